@@ -1,4 +1,15 @@
 from .version import VERSION
-from .exceptions import DcmtError, DcmtParameterError
+from .exceptions import DcmtError, DcmtParameterError, DcmtTimeoutError
 from .pyrandom import DcmtRandom
-from .numpyrandom import DcmtRandomState, mt_range
+from .numpyrandom import DcmtRandomState, DcmtRandomLanes, mt_range, iter_mt_range
+from .catalog import Catalog, write_catalog
+from .background import search_async
+from . import pyrandom as _pyrandom, numpyrandom as _numpyrandom
+
+def set_cache_file(path):
+	"""
+	Keep found RNG parameters in the file ``path`` (``None`` switches the cache off).
+	Both extension modules have their own copy of the library, so both are set.
+	"""
+	_pyrandom.set_cache_file(path)
+	_numpyrandom.set_cache_file(path)
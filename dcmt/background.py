@@ -0,0 +1,133 @@
+"""
+Searches for RNG parameters in a pool of background threads.
+The searches release the GIL, so other Python threads keep running meanwhile.
+"""
+
+import threading
+
+try:
+	from concurrent.futures import ThreadPoolExecutor as _Executor, Future
+except ImportError:
+	_Executor = None
+
+try:
+	import queue
+except ImportError:
+	import Queue as queue
+
+
+class SearchTimeoutError(Exception):
+	"""Thrown by Future.result() if the search is not finished in time (Python 2 only)"""
+	pass
+
+
+if _Executor is None:
+
+	class Future(object):
+		"""Minimal analogue of concurrent.futures.Future for Python without it"""
+
+		def __init__(self):
+			self._cond = threading.Condition()
+			self._done = False
+			self._result = None
+			self._exception = None
+			self._callbacks = []
+
+		def cancel(self):
+			return False
+
+		def cancelled(self):
+			return False
+
+		def done(self):
+			with self._cond:
+				return self._done
+
+		def _wait(self, timeout):
+			with self._cond:
+				if not self._done:
+					self._cond.wait(timeout)
+				if not self._done:
+					raise SearchTimeoutError()
+
+		def result(self, timeout=None):
+			self._wait(timeout)
+			if self._exception is not None:
+				raise self._exception
+			return self._result
+
+		def exception(self, timeout=None):
+			self._wait(timeout)
+			return self._exception
+
+		def add_done_callback(self, fn):
+			with self._cond:
+				if not self._done:
+					self._callbacks.append(fn)
+					return
+			fn(self)
+
+		def _set(self, result, exception):
+			with self._cond:
+				self._result = result
+				self._exception = exception
+				self._done = True
+				self._cond.notify_all()
+				callbacks, self._callbacks = self._callbacks, []
+			for fn in callbacks:
+				fn(self)
+
+	class _Executor(object):
+		"""Minimal analogue of concurrent.futures.ThreadPoolExecutor"""
+
+		def __init__(self, max_workers):
+			self._max_workers = max_workers
+			self._queue = queue.Queue()
+			self._threads = []
+			self._lock = threading.Lock()
+
+		def submit(self, fn, *args, **kwds):
+			future = Future()
+			self._queue.put((future, fn, args, kwds))
+			with self._lock:
+				if len(self._threads) < self._max_workers:
+					thread = threading.Thread(target=self._work)
+					thread.daemon = True
+					thread.start()
+					self._threads.append(thread)
+			return future
+
+		def _work(self):
+			while True:
+				future, fn, args, kwds = self._queue.get()
+				try:
+					result = fn(*args, **kwds)
+				except BaseException as e:
+					future._set(None, e)
+				else:
+					future._set(result, None)
+
+
+_executor = None
+_executor_lock = threading.Lock()
+
+def _default_workers():
+	try:
+		import multiprocessing
+		return multiprocessing.cpu_count()
+	except (ImportError, NotImplementedError):
+		return 2
+
+def search_async(func, *args, **kwds):
+	"""
+	Calls ``func(*args, **kwds)`` in a background thread, where ``func`` is one of the functions
+	which search for RNG parameters (for example, ``DcmtRandomState`` or ``mt_range``),
+	and returns a Future with its result.
+	"""
+	global _executor
+
+	with _executor_lock:
+		if _executor is None:
+			_executor = _Executor(max_workers=_default_workers())
+
+	return _executor.submit(func, *args, **kwds)
@@ -0,0 +1,132 @@
+"""
+Loader of the catalogs of precomputed parameters written by ``mkcatalog``
+(see ``src/dcmt/lib/catalog.c`` for the file format).
+"""
+
+import os
+import struct
+import numpy
+
+from .exceptions import DcmtError, DcmtParameterError
+from .numpyrandom import DcmtRandomState, mt_range
+
+_MAGIC = b'DCMTCAT\0'
+_VERSION = 1
+_HEADER_SIZE = 128
+_SEARCH_SERIAL = 0
+_SEARCH_ID_STREAM = 1
+
+# catalog_header_t; the numbers are in the native byte order
+_HEADER = struct.Struct('=8s8I4i3I4i2I')
+_HEADER_FIELDS = ('magic', 'version', 'header_size', 'w', 'p', 'seed', 'search',
+	'start_id', 'count', 'mm', 'nn', 'rr', 'ww', 'wmask', 'umask', 'lmask',
+	'shift0', 'shift1', 'shiftB', 'shiftC', 'data_checksum', 'checksum')
+_COMMON_FIELDS = ('mm', 'nn', 'rr', 'ww', 'wmask', 'umask', 'lmask',
+	'shift0', 'shift1', 'shiftB', 'shiftC')
+
+def _fnv1a(data):
+	h = 2166136261
+	for c in bytearray(data):
+		h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+	return h
+
+def write_catalog(path, *args, **kwds):
+	"""
+	Writes a catalog of the generators created by ``mt_range(*args, **kwds)``
+	(``gen_seed`` must be an integer); same as ``mkcatalog``, which is faster for large ranges.
+	"""
+	if not isinstance(kwds.get('gen_seed'), (int, long)):
+		raise DcmtParameterError("Catalog needs an integer gen_seed")
+	if kwds.get('tempering') not in (None, 'hard'):
+		raise DcmtParameterError("Catalog needs the 'hard' tempering")
+	start = args[0] if len(args) == 2 else 0
+	mt_common, mt_unique = mt_range(*args, **kwds)
+
+	records = numpy.ascontiguousarray(mt_unique, numpy.uint32).copy()
+	records[:, 3] = 0
+	data = records.tostring()
+
+	header = dict(mt_common)
+	header.update(magic=_MAGIC, version=_VERSION, header_size=_HEADER_SIZE,
+		w=kwds.get('wordlen', 32), p=kwds.get('exponent', 521),
+		seed=kwds['gen_seed'] & 0xFFFFFFFF,
+		search=_SEARCH_SERIAL if kwds.get('n_threads') is None else _SEARCH_ID_STREAM,
+		start_id=start, count=records.shape[0],
+		data_checksum=_fnv1a(data), checksum=0)
+	raw_header = _HEADER.pack(*[header[name] for name in _HEADER_FIELDS])
+	raw_header = raw_header[:-4] + struct.pack('=I', _fnv1a(raw_header[:-4]))
+
+	# readers of the old file keep their map of it
+	tmp_path = path + '.tmp'
+	try:
+		with open(tmp_path, 'wb') as f:
+			f.write(raw_header + b'\0' * (_HEADER_SIZE - len(raw_header)))
+			f.write(data)
+		os.rename(tmp_path, path)
+	except:
+		if os.path.exists(tmp_path):
+			os.remove(tmp_path)
+		raise
+
+
+class Catalog(object):
+	"""
+	Parameters of the generators for a range of IDs, memory mapped from a catalog file.
+	Nothing is copied from the file until a generator is created,
+	and the records are only checked by check().
+	"""
+
+	def __init__(self, path):
+		with open(path, 'rb') as f:
+			raw_header = f.read(_HEADER.size)
+			f.seek(0, 2)
+			size = f.tell()
+
+		if len(raw_header) < _HEADER.size:
+			raise DcmtError(path + ": not a catalog")
+		header = dict(zip(_HEADER_FIELDS, _HEADER.unpack(raw_header)))
+		if header['magic'] != _MAGIC or header['version'] != _VERSION or \
+				header['checksum'] != _fnv1a(raw_header[:-4]) or \
+				size != header['header_size'] + header['count'] * 16:
+			raise DcmtError(path + ": not a catalog")
+
+		self.wordlen = header['w']
+		self.exponent = header['p']
+		self.gen_seed = header['seed']
+		self.start_id = header['start_id']
+		self.stop_id = header['start_id'] + header['count']
+		self._data_checksum = header['data_checksum']
+
+		self.mt_common = dict((name, header[name]) for name in _COMMON_FIELDS)
+		self.mt_unique = numpy.memmap(path, dtype=numpy.uint32, mode='r',
+			offset=header['header_size'], shape=(header['count'], 4))
+
+	def __len__(self):
+		return self.stop_id - self.start_id
+
+	def _index(self, id):
+		if id < self.start_id or id >= self.stop_id:
+			raise DcmtParameterError("ID must lie between " + str(self.start_id) +
+				" and " + str(self.stop_id - 1))
+		return id - self.start_id
+
+	def check(self):
+		"""Returns True if the records match the checksum in the header (reads the whole file)"""
+		return _fnv1a(self.mt_unique.tostring()) == self._data_checksum
+
+	def mt_range(self, *args):
+		"""
+		Analogue of mt_range() for the IDs in range(start, stop) of the catalog;
+		unlike mt_range(), start defaults to start_id, not 0.
+		"""
+		start, stop = (self.start_id, args[0]) if len(args) == 1 else args
+		i = self._index(start)
+		j = self._index(stop - 1) + 1
+		return dict(self.mt_common), self.mt_unique[i:j]
+
+	def random_state(self, id, seed=None):
+		"""Returns DcmtRandomState with parameters for the given ID"""
+		i = self._index(id)
+		rng, = DcmtRandomState.from_mt_range(self.mt_common, self.mt_unique[i:i + 1])
+		rng.seed(seed)
+		return rng
@@ -3,3 +3,6 @@ class DcmtError(Exception):
 
 class DcmtParameterError(DcmtError):
 	pass
+
+class DcmtTimeoutError(DcmtError):
+	pass
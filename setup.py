@@ -5,19 +5,17 @@ if not (major == 2 and minor >= 5):
 	print("Python >=2.5 is required to use this module.")
 	sys.exit(1)
 
+# the wrappers are generated from .pyx at build time, and are not shipped
 try:
-    from Cython.Distutils import build_ext
-    has_cython = True
-except:
-    has_cython = False
+	from Cython.Distutils import build_ext
+except ImportError:
+	print("Cython is required to build this module.")
+	sys.exit(1)
 
 try:
 	from distutils.core import setup, Extension
 except ImportError:
 	from setuptools import setup, Extension
-	# In order to work with Cython, setuptools needs a weird hack involving
-	# fake Pyrex module. I do not really want to do that.
-	has_cython = False
 
 def get_symbol(path, symbol):
 	full_path = os.path.join(setup_dir, *path)
@@ -60,10 +58,14 @@ class NumpyExtension(Extension):
 
 
 c_sources = [
+	'src/dcmt/lib/cache.c',
+	'src/dcmt/lib/catalog.c',
 	'src/dcmt/lib/check32.c',
 	'src/dcmt/lib/eqdeg.c',
 	'src/dcmt/lib/genmtrand.c',
+	'src/dcmt/lib/gf2x.c',
 	'src/dcmt/lib/init.c',
+	'src/dcmt/lib/lanes.c',
 	'src/dcmt/lib/mt19937.c',
 	'src/dcmt/lib/prescr.c',
 	'src/dcmt/lib/seive.c',
@@ -73,18 +75,20 @@ c_sources = [
 
 pyrandom = Extension("dcmt.pyrandom",
 	include_dirs = ['src/dcmt/include', 'src/dcmt/lib'],
-	extra_compile_args = ['-Wall', '-Wmissing-prototypes', '-O3', '-std=c99'],
-	sources = c_sources + ['src/wrapper/pyrandom.' + ('pyx' if has_cython else 'c')])
+	extra_compile_args = ['-Wall', '-Wmissing-prototypes', '-O3', '-std=c99', '-pthread'],
+	extra_link_args = ['-pthread'],
+	sources = c_sources + ['src/wrapper/pyrandom.pyx'])
 
 numpyrandom = NumpyExtension("dcmt.numpyrandom",
 	include_dirs = ['src/dcmt/include', 'src/dcmt/lib'],
-	extra_compile_args = ['-Wall', '-Wmissing-prototypes', '-O3', '-std=c99'],
-	sources = c_sources + ['src/wrapper/numpyrandom.' + ('pyx' if has_cython else 'c')])
+	extra_compile_args = ['-Wall', '-Wmissing-prototypes', '-O3', '-std=c99', '-pthread'],
+	extra_link_args = ['-pthread'],
+	sources = c_sources + ['src/wrapper/numpyrandom.pyx'])
 
 setup(
 	name='dcmt',
 	packages=['dcmt'],
-	cmdclass={'build_ext': build_ext} if has_cython else {},
+	cmdclass={'build_ext': build_ext},
 	ext_modules=[pyrandom, numpyrandom],
 	requires=['numpy'],
 	install_requires=['numpy'],
@@ -20,6 +20,7 @@
 #define DYNAMIC_CREATION
 
 #include <inttypes.h> /* C99 compiler */
+#include <stddef.h> /* size_t */
 
 typedef struct {
     uint32_t aaa;
@@ -31,6 +32,67 @@ typedef struct {
     uint32_t *state;
 }mt_struct;
 
+/* period check engines (dc_opts.period_check) */
+#define DC_PERIOD_DECIMATION 0 /* decimation of the generated sequence */
+#define DC_PERIOD_BM 1 /* Berlekamp-Massey and t^(2^p) mod f(t) */
+#define DC_PERIOD_BITSLICED 2 /* decimation of 64 candidates at once */
+
+/* depth of the tempering search (dc_opts.temper_depth) */
+#define DC_TEMPER_GREEDY 0 /* the masks are chosen one bit at a time */
+#define DC_TEMPER_HARD 15  /* their first 15 bits are searched exhaustively,
+			      the rest greedily; the default */
+
+/* why a search was stopped (*dc_opts.cancel after the search) */
+#define DC_CANCELLED 1 /* by *cancel or the progress callback */
+#define DC_TIMED_OUT 2 /* time_limit has run out */
+
+/* IDs found and candidates drawn so far by the search; a nonzero
+   return value cancels it */
+typedef int (*dc_progress_callback)(int ids_done, long candidates,
+				    void *arg);
+
+/* work done by the search for one ID, see dc_opts.stats; the counts
+   go up to the accepted candidate, whichever way it was checked */
+typedef struct {
+    long candidates;    /* parameters "a" drawn */
+    long rejected;      /* of them, rejected by the prescreening */
+    long period_checks; /* of the others, checked for the period */
+    long mask_nodes;    /* MaskNodes made by the tempering search */
+    long masks_pruned;  /* its mask evaluations cut short, temper_prune */
+    /* of the generator found, the sum of [p/v] - k(v) for v = 1..w,
+       where k(v) is its dimension of equidistribution to v bits */
+    int k_deficit;
+    /* wall time in seconds: */
+    double prescreen_time; /* drawing and prescreening the candidates */
+    double period_time;
+    double temper_time;
+}dc_stats;
+
+/* search options; init_dc_opts() sets the defaults */
+typedef struct {
+    /* ranges: 0 -- IDs share one stream, >0 -- one stream per ID;
+       single ID: >1 -- candidates are checked by n_threads threads */
+    int n_threads;
+    int period_check;
+    /* checked before every period check: */
+    double time_limit; /* seconds per search call, 0 -- none */
+    volatile int *cancel; /* nonzero *cancel stops the search; set to
+			     DC_CANCELLED or DC_TIMED_OUT if stopped */
+    dc_progress_callback progress; /* called by the calling thread only */
+    void *progress_arg;
+    /* if not NULL, stats[id - start_id] (stats[0] for a single ID) is
+       filled for every ID searched; all zeros if it came from the cache */
+    dc_stats *stats;
+    /* 1 -- the tempering search stops evaluating the masks which are
+       shown to be worse than one before them, 0 -- every mask is
+       evaluated in full; the result is the same */
+    int temper_prune;
+    /* DC_TEMPER_* or the number of bits 0..31 searched exhaustively (at
+       most w-1); lower ones are faster, but the generators found are
+       less equidistributed (see dc_stats.k_deficit) */
+    int temper_depth;
+}dc_opts;
+
 /* old interface */
 void init_dc(uint32_t seed);
 mt_struct *get_mt_parameter(int w, int p);
@@ -42,10 +104,69 @@ mt_struct *get_mt_parameter_st(int w, int p, uint32_t seed);
 mt_struct *get_mt_parameter_id_st(int w, int p, int id, uint32_t seed);
 mt_struct **get_mt_parameters_st(int w, int p, int start_id, int max_id,
 				 uint32_t seed, int *count);
+mt_struct **get_mt_parameters_mt_st(int w, int p, int start_id, int max_id,
+				    uint32_t seed, int n_threads, int *count);
+void init_dc_opts(dc_opts *opts);
+mt_struct *get_mt_parameter_id_opt_st(int w, int p, int id, uint32_t seed,
+				      const dc_opts *opts);
+mt_struct **get_mt_parameters_opt_st(int w, int p, int start_id, int max_id,
+				     uint32_t seed, const dc_opts *opts,
+				     int *count);
+/* streaming range search with checkpoints, see seive.c */
+typedef struct MT_RANGE_SEARCH_T mt_range_search;
+/* gets every generator (in the order of IDs) and owns it; a nonzero
+   return value stops the search */
+typedef int (*mt_range_callback)(mt_struct *mts, int id, void *arg);
+#define MT_RANGE_DONE 0
+#define MT_RANGE_STOPPED 1
+#define MT_RANGE_FAILED (-1)
+#define MT_RANGE_CANCELLED 2 /* see dc_opts.cancel */
+#define MT_RANGE_CHECKPOINT_SIZE 2560 /* bytes */
+mt_range_search *new_mt_range_search(int w, int p, int start_id, int max_id,
+				     uint32_t seed, const dc_opts *opts);
+mt_range_search *resume_mt_range_search(const void *checkpoint,
+					const dc_opts *opts);
+int run_mt_range_search(mt_range_search *search,
+			mt_range_callback callback, void *arg);
+int mt_range_search_next_id(const mt_range_search *search);
+void mt_range_search_checkpoint(const mt_range_search *search,
+				void *checkpoint);
+void free_mt_range_search(mt_range_search *search);
+
+/* persistent cache of the *_st functions; NULL switches it off */
+int set_mt_cache_file(const char *path);
+
+/* catalog of precomputed parameters, see catalog.c */
+#define DC_CATALOG_SERIAL 0    /* found by get_mt_parameters_st() */
+#define DC_CATALOG_ID_STREAM 1 /* found by get_mt_parameters_mt_st() */
+typedef struct MT_CATALOG_T mt_catalog;
+int write_mt_catalog(const char *path, mt_struct **mtss, int count,
+		     int start_id, uint32_t seed, int search);
+mt_catalog *open_mt_catalog(const char *path);
+int check_mt_catalog(const mt_catalog *cat);
+void close_mt_catalog(mt_catalog *cat);
+int mt_catalog_info(const mt_catalog *cat, int *w, int *p, uint32_t *seed,
+		    int *start_id);
+mt_struct *get_mt_parameter_catalog(const mt_catalog *cat, int id);
 /* common */
 void free_mt_struct(mt_struct *mts);
 void free_mt_struct_array(mt_struct **mtss, int count);
 void sgenrand_mt(uint32_t seed, mt_struct *mts);
 uint32_t genrand_mt(mt_struct *mts);
+/* many outputs at once, see genmtrand.c */
+void dcmt_fill_uint32(mt_struct *mts, uint32_t *out, size_t n);
+void dcmt_fill_double(mt_struct *mts, double *out, size_t n);
+/* computes the next nn words of the state and sets mts->i = 0, as
+   genrand_mt() does every nn outputs */
+typedef void (*dcmt_next_state_fn)(mt_struct *mts);
+dcmt_next_state_fn dcmt_next_state_kernel(const mt_struct *mts);
+/* generators of one range advanced together, see lanes.c */
+typedef struct MT_LANES_T mt_lanes;
+mt_lanes *new_mt_lanes(mt_struct **mtss, int count);
+void free_mt_lanes(mt_lanes *lanes);
+int mt_lanes_count(const mt_lanes *lanes);
+void mt_lanes_get(const mt_lanes *lanes, int l, mt_struct *mts);
+void mt_lanes_fill_uint32(mt_lanes *lanes, uint32_t *out, size_t n);
+void mt_lanes_fill_double(mt_lanes *lanes, double *out, size_t n);
 
 #endif
@@ -0,0 +1,347 @@
+/* cache.c */
+
+/* This library is free software; you can redistribute it and/or   */
+/* modify it under the terms of the GNU Library General Public     */
+/* License as published by the Free Software Foundation; either    */
+/* version 2 of the License, or (at your option) any later         */
+/* version.                                                        */
+/* This library is distributed in the hope that it will be useful, */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of  */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.            */
+/* See the GNU Library General Public License for more details.    */
+/* You should have received a copy of the GNU Library General      */
+/* Public License along with this library; if not, write to the    */
+/* Free Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA   */
+/* 02111-1307  USA                                                 */
+
+/*
+   Persistent cache of found parameters, see set_mt_cache_file().
+
+   The file is a header followed by records appended to its end.  The
+   header holds a hash table of CACHE_BUCKETS chains; every record
+   points to the previous record of its chain, so a lookup reads only
+   a few records of the memory mapped file.  The header and every
+   record carry a checksum; a file with an unknown version or a broken
+   header is never used or modified, a broken record is ignored.
+
+   Lookups hold a shared flock() of the file and stores an exclusive
+   one, so any number of processes (and threads, each with its own
+   dc_cache_t) may use the same file at once.  A store writes the
+   record before it is linked into its chain, so a crash leaves at
+   most an unreachable record behind.
+*/
+
+#define _DEFAULT_SOURCE /* flock() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "dci.h"
+
+#define CACHE_MAGIC "DCMTPAR"
+#define CACHE_VERSION 1
+#define CACHE_BUCKETS 4096
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t n_buckets;
+    uint32_t checksum; /* of the fields above */
+    uint64_t heads[CACHE_BUCKETS]; /* last record of a chain, 0 if none */
+} cache_header_t;
+
+typedef struct {
+    dc_cache_key_t key;
+    uint32_t aaa;
+    int32_t mm, nn, rr, ww;
+    uint32_t wmask, umask, lmask;
+    int32_t shift0, shift1, shiftB, shiftC;
+    uint32_t maskB, maskC;
+    uint64_t next; /* previous record of the chain, 0 if none */
+    uint32_t checksum; /* of the fields above */
+    uint32_t pad;
+} cache_record_t;
+
+static char *cache_path = NULL;
+static pthread_mutex_t cache_path_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void header_init(cache_header_t *h);
+static int header_ok(const cache_header_t *h);
+static uint32_t bucket(const dc_cache_key_t *key);
+static int remap(dc_cache_t *cache);
+static const cache_record_t *find(dc_cache_t *cache,
+				  const dc_cache_key_t *key);
+
+/* FNV-1a hash, the checksum of the cache and catalog files */
+uint32_t _fnv1a_dc(const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    uint32_t h = UINT32_C(2166136261);
+    size_t i;
+
+    for (i=0; i<size; i++) {
+	h ^= p[i];
+	h *= UINT32_C(16777619);
+    }
+    return h;
+}
+
+static void header_init(cache_header_t *h)
+{
+    memset(h, 0, sizeof(cache_header_t));
+    memcpy(h->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    h->version = CACHE_VERSION;
+    h->record_size = sizeof(cache_record_t);
+    h->n_buckets = CACHE_BUCKETS;
+    h->checksum = _fnv1a_dc(h, offsetof(cache_header_t, checksum));
+}
+
+static int header_ok(const cache_header_t *h)
+{
+    return (0 == memcmp(h->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)))
+	&& (h->version == CACHE_VERSION)
+	&& (h->record_size == sizeof(cache_record_t))
+	&& (h->n_buckets == CACHE_BUCKETS)
+	&& (h->checksum == _fnv1a_dc(h, offsetof(cache_header_t, checksum)));
+}
+
+static uint32_t bucket(const dc_cache_key_t *key)
+{
+    return _fnv1a_dc(key, sizeof(dc_cache_key_t)) % CACHE_BUCKETS;
+}
+
+/*
+   Sets the cache file used by the *_st functions, or switches the
+   cache off if path is NULL.  Returns 0 on success, -1 if out of
+   memory (the cache is then switched off).
+*/
+int set_mt_cache_file(const char *path)
+{
+    char *copy = NULL;
+    int res = 0;
+
+    if (NULL != path) {
+	copy = (char *)malloc(strlen(path) + 1);
+	if (NULL == copy)
+	    res = -1;
+	else
+	    strcpy(copy, path);
+    }
+
+    pthread_mutex_lock(&cache_path_lock);
+    free(cache_path);
+    cache_path = copy;
+    pthread_mutex_unlock(&cache_path_lock);
+
+    return res;
+}
+
+/*
+   Opens the current cache file, creating it if needed.  Returns 0 on
+   success, -1 if there is no cache file or it cannot be used; in
+   the latter case the lookups and stores just do nothing.
+*/
+int _OpenCache_dc(dc_cache_t *cache)
+{
+    cache_header_t h;
+    struct stat st;
+    int fd;
+
+    cache->fd = -1;
+    cache->map = NULL;
+    cache->size = 0;
+
+    pthread_mutex_lock(&cache_path_lock);
+    fd = (NULL == cache_path) ? -1
+	: open(cache_path, O_RDWR | O_CREAT, 0666);
+    pthread_mutex_unlock(&cache_path_lock);
+    if (fd < 0) return -1;
+
+    if (0 != flock(fd, LOCK_EX)) {
+	close(fd);
+	return -1;
+    }
+    if (0 != fstat(fd, &st)) goto fail;
+    if (st.st_size == 0) {
+	/* a new file */
+	header_init(&h);
+	if ((ssize_t)sizeof(h) != pwrite(fd, &h, sizeof(h), 0))
+	    goto fail;
+    }
+    else if ( (st.st_size < (off_t)sizeof(h))
+	      || ((ssize_t)sizeof(h) != pread(fd, &h, sizeof(h), 0))
+	      || !header_ok(&h) )
+	goto fail;
+    flock(fd, LOCK_UN);
+
+    cache->fd = fd;
+    return 0;
+
+ fail:
+    flock(fd, LOCK_UN);
+    close(fd);
+    return -1;
+}
+
+void _CloseCache_dc(dc_cache_t *cache)
+{
+    if (NULL != cache->map)
+	munmap(cache->map, cache->size);
+    if (cache->fd >= 0)
+	close(cache->fd);
+    cache->fd = -1;
+    cache->map = NULL;
+    cache->size = 0;
+}
+
+/* maps the whole file; the caller holds the lock */
+static int remap(dc_cache_t *cache)
+{
+    struct stat st;
+    void *map;
+
+    if (0 != fstat(cache->fd, &st)) return -1;
+    if ((size_t)st.st_size == cache->size) return 0;
+
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, cache->fd, 0);
+    if (MAP_FAILED == map) return -1;
+    if (NULL != cache->map)
+	munmap(cache->map, cache->size);
+    cache->map = map;
+    cache->size = st.st_size;
+
+    return 0;
+}
+
+/* the caller holds the lock and has called remap() */
+static const cache_record_t *find(dc_cache_t *cache,
+				  const dc_cache_key_t *key)
+{
+    const cache_header_t *h = (const cache_header_t *)cache->map;
+    const cache_record_t *rec;
+    uint64_t off;
+
+    off = h->heads[bucket(key)];
+    while (off != 0) {
+	if ( (off < sizeof(cache_header_t))
+	     || (off + sizeof(cache_record_t) > cache->size) )
+	    return NULL;
+	rec = (const cache_record_t *)((const char *)cache->map + off);
+	if (rec->checksum
+	    != _fnv1a_dc(rec, offsetof(cache_record_t, checksum)))
+	    return NULL;
+	if (0 == memcmp(&rec->key, key, sizeof(dc_cache_key_t)))
+	    return rec;
+	/* chains only go towards the beginning of the file */
+	if (rec->next >= off) return NULL;
+	off = rec->next;
+    }
+
+    return NULL;
+}
+
+/*
+   Fills the parameters of mts (which has the state vector allocated)
+   from the cache.  Returns 1 if key was found, 0 otherwise.
+*/
+int _CacheLookup_dc(dc_cache_t *cache, const dc_cache_key_t *key,
+		    mt_struct *mts)
+{
+    const cache_record_t *rec = NULL;
+
+    if (cache->fd < 0) return 0;
+
+    flock(cache->fd, LOCK_SH);
+    if (0 == remap(cache))
+	rec = find(cache, key);
+    if (NULL != rec) {
+	mts->aaa = rec->aaa;
+	mts->mm = rec->mm;
+	mts->nn = rec->nn;
+	mts->rr = rec->rr;
+	mts->ww = rec->ww;
+	mts->wmask = rec->wmask;
+	mts->umask = rec->umask;
+	mts->lmask = rec->lmask;
+	mts->shift0 = rec->shift0;
+	mts->shift1 = rec->shift1;
+	mts->shiftB = rec->shiftB;
+	mts->shiftC = rec->shiftC;
+	mts->maskB = rec->maskB;
+	mts->maskC = rec->maskC;
+	mts->i = 0;
+    }
+    flock(cache->fd, LOCK_UN);
+
+    return NULL != rec;
+}
+
+/*
+   Adds the parameters of mts to the cache, unless key is already
+   there.  Returns 0 on success, -1 if the cache could not be written.
+*/
+int _CacheStore_dc(dc_cache_t *cache, const dc_cache_key_t *key,
+		   const mt_struct *mts)
+{
+    cache_record_t rec;
+    const cache_header_t *h;
+    uint64_t off, head;
+    uint32_t b;
+    int res;
+
+    if (cache->fd < 0) return -1;
+
+    flock(cache->fd, LOCK_EX);
+    if (0 != remap(cache)) {
+	flock(cache->fd, LOCK_UN);
+	return -1;
+    }
+    if (NULL != find(cache, key)) {
+	flock(cache->fd, LOCK_UN);
+	return 0;
+    }
+
+    b = bucket(key);
+    h = (const cache_header_t *)cache->map;
+    head = h->heads[b];
+    /* after a failed store the file may end with a part of a record */
+    off = (cache->size + 7) & ~(uint64_t)7;
+
+    memset(&rec, 0, sizeof(rec));
+    rec.key = *key;
+    rec.aaa = mts->aaa;
+    rec.mm = mts->mm;
+    rec.nn = mts->nn;
+    rec.rr = mts->rr;
+    rec.ww = mts->ww;
+    rec.wmask = mts->wmask;
+    rec.umask = mts->umask;
+    rec.lmask = mts->lmask;
+    rec.shift0 = mts->shift0;
+    rec.shift1 = mts->shift1;
+    rec.shiftB = mts->shiftB;
+    rec.shiftC = mts->shiftC;
+    rec.maskB = mts->maskB;
+    rec.maskC = mts->maskC;
+    rec.next = head;
+    rec.checksum = _fnv1a_dc(&rec, offsetof(cache_record_t, checksum));
+
+    /* the record first, then the link to it */
+    res = -1;
+    if ( ((ssize_t)sizeof(rec) == pwrite(cache->fd, &rec, sizeof(rec), off))
+	 && ((ssize_t)sizeof(off)
+	     == pwrite(cache->fd, &off, sizeof(off),
+		       offsetof(cache_header_t, heads) + b*sizeof(uint64_t))) )
+	res = 0;
+    flock(cache->fd, LOCK_UN);
+
+    return res;
+}
@@ -0,0 +1,264 @@
+/* catalog.c */
+
+/* This library is free software; you can redistribute it and/or   */
+/* modify it under the terms of the GNU Library General Public     */
+/* License as published by the Free Software Foundation; either    */
+/* version 2 of the License, or (at your option) any later         */
+/* version.                                                        */
+/* This library is distributed in the hope that it will be useful, */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of  */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.            */
+/* See the GNU Library General Public License for more details.    */
+/* You should have received a copy of the GNU Library General      */
+/* Public License along with this library; if not, write to the    */
+/* Free Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA   */
+/* 02111-1307  USA                                                 */
+
+/*
+   Catalog of precomputed parameters of a range of IDs, written by
+   mkcatalog ("make catalog").
+
+   The file is a catalog_header_t padded to CATALOG_HEADER_SIZE
+   bytes, which holds the parameters shared by all generators, followed
+   by one record of 4 uint32_t per ID: aaa, maskB, maskC and 0.  This
+   is the layout of the result of mt_range() in the Python module, so
+   the records can be used from a memory map as they are.  All numbers
+   are in the byte order of the machine which wrote the file.
+
+   open_mt_catalog() maps the file and checks the header only, so
+   opening takes the same time for any number of IDs;
+   check_mt_catalog() also checks the checksum of the records.
+*/
+
+#define _DEFAULT_SOURCE /* mmap() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "dci.h"
+
+#define CATALOG_MAGIC "DCMTCAT"
+#define CATALOG_VERSION 1
+#define CATALOG_HEADER_SIZE 128
+#define CATALOG_RECORD_WORDS 4
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t w, p, seed;
+    uint32_t search; /* DC_CATALOG_* */
+    uint32_t start_id, count;
+    int32_t mm, nn, rr, ww;
+    uint32_t wmask, umask, lmask;
+    int32_t shift0, shift1, shiftB, shiftC;
+    uint32_t data_checksum; /* of the records */
+    uint32_t checksum; /* of the fields above */
+} catalog_header_t;
+
+struct MT_CATALOG_T {
+    void *map;
+    size_t size;
+    const catalog_header_t *h;
+    const uint32_t *records;
+};
+
+static int header_ok(const catalog_header_t *h, size_t size);
+
+/*
+   Writes the parameters of mtss[0..count-1], found for the IDs
+   start_id, ... with the generator seed, to the file path.  search is
+   DC_CATALOG_SERIAL if they were found by get_mt_parameters_st(), or
+   DC_CATALOG_ID_STREAM if by get_mt_parameters_mt_st().  The file is
+   replaced atomically.  Returns 0 on success, -1 on failure.
+*/
+int write_mt_catalog(const char *path, mt_struct **mtss, int count,
+		     int start_id, uint32_t seed, int search)
+{
+    unsigned char header[CATALOG_HEADER_SIZE];
+    catalog_header_t h;
+    uint32_t *records;
+    char *tmp_path;
+    FILE *fp;
+    size_t size;
+    int i, res;
+
+    if (count < 1) return -1;
+
+    size = (size_t)count*CATALOG_RECORD_WORDS*sizeof(uint32_t);
+    records = (uint32_t *)malloc(size);
+    tmp_path = (char *)malloc(strlen(path) + 5);
+    if (NULL == records || NULL == tmp_path) {
+	free(records);
+	free(tmp_path);
+	return -1;
+    }
+    for (i=0; i<count; i++) {
+	records[i*CATALOG_RECORD_WORDS + 0] = mtss[i]->aaa;
+	records[i*CATALOG_RECORD_WORDS + 1] = mtss[i]->maskB;
+	records[i*CATALOG_RECORD_WORDS + 2] = mtss[i]->maskC;
+	records[i*CATALOG_RECORD_WORDS + 3] = 0;
+    }
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, CATALOG_MAGIC, sizeof(CATALOG_MAGIC));
+    h.version = CATALOG_VERSION;
+    h.header_size = CATALOG_HEADER_SIZE;
+    h.w = mtss[0]->ww;
+    h.p = mtss[0]->nn * mtss[0]->ww - mtss[0]->rr;
+    h.seed = seed;
+    h.search = search;
+    h.start_id = start_id;
+    h.count = count;
+    h.mm = mtss[0]->mm;
+    h.nn = mtss[0]->nn;
+    h.rr = mtss[0]->rr;
+    h.ww = mtss[0]->ww;
+    h.wmask = mtss[0]->wmask;
+    h.umask = mtss[0]->umask;
+    h.lmask = mtss[0]->lmask;
+    h.shift0 = mtss[0]->shift0;
+    h.shift1 = mtss[0]->shift1;
+    h.shiftB = mtss[0]->shiftB;
+    h.shiftC = mtss[0]->shiftC;
+    h.data_checksum = _fnv1a_dc(records, size);
+    h.checksum = _fnv1a_dc(&h, offsetof(catalog_header_t, checksum));
+    memset(header, 0, sizeof(header));
+    memcpy(header, &h, sizeof(h));
+
+    /* readers of the old file keep their map of it */
+    sprintf(tmp_path, "%s.tmp", path);
+    res = -1;
+    fp = fopen(tmp_path, "wb");
+    if (NULL != fp) {
+	if ( (1 == fwrite(header, sizeof(header), 1, fp))
+	     && (1 == fwrite(records, size, 1, fp)) )
+	    res = 0;
+	if (0 != fclose(fp)) res = -1;
+	if (0 == res && 0 != rename(tmp_path, path)) res = -1;
+	if (0 != res) remove(tmp_path);
+    }
+
+    free(records);
+    free(tmp_path);
+    return res;
+}
+
+static int header_ok(const catalog_header_t *h, size_t size)
+{
+    return (size >= CATALOG_HEADER_SIZE)
+	&& (0 == memcmp(h->magic, CATALOG_MAGIC, sizeof(CATALOG_MAGIC)))
+	&& (h->version == CATALOG_VERSION)
+	&& (h->header_size == CATALOG_HEADER_SIZE)
+	&& (h->checksum == _fnv1a_dc(h, offsetof(catalog_header_t, checksum)))
+	&& (h->count > 0)
+	&& (size == CATALOG_HEADER_SIZE
+	    + (size_t)h->count*CATALOG_RECORD_WORDS*sizeof(uint32_t));
+}
+
+/* Returns NULL if the file cannot be read or is not a valid catalog */
+mt_catalog *open_mt_catalog(const char *path)
+{
+    mt_catalog *cat;
+    struct stat st;
+    void *map;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    if (0 != fstat(fd, &st) || st.st_size < CATALOG_HEADER_SIZE) {
+	close(fd);
+	return NULL;
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == map) return NULL;
+
+    if (!header_ok((const catalog_header_t *)map, st.st_size)) {
+	munmap(map, st.st_size);
+	return NULL;
+    }
+
+    cat = (mt_catalog *)malloc(sizeof(mt_catalog));
+    if (NULL == cat) {
+	munmap(map, st.st_size);
+	return NULL;
+    }
+    cat->map = map;
+    cat->size = st.st_size;
+    cat->h = (const catalog_header_t *)map;
+    cat->records = (const uint32_t *)((const char *)map + CATALOG_HEADER_SIZE);
+
+    return cat;
+}
+
+/* Returns 1 if the records of the catalog are intact, 0 otherwise */
+int check_mt_catalog(const mt_catalog *cat)
+{
+    return cat->h->data_checksum
+	== _fnv1a_dc(cat->records, cat->size - CATALOG_HEADER_SIZE);
+}
+
+void close_mt_catalog(mt_catalog *cat)
+{
+    if (NULL == cat) return;
+    munmap(cat->map, cat->size);
+    free(cat);
+}
+
+/*
+   Sets *w, *p, *seed and *start_id of the catalog (any of them may be
+   NULL) and returns the number of IDs in it.
+*/
+int mt_catalog_info(const mt_catalog *cat, int *w, int *p, uint32_t *seed,
+		    int *start_id)
+{
+    if (NULL != w) *w = cat->h->w;
+    if (NULL != p) *p = cat->h->p;
+    if (NULL != seed) *seed = cat->h->seed;
+    if (NULL != start_id) *start_id = cat->h->start_id;
+    return cat->h->count;
+}
+
+/* Returns NULL if id is not in the catalog or out of memory */
+mt_struct *get_mt_parameter_catalog(const mt_catalog *cat, int id)
+{
+    const catalog_header_t *h = cat->h;
+    const uint32_t *rec;
+    mt_struct *mts;
+
+    if (id < (int)h->start_id || id - (int)h->start_id >= (int)h->count)
+	return NULL;
+    rec = cat->records + (size_t)(id - h->start_id)*CATALOG_RECORD_WORDS;
+
+    mts = (mt_struct*)malloc(sizeof(mt_struct));
+    if (NULL == mts) return NULL;
+    mts->state = (uint32_t*)malloc(h->nn*sizeof(uint32_t));
+    if (NULL == mts->state) {
+	free(mts);
+	return NULL;
+    }
+
+    mts->aaa = rec[0];
+    mts->maskB = rec[1];
+    mts->maskC = rec[2];
+    mts->mm = h->mm;
+    mts->nn = h->nn;
+    mts->rr = h->rr;
+    mts->ww = h->ww;
+    mts->wmask = h->wmask;
+    mts->umask = h->umask;
+    mts->lmask = h->lmask;
+    mts->shift0 = h->shift0;
+    mts->shift1 = h->shift1;
+    mts->shiftB = h->shiftB;
+    mts->shiftC = h->shiftC;
+    mts->i = 0;
+
+    return mts;
+}
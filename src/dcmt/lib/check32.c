@@ -18,11 +18,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "dci.h"
 #include "mt19937.h"
 
 #define LSB 0x1
 #define WORDLEN 32
+/* the long loops poll the search every POLL_MASK+1 steps */
+#define POLL_MASK 255
 
 #if defined(DEBUG)
 /* period parameters */
@@ -42,6 +45,8 @@ int main(int argc, char **argv)
     check32_t ck;
 
     _sgenrand_dc(&st, 3249);
+    if (0 != _InitCheck32_dc(&ck, NNN, RRR, WWW, DC_PERIOD_DECIMATION))
+	return 1;
 
     for(i=0; i<NREPEAT; i++) {
 	a = next_A(&ck, &st, WWW);
@@ -49,14 +54,19 @@ int main(int argc, char **argv)
 	    printf ("%x\n",a);
 	}
     }
+    _EndCheck32_dc(&ck);
 
     return 0;
 }
 #endif
 
-void _InitCheck32_dc(check32_t *ck, int r, int w)
+/*
+   Returns 0 on success, -1 if the scratch space of the period check
+   could not be allocated.  It is released by _EndCheck32_dc().
+*/
+int _InitCheck32_dc(check32_t *ck, int n, int r, int w, int period_check)
 {
-    int i;
+    int i, p;
 
     /* word_mask (least significant w bits) */
     ck->word_mask = 0xFFFFFFFF;
@@ -69,6 +79,51 @@ void _InitCheck32_dc(check32_t *ck, int r, int w)
     }
     /* upper_mask (most significant (w-r) bits */
     ck->upper_mask = (~ck->lower_mask) & ck->word_mask;
+    ck->period_check = period_check;
+
+    p = n*w-r;
+    ck->x = NULL;
+    ck->bm = NULL;
+    ck->xs = NULL;
+    ck->ctl = NULL;
+    ck->md.f = ck->md.mu = ck->md.acc = ck->md.tmp = NULL;
+    ck->init = (uint32_t*) malloc ((period_check == DC_PERIOD_BITSLICED
+				    ? CHECK_BATCH : 1)*n*sizeof(uint32_t));
+    if (NULL == ck->init) return -1;
+    if (period_check == DC_PERIOD_BM) {
+	ck->bm = (uint64_t*) calloc (4*((2*p)/64 + 2), sizeof(uint64_t));
+	if (NULL == ck->bm || 0 != _gf2x_alloc_mod_dc(&ck->md, p)) {
+	    _EndCheck32_dc(ck);
+	    return -1;
+	}
+    }
+    else if (period_check == DC_PERIOD_BITSLICED) {
+	ck->xs = (uint64_t*) malloc ((2*p+n)*w*sizeof(uint64_t));
+	if (NULL == ck->xs) {
+	    _EndCheck32_dc(ck);
+	    return -1;
+	}
+    }
+    else {
+	ck->x = (uint32_t*) malloc (2*p*sizeof(uint32_t));
+	if (NULL == ck->x) {
+	    _EndCheck32_dc(ck);
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
+void _EndCheck32_dc(check32_t *ck)
+{
+    free(ck->x);
+    free(ck->init);
+    free(ck->bm);
+    free(ck->xs);
+    _gf2x_end_mod_dc(&ck->md);
+    ck->x = ck->init = NULL;
+    ck->bm = ck->xs = NULL;
 }
 
 #if defined(DEBUG)
@@ -88,39 +143,59 @@ static uint32_t next_A(check32_t *ck, _org_state *st, int w)
 }
 #endif
 
+static int check_period_decimation(check32_t *ck, uint32_t a,
+				   const uint32_t *init,
+				   int m, int n, int r, int w);
+static int check_period_bm(check32_t *ck, uint32_t a, const uint32_t *init,
+			   int m, int n, int r, int w);
+static int frobenius_check(check32_t *ck, const uint64_t *c);
+
+/*
+   All engines take the same values from st and agree on the result.
+   ck must be set up by _InitCheck32_dc() with the same n, r, w.
+*/
 int _CheckPeriod_dc(check32_t *ck, _org_state *st,
 		    uint32_t a, int m, int n, int r, int w)
+{
+    _DrawPeriodInit_dc(ck, st, n, ck->init);
+    return _CheckPeriodInit_dc(ck, a, ck->init, m, n, r, w);
+}
+
+/*
+   Same as _CheckPeriod_dc(), with the initial values init[0..n-1]
+   drawn beforehand by _DrawPeriodInit_dc().  init is not modified.
+*/
+int _CheckPeriodInit_dc(check32_t *ck, uint32_t a, const uint32_t *init,
+			int m, int n, int r, int w)
+{
+    if (ck->period_check == DC_PERIOD_BM)
+	return check_period_bm(ck, a, init, m, n, r, w);
+    if (ck->period_check == DC_PERIOD_BITSLICED)
+	return _CheckPeriodBatch_dc(ck, &a, init, 1, m, n, r, w)
+	    ? IRRED : REDU;
+    return check_period_decimation(ck, a, init, m, n, r, w);
+}
+
+static int check_period_decimation(check32_t *ck, uint32_t a,
+				   const uint32_t *init,
+				   int m, int n, int r, int w)
 {
     int i, j, p, pp;
-    uint32_t y, *x, *init, mat[2];
+    uint32_t y, *x, mat[2];
 
 
     p = n*w-r;
-    x = (uint32_t*) malloc (2*p*sizeof(uint32_t));
-    if (NULL==x) {
-	printf("malloc error in \"_CheckPeriod_dc()\"\n");
-	exit(1);
-    }
-
-    init = (uint32_t*) malloc (n*sizeof(uint32_t));
-    if (NULL==init) {
-	printf("malloc error \"_CheckPeriod_dc()\"\n");
-	free(x);
-	exit(1);
-    }
+    x = ck->x;
 
     /* set initial values */
-    for (i=0; i<n; ++i)
-	x[i] = init[i] = (ck->word_mask & _genrand_dc(st));
-    /* it is better that LSBs of x[2] and x[3] are different */
-    if ( (x[2]&LSB) == (x[3]&LSB) ) {
-	x[3] ^= 1;
-	init[3] ^= 1;
-    }
+    memcpy(x, init, n*sizeof(uint32_t));
 
     pp = 2*p-n;
     mat[0] = 0; mat[1] = a;
     for (j=0; j<p; ++j) {
+	if ((POLL_MASK == (j & POLL_MASK))
+	    && (0 != _PollSearch_dc(ck->ctl, 0, 0)))
+	    return REDU;
 
 	/* generate */
 	for (i=0; i<pp; ++i){
@@ -148,13 +223,236 @@ int _CheckPeriod_dc(check32_t *ck, _org_state *st,
 	    if (x[i] != init[i])
 		break;
 	}
-	if (i==n) {
-	    free(x); free(init);
+	if (i==n)
 	    return IRRED;
+    }
+
+    return REDU;
+}
+
+/*
+   1 if t^(2^p) = t mod c, where deg c = p = ck->md.d
+   (c has p/64+1 words).
+*/
+static int frobenius_check(check32_t *ck, const uint64_t *c)
+{
+    int i, ok;
+    gf2x_mod_t *md = &ck->md;
+    uint64_t *a = md->acc;
+
+    _gf2x_set_mod_dc(md, c);
+    memset(a, 0, md->nd * sizeof(uint64_t));
+    a[0] = 2; /* t */
+    for (i=0; i<md->d; i++) {
+	if ((POLL_MASK == (i & POLL_MASK))
+	    && (0 != _PollSearch_dc(ck->ctl, 0, 0)))
+	    return 0;
+	_gf2x_sqrmod_dc(md, a);
+    }
+
+    ok = (a[0] == 2);
+    for (i=1; i<md->nd; i++)
+	ok = ok && (a[i] == 0);
+
+    return ok;
+}
+
+/*
+   The state of the generator is a p-bit vector, so the sequence of
+   the LSBs of x[1], x[2], ... satisfies a recurrence given by the
+   characteristic polynomial of the state transition.  If this
+   polynomial f is irreducible, then (for a nonzero initial state)
+   the shortest recurrence found by Berlekamp-Massey from 2p bits is
+   f itself, and t^(2^p) = t mod f.  Conversely these two conditions
+   mean that f is irreducible of degree p, i.e. the period is 2^p-1.
+   The initial state is the same as in the decimation check.
+*/
+static int check_period_bm(check32_t *ck, uint32_t a, const uint32_t *init,
+			   int m, int n, int r, int w)
+{
+    int i, k, p, len, nw, cw, L, lb, shift, res;
+    uint32_t y, *x, mat[2];
+    uint64_t *s, *c, *b, *t, d;
+
+    p = n*w-r;
+    len = 2*p;
+    nw = len/64 + 2;
+
+    x = ck->init;
+    s = ck->bm;
+    memset(s, 0, 4*nw*sizeof(uint64_t));
+    c = s + nw;
+    b = c + nw;
+    t = b + nw;
+
+    /* set initial values; x is used as a ring buffer */
+    if (x != init)
+	memcpy(x, init, n*sizeof(uint32_t));
+
+    /* s holds LSB(x[k+1]) at bit len-1-k (x is a ring of n words) */
+    mat[0] = 0; mat[1] = a;
+    for (k=0; k<len; ++k) {
+	i = k+1;
+	if (i >= n) {
+	    int j = i-n;
+	    y = (x[j%n]&ck->upper_mask) | (x[(j+1)%n]&ck->lower_mask);
+	    x[j%n] = x[(j+m)%n] ^ ( (y>>1) ^ mat[y&LSB] );
 	}
+	if (x[i%n] & LSB)
+	    s[(len-1-k) >> 6] |= UINT64_C(1) << ((len-1-k) & 63);
     }
 
+    /* Berlekamp-Massey; c is the connection polynomial */
+    c[0] = b[0] = 1;
+    L = lb = 0;
+    shift = 1;
+    for (k=0; k<len; ++k) {
+	/* d = sum c_j s_{k-j}, s_{k-j} is at bit len-1-k+j */
+	int off = len-1-k, o = off >> 6, sh = off & 63;
+	d = 0;
+	cw = L/64 + 1;
+	for (i=0; i<cw; i++) {
+	    uint64_t win = s[o+i] >> sh;
+	    if (sh) win |= s[o+i+1] << (64 - sh);
+	    d ^= c[i] & win;
+	}
+	d ^= d >> 32; d ^= d >> 16; d ^= d >> 8;
+	d ^= d >> 4; d ^= d >> 2; d ^= d >> 1;
+	if (!(d & 1)) {
+	    shift++;
+	    continue;
+	}
+	if (2*L <= k)
+	    memcpy(t, c, (L/64 + 1)*sizeof(uint64_t));
+	/* c += t^shift b */
+	{
+	    int wo = shift >> 6, bs = shift & 63;
+	    for (i=lb/64; i>=0; i--) {
+		c[i+wo] ^= b[i] << bs;
+		if (bs) c[i+wo+1] ^= b[i] >> (64 - bs);
+	    }
+	}
+	if (2*L <= k) {
+	    int lt = L;
+	    L = k+1-L;
+	    memset(b, 0, nw*sizeof(uint64_t));
+	    memcpy(b, t, (lt/64 + 1)*sizeof(uint64_t));
+	    lb = lt;
+	    shift = 1;
+	    if (L > p) break;
+	}
+	else
+	    shift++;
+    }
 
-    free(x); free(init);
-    return REDU;
+    res = REDU;
+    /* f(t) = t^p c(1/t); c of degree p is irreducible iff f is */
+    if (L == p && ((c[p >> 6] >> (p & 63)) & 1)) {
+	if (frobenius_check(ck, c))
+	    res = IRRED;
+    }
+
+    return res;
+}
+
+/*
+   Draws the initial values of the period check of one candidate,
+   the same way as _CheckPeriod_dc() does.  It is better that LSBs
+   of init[2] and init[3] are different.
+*/
+void _DrawPeriodInit_dc(check32_t *ck, _org_state *st, int n, uint32_t *init)
+{
+    int i;
+
+    for (i=0; i<n; ++i)
+	init[i] = (ck->word_mask & _genrand_dc(st));
+    if ( (init[2]&LSB) == (init[3]&LSB) )
+	init[3] ^= 1;
+}
+
+/*
+   Bit-sliced decimation check of count (<= 64) candidates: a[k] with
+   the initial values init[k*n], ..., init[k*n+n-1] drawn by
+   _DrawPeriodInit_dc().  Word i of the state is kept as w slices
+   xs[i*w+b]; bit k of a slice is bit b of x[i] of candidate k, so
+   the shifts and masks of the recurrence become slice indices.
+   Returns the mask of the candidates for which _CheckPeriod_dc()
+   returns IRRED.
+*/
+uint64_t _CheckPeriodBatch_dc(check32_t *ck, const uint32_t *a,
+			      const uint32_t *init, int count,
+			      int m, int n, int r, int w)
+{
+    int i, j, b, k, p, pp;
+    uint64_t *xs, *is, *xi, *x1, *xm, *xn, am[WORDLEN], z[WORDLEN];
+    uint64_t c, diff, lanes;
+
+    p = n*w-r;
+    pp = 2*p-n;
+    xs = ck->xs;
+    is = xs + 2*p*w;
+
+    for (b=0; b<w; b++) {
+	am[b] = 0;
+	for (k=0; k<count; k++)
+	    am[b] |= (uint64_t)((a[k] >> b) & LSB) << k;
+    }
+    memset(is, 0, n*w*sizeof(uint64_t));
+    for (k=0; k<count; k++) {
+	for (i=0; i<n; i++) {
+	    uint32_t v = init[k*n+i];
+	    for (b=0; b<w; b++)
+		is[i*w+b] |= (uint64_t)((v >> b) & LSB) << k;
+	}
+    }
+    memcpy(xs, is, n*w*sizeof(uint64_t));
+
+    for (j=0; j<p; ++j) {
+	if ((POLL_MASK == (j & POLL_MASK))
+	    && (0 != _PollSearch_dc(ck->ctl, 0, 0)))
+	    return 0;
+
+	/* generate: x[i+n] = x[i+m] ^ (y>>1) ^ (a if y is odd) */
+	for (i=0; i<pp; ++i) {
+	    xi = xs + i*w;
+	    x1 = xi + w;
+	    xm = xs + (i+m)*w;
+	    xn = xs + (i+n)*w;
+	    c = x1[0]; /* LSB of y (r > 0) */
+	    for (b=0; b<r-1; b++)
+		xn[b] = xm[b] ^ x1[b+1] ^ (am[b] & c);
+	    for (; b<w-1; b++)
+		xn[b] = xm[b] ^ xi[b+1] ^ (am[b] & c);
+	    xn[w-1] = xm[w-1] ^ (am[w-1] & c);
+	}
+
+	/* pick up odd subscritpt elements */
+	for (i=2; i<=p; ++i)
+	    memcpy(xs + i*w, xs + ((i<<1)-1)*w, w*sizeof(uint64_t));
+
+	/* reverse generate */
+	for (i=p-n; i>=0; --i) {
+	    xi = xs + i*w;
+	    x1 = xi + w;
+	    xm = xs + (i+m)*w;
+	    xn = xs + (i+n)*w;
+	    c = x1[0];
+	    for (b=0; b<w-1; b++)
+		z[b] = xn[b] ^ xm[b] ^ (am[b] & c);
+	    /* y = (z << 1) | c; the lower r bits go to x[i+1] */
+	    for (b=1; b<r; b++)
+		x1[b] = z[b-1];
+	    for (b=r; b<w; b++)
+		xi[b] = z[b-1];
+	}
+    }
+
+    diff = 0;
+    for (b=r; b<w; b++)
+	diff |= xs[b] ^ is[b];
+    for (i=w; i<n*w; i++)
+	diff |= xs[i] ^ is[i];
+
+    lanes = (count == 64) ? ~UINT64_C(0) : (UINT64_C(1) << count) - 1;
+    return ~diff & lanes;
 }
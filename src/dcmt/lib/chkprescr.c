@@ -0,0 +1,81 @@
+/* chkprescr.c */
+
+/* Checks _prescreening_batch_dc() against _prescreening_dc() for every
+   supported (w, p) pair and batches of 1 to PRESCR_BATCH_MAX random
+   candidates.  "make check" runs it with and without the AVX2 lanes.
+   Exits with 1 if a survivor bit differs. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "dci.h"
+
+#define NTRIALS 128
+
+static const int exponents[] = {
+    521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
+    9689, 9941, 11213, 19937, 21701, 23209, 44497
+};
+#define NEXPONENTS ((int)(sizeof(exponents) / sizeof(exponents[0])))
+
+static uint32_t xorshift32(uint32_t *x)
+{
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+int main(void)
+{
+    int i, k, t, w, p, m, n, r, count, expect, got;
+    long checked, survived, bad;
+    uint32_t x, wmask, aaa[PRESCR_BATCH_MAX];
+    uint64_t surv[PRESCR_BATCH_MAX / 64];
+    prescr_t pre;
+
+    x = 4172;
+    checked = survived = bad = 0;
+    for (w=31; w<=32; w++) {
+	wmask = (w == 32) ? 0xffffffff : ((uint32_t)1 << w) - 1;
+	for (k=0; k<NEXPONENTS; k++) {
+	    p = exponents[k];
+	    /* same as init_mt_search() in seive.c */
+	    n = p/w + 1;
+	    m = n/2;
+	    if (m < 2) m = n-1;
+	    r = n * w - p;
+
+	    if (0 != _InitPrescreening_dc(&pre, m, n, r, w))
+		return 1;
+	    for (t=0; t<NTRIALS; t++) {
+		/* every batch size up to 64, then the multi-word ones */
+		count = (t < 64) ? t + 1
+		    : 65 + (int)(xorshift32(&x) % (PRESCR_BATCH_MAX - 64));
+		if (t % 8 == 7)
+		    count = PRESCR_BATCH_MAX;
+		for (i=0; i<count; i++) {
+		    /* the top bit is set as in nextA() */
+		    aaa[i] = (xorshift32(&x) & wmask) | ((uint32_t)1 << (w-1));
+		}
+		_prescreening_batch_dc(&pre, aaa, count, surv);
+		for (i=0; i<count; i++) {
+		    expect = (NOT_REJECTED == _prescreening_dc(&pre, aaa[i]));
+		    got = (int)((surv[i >> 6] >> (i & 63)) & 0x1);
+		    if (expect != got) {
+			printf("w=%d p=%d count=%d aaa[%d]=%08x: "
+			       "batch %d, single %d\n",
+			       w, p, count, i, (unsigned)aaa[i], got, expect);
+			bad++;
+		    }
+		    survived += expect;
+		    checked++;
+		}
+	    }
+	    _EndPrescreening_dc(&pre);
+	}
+    }
+
+    printf("%ld candidates, %ld not rejected, %ld mismatches\n",
+	   checked, survived, bad);
+    return (bad == 0) ? 0 : 1;
+}
@@ -20,6 +20,7 @@
 #define DC_IMPLEMENT
 
 #include <inttypes.h> /* uint32_t */
+#include <stddef.h> /* size_t */
 #include "mt19937.h"
 #include "dc.h"
 
@@ -32,18 +33,73 @@
 extern _org_state global_mt19937;
 typedef struct {int *x; int deg;} Polynomial;
 
+/* packed GF(2)[t] polynomial, see gf2x.c */
+typedef struct {uint64_t *x; int deg;} gf2x_t;
+#define GF2X_WORDS(deg) ((deg)/64 + 1)
+
 typedef struct PRESCR_T {
     int sizeofA; /* parameter size */
-    uint32_t **modlist;
-    Polynomial **preModPolys;
+    /* NIRREDPOLY rows of sizeofA+1 entries; a table of
+       prescr_tables.h, the process-wide cache or modlist_own */
+    const uint16_t *modlist;
+    uint16_t *modlist_own; /* computed by _InitPrescreening_dc(), or NULL */
+    gf2x_t **preModPolys;
 } prescr_t;
 
+/* reduction modulo a fixed polynomial f, see gf2x.c */
+typedef struct GF2X_MOD_T {
+    int d;  /* deg f */
+    int nd; /* words in a residue, d/64+1 */
+    uint64_t *f;
+    uint64_t *mu; /* t^(2d) div f */
+    uint64_t *acc;
+    uint64_t *tmp;
+} gf2x_mod_t;
+
+/* reduction modulo a polynomial of degree <= 16, see gf2x.c */
+typedef struct GF2X_SMALL_MOD_T {
+    uint32_t tab[10][256];
+} gf2x_small_mod_t;
+
+/* see seive.c */
+typedef struct SEARCH_CTL_T search_ctl_t;
+
 typedef struct CHECK32_T {
     uint32_t upper_mask;
     uint32_t lower_mask;
     uint32_t word_mask;
+    int period_check; /* DC_PERIOD_* */
+    /* scratch space of the period check, reused for every candidate */
+    uint32_t *x;    /* 2p words (decimation) */
+    uint32_t *init; /* n words, CHECK_BATCH*n if bit-sliced */
+    uint64_t *bm;   /* 4*(2p/64+2) words (Berlekamp-Massey) */
+    gf2x_mod_t md;  /* modulo the characteristic polynomial */
+    uint64_t *xs;   /* (2p+n)*w words (bit-sliced decimation) */
+    search_ctl_t *ctl; /* polled by long checks, which give up (REDU)
+			  when the search is stopped */
 } check32_t;
 
+/*
+   scratch space of the tempering search, reused for every generator;
+   its blocks only grow, see eqdeg.c
+*/
+typedef struct TEMPER_WS_T {
+    int nnn;
+    uint32_t *lattices; /* EQDEG_LATTICE_WORDS(nnn) words per thread */
+    size_t lattices_size;
+    /* bump arenas of optimize_v_hard(): the MaskNodes of levels with
+       odd and even v, and the candidate masks of the current level */
+    void *nodes[2];
+    size_t nodes_size[2];
+    void *cand;
+    size_t cand_size;
+    int n_threads; /* evaluating the masks, 1 by default */
+    int prune;     /* cut evaluations of hopeless masks short, 1 by default */
+    int depth;     /* bits searched exhaustively, DC_TEMPER_HARD by default */
+    long n_nodes;  /* MaskNodes made so far */
+    long n_pruned; /* mask evaluations stopped so far */
+} temper_ws_t;
+
 typedef struct EQDEG_T {
     uint32_t bitmask[32];
     uint32_t mask_b;
@@ -64,14 +120,92 @@ typedef struct EQDEG_T {
     int ggap; /** difference between machine wordsize and dest wordsize **/
     int gcur_maxlengs[32];	/** for optimize_v_hard **/
     uint32_t gmax_b, gmax_c;
+    uint32_t *lattice; /* EQDEG_LATTICE_WORDS(nnn) words */
+    int simd;          /* kernels of pivot_reduction(), see eqdeg.c */
+    int nomem;         /* set if a MaskNode could not be allocated */
+    int n_threads;     /* evaluating the masks of optimize_v_hard() */
+    struct EVAL_JOB_T *eval; /* their threads, see eqdeg.c; NULL if none */
+    temper_ws_t *tw;   /* lattice is the first one of tw->lattices */
 } eqdeg_t;
 
+/* lattice rows of pivot_reduction(), v <= 32; every row is padded to
+   64 bytes, and the first one is aligned to 64 bytes within the space */
+#define EQDEG_ROW_WORDS(nnn) (((nnn) + 15) & ~15)
+#define EQDEG_LATTICE_WORDS(nnn) (33 * EQDEG_ROW_WORDS(nnn) + 15)
+
+/* scratch space of a search, one per thread; see init_mt_search() */
+typedef struct SEARCH_WS_T {
+    check32_t ck;
+    prescr_t pre;
+    temper_ws_t temper;
+    search_ctl_t *ctl; /* NULL if the search cannot be stopped */
+    dc_stats *stats;   /* of the ID being searched, NULL if not needed */
+} search_ws_t;
+
+/* key of the parameter cache, see cache.c */
+#define DC_CACHE_SINGLE 1 /* get_mt_parameter_id_opt_st() */
+#define DC_CACHE_RANGE 2  /* serial range starting at start_id */
+#define DC_CACHE_ID_STREAM 3 /* ID with its own stream (threaded range) */
+typedef struct DC_CACHE_KEY_T {
+    uint32_t kind; /* DC_CACHE_* */
+    uint32_t w, p, id, seed;
+    uint32_t start_id; /* DC_CACHE_RANGE only, 0 otherwise */
+    uint32_t effort;   /* of the tempering: 0 for DC_TEMPER_HARD,
+			  temper_depth + 1 otherwise */
+    uint32_t reserved; /* 0 */
+} dc_cache_key_t;
+
+typedef struct DC_CACHE_T {
+    int fd;    /* -1 if there is no usable cache */
+    void *map; /* the whole file as of the last lookup or store */
+    size_t size;
+} dc_cache_t;
+
+#define PRESCR_BATCH_MAX 256
+#define CHECK_BATCH 64 /* candidates of _CheckPeriodBatch_dc() */
+
 int _prescreening_dc(prescr_t *pre, uint32_t aaa);
-void _InitPrescreening_dc(prescr_t *pre, int m, int n, int r, int w);
+void _prescreening_batch_dc(prescr_t *pre, const uint32_t *aaa, int count,
+			    uint64_t *survivors);
+int _InitPrescreening_dc(prescr_t *pre, int m, int n, int r, int w);
+int _InitCachedPrescreening_dc(prescr_t *pre, int m, int n, int r, int w);
 void _EndPrescreening_dc(prescr_t *pre);
 int _CheckPeriod_dc(check32_t *ck, _org_state *st,
 		    uint32_t a, int m, int n, int r, int w);
-void _get_tempering_parameter_dc(mt_struct *mts);
-void _get_tempering_parameter_hard_dc(mt_struct *mts);
-void _InitCheck32_dc(check32_t *ck, int r, int w);
+int _get_tempering_parameter_dc(mt_struct *mts);
+int _get_tempering_parameter_hard_dc(mt_struct *mts);
+int _InitTempering_dc(temper_ws_t *tw, int n);
+void _EndTempering_dc(temper_ws_t *tw);
+int _get_tempering_parameter_hard_ws_dc(mt_struct *mts, temper_ws_t *tw);
+int _k_deficit_dc(mt_struct *mts, temper_ws_t *tw);
+int _InitCheck32_dc(check32_t *ck, int n, int r, int w, int period_check);
+void _EndCheck32_dc(check32_t *ck);
+int _CheckPeriodInit_dc(check32_t *ck, uint32_t a, const uint32_t *init,
+			int m, int n, int r, int w);
+void _DrawPeriodInit_dc(check32_t *ck, _org_state *st, int n, uint32_t *init);
+uint64_t _CheckPeriodBatch_dc(check32_t *ck, const uint32_t *a,
+			      const uint32_t *init, int count,
+			      int m, int n, int r, int w);
+int _PollSearch_dc(search_ctl_t *ctl, int candidates, int ids);
+uint32_t _fnv1a_dc(const void *data, size_t size);
+int _OpenCache_dc(dc_cache_t *cache);
+void _CloseCache_dc(dc_cache_t *cache);
+int _CacheLookup_dc(dc_cache_t *cache, const dc_cache_key_t *key,
+		    mt_struct *mts);
+int _CacheStore_dc(dc_cache_t *cache, const dc_cache_key_t *key,
+		   const mt_struct *mts);
+int _gf2x_mul_dc(uint64_t *r, const uint64_t *a, int na,
+		 const uint64_t *b, int nb);
+void _gf2x_sqr_dc(uint64_t *r, const uint64_t *a, int na);
+int _gf2x_alloc_mod_dc(gf2x_mod_t *md, int d);
+void _gf2x_set_mod_dc(gf2x_mod_t *md, const uint64_t *f);
+void _gf2x_end_mod_dc(gf2x_mod_t *md);
+void _gf2x_sqrmod_dc(gf2x_mod_t *md, uint64_t *a);
+gf2x_t *_gf2x_new_dc(int deg);
+void _gf2x_free_dc(gf2x_t *p);
+gf2x_t *_gf2x_dup_dc(const gf2x_t *p);
+gf2x_t *_gf2x_mult_dc(const gf2x_t *p0, const gf2x_t *p1);
+void _gf2x_init_small_mod_dc(gf2x_small_mod_t *sm, uint32_t g);
+uint32_t _gf2x_small_mod_dc(const gf2x_small_mod_t *sm,
+			    const uint64_t *a, int na);
 #endif
@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "dci.h"
 
 /**************************************/
@@ -30,12 +31,28 @@
 /**************************************/
 
 /** for get_tempering_parameter_hard **/
-#define LIMIT_V_BEST_OPT 15
+#define LIMIT_V_BEST_OPT DC_TEMPER_HARD
 /**************************************/
 
 #define WORD_LEN 32
 #define MIN_INFINITE (-2147483647-1)
 
+/* pivot_reduction() is instantiated for several vector widths/targets */
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#define EQDEG_HAVE_VECTORS
+typedef uint32_t vec8_t __attribute__((vector_size(32)));
+typedef uint32_t vec16_t __attribute__((vector_size(64)));
+#else
+#define ALWAYS_INLINE inline
+#endif
+#if defined(EQDEG_HAVE_VECTORS) && (defined(__x86_64__) || defined(__i386__))
+#define EQDEG_HAVE_AVX
+#endif
+#define EQDEG_SIMD_NONE 0
+#define EQDEG_SIMD_AVX2 1
+#define EQDEG_SIMD_AVX512 2
+
 typedef struct {
     uint32_t *cf;  /* fraction part */              // status
     int start;     /* beginning of fraction part */ // idx
@@ -88,20 +105,26 @@ static int push_stack(eqdeg_t *eq, uint32_t b, uint32_t c,
 		      int v, uint32_t *bbb, uint32_t *ccc);
 static int push_mask(eqdeg_t * eq, int l, int v,
 		     uint32_t b, uint32_t c, uint32_t *bbb, uint32_t *ccc);
-static int pivot_reduction(eqdeg_t *eq, int v);
+static int pivot_reduction(eqdeg_t *eq, int v, int floor);
+static int pivot_reduction_generic(eqdeg_t *eq, int v, int floor);
+#if defined(EQDEG_HAVE_AVX)
+static int pivot_reduction_avx2(eqdeg_t *eq, int v, int floor);
+static int pivot_reduction_avx512(eqdeg_t *eq, int v, int floor);
+#endif
 static void init_tempering(eqdeg_t *eq, mt_struct *mts);
-static void free_Vector( Vector *v );
-static void free_lattice( Vector **lattice, int v);
-static void add(int nnn, Vector *u, Vector *v);
+static uint32_t *alloc_lattice(int nnn);
 static void optimize_v(eqdeg_t *eq, uint32_t b, uint32_t c, int v);
 static MaskNode *optimize_v_hard(eqdeg_t *eq, int v, MaskNode *prev);
-static Vector *new_Vector(int nnn);
-static Vector **make_lattice(eqdeg_t *eq, int v);
-static void delete_MaskNodes(MaskNode *head);
+static void eval_masks(eqdeg_t *eq, int v, const uint32_t *b,
+		       const uint32_t *c, int *leng, int count);
+static void start_eval(eqdeg_t *eq);
+static void end_eval(eqdeg_t *eq);
+static void *eval_worker(void *arg);
+static void *reserve(void *mem, size_t *size, size_t new_size);
 static MaskNode *delete_lower_MaskNodes(MaskNode *head, int l);
-static MaskNode *cons_MaskNode(MaskNode *head, uint32_t b, uint32_t c, int leng);
+static MaskNode *cons_MaskNode(MaskNode *node, MaskNode *head,
+			       uint32_t b, uint32_t c, int leng);
 /* static void count_MaskNodes(MaskNode *head); */
-static void next_state(eqdeg_t *eq, Vector *v, int *count);
 
 #if defined(DEBUG)
 static void show_distrib(eqdeg_t *eq, mt_struct *mts);
@@ -118,41 +141,122 @@ int main(int argc, char **argv)
 }
 #endif
 
-void _get_tempering_parameter_dc(mt_struct *mts)
+/* returns 0, or -1 if out of memory */
+int _get_tempering_parameter_dc(mt_struct *mts)
 {
     eqdeg_t eq;
     init_tempering(&eq, mts);
+    eq.lattice = alloc_lattice(eq.nnn);
+    if (NULL == eq.lattice) return -1;
     optimize_v(&eq, 0, 0, 0);
+    free(eq.lattice);
     mts->shift0 = eq.shift_0;
     mts->shift1 = eq.shift_1;
     mts->shiftB = eq.shift_s;
     mts->shiftC = eq.shift_t;
     mts->maskB = eq.mask_b >> eq.ggap;
     mts->maskC = eq.mask_c >> eq.ggap;
+    return 0;
 }
 
-void _get_tempering_parameter_hard_dc(mt_struct *mts)
+/* returns 0, or -1 if out of memory */
+int _get_tempering_parameter_hard_dc(mt_struct *mts)
 {
-    int i;
-    MaskNode mn0, *cur, *next;
+    temper_ws_t tw;
+    int res;
+
+    if (0 != _InitTempering_dc(&tw, mts->nn)) {
+	printf("malloc error in \"_get_tempering_parameter_hard_dc()\"\n");
+	return -1;
+    }
+    res = _get_tempering_parameter_hard_ws_dc(mts, &tw);
+    if (0 != res)
+	printf("malloc error in \"_get_tempering_parameter_hard_dc()\"\n");
+    _EndTempering_dc(&tw);
+    return res;
+}
+
+/* scratch space for the tempering of generators with n words */
+int _InitTempering_dc(temper_ws_t *tw, int n)
+{
+    tw->nnn = n;
+    tw->lattices_size = EQDEG_LATTICE_WORDS(n) * sizeof(uint32_t);
+    tw->lattices = (uint32_t *)malloc(tw->lattices_size);
+    if (NULL == tw->lattices) return -1;
+    tw->nodes[0] = tw->nodes[1] = NULL;
+    tw->nodes_size[0] = tw->nodes_size[1] = 0;
+    tw->cand = NULL;
+    tw->cand_size = 0;
+    tw->n_threads = 1;
+    tw->prune = 1;
+    tw->depth = LIMIT_V_BEST_OPT;
+    tw->n_nodes = 0;
+    tw->n_pruned = 0;
+    return 0;
+}
+
+void _EndTempering_dc(temper_ws_t *tw)
+{
+    free(tw->lattices);
+    free(tw->nodes[0]);
+    free(tw->nodes[1]);
+    free(tw->cand);
+}
+
+/*
+   Same as _get_tempering_parameter_hard_dc(), tw is the scratch space
+   set up by _InitTempering_dc(&tw, mts->nn).  The candidate masks
+   are evaluated by tw->n_threads threads, and with tw->prune their
+   evaluation stops as soon as they cannot be chosen; the result is
+   the same.  Only the first tw->depth bits of the masks (at most w-1)
+   are searched exhaustively instead of LIMIT_V_BEST_OPT, the rest as
+   in _get_tempering_parameter_dc(); with 0 the result is the same as
+   that.  The MaskNodes made and the evaluations stopped are added to
+   tw->n_nodes and tw->n_pruned.
+   Returns 0 on success, -1 if out of memory.
+*/
+int _get_tempering_parameter_hard_ws_dc(mt_struct *mts, temper_ws_t *tw)
+{
+    int i, depth;
+    MaskNode mn0, *cur;
     eqdeg_t eq;
+    uint32_t *lattices;
 
     init_tempering(&eq, mts);
+    eq.tw = tw;
+    eq.nomem = 0;
+    eq.n_threads = 1;
+    if (tw->n_threads > 1) {
+	lattices = (uint32_t *)reserve(tw->lattices, &tw->lattices_size,
+				       tw->n_threads
+				       * EQDEG_LATTICE_WORDS(eq.nnn)
+				       * sizeof(uint32_t));
+	/* without them the masks are evaluated by this thread only */
+	if (NULL != lattices) {
+	    tw->lattices = lattices;
+	    eq.n_threads = tw->n_threads;
+	}
+    }
+    eq.lattice = tw->lattices;
+    start_eval(&eq);
 
     for (i=0; i<eq.www; i++)
 	eq.gcur_maxlengs[i] = -1;
+    eq.gmax_b = eq.gmax_c = 0;
+    depth = tw->depth;
+    if (depth > eq.www - 1) depth = eq.www - 1;
 
     mn0.b = mn0.c = mn0.leng = 0;
     mn0.next = NULL;
 
+    /* the nodes of every level are in the arenas of tw */
     cur = &mn0;
-    for (i=0; i<LIMIT_V_BEST_OPT; i++) {
-	next = optimize_v_hard(&eq, i, cur);
-	if (i > 0)
-	    delete_MaskNodes(cur);
-	cur = next;
+    for (i=0; i<depth; i++) {
+	cur = optimize_v_hard(&eq, i, cur);
+	if (eq.nomem) break;
     }
-    delete_MaskNodes(cur);
+    end_eval(&eq);
+    if (eq.nomem) return -1;
 
     optimize_v(&eq, eq.gmax_b, eq.gmax_c,i);
     mts->shift0 = eq.shift_0;
@@ -163,6 +267,30 @@ void _get_tempering_parameter_hard_dc(mt_struct *mts)
     mts->maskC = eq.mask_c >> eq.ggap;
 
     /* show_distrib(mts); */
+    return 0;
+}
+
+/*
+   The k-distribution deficit of the tempered generator mts, the sum of
+   [p/v] - k(v) for v = 1..w, where k(v) is its dimension of
+   equidistribution to v bits.  tw is as in
+   _get_tempering_parameter_hard_ws_dc().
+*/
+int _k_deficit_dc(mt_struct *mts, temper_ws_t *tw)
+{
+    eqdeg_t eq;
+    int v, deficit;
+
+    init_tempering(&eq, mts);
+    eq.lattice = tw->lattices;
+    eq.mask_b = mts->maskB << eq.ggap;
+    eq.mask_c = mts->maskC << eq.ggap;
+
+    deficit = 0;
+    for (v=1; v<=eq.www; v++)
+	deficit += (eq.nnn * eq.www - eq.rrr) / v
+	    - pivot_reduction(&eq, v, 0);
+    return deficit;
 }
 
 static int calc_pivot(uint32_t v) {
@@ -208,6 +336,7 @@ static void init_tempering(eqdeg_t *eq, mt_struct *mts)
     eq->shift_s = SSS;
     eq->shift_t = TTT;
     eq->ggap = WORD_LEN - eq->www;
+    eq->eval = NULL;
     /* bits are filled in mts->aaa from MSB */
     eq->aaa[0] = 0; eq->aaa[1] = (mts->aaa) << eq->ggap;
 
@@ -224,6 +353,14 @@ static void init_tempering(eqdeg_t *eq, mt_struct *mts)
 
     eq->greal_mask = (eq->gupper_mask | eq->glower_mask);
 
+    eq->simd = EQDEG_SIMD_NONE;
+#if defined(EQDEG_HAVE_AVX)
+    if (__builtin_cpu_supports("avx512f"))
+	eq->simd = EQDEG_SIMD_AVX512;
+    else if (__builtin_cpu_supports("avx2"))
+	eq->simd = EQDEG_SIMD_AVX2;
+#endif
+
 #if defined(DEBUG)
     printf ("n=%d m=%d r=%d w=%d\n", eq->nnn, eq->mmm, eq->rrr, eq->www);
     printf ("nw-r=%d\n", eq->nnn * eq->www - eq->rrr);
@@ -235,38 +372,301 @@ static void init_tempering(eqdeg_t *eq, mt_struct *mts)
 #endif
 }
 
-/* (v-1) bitmasks of b,c */
+/*
+   (v-1) bitmasks of b,c.  The nodes go to the arena eq->tw->nodes[v&1],
+   which held the nodes of level v-2; prev_masks are in the other one.
+*/
 static MaskNode *optimize_v_hard(eqdeg_t *eq, int v, MaskNode *prev_masks)
 {
-    int i, ll, t;
-    uint32_t bbb[8], ccc[8];
-    MaskNode *cur_masks;
+    temper_ws_t *tw = eq->tw;
+    int i, k, n, size, *leng;
+    uint32_t *bbb, *ccc;
+    void *mem;
+    MaskNode *cur_masks, *node, *nodes;
+
+    /* every node has at most 8 children, see push_stack() */
+    for (n=0, node=prev_masks; node != NULL; node=node->next)
+	n++;
+    mem = reserve(tw->cand, &tw->cand_size,
+		  8 * n * (2 * sizeof(uint32_t) + sizeof(int)));
+    if (NULL == mem) {
+	eq->nomem = 1;
+	return NULL;
+    }
+    tw->cand = mem;
+    bbb = (uint32_t *)mem;
+    ccc = bbb + 8 * n;
+    leng = (int *)(ccc + 8 * n);
+
+    size = 0;
+    for (node=prev_masks; node != NULL; node=node->next)
+	size += push_stack(eq, node->b, node->c, v, bbb + size, ccc + size);
+    eval_masks(eq, v, bbb, ccc, leng, size);
+
+    mem = reserve(tw->nodes[v & 1], &tw->nodes_size[v & 1],
+		  size * sizeof(MaskNode));
+    if (NULL == mem) {
+	eq->nomem = 1;
+	return NULL;
+    }
+    tw->nodes[v & 1] = mem;
+    nodes = (MaskNode *)mem;
 
+    /* the nodes are chosen as if the masks were evaluated in order */
     cur_masks = NULL;
+    k = 0;
+    for (i=0; i<size; ++i) {
+	if (leng[i] >= eq->gcur_maxlengs[v]) {
+	    eq->gcur_maxlengs[v] = leng[i];
+	    eq->gmax_b = bbb[i];
+	    eq->gmax_c = ccc[i];
+	    cur_masks = cons_MaskNode(&nodes[k++], cur_masks,
+				      bbb[i], ccc[i], leng[i]);
+	}
+    }
+    tw->n_nodes += k;
 
-    while (prev_masks != NULL) {
+    cur_masks = delete_lower_MaskNodes(cur_masks, eq->gcur_maxlengs[v]);
 
-	ll = push_stack(eq, prev_masks->b,prev_masks->c,v,bbb,ccc);
+    return cur_masks;
+}
 
-	for (i=0; i<ll; ++i) {
-	    eq->mask_b = bbb[i];
-	    eq->mask_c = ccc[i];
-	    t = pivot_reduction(eq, v+1);
-	    if (t >= eq->gcur_maxlengs[v]) {
-		eq->gcur_maxlengs[v] = t;
-		eq->gmax_b = eq->mask_b;
-		eq->gmax_c = eq->mask_c;
-		cur_masks = cons_MaskNode(cur_masks, eq->mask_b, eq->mask_c, t);
+/*
+   evaluations of the levels of optimize_v_hard(), shared by the threads
+   of eval_masks(); they run for the whole tempering search and wait on
+   start for the next level
+*/
+typedef struct EVAL_JOB_T {
+    int v;
+    const uint32_t *b, *c;
+    int *leng;
+    int count;
+    int next; /* next mask to be evaluated */
+    int prune;
+    /* with prune: for every EVAL_UNIT masks, once they are evaluated,
+       a leng not larger than that of a mask up to their last one,
+       MIN_INFINITE before; floor is the largest of them before unit
+       n_done, where none is MIN_INFINITE */
+    int *unit_max;
+    size_t unit_max_size;
+    int n_done;
+    int floor;
+    long n_pruned;
+    struct EVAL_WORKER_T *workers; /* the calling thread is worker 0 */
+    pthread_t *threads;
+    int n_started; /* threads, workers 1 to n_started */
+    int level;     /* incremented when a level is handed over */
+    int running;   /* threads still evaluating the level */
+    int quit;      /* set at the end of the search */
+    pthread_mutex_t lock;
+    pthread_cond_t start; /* a new level, or quit */
+    pthread_cond_t done;  /* running dropped to 0 */
+} eval_job_t;
+
+typedef struct EVAL_WORKER_T {
+    eval_job_t *job;
+    eqdeg_t eq; /* own copy, pivot_reduction() writes to it */
+} eval_worker_t;
+
+#define EVAL_UNIT 4 /* masks taken by a thread at once */
+
+static void eval_level(eval_worker_t *worker);
+
+/*
+   Starts the eq->n_threads - 1 threads of eval_masks() for one
+   tempering search; if none can be started (or out of memory)
+   eq->eval stays NULL and the calling thread evaluates all masks.
+*/
+static void start_eval(eqdeg_t *eq)
+{
+    eval_job_t *job;
+
+    if (eq->n_threads < 2) return;
+    job = (eval_job_t *)malloc(sizeof(eval_job_t));
+    if (NULL == job) return;
+    job->workers = (eval_worker_t *)malloc(eq->n_threads
+					   * sizeof(eval_worker_t));
+    job->threads = (pthread_t *)malloc((eq->n_threads-1)
+				       * sizeof(pthread_t));
+    if (NULL == job->workers || NULL == job->threads) {
+	free(job->workers); free(job->threads); free(job);
+	return;
+    }
+    job->unit_max = NULL;
+    job->unit_max_size = 0;
+    job->level = 0;
+    job->running = 0;
+    job->quit = 0;
+    pthread_mutex_init(&job->lock, NULL);
+    pthread_cond_init(&job->start, NULL);
+    pthread_cond_init(&job->done, NULL);
+
+    for (job->n_started=0; job->n_started<eq->n_threads-1; ++job->n_started) {
+	job->workers[job->n_started+1].job = job;
+	if (0 != pthread_create(&job->threads[job->n_started], NULL,
+				eval_worker, &job->workers[job->n_started+1]))
+	    break;
+    }
+    job->workers[0].job = job;
+    eq->eval = job;
+    if (0 == job->n_started) end_eval(eq);
+}
+
+static void end_eval(eqdeg_t *eq)
+{
+    eval_job_t *job = eq->eval;
+    int i;
+
+    if (NULL == job) return;
+    pthread_mutex_lock(&job->lock);
+    job->quit = 1;
+    pthread_cond_broadcast(&job->start);
+    pthread_mutex_unlock(&job->lock);
+    for (i=0; i<job->n_started; ++i)
+	pthread_join(job->threads[i], NULL);
+    pthread_cond_destroy(&job->done);
+    pthread_cond_destroy(&job->start);
+    pthread_mutex_destroy(&job->lock);
+
+    free(job->unit_max); free(job->workers); free(job->threads);
+    free(job);
+    eq->eval = NULL;
+}
+
+static void *eval_worker(void *arg)
+{
+    eval_worker_t *worker = (eval_worker_t *)arg;
+    eval_job_t *job = worker->job;
+    int level = 0;
+
+    pthread_mutex_lock(&job->lock);
+    for (;;) {
+	while (job->level == level && !job->quit)
+	    pthread_cond_wait(&job->start, &job->lock);
+	if (job->quit) break;
+	level = job->level;
+	pthread_mutex_unlock(&job->lock);
+
+	eval_level(worker);
+
+	pthread_mutex_lock(&job->lock);
+	if (--job->running == 0)
+	    pthread_cond_signal(&job->done);
+    }
+    pthread_mutex_unlock(&job->lock);
+
+    return NULL;
+}
+
+/* evaluates masks of the current level until all are taken */
+static void eval_level(eval_worker_t *worker)
+{
+    eval_job_t *job = worker->job;
+    int i, k, floor, n_units;
+    long n_pruned;
+
+    n_units = (job->count + EVAL_UNIT - 1) / EVAL_UNIT;
+    i = -1;
+    floor = 0;
+    n_pruned = 0;
+    for (;;) {
+	pthread_mutex_lock(&job->lock);
+	if (i >= 0 && job->prune) {
+	    job->unit_max[i / EVAL_UNIT] = floor;
+	    while (job->n_done < n_units
+		   && job->unit_max[job->n_done] != MIN_INFINITE) {
+		if (job->floor < job->unit_max[job->n_done])
+		    job->floor = job->unit_max[job->n_done];
+		job->n_done++;
 	    }
 	}
-	prev_masks = prev_masks->next;
+	i = job->next;
+	job->next += EVAL_UNIT;
+	floor = job->floor;
+	pthread_mutex_unlock(&job->lock);
+	if (i >= job->count) break;
+
+	/* the masks before k are evaluated before it in the serial order,
+	   so a mask shorter than all of them is not chosen anyway */
+	for (k=i; (k<i+EVAL_UNIT) && (k<job->count); ++k) {
+	    worker->eq.mask_b = job->b[k];
+	    worker->eq.mask_c = job->c[k];
+	    job->leng[k] = pivot_reduction(&worker->eq, job->v+1,
+					   job->prune ? floor : 0);
+	    if (job->leng[k] < 0) n_pruned++;
+	    if (floor < job->leng[k]) floor = job->leng[k];
+	}
     }
 
-    cur_masks = delete_lower_MaskNodes(cur_masks, eq->gcur_maxlengs[v]);
-
-    return cur_masks;
+    pthread_mutex_lock(&job->lock);
+    job->n_pruned += n_pruned;
+    pthread_mutex_unlock(&job->lock);
 }
 
+/*
+   leng[i] = pivot_reduction() of the masks b[i], c[i], evaluated by
+   the threads of eq->eval, each with its own lattice.  With
+   eq->tw->prune, leng[i] = -1 if the mask is shorter than one before
+   it, which optimize_v_hard() would not choose either.
+*/
+static void eval_masks(eqdeg_t *eq, int v, const uint32_t *b,
+		       const uint32_t *c, int *leng, int count)
+{
+    eval_job_t *job = eq->eval;
+    int *unit_max;
+    int i, floor;
+
+    /* a level of one unit is not worth waking the threads */
+    unit_max = NULL;
+    if (NULL != job && count / EVAL_UNIT > 1) {
+	unit_max = (int *)reserve(job->unit_max, &job->unit_max_size,
+				  (count / EVAL_UNIT + 1) * sizeof(int));
+	if (NULL != unit_max) job->unit_max = unit_max;
+    }
+    if (NULL == unit_max) {
+	floor = 0;
+	for (i=0; i<count; ++i) {
+	    eq->mask_b = b[i];
+	    eq->mask_c = c[i];
+	    leng[i] = pivot_reduction(eq, v+1, eq->tw->prune ? floor : 0);
+	    if (leng[i] < 0) eq->tw->n_pruned++;
+	    if (floor < leng[i]) floor = leng[i];
+	}
+	return;
+    }
+
+    pthread_mutex_lock(&job->lock);
+    job->v = v;
+    job->b = b;
+    job->c = c;
+    job->leng = leng;
+    job->count = count;
+    job->next = 0;
+    job->prune = eq->tw->prune;
+    for (i=0; i<=count / EVAL_UNIT; ++i)
+	unit_max[i] = MIN_INFINITE;
+    job->n_done = 0;
+    job->floor = 0;
+    job->n_pruned = 0;
+    /* the calling thread is worker 0 and uses eq->lattice */
+    for (i=0; i<=job->n_started; ++i) {
+	job->workers[i].eq = *eq;
+	job->workers[i].eq.lattice = eq->tw->lattices
+	    + i * EQDEG_LATTICE_WORDS(eq->nnn);
+    }
+    job->running = job->n_started;
+    job->level++;
+    pthread_cond_broadcast(&job->start);
+    pthread_mutex_unlock(&job->lock);
+
+    eval_level(&job->workers[0]);
+
+    pthread_mutex_lock(&job->lock);
+    while (job->running > 0)
+	pthread_cond_wait(&job->done, &job->lock);
+    pthread_mutex_unlock(&job->lock);
+    eq->tw->n_pruned += job->n_pruned;
+}
 
 /* (v-1) bitmasks of b,c */
 static void optimize_v(eqdeg_t *eq, uint32_t b, uint32_t c, int v)
@@ -281,7 +681,7 @@ static void optimize_v(eqdeg_t *eq, uint32_t b, uint32_t c, int v)
 	for (i=0; i<ll; ++i) {
 	    eq->mask_b = bbb[i];
 	    eq->mask_c = ccc[i];
-	    t = pivot_reduction(eq, v+1);
+	    t = pivot_reduction(eq, v+1, 0);
 	    if (t > max_len) {
 		max_len = t;
 		max_i = i;
@@ -362,20 +762,170 @@ static int push_mask(eqdeg_t *eq, int l, int v, uint32_t b, uint32_t c,
 /**********************************/
 /****  subroutines for lattice ****/
 /**********************************/
-static int pivot_reduction(eqdeg_t *eq, int v)
+
+/* u[i] ^= v[i] for i < n, width words at once */
+static ALWAYS_INLINE void xor_words(uint32_t *u, const uint32_t *v, int n,
+				    int width)
 {
-    Vector **lattice, *ltmp;
+    int i = 0;
+#if defined(EQDEG_HAVE_VECTORS)
+    vec8_t x8, y8;
+    vec16_t x16, y16;
+
+    if (width == 16) {
+	for (; i+16<=n; i+=16) {
+	    memcpy(&x16, u + i, sizeof(x16));
+	    memcpy(&y16, v + i, sizeof(y16));
+	    x16 ^= y16;
+	    memcpy(u + i, &x16, sizeof(x16));
+	}
+    }
+    if (width >= 8) {
+	for (; i+8<=n; i+=8) {
+	    memcpy(&x8, u + i, sizeof(x8));
+	    memcpy(&y8, v + i, sizeof(y8));
+	    x8 ^= y8;
+	    memcpy(u + i, &x8, sizeof(x8));
+	}
+    }
+#endif
+    for (; i<n; i++)
+	u[i] ^= v[i];
+}
+
+/* adds v to u (then u will change) */
+static ALWAYS_INLINE void add(int nnn, Vector *u, Vector *v, int width)
+{
+    int diff = v->start - u->start;
+
+    if (diff < 0) diff += nnn;
+    /* v->cf is a ring buffer which starts diff words later than u->cf */
+    xor_words(u->cf, v->cf + diff, nnn - diff, width);
+    xor_words(u->cf + nnn - diff, v->cf, diff, width);
+    u->next ^=  v->next;
+}
+
+static inline void next_state(eqdeg_t *eq, Vector *v, int *count) {
+    uint32_t tmp;
+    int s1, sm;
+
+    do {
+	s1 = v->start + 1;
+	if (s1 == eq->nnn) s1 = 0;
+	sm = v->start + eq->mmm;
+	if (sm >= eq->nnn) sm -= eq->nnn;
+	tmp = ( v->cf[v->start] & eq->gupper_mask )
+	    | ( v->cf[s1] & eq->glower_mask );
+	v->cf[v->start] = v->cf[sm]
+	    ^ ( (tmp>>1) ^ eq->aaa[lsb(eq, tmp)] );
+	v->cf[v->start] &= eq->greal_mask;
+	tmp = v->cf[v->start];
+	v->start = s1;
+	v->count++;
+	tmp = trnstmp(eq, tmp);
+	tmp = masktmp(eq, tmp);
+	v->next = tmp & eq->upper_v_bits;
+	(*count)++;
+	if (*count > eq->nnn * (eq->www-1) - eq->rrr) {
+	    break;
+	}
+    } while (v->next == 0);
+}
+
+/*
+   makes a initial lattice; the rows use eq->lattice, every one
+   EQDEG_ROW_WORDS(nnn) words from a 64 byte boundary
+*/
+static inline void make_lattice(eqdeg_t *eq, int v, Vector *rows,
+				Vector **lattice)
+{
+    int i;
+    int count;
+    int stride = EQDEG_ROW_WORDS(eq->nnn);
+    uint32_t *base;
+    Vector *bottom;
+
+    base = (uint32_t *)(((uintptr_t)eq->lattice + 63) & ~(uintptr_t)63);
+    memset(base, 0, (v+1) * stride * sizeof(uint32_t));
+    for( i=0; i<=v; i++){
+        rows[i].cf = base + i * stride;
+        lattice[i] = &rows[i];
+    }
+
+    for( i=0; i<v; i++){ /* from 0th row to v-1-th row */
+        lattice[i]->next = eq->bitmask[i];
+        lattice[i]->start = 0;
+        lattice[i]->count = 0;
+    }
+
+    bottom = lattice[v]; /* last row */
+    bottom->cf[eq->nnn -1] = 0xc0000000 & eq->greal_mask;
+    bottom->start = 0;
+    bottom->count = 0;
+    count = 0;
+    do {
+	next_state(eq, bottom, &count);
+    } while (bottom->next == 0);
+//    degree_of_vector(eq, top );
+}
+
+/*
+   An upper bound of what pivot_reduction() returns, while it reduces
+   lattice[0..v] whose counts add up to sum.  The counts only grow, and
+   those of the v rows left at the end add up to nw-r; so the smallest
+   one of them, or the mean of the smallest two, is at most nw-r minus
+   the others.  The row dropped at the end is not known, so it is taken
+   as the one with the largest count.
+*/
+static inline int length_bound(eqdeg_t *eq, Vector **lattice, int v, int sum)
+{
+    int i, c, min0, min1, max, rest;
+
+    min0 = min1 = max = lattice[0]->count;
+    if (min0 > lattice[1]->count) min0 = lattice[1]->count;
+    else min1 = lattice[1]->count;
+    if (max < lattice[1]->count) max = lattice[1]->count;
+    for (i = 2; i <= v; i++) {
+	c = lattice[i]->count;
+	if (c < min1) {
+	    if (c < min0) {
+		min1 = min0;
+		min0 = c;
+	    }
+	    else
+		min1 = c;
+	}
+	if (max < c) max = c;
+    }
+
+    /* one row is left if v == 1 */
+    rest = eq->nnn * eq->www - eq->rrr - (sum - max - min0);
+    if (v < 2 || rest <= (rest + min1) / 2) return rest;
+    return (rest + min1) / 2;
+}
+
+/*
+   The k-distribution length (in bits v) of the masks eq->mask_b,
+   eq->mask_c; -1 as soon as it is shown to be less than floor.
+*/
+static ALWAYS_INLINE int pivot_reduction_n(eqdeg_t *eq, int v, int floor,
+					   int width)
+{
+    Vector rows[WORD_LEN+1], *lattice[WORD_LEN+1], *ltmp;
     int i;
     int pivot;
     int count;
     int min;
+    int sum, check_at, bound, before;
 
     eq->upper_v_bits = 0;
     for( i=0; i<v; i++) {
         eq->upper_v_bits |= eq->bitmask[i];
     }
 
-    lattice = make_lattice(eq, v );
+    make_lattice(eq, v, rows, lattice);
+    sum = lattice[v]->count;
+    check_at = sum;
 
     for (;;) {
 	pivot = calc_pivot(lattice[v]->next);
@@ -384,8 +934,9 @@ static int pivot_reduction(eqdeg_t *eq, int v)
 	    lattice[pivot] = lattice[v];
 	    lattice[v] = ltmp;
 	}
-	add(eq->nnn, lattice[v], lattice[pivot]);
+	add(eq->nnn, lattice[v], lattice[pivot], width);
 	if (lattice[v]->next == 0) {
+	    before = lattice[v]->count;
 	    count = 0;
 	    next_state(eq, lattice[v], &count);
 	    if (lattice[v]->next == 0) {
@@ -403,6 +954,16 @@ static int pivot_reduction(eqdeg_t *eq, int v)
 		    break;
 		}
 	    }
+	    /* only next_state() changes the counts, and the bound falls
+	       at most by as much as their sum grows */
+	    if (floor > 0) {
+		sum += lattice[v]->count - before;
+		if (sum >= check_at) {
+		    bound = length_bound(eq, lattice, v, sum);
+		    if (bound < floor) return -1;
+		    check_at = sum + bound - floor + 1;
+		}
+	    }
 	}
     }
 
@@ -412,160 +973,87 @@ static int pivot_reduction(eqdeg_t *eq, int v)
 	    min = lattice[i]->count;
 	}
     }
-    free_lattice( lattice, v );
     return min;
 }
 
-
-
-
-/********************************/
-/** allocate momory for Vector **/
-/********************************/
-static Vector *new_Vector(int nnn)
+static int pivot_reduction_generic(eqdeg_t *eq, int v, int floor)
 {
-    Vector *v;
-
-    v = (Vector *)malloc( sizeof( Vector ) );
-    if( v == NULL ){
-        printf("malloc error in \"new_Vector()\"\n");
-        exit(1);
-    }
-
-    v->cf = (uint32_t *)calloc( nnn, sizeof( uint32_t ) );
-    if( v->cf == NULL ){
-        printf("calloc error in \"new_Vector()\"\n");
-        exit(1);
-    }
-
-    v->start = 0;
-
-    return v;
+    return pivot_reduction_n(eq, v, floor, 8);
 }
 
-
-/************************************************/
-/* frees *v which was allocated by new_Vector() */
-/************************************************/
-static void free_Vector( Vector *v )
+#if defined(EQDEG_HAVE_AVX)
+/* same, with the rows XORed in 256-bit registers */
+__attribute__((target("avx2")))
+static int pivot_reduction_avx2(eqdeg_t *eq, int v, int floor)
 {
-    if( NULL != v->cf ) free( v->cf );
-    if( NULL != v ) free( v );
+    return pivot_reduction_n(eq, v, floor, 8);
 }
 
-static void free_lattice( Vector **lattice, int v)
+/* same, in 512-bit registers */
+__attribute__((target("avx512f")))
+static int pivot_reduction_avx512(eqdeg_t *eq, int v, int floor)
 {
-    int i;
-
-    for( i=0; i<=v; i++)
-        free_Vector( lattice[i] );
-    free( lattice );
+    return pivot_reduction_n(eq, v, floor, 16);
 }
+#endif
 
-/* adds v to u (then u will change) */
-static void add(int nnn, Vector *u, Vector *v)
+static int pivot_reduction(eqdeg_t *eq, int v, int floor)
 {
-    int i;
-    int diff = (v->start - u->start + nnn) % nnn;
-    for (i = 0; i < nnn - diff; i++) {
-	u->cf[i] ^= v->cf[i + diff];
-    }
-    diff = diff - nnn;
-    for (; i < nnn; i++) {
-	u->cf[i] ^= v->cf[i + diff];
-    }
-    u->next ^=  v->next;
+#if defined(EQDEG_HAVE_AVX)
+    if (eq->simd == EQDEG_SIMD_AVX512)
+	return pivot_reduction_avx512(eq, v, floor);
+    if (eq->simd == EQDEG_SIMD_AVX2)
+	return pivot_reduction_avx2(eq, v, floor);
+#endif
+    return pivot_reduction_generic(eq, v, floor);
 }
 
-/* makes a initial lattice */
-static Vector **make_lattice(eqdeg_t *eq, int v)
+/* scratch space for the lattice rows of pivot_reduction(), or NULL */
+static uint32_t *alloc_lattice(int nnn)
 {
-    int i;
-    int count;
-    Vector **lattice, *bottom;
+    uint32_t *lattice;
 
-    lattice = (Vector **)malloc( (v+1) * sizeof( Vector *) );
+    lattice = (uint32_t *)malloc(EQDEG_LATTICE_WORDS(nnn) * sizeof(uint32_t));
     if( NULL == lattice ){
-        printf("malloc error in \"make_lattice\"\n");
-        exit(1);
-    }
-
-    for( i=0; i<v; i++){ /* from 0th row to v-1-th row */
-        lattice[i] = new_Vector(eq->nnn);
-        lattice[i]->next = eq->bitmask[i];
-        lattice[i]->start = 0;
-        lattice[i]->count = 0;
-    }
-
-    bottom = new_Vector(eq->nnn); /* last row */
-    for(i=0; i< eq->nnn; i++) {
-	bottom->cf[i] = 0;
+        printf("malloc error in \"alloc_lattice()\"\n");
     }
-    bottom->cf[eq->nnn -1] = 0xc0000000 & eq->greal_mask;
-    bottom->start = 0;
-    bottom->count = 0;
-    count = 0;
-    do {
-	next_state(eq, bottom, &count);
-    } while (bottom->next == 0);
-//    degree_of_vector(eq, top );
-    lattice[v] = bottom;
 
     return lattice;
 }
 
-static void next_state(eqdeg_t *eq, Vector *v, int *count) {
-    uint32_t tmp;
-
-    do {
-	tmp = ( v->cf[v->start] & eq->gupper_mask )
-	    | ( v->cf[(v->start + 1) % eq->nnn] & eq->glower_mask );
-	v->cf[v->start] = v->cf[(v->start + eq->mmm) % eq->nnn]
-	    ^ ( (tmp>>1) ^ eq->aaa[lsb(eq, tmp)] );
-	v->cf[v->start] &= eq->greal_mask;
-	tmp = v->cf[v->start];
-	v->start = (v->start + 1) % eq->nnn;
-	v->count++;
-	tmp = trnstmp(eq, tmp);
-	tmp = masktmp(eq, tmp);
-	v->next = tmp & eq->upper_v_bits;
-	(*count)++;
-	if (*count > eq->nnn * (eq->www-1) - eq->rrr) {
-	    break;
-	}
-    } while (v->next == 0);
-}
-
-/***********/
-static MaskNode *cons_MaskNode(MaskNode *head, uint32_t b, uint32_t c, int leng)
+/*
+   Makes *mem at least new_size bytes (*size is its size); the contents
+   are lost when it grows.  Returns the block, or NULL if out of memory,
+   in which case mem is still there.
+*/
+static void *reserve(void *mem, size_t *size, size_t new_size)
 {
-    MaskNode *t;
-
-    t = (MaskNode*)malloc(sizeof(MaskNode));
-    if (t == NULL) {
-	printf("malloc error in \"cons_MaskNode\"\n");
-        exit(1);
-    }
-
-    t->b = b;
-    t->c = c;
-    t->leng = leng;
-    t->next = head;
-
-    return t;
+    void *p;
+
+    if (new_size <= *size && NULL != mem) return mem;
+    if (new_size < 64) new_size = 64;
+    if (new_size < 2 * *size) new_size = 2 * *size;
+    p = malloc(new_size);
+    if (NULL == p) return NULL;
+    free(mem);
+    *size = new_size;
+    return p;
 }
 
-static void delete_MaskNodes(MaskNode *head)
+/***********/
+/* node (in an arena) becomes the head of the list */
+static MaskNode *cons_MaskNode(MaskNode *node, MaskNode *head,
+			       uint32_t b, uint32_t c, int leng)
 {
-    MaskNode *t;
+    node->b = b;
+    node->c = c;
+    node->leng = leng;
+    node->next = head;
 
-    while(head != NULL) {
-	t = head->next;
-	free(head);
-	head = t;
-    }
+    return node;
 }
 
+/* unlinks the nodes shorter than l; they stay in their arena */
 static MaskNode *delete_lower_MaskNodes(MaskNode *head, int l)
 {
     MaskNode *s, *t, *tail;
@@ -576,19 +1064,13 @@ static MaskNode *delete_lower_MaskNodes(MaskNode *head, int l)
 	    return NULL;
 	if (s->leng >= l)
 	    break;
-	t = s->next;
-	free(s);
-	s = t;
+	s = s->next;
     }
 
     head = tail = s;
-
     while (head != NULL) {
 	t = head->next;
-	if (head->leng < l) {
-	    free(head);
-	}
-	else {
+	if (head->leng >= l) {
 	    tail->next = head;
 	    tail = head;
 	}
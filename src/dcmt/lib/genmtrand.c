@@ -17,10 +17,55 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
 #include "dci.h"
 
 #define SHIFT1 18
 
+/* the refill is instantiated for several vector widths/targets */
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#define GENMT_HAVE_VECTORS
+typedef uint32_t vec4_t __attribute__((vector_size(16)));
+typedef uint32_t vec8_t __attribute__((vector_size(32)));
+typedef uint32_t vec16_t __attribute__((vector_size(64)));
+#else
+#define ALWAYS_INLINE inline
+#endif
+#if defined(GENMT_HAVE_VECTORS) && (defined(__x86_64__) || defined(__i386__))
+#define GENMT_HAVE_AVX
+#endif
+
+#define GENMT_VECTOR_MIN_WORDS 64
+
+/* words of dcmt_fill_double() tempered at once */
+#define GENMT_DOUBLE_CHUNK 512
+
+static void next_state_generic(mt_struct *mts);
+static void temper_generic(const mt_struct *mts, uint32_t *out,
+			   const uint32_t *st, int count);
+#if defined(GENMT_HAVE_AVX)
+static void next_state_avx2(mt_struct *mts);
+static void next_state_avx512(mt_struct *mts);
+static void temper_avx2(const mt_struct *mts, uint32_t *out,
+			const uint32_t *st, int count);
+static void temper_avx512(const mt_struct *mts, uint32_t *out,
+			  const uint32_t *st, int count);
+#endif
+typedef void (*temper_fn)(const mt_struct *mts, uint32_t *out,
+			  const uint32_t *st, int count);
+static void choose_cpu_kernels(void);
+static temper_fn temper_kernel(void);
+static dcmt_next_state_fn cached_kernel(const mt_struct *mts);
+static void fill_uint32(mt_struct *mts, uint32_t *out, size_t n,
+			dcmt_next_state_fn next_state, temper_fn temper);
+
+/* the vector kernels for this CPU, chosen once by choose_cpu_kernels() */
+static pthread_once_t cpu_kernels_once = PTHREAD_ONCE_INIT;
+static dcmt_next_state_fn cpu_next_state;
+static temper_fn cpu_temper;
+
 void sgenrand_mt(uint32_t seed, mt_struct *mts) 
 {
     int i;
@@ -40,30 +85,11 @@ void sgenrand_mt(uint32_t seed, mt_struct *mts)
 
 uint32_t genrand_mt(mt_struct *mts) 
 {
-    uint32_t *st, uuu, lll, aa, x;
-    int k,n,m,lim;
-
-    if ( mts->i >= mts->nn ) {
-	n = mts->nn; m = mts->mm;
-	aa = mts->aaa;
-	st = mts->state;
-	uuu = mts->umask; lll = mts->lmask;
-
-	lim = n - m;
-	for (k=0; k<lim; k++) {
-	    x = (st[k]&uuu)|(st[k+1]&lll);
-	    st[k] = st[k+m] ^ (x>>1) ^ (x&1U ? aa : 0U);
-	}
-	lim = n - 1;
-	for (; k<lim; k++) {
-	    x = (st[k]&uuu)|(st[k+1]&lll);
-	    st[k] = st[k+m-n] ^ (x>>1) ^ (x&1U ? aa : 0U);
-	}
-	x = (st[n-1]&uuu)|(st[0]&lll);
-	st[n-1] = st[m-1] ^ (x>>1) ^ (x&1U ? aa : 0U);
-	mts->i=0;
-    }
-		
+    uint32_t x;
+
+    if ( mts->i >= mts->nn )
+	cached_kernel(mts)(mts);
+
     x = mts->state[mts->i];
     mts->i += 1;
     x ^= x >> mts->shift0;
@@ -74,3 +100,361 @@ uint32_t genrand_mt(mt_struct *mts)
     return x;
 }
 
+
+/*
+   st[k] = st[k+off] ^ (x>>1) ^ (x&1U ? aa : 0U), x = (st[k]&uuu)|(st[k+1]&lll)
+   for k < lim, width words at a time while the words read are not written
+   in the same step: off >= 0, or -off >= width.  Returns the next k.
+*/
+static ALWAYS_INLINE int recurrence(uint32_t *st, int k, int lim, int off,
+				    uint32_t uuu, uint32_t lll, uint32_t aa,
+				    int width)
+{
+    uint32_t x;
+#if defined(GENMT_HAVE_VECTORS)
+    vec4_t x4, y4, z4;
+    vec8_t x8, y8, z8;
+    vec16_t x16, y16, z16;
+
+    if (width == 16 && (off >= 0 || -off >= 16)) {
+	for (; k+16<=lim; k+=16) {
+	    memcpy(&x16, st + k, sizeof(x16));
+	    memcpy(&y16, st + k + 1, sizeof(y16));
+	    memcpy(&z16, st + k + off, sizeof(z16));
+	    x16 = (x16 & uuu) | (y16 & lll);
+	    x16 = z16 ^ (x16 >> 1) ^ (-(x16 & 1) & aa);
+	    memcpy(st + k, &x16, sizeof(x16));
+	}
+    }
+    if (width >= 8 && (off >= 0 || -off >= 8)) {
+	for (; k+8<=lim; k+=8) {
+	    memcpy(&x8, st + k, sizeof(x8));
+	    memcpy(&y8, st + k + 1, sizeof(y8));
+	    memcpy(&z8, st + k + off, sizeof(z8));
+	    x8 = (x8 & uuu) | (y8 & lll);
+	    x8 = z8 ^ (x8 >> 1) ^ (-(x8 & 1) & aa);
+	    memcpy(st + k, &x8, sizeof(x8));
+	}
+    }
+    if (width >= 4 && (off >= 0 || -off >= 4)) {
+	for (; k+4<=lim; k+=4) {
+	    memcpy(&x4, st + k, sizeof(x4));
+	    memcpy(&y4, st + k + 1, sizeof(y4));
+	    memcpy(&z4, st + k + off, sizeof(z4));
+	    x4 = (x4 & uuu) | (y4 & lll);
+	    x4 = z4 ^ (x4 >> 1) ^ (-(x4 & 1) & aa);
+	    memcpy(st + k, &x4, sizeof(x4));
+	}
+    }
+#endif
+    for (; k<lim; k++) {
+	x = (st[k]&uuu)|(st[k+1]&lll);
+	st[k] = st[k+off] ^ (x>>1) ^ (x&1U ? aa : 0U);
+    }
+    return k;
+}
+
+/*
+   The words st[k+m-n] of the second part were computed in the first
+   one or earlier in the second, so its steps are at most n-m words.
+*/
+static ALWAYS_INLINE void next_state_n(mt_struct *mts, int width)
+{
+    uint32_t *st, uuu, lll, aa, x;
+    int k, n, m;
+
+    n = mts->nn; m = mts->mm;
+    aa = mts->aaa;
+    st = mts->state;
+    uuu = mts->umask; lll = mts->lmask;
+
+    k = recurrence(st, 0, n - m, m, uuu, lll, aa, width);
+    recurrence(st, k, n - 1, m - n, uuu, lll, aa, width);
+    x = (st[n-1]&uuu)|(st[0]&lll);
+    st[n-1] = st[m-1] ^ (x>>1) ^ (x&1U ? aa : 0U);
+    mts->i = 0;
+}
+
+/* SSE2 on x86-64 */
+static void next_state_generic(mt_struct *mts)
+{
+    next_state_n(mts, 4);
+}
+
+#if defined(GENMT_HAVE_AVX)
+__attribute__((target("avx2")))
+static void next_state_avx2(mt_struct *mts)
+{
+    next_state_n(mts, 8);
+}
+
+__attribute__((target("avx512f")))
+static void next_state_avx512(mt_struct *mts)
+{
+    next_state_n(mts, 16);
+}
+#endif
+
+/*
+   The exponents with nn < GENMT_VECTOR_MIN_WORDS are refilled word by
+   word, where the loop overhead is a large part of the little work.
+   Their kernels are generated for every (w, p) with nn, mm and the
+   masks known at compile time (as computed by init_mt_search()).
+*/
+#define GENMT_FIXED_EXPONENTS(X) \
+    X(31, 521) X(32, 521) X(31, 607) X(32, 607) X(31, 1279) X(32, 1279)
+
+#define GENMT_NN(w, p) ((p)/(w) + 1)
+#define GENMT_MM(w, p) (GENMT_NN(w, p) / 2)
+#define GENMT_RR(w, p) (GENMT_NN(w, p) * (w) - (p))
+#define GENMT_WMASK(w) (UINT32_C(0xFFFFFFFF) >> (32 - (w)))
+#define GENMT_LMASK(w, p) ((UINT32_C(1) << GENMT_RR(w, p)) - 1)
+#define GENMT_UMASK(w, p) (~GENMT_LMASK(w, p) & GENMT_WMASK(w))
+
+static ALWAYS_INLINE void next_state_fixed(mt_struct *mts, const int n,
+					   const int m, const uint32_t uuu,
+					   const uint32_t lll)
+{
+    uint32_t *st = mts->state, aa = mts->aaa, x;
+    int k;
+
+    for (k=0; k<n-m; k++) {
+	x = (st[k]&uuu)|(st[k+1]&lll);
+	st[k] = st[k+m] ^ (x>>1) ^ (x&1U ? aa : 0U);
+    }
+    for (; k<n-1; k++) {
+	x = (st[k]&uuu)|(st[k+1]&lll);
+	st[k] = st[k+m-n] ^ (x>>1) ^ (x&1U ? aa : 0U);
+    }
+    x = (st[n-1]&uuu)|(st[0]&lll);
+    st[n-1] = st[m-1] ^ (x>>1) ^ (x&1U ? aa : 0U);
+    mts->i = 0;
+}
+
+#define GENMT_FIXED_KERNEL(w, p) \
+static void next_state_##w##_##p(mt_struct *mts) \
+{ \
+    next_state_fixed(mts, GENMT_NN(w, p), GENMT_MM(w, p), \
+		     GENMT_UMASK(w, p), GENMT_LMASK(w, p)); \
+}
+GENMT_FIXED_EXPONENTS(GENMT_FIXED_KERNEL)
+
+typedef struct {
+    int ww, nn, rr;
+    dcmt_next_state_fn next_state;
+} fixed_kernel_t;
+
+#define GENMT_FIXED_ENTRY(w, p) \
+    {w, GENMT_NN(w, p), GENMT_RR(w, p), next_state_##w##_##p},
+static const fixed_kernel_t fixed_kernels[] = {
+    GENMT_FIXED_EXPONENTS(GENMT_FIXED_ENTRY)
+};
+
+static void next_state_scalar(mt_struct *mts)
+{
+    next_state_n(mts, 1);
+}
+
+/*
+   the kernel which computes the next nn words of mts->state and sets
+   mts->i = 0; short states gain nothing from the vectors (p < 2203).
+   It depends on mm, nn, rr, ww, umask and lmask only, and generators
+   whose fields do not change keep it.
+*/
+dcmt_next_state_fn dcmt_next_state_kernel(const mt_struct *mts)
+{
+    const fixed_kernel_t *fk;
+    int k;
+
+    for (k=0; k<(int)(sizeof(fixed_kernels)/sizeof(fixed_kernels[0])); k++) {
+	fk = fixed_kernels + k;
+	if (mts->nn == fk->nn && mts->ww == fk->ww && mts->rr == fk->rr
+	    && mts->mm == fk->nn / 2
+	    && mts->umask == (GENMT_WMASK(fk->ww) >> fk->rr) << fk->rr
+	    && mts->lmask == (UINT32_C(1) << fk->rr) - 1)
+	    return fk->next_state;
+    }
+    if (mts->nn < GENMT_VECTOR_MIN_WORDS)
+	return next_state_scalar;
+    pthread_once(&cpu_kernels_once, choose_cpu_kernels);
+    return cpu_next_state;
+}
+
+/*
+   dcmt_next_state_kernel() of the last generator refilled by this
+   thread and the fields it was chosen for; genrand_mt() and the fills
+   look it up instead of choosing again
+*/
+typedef struct {
+    int mm, nn, rr, ww;
+    uint32_t umask, lmask;
+    dcmt_next_state_fn next_state;
+} kernel_cache_t;
+
+static __thread kernel_cache_t kernel_cache;
+
+static dcmt_next_state_fn cached_kernel(const mt_struct *mts)
+{
+    kernel_cache_t *kc = &kernel_cache;
+
+    if (NULL == kc->next_state
+	|| kc->nn != mts->nn || kc->mm != mts->mm || kc->rr != mts->rr
+	|| kc->ww != mts->ww || kc->umask != mts->umask
+	|| kc->lmask != mts->lmask) {
+	kc->mm = mts->mm;
+	kc->nn = mts->nn;
+	kc->rr = mts->rr;
+	kc->ww = mts->ww;
+	kc->umask = mts->umask;
+	kc->lmask = mts->lmask;
+	kc->next_state = dcmt_next_state_kernel(mts);
+    }
+    return kc->next_state;
+}
+
+/* out[i] = tempered st[i] for i < count, width words at a time */
+static ALWAYS_INLINE void temper_n(const mt_struct *mts, uint32_t *out,
+				   const uint32_t *st, int count, int width)
+{
+    int i = 0;
+    uint32_t x;
+#if defined(GENMT_HAVE_VECTORS)
+    vec4_t x4;
+    vec8_t x8;
+    vec16_t x16;
+
+    if (width == 16) {
+	for (; i+16<=count; i+=16) {
+	    memcpy(&x16, st + i, sizeof(x16));
+	    x16 ^= x16 >> mts->shift0;
+	    x16 ^= (x16 << mts->shiftB) & mts->maskB;
+	    x16 ^= (x16 << mts->shiftC) & mts->maskC;
+	    x16 ^= x16 >> mts->shift1;
+	    memcpy(out + i, &x16, sizeof(x16));
+	}
+    }
+    if (width >= 8) {
+	for (; i+8<=count; i+=8) {
+	    memcpy(&x8, st + i, sizeof(x8));
+	    x8 ^= x8 >> mts->shift0;
+	    x8 ^= (x8 << mts->shiftB) & mts->maskB;
+	    x8 ^= (x8 << mts->shiftC) & mts->maskC;
+	    x8 ^= x8 >> mts->shift1;
+	    memcpy(out + i, &x8, sizeof(x8));
+	}
+    }
+    if (width >= 4) {
+	for (; i+4<=count; i+=4) {
+	    memcpy(&x4, st + i, sizeof(x4));
+	    x4 ^= x4 >> mts->shift0;
+	    x4 ^= (x4 << mts->shiftB) & mts->maskB;
+	    x4 ^= (x4 << mts->shiftC) & mts->maskC;
+	    x4 ^= x4 >> mts->shift1;
+	    memcpy(out + i, &x4, sizeof(x4));
+	}
+    }
+#endif
+    for (; i<count; i++) {
+	x = st[i];
+	x ^= x >> mts->shift0;
+	x ^= (x << mts->shiftB) & mts->maskB;
+	x ^= (x << mts->shiftC) & mts->maskC;
+	x ^= x >> mts->shift1;
+	out[i] = x;
+    }
+}
+
+static void temper_generic(const mt_struct *mts, uint32_t *out,
+			   const uint32_t *st, int count)
+{
+    temper_n(mts, out, st, count, 4);
+}
+
+#if defined(GENMT_HAVE_AVX)
+__attribute__((target("avx2")))
+static void temper_avx2(const mt_struct *mts, uint32_t *out,
+			const uint32_t *st, int count)
+{
+    temper_n(mts, out, st, count, 8);
+}
+
+__attribute__((target("avx512f")))
+static void temper_avx512(const mt_struct *mts, uint32_t *out,
+			  const uint32_t *st, int count)
+{
+    temper_n(mts, out, st, count, 16);
+}
+#endif
+
+static void choose_cpu_kernels(void)
+{
+    cpu_next_state = next_state_generic;
+    cpu_temper = temper_generic;
+#if defined(GENMT_HAVE_AVX)
+    if (__builtin_cpu_supports("avx512f")) {
+	cpu_next_state = next_state_avx512;
+	cpu_temper = temper_avx512;
+    } else if (__builtin_cpu_supports("avx2")) {
+	cpu_next_state = next_state_avx2;
+	cpu_temper = temper_avx2;
+    }
+#endif
+}
+
+static temper_fn temper_kernel(void)
+{
+    pthread_once(&cpu_kernels_once, choose_cpu_kernels);
+    return cpu_temper;
+}
+
+/*
+   out[0..n-1] = the next n outputs of genrand_mt(); the state is
+   left as if genrand_mt() had been called n times
+*/
+void dcmt_fill_uint32(mt_struct *mts, uint32_t *out, size_t n)
+{
+    fill_uint32(mts, out, n, cached_kernel(mts), temper_kernel());
+}
+
+static void fill_uint32(mt_struct *mts, uint32_t *out, size_t n,
+			dcmt_next_state_fn next_state, temper_fn temper)
+{
+    size_t count;
+
+    while (n > 0) {
+	if (mts->i >= mts->nn)
+	    next_state(mts);
+	count = mts->nn - mts->i;
+	if (count > n) count = n;
+	temper(mts, out, mts->state + mts->i, (int)count);
+	mts->i += (int)count;
+	out += count;
+	n -= count;
+    }
+}
+
+/*
+   out[0..n-1] = numbers in [0, 1) with 53-bit resolution, each made
+   of the upper 27 and 26 bits of two outputs of genrand_mt(), as
+   random.random() of Python
+*/
+void dcmt_fill_double(mt_struct *mts, double *out, size_t n)
+{
+    uint32_t buf[GENMT_DOUBLE_CHUNK];
+    int sa = mts->ww - 27, sb = mts->ww - 26;
+    dcmt_next_state_fn next_state = cached_kernel(mts);
+    temper_fn temper = temper_kernel();
+    size_t i, count;
+
+    while (n > 0) {
+	count = (n < GENMT_DOUBLE_CHUNK / 2) ? n : GENMT_DOUBLE_CHUNK / 2;
+	fill_uint32(mts, buf, 2 * count, next_state, temper);
+	/* the words fit in int32_t, which converts faster */
+	for (i=0; i<count; i++)
+	    out[i] = ((int32_t)(buf[2*i] >> sa) * 67108864.0
+		      + (int32_t)(buf[2*i+1] >> sb))
+		* (1.0 / 9007199254740992.0);
+	out += count;
+	n -= count;
+    }
+}
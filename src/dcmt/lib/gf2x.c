@@ -0,0 +1,469 @@
+/* gf2x.c */
+
+/* This library is free software; you can redistribute it and/or   */
+/* modify it under the terms of the GNU Library General Public     */
+/* License as published by the Free Software Foundation; either    */
+/* version 2 of the License, or (at your option) any later         */
+/* version.                                                        */
+/* This library is distributed in the hope that it will be useful, */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of  */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.            */
+/* See the GNU Library General Public License for more details.    */
+/* You should have received a copy of the GNU Library General      */
+/* Public License along with this library; if not, write to the    */
+/* Free Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA   */
+/* 02111-1307  USA                                                 */
+
+/* Packed GF(2)[t] arithmetic.  A polynomial is an array of 64-bit
+   words; bit i of x[i/64] is the coefficient of t^i.  The routines
+   work on plain word arrays, the callers keep track of the lengths. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dci.h"
+
+/* _mm_cvtsi64_si128() and _mm_cvtsi128_si64() are x86-64 only */
+#if defined(__GNUC__) && defined(__x86_64__)
+#define GF2X_HAVE_PCLMUL
+#include <wmmintrin.h>
+#endif
+
+/* operands of at least this many words are multiplied by Karatsuba */
+#define KARATSUBA_THRESHOLD 12
+
+static void mul_tmp(uint64_t *r, const uint64_t *a, int na,
+		    const uint64_t *b, int nb, uint64_t *tmp);
+static int mul_tmp_size(int na, int nb);
+static void mul_kara(uint64_t *r, const uint64_t *a, const uint64_t *b, int n,
+		     uint64_t *tmp);
+static void mul_small(uint64_t *r, const uint64_t *a, int na,
+		      const uint64_t *b, int nb);
+static void mul_basecase(uint64_t *r, const uint64_t *a, int na,
+			 const uint64_t *b, int nb);
+#if defined(GF2X_HAVE_PCLMUL)
+static void mul_basecase_pclmul(uint64_t *r, const uint64_t *a, int na,
+				const uint64_t *b, int nb);
+#endif
+static void shift_right(uint64_t *r, const uint64_t *a, int na, int s,
+			int nr);
+static void barrett_reduce(gf2x_mod_t *md, uint64_t *a);
+
+/* r[0..1] = a * b, without carries */
+static inline void clmul1(uint64_t *r, uint64_t a, uint64_t b)
+{
+    int i;
+    uint64_t lo, hi, mask;
+
+    lo = hi = 0;
+    for (i=0; i<64; i++) {
+	mask = -((b >> i) & 1);
+	lo ^= (a << i) & mask;
+	hi ^= ((a >> (63 - i)) >> 1) & mask;
+    }
+    r[0] = lo;
+    r[1] = hi;
+}
+
+/* inserts a zero bit above each of the 32 low bits of x */
+static inline uint64_t spread32(uint64_t x)
+{
+    x = (x | (x << 16)) & UINT64_C(0x0000ffff0000ffff);
+    x = (x | (x << 8)) & UINT64_C(0x00ff00ff00ff00ff);
+    x = (x | (x << 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    x = (x | (x << 2)) & UINT64_C(0x3333333333333333);
+    x = (x | (x << 1)) & UINT64_C(0x5555555555555555);
+    return x;
+}
+
+/* r[0..na+nb-1] = a * b; r must not overlap a or b.
+   Returns 0, or -1 if out of memory. */
+int _gf2x_mul_dc(uint64_t *r, const uint64_t *a, int na,
+		 const uint64_t *b, int nb)
+{
+    uint64_t *tmp;
+
+    tmp = (uint64_t *)malloc(mul_tmp_size(na, nb) * sizeof(uint64_t));
+    if (NULL == tmp) {
+	printf("malloc error in \"_gf2x_mul_dc()\"\n");
+	return -1;
+    }
+    mul_tmp(r, a, na, b, nb, tmp);
+    free(tmp);
+    return 0;
+}
+
+/* r[0..2na-1] = a^2; r must not overlap a */
+void _gf2x_sqr_dc(uint64_t *r, const uint64_t *a, int na)
+{
+    int i;
+
+    /* squaring only spreads the bits apart */
+    for (i=0; i<na; i++) {
+	r[2*i] = spread32(a[i] & 0xffffffff);
+	r[2*i+1] = spread32(a[i] >> 32);
+    }
+}
+
+/*
+   Allocates the buffers for reduction modulo polynomials of degree
+   d > 0.  Returns 0 on success, -1 if out of memory.
+*/
+int _gf2x_alloc_mod_dc(gf2x_mod_t *md, int d)
+{
+    int nd;
+
+    nd = d/64 + 1;
+    md->d = d;
+    md->nd = nd;
+    md->f = (uint64_t *)calloc(nd, sizeof(uint64_t));
+    md->mu = (uint64_t *)calloc(nd, sizeof(uint64_t));
+    md->acc = (uint64_t *)calloc(nd, sizeof(uint64_t));
+    md->tmp = (uint64_t *)calloc(5 * nd + mul_tmp_size(nd, nd),
+				 sizeof(uint64_t));
+    if (NULL == md->f || NULL == md->mu || NULL == md->acc
+	|| NULL == md->tmp) {
+	_gf2x_end_mod_dc(md);
+	return -1;
+    }
+
+    return 0;
+}
+
+/* prepares reduction modulo f, deg f = md->d (Barrett) */
+void _gf2x_set_mod_dc(gf2x_mod_t *md, const uint64_t *f)
+{
+    int i, nd = md->nd, d = md->d, nr;
+    uint64_t *rem;
+
+    memcpy(md->f, f, nd * sizeof(uint64_t));
+    memset(md->mu, 0, nd * sizeof(uint64_t));
+
+    /* mu = t^(2d) div f, by plain long division */
+    nr = (2*d)/64 + 1;
+    rem = md->tmp;
+    memset(rem, 0, nr * sizeof(uint64_t));
+    rem[(2*d) >> 6] = UINT64_C(1) << ((2*d) & 63);
+    for (i=2*d; i>=d; i--) {
+	int k, s, o;
+	if (!((rem[i >> 6] >> (i & 63)) & 1)) continue;
+	md->mu[(i-d) >> 6] |= UINT64_C(1) << ((i-d) & 63);
+	/* rem ^= f << (i-d) */
+	s = (i-d) & 63;
+	o = (i-d) >> 6;
+	for (k=0; k<nd; k++) {
+	    rem[k+o] ^= f[k] << s;
+	    if (s && k+o+1 < nr) rem[k+o+1] ^= f[k] >> (64 - s);
+	}
+    }
+}
+
+void _gf2x_end_mod_dc(gf2x_mod_t *md)
+{
+    free(md->f);
+    free(md->mu);
+    free(md->acc);
+    free(md->tmp);
+    md->f = md->mu = md->acc = md->tmp = NULL;
+}
+
+/* a = a^2 mod f; a has md->nd words, deg a < d */
+void _gf2x_sqrmod_dc(gf2x_mod_t *md, uint64_t *a)
+{
+    uint64_t *sq = md->tmp;
+
+    _gf2x_sqr_dc(sq, a, md->nd);
+    barrett_reduce(md, sq);
+    memcpy(a, sq, md->nd * sizeof(uint64_t));
+}
+
+/*
+   a (2*nd words, deg a <= 2d-2) is replaced by a mod f (nd words):
+   q = ((a div t^d) * mu) div t^d, a mod f = (a - q*f) mod t^d.
+*/
+static void barrett_reduce(gf2x_mod_t *md, uint64_t *a)
+{
+    int i, nd = md->nd, d = md->d;
+    uint64_t *a1, *prod, *q;
+
+    a1 = md->tmp + 2 * nd;
+    prod = a1 + nd;
+    q = a1;
+
+    shift_right(a1, a, 2 * nd, d, nd);
+    mul_tmp(prod, a1, nd, md->mu, nd, prod + 2 * nd);
+    shift_right(q, prod, 2 * nd, d, nd);
+    mul_tmp(prod, q, nd, md->f, nd, prod + 2 * nd);
+
+    for (i=0; i<nd; i++)
+	a[i] ^= prod[i];
+    /* keep the bits below t^d */
+    if (d & 63)
+	a[nd-1] &= (UINT64_C(1) << (d & 63)) - 1;
+    else
+	a[nd-1] = 0;
+}
+
+/* the polynomial functions return NULL if out of memory */
+gf2x_t *_gf2x_new_dc(int deg)
+{
+    gf2x_t *p;
+
+    p = (gf2x_t *)malloc(sizeof(gf2x_t));
+    if (NULL == p) {
+	printf("malloc error in \"_gf2x_new_dc()\"\n");
+	return NULL;
+    }
+    p->deg = deg;
+    p->x = (uint64_t *)calloc(GF2X_WORDS(deg), sizeof(uint64_t));
+    if (NULL == p->x) {
+	printf("calloc error in \"_gf2x_new_dc()\"\n");
+	free(p);
+	return NULL;
+    }
+
+    return p;
+}
+
+/* p may be NULL */
+void _gf2x_free_dc(gf2x_t *p)
+{
+    if (NULL == p) return;
+    free(p->x);
+    free(p);
+}
+
+gf2x_t *_gf2x_dup_dc(const gf2x_t *p)
+{
+    gf2x_t *q;
+
+    q = _gf2x_new_dc(p->deg);
+    if (NULL == q) return NULL;
+    memcpy(q->x, p->x, GF2X_WORDS(p->deg) * sizeof(uint64_t));
+
+    return q;
+}
+
+/* returns p0 * p1 (both nonzero) */
+gf2x_t *_gf2x_mult_dc(const gf2x_t *p0, const gf2x_t *p1)
+{
+    gf2x_t *p;
+    uint64_t *r;
+    int n0 = GF2X_WORDS(p0->deg), n1 = GF2X_WORDS(p1->deg);
+
+    p = _gf2x_new_dc(p0->deg + p1->deg);
+    if (NULL == p) return NULL;
+    r = (uint64_t *)malloc((n0 + n1) * sizeof(uint64_t));
+    if (NULL == r || 0 != _gf2x_mul_dc(r, p0->x, n0, p1->x, n1)) {
+	printf("malloc error in \"_gf2x_mult_dc()\"\n");
+	free(r);
+	_gf2x_free_dc(p);
+	return NULL;
+    }
+    memcpy(p->x, r, GF2X_WORDS(p->deg) * sizeof(uint64_t));
+    free(r);
+
+    return p;
+}
+
+/*
+   Tables for reduction modulo g, 0 < deg g <= 16:
+   tab[k][v] = v * t^(8k) mod g.
+*/
+void _gf2x_init_small_mod_dc(gf2x_small_mod_t *sm, uint32_t g)
+{
+    int d, j, k, v;
+    uint32_t x;
+
+    for (d=16; !((g >> d) & 1); d--);
+    x = 1;
+    for (k=0; k<10; k++) {
+	sm->tab[k][0] = 0;
+	for (j=0; j<8; j++) {
+	    /* x = t^(8k+j) mod g */
+	    for (v=(1 << j); v<(2 << j); v++)
+		sm->tab[k][v] = sm->tab[k][v - (1 << j)] ^ x;
+	    x <<= 1;
+	    if ((x >> d) & 1) x ^= g;
+	}
+    }
+}
+
+/* a mod g, one word at a time (Horner's scheme in t^64) */
+uint32_t _gf2x_small_mod_dc(const gf2x_small_mod_t *sm,
+			    const uint64_t *a, int na)
+{
+    int i;
+    uint32_t r;
+    uint64_t w;
+
+    r = 0;
+    for (i=na-1; i>=0; i--) {
+	w = a[i];
+	/* r * t^64 + w */
+	r = sm->tab[8][r & 0xff] ^ sm->tab[9][r >> 8]
+	    ^ sm->tab[0][w & 0xff] ^ sm->tab[1][(w >> 8) & 0xff]
+	    ^ sm->tab[2][(w >> 16) & 0xff] ^ sm->tab[3][(w >> 24) & 0xff]
+	    ^ sm->tab[4][(w >> 32) & 0xff] ^ sm->tab[5][(w >> 40) & 0xff]
+	    ^ sm->tab[6][(w >> 48) & 0xff] ^ sm->tab[7][w >> 56];
+    }
+
+    return r;
+}
+
+/* words of scratch space needed by mul_tmp() */
+static int mul_tmp_size(int na, int nb)
+{
+    int n = (na < nb) ? na : nb;
+
+    /* padded block, block product, and 8n for the Karatsuba levels */
+    return 11 * n + 64;
+}
+
+/* r[0..na+nb-1] = a * b, cutting the longer operand into blocks */
+static void mul_tmp(uint64_t *r, const uint64_t *a, int na,
+		    const uint64_t *b, int nb, uint64_t *tmp)
+{
+    int off, i, len, lim;
+    uint64_t *blk, *prod;
+
+    if (na < nb) {
+	const uint64_t *t = a;
+	a = b; b = t;
+	i = na; na = nb; nb = i;
+    }
+    if (nb < KARATSUBA_THRESHOLD) {
+	mul_small(r, a, na, b, nb);
+	return;
+    }
+
+    blk = tmp;
+    prod = blk + nb;
+    memset(r, 0, (na + nb) * sizeof(uint64_t));
+    for (off=0; off<na; off+=nb) {
+	len = (na - off < nb) ? na - off : nb;
+	if (len < nb) {
+	    memcpy(blk, a + off, len * sizeof(uint64_t));
+	    memset(blk + len, 0, (nb - len) * sizeof(uint64_t));
+	    mul_kara(prod, blk, b, nb, prod + 2 * nb);
+	}
+	else
+	    mul_kara(prod, a + off, b, nb, prod + 2 * nb);
+	lim = (na + nb - off < 2 * nb) ? na + nb - off : 2 * nb;
+	for (i=0; i<lim; i++)
+	    r[off + i] ^= prod[i];
+    }
+}
+
+/*
+   r[0..2n-1] = a * b, a and b have n words; tmp has 8n words.
+   a = a0 + a1 T, b = b0 + b1 T, T = t^(64 l):
+   ab = a0 b0 + ((a0 + a1)(b0 + b1) + a0 b0 + a1 b1) T + a1 b1 T^2
+*/
+static void mul_kara(uint64_t *r, const uint64_t *a, const uint64_t *b, int n,
+		     uint64_t *tmp)
+{
+    int i, l, h;
+    uint64_t *sa, *sb, *mid;
+
+    if (n < KARATSUBA_THRESHOLD) {
+	mul_small(r, a, n, b, n);
+	return;
+    }
+
+    l = (n + 1) / 2;
+    h = n - l;
+    sa = tmp;
+    sb = sa + l;
+    mid = sb + l;
+
+    for (i=0; i<h; i++) {
+	sa[i] = a[i] ^ a[l + i];
+	sb[i] = b[i] ^ b[l + i];
+    }
+    if (h < l) {
+	sa[h] = a[h];
+	sb[h] = b[h];
+    }
+
+    mul_kara(r, a, b, l, mid + 2 * l);
+    mul_kara(r + 2 * l, a + l, b + l, h, mid + 2 * l);
+    mul_kara(mid, sa, sb, l, mid + 2 * l);
+
+    for (i=0; i<2*l; i++)
+	mid[i] ^= r[i];
+    for (i=0; i<2*h; i++)
+	mid[i] ^= r[2 * l + i];
+    for (i=0; i<2*l; i++)
+	r[l + i] ^= mid[i];
+}
+
+/* r[0..na+nb-1] = a * b for short operands */
+static void mul_small(uint64_t *r, const uint64_t *a, int na,
+		      const uint64_t *b, int nb)
+{
+#if defined(GF2X_HAVE_PCLMUL)
+    if (__builtin_cpu_supports("pclmul")) {
+	mul_basecase_pclmul(r, a, na, b, nb);
+	return;
+    }
+#endif
+    mul_basecase(r, a, na, b, nb);
+}
+
+/* r[0..nr-1] = a >> s, a has na words */
+static void shift_right(uint64_t *r, const uint64_t *a, int na, int s,
+			int nr)
+{
+    int i, o = s >> 6, b = s & 63;
+    uint64_t lo, hi;
+
+    for (i=0; i<nr; i++) {
+	lo = (i + o < na) ? a[i + o] : 0;
+	hi = (i + o + 1 < na) ? a[i + o + 1] : 0;
+	r[i] = b ? (lo >> b) | (hi << (64 - b)) : lo;
+    }
+}
+
+static void mul_basecase(uint64_t *r, const uint64_t *a, int na,
+			 const uint64_t *b, int nb)
+{
+    int i, j;
+    uint64_t t[2];
+
+    memset(r, 0, (na + nb) * sizeof(uint64_t));
+    for (i=0; i<na; i++) {
+	if (a[i] == 0) continue;
+	for (j=0; j<nb; j++) {
+	    clmul1(t, a[i], b[j]);
+	    r[i+j] ^= t[0];
+	    r[i+j+1] ^= t[1];
+	}
+    }
+}
+
+#if defined(GF2X_HAVE_PCLMUL)
+__attribute__((target("pclmul,sse2")))
+static void mul_basecase_pclmul(uint64_t *r, const uint64_t *a, int na,
+				const uint64_t *b, int nb)
+{
+    int i, j;
+    __m128i x, y, acc, carry;
+
+    /* product word k is accumulated from all i+j == k */
+    carry = _mm_setzero_si128();
+    for (i=0; i<na+nb-1; i++) {
+	acc = carry;
+	carry = _mm_setzero_si128();
+	for (j=(i < nb ? 0 : i-nb+1); j<=i && j<na; j++) {
+	    x = _mm_cvtsi64_si128((long long)a[j]);
+	    y = _mm_cvtsi64_si128((long long)b[i-j]);
+	    x = _mm_clmulepi64_si128(x, y, 0x00);
+	    acc = _mm_xor_si128(acc, x);
+	}
+	r[i] = (uint64_t)_mm_cvtsi128_si64(acc);
+	carry = _mm_srli_si128(acc, 8);
+    }
+    r[na+nb-1] = (uint64_t)_mm_cvtsi128_si64(carry);
+}
+#endif
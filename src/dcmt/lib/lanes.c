@@ -0,0 +1,407 @@
+/* lanes.c */
+
+/* This library is free software; you can redistribute it and/or   */
+/* modify it under the terms of the GNU Library General Public     */
+/* License as published by the Free Software Foundation; either    */
+/* version 2 of the License, or (at your option) any later         */
+/* version.                                                        */
+/* This library is distributed in the hope that it will be useful, */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of  */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.            */
+/* See the GNU Library General Public License for more details.    */
+/* You should have received a copy of the GNU Library General      */
+/* Public License along with this library; if not, write to the    */
+/* Free Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA   */
+/* 02111-1307  USA                                                 */
+
+/*
+   Generators which differ only in aaa, maskB and maskC (as all of
+   one get_mt_parameters_st() call), advanced together.
+
+   The states are interleaved: word k of generator l is
+   state[k*width + l], where width is the number of generators
+   rounded up to LANES_ALIGN.  A step of the recurrence is then the
+   same operation on a whole row, with aaa, maskB and maskC taken
+   from rows of their own, so every vector lane runs one generator;
+   the padding lanes have aaa = 0 and a zero state and are never
+   output.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "dci.h"
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#define LANES_HAVE_VECTORS
+typedef uint32_t vec4_t __attribute__((vector_size(16)));
+typedef uint32_t vec8_t __attribute__((vector_size(32)));
+typedef uint32_t vec16_t __attribute__((vector_size(64)));
+#else
+#define ALWAYS_INLINE inline
+#endif
+#if defined(LANES_HAVE_VECTORS) && (defined(__x86_64__) || defined(__i386__))
+#define LANES_HAVE_AVX
+#endif
+
+#define LANES_ALIGN 16 /* words of a row, 64 bytes */
+
+/* rows of outputs of mt_lanes_fill_double() tempered at once */
+#define LANES_DOUBLE_ROWS 64
+
+struct MT_LANES_T {
+    int count; /* generators */
+    int width; /* words of a row */
+    int nn, mm, ww, i;
+    uint32_t umask, lmask;
+    int shift0, shift1, shiftB, shiftC;
+    uint32_t *aaa, *maskB, *maskC; /* one row each */
+    uint32_t *state; /* nn rows */
+    uint32_t *buf;   /* LANES_DOUBLE_ROWS*count words */
+    void *mem;
+    void (*next_state)(mt_lanes *lanes);
+    void (*temper)(const mt_lanes *lanes, uint32_t *out, int rows);
+};
+
+/*
+   a[l] = c[l] ^ (x>>1) ^ (x&1U ? aaa[l] : 0U), x = (a[l]&uuu)|(b[l]&lll)
+   for the w words of a row, w a multiple of LANES_ALIGN
+*/
+static ALWAYS_INLINE void lanes_row(uint32_t *a, const uint32_t *b,
+				    const uint32_t *c, const uint32_t *aaa,
+				    int w, uint32_t uuu, uint32_t lll,
+				    int width)
+{
+    int l;
+#if defined(LANES_HAVE_VECTORS)
+    vec4_t x4, y4, z4, a4;
+    vec8_t x8, y8, z8, a8;
+    vec16_t x16, y16, z16, a16;
+
+    if (width == 16) {
+	for (l=0; l<w; l+=16) {
+	    memcpy(&x16, a + l, sizeof(x16));
+	    memcpy(&y16, b + l, sizeof(y16));
+	    memcpy(&z16, c + l, sizeof(z16));
+	    memcpy(&a16, aaa + l, sizeof(a16));
+	    x16 = (x16 & uuu) | (y16 & lll);
+	    x16 = z16 ^ (x16 >> 1) ^ (-(x16 & 1) & a16);
+	    memcpy(a + l, &x16, sizeof(x16));
+	}
+    } else if (width == 8) {
+	for (l=0; l<w; l+=8) {
+	    memcpy(&x8, a + l, sizeof(x8));
+	    memcpy(&y8, b + l, sizeof(y8));
+	    memcpy(&z8, c + l, sizeof(z8));
+	    memcpy(&a8, aaa + l, sizeof(a8));
+	    x8 = (x8 & uuu) | (y8 & lll);
+	    x8 = z8 ^ (x8 >> 1) ^ (-(x8 & 1) & a8);
+	    memcpy(a + l, &x8, sizeof(x8));
+	}
+    } else {
+	for (l=0; l<w; l+=4) {
+	    memcpy(&x4, a + l, sizeof(x4));
+	    memcpy(&y4, b + l, sizeof(y4));
+	    memcpy(&z4, c + l, sizeof(z4));
+	    memcpy(&a4, aaa + l, sizeof(a4));
+	    x4 = (x4 & uuu) | (y4 & lll);
+	    x4 = z4 ^ (x4 >> 1) ^ (-(x4 & 1) & a4);
+	    memcpy(a + l, &x4, sizeof(x4));
+	}
+    }
+#else
+    uint32_t x;
+
+    for (l=0; l<w; l++) {
+	x = (a[l]&uuu)|(b[l]&lll);
+	a[l] = c[l] ^ (x>>1) ^ (x&1U ? aaa[l] : 0U);
+    }
+#endif
+}
+
+/*
+   computes the next nn rows of the state, one row after the other
+   as the words of genrand_mt(), width words of a row at a time
+*/
+static ALWAYS_INLINE void lanes_next_state_n(mt_lanes *lanes, int width)
+{
+    uint32_t *st = lanes->state, *aaa = lanes->aaa;
+    uint32_t uuu = lanes->umask, lll = lanes->lmask;
+    int n = lanes->nn, m = lanes->mm, w = lanes->width, k;
+
+    for (k=0; k<n-m; k++)
+	lanes_row(st + k*w, st + (k+1)*w, st + (k+m)*w, aaa, w, uuu, lll,
+		  width);
+    for (; k<n-1; k++)
+	lanes_row(st + k*w, st + (k+1)*w, st + (k+m-n)*w, aaa, w, uuu, lll,
+		  width);
+    lanes_row(st + (n-1)*w, st, st + (m-1)*w, aaa, w, uuu, lll, width);
+    lanes->i = 0;
+}
+
+/* out[j*count + l] = tempered word l of the rows i..i+rows-1 */
+static ALWAYS_INLINE void lanes_temper_n(const mt_lanes *lanes, uint32_t *out,
+					 int rows, int width)
+{
+    /* copies of the fields, which out may alias */
+    const uint32_t *st = lanes->state + lanes->i * lanes->width;
+    const uint32_t *mb = lanes->maskB, *mc = lanes->maskC;
+    uint32_t x;
+    int count = lanes->count, w = lanes->width, j, l;
+    int s0 = lanes->shift0, s1 = lanes->shift1;
+    int sB = lanes->shiftB, sC = lanes->shiftC;
+#if defined(LANES_HAVE_VECTORS)
+    vec4_t x4, b4, c4;
+    vec8_t x8, b8, c8;
+    vec16_t x16, b16, c16;
+#endif
+
+    for (j=0; j<rows; j++, st+=w, out+=count) {
+	l = 0;
+#if defined(LANES_HAVE_VECTORS)
+	if (width == 16) {
+	    for (; l+16<=count; l+=16) {
+		memcpy(&x16, st + l, sizeof(x16));
+		memcpy(&b16, mb + l, sizeof(b16));
+		memcpy(&c16, mc + l, sizeof(c16));
+		x16 ^= x16 >> s0;
+		x16 ^= (x16 << sB) & b16;
+		x16 ^= (x16 << sC) & c16;
+		x16 ^= x16 >> s1;
+		memcpy(out + l, &x16, sizeof(x16));
+	    }
+	}
+	if (width >= 8) {
+	    for (; l+8<=count; l+=8) {
+		memcpy(&x8, st + l, sizeof(x8));
+		memcpy(&b8, mb + l, sizeof(b8));
+		memcpy(&c8, mc + l, sizeof(c8));
+		x8 ^= x8 >> s0;
+		x8 ^= (x8 << sB) & b8;
+		x8 ^= (x8 << sC) & c8;
+		x8 ^= x8 >> s1;
+		memcpy(out + l, &x8, sizeof(x8));
+	    }
+	}
+	if (width >= 4) {
+	    for (; l+4<=count; l+=4) {
+		memcpy(&x4, st + l, sizeof(x4));
+		memcpy(&b4, mb + l, sizeof(b4));
+		memcpy(&c4, mc + l, sizeof(c4));
+		x4 ^= x4 >> s0;
+		x4 ^= (x4 << sB) & b4;
+		x4 ^= (x4 << sC) & c4;
+		x4 ^= x4 >> s1;
+		memcpy(out + l, &x4, sizeof(x4));
+	    }
+	}
+#endif
+	for (; l<count; l++) {
+	    x = st[l];
+	    x ^= x >> s0;
+	    x ^= (x << sB) & mb[l];
+	    x ^= (x << sC) & mc[l];
+	    x ^= x >> s1;
+	    out[l] = x;
+	}
+    }
+}
+
+/* SSE2 on x86-64 */
+static void lanes_next_state_generic(mt_lanes *lanes)
+{
+    lanes_next_state_n(lanes, 4);
+}
+
+static void lanes_temper_generic(const mt_lanes *lanes, uint32_t *out,
+				 int rows)
+{
+    lanes_temper_n(lanes, out, rows, 4);
+}
+
+#if defined(LANES_HAVE_AVX)
+__attribute__((target("avx2")))
+static void lanes_next_state_avx2(mt_lanes *lanes)
+{
+    lanes_next_state_n(lanes, 8);
+}
+
+__attribute__((target("avx2")))
+static void lanes_temper_avx2(const mt_lanes *lanes, uint32_t *out, int rows)
+{
+    lanes_temper_n(lanes, out, rows, 8);
+}
+
+__attribute__((target("avx512f")))
+static void lanes_next_state_avx512(mt_lanes *lanes)
+{
+    lanes_next_state_n(lanes, 16);
+}
+
+__attribute__((target("avx512f")))
+static void lanes_temper_avx512(const mt_lanes *lanes, uint32_t *out,
+				int rows)
+{
+    lanes_temper_n(lanes, out, rows, 16);
+}
+#endif
+
+/* the kernels of the machine, picked by new_mt_lanes() */
+static void set_lanes_kernels(mt_lanes *lanes)
+{
+    lanes->next_state = lanes_next_state_generic;
+    lanes->temper = lanes_temper_generic;
+#if defined(LANES_HAVE_AVX)
+    if (__builtin_cpu_supports("avx512f")) {
+	lanes->next_state = lanes_next_state_avx512;
+	lanes->temper = lanes_temper_avx512;
+    } else if (__builtin_cpu_supports("avx2")) {
+	lanes->next_state = lanes_next_state_avx2;
+	lanes->temper = lanes_temper_avx2;
+    }
+#endif
+}
+
+/* whether mts may share the lanes of ref */
+static int same_lanes(const mt_struct *ref, const mt_struct *mts)
+{
+    return mts->mm == ref->mm && mts->nn == ref->nn && mts->rr == ref->rr
+	&& mts->ww == ref->ww && mts->wmask == ref->wmask
+	&& mts->umask == ref->umask && mts->lmask == ref->lmask
+	&& mts->shift0 == ref->shift0 && mts->shift1 == ref->shift1
+	&& mts->shiftB == ref->shiftB && mts->shiftC == ref->shiftC
+	&& mts->i == ref->i;
+}
+
+/*
+   copies the count generators mtss[] into lanes; they must have the
+   same parameters except aaa, maskB and maskC, and be at the same
+   position (mts->i).  The generators themselves are not advanced.
+*/
+mt_lanes *new_mt_lanes(mt_struct **mtss, int count)
+{
+    mt_lanes *lanes;
+    size_t words;
+    char *p;
+    int k, l, width;
+
+    if (count < 1) {
+	printf("count must be positive\n");
+	return NULL;
+    }
+    for (l=1; l<count; l++) {
+	if (!same_lanes(mtss[0], mtss[l])) {
+	    printf("generator %d does not match generator 0\n", l);
+	    return NULL;
+	}
+    }
+
+    lanes = (mt_lanes*)malloc(sizeof(mt_lanes));
+    if (NULL == lanes) return NULL;
+    width = (count + LANES_ALIGN - 1) & ~(LANES_ALIGN - 1);
+    words = (size_t)(3 + mtss[0]->nn) * width
+	+ (size_t)LANES_DOUBLE_ROWS * count;
+    lanes->mem = calloc(words * sizeof(uint32_t) + 63, 1);
+    if (NULL == lanes->mem) {
+	free(lanes);
+	return NULL;
+    }
+    p = (char*)lanes->mem + ((64 - (uintptr_t)lanes->mem % 64) % 64);
+    lanes->aaa = (uint32_t*)p;
+    lanes->maskB = lanes->aaa + width;
+    lanes->maskC = lanes->maskB + width;
+    lanes->state = lanes->maskC + width;
+    lanes->buf = lanes->state + (size_t)mtss[0]->nn * width;
+
+    lanes->count = count;
+    lanes->width = width;
+    lanes->nn = mtss[0]->nn;
+    lanes->mm = mtss[0]->mm;
+    lanes->ww = mtss[0]->ww;
+    lanes->i = mtss[0]->i;
+    lanes->umask = mtss[0]->umask;
+    lanes->lmask = mtss[0]->lmask;
+    lanes->shift0 = mtss[0]->shift0;
+    lanes->shift1 = mtss[0]->shift1;
+    lanes->shiftB = mtss[0]->shiftB;
+    lanes->shiftC = mtss[0]->shiftC;
+    set_lanes_kernels(lanes);
+    for (l=0; l<count; l++) {
+	lanes->aaa[l] = mtss[l]->aaa;
+	lanes->maskB[l] = mtss[l]->maskB;
+	lanes->maskC[l] = mtss[l]->maskC;
+	for (k=0; k<lanes->nn; k++)
+	    lanes->state[k * width + l] = mtss[l]->state[k];
+    }
+    return lanes;
+}
+
+void free_mt_lanes(mt_lanes *lanes)
+{
+    if (NULL == lanes) return;
+    free(lanes->mem);
+    free(lanes);
+}
+
+int mt_lanes_count(const mt_lanes *lanes)
+{
+    return lanes->count;
+}
+
+/* copies the state of generator l back into mts, one of its kind */
+void mt_lanes_get(const mt_lanes *lanes, int l, mt_struct *mts)
+{
+    int k;
+
+    for (k=0; k<lanes->nn; k++)
+	mts->state[k] = lanes->state[k * lanes->width + l];
+    mts->i = lanes->i;
+}
+
+/*
+   out[j*count + l] = output j of the next n outputs of genrand_mt()
+   of generator l, for j < n and l < count
+*/
+void mt_lanes_fill_uint32(mt_lanes *lanes, uint32_t *out, size_t n)
+{
+    size_t rows;
+
+    while (n > 0) {
+	if (lanes->i >= lanes->nn)
+	    lanes->next_state(lanes);
+	rows = lanes->nn - lanes->i;
+	if (rows > n) rows = n;
+	lanes->temper(lanes, out, (int)rows);
+	lanes->i += (int)rows;
+	out += rows * lanes->count;
+	n -= rows;
+    }
+}
+
+/*
+   out[j*count + l] = output j of the next n outputs of
+   dcmt_fill_double() of generator l
+*/
+void mt_lanes_fill_double(mt_lanes *lanes, double *out, size_t n)
+{
+    uint32_t *a, *b;
+    int sa = lanes->ww - 27, sb = lanes->ww - 26, count = lanes->count, l;
+    size_t j, rows;
+
+    while (n > 0) {
+	rows = (n < LANES_DOUBLE_ROWS / 2) ? n : LANES_DOUBLE_ROWS / 2;
+	mt_lanes_fill_uint32(lanes, lanes->buf, 2 * rows);
+	for (j=0; j<rows; j++, out+=count) {
+	    a = lanes->buf + 2 * j * count;
+	    b = a + count;
+	    /* the words fit in int32_t, which converts faster */
+	    for (l=0; l<count; l++)
+		out[l] = ((int32_t)(a[l] >> sa) * 67108864.0
+			  + (int32_t)(b[l] >> sb))
+		    * (1.0 / 9007199254740992.0);
+	}
+	n -= rows;
+    }
+}
@@ -0,0 +1,83 @@
+/* mkcatalog.c */
+
+/* Writes a catalog of precomputed parameters (see catalog.c) or checks
+   one.  Run "make catalog" to build the catalog of all 65536 IDs for
+   the CATALOG_* settings of the Makefile.
+
+   mkcatalog w p seed start_id max_id n_threads file
+       searches the IDs start_id..max_id with n_threads threads
+       (0 for the serial search of get_mt_parameters_st()) and
+       writes them to file;
+   mkcatalog check file
+       prints the contents of the header and checks the records. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dc.h"
+
+static int check(const char *path)
+{
+    mt_catalog *cat;
+    int w, p, start_id, count, ok;
+    uint32_t seed;
+
+    cat = open_mt_catalog(path);
+    if (NULL == cat) {
+	fprintf(stderr, "%s: not a catalog\n", path);
+	return 1;
+    }
+    count = mt_catalog_info(cat, &w, &p, &seed, &start_id);
+    ok = check_mt_catalog(cat);
+    printf("w=%d p=%d seed=%lu ids=%d..%d %s\n", w, p,
+	   (unsigned long)seed, start_id, start_id+count-1,
+	   ok ? "ok" : "BROKEN");
+    close_mt_catalog(cat);
+
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    int w, p, start_id, max_id, count;
+    uint32_t seed;
+    dc_opts opts;
+    mt_struct **mtss;
+
+    if (argc == 3 && 0 == strcmp(argv[1], "check"))
+	return check(argv[2]);
+    if (argc != 8) {
+	fprintf(stderr, "usage: %s w p seed start_id max_id n_threads file\n"
+		"       %s check file\n", argv[0], argv[0]);
+	return 2;
+    }
+
+    w = atoi(argv[1]);
+    p = atoi(argv[2]);
+    seed = strtoul(argv[3], NULL, 0);
+    start_id = atoi(argv[4]);
+    max_id = atoi(argv[5]);
+    init_dc_opts(&opts);
+    opts.n_threads = atoi(argv[6]);
+
+    mtss = get_mt_parameters_opt_st(w, p, start_id, max_id, seed, &opts,
+				    &count);
+    if (NULL == mtss) {
+	fprintf(stderr, "search failed\n");
+	return 1;
+    }
+    if (count < max_id-start_id+1)
+	fprintf(stderr, "search failed at ID %d, writing %d IDs\n",
+		start_id+count, count);
+
+    if (0 != write_mt_catalog(argv[7], mtss, count, start_id, seed,
+			      opts.n_threads > 0 ? DC_CATALOG_ID_STREAM
+			      : DC_CATALOG_SERIAL)) {
+	fprintf(stderr, "%s: cannot write\n", argv[7]);
+	free_mt_struct_array(mtss, count);
+	return 1;
+    }
+    free_mt_struct_array(mtss, count);
+
+    return 0;
+}
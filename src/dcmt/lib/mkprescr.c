@@ -0,0 +1,71 @@
+/* mkprescr.c */
+
+/* Writes prescr_tables.h: the modlist tables of _InitPrescreening_dc()
+   for every supported (w, p) pair, so that they do not have to be
+   computed at run time.  Run "make tables" to regenerate the header. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "dci.h"
+
+#define NIRREDPOLY 127
+
+static const int exponents[] = {
+    521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
+    9689, 9941, 11213, 19937, 21701, 23209, 44497
+};
+#define NEXPONENTS ((int)(sizeof(exponents) / sizeof(exponents[0])))
+
+int main(void)
+{
+    int i, j, k, w, p, m, n, r;
+    prescr_t pre;
+
+    printf("/* prescr_tables.h -- generated by mkprescr.c, do not edit */\n\n");
+    printf("#define PRESCR_NTABLES %d\n\n", 2 * NEXPONENTS);
+
+    for (w=31; w<=32; w++) {
+	for (k=0; k<NEXPONENTS; k++) {
+	    p = exponents[k];
+	    /* same as init_mt_search() in seive.c */
+	    n = p/w + 1;
+	    m = n/2;
+	    if (m < 2) m = n-1;
+	    r = n * w - p;
+
+	    if (0 != _InitPrescreening_dc(&pre, m, n, r, w))
+		return 1;
+	    printf("static const uint16_t prescr_table_%d_%d[%d][%d] = {\n",
+		   w, p, NIRREDPOLY, w+1);
+	    for (i=0; i<NIRREDPOLY; i++) {
+		printf("{");
+		for (j=0; j<=w; j++) {
+		    printf(j < w ? "%u," : "%u",
+			   (unsigned)pre.modlist[i * (w + 1) + j]);
+		}
+		printf("},\n");
+	    }
+	    printf("};\n\n");
+	    _EndPrescreening_dc(&pre);
+	}
+    }
+
+    printf("static const struct {\n");
+    printf("    int m, n, r, w;\n");
+    printf("    const uint16_t *modlist; /* NIRREDPOLY rows of w+1 entries */\n");
+    printf("} prescr_tables[PRESCR_NTABLES] = {\n");
+    for (w=31; w<=32; w++) {
+	for (k=0; k<NEXPONENTS; k++) {
+	    p = exponents[k];
+	    n = p/w + 1;
+	    m = n/2;
+	    if (m < 2) m = n-1;
+	    r = n * w - p;
+	    printf("    {%d, %d, %d, %d, &prescr_table_%d_%d[0][0]},\n",
+		   m, n, r, w, w, p);
+	}
+    }
+    printf("};\n");
+
+    return 0;
+}
@@ -28,15 +28,46 @@
    ------------------------
    _InitPrescreening_dc(),_EndPrescreening_dc() shoud be called once.
    Parameters (m,n,r,w) should not be changed.
+
+   _InitCachedPrescreening_dc() can be used instead of
+   _InitPrescreening_dc(); it builds the tables once per (m,n,r,w)
+   and shares them between all searches in the process.
+   Both return 0, or -1 if out of memory.
 */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 #include "dci.h"
 
+/* mkprescr.c builds with DC_NO_PRESCR_TABLES to generate the tables */
+#if !defined(DC_NO_PRESCR_TABLES)
+#include "prescr_tables.h"
+#endif
+
 #define LIMIT_IRRED_DEG 31
 #define NIRREDPOLY 127
 #define MAX_IRRED_DEG 9
+#define WORDLEN 32
+
+/* the residues of the polynomials of row i, modulo irredpolylist[i] */
+#define MODLIST_ROW(pre, i) ((pre)->modlist + (i) * ((pre)->sizeofA + 1))
+
+/* 64-bit words per bit-slice in _prescreening_batch_dc() */
+#define LANE_WORDS (PRESCR_BATCH_MAX / 64)
+
+/* chkprescr.c builds with DC_NO_AVX2 to check the portable lanes */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+    && !defined(DC_NO_AVX2)
+#define PRESCR_HAVE_AVX2
+#endif
+
+/* the lane kernels are instantiated for several widths/targets */
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
 
 /* list of irreducible polynomials whose degrees are less than 10 */
 static const int irredpolylist[NIRREDPOLY][MAX_IRRED_DEG+1] = {
@@ -85,17 +116,30 @@ static const int irredpolylist[NIRREDPOLY][MAX_IRRED_DEG+1] = {
     {1,1,0,1,1,1,1,1,1,1,},
 };
 
-static void MakepreModPolys(prescr_t *pre, int mm, int nn, int rr, int ww);
-static Polynomial *make_tntm( int n, int m);
-static Polynomial *PolynomialDup(Polynomial *pl);
-static void PolynomialMod(Polynomial *wara, const Polynomial *waru);
-static Polynomial *PolynomialMult(Polynomial *p0, Polynomial *p1);
-static void FreePoly( Polynomial *p);
-static Polynomial *NewPoly(int degree);
-static int IsReducible(prescr_t *pre, uint32_t aaa, uint32_t *polylist);
-static uint32_t word2bit(Polynomial *pl);
-static void makemodlist(prescr_t *pre, Polynomial *pl, int nPoly);
-static void NextIrredPoly(Polynomial *pl, int nth);
+static int MakepreModPolys(prescr_t *pre, int mm, int nn, int rr, int ww);
+static gf2x_t *make_tntm( int n, int m);
+static int IsReducible(prescr_t *pre, uint32_t aaa, const uint16_t *polylist);
+static void makemodlist(prescr_t *pre, uint32_t pl, int nPoly);
+static uint32_t NextIrredPoly(int nth);
+static const uint16_t *find_modlist(int m, int n, int r, int w);
+static void prescreen_lanes_1(prescr_t *pre,
+			      uint64_t (*cbits)[LANE_WORDS], uint64_t *surv);
+static void prescreen_lanes(prescr_t *pre,
+			    uint64_t (*cbits)[LANE_WORDS], uint64_t *surv);
+#if defined(PRESCR_HAVE_AVX2)
+static void prescreen_lanes_avx2(prescr_t *pre,
+				 uint64_t (*cbits)[LANE_WORDS], uint64_t *surv);
+#endif
+
+/* modlist tables shared by _InitCachedPrescreening_dc(); never freed */
+typedef struct MODLIST_CACHE_T {
+    int m, n, r, w;
+    const uint16_t *modlist;
+    struct MODLIST_CACHE_T *next;
+} modlist_cache_t;
+
+static modlist_cache_t *modlist_cache = NULL;
+static pthread_mutex_t modlist_cache_lock = PTHREAD_MUTEX_INITIALIZER;
 
 
 #if defined(DEBUG)
@@ -104,7 +148,6 @@ static void printPoly(Polynomial *p);
 static void printPoly2(Polynomial *p);
 static void printuint32(uint32_t x);
 static void show_modlist(prescr_t *pre);
-static Polynomial *PolynomialSum( Polynomial *p0, Polynomial *p1);
 /***********************************/
 #endif
 
@@ -116,114 +159,258 @@ int _prescreening_dc(prescr_t *pre, uint32_t aaa)
     int i;
 
     for (i=0; i<NIRREDPOLY; i++) {
-	if (IsReducible(pre, aaa,pre->modlist[i])==REDU)
+	if (IsReducible(pre, aaa, MODLIST_ROW(pre, i))==REDU)
 	    return REJECTED;
     }
     return NOT_REJECTED;
 }
 
-void _InitPrescreening_dc(prescr_t *pre, int m, int n, int r, int w)
+/*
+   Prescreens count (at most PRESCR_BATCH_MAX) candidates at once.
+   Bit k of survivors[k/64] is set if aaa[k] is NOT_REJECTED.
+   The candidates are transposed into bit-slices, so that one word
+   operation evaluates IsReducible() for 64 candidates (256 with AVX2);
+   batches of more than 64 are evaluated 256 candidates at a time.
+*/
+void _prescreening_batch_dc(prescr_t *pre, const uint32_t *aaa, int count,
+			    uint64_t *survivors)
 {
-    int i;
-    Polynomial *pl;
+    int j, k, nw;
+    uint64_t cbits[WORDLEN][LANE_WORDS], surv[LANE_WORDS], bit;
+
+    nw = (count + 63) / 64;
+    for (j=0; j<pre->sizeofA; j++) {
+	for (k=0; k<LANE_WORDS; k++)
+	    cbits[j][k] = 0;
+	for (k=0; k<count; k++) {
+	    bit = (uint64_t)((aaa[k] >> j) & 0x1);
+	    cbits[j][k >> 6] |= bit << (k & 63);
+	}
+    }
 
-    pre->sizeofA = w;
+    for (k=0; k<LANE_WORDS; k++)
+	surv[k] = (k < nw) ? ~UINT64_C(0) : 0;
+    if (count & 63)
+	surv[nw-1] = (UINT64_C(1) << (count & 63)) - 1;
 
-    pre->preModPolys = (Polynomial **)malloc(
-	(pre->sizeofA+1)*(sizeof(Polynomial*)));
-    if (NULL == pre->preModPolys) {
-	printf ("malloc error in \"InitPrescreening\"\n");
-	exit(1);
-    }
-    MakepreModPolys(pre, m,n,r,w);
+    if (nw == 1)
+	prescreen_lanes_1(pre, cbits, surv);
+#if defined(PRESCR_HAVE_AVX2)
+    else if (__builtin_cpu_supports("avx2"))
+	prescreen_lanes_avx2(pre, cbits, surv);
+#endif
+    else
+	prescreen_lanes(pre, cbits, surv);
 
-    pre->modlist = (uint32_t**)malloc(NIRREDPOLY * sizeof(uint32_t*));
-    if (NULL == pre->modlist) {
+    for (k=0; k<nw; k++)
+	survivors[k] = surv[k];
+}
+
+/*
+   Points pre->modlist at the pregenerated table of (m,n,r,w), so that
+   the setup costs nothing; other parameters (or a build without the
+   tables) compute it into pre->modlist_own.
+*/
+int _InitPrescreening_dc(prescr_t *pre, int m, int n, int r, int w)
+{
+    int i, res;
+
+    pre->sizeofA = w;
+    pre->modlist_own = NULL;
+    pre->preModPolys = NULL;
+    pre->modlist = find_modlist(m, n, r, w);
+    if (NULL != pre->modlist)
+	return 0;
+
+    pre->modlist_own = (uint16_t *)malloc(
+	NIRREDPOLY * (pre->sizeofA + 1) * sizeof(uint16_t));
+    pre->preModPolys = (gf2x_t **)calloc(
+	pre->sizeofA+1, sizeof(gf2x_t*));
+    if (NULL == pre->modlist_own || NULL == pre->preModPolys) {
 	printf ("malloc error in \"InitPrescreening()\"\n");
-	exit(1);
-    }
-    for (i=0; i<NIRREDPOLY; i++) {
-	pre->modlist[i]
-	    = (uint32_t*)malloc( (pre->sizeofA + 1) * (sizeof(uint32_t)) );
-	if (NULL == pre->modlist[i]) {
-	    printf ("malloc error in \"InitPrescreening()\"\n");
-	    exit(1);
-	}
+	free(pre->modlist_own);
+	free(pre->preModPolys);
+	pre->modlist_own = NULL;
+	pre->preModPolys = NULL;
+	return -1;
     }
+    pre->modlist = pre->modlist_own;
 
-
-    for (i=0; i<NIRREDPOLY; i++) {
-	pl = NewPoly(MAX_IRRED_DEG);
-	NextIrredPoly(pl,i);
-	makemodlist(pre, pl, i);
-	FreePoly(pl);
+    res = MakepreModPolys(pre, m,n,r,w);
+    if (0 == res) {
+	for (i=0; i<NIRREDPOLY; i++)
+	    makemodlist(pre, NextIrredPoly(i), i);
     }
 
     for (i=pre->sizeofA; i>=0; i--)
-	FreePoly(pre->preModPolys[i]);
+	_gf2x_free_dc(pre->preModPolys[i]);
     free(pre->preModPolys);
+    pre->preModPolys = NULL;
+    if (0 != res)
+	_EndPrescreening_dc(pre);
+    return res;
+}
+
+/* same, with the computed modlists shared by the whole process */
+int _InitCachedPrescreening_dc(prescr_t *pre, int m, int n, int r, int w)
+{
+    modlist_cache_t *c;
+    prescr_t tmp;
 
+    pre->sizeofA = w;
+    pre->modlist_own = NULL;
+    pre->preModPolys = NULL;
+    pre->modlist = find_modlist(m, n, r, w);
+    if (NULL != pre->modlist)
+	return 0;
+
+    pthread_mutex_lock(&modlist_cache_lock);
+    for (c=modlist_cache; c!=NULL; c=c->next) {
+	if (c->m == m && c->n == n && c->r == r && c->w == w)
+	    break;
+    }
+    if (NULL == c) {
+	c = (modlist_cache_t *)malloc(sizeof(modlist_cache_t));
+	if (NULL == c || 0 != _InitPrescreening_dc(&tmp, m, n, r, w)) {
+	    printf ("malloc error in \"InitCachedPrescreening()\"\n");
+	    pthread_mutex_unlock(&modlist_cache_lock);
+	    free(c);
+	    return -1;
+	}
+	c->m = m; c->n = n; c->r = r; c->w = w;
+	c->modlist = tmp.modlist;
+	c->next = modlist_cache;
+	modlist_cache = c;
+    }
+    pthread_mutex_unlock(&modlist_cache_lock);
+
+    pre->modlist = c->modlist;
+    return 0;
 }
 
 void _EndPrescreening_dc(prescr_t *pre)
 {
-    int i;
-
-    for (i=0; i<NIRREDPOLY; i++)
-      free(pre->modlist[i]);
-    free(pre->modlist);
+    free(pre->modlist_own);
+    pre->modlist_own = NULL;
+    pre->modlist = NULL;
 }
 
 /*************************************************/
 /******          static functions           ******/
 /*************************************************/
 
-void NextIrredPoly(Polynomial *pl, int nth)
+/* bit-sliced IsReducible() over all polynomials for nw words of
+   candidates; clears the bits of rejected candidates in surv */
+static ALWAYS_INLINE void prescreen_lanes_n(prescr_t *pre, int nw,
+					    uint64_t (*cbits)[LANE_WORDS],
+					    uint64_t *surv)
 {
-    int i, max_deg;
+    int i, j, k, b;
+    uint32_t x;
+    const uint16_t *polylist;
+    uint64_t res[MAX_IRRED_DEG][LANE_WORDS], mask, any;
 
-    for (max_deg=0,i=0; i<=MAX_IRRED_DEG; i++) {
-	if ( irredpolylist[nth][i] )
-	    max_deg = i;
-	pl->x[i] = irredpolylist[nth][i];
+    for (i=0; i<NIRREDPOLY; i++) {
+	polylist = MODLIST_ROW(pre, i);
+	x = polylist[pre->sizeofA];
+	for (b=0; b<MAX_IRRED_DEG; b++) {
+	    mask = -(uint64_t)((x >> b) & 0x1);
+	    for (k=0; k<nw; k++)
+		res[b][k] = mask;
+	}
+	/* branch-free, so that the lane loops vectorize */
+	for (j=0; j<pre->sizeofA; j++) {
+	    x = polylist[pre->sizeofA-1-j];
+	    for (b=0; b<MAX_IRRED_DEG; b++) {
+		mask = -(uint64_t)((x >> b) & 0x1);
+		for (k=0; k<nw; k++)
+		    res[b][k] ^= cbits[j][k] & mask;
+	    }
+	}
+
+	any = 0;
+	for (k=0; k<nw; k++) {
+	    for (b=1; b<MAX_IRRED_DEG; b++)
+		res[0][k] |= res[b][k];
+	    surv[k] &= res[0][k];
+	    any |= surv[k];
+	}
+	if (!any) break;
     }
+}
 
-    pl->deg = max_deg;
+static void prescreen_lanes_1(prescr_t *pre,
+			      uint64_t (*cbits)[LANE_WORDS], uint64_t *surv)
+{
+    prescreen_lanes_n(pre, 1, cbits, surv);
+}
 
+static void prescreen_lanes(prescr_t *pre,
+			    uint64_t (*cbits)[LANE_WORDS], uint64_t *surv)
+{
+    prescreen_lanes_n(pre, LANE_WORDS, cbits, surv);
 }
 
-static void makemodlist(prescr_t *pre, Polynomial *pl, int nPoly)
+#if defined(PRESCR_HAVE_AVX2)
+/* same, with the lane loops in 256-bit registers */
+__attribute__((target("avx2")))
+static void prescreen_lanes_avx2(prescr_t *pre,
+				 uint64_t (*cbits)[LANE_WORDS], uint64_t *surv)
 {
-    Polynomial *tmpPl;
-    int i;
+    prescreen_lanes_n(pre, LANE_WORDS, cbits, surv);
+}
+#endif
 
-    for (i=0; i<=pre->sizeofA; i++) {
-	tmpPl = PolynomialDup(pre->preModPolys[i]);
-	PolynomialMod(tmpPl,pl);
-	pre->modlist[nPoly][i] = word2bit(tmpPl);
-	FreePoly(tmpPl);
+/* the pregenerated table of (m,n,r,w), NULL if there is none */
+static const uint16_t *find_modlist(int m, int n, int r, int w)
+{
+#if !defined(DC_NO_PRESCR_TABLES)
+    int k;
+
+    for (k=0; k<PRESCR_NTABLES; k++) {
+	if (prescr_tables[k].m == m && prescr_tables[k].n == n
+	    && prescr_tables[k].r == r && prescr_tables[k].w == w)
+	    return prescr_tables[k].modlist;
     }
+#else
+    (void)m; (void)n; (void)r; (void)w;
+#endif
+    return NULL;
 }
 
-/* Pack Polynomial into a word */
-static uint32_t word2bit(Polynomial *pl)
+/* nth irreducible polynomial, bit i is the coefficient of t^i */
+static uint32_t NextIrredPoly(int nth)
 {
     int i;
-    uint32_t bx;
+    uint32_t pl;
 
-    bx = 0;
-    for (i=pl->deg; i>0; i--) {
-	if (pl->x[i]) bx |= 0x1;
-	bx <<= 1;
+    pl = 0;
+    for (i=0; i<=MAX_IRRED_DEG; i++) {
+	if ( irredpolylist[nth][i] )
+	    pl |= UINT32_C(1) << i;
     }
-    if (pl->x[0]) bx |= 0x1;
 
-    return bx;
+    return pl;
+}
+
+/* row nPoly of modlist: preModPolys[i] mod pl, packed into a word
+   (of at most MAX_IRRED_DEG bits) */
+static void makemodlist(prescr_t *pre, uint32_t pl, int nPoly)
+{
+    gf2x_small_mod_t sm;
+    int i;
+
+    _gf2x_init_small_mod_dc(&sm, pl);
+    for (i=0; i<=pre->sizeofA; i++) {
+	pre->modlist_own[nPoly * (pre->sizeofA + 1) + i]
+	    = (uint16_t)_gf2x_small_mod_dc(&sm,
+	    pre->preModPolys[i]->x, GF2X_WORDS(pre->preModPolys[i]->deg));
+    }
 }
 
 /* REDU -- reducible */
 /* aaa = (a_{w-1}a_{w-2}...a_1a_0 */
-static int IsReducible(prescr_t *pre, uint32_t aaa, uint32_t *polylist)
+static int IsReducible(prescr_t *pre, uint32_t aaa, const uint16_t *polylist)
 {
     int i;
     uint32_t x;
@@ -243,143 +430,68 @@ static int IsReducible(prescr_t *pre, uint32_t aaa, uint32_t *polylist)
 /***********************************/
 /**   functions for polynomial    **/
 /***********************************/
-static Polynomial *NewPoly(int degree)
-{
-    Polynomial *p;
-
-    p = (Polynomial *)calloc( 1, sizeof(Polynomial));
-    if( p==NULL ){
-	printf("calloc error in \"NewPoly()\"\n");
-	exit(1);
-    }
-    p->deg = degree;
-
-    if (degree < 0) {
-	p->x = NULL;
-	return p;
-    }
-
-    p->x = (int *)calloc( degree + 1, sizeof(int));
-    if( p->x == NULL ){
-	printf("calloc error\n");
-	exit(1);
-    }
-
-    return p;
-}
-
-static void FreePoly( Polynomial *p)
-{
-    if (p->x != NULL)
-	free( p->x );
-    free( p );
-}
-
-
-/** multiplication **/
-static Polynomial *PolynomialMult(Polynomial *p0,Polynomial *p1)
-{
-    int i, j;
-    Polynomial *p;
-
-    /* if either p0 or p1 is 0, return 0 */
-    if ( (p0->deg < 0) || (p1->deg < 0) ) {
-	p = NewPoly(-1);
-	return p;
-    }
-
-    p = NewPoly(p0->deg + p1->deg);
-    for( i=0; i<=p1->deg; i++){
-	if( p1->x[i] ){
-	    for( j=0; j<=p0->deg; j++){
-		p->x[i+j] ^= p0->x[j];
-	    }
-	}
-    }
-
-    return p;
-}
-
-/** wara mod waru **/
-/** the result is stored in wara ********/
-static void PolynomialMod( Polynomial *wara, const Polynomial *waru)
-{
-    int i;
-    int deg_diff;
-
-    while( wara->deg >= waru->deg  ){
-	deg_diff = wara->deg - waru->deg;
-	for( i=0; i<=waru->deg; i++){
-	    wara->x[ i+deg_diff ] ^= waru->x[i];
-	}
-
-	for( i=wara->deg; i>=0; i--){
-	    if( wara->x[i] ) break;
-	}
-	wara->deg=i;
-
-    }
-}
-
-static Polynomial *PolynomialDup(Polynomial *pl)
-{
-    Polynomial *pt;
-    int i;
-
-    pt = NewPoly(pl->deg);
-    for (i=pl->deg; i>=0; i--)
-	pt->x[i] = pl->x[i];
-
-    return pt;
-}
 
 /** make the polynomial  "t**n + t**m"  **/
-static Polynomial *make_tntm( int n, int m)
+static gf2x_t *make_tntm( int n, int m)
 {
-    Polynomial *p;
+    gf2x_t *p;
 
-    p = NewPoly(n);
-    p->x[n] = p->x[m] = 1;
+    p = _gf2x_new_dc(n);
+    if (NULL == p) return NULL;
+    p->x[n >> 6] |= UINT64_C(1) << (n & 63);
+    p->x[m >> 6] |= UINT64_C(1) << (m & 63);
 
     return p;
 }
 
-static void MakepreModPolys(prescr_t *pre, int mm, int nn, int rr, int ww)
+/* fills pre->preModPolys[] (cleared by the caller); returns 0, or -1
+   if out of memory, with the polynomials made so far left there */
+static int MakepreModPolys(prescr_t *pre, int mm, int nn, int rr, int ww)
 {
-    Polynomial *t, *t0, *t1, *s, *s0, *s1;
-    int i,j;
+    gf2x_t *t, *t0, *t1, *s, *s0, *s1;
+    int i,j,res;
 
+    res = -1;
     j = 0;
-    t = NewPoly(0);
-    t->deg = 0;
+    s0 = NULL;
+    t = _gf2x_new_dc(0);
+    if (NULL == t) return -1;
     t->x[0] = 1;
     pre->preModPolys[j++] = t;
 
     t = make_tntm (nn, mm);
     t0 = make_tntm (nn, mm);
     s = make_tntm (nn-1, mm-1);
+    if (NULL == t || NULL == t0 || NULL == s) goto out;
 
     for( i=1; i<(ww - rr); i++){
-	pre->preModPolys[j++] = PolynomialDup(t0);
+	pre->preModPolys[j++] = _gf2x_dup_dc(t0);
 	t1 = t0;
-	t0 = PolynomialMult(t0, t);
-	FreePoly(t1);
+	t0 = _gf2x_mult_dc(t0, t);
+	_gf2x_free_dc(t1);
+	if (NULL == pre->preModPolys[j-1] || NULL == t0) goto out;
     }
 
-    pre->preModPolys[j++] = PolynomialDup(t0);
+    pre->preModPolys[j++] = _gf2x_dup_dc(t0);
 
-    s0 =PolynomialMult( t0, s);
-    FreePoly(t0);	FreePoly(t);
+    s0 = _gf2x_mult_dc( t0, s);
+    if (NULL == pre->preModPolys[j-1] || NULL == s0) goto out;
     for( i=(rr-2); i>=0; i--){
-	pre->preModPolys[j++] = PolynomialDup(s0);
+	pre->preModPolys[j++] = _gf2x_dup_dc(s0);
 	s1 = s0;
-	s0 = PolynomialMult( s0, s);
-	FreePoly(s1);
+	s0 = _gf2x_mult_dc( s0, s);
+	_gf2x_free_dc(s1);
+	if (NULL == pre->preModPolys[j-1] || NULL == s0) goto out;
     }
 
-    pre->preModPolys[j++] = PolynomialDup(s0);
+    pre->preModPolys[j++] = _gf2x_dup_dc(s0);
+    if (NULL != pre->preModPolys[j-1])
+	res = 0;
 
-    FreePoly(s0); FreePoly(s);
+ out:
+    _gf2x_free_dc(s0); _gf2x_free_dc(s);
+    _gf2x_free_dc(t0); _gf2x_free_dc(t);
+    return res;
 }
 
 /********************************/
@@ -452,61 +564,11 @@ static void show_modlist(prescr_t *pre)
 
     for (i=0; i<NIRREDPOLY; i++)  {
 	for (j=0; j<=pre->sizeofA; j++)
-	    printuint32(pre->modlist[i][j]);
+	    printuint32(MODLIST_ROW(pre, i)[j]);
 	getchar();
     }
 }
 
-/** addition **/
-static Polynomial *PolynomialSum( Polynomial *p0, Polynomial *p1)
-{
-    Polynomial *p, *pmin, *pmax;
-    int i, maxdeg, mindeg;
-
-    if ( p0->deg > p1->deg ) {
-	pmax = p0;
-	pmin = p1;
-    }
-    else {
-	pmax = p1;
-	pmin = p0;
-    }
-    maxdeg = pmax->deg;
-    mindeg = pmin->deg;
-
-    p = NewPoly(maxdeg);
-    for (i=0; i<=maxdeg; i++)
-	p->x[i] = pmax->x[i];
-    for( i=0; i<=mindeg; i++)
-	p->x[i] ^= pmin->x[i];
-
-    for( i=p->deg; i>=0; i--){
-	if( p->x[i] ) break;
-    }
-    p->deg=i;
-
-    return p;
-}
-
-static Polynomial *chPoly(prescr_t *pre, uint32_t a)
-{
-    Polynomial *pl, *tmpP;
-    int i;
-
-    pl = PolynomialDup(pre->preModPolys[pre->sizeofA]);
-    for (i=pre->sizeofA-1; i>=0; i--) {
-	if (a&1U) {
-	    tmpP = PolynomialSum(pl, pre->preModPolys[i]);
-	    FreePoly(pl);
-	    pl = tmpP;
-	}
-	a >>= 1;
-    }
-
-    return pl;
-}
-
-
 int main(void)
 {
     int i,j,cnt;
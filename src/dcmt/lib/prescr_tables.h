@@ -0,0 +1,3939 @@
+/* prescr_tables.h -- generated by mkprescr.c, do not edit */
+
+#define PRESCR_NTABLES 30
+
+static const uint16_t prescr_table_31_521[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,7,6,3,4,2},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,3,2,7,1,5,6},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,13,15,14,7,10},
+{1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,9,6,7,2,10,9},
+{1,12,13,1,12,13,1,12,13,1,12,13,1,12,13,1,12,13,1,12,13,1,12,13,1,12,9,8,14,5,1,6},
+{1,30,19,17,8,11,12,28,10,18,15,27,26,4,23,6,14,5,9,21,31,13,2,25,3,7,8,23,3,17,4,25},
+{1,2,4,8,16,9,18,13,26,29,19,15,30,21,3,6,12,24,25,27,31,23,7,14,28,17,17,17,17,17,17,17},
+{1,24,23,12,28,6,14,3,7,22,20,11,10,18,5,9,21,19,29,30,25,15,27,16,26,8,17,1,12,14,22,10},
+{1,7,21,5,27,24,17,25,22,12,19,23,11,6,18,16,30,3,9,8,15,26,31,4,28,13,10,27,12,18,8,28},
+{1,4,16,13,15,7,28,6,24,22,21,25,18,5,20,29,2,8,27,26,30,14,3,12,11,23,21,17,25,9,18,31},
+{1,10,3,30,5,31,15,28,17,25,14,22,18,7,11,9,29,27,26,16,19,13,8,23,24,4,20,3,15,14,11,26},
+{1,42,55,18,41,10,8,31,50,22,7,19,3,61,26,54,56,30,24,33,21,58,9,53,5,4,23,55,9,59,48,33},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,23,62,15,8,18,11},
+{1,17,54,15,18,5,14,3,51,1,17,54,15,18,5,14,3,51,1,17,54,15,18,5,14,3,52,59,50,8,31,55},
+{1,18,35,56,58,30,57,40,61,1,18,35,56,58,30,57,40,61,1,18,35,56,58,30,57,40,46,24,26,8,41,39},
+{1,46,41,45,60,49,44,18,24,1,46,41,45,60,49,44,18,24,1,46,41,45,60,49,44,18,12,42,28,8,17,53},
+{1,9,44,34,49,13,8,37,14,19,60,5,45,43,29,47,57,40,6,54,50,22,17,46,48,4,18,44,17,23,12,54},
+{1,62,48,29,23,36,8,60,63,14,45,10,51,44,52,3,49,35,39,57,31,24,55,50,18,4,15,48,55,25,61,57},
+{1,36,2,61,4,15,8,30,16,60,32,13,53,26,31,52,62,29,9,58,18,1,36,2,61,4,61,2,36,1,18,58},
+{1,46,76,116,48,50,110,117,30,126,26,69,44,16,111,91,82,10,42,119,66,101,113,37,72,79,3,57,53,82,5,75},
+{1,62,14,102,84,64,110,63,48,104,50,20,46,81,15,88,90,38,58,127,94,87,2,124,28,69,84,32,95,112,3,33},
+{1,5,17,85,31,99,126,23,75,121,12,60,67,81,11,39,52,107,86,16,80,14,54,97,116,53,55,50,125,12,30,51},
+{1,24,98,11,121,65,69,37,30,50,101,67,117,112,8,81,118,88,63,76,108,10,97,35,78,92,103,113,8,96,85,11},
+{1,44,37,83,100,70,76,78,22,92,103,50,35,38,39,11,46,125,25,95,19,93,75,23,112,66,126,120,12,117,111,52},
+{1,35,115,84,12,125,111,34,80,39,88,113,18,77,114,119,127,41,99,95,63,5,8,86,74,60,48,93,111,17,20,16},
+{1,9,65,78,57,12,108,93,25,122,80,124,102,7,63,58,23,4,36,82,110,79,48,77,34,100,95,80,62,76,64,118},
+{1,57,48,10,113,43,68,69,124,76,70,55,28,88,29,97,45,107,92,64,24,5,100,73,34,126,31,85,61,106,110,28},
+{1,81,36,43,41,52,124,42,120,16,87,3,76,108,125,123,92,59,126,55,48,70,5,107,11,56,25,57,110,48,35,113},
+{1,118,103,58,37,122,72,24,94,68,55,124,63,9,3,91,104,78,111,79,25,40,35,13,89,69,64,86,120,82,85,53},
+{1,80,50,60,112,17,36,62,27,117,92,21,57,61,32,35,24,78,10,81,98,14,76,97,53,26,119,126,75,70,24,39},
+{1,86,15,94,85,38,79,100,10,37,102,117,59,9,12,119,68,23,99,14,8,90,120,26,66,69,73,27,10,123,112,32},
+{1,28,47,96,3,36,113,117,5,108,70,74,15,97,31,11,17,118,33,29,51,79,99,39,85,4,56,47,48,95,110,63},
+{1,55,99,95,23,97,49,52,58,31,19,88,119,103,102,81,50,109,122,27,42,30,36,59,40,112,113,24,75,101,4,110},
+{1,7,21,107,32,15,45,44,43,62,85,117,122,87,123,80,110,59,78,52,99,24,72,38,29,83,68,1,116,73,103,2},
+{1,63,10,100,68,44,127,43,51,29,28,35,41,77,9,37,90,113,66,95,67,96,73,4,13,40,57,68,22,91,39,18},
+{1,94,51,92,120,58,55,61,67,83,57,34,104,80,44,119,123,47,98,46,60,29,96,101,90,82,72,66,125,121,50,1},
+{1,45,77,122,33,107,47,23,29,40,41,4,73,51,18,121,86,65,92,116,93,89,16,35,49,72,15,86,94,23,112,10},
+{1,167,227,7,88,159,21,147,240,107,212,230,10,26,132,54,70,177,130,201,58,163,73,166,68,228,162,119,218,43,77,6},
+{1,133,2,23,4,46,8,92,16,184,32,109,64,218,128,169,29,79,58,158,116,33,232,66,205,132,205,66,232,33,116,158},
+{1,210,44,220,252,127,120,16,212,150,52,98,33,81,43,180,56,61,218,70,151,230,78,253,173,84,102,10,231,78,235,244},
+{1,202,188,192,187,236,248,246,174,40,28,176,33,104,117,15,146,58,244,23,125,177,235,212,181,180,63,166,75,82,214,6},
+{1,56,157,36,79,54,244,45,142,167,201,104,49,92,181,114,115,75,214,242,189,139,127,82,220,123,89,170,116,237,143,211},
+{1,44,172,159,22,86,208,11,43,104,154,138,52,77,69,26,185,189,13,195,193,153,254,255,211,127,112,162,20,7,98,209},
+{1,240,163,159,66,144,38,2,173,11,115,132,109,76,4,23,22,230,69,218,152,8,46,44,129,138,218,76,2,240,247,210},
+{1,12,80,33,211,168,34,199,88,65,237,255,39,251,23,228,147,73,141,193,112,254,43,171,54,55,178,77,241,152,177,71},
+{1,230,134,120,112,10,213,176,149,197,68,72,15,14,232,110,22,102,108,185,9,156,89,29,85,90,42,47,243,229,214,205},
+{1,22,113,13,254,247,81,7,98,50,35,48,15,210,21,75,158,233,144,45,244,107,148,117,85,95,211,179,188,213,137,71},
+{1,111,23,139,124,73,171,203,123,45,206,193,102,187,36,98,110,120,156,247,53,226,96,176,86,227,179,199,130,104,141,143},
+{1,230,79,246,99,179,62,212,134,167,25,220,144,61,143,87,204,188,120,210,48,116,207,231,169,185,242,52,135,152,173,89},
+{1,22,99,72,236,34,2,44,198,144,175,68,4,88,251,87,41,136,8,176,129,174,82,103,16,23,129,87,175,34,1,11},
+{1,125,23,194,110,90,240,177,105,82,149,9,24,175,179,147,124,106,213,172,52,170,65,216,59,199,78,231,132,95,1,131},
+{1,89,27,40,194,182,213,60,163,237,124,34,49,88,66,51,234,116,99,233,159,78,145,94,19,105,13,190,74,57,207,229},
+{1,84,194,13,178,224,81,77,209,139,7,39,211,35,8,61,60,104,170,167,21,245,164,233,56,179,90,70,8,219,15,13},
+{1,247,76,207,75,157,34,103,94,174,176,22,167,70,173,36,194,123,155,135,66,107,153,228,218,120,193,177,182,159,230,154},
+{1,101,134,62,163,8,22,237,111,90,64,176,139,70,113,161,194,133,145,182,74,108,245,85,242,241,47,117,85,121,148,108},
+{1,67,2,134,4,175,8,253,16,89,32,178,64,199,128,45,163,90,229,180,105,203,210,53,7,106,7,53,210,203,105,180},
+{1,153,238,180,216,144,224,39,58,44,175,202,140,111,74,235,178,220,15,10,12,8,151,125,86,100,187,105,39,29,11,158},
+{1,125,171,120,147,172,186,160,117,33,134,49,35,124,214,211,235,63,22,26,213,84,167,183,18,95,85,109,7,97,184,45},
+{1,42,119,94,87,144,37,76,100,71,247,28,34,154,156,96,239,150,217,195,29,8,237,194,55,127,135,74,76,50,160,70},
+{1,253,2,57,4,114,8,228,16,11,32,22,64,44,128,88,195,176,69,163,138,133,215,201,109,81,109,201,215,133,138,163},
+{1,35,167,189,77,51,198,23,136,65,104,94,55,74,218,45,186,164,216,107,59,17,66,13,120,63,169,80,21,103,48,182},
+{1,214,234,189,159,8,59,12,205,10,64,15,96,227,80,121,120,174,68,249,102,110,85,89,148,158,111,170,89,74,204,110},
+{1,31,136,77,47,255,211,13,155,65,171,54,53,20,81,134,247,43,131,148,228,39,7,93,2,62,136,200,146,83,92,224},
+{1,29,182,72,52,45,239,86,165,88,3,39,61,216,92,119,214,250,8,232,5,105,71,143,228,153,189,176,3,224,133,27},
+{1,130,177,88,109,110,27,59,211,100,214,251,182,48,156,21,235,194,146,197,250,52,129,196,120,133,149,175,126,206,163,148},
+{1,165,37,72,47,20,184,219,107,83,229,233,129,200,66,115,131,119,8,227,221,95,141,160,11,249,89,166,229,142,93,25},
+{1,39,3,105,5,187,15,52,17,92,51,228,85,213,255,134,248,115,241,149,234,70,199,202,176,167,232,4,78,3,200,127},
+{1,3,5,15,17,51,85,255,257,256,259,262,265,280,299,382,385,128,384,131,389,140,404,191,449,64,96,80,120,68,102,85},
+{1,136,113,197,427,71,168,505,146,455,157,12,83,93,286,417,309,467,104,235,352,175,80,453,397,238,484,334,50,46,365,58},
+{1,129,246,130,373,408,243,16,76,261,124,465,356,341,256,238,232,505,474,193,454,184,133,229,333,362,49,289,368,133,377,477},
+{1,175,280,469,154,153,360,91,63,401,58,409,372,309,413,467,355,228,416,284,370,204,480,283,36,425,371,316,62,159,325,260},
+{1,49,323,236,133,505,376,69,115,423,481,449,386,343,281,177,79,409,445,314,161,382,227,410,494,222,474,180,93,101,24,332},
+{1,19,261,26,398,387,324,147,49,366,96,215,231,410,255,50,347,322,249,88,306,286,391,264,221,89,390,411,118,464,379,401},
+{1,168,19,391,261,414,244,37,197,12,437,212,219,150,119,22,444,346,80,387,406,466,189,87,232,495,393,240,91,439,194,426},
+{1,299,483,481,508,113,504,75,169,274,388,214,185,506,86,292,155,55,52,258,364,260,331,472,411,326,379,112,332,106,41,354},
+{1,488,10,326,68,472,241,166,129,206,440,263,319,267,187,371,28,26,216,228,411,3,97,30,403,204,308,510,171,346,47,64},
+{1,505,200,332,36,81,420,60,174,71,422,401,318,128,494,307,41,248,178,445,314,389,145,189,185,444,334,491,456,328,447,356},
+{1,459,417,158,98,92,170,4,387,43,29,392,368,205,16,163,172,116,143,266,337,64,233,213,464,89,113,337,32,163,86,29},
+{1,473,366,436,255,170,204,136,240,160,192,128,295,29,22,451,165,198,132,248,375,125,86,100,415,205,412,339,278,242,393,135},
+{1,462,422,458,47,483,438,351,139,310,297,373,303,271,37,365,199,505,429,138,248,143,191,256,236,403,25,19,84,420,299,67},
+{1,282,329,451,387,63,98,289,429,296,443,386,293,299,226,46,279,473,163,136,3,345,428,50,242,65,83,69,16,268,458,497},
+{1,287,100,472,383,314,311,418,267,135,143,387,222,365,284,312,372,362,198,4,134,400,487,262,18,38,313,267,381,386,478,221},
+{1,162,220,317,432,227,142,181,265,507,491,471,386,483,457,235,144,476,122,494,378,169,292,304,259,161,157,500,14,489,266,333},
+{1,339,484,500,108,208,364,19,248,5,309,459,411,476,261,502,95,397,17,203,344,72,275,59,401,291,3,176,139,265,174,321},
+{1,385,334,23,162,361,277,435,373,106,389,225,29,254,376,387,213,18,140,45,350,256,138,25,337,370,419,49,348,257,457,447},
+{1,76,14,363,84,331,507,139,334,135,189,207,387,412,317,391,172,261,365,508,367,356,371,273,475,292,71,349,443,187,482,193},
+{1,59,15,377,85,220,422,446,371,507,186,173,281,452,89,488,482,76,42,289,390,305,147,449,142,475,328,250,395,31,54,128},
+{1,158,460,458,33,471,53,243,351,481,356,343,79,230,229,327,444,333,302,504,423,178,508,368,115,293,250,352,192,372,82,121},
+{1,458,280,174,293,341,213,430,282,397,418,9,40,435,176,102,289,420,475,417,224,439,65,360,302,94,427,331,203,301,256,324},
+{1,367,212,43,375,253,319,34,404,334,76,25,326,448,382,30,140,337,431,412,194,299,321,10,495,207,135,438,109,286,93,311},
+{1,291,237,418,476,16,470,114,53,132,256,36,113,415,435,297,143,65,298,293,374,259,398,326,438,280,491,361,67,438,140,402},
+{1,90,191,401,104,13,307,200,25,89,81,80,10,181,292,332,321,114,186,163,250,171,251,241,68,352,22,239,421,131,127,428},
+{1,201,77,140,484,475,489,456,35,121,192,417,114,190,453,48,435,369,322,426,12,218,391,317,263,3,448,131,351,148,40,366},
+{1,72,247,117,97,43,76,471,348,437,431,224,231,287,303,100,323,402,118,185,306,211,372,289,353,291,386,142,442,113,474,314},
+{1,190,339,406,281,248,62,371,414,283,388,97,166,341,235,504,126,355,410,282,314,306,304,76,19,454,506,129,79,404,334,491},
+{1,511,409,391,385,128,213,196,193,192,319,166,289,160,32,245,49,240,48,271,425,136,40,8,253,204,30,3,128,490,49,120},
+{1,92,177,205,406,188,18,77,24,262,455,210,260,383,432,158,320,200,186,474,248,421,327,348,190,170,286,489,264,254,447,501},
+{1,347,289,234,153,175,414,56,103,297,76,250,469,105,127,195,233,97,217,160,403,406,158,4,83,443,468,153,477,493,7,479},
+{1,369,50,96,37,130,132,412,304,112,174,189,186,211,77,365,406,263,388,113,479,143,218,246,207,489,5,202,433,60,89,270},
+{1,126,192,354,22,162,303,413,276,5,390,227,399,78,265,246,431,33,17,472,76,501,374,72,13,341,451,332,215,223,295,167},
+{1,465,146,245,376,308,33,374,508,447,435,488,338,125,424,28,400,13,394,40,474,173,128,429,235,123,406,220,289,278,402,79},
+{1,503,35,158,328,288,176,484,479,496,171,119,425,430,294,463,302,416,54,29,236,188,33,75,270,28,272,233,493,446,252,49},
+{1,486,296,337,488,506,140,418,380,246,120,351,314,39,198,292,262,300,91,147,357,446,216,5,236,83,231,402,16,349,379,491},
+{1,195,41,274,400,155,66,103,432,460,179,403,478,57,30,79,97,117,314,65,290,459,437,332,62,280,72,276,397,367,22,451},
+{1,31,341,208,305,353,487,18,462,78,460,112,61,464,260,73,401,109,342,241,405,17,495,234,188,120,463,389,349,20,198,492},
+{1,231,192,62,374,206,247,85,442,503,290,403,448,329,351,249,156,153,131,34,228,489,382,308,53,421,166,137,11,473,464,238},
+{1,253,70,132,54,311,152,128,169,47,483,88,456,292,136,407,372,126,488,97,89,309,354,12,417,67,115,90,25,106,48,41},
+{1,448,126,71,229,37,19,159,440,270,422,338,261,82,333,153,143,10,52,97,475,56,354,190,113,105,129,242,176,377,124,85},
+{1,276,282,381,334,100,124,375,236,426,311,450,119,449,56,412,204,317,96,441,138,141,263,167,50,62,129,420,168,281,153,152},
+{1,57,192,325,109,8,456,254,298,23,64,195,270,301,184,383,230,13,277,65,250,462,104,213,375,302,454,208,213,260,500,462},
+{1,100,294,479,41,464,432,262,206,145,485,31,211,138,166,130,3,172,239,484,123,501,341,143,338,435,213,233,94,136,55,369},
+{1,144,306,233,349,75,297,362,82,394,398,65,24,51,470,250,207,502,190,392,174,426,458,262,320,295,202,403,337,269,439,83},
+{1,67,40,31,163,185,341,356,82,184,278,332,77,27,431,25,297,73,279,271,101,4,268,160,124,301,370,341,178,452,23,141},
+{1,343,45,286,142,272,165,150,197,168,241,308,95,349,389,44,73,163,14,43,390,96,62,52,412,174,494,428,386,299,504,339},
+{1,140,445,76,177,80,197,9,39,264,405,498,361,415,65,287,222,96,134,14,58,496,113,348,217,125,63,422,462,4,280,445},
+{1,70,304,300,490,402,186,72,339,272,382,491,468,394,356,185,130,452,419,135,154,26,338,342,78,199,31,6,202,424,221,182},
+{1,399,122,102,109,424,317,364,376,492,50,92,174,285,219,276,459,373,342,443,345,468,36,29,388,447,412,15,466,328,343,26},
+{1,150,51,37,338,261,70,27,147,304,218,483,328,256,325,228,34,381,412,189,319,18,226,155,471,322,387,315,293,493,139,490},
+{1,5,17,85,257,378,237,140,361,178,431,185,392,2,10,34,170,471,289,474,280,263,356,139,370,197,2,5,482,224,432,109},
+{1,454,217,203,495,368,235,212,243,241,164,278,128,135,446,104,448,38,452,140,377,121,375,466,258,347,359,445,273,304,162,280},
+{1,247,23,474,277,120,361,302,27,411,497,394,506,237,379,60,325,151,508,316,265,197,253,391,332,30,344,415,231,388,475,241},
+{1,33,58,168,383,227,34,89,230,135,139,263,63,13,429,258,154,223,76,442,28,117,369,301,366,315,476,399,345,31,11,321},
+{1,118,301,435,231,368,355,367,252,311,386,299,135,511,215,202,441,64,419,113,111,390,243,62,197,176,382,14,322,487,5,215},
+};
+
+static const uint16_t prescr_table_31_607[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,2,1,3,2,1,3,2,1,3,2,1,3},
+{1,6,2,7,4,5,3,1,6,2,7,4,5,3,1,6,2,7,4,7,2,6,1,3,5,4,7,2,6,1,3,5},
+{1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,5,1,7,2,3,4,6,5,1,7,2,3,4},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,13,15,14,7,10,5,11,12,6,3,8,4},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,12,6,3,13,10,5,14,7,15,11,9,8,4},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,29,22,7,25,13,21,5,6,4,27,18,28,11,17,30,20,24,16,19,18,14,25,20,12,4,31,22,17,15,5,3},
+{1,12,2,24,4,25,8,27,16,31,9,23,18,7,13,14,26,28,29,28,26,14,13,7,18,23,9,31,16,27,8,25},
+{1,16,9,3,31,27,5,14,2,15,18,6,17,25,10,28,4,30,11,6,31,26,29,10,14,1,8,30,18,3,24,13},
+{1,25,18,26,14,27,23,9,13,7,22,16,31,29,24,11,8,20,21,6,28,27,16,20,17,3,14,22,8,10,19,26},
+{1,18,11,7,8,10,21,3,13,29,9,24,30,4,5,23,28,27,19,17,3,27,20,21,28,16,10,23,14,8,5,22},
+{1,9,6,11,20,7,2,18,12,22,21,14,4,25,24,17,23,28,8,25,12,11,10,16,15,24,22,20,29,30,13,17},
+{1,12,19,17,9,47,13,31,2,24,38,34,18,29,26,62,4,48,15,34,9,54,50,42,57,16,35,15,34,9,54,50},
+{1,6,20,49,52,42,39,9,54,38,15,34,23,59,8,48,50,62,22,58,7,9,27,45,62,11,29,39,32,41,50,31},
+{1,7,21,60,26,17,32,25,24,31,10,54,44,61,29,4,28,3,9,52,17,16,56,3,47,26,35,8,28,42,60,13},
+{1,54,18,14,51,17,15,5,3,1,54,18,14,51,17,15,5,3,1,27,41,23,43,33,34,15,47,22,48,8,53,36},
+{1,19,34,8,59,55,33,61,60,47,13,5,62,9,40,21,41,6,11,7,12,11,7,12,11,7,12,11,7,12,11,7},
+{1,12,55,54,58,13,59,1,12,55,54,58,13,59,1,12,55,54,58,53,23,21,25,49,15,34,2,12,40,62,45,32},
+{1,49,14,45,57,50,48,63,35,20,11,2,15,28,55,31,9,13,19,35,10,47,27,61,22,2,49,7,16,60,56,55},
+{1,8,51,39,18,5,40,25,46,41,17,29,14,3,24,38,26,54,15,60,22,43,57,2,8,32,21,39,9,36,5,20},
+{1,40,39,30,7,50,31,47,21,1,40,39,30,7,50,31,47,21,1,20,46,36,51,33,2,40,41,61,19,55,4,37},
+{1,94,50,59,26,61,91,18,66,78,79,17,35,24,2,63,100,118,52,61,108,69,105,85,22,30,96,4,63,50,92,71},
+{1,58,30,65,70,105,51,111,38,43,59,36,95,7,47,90,92,73,13,8,97,60,65,35,56,53,61,92,96,33,2,58},
+{1,47,45,115,41,64,18,29,57,3,113,119,26,123,79,54,39,75,5,14,66,38,50,10,28,11,76,100,20,56,22,23},
+{1,122,27,118,103,83,75,34,104,48,67,5,33,119,29,72,61,69,59,117,60,87,8,91,54,118,123,120,63,16,39,108},
+{1,88,9,113,65,42,61,64,114,52,49,51,30,12,115,108,56,66,95,19,93,75,23,112,66,97,71,96,107,69,56,33},
+{1,107,2,113,4,69,8,45,16,90,32,19,64,38,39,76,78,63,59,63,78,76,39,38,64,19,32,90,16,45,8,69},
+{1,90,42,110,74,121,98,8,124,6,33,87,50,65,64,26,48,94,20,99,41,64,13,12,33,126,89,98,4,31,42,55},
+{1,6,20,120,98,62,61,55,11,58,37,103,32,121,100,42,69,85,53,95,88,81,74,103,16,48,80,73,98,31,33,99},
+{1,63,18,12,122,103,80,123,88,66,119,34,37,39,89,125,101,46,95,32,114,47,48,75,103,40,49,11,60,118,81,34},
+{1,101,33,20,78,18,83,21,43,51,71,91,57,96,82,112,10,39,9,68,122,118,107,8,22,66,20,39,100,34,61,59},
+{1,65,110,52,18,112,100,4,89,46,27,72,86,6,16,57,115,108,125,103,6,8,89,23,52,9,28,105,87,70,122,42},
+{1,31,32,127,114,58,60,126,109,26,67,12,87,38,61,97,77,101,49,27,46,11,5,88,40,42,53,37,14,93,112,2},
+{1,26,59,53,108,81,56,27,33,14,89,61,105,35,58,47,87,100,84,37,51,24,109,79,95,90,99,9,101,39,41,111},
+{1,124,109,28,67,85,127,12,78,103,117,101,104,90,80,57,31,34,7,95,11,120,89,106,81,80,110,76,61,96,23,43},
+{1,69,82,44,118,16,123,58,77,24,49,39,28,20,94,67,18,30,113,125,61,36,30,79,73,105,18,15,80,83,67,9},
+{1,63,10,100,68,44,127,43,51,29,28,35,41,77,9,37,90,113,66,87,84,12,115,30,86,51,118,7,38,117,95,89},
+{1,110,78,59,42,5,56,111,32,117,17,47,61,87,79,85,100,62,18,53,6,69,105,85,50,116,68,94,61,80,46,82},
+{1,75,53,110,10,61,56,88,68,104,74,126,91,100,55,5,96,28,44,17,13,27,109,21,102,46,90,105,126,83,25,38},
+{1,251,3,22,5,58,15,78,17,210,51,109,85,183,255,194,26,93,46,254,145,205,42,19,146,198,224,223,72,147,54,166},
+{1,192,222,182,151,114,110,155,27,143,160,177,237,82,75,89,88,152,70,120,208,33,252,7,61,8,39,161,182,197,146,196},
+{1,181,115,69,100,109,247,97,90,99,27,133,145,77,75,136,137,60,79,5,142,37,208,192,239,8,130,230,69,50,196,174},
+{1,79,223,225,128,122,77,65,114,111,87,185,219,240,139,137,23,132,107,35,186,5,47,53,73,40,85,133,18,109,242,156},
+{1,236,72,33,155,128,229,107,91,139,39,129,9,35,122,16,167,100,98,60,114,243,107,177,240,241,135,149,182,139,143,110},
+{1,100,93,33,223,123,253,8,97,150,55,122,153,85,64,73,76,135,145,26,170,64,187,19,55,61,246,253,4,200,93,143},
+{1,165,86,209,240,37,219,235,163,95,104,140,159,5,171,67,66,231,177,48,36,63,124,93,145,8,14,172,209,120,90,199},
+{1,5,17,85,94,121,194,43,135,37,177,203,6,30,102,161,155,73,50,125,107,76,190,124,198,176,103,82,141,172,81,37},
+{1,40,175,129,222,24,101,127,74,8,35,244,231,217,192,141,93,150,64,140,139,231,221,48,101,142,163,1,20,115,213,144},
+{1,198,182,212,73,149,215,102,42,206,189,240,210,23,142,229,181,251,246,70,3,165,196,157,110,162,136,239,153,135,20,226},
+{1,253,148,96,151,14,66,174,146,188,84,39,139,138,119,227,131,20,26,44,137,184,185,115,86,90,134,83,3,55,111,20},
+{1,184,92,46,23,179,225,200,100,50,25,180,90,45,174,87,147,241,192,48,12,3,228,57,82,172,43,238,131,196,49,80},
+{1,58,152,33,72,67,170,30,2,116,71,66,144,134,35,60,4,232,142,66,72,154,145,94,115,203,89,32,57,107,132,144},
+{1,167,220,85,223,199,192,56,218,10,225,66,244,92,172,154,203,126,68,232,165,201,152,127,204,67,148,32,211,129,47,197},
+{1,121,142,15,46,65,85,61,193,13,220,218,75,97,67,167,166,223,81,47,28,87,164,213,241,8,99,155,15,23,178,152},
+{1,101,249,82,205,201,214,36,231,197,247,185,41,163,161,107,18,182,167,95,129,140,174,183,97,115,40,99,22,145,178,92},
+{1,105,249,83,24,246,147,17,205,27,77,21,228,229,140,117,38,62,200,235,212,66,172,88,190,99,250,116,225,148,135,78},
+{1,238,116,151,24,42,61,175,223,206,153,78,19,20,63,236,55,127,169,13,178,129,50,196,235,14,43,166,81,9,241,245},
+{1,70,19,195,166,109,30,235,97,112,63,191,247,6,55,106,111,146,205,34,79,64,18,147,148,125,218,30,164,161,14,113},
+{1,118,55,92,227,103,44,73,137,174,159,94,15,9,148,38,71,246,13,166,234,173,214,191,66,172,237,12,157,89,114,35},
+{1,179,98,110,79,4,31,57,9,141,16,124,228,36,231,64,65,242,144,127,64,248,228,18,141,8,31,196,110,255,1,129},
+{1,184,132,244,90,168,24,210,53,134,57,239,253,172,63,5,159,83,94,153,130,15,14,82,115,179,129,235,109,175,37,13},
+{1,185,127,42,113,187,206,212,37,89,123,139,78,19,201,125,155,143,239,22,137,158,170,91,101,140,146,186,218,90,216,227},
+{1,254,26,168,139,232,24,155,191,119,193,132,143,142,112,106,194,73,161,187,239,190,163,69,226,148,108,172,145,32,87,208},
+{1,250,72,30,38,44,131,42,230,77,162,153,74,61,182,16,207,114,55,231,176,209,42,115,141,138,46,80,197,133,204,190},
+{1,119,132,33,127,134,207,170,196,49,123,135,184,46,229,78,253,72,18,117,53,61,60,233,200,25,214,131,178,97,217,206},
+{1,30,179,19,37,104,226,22,67,62,189,167,108,154,243,15,170,250,225,26,150,206,72,118,219,139,117,202,116,197,33,8},
+{1,68,184,61,44,2,136,131,122,88,4,227,245,244,176,8,53,25,27,176,4,136,184,231,11,133,241,242,148,230,41,171},
+{1,161,53,175,218,76,97,126,67,47,168,87,199,198,103,82,253,39,107,5,29,69,251,255,72,125,208,28,239,139,169,123},
+{1,251,107,33,11,200,23,146,69,252,129,201,236,249,100,247,73,222,126,94,38,140,8,30,214,33,249,50,191,54,176,93},
+{1,18,260,83,400,55,285,497,224,457,275,269,209,184,255,7,126,281,441,123,416,170,508,21,189,339,452,493,140,234,447,77},
+{1,4,16,64,256,34,136,49,196,257,38,152,113,452,291,174,169,181,197,394,261,27,54,108,216,432,369,243,486,477,427,327},
+{1,84,424,294,338,49,497,317,119,415,303,433,171,443,180,462,387,422,105,223,108,93,430,111,35,272,396,341,453,228,155,15},
+{1,276,202,40,487,393,118,171,90,298,224,508,506,431,264,504,412,156,424,297,494,293,443,123,391,378,407,438,164,486,323,47},
+{1,334,212,397,122,124,443,354,14,274,26,450,237,201,198,154,84,27,140,268,81,263,194,240,193,281,158,151,330,215,63,337},
+{1,118,38,311,78,175,208,285,316,329,501,168,402,495,206,163,149,181,182,22,263,173,30,223,225,297,248,343,307,203,400,407},
+{1,396,177,265,338,174,149,119,72,207,7,194,292,362,235,377,472,325,504,47,400,197,243,266,483,458,253,456,369,137,166,310},
+{1,462,315,29,227,93,337,288,204,249,322,112,34,270,422,465,15,125,392,376,219,38,336,119,239,313,229,274,352,191,97,375},
+{1,281,309,20,471,510,272,384,493,355,286,145,372,443,105,88,27,479,82,238,72,141,427,180,112,246,306,216,407,164,476,144},
+{1,407,133,204,210,207,52,320,352,54,49,106,430,405,500,454,330,363,426,148,248,201,252,440,121,478,354,396,217,390,499,481},
+{1,61,411,256,492,370,343,145,382,75,468,32,271,183,255,364,388,494,264,2,61,511,64,271,361,404,287,129,343,378,365,494},
+{1,161,133,443,71,193,153,337,308,356,374,489,279,340,376,412,154,178,187,224,449,143,421,451,46,211,3,453,461,288,42,401},
+{1,31,341,504,97,225,108,122,456,30,330,173,409,128,141,22,434,470,340,452,77,245,240,502,346,409,64,399,153,205,388,450},
+{1,62,442,427,2,124,259,289,4,248,113,53,8,496,226,106,16,407,452,106,8,248,259,427,1,31,341,320,211,77,450,40},
+{1,2,4,8,16,32,64,128,256,125,250,500,405,343,211,422,305,31,62,62,62,62,62,62,62,62,62,62,62,62,62,62},
+{1,395,322,13,483,328,81,492,314,282,423,407,55,31,367,339,155,185,405,211,7,412,240,279,34,150,173,469,110,31,500,245},
+{1,295,92,414,210,102,384,289,305,86,188,31,212,267,72,335,328,258,150,179,214,232,60,499,481,319,97,229,136,256,364,317},
+{1,8,64,153,506,134,258,237,195,435,87,33,264,189,218,379,444,47,376,210,465,239,293,422,307,510,83,332,2,8,32,128},
+{1,426,220,509,118,484,407,148,12,372,214,51,203,159,104,277,80,442,174,170,349,385,46,354,15,453,317,279,386,337,315,330},
+{1,163,199,403,511,249,322,423,58,248,481,352,425,263,280,34,14,317,480,435,265,320,290,109,384,95,469,256,106,358,99,76},
+{1,227,485,331,318,158,172,435,197,11,460,74,406,14,12,458,175,150,69,491,500,61,248,426,473,44,311,74,203,340,342,437},
+{1,231,66,287,210,383,304,258,61,476,136,323,11,456,97,261,63,18,12,229,198,203,262,139,53,453,166,58,239,266,110,243},
+{1,191,218,507,291,422,305,476,22,59,242,460,274,168,94,467,276,407,63,263,169,302,237,229,164,272,235,292,19,316,208,349},
+{1,134,302,118,188,502,419,380,500,175,495,280,471,204,145,480,491,463,241,138,332,199,317,336,178,422,497,127,202,165,449,66},
+{1,54,182,265,41,53,236,211,483,78,179,487,150,186,97,50,110,256,431,288,14,130,385,19,413,279,78,305,421,462,313,381},
+{1,292,47,129,483,375,440,119,54,28,159,495,198,124,278,277,162,211,336,215,59,297,93,311,91,128,270,86,423,450,106,427},
+{1,126,9,379,65,375,188,283,182,226,236,237,147,154,481,416,215,107,368,227,73,57,61,193,200,271,418,367,163,439,169,49},
+{1,237,149,93,228,27,402,168,212,337,325,206,46,376,71,411,38,283,285,197,189,217,73,459,508,356,427,182,115,206,23,94},
+{1,249,114,280,264,413,191,48,447,103,401,400,361,283,3,267,150,41,25,211,176,10,28,221,350,165,462,58,323,388,268,188},
+{1,447,364,482,42,303,476,420,369,328,462,434,445,257,41,253,379,145,271,149,355,175,457,93,163,382,250,432,232,443,219,157},
+{1,242,222,379,433,118,30,226,191,207,488,219,340,258,478,321,332,217,176,95,202,361,26,405,446,393,317,134,146,204,127,171},
+{1,438,296,495,214,8,460,29,27,142,64,259,232,216,337,287,325,382,254,101,289,325,191,432,337,256,281,232,108,284,64,270},
+{1,95,420,290,301,363,478,143,395,78,366,253,509,324,178,204,29,109,165,226,151,499,319,160,482,346,31,504,418,112,100,257},
+{1,441,414,385,216,269,397,338,291,295,417,443,477,396,235,189,166,377,182,40,431,57,487,476,386,145,447,309,509,495,346,399},
+{1,131,481,4,311,498,16,401,446,64,50,142,256,200,259,333,27,321,121,54,321,417,27,317,333,400,259,315,200,284,256,100},
+{1,121,356,164,70,197,161,475,490,476,133,370,176,160,418,142,376,195,439,428,296,9,124,472,276,156,68,447,72,169,173,95},
+{1,442,37,307,448,43,402,54,362,176,404,123,436,132,197,129,265,48,295,55,104,337,125,347,433,164,29,124,390,204,332,1},
+{1,404,471,103,208,58,250,3,487,290,169,368,78,270,5,370,61,507,203,105,361,455,82,478,434,98,209,215,304,417,240,222},
+{1,126,185,479,474,92,352,257,369,93,286,440,174,391,322,216,431,246,287,227,365,11,441,104,511,463,124,402,243,508,398,358},
+{1,146,396,462,403,327,437,73,198,231,380,278,367,401,99,454,190,139,258,267,97,113,348,442,333,222,456,202,449,416,465,141},
+{1,365,384,160,120,34,431,103,241,297,435,110,410,285,420,187,168,126,406,140,388,487,414,143,489,327,418,305,362,282,264,99},
+{1,309,142,180,495,221,318,339,195,6,88,87,203,503,445,98,268,505,20,232,453,306,328,382,50,85,233,230,168,231,395,381},
+{1,52,145,499,406,496,458,67,160,390,463,167,266,327,255,105,278,8,416,315,153,406,248,461,472,10,228,213,336,38,99,111},
+{1,308,301,475,108,227,416,373,358,195,221,173,467,210,149,364,400,372,82,247,387,426,19,272,453,14,134,422,417,482,305,35},
+{1,418,111,214,271,358,237,128,157,332,390,250,313,126,50,142,355,217,339,78,508,175,225,285,434,339,78,508,175,225,285,434},
+{1,156,484,405,283,449,212,511,52,475,489,219,393,207,94,244,499,486,173,185,386,180,293,320,60,236,251,274,175,37,368,57},
+{1,466,173,59,31,301,410,380,341,467,383,150,36,306,183,230,41,134,172,302,502,277,35,435,253,147,234,509,12,51,503,508},
+{1,502,97,226,95,451,439,280,448,20,443,230,245,71,390,100,446,442,272,74,199,76,356,449,241,426,476,417,123,121,399,99},
+{1,300,186,272,468,185,419,26,78,24,465,364,54,259,324,386,368,286,320,350,230,90,97,243,161,57,446,15,220,94,510,73},
+{1,120,105,7,360,287,21,398,203,107,247,442,273,270,123,225,188,353,364,410,379,293,106,418,134,208,127,357,70,164,190,301},
+{1,30,340,490,135,110,163,27,306,441,351,312,373,505,325,20,408,332,250,353,470,241,264,76,73,122,379,320,57,359,500,271},
+{1,169,100,148,403,126,330,68,55,402,215,302,208,420,492,413,362,231,54,375,307,194,332,473,324,168,396,60,175,457,115,312},
+{1,489,231,317,208,33,345,278,430,115,106,503,142,296,375,407,350,226,194,57,378,34,433,277,38,442,498,340,398,397,380,448},
+{1,17,257,389,267,303,168,385,335,270,378,392,470,77,184,145,459,384,350,502,199,108,181,38,291,50,393,274,83,163,157,370},
+{1,325,409,112,124,228,471,126,391,268,158,383,196,217,387,35,296,191,308,80,185,188,137,396,442,172,318,58,346,208,332,321},
+{1,92,356,288,146,241,182,480,468,264,488,207,457,242,82,439,335,190,251,375,505,175,181,130,158,77,391,396,142,342,26,55},
+};
+
+static const uint16_t prescr_table_31_1279[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,5,15,2,6,10,13,4,6,5,14,9,4,6,5,14,9,4,6,5,14,9,4,6,5,14,9,4,6,5,14},
+{1,12,6,3,13,10,5,14,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11,8,2,12,3,10,14,15},
+{1,6,11,4,7,13,15,3,10,1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,15,14,13,8,7},
+{1,31,18,29,9,28,22,14,11,17,30,20,24,16,3,2,31,9,14,23,26,15,10,12,8,19,1,29,22,7,25,13},
+{1,24,8,31,18,14,29,11,30,5,21,10,3,20,6,1,12,2,24,4,25,8,27,16,31,9,23,18,7,13,14,26},
+{1,15,11,24,27,10,23,16,18,6,17,25,10,28,4,30,11,12,13,29,20,23,8,19,22,24,26,21,7,1,16,9},
+{1,5,17,12,11,16,9,26,28,1,25,18,26,14,27,23,9,13,7,22,16,31,29,24,11,8,20,21,12,30,4,10},
+{1,31,23,3,26,2,5,21,6,26,1,18,11,7,8,10,21,3,13,29,9,24,30,4,5,23,28,27,19,25,12,15},
+{1,18,24,31,27,20,14,8,30,26,3,27,10,29,1,9,6,11,20,7,2,18,12,22,21,14,4,25,24,17,23,28},
+{1,1,1,1,1,1,1,1,1,33,49,57,61,63,62,31,46,23,42,21,43,52,26,13,39,50,25,45,55,58,29,47},
+{1,1,1,1,1,1,1,1,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,45,59,48,24,12,6,3,44,22,11,40,20,10,5,47,58,29,35,60,30,15,42,21},
+{1,1,1,1,1,1,1,1,1,48,24,12,6,3,49,40,20,10,5,50,25,60,30,15,55,43,37,34,17,56,28,14},
+{1,1,1,1,1,1,1,1,1,51,42,21,57,47,36,18,9,55,40,20,10,5,49,43,38,19,58,29,61,45,37,33},
+{1,1,1,1,1,1,1,1,1,54,27,59,43,35,39,37,36,18,9,50,25,58,29,56,28,14,7,53,44,22,11,51},
+{1,1,1,1,1,1,1,1,1,57,37,43,44,22,11,60,30,15,62,31,54,27,52,26,13,63,38,19,48,24,12,6},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,90,34,77,28,12,49,29,86,72,20,104,41,126,27,70,23,31,113,53,120,118,117,2,90,17,114,66,32,61,22,50},
+{1,70,38,95,92,31,117,29,112,108,119,12,15,106,52,57,21,50,122,32,40,34,110,49,31,126,37,14,73,121,69,118},
+{1,88,47,55,45,8,115,102,41,59,16,115,51,110,45,4,63,47,92,111,1,44,40,23,56,100,11,10,38,14,25,33},
+{1,4,16,64,34,25,100,35,29,58,116,121,99,87,63,126,109,75,7,14,28,56,112,113,115,119,127,111,79,15,30,60},
+{1,87,92,105,25,57,71,99,123,68,77,78,124,69,40,89,44,106,112,16,81,74,79,25,82,120,118,116,35,13,48,110},
+{1,70,37,60,103,79,104,127,82,97,25,126,10,16,11,51,120,103,116,26,27,56,75,31,19,110,1,35,115,84,12,125},
+{1,6,20,120,70,105,32,107,44,116,55,89,64,107,22,58,78,121,32,96,11,29,39,105,16,48,80,91,70,97,8,24},
+{1,78,88,109,62,21,94,2,37,88,106,83,73,96,87,108,56,61,63,113,93,104,29,101,85,34,20,8,74,9,109,31},
+{1,92,117,69,13,78,74,68,81,66,44,49,10,82,48,36,63,95,23,105,104,70,43,68,119,33,22,71,5,41,24,18},
+{1,120,51,87,9,125,41,105,65,40,104,124,72,118,82,105,64,20,52,62,36,59,41,84,32,10,26,31,18,125,116,42},
+{1,3,5,15,17,51,85,52,92,114,75,11,107,59,67,7,97,52,46,57,64,96,80,120,68,102,85,26,23,121,32,48},
+{1,72,46,45,38,84,35,73,102,104,54,83,87,20,58,69,37,70,73,51,52,27,64,66,10,29,75,123,35,77,112,26},
+{1,59,108,56,33,89,105,58,87,42,51,15,3,76,45,9,78,22,63,64,98,104,106,81,103,105,29,74,96,83,92,95},
+{1,69,90,52,32,18,102,98,89,15,65,66,87,30,103,97,75,60,43,39,115,120,86,78,3,21,73,121,6,42,119,23},
+{1,44,123,24,28,67,113,17,97,46,102,76,114,69,59,121,32,77,100,96,56,67,79,72,42,62,55,126,66,89,109,41},
+{1,17,18,33,23,116,77,32,6,51,27,92,25,77,16,121,72,66,23,58,47,4,34,18,104,65,118,79,1,112,124,26},
+{1,29,72,16,62,19,25,60,41,63,7,82,126,14,83,11,28,81,22,56,85,44,112,93,88,23,77,71,46,109,121,92},
+{1,33,29,73,86,93,49,3,99,109,119,32,30,21,35,81,93,102,65,82,18,46,4,66,29,90,107,20,77,105,53,61},
+{1,83,181,195,252,57,52,158,22,91,128,7,81,132,161,228,104,158,11,160,64,142,165,66,221,114,52,79,136,80,32,71},
+{1,192,222,182,151,114,110,155,27,201,40,187,31,84,246,224,243,29,148,153,67,133,183,165,43,27,201,40,187,31,84,246},
+{1,177,99,188,79,29,50,107,179,21,139,150,143,223,236,129,181,237,76,231,111,133,252,142,18,190,3,124,246,173,112,45},
+{1,75,207,238,173,96,24,6,151,124,153,160,20,148,132,134,205,60,145,161,167,122,68,158,206,196,142,204,143,127,97,191},
+{1,41,165,207,210,204,169,26,193,182,43,231,47,181,138,78,34,203,59,150,201,18,88,40,70,134,184,244,255,250,32,226},
+{1,90,202,240,79,164,200,68,228,162,138,190,199,182,144,29,96,165,73,188,157,211,172,51,186,115,124,232,65,235,54,35},
+{1,71,188,160,90,1,71,188,160,45,83,114,254,5,11,147,68,156,89,100,149,141,126,33,140,251,14,152,215,216,197,61},
+{1,144,209,37,92,32,50,84,131,188,95,200,168,131,188,95,200,168,131,188,95,200,168,131,188,95,200,168,131,188,95,200},
+{1,46,187,88,173,154,58,37,218,81,72,244,189,94,149,192,212,155,10,150,249,78,134,234,100,54,71,41,137,55,80,95},
+{1,160,56,67,212,244,110,48,215,138,187,50,121,89,20,177,216,21,225,214,218,181,253,45,114,227,118,198,78,85,123,249},
+{1,34,201,206,32,141,53,213,205,35,193,239,243,70,235,183,143,140,191,7,119,113,23,14,238,226,46,28,181,173,92,56},
+{1,47,224,252,91,34,122,41,2,47,112,63,121,44,240,119,225,209,202,255,21,248,203,80,45,95,79,70,85,220,135,150},
+{1,113,159,116,93,121,142,39,100,132,106,164,72,247,239,77,150,10,194,189,105,86,198,95,246,108,55,35,208,221,15,163},
+{1,93,128,155,94,103,96,136,133,217,10,82,59,227,122,8,15,123,155,47,71,12,181,251,107,133,217,10,82,59,227,122},
+{1,80,90,243,30,124,176,166,211,29,70,212,197,228,222,82,125,112,63,4,160,90,186,196,204,11,191,76,67,92,74,179},
+{1,151,113,233,98,201,70,44,236,26,95,80,45,248,182,97,184,146,214,87,145,207,17,135,244,210,242,224,126,204,8,193},
+{1,213,235,76,145,230,75,45,224,17,48,41,87,37,62,149,84,92,18,73,5,139,116,233,243,244,170,109,151,129,239,1},
+{1,229,49,254,67,148,235,5,79,181,14,26,132,113,109,89,206,44,246,68,71,31,108,228,106,84,140,219,15,167,32,9},
+{1,174,33,163,104,173,112,192,46,219,9,10,243,131,227,57,103,220,15,91,19,67,244,133,178,217,167,203,179,142,22,235},
+{1,42,27,220,236,1,42,27,220,118,106,111,46,141,44,167,245,144,60,94,153,129,208,138,71,221,99,210,160,158,234,170},
+{1,131,196,87,141,163,248,165,144,119,128,120,242,214,127,95,65,165,72,227,64,60,121,107,231,247,248,138,36,169,32,30},
+{1,151,226,197,177,1,151,226,197,134,111,74,231,186,71,122,199,17,30,20,24,16,139,242,55,177,222,148,115,201,142,244},
+{1,149,165,105,236,13,166,21,192,91,133,145,90,46,41,254,80,170,19,28,218,253,110,161,60,158,156,9,186,49,205,8},
+{1,111,46,77,246,188,136,254,90,252,66,105,166,190,43,207,24,149,228,215,141,113,51,90,252,66,105,166,190,43,207,24},
+{1,199,60,5,117,204,17,118,82,193,128,189,220,80,6,158,34,118,41,139,64,181,110,40,3,79,17,59,255,174,32,177},
+{1,91,26,170,153,76,229,145,243,244,218,37,214,34,248,221,11,41,209,12,7,46,255,243,244,218,37,214,34,248,221,11},
+{1,170,131,150,144,162,102,220,114,56,73,142,44,31,40,172,171,231,143,121,70,67,165,127,95,114,56,73,142,44,31,40},
+{1,98,134,71,161,164,189,54,158,87,95,36,219,156,53,28,73,116,19,165,150,44,160,99,114,181,96,33,46,194,32,31},
+{1,124,99,252,195,116,105,14,247,220,143,239,211,48,30,139,23,176,78,169,127,137,107,123,113,8,5,198,252,155,29,201},
+{1,48,239,186,130,20,50,143,157,251,68,125,46,98,223,214,14,144,67,53,243,132,90,148,35,218,174,88,164,168,8,192},
+{1,110,74,56,92,441,326,170,328,351,169,253,152,348,240,459,145,211,375,500,58,64,458,166,448,368,369,326,85,82,215,427},
+{1,148,289,69,231,434,153,374,142,463,504,392,23,372,211,119,105,278,346,42,465,135,452,359,143,389,308,202,254,80,155,47},
+{1,389,301,401,436,372,61,46,2,389,413,490,317,409,247,16,90,154,309,436,186,385,128,199,254,500,466,510,122,46,1,457},
+{1,466,381,177,101,333,76,273,255,360,210,249,261,28,11,94,134,200,159,405,104,408,91,464,97,20,366,191,55,503,327,145},
+{1,314,142,417,54,356,425,354,342,291,292,214,300,124,48,477,43,388,90,470,294,492,363,156,430,323,191,128,5,200,445,432},
+{1,112,50,340,350,19,487,347,419,408,202,245,327,330,82,286,476,233,458,468,297,430,128,390,55,114,105,76,483,347,455,204},
+{1,237,410,35,421,373,99,129,150,302,130,457,293,135,380,448,461,255,285,116,60,297,218,481,235,506,467,370,368,413,336,468},
+{1,375,160,381,218,427,228,18,283,310,249,167,471,459,251,464,391,35,343,494,126,206,394,82,159,508,470,85,211,292,337,60},
+{1,302,146,365,281,459,6,15,309,494,185,1,151,264,330,52,57,161,31,418,230,499,53,174,425,341,406,223,338,42,268,335},
+{1,92,503,122,156,98,349,13,403,344,447,494,476,65,141,160,56,177,169,358,490,356,438,176,135,396,93,506,475,139,68,27},
+{1,148,238,485,45,355,319,129,155,436,172,252,318,312,132,29,317,486,506,141,98,488,115,456,167,23,412,77,255,480,70,20},
+{1,343,364,12,251,463,80,230,224,480,298,144,272,447,216,408,84,180,340,126,238,510,65,153,257,341,481,181,203,37,475,410},
+{1,355,427,91,126,268,82,470,157,95,150,488,188,79,93,501,10,49,219,214,171,200,248,421,386,88,218,336,90,441,178,215},
+{1,230,144,465,165,448,358,396,346,105,132,438,296,62,73,417,472,245,372,393,274,443,376,426,162,441,414,482,368,69,386,104},
+{1,125,62,287,430,358,100,129,332,236,300,360,321,226,95,309,9,244,333,492,29,411,395,30,230,165,267,440,417,192,373,218},
+{1,415,82,144,50,350,214,266,10,106,141,180,509,337,52,137,269,431,281,379,3,19,382,54,278,292,395,253,318,140,312,170},
+{1,350,437,125,239,410,505,129,330,285,100,356,368,509,291,173,406,461,207,389,152,252,408,232,277,54,155,269,192,15,394,274},
+{1,55,39,462,295,498,225,365,43,85,458,433,279,168,314,164,392,205,161,177,265,405,144,439,334,464,226,154,348,95,289,160},
+{1,280,486,474,210,234,196,129,34,198,9,426,71,24,457,274,205,187,286,376,50,41,116,189,149,109,504,175,354,227,456,414},
+{1,133,409,468,262,68,309,360,475,173,334,81,176,135,283,491,430,374,483,287,225,55,412,240,69,216,149,252,510,214,427,364},
+{1,181,215,139,427,472,221,279,332,228,432,473,52,112,109,135,147,271,43,47,325,402,128,65,122,163,21,145,442,279,166,114},
+{1,336,435,381,481,389,140,220,51,284,203,241,363,176,179,331,8,46,465,381,427,407,330,160,239,94,69,463,72,350,235,73},
+{1,49,123,226,173,193,281,162,478,464,327,169,348,146,202,97,268,253,337,370,424,65,161,408,100,40,361,403,471,82,94,248},
+{1,39,395,507,9,287,446,129,65,10,187,123,310,392,201,165,438,443,29,158,510,89,430,31,185,92,148,325,34,152,407,112},
+{1,211,97,434,88,338,148,311,187,285,380,421,435,301,400,504,445,453,107,407,396,40,154,283,9,156,110,304,321,115,481,202},
+{1,267,460,429,469,76,471,129,148,128,418,51,9,114,304,373,129,74,64,209,372,361,57,152,471,301,37,32,261,186,473,369},
+{1,182,215,300,395,350,286,315,200,352,406,495,31,502,51,3,237,227,276,380,141,319,264,103,93,40,153,9,118,92,115,363},
+{1,484,11,483,69,466,30,9,210,341,133,366,171,437,407,230,455,250,347,203,10,383,367,89,117,330,271,486,157,195,145,361},
+{1,215,293,302,237,172,168,245,354,492,27,475,327,221,408,402,280,321,420,431,206,30,414,235,303,29,162,368,385,158,333,87},
+{1,170,211,377,326,56,315,41,347,195,336,391,486,237,479,428,104,229,100,10,273,70,106,79,388,281,509,460,310,295,279,440},
+{1,508,301,458,201,260,262,491,164,408,290,208,263,385,167,154,176,468,388,180,313,169,81,462,259,364,394,127,71,126,185,240},
+{1,492,457,423,249,461,41,483,367,105,370,469,22,296,440,419,308,242,509,414,142,189,418,450,456,426,76,325,13,447,126,172},
+{1,12,80,227,497,421,374,455,205,397,75,442,249,309,248,307,236,331,508,365,296,182,151,81,486,305,224,355,268,110,356,286},
+{1,343,250,213,116,187,370,474,92,502,386,71,387,372,37,144,238,115,62,229,24,17,301,383,78,191,294,276,97,375,65,331},
+{1,27,325,290,398,13,175,430,86,174,327,138,193,381,405,164,304,4,54,325,145,510,168,362,240,389,124,361,379,440,222,116},
+{1,92,174,143,229,430,319,416,350,211,385,154,233,287,203,344,55,376,44,467,345,25,247,290,159,127,62,38,255,82,451,240},
+{1,494,239,410,424,431,500,54,289,84,77,159,346,508,317,226,399,435,76,104,434,187,128,245,262,151,124,34,167,54,311,42},
+{1,252,90,51,70,57,232,262,278,477,43,478,169,72,30,249,427,315,263,245,248,469,128,362,154,107,363,228,464,262,139,323},
+{1,232,149,5,41,416,17,141,482,410,118,21,38,349,100,383,233,398,36,437,414,422,128,404,399,80,328,66,34,141,241,205},
+{1,210,430,469,42,250,240,274,505,286,206,278,237,289,312,308,179,298,416,10,241,224,207,383,307,428,397,360,106,357,388,290},
+{1,363,404,96,360,324,433,456,401,136,427,418,186,154,246,482,98,479,155,501,391,110,127,330,421,361,417,210,53,226,111,380},
+{1,504,470,325,23,496,169,330,277,164,476,485,237,79,232,48,242,433,376,57,264,162,167,216,194,323,201,321,305,426,5,127},
+{1,260,307,287,423,101,118,191,32,186,485,509,49,101,59,240,4,375,307,304,182,259,471,30,447,65,502,38,201,496,85,220},
+{1,302,105,13,375,256,81,263,145,12,494,187,457,7,96,356,343,92,56,133,443,35,357,448,167,73,280,435,20,439,461,478},
+{1,8,64,399,459,100,175,489,372,321,405,330,441,506,246,87,348,481,154,487,130,391,258,153,491,178,327,397,298,57,228,31},
+{1,464,232,116,58,29,478,239,423,337,188,47,307,372,93,255,263,377,182,509,151,285,175,275,380,95,303,371,356,89,254,495},
+{1,69,216,60,280,92,399,431,177,355,139,288,40,411,26,204,265,75,439,267,14,475,260,45,233,244,271,132,259,282,107,312},
+{1,120,286,95,402,292,448,343,47,422,233,187,350,23,205,185,294,152,488,101,474,150,128,113,339,315,461,91,57,343,459,211},
+{1,511,66,151,288,296,460,27,234,188,457,203,104,493,314,509,478,245,240,469,100,422,508,194,262,154,455,383,143,6,454,99},
+{1,378,463,108,270,290,377,394,502,221,140,479,151,268,491,75,317,181,308,445,480,57,235,298,236,466,160,23,89,230,285,503},
+{1,177,113,488,10,189,167,105,68,388,251,128,460,276,232,80,313,334,105,34,194,411,64,230,138,116,40,378,167,466,17,97},
+{1,177,292,258,263,167,364,25,381,419,12,115,185,387,55,429,206,88,144,283,61,13,449,240,342,394,148,121,281,140,159,107},
+{1,290,12,293,80,257,25,177,172,127,500,129,453,387,406,348,355,61,124,71,132,201,396,347,333,52,14,92,18,228,54,300},
+{1,153,242,333,6,181,463,104,20,479,217,46,502,313,81,263,330,21,98,276,131,394,236,406,180,171,471,350,458,187,314,373},
+{1,352,435,385,3,73,316,362,5,409,209,377,185,105,416,123,95,72,46,204,452,505,122,239,298,99,379,473,324,314,252,101},
+{1,123,380,112,466,14,313,255,347,307,21,277,222,214,314,57,73,160,350,5,310,291,54,232,62,260,317,372,468,138,143,441},
+};
+
+static const uint16_t prescr_table_31_2203[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,6,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6},
+{1,6,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5},
+{1,3,5,14,9,4,6,5,14,9,4,6,5,14,9,4,6,5,14,9,4,6,5,14,9,4,6,5,14,9,4,6},
+{1,12,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1},
+{1,6,11,2,6,10,1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,15,14,13,8,7,9,4,12},
+{1,20,29,12,23,2,20,28,6,25,1,10,14,3,30,18,5,7,19,15,9,16,17,27,21,22,8,26,31,24,11,4},
+{1,26,12,14,20,18,21,31,22,8,19,24,28,1,13,3,23,5,16,15,25,17,2,26,6,7,10,9,30,27,11,4},
+{1,4,16,15,30,19,9,18,11,22,3,6,12,24,31,17,13,26,27,25,29,21,5,10,20,7,14,28,23,1,2,4},
+{1,8,25,10,31,18,17,29,26,6,24,14,15,11,27,2,8,23,5,20,9,19,21,13,3,12,7,28,30,22,1,4},
+{1,28,18,16,12,5,13,11,20,15,23,29,7,17,2,28,9,8,6,31,27,24,10,26,22,19,30,21,1,14,25,4},
+{1,23,9,14,31,1,21,13,29,22,15,10,12,8,27,18,28,3,2,23,26,7,17,30,20,24,16,11,25,5,6,4},
+{1,14,23,38,55,3,9,63,59,39,48,22,33,34,43,20,47,8,56,46,15,45,6,18,61,53,13,35,44,1,7,21},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,31,9,15,46,8,43,18,30,11,16,1,36,60,22,32,2,31,47,44,23,4,62,9,15,46,8,43,18,30,11,16},
+{1,23,34,11,54,43,42,12,41,61,29,1,38,37,20,32,28,39,3,49,52,60,59,36,50,5,8,7,31,22,55,13},
+{1,11,36,5,35,45,28,3,62,27,43,1,53,9,25,32,19,7,40,63,46,34,24,21,26,30,8,44,41,10,39,59},
+{1,54,59,40,41,50,37,47,15,48,19,1,27,23,10,32,63,35,18,26,12,29,42,31,28,49,8,22,17,55,53,3},
+{1,21,18,10,44,45,17,35,23,28,12,19,54,30,25,26,51,8,57,36,20,53,55,34,43,46,56,24,38,1,60,50},
+{1,41,15,20,48,51,55,22,25,13,61,14,57,47,54,59,6,8,49,30,40,19,21,29,44,50,26,9,28,1,45,31},
+{1,53,61,26,2,53,36,13,1,32,18,60,58,16,9,30,29,8,62,15,52,4,31,61,26,2,53,36,13,1,32,18},
+{1,10,68,82,28,108,89,59,84,2,10,34,41,14,54,109,92,42,1,5,17,85,7,27,119,46,21,65,67,73,107,66},
+{1,26,86,1,13,81,34,33,54,76,42,73,19,78,48,98,87,12,92,115,3,23,122,102,99,90,93,126,82,53,91,80},
+{1,97,8,21,16,42,32,84,64,39,15,78,30,19,60,38,120,76,127,23,113,46,109,92,85,55,37,110,74,83,27,41},
+{1,126,11,10,53,91,17,56,66,98,108,52,100,127,114,107,24,76,58,60,47,105,102,1,63,110,74,41,122,32,14,88},
+{1,65,114,15,14,96,50,88,21,13,79,89,123,95,37,20,99,29,51,54,71,103,2,65,57,73,7,48,25,44,68,72},
+{1,103,82,80,55,30,54,126,113,106,85,62,11,114,109,59,2,103,41,40,72,15,27,63,107,53,121,31,86,57,101,78},
+{1,106,114,109,25,97,51,92,47,119,39,34,104,83,90,58,60,41,98,108,44,40,87,37,72,81,48,3,95,112,7,32},
+{1,60,33,72,92,15,19,9,87,100,59,22,111,80,62,112,104,10,117,14,13,47,69,115,74,96,67,55,39,12,49,99},
+{1,108,50,52,63,20,58,69,91,124,68,109,47,73,77,42,24,44,19,7,61,120,35,95,27,118,89,16,93,119,111,67},
+{1,23,86,38,10,75,70,95,17,18,110,48,74,45,42,120,112,44,65,13,25,78,3,124,94,122,103,7,82,8,92,109},
+{1,5,17,79,23,64,107,77,18,45,41,35,50,125,106,42,65,12,30,51,26,57,11,118,28,54,119,123,101,86,76,117},
+{1,87,14,3,21,109,92,59,25,57,78,62,38,93,121,115,13,22,120,49,103,34,32,119,112,24,123,36,10,126,27,110},
+{1,48,41,89,90,114,51,86,7,72,104,60,11,61,19,2,48,126,70,45,57,115,43,105,36,52,30,111,116,99,1,24},
+{1,95,49,125,86,100,27,18,28,75,114,92,104,19,65,126,84,59,113,94,55,121,13,85,102,68,120,80,96,64,35,97},
+{1,98,108,41,14,31,109,24,21,89,25,36,66,95,80,126,8,86,55,82,28,62,53,48,42,93,50,72,107,81,79,19},
+{1,12,80,2,12,40,1,6,20,120,3,10,60,121,5,30,68,122,15,34,61,127,17,102,71,112,51,91,56,97,85,28},
+{1,56,61,9,11,51,86,41,87,53,30,113,33,64,79,12,103,71,27,29,85,13,123,14,95,34,100,99,55,38,20,94},
+{1,30,83,40,98,48,23,32,26,107,71,25,122,69,7,45,81,54,53,36,38,56,111,123,74,82,39,55,58,113,44,94},
+{1,247,83,49,230,171,144,112,217,190,106,38,235,89,55,228,92,52,229,170,102,34,30,10,6,2,247,164,149,115,216,72},
+{1,64,205,152,234,12,157,74,181,35,20,186,222,194,101,60,211,127,91,175,68,104,129,237,236,204,184,158,42,41,73,213},
+{1,98,78,154,185,48,183,53,66,253,107,181,87,101,176,162,173,153,234,145,73,13,86,84,54,17,92,149,141,67,204,237},
+{1,130,118,160,220,172,167,54,106,127,179,187,233,5,104,253,136,235,135,83,173,230,189,66,72,152,79,114,137,170,12,123},
+{1,20,41,35,103,189,118,23,150,65,248,166,152,45,11,78,158,17,170,224,86,110,231,96,139,147,99,149,95,52,241,252},
+{1,95,219,128,204,87,177,201,89,19,105,166,30,36,141,129,124,46,145,250,3,239,139,96,85,238,59,25,117,221,97,229},
+{1,89,165,150,179,47,236,48,246,18,11,250,137,169,13,17,216,116,65,143,66,92,204,148,234,219,167,207,71,100,19,129},
+{1,10,68,11,39,187,233,172,162,148,122,205,24,120,199,58,210,123,200,9,45,153,67,16,80,79,44,156,82,69,14,54},
+{1,74,93,242,82,66,212,195,174,133,238,27,178,204,30,3,111,97,244,140,128,95,184,205,59,253,226,196,85,185,232,197},
+{1,57,213,243,135,25,231,88,55,119,9,74,163,84,161,109,121,166,136,24,73,52,224,189,86,152,181,178,87,54,217,101},
+{1,182,94,253,152,190,37,118,223,6,179,113,55,212,225,131,77,4,5,94,253,152,190,37,118,223,6,179,113,55,212,225},
+{1,103,150,158,115,46,99,133,217,31,100,167,153,81,110,45,143,83,9,102,192,210,30,239,58,6,169,221,209,242,57,234},
+{1,164,196,132,237,39,70,242,108,167,148,17,174,184,223,240,200,197,214,220,6,155,166,198,32,143,101,139,90,79,222,162},
+{1,129,95,226,33,184,71,143,152,2,129,146,113,173,92,158,250,76,1,253,73,133,235,46,79,125,38,189,195,153,255,200},
+{1,24,199,54,239,81,194,10,120,169,119,237,73,98,17,204,66,22,232,117,245,233,121,165,39,35,19,212,226,13,92,158},
+{1,223,104,15,42,150,178,164,154,237,28,139,147,45,214,244,8,106,208,30,84,167,239,195,191,81,56,157,173,90,39,99},
+{1,19,136,47,11,144,251,33,114,193,91,255,7,250,238,80,111,252,219,156,145,52,3,220,102,127,100,108,32,189,227,245},
+{1,180,229,179,164,95,60,63,209,253,32,91,203,218,98,89,127,103,244,11,159,121,36,172,46,105,198,6,67,88,37,246},
+{1,64,7,224,188,168,205,214,240,89,180,11,195,181,43,170,141,4,128,7,224,188,168,205,214,240,89,180,11,195,181,43},
+{1,200,147,101,254,233,152,187,118,182,89,48,133,112,71,87,179,4,57,147,101,254,233,152,187,118,182,89,48,133,112,71},
+{1,175,131,20,49,92,68,245,157,229,67,58,19,254,210,95,100,248,146,69,122,9,224,35,45,2,175,153,10,192,46,34},
+{1,254,92,89,103,44,12,195,228,235,169,116,20,248,145,128,70,156,60,181,14,61,202,25,68,98,18,71,227,43,204,166},
+{1,64,109,62,204,249,150,232,243,21,229,144,40,73,52,79,244,245,213,95,177,130,45,233,211,159,11,163,135,141,14,3},
+{1,114,176,98,86,160,108,199,231,251,22,152,121,20,234,33,37,193,113,19,69,229,137,78,169,82,68,220,165,177,91,122},
+{1,20,199,234,15,102,82,77,139,107,32,151,179,12,120,158,233,17,170,246,215,74,189,96,110,2,20,136,117,236,51,41},
+{1,151,167,39,45,129,175,28,190,207,245,195,61,247,84,128,10,172,46,179,162,113,58,54,254,202,163,212,138,166,130,157},
+{1,142,193,56,119,220,183,163,122,113,169,229,135,197,195,182,228,192,127,205,210,211,148,46,32,68,115,39,118,155,13,173},
+{1,239,98,177,216,82,158,85,210,231,107,101,253,106,235,28,195,221,241,29,77,60,88,43,160,226,200,230,229,132,84,92},
+{1,239,153,220,213,14,146,232,255,26,21,10,185,113,35,207,27,152,81,142,57,218,17,33,32,173,246,193,137,112,174,148},
+{1,80,161,137,223,131,54,148,101,64,39,55,188,51,28,146,149,77,22,123,130,30,194,57,245,133,198,153,84,12,25,26},
+{1,272,128,102,24,202,259,340,80,191,15,509,480,385,34,8,70,256,204,48,404,5,171,160,382,30,505,451,257,68,16,140},
+{1,109,251,294,383,330,308,107,450,285,2,109,373,147,439,165,154,317,225,390,1,318,434,321,467,346,77,406,376,195,264,159},
+{1,465,133,263,306,83,380,233,438,183,481,126,397,207,8,381,266,25,115,166,239,466,379,366,469,252,269,414,16,237,3,50},
+{1,460,41,441,155,286,376,497,258,455,302,283,29,89,350,508,378,61,27,22,110,404,161,428,479,18,493,445,280,311,193,362},
+{1,212,122,461,275,139,436,96,171,50,401,36,46,395,322,271,145,210,321,433,418,479,260,350,277,503,499,91,33,492,255,116},
+{1,316,149,422,423,313,407,232,284,473,33,27,92,161,34,441,430,269,19,246,395,323,218,497,14,451,227,20,257,236,329,332},
+{1,456,313,448,240,161,459,169,190,232,269,264,79,173,285,465,205,504,238,358,436,367,37,245,486,297,281,114,500,56,30,455},
+{1,34,146,158,82,484,70,176,215,29,461,180,147,143,339,230,375,201,483,49,362,260,343,162,485,87,433,469,300,436,384,191},
+{1,242,314,381,332,225,365,55,187,43,437,358,301,361,467,385,342,249,391,64,350,360,426,227,415,170,297,141,233,252,26,24},
+{1,31,341,68,385,28,186,74,476,57,84,377,502,426,175,428,142,380,232,274,250,501,149,199,415,185,373,436,10,99,368,170},
+{1,143,427,332,315,164,288,437,54,71,73,385,254,489,366,208,325,23,86,398,67,343,42,434,210,458,496,240,33,17,455,450},
+{1,239,496,251,229,450,56,505,109,272,420,337,336,19,111,511,348,24,22,242,115,55,94,144,196,366,219,266,349,347,106,354},
+{1,159,471,344,162,483,12,301,22,391,486,74,20,280,58,230,69,222,60,327,78,298,207,354,68,422,210,273,337,457,204,133},
+{1,35,235,80,406,46,174,434,47,388,277,59,218,37,299,397,179,330,110,32,71,449,247,386,368,414,162,376,274,372,472,73},
+{1,226,440,406,22,177,259,386,69,366,74,460,77,155,327,157,97,505,316,484,235,344,424,1,113,110,347,315,179,481,350,142},
+{1,42,330,500,201,111,170,57,458,360,505,32,39,76,178,449,511,94,456,322,348,218,256,312,231,158,282,234,119,338,12,252},
+{1,383,158,229,471,479,265,53,511,196,495,360,258,105,481,170,239,126,172,507,175,369,397,213,438,232,159,272,186,323,147,429},
+{1,68,490,341,410,227,403,465,488,273,367,261,350,236,109,181,411,193,165,290,194,195,225,471,292,14,476,82,128,250,24,425},
+{1,6,20,60,68,204,340,351,322,357,268,439,122,142,402,21,63,65,195,325,364,279,410,13,23,57,75,221,359,266,445,100},
+{1,26,324,426,198,164,251,389,301,394,358,16,208,90,327,445,53,329,507,510,455,210,64,485,360,86,283,212,110,3,23,243},
+{1,191,147,383,411,496,367,317,275,461,160,290,303,266,48,490,293,486,8,83,294,81,409,335,113,213,137,309,320,235,241,187},
+{1,49,111,394,397,157,296,350,219,130,372,393,255,327,212,342,31,92,215,36,453,416,223,224,283,3,370,474,508,8,196,222},
+{1,37,363,101,49,137,209,183,495,294,45,383,263,396,376,36,167,199,496,441,443,414,117,281,95,325,115,374,223,76,260,229},
+{1,132,298,29,43,426,384,104,197,382,258,369,19,376,142,206,359,33,497,398,315,481,48,13,405,156,500,196,316,47,162,170},
+{1,499,366,356,40,146,57,125,272,22,442,451,484,156,66,425,223,122,69,252,53,501,115,363,450,117,431,27,419,403,192,238},
+{1,303,106,92,167,219,482,178,363,343,393,276,187,411,244,294,197,397,401,209,455,83,509,295,319,250,390,78,327,326,188,459},
+{1,271,241,369,160,347,62,300,439,214,303,325,341,12,317,275,358,480,280,66,385,44,378,388,314,266,20,434,448,351,213,477},
+{1,339,281,31,283,332,235,63,282,153,19,506,158,202,491,55,420,82,45,309,255,284,405,250,150,116,288,9,363,51,507,331},
+{1,24,320,5,60,272,196,51,340,245,383,257,8,96,385,10,120,289,392,102,425,490,511,259,16,192,3,20,240,323,17,204},
+{1,504,152,148,433,25,421,101,78,434,285,463,10,62,380,354,288,439,258,369,187,174,46,483,17,99,341,358,451,303,406,192},
+{1,251,159,288,339,190,38,508,157,475,150,46,261,419,142,293,338,329,334,436,390,126,277,81,487,154,289,164,470,110,231,312},
+{1,335,71,270,108,256,191,101,53,231,170,246,440,316,365,151,12,412,201,13,180,31,449,175,95,297,510,282,471,91,168,441},
+{1,352,299,351,175,414,142,409,189,308,67,190,228,453,287,449,252,234,419,69,61,203,420,118,144,53,46,209,491,462,42,306},
+{1,509,401,67,239,352,414,389,149,344,47,508,54,273,171,479,151,165,383,69,473,417,100,133,325,9,240,187,450,177,425,498},
+{1,436,95,170,75,437,360,140,15,411,394,28,441,413,109,497,326,110,159,45,396,507,84,354,414,259,154,164,266,230,195,489},
+{1,275,374,427,500,201,343,72,11,425,231,114,38,178,459,166,195,467,342,357,498,181,154,146,261,160,191,30,396,107,251,237},
+{1,55,196,236,15,313,287,377,353,5,466,245,215,223,3,395,83,77,368,1,444,49,59,208,314,148,298,300,373,467,329,230},
+{1,329,97,392,406,77,247,358,162,202,130,181,209,409,269,170,3,64,254,166,259,227,317,327,468,506,460,161,138,124,19,466},
+{1,492,454,22,208,255,69,153,429,195,96,189,383,464,198,47,186,220,308,366,163,221,450,175,278,233,149,102,488,90,461,126},
+{1,11,69,198,214,142,410,489,474,137,55,325,251,436,360,449,326,320,349,143,42,151,94,265,417,150,494,119,37,278,120,420},
+{1,137,89,98,316,24,182,470,332,82,80,217,323,370,492,480,443,336,502,479,503,45,314,387,373,389,238,70,189,484,169,265},
+{1,455,278,404,510,418,333,283,457,75,8,506,351,91,143,55,489,325,225,150,16,135,461,182,286,110,161,505,450,300,32,270},
+{1,46,469,252,200,123,47,322,363,91,432,361,117,229,279,17,359,191,176,109,301,104,358,168,421,82,287,169,434,327,288,155},
+{1,277,419,215,439,206,402,192,499,179,291,246,22,268,310,423,376,20,25,37,14,97,115,208,69,309,506,288,171,78,435,353},
+{1,138,118,86,468,491,212,72,300,146,349,287,286,347,129,339,294,447,394,408,467,48,323,487,103,210,470,353,239,99,454,416},
+{1,87,312,107,484,265,282,431,382,21,76,373,229,335,356,7,258,490,172,367,247,1,507,78,290,121,170,406,339,399,237,19},
+{1,350,108,257,459,473,124,506,123,258,58,500,395,384,470,291,355,314,144,73,337,361,451,126,164,77,88,261,194,437,381,49},
+{1,319,344,115,374,96,356,305,99,280,459,168,34,483,67,452,292,137,445,346,332,474,389,479,257,209,92,38,36,283,439,82},
+{1,152,409,353,191,473,130,153,355,39,246,465,293,108,102,345,131,213,23,365,40,181,230,344,207,417,349,435,332,374,466,497},
+{1,326,194,358,296,309,213,133,157,153,478,284,122,338,103,178,55,170,51,493,241,139,473,446,268,315,401,418,79,190,53,492},
+{1,43,18,371,65,196,194,191,164,136,271,425,266,12,250,54,88,195,332,326,449,492,408,220,310,211,20,270,90,232,325,25},
+{1,492,225,494,118,365,204,359,314,319,452,488,407,22,469,298,267,405,506,79,477,304,201,412,278,320,69,43,360,55,331,325},
+{1,56,299,396,229,483,186,37,53,501,306,176,253,195,498,358,434,468,375,110,67,150,236,287,101,135,304,136,388,5,108,123},
+{1,452,61,328,93,133,390,349,376,330,409,362,290,130,203,393,198,470,391,447,126,280,135,66,178,476,149,42,425,125,62,110},
+{1,206,225,205,301,212,57,441,439,52,147,86,426,188,287,277,266,332,324,405,87,461,126,470,420,319,440,464,246,90,231,415},
+{1,412,315,337,130,466,414,252,53,276,168,38,177,409,365,222,71,438,148,122,292,433,261,145,119,175,439,90,202,115,108,140},
+};
+
+static const uint16_t prescr_table_31_2281[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,2,1,3,2,1,3,2,1,3,2,1,3},
+{1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,6,6,6,6,6,6,6,6,6,6,6,6,6},
+{1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,5,1,7,2,3,4,6,5,1,7,2,3,4},
+{1,2,4,8,3,6,12,11,5,10,7,14,15,13,9,1,2,4,8,8,8,8,8,8,8,8,8,8,8,8,8,8},
+{1,11,10,1,11,10,1,11,10,1,11,10,1,11,10,1,11,10,1,9,14,3,2,11,5,6,4,15,10,12,8,7},
+{1,11,7,15,10,12,8,5,6,4,13,3,2,9,14,1,11,7,15,5,3,1,10,6,2,11,12,4,9,7,8,13},
+{1,4,16,10,13,17,14,29,27,3,12,21,30,23,22,18,2,8,5,10,20,13,26,17,7,14,28,29,31,27,19,3},
+{1,12,2,24,4,25,8,27,16,31,9,23,18,7,13,14,26,28,29,28,26,14,13,7,18,23,9,31,16,27,8,25},
+{1,29,6,16,20,17,9,23,25,3,8,10,31,19,28,27,22,4,5,12,16,10,24,15,20,31,30,7,17,19,14,13},
+{1,11,28,24,3,29,19,31,5,16,2,22,15,7,6,13,17,9,10,16,1,30,7,3,21,9,5,8,27,15,24,26},
+{1,17,14,2,25,28,4,9,3,8,18,6,16,31,12,27,5,24,13,5,12,16,18,3,4,25,14,1,21,30,19,22},
+{1,18,24,31,27,20,14,8,30,9,12,17,19,10,7,4,15,26,6,11,20,7,2,18,12,22,21,14,4,25,24,17},
+{1,15,22,23,24,14,25,1,15,22,23,24,14,25,1,15,22,23,24,7,55,57,20,37,13,4,30,22,42,6,17,29},
+{1,6,20,49,52,42,39,9,54,38,15,34,23,59,8,48,50,62,22,58,7,9,27,45,62,11,29,39,32,41,50,31},
+{1,29,13,47,6,25,46,27,20,1,29,13,47,6,25,46,27,20,1,37,61,15,33,7,2,29,45,30,21,14,4,58},
+{1,38,37,20,32,28,39,3,49,52,60,59,36,50,5,8,7,31,22,54,56,39,44,55,43,21,3,53,13,42,6,49},
+{1,54,12,46,49,45,10,57,25,11,15,21,37,62,56,47,7,33,36,4,13,12,23,20,57,60,42,37,31,14,33,18},
+{1,37,11,21,34,62,36,46,30,55,28,26,10,48,41,43,6,16,58,63,51,35,62,18,56,26,5,12,16,29,44,42},
+{1,62,54,31,27,57,59,42,43,21,35,60,39,30,37,15,36,49,18,23,25,20,56,52,7,48,22,6,47,45,19,8},
+{1,21,59,25,33,7,24,52,60,1,21,59,25,33,7,24,52,60,1,51,18,40,46,17,14,24,26,15,43,8,39,5},
+{1,41,38,16,6,28,62,21,20,61,27,11,13,17,47,58,46,19,8,59,57,16,3,7,32,6,14,53,12,28,31,24},
+{1,122,58,125,90,88,47,91,34,21,38,120,77,9,35,111,28,5,23,105,3,71,82,65,95,102,94,91,17,100,36,70},
+{1,58,30,65,70,105,51,111,38,43,59,36,95,7,47,90,92,73,13,8,97,60,65,35,56,53,61,92,96,33,2,58},
+{1,39,109,43,88,68,61,73,47,75,97,30,55,33,48,91,45,5,52,36,2,39,113,41,11,96,91,81,101,65,67,100},
+{1,90,2,37,4,74,8,5,16,10,32,20,64,40,17,80,34,49,68,49,34,80,17,40,64,20,32,10,16,5,8,74},
+{1,125,109,27,87,64,127,10,92,97,115,98,105,72,68,44,25,48,7,106,41,85,93,14,73,82,55,39,28,15,57,110},
+{1,76,97,42,70,5,50,12,37,16,17,93,60,22,80,85,103,107,78,47,58,120,22,40,111,24,37,8,126,101,42,35},
+{1,58,28,52,6,55,72,19,20,25,77,106,120,86,83,42,70,9,23,126,101,44,109,111,85,91,86,124,95,34,96,69},
+{1,118,105,51,78,34,116,60,88,40,7,48,109,32,33,87,62,13,67,108,43,18,80,7,24,53,4,85,105,69,79,42},
+{1,41,120,76,92,48,11,77,117,72,71,17,69,67,10,100,13,4,27,79,76,46,12,73,55,106,57,10,50,115,95,122},
+{1,39,90,31,120,63,22,36,51,48,89,118,87,30,95,101,9,92,12,19,47,112,34,16,123,43,62,120,127,101,100,23},
+{1,66,107,90,3,13,118,37,5,23,81,111,15,57,56,122,17,75,72,71,62,48,104,78,74,5,110,67,113,91,69,124},
+{1,64,110,70,72,87,122,65,46,40,14,31,45,59,111,6,38,17,50,11,21,74,2,64,55,120,9,85,125,122,73,98},
+{1,118,26,106,59,13,53,119,108,112,81,54,56,66,27,28,33,103,14,61,35,47,100,74,21,51,30,12,75,46,95,38},
+{1,72,11,35,69,82,92,56,90,66,96,109,52,75,54,62,32,120,79,110,118,103,93,56,45,98,12,122,29,64,120,85},
+{1,41,106,101,44,8,121,3,123,81,64,116,24,100,5,98,28,47,115,20,43,28,96,39,5,49,7,24,50,77,64,58},
+{1,3,5,15,17,51,85,14,18,54,90,31,33,99,84,13,23,57,75,22,29,107,38,53,87,4,6,5,127,56,36,54},
+{1,117,18,2,29,36,4,58,72,8,116,103,16,31,57,32,62,114,64,62,57,16,116,72,4,29,18,1,65,127,70,86},
+{1,45,77,122,33,107,47,23,29,40,41,4,73,51,18,121,86,65,92,58,40,106,1,104,44,48,76,85,27,99,32,35},
+{1,75,238,139,9,37,223,191,65,22,125,48,127,166,184,171,170,225,15,66,232,21,80,205,247,57,45,213,174,107,171,85},
+{1,195,219,33,134,185,117,139,7,115,59,231,181,8,86,150,21,68,161,201,11,7,183,199,120,148,71,242,246,109,182,40},
+{1,254,208,39,40,165,185,95,236,69,88,64,35,173,152,37,255,46,247,146,252,150,43,70,173,76,214,175,178,190,236,183},
+{1,201,185,179,170,164,238,94,130,192,214,91,24,199,243,3,118,230,248,255,123,109,189,112,5,77,220,33,147,52,120,86},
+{1,72,155,229,91,39,9,122,167,98,241,38,65,225,66,57,214,47,59,35,8,25,15,229,177,219,38,188,118,70,16,50},
+{1,77,224,183,247,71,108,245,221,147,164,12,29,124,217,152,101,174,128,176,138,246,5,35,216,245,241,107,139,79,61,18},
+{1,239,187,98,79,146,212,127,252,38,119,42,202,176,200,35,243,231,109,71,34,14,23,123,237,20,69,205,245,169,8,107},
+{1,95,134,222,154,55,9,25,149,179,105,208,65,209,30,87,192,205,247,98,148,118,108,86,224,69,121,46,78,133,176,68},
+{1,92,42,6,171,252,20,95,206,120,161,98,115,99,47,73,41,226,213,123,147,7,202,132,235,230,99,166,251,192,203,170},
+{1,19,96,155,154,137,233,114,232,97,136,250,18,115,251,1,19,96,155,77,123,131,153,94,75,78,211,171,128,49,118,82},
+{1,131,235,102,233,9,86,197,237,215,65,52,242,243,112,155,253,20,29,145,151,123,81,207,159,165,238,169,95,253,10,93},
+{1,129,217,67,222,87,51,239,203,59,82,84,193,245,14,40,171,1,129,212,244,255,96,29,208,135,38,249,146,16,189,247},
+{1,232,214,97,94,1,232,214,97,94,1,232,214,97,94,1,232,214,97,47,230,29,152,66,87,246,111,89,128,9,77,85},
+{1,105,124,59,22,252,169,167,111,113,72,140,136,87,220,48,104,21,71,171,135,123,146,229,122,27,250,82,53,111,133,18},
+{1,21,150,13,233,98,81,144,115,147,76,174,91,18,253,225,202,116,248,80,129,155,114,67,245,231,90,192,123,222,184,121},
+{1,144,100,26,248,146,207,210,204,233,96,199,227,250,57,7,230,183,70,255,58,30,215,133,224,165,130,147,234,232,120,74},
+{1,119,32,31,163,250,216,41,202,14,29,77,186,230,226,179,51,79,84,83,55,15,53,120,37,218,165,228,6,153,48,107},
+{1,60,18,134,155,214,163,52,109,22,118,211,111,110,82,64,198,93,139,20,7,90,208,218,22,59,83,62,53,231,1,30},
+{1,122,137,253,93,241,128,17,245,203,208,71,28,82,162,88,192,200,94,238,46,74,140,102,188,127,92,148,187,204,219,254},
+{1,28,249,80,100,175,124,38,154,171,12,144,115,146,75,201,235,1,28,168,20,216,79,136,125,29,166,64,210,35,123,57},
+{1,42,83,112,232,128,250,167,202,50,193,173,127,223,195,249,217,63,162,36,39,24,73,91,144,156,96,149,221,147,163,49},
+{1,105,190,15,144,62,85,57,247,121,218,243,96,229,207,231,29,38,3,131,174,235,27,168,80,250,195,102,23,99,47,44},
+{1,56,9,59,65,32,12,227,108,247,138,67,80,30,149,238,183,146,70,68,124,153,231,70,68,124,153,231,70,68,124,153},
+{1,138,190,186,195,106,211,65,38,244,63,167,233,21,216,226,182,72,94,140,14,40,82,46,3,207,151,74,165,25,206,210},
+{1,72,38,131,230,162,74,182,207,55,185,217,34,116,126,215,124,71,48,75,127,164,253,243,220,165,217,17,29,122,16,57},
+{1,127,196,184,253,212,60,50,175,217,32,213,67,246,23,36,244,233,113,194,221,238,134,246,229,9,240,100,175,130,8,33},
+{1,116,10,134,68,137,129,239,191,221,212,206,148,112,61,174,117,126,140,97,185,1,58,241,105,142,21,188,211,193,219,246},
+{1,240,196,185,13,154,45,89,81,29,2,19,123,129,26,199,90,178,162,29,1,120,49,172,216,220,207,11,174,40,190,100},
+{1,238,152,58,191,32,143,18,148,204,62,237,95,103,241,20,239,118,162,184,160,86,236,162,184,160,86,236,162,184,160,86},
+{1,246,58,64,171,177,88,87,202,69,119,99,225,91,180,132,133,115,73,248,212,67,36,189,19,217,7,152,213,56,214,181},
+{1,32,6,192,20,131,120,265,272,51,101,170,350,511,449,4,128,24,259,40,131,60,451,34,35,51,307,299,171,191,511,481},
+{1,315,419,26,210,196,324,65,445,6,169,488,92,253,137,427,390,428,20,507,284,57,494,370,193,336,211,503,437,205,505,39},
+{1,438,6,410,20,370,120,277,272,71,89,402,470,322,218,437,203,400,173,167,496,511,264,11,396,261,330,140,495,202,19,175},
+{1,346,70,255,204,240,192,265,499,315,149,333,419,379,411,21,330,264,169,435,279,504,313,29,507,206,290,19,336,39,22,338},
+{1,316,154,255,294,334,125,84,478,447,212,245,27,232,24,397,438,140,253,431,270,252,305,56,319,495,220,472,170,226,386,402},
+{1,308,213,391,387,265,112,27,96,30,478,434,50,74,325,506,306,26,340,371,157,341,489,35,427,285,361,55,250,177,415,73},
+{1,450,381,389,123,471,240,375,187,421,108,493,203,142,63,164,278,320,150,210,370,18,331,53,205,50,89,290,140,196,398,346},
+{1,71,6,402,20,506,120,138,272,375,189,495,453,244,8,115,48,298,160,309,240,138,136,207,204,397,170,110,255,89,421,336},
+{1,307,451,214,253,164,408,469,367,434,191,400,297,248,489,444,2,63,479,214,338,41,51,386,119,20,195,36,455,84,362,339},
+{1,269,258,468,343,504,39,300,225,472,201,34,171,341,445,124,219,16,119,364,433,241,504,316,75,192,306,393,280,121,174,105},
+{1,285,6,225,20,35,120,202,272,217,207,179,199,463,247,104,87,368,498,501,267,61,188,273,226,171,147,460,488,298,284,447},
+{1,364,251,80,224,122,33,433,421,413,183,37,211,32,221,350,461,87,95,121,254,47,339,183,294,410,4,177,251,40,56,149},
+{1,371,171,243,25,430,78,487,321,408,111,440,323,273,313,94,369,34,421,456,103,462,413,7,116,376,141,34,485,228,260,231},
+{1,102,309,32,498,464,238,291,397,317,359,390,208,59,230,100,505,61,434,282,488,81,134,313,324,111,10,510,444,40,353,105},
+{1,235,505,327,460,69,177,440,39,279,388,17,296,143,88,407,239,40,36,21,322,123,406,2,235,450,496,263,285,504,214,146},
+{1,16,256,310,209,133,203,293,481,52,455,211,165,76,462,67,318,81,30,240,9,72,199,433,29,232,201,449,282,75,223,369},
+{1,373,218,332,369,36,177,363,202,33,314,76,412,446,398,172,113,201,299,42,230,182,261,179,138,277,335,375,280,62,357,401},
+{1,139,6,419,20,248,120,137,272,431,459,208,392,121,2,278,12,479,40,248,60,132,34,198,51,165,358,443,469,42,115,63},
+{1,18,260,181,182,128,303,240,298,170,376,104,437,75,352,472,420,377,122,265,366,146,324,488,354,254,235,86,69,206,347,271},
+{1,175,151,9,157,357,65,319,217,236,246,510,99,169,464,478,171,142,240,270,109,238,212,52,264,412,352,297,253,332,10,182},
+{1,78,114,504,124,131,111,495,40,268,157,170,301,256,378,93,286,447,159,27,398,94,230,438,7,245,256,189,491,136,49,326},
+{1,303,350,305,487,344,10,506,39,310,499,27,68,289,374,256,379,238,31,203,224,320,196,312,438,337,27,34,446,131,16,275},
+{1,505,309,199,258,454,114,86,365,128,282,268,236,234,390,255,208,283,245,434,164,334,151,479,510,208,467,146,306,41,269,468},
+{1,256,374,169,213,54,229,386,258,441,138,391,412,137,72,201,370,311,147,329,312,511,279,7,335,247,50,474,113,199,232,272},
+{1,271,248,98,390,471,93,505,38,406,220,315,170,40,298,174,438,27,294,262,13,190,310,235,316,122,176,360,415,31,92,123},
+{1,4,16,64,256,438,437,441,393,329,146,147,151,135,199,455,113,452,125,250,500,307,189,378,47,94,188,376,43,86,172,344},
+{1,353,504,246,144,179,96,122,297,219,198,173,349,375,25,5,271,263,475,360,344,60,317,508,76,476,500,34,217,258,106,306},
+{1,303,376,165,174,323,22,291,83,147,25,384,276,459,296,446,454,300,240,234,238,73,305,31,328,385,353,494,274,17,398,76},
+{1,51,6,170,20,253,120,271,272,32,98,192,332,385,426,5,255,30,259,34,2,51,3,426,386,383,323,64,98,96,83,80},
+{1,206,23,469,277,227,508,213,447,36,371,431,136,3,338,57,364,44,293,258,155,375,194,53,257,50,52,358,243,168,292,357},
+{1,253,139,370,355,271,95,484,350,354,498,212,150,61,109,429,304,456,351,325,155,379,46,375,309,234,254,198,372,60,72,451},
+{1,225,47,375,372,87,38,160,35,218,176,336,309,91,395,356,292,457,75,124,229,90,181,149,486,158,99,404,451,464,504,16},
+{1,392,24,340,320,190,350,447,78,191,214,423,282,511,104,249,165,433,215,390,465,113,387,294,111,146,354,79,266,418,122,169},
+{1,125,29,226,337,252,308,394,238,124,96,255,435,429,456,190,356,146,28,471,83,343,249,454,300,488,493,177,103,198,120,202},
+{1,412,338,507,155,331,115,471,161,364,474,311,49,436,366,473,168,252,130,508,129,174,481,70,431,495,479,459,452,147,318,333},
+{1,364,6,506,20,455,120,329,272,292,242,74,357,444,460,83,371,490,440,375,356,104,470,92,317,114,7,75,416,458,368,303},
+{1,434,101,170,26,479,99,215,324,364,63,452,14,209,313,50,140,408,285,362,33,385,266,134,296,108,218,6,409,496,472,214},
+{1,492,120,369,431,117,204,172,383,381,510,270,183,178,88,448,152,317,156,432,95,377,124,406,197,422,103,221,503,375,21,290},
+{1,183,398,377,47,19,495,378,502,480,261,267,451,176,490,112,130,222,406,170,484,92,164,384,360,87,69,233,212,449,239,269},
+{1,167,288,509,246,280,269,343,3,489,11,364,282,67,124,146,5,336,29,474,382,175,359,59,313,479,470,455,164,465,456,348},
+{1,89,327,14,115,30,84,479,180,53,340,194,278,236,299,29,191,379,166,80,491,362,108,447,51,65,468,253,284,331,465,469},
+{1,145,186,501,362,216,391,81,361,363,73,317,420,3,435,462,364,205,360,253,224,25,475,376,480,379,128,177,276,349,122,19},
+{1,362,28,223,336,9,312,252,217,210,65,133,482,239,188,310,300,113,361,465,225,182,472,125,137,371,192,167,319,10,323,54},
+{1,13,81,24,184,146,320,84,33,429,234,157,267,238,169,79,142,460,386,322,39,259,67,105,128,197,187,384,335,461,261,84},
+{1,28,336,422,3,36,127,357,5,108,129,32,15,180,387,96,17,476,266,80,239,395,64,15,90,131,12,72,127,373,293,458},
+{1,173,6,79,20,418,120,303,272,416,290,291,398,392,455,467,113,9,294,27,437,454,191,293,304,103,424,388,380,326,450,485},
+{1,507,51,250,474,295,451,125,237,329,315,484,428,382,327,242,214,191,377,486,301,70,343,373,291,376,193,22,180,316,109,160},
+{1,407,62,201,415,475,313,165,126,261,251,413,332,325,311,249,266,304,215,216,481,111,428,39,100,2,407,31,220,374,81,20},
+{1,354,458,130,282,510,221,410,487,368,67,398,172,137,318,299,258,305,206,347,346,491,122,376,3,467,372,193,74,439,489,280},
+{1,186,148,236,157,475,244,449,220,494,30,267,436,185,346,336,425,124,338,395,85,262,208,160,94,194,407,399,289,402,166,400},
+{1,66,344,156,215,16,119,139,366,393,256,234,30,38,354,348,404,480,429,115,295,229,480,304,479,373,404,240,152,265,348,202},
+{1,319,66,357,504,263,250,65,497,318,381,295,157,255,509,187,432,207,67,45,388,249,384,338,450,10,444,165,457,195,227,314},
+{1,500,438,21,30,287,273,390,340,386,310,232,354,144,373,191,223,388,357,375,71,502,303,40,490,440,65,51,66,317,280,91},
+{1,304,47,370,112,325,191,350,433,324,399,369,195,308,202,462,413,133,398,465,59,240,143,274,161,307,78,184,132,95,490,203},
+{1,137,24,149,320,437,328,454,392,341,23,176,456,292,453,19,381,424,153,127,191,258,107,478,378,255,206,491,333,65,124,390},
+{1,111,108,221,105,270,437,348,120,103,239,70,375,445,479,227,377,92,44,100,47,449,2,111,54,308,369,402,211,196,316,205},
+};
+
+static const uint16_t prescr_table_31_3217[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,2,1,3,2,1,3},
+{1,6,2,7,4,5,3,1,6,2,7,4,5,3,1,6,2,7,4,5,3,1,6,2,7,2,6,1,3,5,4,7},
+{1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,3,4,6,5,1,7,2},
+{1,2,4,8,3,6,12,11,5,10,7,14,15,13,9,1,2,4,8,3,6,12,11,5,10,10,10,10,10,10,10,10},
+{1,11,10,1,11,10,1,11,10,1,11,10,1,11,10,1,11,10,1,11,10,1,11,10,1,9,14,3,2,11,5,6},
+{1,11,7,15,10,12,8,5,6,4,13,3,2,9,14,1,11,7,15,10,12,8,5,6,4,9,7,8,13,14,15,5},
+{1,31,18,29,9,28,22,14,11,7,23,17,25,26,30,13,15,20,21,10,24,5,12,16,6,4,27,18,28,11,17,30},
+{1,24,8,31,18,14,29,11,30,10,6,2,25,16,23,13,28,19,22,21,20,12,4,27,9,23,18,7,13,14,26,28},
+{1,15,11,24,27,10,23,16,18,12,26,5,28,8,9,6,13,21,14,4,19,3,17,29,7,1,16,9,3,31,27,5},
+{1,5,17,12,11,16,9,26,28,2,10,21,24,22,23,18,3,15,4,20,29,7,27,25,19,3,28,1,25,18,26,14},
+{1,31,23,3,26,2,5,21,6,15,4,10,17,12,30,8,20,25,24,7,16,19,9,11,14,16,20,17,6,26,1,18},
+{1,18,24,31,27,20,14,8,30,9,12,17,19,10,7,4,15,26,6,22,23,5,29,2,25,24,17,23,28,8,15,13},
+{1,8,3,24,5,40,15,59,17,14,51,18,22,54,58,25,13,43,23,62,57,1,8,3,24,35,10,40,38,30,59,41},
+{1,50,34,39,6,62,23,9,20,22,59,54,49,61,8,38,52,28,48,15,42,1,50,34,39,3,43,61,4,45,34,55},
+{1,7,21,60,26,17,32,25,24,31,10,54,44,61,29,4,28,3,9,63,19,46,51,55,43,20,54,22,49,55,62,10},
+{1,2,4,8,16,32,27,54,55,53,49,57,41,9,18,36,19,38,23,46,7,14,28,56,43,43,43,43,43,43,43,43},
+{1,46,10,11,37,47,36,1,46,10,11,37,47,36,1,46,10,11,37,47,36,1,46,10,11,34,35,52,6,19,15,31},
+{1,49,46,44,41,18,45,24,60,1,49,46,44,41,18,45,24,60,1,49,46,44,41,18,45,12,15,21,58,7,31,1},
+{1,57,35,15,9,40,56,26,44,6,33,16,34,54,42,39,49,50,20,28,13,22,3,38,8,62,43,15,50,10,7,12},
+{1,19,47,51,27,34,18,60,28,40,57,48,46,32,52,17,9,30,14,20,37,24,23,16,26,33,42,54,34,9,15,58},
+{1,40,39,30,7,50,31,47,21,1,40,39,30,7,50,31,47,21,1,40,39,30,7,50,31,45,24,52,56,34,62,47},
+{1,80,102,33,108,13,25,65,40,51,81,54,71,77,97,20,88,105,27,98,103,113,10,44,117,38,109,111,63,12,101,41},
+{1,48,90,28,100,116,66,49,106,70,120,16,54,115,91,44,62,104,38,69,40,119,18,86,78,117,57,124,104,19,51,5},
+{1,2,4,8,16,32,64,15,30,60,120,127,113,109,85,37,74,27,54,108,87,33,66,11,22,22,22,22,22,22,22,22},
+{1,38,13,61,81,3,106,23,71,98,5,47,57,88,55,15,113,75,121,89,17,2,76,26,122,81,73,82,124,59,10,47},
+{1,16,58,115,11,45,57,67,69,37,36,52,14,125,118,91,98,33,100,65,101,81,95,34,84,73,60,71,76,20,61,79},
+{1,28,30,38,26,86,98,105,10,127,107,50,67,39,6,72,68,115,92,29,2,56,60,76,52,86,49,96,123,94,65,92},
+{1,122,36,22,30,52,66,89,2,95,72,44,60,104,47,25,4,21,59,88,120,123,94,50,8,21,72,22,15,13,119,101},
+{1,25,51,127,116,46,40,126,109,29,87,10,67,53,41,103,94,98,35,36,107,75,68,122,9,52,24,21,19,56,78,64},
+{1,59,2,118,4,83,8,25,16,50,32,100,64,119,63,81,126,29,67,58,57,116,114,87,91,87,114,116,57,58,67,29},
+{1,95,105,110,113,45,100,112,114,13,30,3,32,122,115,82,119,109,81,87,23,34,5,96,79,42,93,11,47,109,72,69},
+{1,30,9,37,65,80,56,106,110,22,50,109,52,41,2,60,18,74,73,107,112,31,23,44,100,109,26,93,87,49,66,57},
+{1,78,58,22,67,112,97,110,107,104,105,39,29,11,72,56,89,55,92,52,93,122,103,108,36,14,76,83,113,126,21,33},
+{1,78,115,81,11,92,89,80,69,47,8,91,25,118,88,30,54,126,3,7,64,38,29,49,62,120,108,126,107,94,8,71},
+{1,84,116,24,45,92,111,44,8,27,52,37,71,91,9,79,64,61,106,7,102,99,72,38,94,17,49,7,51,83,9,85},
+{1,70,87,90,103,104,54,120,125,18,40,43,14,24,25,95,8,82,53,93,107,19,110,124,84,72,80,43,7,6,37,11},
+{1,45,29,20,66,70,3,119,39,60,55,59,5,104,105,68,89,77,15,73,74,61,26,38,17,21,79,82,88,48,124,109},
+{1,32,100,44,10,89,52,33,68,72,38,83,109,21,101,12,110,117,62,120,112,105,98,27,75,35,2,32,50,11,71,20},
+{1,10,68,91,96,52,50,14,108,76,11,78,31,59,84,6,60,98,32,71,69,81,36,111,82,29,105,55,22,78,113,79},
+{1,6,20,120,11,58,156,101,69,133,51,170,209,208,214,194,186,177,139,23,114,55,178,129,43,125,135,146,173,236,47,113},
+{1,25,92,47,128,28,33,30,19,166,77,187,117,249,73,223,24,69,115,175,156,61,63,13,181,251,179,208,193,139,241,206},
+{1,158,154,180,138,12,114,66,161,130,80,14,101,93,226,189,72,234,225,52,205,29,84,32,91,248,39,126,24,114,33,247},
+{1,219,144,123,95,156,86,113,242,165,15,109,179,227,18,247,101,133,215,189,85,49,111,40,238,114,89,14,91,213,19,22},
+{1,6,20,120,41,246,70,173,165,149,53,190,207,208,146,39,210,158,15,34,204,218,174,175,169,194,127,129,186,247,32,96},
+{1,45,173,30,23,109,107,133,42,110,28,77,8,87,171,240,184,41,25,212,111,49,224,22,64,99,105,240,92,218,107,221},
+{1,92,180,98,26,54,212,192,9,38,32,165,202,203,151,35,65,91,109,185,121,112,86,118,211,170,146,33,218,185,154,28},
+{1,65,141,107,223,22,234,89,8,182,75,185,101,176,146,118,64,204,230,180,201,252,179,81,190,209,147,180,203,63,146,59},
+{1,219,91,188,63,214,184,246,217,142,10,36,168,119,229,86,95,117,48,224,68,11,255,243,203,109,32,129,30,54,126,214},
+{1,100,138,48,141,105,148,249,152,131,219,166,188,128,119,93,236,114,204,132,130,191,44,140,13,15,107,46,34,31,228,204},
+{1,53,181,155,91,98,194,83,163,206,70,169,101,73,227,217,38,1,53,181,155,91,98,194,83,229,135,230,28,127,176,61},
+{1,119,231,227,78,65,94,23,98,107,55,206,19,207,100,40,135,102,198,56,209,90,186,109,116,63,202,95,48,125,17,168},
+{1,79,23,193,98,51,60,48,237,9,217,175,140,235,220,171,199,183,65,84,11,71,129,121,47,93,105,58,201,122,127,125},
+{1,232,35,80,146,83,209,54,33,251,212,243,142,144,248,151,150,126,93,13,159,204,29,43,10,197,234,68,184,229,94,39},
+{1,184,40,148,213,225,237,86,49,221,51,42,99,133,78,192,19,108,113,81,23,5,209,136,77,132,123,58,32,35,199,217},
+{1,86,198,209,162,85,60,16,90,56,195,84,106,214,139,154,150,104,122,140,179,89,194,2,172,198,173,237,89,97,197,208},
+{1,150,245,22,72,139,153,30,91,154,41,201,160,241,217,134,211,52,165,168,226,200,54,4,207,103,22,36,135,228,83,130},
+{1,6,20,120,143,28,72,47,226,237,207,3,10,60,136,14,36,216,113,185,168,206,5,30,68,204,203,194,217,244,131,26},
+{1,114,201,224,90,1,114,201,224,90,1,114,201,224,90,1,114,201,224,90,1,114,201,224,90,209,205,148,14,253,77,168},
+{1,185,177,143,241,214,83,71,36,231,110,91,121,90,192,235,79,26,153,73,222,109,57,3,98,61,14,125,246,129,209,23},
+{1,6,20,120,161,164,186,254,215,33,198,71,35,202,111,211,57,150,22,116,137,84,73,7,18,54,90,238,131,52,92,228},
+{1,172,41,128,114,127,74,50,70,171,23,95,136,156,138,121,216,196,60,58,168,94,36,181,10,219,152,160,88,91,161,14},
+{1,100,247,38,70,226,158,64,121,233,148,46,224,86,109,53,101,147,209,96,164,124,222,57,144,223,207,105,51,127,57,72},
+{1,165,73,153,152,61,116,237,117,72,60,209,164,236,208,1,165,73,153,152,61,116,237,117,72,30,160,243,125,225,157,201},
+{1,6,20,120,199,235,3,10,60,136,158,234,5,30,68,79,117,233,15,34,204,209,159,236,17,51,85,255,214,173,32,96},
+{1,34,202,23,169,62,200,83,224,16,71,47,173,182,90,15,35,232,221,190,151,246,155,179,240,197,26,103,190,165,211,177},
+{1,35,87,148,93,45,98,16,25,197,3,101,249,91,231,119,166,48,43,168,5,175,236,237,206,191,137,10,175,118,177,96},
+{1,6,20,120,227,95,49,166,50,172,14,36,216,197,139,220,221,219,207,183,84,11,58,156,174,1,3,5,15,17,51,85},
+{1,221,86,223,25,115,82,65,180,229,54,120,9,20,249,6,209,1,221,86,223,25,115,82,65,90,68,129,253,76,31,81},
+{1,41,87,35,180,62,19,224,102,94,187,80,252,232,215,237,90,31,245,112,51,47,161,40,126,58,167,111,99,149,108,162},
+{1,356,398,335,436,76,461,404,246,37,72,91,425,460,240,376,362,508,23,100,88,6,349,290,423,223,106,21,342,209,83,67},
+{1,150,293,95,247,344,477,102,398,74,268,2,300,91,190,494,161,427,204,269,148,9,4,73,182,190,247,172,243,384,470,167},
+{1,2,4,8,16,32,64,128,256,23,46,92,184,368,247,494,459,385,277,61,122,244,488,455,409,409,409,409,409,409,409,409},
+{1,51,307,320,233,72,258,21,468,58,152,391,478,452,273,363,361,271,370,489,59,171,180,158,301,417,401,290,44,385,186,214},
+{1,246,60,130,274,407,102,325,140,212,255,281,350,450,145,399,50,324,122,232,125,11,201,420,468,401,297,251,112,379,241,383},
+{1,241,457,216,332,411,466,487,167,298,288,317,9,270,322,111,437,429,385,28,453,206,148,97,65,229,495,172,227,252,151,185},
+{1,175,6,465,20,128,120,307,272,255,53,49,190,166,439,487,468,52,158,184,375,419,359,428,263,199,157,445,458,122,303,71},
+{1,27,325,30,306,217,340,437,162,295,286,326,51,182,251,73,222,277,435,248,100,346,311,174,403,460,342,484,138,106,236,220},
+{1,213,413,155,312,205,344,384,390,289,221,478,421,338,105,475,125,80,199,177,477,218,428,452,202,149,238,441,77,237,42,350},
+{1,151,470,433,35,417,47,420,187,459,303,356,235,503,318,511,312,210,370,458,440,178,346,468,159,232,39,209,330,236,265,263},
+{1,120,199,498,166,455,42,366,288,483,497,46,142,89,132,268,413,38,299,206,47,246,158,374,426,45,3,68,203,489,82,486},
+{1,319,223,121,34,359,178,205,214,282,190,191,384,351,294,260,99,209,28,202,464,366,465,81,270,20,75,458,506,286,72,350},
+{1,472,178,266,344,23,35,386,48,112,277,182,219,511,225,413,478,188,201,469,374,81,328,482,208,301,434,32,501,334,246,223},
+{1,128,421,416,343,255,326,419,215,103,465,45,470,474,323,340,383,478,308,345,358,108,191,175,371,408,213,392,59,389,268,210},
+{1,344,484,505,157,155,460,366,386,177,406,452,39,465,10,388,486,308,296,276,246,88,103,16,239,83,355,314,155,230,357,175},
+{1,298,411,278,66,409,453,499,306,321,70,63,32,165,58,172,219,122,486,175,290,80,91,105,270,76,464,55,438,122,243,138},
+{1,464,86,45,150,447,379,22,163,446,171,64,142,296,276,315,152,395,170,400,216,261,386,132,483,388,167,490,403,340,400,108},
+{1,240,395,320,266,409,246,306,328,289,14,146,415,79,314,355,182,106,63,152,84,87,327,323,26,386,385,265,264,368,248,208},
+{1,360,510,423,402,498,141,437,218,217,450,355,297,316,393,30,98,268,103,130,388,92,443,387,417,466,44,430,155,348,123,280},
+{1,292,149,267,153,448,394,207,201,510,37,496,3,457,447,440,427,229,59,337,347,167,111,181,5,127,25,89,343,54,95,158},
+{1,324,249,82,161,72,290,497,455,73,102,264,405,232,46,42,100,303,103,76,364,186,143,98,326,111,104,425,441,293,110,202},
+{1,282,289,302,266,87,351,395,33,321,451,44,486,107,463,401,367,166,178,194,345,14,318,124,38,239,393,81,109,37,376,508},
+{1,20,272,168,105,243,463,426,425,405,24,480,347,78,162,225,167,165,141,16,320,402,116,343,190,502,367,495,405,12,120,397},
+{1,123,498,117,511,245,422,51,430,292,156,67,454,186,155,290,390,497,248,294,106,360,300,395,369,311,120,472,43,44,507,491},
+{1,451,460,473,409,282,136,504,371,31,489,332,223,108,299,414,497,78,341,30,42,128,262,501,49,139,182,277,294,110,62,489},
+{1,122,327,88,41,235,245,47,503,10,511,257,171,282,483,303,294,87,68,7,358,440,392,223,74,8,488,85,88,377,140,243},
+{1,364,425,65,294,378,182,430,346,147,189,91,215,173,307,292,343,273,300,483,146,465,498,150,395,350,286,315,200,53,327,326},
+{1,9,65,176,194,473,263,34,306,447,168,26,202,401,502,80,41,353,397,266,71,134,324,128,370,131,456,207,222,494,68,306},
+{1,308,492,72,156,76,335,510,111,143,351,176,165,268,408,371,89,230,362,132,421,480,316,331,45,366,299,325,24,372,363,216},
+{1,65,480,11,472,364,69,228,429,500,42,192,496,302,358,476,104,483,200,235,369,318,67,354,216,231,183,245,493,419,317,64},
+{1,230,462,325,278,166,117,422,179,319,13,369,493,312,426,292,284,112,461,111,81,124,90,76,44,96,118,70,125,94,490,453},
+{1,372,35,309,292,139,391,344,134,480,239,179,264,46,338,147,190,367,409,359,123,127,142,2,503,35,277,73,509,422,205,121},
+{1,475,492,252,412,250,35,503,264,474,55,272,352,358,217,468,255,210,493,295,112,6,447,269,299,391,135,320,382,416,376,238},
+{1,260,480,168,192,181,367,424,99,511,62,300,233,184,159,351,329,364,405,370,7,382,243,105,369,29,335,139,441,156,177,22},
+{1,508,102,33,288,74,332,159,171,415,61,255,463,491,177,261,236,158,343,505,28,479,389,167,46,215,146,115,391,50,421,416},
+{1,82,250,415,11,303,76,52,69,447,509,508,430,340,203,192,495,419,407,466,109,400,108,450,150,394,245,252,413,499,320,188},
+{1,63,132,213,486,52,317,168,175,18,193,421,454,330,103,112,114,12,260,174,45,69,368,32,382,173,54,262,104,317,84,248},
+{1,363,392,353,135,6,460,221,496,73,20,325,405,461,438,120,296,147,323,89,272,70,49,316,470,107,101,194,453,154,85,324},
+{1,36,435,126,221,189,185,41,39,479,458,95,474,382,482,92,438,202,352,315,113,257,283,338,369,31,462,471,117,376,157,205},
+{1,205,251,465,82,171,224,324,294,354,368,406,279,320,377,485,226,222,208,427,468,192,215,163,94,37,309,273,503,2,205,456},
+{1,370,213,226,271,357,429,320,53,100,448,268,414,210,102,73,166,90,417,449,126,331,48,361,300,307,496,388,410,480,378,419},
+{1,403,180,467,318,123,6,255,203,383,98,282,20,369,457,484,332,186,120,448,291,461,334,239,272,307,11,73,287,303,416,54},
+{1,350,141,268,198,368,371,494,121,18,344,439,349,16,155,173,58,412,260,308,153,366,288,251,136,490,64,310,173,29,103,415},
+{1,197,70,277,429,341,419,364,386,430,26,361,470,240,468,378,344,213,391,506,324,167,453,126,497,342,118,427,39,302,3,357},
+{1,462,357,405,387,302,491,445,255,417,13,420,485,452,314,341,61,12,106,128,81,185,123,470,433,397,364,460,187,52,199,485},
+{1,417,295,371,391,182,186,337,464,256,323,361,275,91,93,376,232,128,369,356,345,509,510,188,116,32,90,254,303,175,182,93},
+{1,18,260,308,481,122,62,41,375,392,338,39,395,356,158,354,242,16,288,137,60,13,202,85,293,435,330,273,39,287,89,292},
+{1,188,118,375,330,28,397,451,23,354,336,416,378,404,443,122,277,155,156,17,339,100,480,436,476,47,316,361,259,382,434,298},
+{1,332,471,239,75,28,481,505,353,74,336,54,278,298,86,177,463,119,352,262,135,217,349,310,439,164,456,365,3,490,396,175},
+{1,306,251,296,481,12,447,105,263,54,80,117,295,195,360,11,439,323,329,460,116,21,56,64,490,312,63,36,48,181,105,358},
+{1,510,435,337,190,379,150,354,36,191,133,293,51,154,452,19,71,23,37,321,310,116,141,481,338,350,269,21,10,412,404,502},
+{1,17,257,237,361,431,392,10,170,289,280,356,370,4,68,123,97,475,278,394,40,381,251,31,495,305,4,34,257,412,175,186},
+{1,437,27,480,325,341,166,278,478,73,222,433,381,396,375,42,409,87,493,131,506,272,11,19,245,290,186,75,474,379,448,189},
+{1,434,408,218,505,294,99,379,329,489,315,317,180,449,254,205,479,149,73,57,106,310,126,37,134,321,11,101,121,15,226,481},
+{1,400,61,392,362,89,381,264,503,401,429,437,226,307,292,117,255,102,60,24,343,465,23,337,138,440,482,496,173,435,296,149},
+{1,186,409,200,298,54,164,98,242,320,281,315,205,131,61,183,493,28,143,243,506,128,499,487,181,433,310,417,235,51,379,281},
+};
+
+static const uint16_t prescr_table_31_4253[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,2,4,3,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+{1,5,6,4,3,2,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3},
+{1,2,4,8,3,6,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+{1,13,7,8,12,10,15,2,13,15,2,13,15,2,13,15,2,13,15,2,13,15,2,13,15,2,13,15,2,13,15,2},
+{1,7,10,8,6,13,2,7,5,2,7,5,2,7,5,2,7,5,2,7,5,2,7,5,2,7,5,2,7,5,2,7},
+{1,9,11,25,15,24,6,27,28,17,20,16,2,9,23,15,12,19,29,7,13,5,4,18,11,30,24,3,31,14,26,10},
+{1,14,6,13,20,7,3,9,22,25,29,1,7,21,16,11,24,26,20,23,30,8,17,12,13,10,31,15,4,28,6,18},
+{1,31,2,17,4,13,8,13,4,17,2,31,1,24,23,12,28,6,14,3,7,22,20,11,10,18,5,9,21,19,29,30},
+{1,20,26,30,23,17,7,1,10,29,14,2,20,13,28,4,31,26,15,8,9,3,30,16,18,6,11,23,19,12,22,25},
+{1,28,18,27,11,19,7,17,2,28,9,8,6,31,27,24,10,26,22,19,30,21,1,14,25,4,3,18,16,12,5,13},
+{1,29,10,27,3,26,30,8,14,20,27,31,24,18,1,16,28,21,11,3,13,25,2,29,5,23,22,6,26,15,4,7},
+{1,6,20,59,28,11,58,13,23,57,8,24,40,59,14,18,54,25,43,62,1,3,5,15,17,51,22,58,13,23,57,8},
+{1,1,1,1,1,1,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4},
+{1,9,22,8,31,30,23,43,60,23,43,60,23,43,60,23,43,60,23,43,60,23,43,60,23,43,60,23,43,60,23,43},
+{1,50,2,63,4,37,8,37,4,63,2,50,1,25,45,33,59,61,48,51,24,52,12,26,6,13,3,43,44,56,22,28},
+{1,31,19,52,34,20,8,29,38,52,17,5,1,63,44,54,14,60,12,35,53,46,41,55,49,16,58,45,9,34,10,2},
+{1,40,61,56,25,30,8,9,29,56,63,52,1,20,37,7,11,53,21,49,34,12,62,32,36,19,46,50,30,4,55,61},
+{1,29,63,23,55,37,22,21,48,59,7,31,52,1,56,34,20,8,25,19,23,45,18,47,15,6,39,22,21,48,59,7},
+{1,33,60,25,52,59,24,51,29,43,46,54,5,24,51,29,43,46,54,5,24,51,29,43,46,54,5,24,51,29,43,46},
+{1,8,53,9,61,60,52,58,2,8,32,31,9,36,15,60,26,29,1,4,16,53,62,18,61,30,13,52,58,2,8,32},
+{1,124,46,70,76,94,116,98,12,14,114,101,53,125,41,26,96,112,25,34,45,97,78,83,10,9,75,22,110,2,124,23},
+{1,52,74,16,118,97,18,15,31,36,30,62,72,60,124,25,120,113,50,121,107,100,123,95,65,127,55,11,119,110,22,103},
+{1,43,61,75,55,91,52,19,63,73,119,108,112,67,127,79,10,8,35,122,75,92,53,65,84,22,59,31,74,14,94,30},
+{1,38,13,61,81,3,106,67,125,40,45,114,88,83,111,28,87,35,17,1,19,39,93,12,69,23,107,80,90,117,33,55},
+{1,53,94,74,29,109,55,26,115,76,31,77,75,20,101,28,44,61,102,125,90,79,126,59,57,12,35,127,111,96,34,43},
+{1,88,63,28,109,104,30,61,86,45,10,118,50,27,6,79,115,9,2,88,76,7,99,85,89,96,33,51,55,32,31,17},
+{1,38,26,77,18,43,105,34,65,118,14,89,35,82,37,56,50,39,30,63,75,99,55,120,87,122,113,119,29,10,21,57},
+{1,37,18,71,118,68,25,57,52,29,115,38,98,50,114,104,58,95,76,125,100,93,105,116,7,33,67,113,3,107,81,14},
+{1,22,106,103,38,72,119,28,123,104,122,99,63,120,117,10,78,94,81,56,73,111,75,121,126,79,85,20,35,3,29,112},
+{1,123,54,23,24,39,86,37,80,105,125,87,120,61,35,28,68,67,82,18,102,2,123,27,85,3,38,118,31,98,53,77},
+{1,52,100,46,86,57,125,32,108,12,115,103,57,91,16,54,6,92,86,121,72,8,27,3,46,43,89,36,4,104,100,23},
+{1,28,37,115,99,5,108,49,91,78,75,125,12,72,111,35,116,114,86,8,112,74,115,88,92,100,65,17,61,19,33,104},
+{1,69,54,62,61,39,125,117,30,114,76,56,110,123,111,51,8,107,108,62,116,86,21,20,92,59,99,7,82,74,34,67},
+{1,60,38,32,77,124,89,108,116,75,122,26,3,34,104,12,109,106,48,126,98,37,50,66,113,45,39,14,81,121,56,107},
+{1,17,48,99,26,100,109,122,81,90,112,4,34,48,70,113,123,46,86,22,84,7,76,36,3,110,20,69,31,111,107,73},
+{1,30,71,82,54,66,52,63,86,39,47,87,40,122,97,9,119,42,100,58,101,53,48,3,17,14,90,99,23,44,70,38},
+{1,118,23,116,12,90,19,33,20,119,75,37,15,96,113,38,66,40,25,97,74,30,55,21,76,115,80,50,53,99,60,110},
+{1,86,99,26,105,8,67,118,52,105,4,81,99,13,37,1,43,89,60,54,63,75,41,15,115,78,83,53,66,93,109,85},
+{1,161,247,55,83,211,98,184,230,52,216,255,36,167,14,74,244,234,223,218,94,210,236,39,219,131,169,68,190,30,53,5},
+{1,14,84,127,192,244,241,237,185,8,56,168,127,96,61,179,62,186,1,7,21,107,12,36,252,206,80,173,100,33,231,143},
+{1,152,142,123,177,225,36,195,82,111,186,7,207,127,214,105,57,206,51,96,67,79,98,219,8,54,55,123,205,231,145,61},
+{1,172,150,86,75,43,179,215,238,116,192,152,24,19,3,250,248,84,31,156,109,133,40,53,5,35,37,252,33,137,183,162},
+{1,6,20,120,41,246,70,202,103,169,194,127,129,186,247,32,96,160,217,82,246,35,101,175,200,97,163,220,93,231,16,48},
+{1,243,205,98,90,161,73,255,173,239,136,154,76,192,131,2,243,249,135,219,62,200,14,167,145,212,127,186,6,42,52,182},
+{1,90,160,188,71,1,90,80,47,114,225,22,164,234,68,209,200,138,181,141,118,85,182,250,14,203,253,205,19,61,98,171},
+{1,71,153,180,144,117,226,161,204,120,48,213,49,89,239,224,230,47,85,34,20,8,67,109,180,72,229,228,104,182,15,6},
+{1,216,94,76,46,254,73,168,118,82,48,88,45,203,114,129,110,126,151,140,20,58,69,190,148,56,157,145,135,101,15,162},
+{1,167,45,39,160,247,228,152,14,218,211,100,108,58,96,71,23,193,111,124,150,212,9,183,8,86,90,39,80,214,174,19},
+{1,51,161,217,34,25,73,30,104,56,182,209,221,119,253,252,81,35,21,58,133,53,177,41,234,245,48,122,250,4,102,161},
+{1,113,243,208,47,81,159,101,56,152,118,210,222,137,237,85,21,121,116,163,31,189,34,71,127,231,145,67,157,20,249,172},
+{1,212,90,157,113,126,89,75,122,72,196,200,222,48,88,33,215,147,65,103,209,152,54,83,86,227,20,58,69,184,139,109},
+{1,77,251,41,93,188,214,160,32,71,194,164,186,188,107,80,16,158,97,82,93,94,136,40,8,79,141,41,147,47,68,20},
+{1,106,12,113,80,197,206,23,213,57,248,75,143,221,22,224,58,167,78,110,210,178,241,81,148,243,59,146,77,49,215,83},
+{1,163,91,147,151,134,97,88,187,219,23,216,32,68,69,209,165,134,245,44,152,168,206,108,16,34,231,173,151,67,191,22},
+{1,144,225,46,213,51,247,9,159,20,142,127,75,131,77,190,26,100,103,191,82,63,199,108,176,240,124,147,110,32,70,177},
+{1,185,180,194,229,125,249,211,164,235,224,143,15,130,52,236,39,76,33,24,207,134,217,88,70,221,181,242,188,36,102,86},
+{1,250,149,4,174,177,16,255,177,8,174,137,4,87,149,2,250,155,1,125,156,209,239,78,185,166,39,141,83,194,151,248},
+{1,236,220,27,42,1,236,110,184,111,206,88,146,187,245,151,188,30,18,129,76,142,69,26,99,93,149,80,112,170,238,130},
+{1,127,175,210,131,190,40,200,49,248,46,73,17,125,240,99,166,195,228,7,102,191,243,251,182,89,139,18,229,224,249,201},
+{1,177,197,226,151,1,177,188,230,74,170,142,93,68,199,192,40,15,235,16,6,110,121,151,222,67,47,231,204,244,253,120},
+{1,98,227,245,149,178,66,127,184,8,75,5,245,171,205,153,214,23,1,49,72,86,45,81,186,106,219,169,175,9,122,77},
+{1,203,102,35,111,67,167,188,236,186,126,239,243,179,78,221,10,121,255,88,228,8,178,204,35,208,99,45,240,250,131,124},
+{1,6,20,120,199,235,3,5,15,17,51,85,255,214,173,32,96,160,55,89,235,234,233,236,227,242,193,148,107,189,16,48},
+{1,57,82,240,91,220,254,108,232,50,6,75,123,68,38,97,140,62,144,189,243,8,228,164,240,195,55,134,227,29,113,153},
+{1,37,67,108,170,113,173,69,89,72,102,228,194,212,116,14,251,23,65,19,11,80,61,137,118,43,41,12,222,197,90,140},
+{1,209,239,255,98,249,145,71,216,189,41,174,222,61,72,107,182,203,74,186,56,136,195,232,151,199,185,120,65,88,220,236},
+{1,146,251,219,124,76,66,53,159,72,240,27,34,59,139,55,13,207,65,238,161,91,133,35,114,50,149,141,116,113,233,171},
+{1,131,156,245,48,36,63,212,185,216,65,133,50,145,195,118,86,74,188,154,250,222,61,87,247,155,71,249,224,84,201,242},
+{1,30,340,12,136,505,80,307,8,120,171,12,68,511,10,102,1,15,85,256,265,382,384,140,449,320,202,32,480,175,48,272},
+{1,260,212,440,425,101,407,185,301,18,352,299,271,478,409,406,59,280,37,83,114,56,158,122,10,310,450,470,427,62,387,196},
+{1,117,391,89,297,286,505,127,105,329,291,302,289,347,233,195,11,144,53,269,268,61,217,21,100,326,345,156,267,403,114,102},
+{1,326,278,443,206,411,466,120,251,317,405,22,406,499,85,367,392,331,401,129,128,35,363,287,93,65,447,240,502,97,305,44},
+{1,96,330,62,196,309,278,184,334,223,379,365,236,105,277,232,169,95,247,152,301,42,387,229,473,226,329,79,470,498,337,238},
+{1,129,507,291,18,422,448,143,65,30,504,80,282,384,455,90,434,432,305,218,271,390,68,74,480,43,346,200,476,502,506,209},
+{1,10,68,155,392,457,368,214,445,284,266,324,50,250,289,451,154,193,502,123,407,414,435,298,484,33,165,2,10,34,170,49},
+{1,355,432,62,234,400,450,1,404,108,149,213,297,349,173,334,37,487,486,114,30,139,94,375,42,135,457,492,11,493,415,385},
+{1,269,37,265,163,413,53,164,262,287,319,382,86,192,390,27,301,383,508,95,492,339,376,280,475,250,320,211,45,302,472,93},
+{1,192,100,365,9,33,283,147,424,249,46,477,481,29,94,293,431,473,97,121,455,159,375,85,218,332,137,214,403,37,34,258},
+{1,222,487,181,315,238,37,365,54,387,278,7,269,500,390,197,50,63,241,367,232,66,418,455,470,486,263,55,492,196,93,493},
+{1,265,281,168,25,340,196,271,202,139,48,93,474,409,43,510,83,94,355,253,20,407,431,260,133,436,167,268,115,495,15,52},
+{1,301,232,472,267,392,178,64,319,397,461,242,383,178,64,319,397,461,242,383,178,64,319,397,461,242,383,178,64,319,397,461},
+{1,177,74,159,395,408,240,48,477,271,309,234,340,68,20,4,354,74,372,255,51,15,3,466,268,231,486,435,418,423,422,197},
+{1,307,206,283,274,77,116,287,146,66,131,393,203,15,185,56,130,46,454,450,473,279,164,478,408,256,71,319,74,181,21,464},
+{1,126,364,224,185,125,494,426,388,151,110,449,134,294,292,346,492,468,306,175,136,92,161,498,473,9,455,4,252,364,112,460},
+{1,390,192,127,53,465,509,169,481,332,308,184,249,233,306,167,89,108,462,276,411,326,277,344,374,493,370,116,434,257,282,35},
+{1,176,113,295,457,501,43,469,61,183,252,28,395,343,47,181,76,360,40,317,499,137,163,302,425,131,74,184,301,321,333,116},
+{1,460,464,344,128,114,440,195,94,197,169,509,83,461,14,34,59,418,112,272,472,121,291,175,266,363,311,62,127,468,407,496},
+{1,108,376,464,423,129,293,136,70,79,457,450,40,159,257,383,106,8,432,85,464,385,137,112,17,499,244,319,145,5,238,294},
+{1,211,443,509,76,382,126,376,330,141,143,92,470,85,267,329,352,448,73,39,54,97,441,378,409,263,268,258,404,124,427,192},
+{1,61,63,69,59,177,199,393,167,151,24,284,130,207,381,217,210,350,198,204,5,319,157,209,38,288,131,394,479,369,87,147},
+{1,472,78,96,198,38,488,328,493,169,238,149,43,434,315,500,428,7,57,292,36,300,131,432,227,467,436,494,413,388,129,104},
+{1,415,281,358,55,242,469,450,145,11,282,132,199,107,171,262,205,217,445,350,494,359,212,201,296,164,493,336,173,360,63,340},
+{1,252,406,16,294,270,256,165,410,209,330,485,418,69,283,405,138,231,507,276,462,295,249,333,159,498,75,318,309,150,173,187},
+{1,195,9,438,65,7,146,370,109,270,282,489,452,168,290,378,442,284,172,164,371,353,215,410,301,228,273,497,358,158,291,118},
+{1,29,337,238,274,150,288,366,104,241,326,460,506,229,404,51,81,201,10,105,389,431,22,207,45,234,179,14,83,212,472,296},
+{1,92,403,159,47,489,160,250,427,104,294,326,272,393,6,228,38,214,81,83,15,442,95,455,502,499,357,336,493,232,494,154},
+{1,51,6,170,20,253,120,263,68,4,102,6,85,5,511,391,128,196,192,166,160,245,240,271,136,8,204,12,170,10,255,15},
+{1,193,66,242,485,24,114,11,319,316,20,428,330,413,209,15,189,382,109,152,329,181,361,233,106,50,179,42,138,422,412,312},
+{1,299,221,336,436,342,356,460,417,196,23,324,426,355,187,106,18,280,389,481,8,403,442,336,218,479,422,435,476,402,165,418},
+{1,165,410,225,89,246,47,427,57,77,312,256,144,65,505,177,398,188,146,228,308,449,289,351,260,474,475,6,495,343,143,497},
+{1,478,509,165,157,70,403,56,508,300,88,120,485,418,21,303,361,49,45,211,69,105,85,310,487,124,378,95,470,81,425,26},
+{1,204,51,344,86,397,175,295,278,374,378,227,182,322,228,388,424,53,504,63,309,472,59,173,491,151,288,36,412,427,159,289},
+{1,89,312,424,491,335,271,160,146,485,181,98,318,63,272,365,414,173,245,472,508,403,202,200,145,13,103,61,329,497,500,247},
+{1,393,344,58,205,297,159,446,227,453,42,174,35,376,396,407,164,284,45,28,385,26,83,494,484,219,398,30,8,182,505,58},
+{1,359,344,378,476,122,9,345,425,33,32,308,354,57,247,122,419,267,371,439,16,154,177,443,476,61,374,290,286,380,8,77},
+{1,242,14,81,84,53,3,139,425,117,217,264,170,199,427,135,222,103,269,311,359,308,492,157,409,68,145,238,86,325,209,411},
+{1,377,495,480,451,112,406,368,12,468,336,272,73,18,503,57,217,335,63,51,487,183,423,494,508,11,50,235,420,411,424,79},
+{1,355,209,298,427,62,178,446,212,60,314,258,405,70,326,432,43,146,378,138,297,263,316,460,153,300,430,182,19,5,169,394},
+{1,426,395,220,61,9,334,389,399,87,351,436,118,66,343,454,13,158,255,287,329,195,120,419,468,323,283,368,328,22,375,14},
+{1,95,487,46,131,186,449,147,470,111,164,335,154,316,119,83,136,232,71,445,117,12,450,346,57,260,229,19,66,149,311,194},
+{1,304,418,401,49,191,181,404,32,133,236,186,98,191,485,202,16,509,118,93,49,480,333,101,8,321,59,401,423,240,281,397},
+{1,54,411,361,25,355,453,398,177,351,193,448,505,111,438,316,451,468,37,146,407,450,463,352,269,141,190,454,419,251,123,106},
+{1,185,482,444,420,448,315,231,253,118,90,382,507,375,267,131,327,367,313,94,12,25,425,354,187,72,158,412,495,348,127,170},
+{1,413,148,213,420,137,392,2,413,74,221,484,482,228,58,349,208,343,123,53,115,259,347,470,393,284,440,500,47,277,400,249},
+{1,384,352,139,487,359,212,396,367,256,435,486,425,109,307,229,346,355,223,422,242,462,436,19,33,439,339,201,498,125,82,442},
+{1,6,20,120,272,274,286,155,429,334,107,189,455,496,425,322,127,129,387,316,253,263,176,464,457,482,415,280,145,435,364,13},
+{1,146,477,298,15,224,174,205,263,180,265,141,420,155,203,177,100,53,6,438,208,316,139,18,75,503,58,118,126,497,396,166},
+{1,383,478,356,15,354,155,280,258,341,291,285,365,281,88,199,234,54,465,3,37,381,400,182,452,229,135,261,69,384,63,298},
+{1,207,46,159,3,337,114,310,242,274,357,76,381,351,409,254,125,279,378,399,77,252,178,256,72,227,369,48,491,456,143,5},
+{1,218,226,302,477,264,323,214,376,135,504,124,197,181,377,234,42,326,271,72,298,176,160,474,391,14,467,343,24,455,409,167},
+{1,178,109,186,406,11,45,3,235,311,291,444,101,332,339,54,2,178,474,450,296,70,392,213,36,331,220,364,380,135,307,71},
+{1,52,309,152,62,253,243,260,341,425,59,509,181,30,300,294,450,288,414,382,500,127,211,423,183,42,71,256,317,156,119,3},
+{1,510,190,232,310,216,206,472,284,272,303,237,113,339,382,278,196,12,63,450,156,290,45,104,466,200,51,509,350,446,271,69},
+{1,431,51,414,264,240,319,18,192,296,349,297,119,475,186,54,320,131,28,128,153,406,462,90,59,389,36,384,427,321,425,238},
+};
+
+static const uint16_t prescr_table_31_4423[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,7,6,3,4,2,1,5,7,6},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,5,6,4,3,2,7,1,5,6,4},
+{1,11,9,12,13,6,15,3,14,8,7,4,10,2,5,1,11,9,12,13,6,15,8,10,1,12,15,8,10,1,12,15},
+{1,3,5,15,8,1,3,5,15,8,1,3,5,15,8,1,3,5,15,8,1,3,14,9,1,13,7,8,12,10,15,4},
+{1,10,6,2,11,12,4,9,7,8,13,14,15,5,3,1,10,6,2,11,12,4,11,6,1,5,14,8,9,12,2,10},
+{1,28,23,13,24,8,27,9,7,30,10,6,2,29,11,26,21,16,19,18,14,25,10,3,18,7,15,16,27,22,26,24},
+{1,6,20,3,10,21,5,30,22,15,11,19,17,29,28,26,14,13,7,18,23,9,27,4,12,20,21,22,19,28,13,23},
+{1,8,30,18,3,24,13,25,5,7,23,4,15,9,22,12,17,27,21,20,28,2,8,15,19,18,22,6,24,17,26,25},
+{1,23,31,21,6,28,27,16,20,17,3,14,22,8,10,19,26,7,11,4,5,18,29,6,14,11,2,23,20,19,13,12},
+{1,9,12,26,29,25,6,13,19,17,3,27,20,21,28,16,10,23,14,8,5,22,30,1,25,3,16,5,11,15,29,17},
+{1,26,31,23,14,2,9,3,19,28,4,18,6,27,5,8,25,12,11,10,16,15,12,27,28,2,26,17,20,16,25,6},
+{1,42,55,18,41,10,8,31,50,22,7,19,3,61,26,54,56,30,24,33,21,58,37,60,24,49,52,54,28,38,3,63},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,60,32,31,44,4,9,46,43,30,16},
+{1,17,54,15,18,5,14,3,51,1,17,54,15,18,5,14,3,51,1,17,54,15,9,58,23,40,56,6,51,45,63,16},
+{1,18,35,56,58,30,57,40,61,1,18,35,56,58,30,57,40,61,1,18,35,56,29,55,11,50,38,49,61,48,52,16},
+{1,46,41,45,60,49,44,18,24,1,46,41,45,60,49,44,18,24,1,46,41,45,30,38,54,20,25,36,24,51,56,16},
+{1,9,44,34,49,13,8,37,14,19,60,5,45,43,29,47,57,40,6,54,50,22,62,61,6,27,58,47,42,10,45,35},
+{1,62,48,29,23,36,8,60,63,14,45,10,51,44,52,3,49,35,39,57,31,24,34,53,39,37,27,3,33,20,51,22},
+{1,36,2,61,4,15,8,30,16,60,32,13,53,26,31,52,62,29,9,58,18,1,18,58,9,29,62,52,31,26,53,13},
+{1,34,28,49,86,80,31,87,114,3,102,36,83,121,115,33,122,21,5,41,108,118,4,68,28,89,84,10,41,54,92,1},
+{1,43,13,68,81,66,34,108,33,17,54,84,76,27,42,38,73,21,19,96,78,77,24,111,46,69,61,117,106,41,105,83},
+{1,4,16,64,30,120,113,85,74,54,87,66,22,88,126,105,53,91,114,89,122,121,125,117,101,69,5,10,20,40,80,47},
+{1,77,53,34,42,6,29,47,93,109,20,78,115,125,76,120,23,8,44,27,50,114,24,58,47,102,63,74,122,14,80,13},
+{1,57,14,100,84,12,22,72,89,35,80,117,46,127,51,19,8,111,112,110,73,96,88,13,89,95,20,29,54,103,65,73},
+{1,41,55,108,45,52,23,116,39,96,40,30,91,65,25,35,99,83,71,72,54,69,13,22,125,4,82,55,54,113,85,11},
+{1,57,25,102,23,110,34,13,67,30,98,88,10,71,81,6,61,86,2,114,50,103,23,55,93,62,91,117,27,10,118,107},
+{1,76,92,38,46,19,23,85,87,118,119,59,103,65,111,124,107,62,105,31,104,83,26,51,45,63,78,98,123,34,54,42},
+{1,25,63,116,18,99,12,19,122,51,103,104,80,107,123,42,88,28,66,8,119,57,17,36,99,6,43,127,39,41,102,103},
+{1,43,10,77,68,116,46,76,111,126,99,8,27,80,47,103,101,51,39,124,53,28,32,54,80,119,73,116,23,19,69,79},
+{1,109,23,29,72,21,12,102,47,87,76,55,80,18,82,3,124,57,39,19,63,20,85,75,81,90,70,49,84,24,102,114},
+{1,7,21,107,100,73,89,41,12,36,47,30,90,32,51,74,80,22,98,91,39,38,121,13,120,103,32,112,123,10,27,73},
+{1,126,90,102,28,20,101,75,47,26,111,19,96,103,98,78,3,87,59,127,36,60,61,2,126,45,115,105,52,111,99,24},
+{1,106,86,54,112,4,98,119,61,10,16,66,22,17,40,64,39,88,68,69,47,121,85,68,80,64,97,22,122,10,8,98},
+{1,54,14,53,84,39,11,52,98,41,62,96,69,34,10,2,108,28,106,71,78,22,52,49,70,60,6,90,9,44,104,98},
+{1,40,12,2,80,24,4,81,48,8,83,96,16,87,49,32,95,98,64,79,53,113,79,98,32,87,96,8,81,24,2,40},
+{1,101,11,91,69,7,34,49,111,53,21,25,96,20,124,107,79,57,108,109,8,3,44,65,69,120,115,37,114,108,77,2},
+{1,87,98,46,104,54,72,29,44,59,15,20,48,64,86,53,76,70,94,126,85,49,117,13,93,61,125,86,100,19,73,37},
+{1,164,230,59,73,125,50,186,234,202,141,82,115,144,169,179,25,93,117,101,203,41,90,18,243,198,62,168,134,121,74,69},
+{1,232,234,39,238,160,97,60,254,134,103,118,184,84,57,145,227,220,7,162,172,245,88,216,64,76,6,37,159,93,97,30},
+{1,39,185,69,35,37,247,28,169,99,189,217,145,26,123,136,8,19,79,126,51,3,161,56,169,164,240,225,116,55,218,124},
+{1,59,220,99,133,1,59,220,99,133,1,59,220,99,133,1,59,220,99,133,1,59,110,197,53,207,226,52,68,213,192,200},
+{1,136,103,236,42,111,72,89,160,33,106,146,155,183,163,128,195,159,229,6,123,107,13,63,98,27,58,15,183,205,32,113},
+{1,242,204,93,91,9,223,46,203,253,65,165,97,17,168,55,78,40,153,43,176,64,180,251,150,83,18,223,23,125,232,48},
+{1,244,179,149,15,88,98,237,85,159,164,223,212,139,191,156,245,71,38,154,87,58,225,46,74,203,193,50,230,5,223,106},
+{1,34,39,141,54,49,223,42,104,234,125,222,8,79,103,75,239,215,101,15,161,146,171,227,8,136,78,141,27,244,48,209},
+{1,159,82,203,126,58,56,101,193,52,200,188,204,6,231,143,124,103,156,144,61,64,92,172,113,155,116,56,131,217,183,189},
+{1,216,135,171,220,72,125,186,151,56,43,181,174,203,25,176,185,154,212,179,180,118,38,158,191,64,67,247,204,223,144,125},
+{1,47,152,74,199,60,203,145,116,82,244,43,36,248,134,155,59,6,226,235,213,64,68,26,130,167,120,203,252,29,80,85},
+{1,75,115,198,247,179,250,31,63,53,25,244,110,111,36,87,145,102,213,47,48,15,29,236,208,164,135,84,38,216,249,97},
+{1,98,237,140,199,11,47,26,40,67,69,126,254,79,51,9,235,183,71,186,83,32,101,90,222,249,11,172,189,5,245,48},
+{1,146,33,142,150,159,10,88,49,128,112,42,68,134,145,236,237,127,94,208,70,217,212,124,244,114,135,188,208,35,213,53},
+{1,160,239,3,103,182,5,169,93,15,124,231,17,132,174,51,11,117,85,29,159,255,208,202,113,46,74,225,172,122,215,253},
+{1,52,42,239,245,224,82,237,157,180,7,140,214,16,86,61,53,30,197,26,21,178,154,28,147,214,8,208,84,239,191,56},
+{1,68,11,123,69,79,112,62,10,63,78,52,53,113,122,1,68,11,123,69,79,112,31,196,85,86,48,84,116,151,207,174},
+{1,189,164,120,122,159,72,184,76,237,125,146,10,79,181,14,26,132,113,109,89,206,22,242,199,210,12,176,115,68,236,96},
+{1,210,188,57,134,106,139,170,8,28,42,107,89,22,49,154,64,224,243,30,45,176,196,151,64,112,84,107,253,212,139,85},
+{1,157,254,153,113,51,238,94,34,180,243,60,216,162,40,144,91,48,224,245,32,39,83,151,109,102,238,47,220,194,244,138},
+{1,153,49,136,167,203,129,225,195,94,216,148,192,68,139,189,152,168,185,47,108,74,48,208,253,82,88,118,212,126,99,28},
+{1,46,103,24,234,198,253,43,241,94,146,254,89,88,118,17,9,227,37,216,243,2,46,237,6,114,138,10,150,35,30,7},
+{1,215,204,239,74,36,197,79,41,191,154,136,11,205,56,134,203,143,107,236,240,179,250,181,64,31,157,116,235,72,197,198},
+{1,88,86,216,2,176,172,127,4,175,151,254,8,145,225,51,16,237,13,102,32,21,13,51,8,175,172,216,1,44,242,27},
+{1,136,15,164,85,215,173,111,160,12,235,68,236,82,193,128,189,220,80,6,158,34,59,148,192,4,199,15,82,139,32,179},
+{1,189,45,131,159,220,106,166,231,246,96,250,8,251,181,214,54,73,234,35,76,196,93,41,8,147,90,131,161,55,122,168},
+{1,147,119,137,15,253,212,107,85,174,222,96,205,65,184,9,89,1,147,119,137,15,141,53,194,94,27,134,121,128,43,63},
+{1,49,216,207,174,190,72,69,203,106,56,146,232,38,185,223,88,179,198,228,153,192,33,23,201,4,98,216,158,210,107,253},
+{1,182,213,209,22,168,6,94,225,249,116,26,20,49,89,9,205,92,120,166,35,54,162,114,34,64,25,231,169,88,165,6},
+{1,172,223,108,109,193,30,114,31,222,192,178,173,115,179,1,172,223,108,109,193,30,57,133,153,12,26,152,90,175,105,61},
+{1,64,24,5,320,120,17,70,408,85,350,509,257,32,12,259,160,60,265,35,204,299,342,255,497,1,32,6,192,20,131,120},
+{1,373,383,121,315,16,491,331,419,297,256,79,26,237,9,136,210,416,167,144,196,326,358,141,288,196,163,179,334,144,98,345},
+{1,329,306,239,225,365,52,256,96,20,268,361,318,486,459,391,150,441,272,102,411,409,142,222,209,440,295,85,293,284,444,418},
+{1,281,155,235,62,284,464,7,354,474,138,186,377,262,21,3,304,429,317,66,319,107,265,484,203,343,169,397,219,499,222,91},
+{1,61,275,329,141,78,193,245,51,117,348,437,363,308,57,487,327,491,91,505,464,454,332,34,460,389,444,95,406,359,20,402},
+{1,348,423,259,42,264,410,26,30,308,479,393,289,347,324,300,340,478,213,134,88,366,18,293,302,502,164,386,350,153,24,339},
+{1,389,240,421,203,164,150,144,488,507,67,202,289,102,309,291,351,213,90,201,413,374,493,262,80,185,106,251,468,282,426,90},
+{1,73,82,140,279,409,28,289,37,353,61,356,336,126,423,419,135,463,436,382,455,439,503,507,77,187,113,264,276,161,287,205},
+{1,157,332,131,181,126,24,238,446,510,375,162,320,244,106,129,399,191,286,388,322,462,377,475,379,326,477,220,172,298,278,239},
+{1,389,385,372,401,255,90,505,145,404,399,318,483,421,200,189,450,361,128,410,453,332,371,218,286,85,27,375,399,159,239,455},
+{1,487,315,37,216,45,219,97,499,14,155,121,502,218,390,200,43,67,84,301,187,117,99,44,158,356,401,490,246,93,342,115},
+{1,248,229,112,436,86,243,150,204,205,53,208,160,276,322,433,295,491,294,275,451,355,271,215,292,325,152,231,192,299,440,82},
+{1,476,162,24,88,61,320,497,87,26,399,377,368,321,45,245,2,471,324,48,176,122,320,463,142,431,62,402,158,66,217,418},
+{1,334,406,348,188,372,146,103,27,447,60,57,161,502,308,271,325,488,19,100,446,370,492,473,399,4,235,406,174,47,277,218},
+{1,220,22,123,276,45,42,67,33,320,171,104,190,375,400,471,251,483,164,102,108,435,425,31,96,338,464,73,255,119,63,174},
+{1,165,201,340,161,218,247,255,217,280,420,418,251,202,187,506,417,276,401,448,25,207,325,36,262,264,244,136,291,287,44,277},
+{1,79,471,135,67,6,418,472,391,394,20,230,506,56,22,120,193,310,144,116,272,19,463,216,39,102,42,169,348,448,88,240},
+{1,245,410,447,11,284,296,111,69,416,92,336,126,182,157,397,491,344,125,425,170,469,251,159,383,349,430,124,174,76,171,144},
+{1,10,68,11,78,79,69,1,10,68,11,78,79,69,1,10,68,11,78,79,69,1,5,17,85,257,67,335,309,167,152,91},
+{1,162,198,502,510,420,123,21,59,96,285,437,109,456,273,450,15,401,296,230,158,365,14,459,297,34,22,444,280,157,279,263},
+{1,286,411,113,274,94,121,497,459,350,370,404,57,280,46,117,52,451,445,231,179,186,500,430,86,77,25,330,201,99,372,327},
+{1,364,397,231,475,380,66,138,25,287,141,452,210,143,427,383,321,170,304,453,446,258,166,41,423,341,390,44,382,333,228,108},
+{1,491,49,418,123,360,226,426,173,224,193,207,281,55,162,221,478,504,285,92,102,402,25,278,5,192,146,74,101,137,183,294},
+{1,149,43,463,475,483,304,233,32,326,254,423,488,441,460,100,414,430,75,202,217,453,388,495,297,403,75,101,482,437,343,100},
+{1,183,40,114,482,487,349,469,111,374,126,501,7,468,216,350,12,23,480,137,269,305,189,174,304,398,164,394,458,418,499,178},
+{1,53,167,287,26,73,220,495,324,295,500,312,348,260,102,50,44,177,42,15,291,288,466,328,320,404,218,453,456,1,375,159},
+{1,258,160,124,451,89,13,465,63,153,502,256,81,316,315,298,191,459,360,231,196,25,82,285,497,498,113,9,355,360,265,49},
+{1,496,283,470,410,152,253,202,110,328,181,259,405,300,370,188,357,331,92,215,278,379,109,428,230,48,67,91,262,87,212,387},
+{1,160,60,392,83,510,128,48,10,323,408,85,319,8,3,480,68,409,245,259,384,80,15,49,85,287,2,160,30,98,170,319},
+{1,76,433,89,312,401,160,14,219,343,13,15,151,230,84,311,262,70,90,492,81,75,419,154,509,244,277,314,269,377,414,402},
+{1,453,339,76,353,399,403,3,346,224,212,182,388,416,5,251,288,380,474,409,501,15,268,216,506,129,94,406,124,404,441,183},
+{1,428,108,382,212,113,103,393,31,350,389,397,145,238,348,450,341,370,326,446,268,344,166,369,473,461,150,330,22,247,490,140},
+{1,260,175,284,471,315,495,289,444,88,159,207,409,331,475,391,109,317,433,480,434,463,432,114,286,126,320,399,210,72,23,356},
+{1,336,239,13,357,376,81,44,173,172,508,275,286,123,259,338,382,467,383,131,400,142,482,485,396,483,333,227,28,420,444,393},
+{1,434,75,491,60,188,371,332,29,435,505,416,471,128,463,63,337,430,74,89,119,343,314,124,227,367,315,165,63,309,502,346},
+{1,187,500,487,44,426,297,212,395,414,134,227,489,252,388,501,348,472,77,261,382,162,165,145,482,153,71,56,416,46,110,98},
+{1,98,15,369,85,227,76,96,203,367,504,73,394,248,11,249,105,246,280,163,507,239,362,9,441,206,485,161,312,328,213,97},
+{1,413,406,494,467,509,124,255,192,143,377,381,447,337,95,421,231,279,432,491,140,133,78,408,457,392,77,358,202,181,409,170},
+{1,227,208,138,118,97,380,169,249,25,492,22,510,261,218,150,404,134,321,2,454,416,138,59,192,415,396,372,265,326,229,333},
+{1,407,214,95,446,440,375,232,298,275,318,218,449,491,343,261,178,393,78,362,418,357,247,423,60,152,303,7,172,317,132,244},
+{1,410,316,364,135,493,385,62,13,76,408,357,121,306,227,310,81,113,86,256,312,478,224,460,30,21,496,52,152,408,260,197},
+{1,139,510,489,450,64,215,338,263,237,178,387,28,123,444,40,31,486,205,352,298,294,218,284,42,317,319,436,331,84,265,269},
+{1,341,200,94,45,124,430,107,464,16,43,380,97,431,318,280,78,6,256,463,452,238,132,377,335,78,3,64,86,380,399,180},
+{1,275,439,161,198,6,352,317,67,273,20,74,388,394,364,120,444,407,435,98,272,263,316,168,491,102,299,213,477,473,122,461},
+{1,59,468,424,33,69,43,491,144,455,474,234,212,471,485,466,306,72,292,237,117,106,150,361,143,391,147,197,302,358,500,235},
+{1,156,484,405,283,449,212,511,52,475,489,219,393,207,94,244,499,486,173,370,330,323,238,103,480,34,154,342,411,296,487,456},
+{1,54,459,248,492,464,455,400,294,303,169,494,444,484,96,331,314,146,379,69,15,306,145,330,134,187,369,278,40,13,175,173},
+{1,172,374,369,396,188,409,502,379,383,118,357,106,296,97,375,477,250,461,21,330,226,408,173,237,307,436,19,337,41,432,331},
+{1,303,191,260,453,62,179,27,335,213,285,275,405,97,325,166,466,110,236,493,498,72,211,475,438,411,400,318,290,420,350,279},
+{1,97,296,426,447,476,54,7,295,78,11,96,329,130,21,99,490,49,288,361,69,107,369,128,398,126,165,287,230,108,7,374},
+{1,9,65,388,349,214,508,296,198,364,367,372,439,246,220,422,111,218,400,489,405,452,104,404,256,215,284,169,219,298,106,413},
+{1,410,118,408,151,372,114,90,335,190,507,501,135,470,184,216,193,424,369,42,500,285,208,72,134,38,473,40,352,137,82,143},
+{1,377,229,372,212,326,180,9,446,127,475,454,121,383,65,243,94,103,146,104,392,400,384,327,266,59,239,76,97,27,353,214},
+{1,495,93,239,453,167,343,446,60,341,387,134,139,490,456,454,373,432,143,400,188,409,290,203,198,391,126,135,178,149,425,62},
+{1,388,301,114,270,163,467,465,304,131,103,402,212,155,208,345,95,145,92,500,194,354,488,303,445,213,379,133,162,479,63,210},
+{1,352,130,199,212,333,241,479,500,305,222,151,488,415,266,473,322,454,439,404,432,66,287,123,257,332,309,340,89,419,272,285},
+};
+
+static const uint16_t prescr_table_31_9689[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1},
+{1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,6,5,2,3,7,1,4,6,5,2,3,7,1,4},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,13,15,14,7,10,5,11,12,6,3,8,4,2},
+{1,9,14,3,2,11,5,6,4,15,10,12,8,7,13,1,9,14,13,12,4,11,14,13,12,4,11,14,13,12,4,11},
+{1,10,6,2,11,12,4,9,7,8,13,14,15,5,3,1,10,6,1,5,14,8,9,12,2,10,3,15,13,7,4,11},
+{1,10,14,3,30,18,5,7,19,15,9,16,17,27,21,22,8,26,29,6,30,9,8,13,28,3,15,22,4,20,14,19},
+{1,10,22,17,14,23,27,24,6,21,15,29,13,9,8,2,20,5,17,7,27,12,21,19,13,16,2,10,11,14,31,24},
+{1,10,26,6,19,2,20,27,12,9,4,7,25,24,18,8,14,29,24,9,2,10,13,22,16,14,25,12,19,1,5,17},
+{1,10,29,14,2,20,13,28,4,31,26,15,8,9,3,30,16,18,3,15,4,20,29,7,27,25,19,6,30,8,31,13},
+{1,10,9,23,12,14,26,8,29,5,25,22,6,7,13,4,19,31,21,12,7,27,1,5,17,24,14,13,2,10,25,11},
+{1,10,3,30,5,31,15,28,17,25,14,22,18,7,11,9,29,27,13,4,20,3,15,14,11,26,8,21,6,30,28,22},
+{1,2,4,8,16,32,3,6,12,24,48,35,5,10,20,40,19,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38},
+{1,26,41,61,10,63,62,36,13,48,58,5,59,31,18,34,24,29,19,28,30,4,52,41,58,38,56,60,8,33,27,61},
+{1,40,59,44,53,57,43,20,54,22,49,55,62,10,27,11,51,48,36,63,17,8,14,33,44,49,48,36,63,17,8,14},
+{1,26,40,36,42,16,33,3,46,35,55,37,48,56,5,41,62,2,26,20,9,62,1,13,10,41,31,45,43,5,57,34},
+{1,46,10,11,37,47,36,1,46,10,11,37,47,36,1,46,10,11,34,35,52,6,19,15,31,41,1,23,50,21,28,16},
+{1,45,44,1,45,44,1,45,44,1,45,44,1,45,44,1,45,44,51,33,54,57,17,31,18,23,15,40,14,13,5,24},
+{1,4,16,45,3,12,48,26,5,20,61,46,15,60,42,31,17,41,63,19,38,33,47,51,11,22,44,53,7,14,28,56},
+{1,52,7,25,21,60,24,33,59,1,52,7,25,21,60,24,33,59,57,13,55,20,4,27,7,53,32,62,56,23,42,60},
+{1,20,46,36,51,33,2,40,41,61,19,55,4,37,39,15,38,27,4,40,46,18,43,48,52,28,50,32,11,59,15,19},
+{1,26,66,35,100,53,29,4,104,14,15,21,87,116,16,37,56,60,42,87,58,4,52,66,80,25,54,88,113,49,123,67},
+{1,51,95,13,117,100,81,45,121,34,106,113,33,63,25,54,41,60,38,83,97,87,7,8,69,55,13,126,25,27,40,67},
+{1,87,122,72,83,56,49,109,106,94,38,79,103,64,88,69,77,70,90,50,74,57,51,38,96,58,8,66,123,72,110,14},
+{1,95,19,42,39,11,93,60,12,115,69,75,23,116,107,50,80,16,45,76,84,39,77,51,79,108,14,46,116,125,68,10},
+{1,120,124,59,108,29,10,126,86,9,107,79,68,66,104,90,93,15,110,56,114,1,60,31,125,111,4,109,124,83,27,16},
+{1,98,67,92,52,113,47,120,40,24,8,101,35,124,73,90,54,18,7,48,8,97,33,92,26,102,17,84,123,71,77,78},
+{1,36,30,66,2,72,60,47,4,59,120,94,8,118,91,23,16,71,91,94,4,72,30,33,85,9,41,110,53,107,111,39},
+{1,45,82,7,122,117,21,20,57,107,108,22,99,118,98,91,48,92,37,36,110,38,67,15,48,46,78,18,55,19,125,91},
+{1,119,9,77,65,102,10,107,90,14,118,126,68,12,39,108,97,49,42,30,1,100,114,110,24,39,54,104,62,117,44,56},
+{1,24,3,40,5,120,15,73,17,26,51,46,85,114,62,87,66,56,99,18,25,109,90,125,91,113,11,116,55,39,38,42},
+{1,98,66,121,107,28,90,61,3,109,13,64,118,36,37,71,5,124,110,48,68,52,75,118,18,94,116,112,127,61,100,76},
+{1,69,127,81,60,22,26,106,87,4,97,90,49,35,88,104,14,41,8,97,45,81,30,108,94,40,67,74,96,102,122,83},
+{1,101,96,59,113,115,108,121,15,56,11,6,33,63,79,89,85,23,94,98,18,25,26,39,15,28,93,95,58,10,91,37},
+{1,103,7,26,21,70,107,24,62,72,95,50,87,123,111,78,34,32,119,56,104,42,70,71,6,76,118,121,34,16,73,28},
+{1,73,2,125,4,21,8,42,16,84,32,71,64,97,111,45,49,90,49,45,111,97,64,71,32,84,16,42,8,21,4,125},
+{1,67,38,97,88,80,110,77,112,103,48,117,59,127,114,16,124,70,61,115,81,110,94,28,86,3,26,98,54,118,127,57},
+{1,87,114,122,7,75,71,127,21,31,59,100,107,93,86,37,8,125,38,3,7,94,44,17,45,65,74,8,69,19,122,120},
+{1,84,103,118,121,124,127,126,42,77,59,66,62,65,63,21,88,99,110,70,74,72,28,81,50,92,26,80,24,4,85,103},
+{1,136,218,242,110,250,66,112,147,45,2,11,175,255,220,239,132,224,147,155,141,34,208,231,84,151,144,87,91,70,51,184},
+{1,141,66,231,201,172,191,13,159,125,55,204,47,232,81,85,91,78,244,179,129,40,54,174,92,101,135,162,85,163,157,61},
+{1,2,4,8,16,32,64,128,43,86,172,115,230,231,229,225,233,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249},
+{1,21,60,123,201,251,86,218,185,165,36,174,179,39,145,247,170,231,253,20,130,204,93,176,12,126,68,208,139,4,42,60},
+{1,136,103,236,42,111,72,89,160,33,106,146,155,183,163,128,195,159,238,157,102,50,93,121,33,53,184,122,237,81,2,136},
+{1,242,204,93,91,9,223,46,203,253,65,165,97,17,168,55,78,40,211,69,22,4,219,204,177,89,105,30,141,124,145,3},
+{1,221,139,145,123,67,114,149,216,245,172,52,153,112,98,131,154,90,89,76,120,146,142,209,183,167,172,26,117,14,137,51},
+{1,65,141,107,223,22,234,89,8,182,75,185,101,176,146,118,64,204,115,45,101,88,139,89,4,130,141,154,96,85,221,74},
+{1,137,37,49,254,252,141,199,165,58,161,216,53,28,104,73,154,240,100,6,248,134,76,201,249,115,172,10,107,233,212,56},
+{1,173,105,176,219,84,93,12,130,38,30,32,95,51,80,35,205,136,192,225,152,60,32,157,231,10,211,84,156,3,73,197},
+{1,110,22,242,125,91,193,167,122,56,163,171,96,208,54,101,111,120,114,205,234,144,140,74,40,46,156,129,112,163,225,24},
+{1,151,188,77,76,219,103,42,102,189,218,240,150,43,241,1,151,188,158,19,105,99,74,29,31,136,214,153,40,164,45,8},
+{1,98,237,140,199,11,47,26,40,67,69,126,254,79,51,9,235,183,152,149,159,2,98,205,35,54,74,87,212,100,107,3},
+{1,146,33,142,150,159,10,88,49,128,112,42,68,134,145,236,237,127,47,52,86,214,238,89,236,203,65,85,13,168,136,134},
+{1,126,155,209,184,165,33,136,40,8,254,77,148,210,58,143,213,199,32,123,77,74,247,165,211,34,5,195,220,224,230,100},
+{1,52,42,239,245,224,82,237,157,180,7,140,214,16,86,61,53,30,167,195,81,157,90,99,212,60,197,13,162,177,180,198},
+{1,93,199,181,98,41,83,251,188,64,226,96,147,80,28,120,18,68,203,223,26,219,160,28,60,194,206,141,73,96,143,20},
+{1,136,247,169,170,173,43,79,46,70,59,234,152,82,31,190,137,127,47,103,51,244,87,11,77,159,106,121,40,36,42,172},
+{1,210,188,57,134,106,139,170,8,28,42,107,89,22,49,154,64,224,168,214,89,11,181,170,4,7,188,205,240,180,195,43},
+{1,114,39,173,74,146,8,194,145,158,171,207,64,180,215,175,174,220,169,193,215,131,255,207,32,45,145,79,148,146,4,228},
+{1,136,129,94,192,189,185,74,157,84,54,17,38,191,24,249,33,101,166,236,122,111,221,199,235,23,58,130,227,228,137,220},
+{1,46,103,24,234,198,253,43,241,94,146,254,89,88,118,17,9,227,204,54,152,233,90,21,134,238,63,55,143,65,89,44},
+{1,3,5,15,17,51,85,255,194,133,76,212,191,2,6,10,30,34,51,203,79,137,44,58,39,213,94,113,168,252,130,195},
+{1,146,49,62,108,188,57,12,43,131,199,129,44,227,80,59,231,73,152,116,117,60,164,208,165,153,61,237,72,209,236,1},
+{1,136,15,164,85,215,173,111,160,12,235,68,236,82,193,128,189,220,40,234,102,77,107,151,12,158,17,246,74,96,2,136},
+{1,189,45,131,159,220,106,166,231,246,96,250,8,251,181,214,54,73,117,145,231,123,24,104,238,88,62,89,142,37,60,228},
+{1,5,17,85,230,176,89,218,124,107,32,160,9,45,153,212,74,133,92,150,128,167,9,229,172,233,178,218,62,99,4,10},
+{1,136,245,27,213,64,182,198,255,146,168,174,120,83,9,226,145,195,33,144,220,81,117,66,211,75,162,234,132,85,150,183},
+{1,239,153,77,190,112,169,79,149,183,51,198,117,16,173,25,238,118,106,187,158,149,161,139,159,24,250,188,215,225,36,134},
+{1,172,223,108,109,193,30,114,31,222,192,178,173,115,179,1,172,223,54,101,39,188,28,149,22,130,194,245,198,84,25,98},
+{1,46,82,304,284,274,134,505,208,113,132,421,116,18,191,386,376,483,398,88,14,202,223,484,491,310,252,318,68,410,372,276},
+{1,510,267,236,129,322,203,374,48,304,72,473,252,414,378,124,290,186,243,488,25,179,455,33,480,466,180,299,361,184,269,101},
+{1,218,267,109,398,317,199,405,360,449,180,491,90,510,45,255,285,372,457,293,254,488,154,61,413,459,511,368,125,46,451,128},
+{1,401,416,198,151,31,439,419,110,108,341,14,386,172,146,487,186,102,95,133,65,150,199,131,233,486,408,380,15,260,67,263},
+{1,127,31,311,341,131,223,326,401,270,103,85,63,48,148,49,235,46,238,454,503,146,393,162,451,38,274,504,192,296,49,357},
+{1,16,256,360,415,44,237,19,304,69,10,160,153,292,261,312,197,190,426,446,286,68,13,104,365,497,331,193,127,469,107,373},
+{1,490,347,451,9,35,380,322,65,315,99,429,122,47,328,111,409,343,482,73,121,17,316,464,459,224,1,245,218,126,233,265},
+{1,109,212,485,335,196,488,437,374,413,79,20,441,481,251,479,161,31,307,56,154,206,301,24,151,179,100,205,83,71,446,113},
+{1,95,452,488,232,235,10,31,126,326,123,101,68,198,341,472,375,443,340,495,406,215,36,508,107,447,490,43,354,237,228,155},
+{1,396,448,97,311,127,24,185,248,422,332,182,320,453,316,278,410,333,157,32,283,413,388,49,127,12,406,31,382,366,204,301},
+{1,292,397,25,248,178,321,300,313,303,48,477,27,213,461,371,220,93,228,154,160,2,292,500,159,31,373,359,247,408,309,466},
+{1,396,350,319,301,25,223,112,475,121,321,26,34,507,243,359,362,379,89,465,15,176,71,177,129,466,325,380,98,323,385,403},
+{1,111,412,67,437,441,274,81,298,389,378,192,355,505,22,291,253,356,122,7,433,309,239,458,50,313,397,257,359,277,174,72},
+{1,316,435,277,67,211,284,323,458,381,367,280,349,415,455,99,35,451,261,294,252,325,470,424,49,218,14,301,320,327,234,74},
+{1,293,474,102,307,59,379,128,206,44,447,71,283,490,211,3,274,19,85,74,70,31,12,89,19,85,74,70,31,12,89,19},
+{1,168,152,316,150,5,143,127,194,73,17,52,387,333,365,85,228,6,504,212,209,469,363,145,237,112,490,50,122,357,334,265},
+{1,346,421,30,495,433,340,322,41,347,255,443,497,94,229,22,363,370,210,81,172,97,288,393,356,301,327,466,208,267,308,300},
+{1,479,480,183,391,308,100,379,346,406,302,296,216,426,129,161,434,234,353,11,171,465,223,398,494,312,450,269,301,232,190,251},
+{1,27,325,128,233,204,376,92,33,472,374,222,254,317,270,336,327,182,96,115,492,485,213,340,452,57,88,375,307,198,203,461},
+{1,399,18,280,260,375,143,182,479,152,498,129,477,291,470,20,368,360,100,94,418,343,438,495,492,502,169,204,263,499,135,392},
+{1,398,3,61,5,71,15,201,17,347,51,322,85,361,255,276,257,403,214,337,265,87,109,450,134,454,309,453,124,56,33,18},
+{1,416,228,309,71,294,26,504,195,47,287,417,324,465,370,353,316,482,454,59,38,93,111,448,108,176,39,141,86,70,67,356},
+{1,494,32,325,378,461,490,95,453,276,351,281,48,185,455,117,287,302,354,313,484,385,174,315,10,401,80,443,61,235,488,159},
+{1,123,498,117,511,245,422,51,430,292,156,67,454,186,155,290,390,497,124,302,473,369,311,120,472,43,44,507,491,252,101,143},
+{1,166,297,455,334,463,476,274,258,38,412,32,153,421,425,370,169,24,219,389,152,489,32,292,221,111,77,463,238,300,148,236},
+{1,229,427,143,451,301,492,28,384,241,110,295,99,200,336,366,48,414,304,297,316,428,282,9,80,337,424,208,418,378,407,352},
+{1,422,371,142,252,339,125,460,36,372,278,442,12,124,106,343,506,490,270,161,54,231,218,207,94,144,29,278,221,3,373,88},
+{1,482,31,431,341,511,141,196,269,289,334,211,420,140,294,274,142,27,150,244,9,114,507,7,46,169,426,26,103,305,417,394},
+{1,502,472,399,143,290,149,16,362,139,248,503,46,87,256,429,439,133,189,184,174,256,342,301,496,503,23,341,32,362,453,62},
+{1,282,490,310,412,139,143,466,92,433,487,216,503,153,489,267,177,194,156,215,159,320,409,102,254,270,123,416,94,75,72,479},
+{1,78,407,491,404,313,56,17,401,79,473,124,127,173,257,41,384,478,203,172,301,485,288,102,422,482,469,410,252,227,75,506},
+{1,431,105,231,197,437,59,204,286,5,301,461,100,206,351,215,227,71,391,46,123,343,358,45,140,446,487,8,130,210,231,493},
+{1,9,65,362,240,310,367,221,115,200,206,248,382,68,327,437,145,380,43,296,337,280,393,311,179,39,286,402,199,461,5,391},
+{1,346,171,115,362,415,73,429,248,193,217,67,94,421,142,202,112,437,49,55,232,398,359,68,93,189,264,313,270,486,104,271},
+{1,412,338,507,155,331,115,471,161,364,474,311,49,436,366,473,168,252,65,254,477,87,365,35,330,362,370,376,226,468,159,315},
+{1,470,499,466,57,140,483,104,154,374,314,87,313,356,101,91,46,463,161,299,441,200,397,330,213,148,66,491,510,301,138,102},
+{1,360,269,349,279,484,461,128,83,189,171,129,315,432,502,406,223,125,187,261,376,451,198,446,125,187,261,376,451,198,446,125},
+{1,18,260,17,306,70,257,75,459,19,278,277,291,372,327,330,384,472,303,214,208,230,352,442,262,439,355,417,453,474,317,84},
+{1,70,90,464,266,39,309,384,263,40,438,439,497,427,123,369,342,99,321,57,425,459,169,310,165,162,75,410,316,507,59,495},
+{1,324,377,192,405,119,170,83,210,425,138,134,369,410,295,161,430,128,426,419,428,260,476,340,83,105,261,382,101,75,414,197},
+{1,354,469,287,367,246,309,320,388,28,189,285,198,49,102,243,104,283,168,94,370,290,164,456,96,260,147,304,440,282,25,240},
+{1,246,392,415,497,183,228,443,407,167,315,464,140,442,353,303,164,33,420,494,382,434,418,244,50,127,398,108,85,12,327,491},
+{1,159,450,55,330,218,148,282,413,171,297,468,391,353,103,13,229,167,278,332,460,262,53,58,360,383,87,333,60,201,92,289},
+{1,77,488,45,42,457,222,29,203,315,164,247,259,424,337,17,18,197,188,352,412,66,243,473,386,76,272,144,145,373,271,378},
+{1,107,287,494,413,507,500,50,427,508,229,113,176,446,405,300,46,382,120,6,189,87,331,37,138,97,143,325,308,364,196,419},
+{1,29,337,455,93,339,509,350,380,327,89,295,90,256,8,232,239,188,372,263,509,175,95,356,495,90,128,2,29,376,329,431},
+{1,353,486,82,354,496,461,404,483,104,118,234,504,206,112,198,371,290,43,227,205,51,187,70,197,360,194,20,116,276,141,224},
+{1,362,220,155,40,72,168,95,139,367,213,142,358,192,448,494,424,113,442,497,122,262,16,383,201,310,40,36,42,334,68,90},
+{1,84,52,396,345,483,42,26,198,335,274,21,13,99,324,137,489,485,233,459,76,45,219,497,294,303,85,48,110,368,353,44},
+{1,233,229,84,181,142,100,442,193,136,473,47,313,253,310,375,248,432,259,127,276,11,279,371,430,137,152,471,166,481,255,114},
+{1,130,291,212,153,108,363,358,102,40,347,244,389,302,468,215,287,196,493,192,233,483,131,310,360,112,469,460,15,2,130,375},
+{1,343,385,257,307,349,361,351,18,392,453,59,170,316,449,280,260,327,185,283,148,241,478,337,262,30,156,466,265,80,117,188},
+{1,236,149,188,19,144,57,267,261,102,2,472,298,376,38,288,114,463,261,51,492,59,389,273,313,244,285,136,331,511,115,381},
+{1,192,295,75,314,449,209,392,107,484,44,507,38,445,249,144,244,373,12,355,138,415,290,52,41,236,110,274,413,482,342,195},
+{1,381,226,60,138,454,363,208,29,43,453,261,502,89,437,102,337,134,63,114,56,342,359,180,475,160,191,35,217,383,268,126},
+{1,345,462,65,11,313,53,304,69,354,503,305,284,172,438,314,37,153,67,161,426,404,109,113,376,31,257,14,377,334,143,378},
+};
+
+static const uint16_t prescr_table_31_9941[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,2,3,1,2,3,1,2,3,1,2},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,11,9,12,13,6,15,3,14,8,7,4,10,2,5,1,11,9,12,13,6,15,8,10,1,12,15,8,10,1,12,15},
+{1,5,8,3,15,1,5,8,3,15,1,5,8,3,15,1,5,8,3,15,1,5,4,10,8,13,9,3,11,6,15,12},
+{1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,15,14,13,8,12,10,15,7,11,1,14,9,2,3},
+{1,2,4,8,16,5,10,20,13,26,17,7,14,28,29,31,27,19,3,6,12,24,24,24,24,24,24,24,24,24,24,24},
+{1,6,20,3,10,21,5,30,22,15,11,19,17,29,28,26,14,13,7,18,23,9,27,4,12,20,21,22,19,28,13,23},
+{1,25,22,2,29,3,4,21,6,8,5,12,16,10,24,15,20,31,30,7,17,19,7,31,15,10,12,8,21,3,2,25},
+{1,30,7,3,21,9,5,8,27,15,24,26,17,31,25,4,22,28,12,13,19,20,16,27,28,6,21,31,23,1,15,12},
+{1,21,30,19,22,26,10,24,27,31,6,8,9,28,2,17,7,29,23,15,20,11,27,18,28,1,23,26,5,6,4,17},
+{1,9,6,11,20,7,2,18,12,22,21,14,4,25,24,17,23,28,8,15,13,31,23,14,2,9,3,19,28,4,18,6},
+{1,39,37,40,33,50,51,20,49,25,56,10,57,45,28,5,61,55,14,35,63,58,34,12,23,44,60,8,26,9,40,49},
+{1,27,40,15,11,46,28,32,12,38,31,13,61,55,2,54,25,30,22,21,56,9,12,19,49,44,21,28,16,3,50,30},
+{1,43,62,31,36,18,9,47,60,30,15,44,22,11,46,23,32,16,8,4,2,1,62,36,9,60,15,22,46,32,8,2},
+{1,62,9,20,26,2,39,18,40,52,4,21,36,11,51,8,42,19,22,61,16,15,19,11,52,2,62,41,5,56,48,37},
+{1,40,30,56,18,61,57,58,35,1,40,30,56,18,61,57,58,35,1,40,30,56,9,23,11,63,4,49,30,28,52,59},
+{1,48,47,50,40,11,43,60,61,13,34,16,56,51,24,36,25,20,54,38,30,45,41,46,1,24,18,44,49,60,45,41},
+{1,4,16,45,3,12,48,26,5,20,61,46,15,60,42,31,17,41,19,33,51,22,44,53,7,14,28,56,29,58,25,50},
+{1,9,50,29,19,30,8,59,47,14,13,22,51,20,33,3,27,37,39,53,34,24,31,57,39,35,49,3,52,44,51,10},
+{1,58,29,52,26,13,60,30,15,61,36,18,9,62,31,53,32,16,8,4,2,1,29,26,60,15,36,9,31,32,8,2},
+{1,63,75,93,37,49,55,54,9,66,31,58,11,60,10,3,65,94,100,111,83,89,45,38,56,123,107,22,60,5,32,121},
+{1,37,89,32,97,15,72,113,123,11,85,7,114,20,105,53,45,99,69,115,49,48,78,19,73,42,76,54,33,34,81,13},
+{1,127,66,106,117,102,77,92,6,28,29,98,32,74,63,89,20,72,78,82,79,45,65,50,15,27,63,107,5,9,21,92},
+{1,114,91,97,3,7,124,50,5,9,21,86,15,27,63,107,17,45,65,44,51,119,41,29,80,72,84,61,15,69,99,59},
+{1,73,50,26,75,61,126,127,54,4,30,85,104,22,105,95,91,69,16,120,110,7,44,105,97,127,27,1,106,66,36,119},
+{1,38,98,127,67,72,92,56,52,117,113,78,47,58,120,22,40,111,24,37,8,126,97,89,67,36,23,7,121,24,65,2},
+{1,19,83,54,107,4,76,26,115,81,16,102,104,49,18,64,101,93,111,72,86,105,17,111,36,64,103,104,77,81,8,76},
+{1,2,4,8,16,32,64,57,114,93,3,6,12,24,48,96,121,75,47,94,5,10,10,10,10,10,10,10,10,10,10,10},
+{1,47,108,45,50,74,104,46,67,65,31,120,34,70,109,2,94,103,90,100,43,111,46,126,96,20,88,29,19,97,92,67},
+{1,103,37,72,94,55,63,3,104,111,25,35,89,65,5,121,112,43,101,42,2,15,37,36,119,78,71,10,121,56,90,116},
+{1,49,117,65,10,124,110,48,68,52,75,118,18,94,116,112,127,61,100,76,42,4,98,117,69,103,106,122,100,38,111,101},
+{1,108,76,47,62,10,39,18,83,42,68,3,103,7,113,66,30,105,54,38,126,31,107,119,70,4,11,76,126,102,92,82},
+{1,53,56,14,105,47,84,21,48,12,3,95,72,18,110,113,41,63,80,20,5,52,108,103,35,65,120,15,46,90,62,88},
+{1,20,63,125,35,7,108,88,92,12,21,43,66,94,36,107,52,4,80,25,62,105,14,108,44,23,115,15,102,104,4,40},
+{1,45,122,78,29,114,23,113,96,16,93,55,36,14,88,65,104,73,49,37,35,34,112,81,109,104,83,64,85,55,18,116},
+{1,87,37,70,93,21,55,54,97,68,2,95,74,125,75,42,110,108,51,121,4,79,74,70,86,57,92,33,124,14,71,5},
+{1,26,93,58,54,121,57,24,105,119,66,21,60,106,89,82,91,102,22,18,122,23,4,52,93,29,118,44,18,61,56,1},
+{1,73,49,39,26,88,9,15,67,24,55,107,65,119,85,37,117,58,71,59,14,10,106,4,111,49,109,120,11,48,55,75},
+{1,175,163,38,243,64,120,85,67,146,171,41,156,107,161,99,174,12,133,213,179,56,155,136,242,250,112,45,11,255,239,224},
+{1,135,6,53,20,190,120,163,13,237,46,84,228,229,98,100,81,69,251,131,32,45,96,181,80,97,120,223,68,62,102,33},
+{1,197,18,46,47,234,248,214,249,19,235,61,196,215,60,1,197,18,46,47,234,248,107,225,39,28,26,126,101,236,24,187},
+{1,121,82,192,163,239,248,233,195,40,25,149,33,223,13,15,253,89,244,159,108,177,39,114,51,63,4,242,82,96,245,115},
+{1,206,168,50,131,108,217,69,34,118,111,178,132,116,202,219,224,75,18,80,106,15,127,191,243,246,52,182,231,181,78,203},
+{1,21,46,8,168,79,64,131,6,126,228,48,177,157,191,75,20,59,38,160,231,15,254,241,15,254,241,15,254,241,15,254},
+{1,162,67,198,172,124,131,113,23,241,205,35,59,87,156,164,88,1,162,67,198,172,62,213,129,60,119,6,171,196,244,152},
+{1,4,16,64,95,35,140,142,134,166,38,152,222,153,218,137,154,214,185,90,55,220,231,145,125,250,171,9,18,36,72,144},
+{1,221,79,53,76,49,157,110,73,61,141,143,86,200,162,58,88,1,221,79,53,76,169,206,85,102,68,120,80,96,64,161},
+{1,76,59,45,209,84,160,143,198,228,30,86,56,249,156,35,182,115,67,16,49,31,13,235,168,160,245,131,174,116,97,117},
+{1,229,189,125,27,164,122,114,44,96,51,235,111,4,47,38,157,108,66,129,161,176,192,51,193,245,180,99,142,75,29,20},
+{1,49,197,182,255,217,8,249,127,116,222,159,64,238,107,51,167,77,226,86,203,233,126,154,226,43,214,51,235,79,64,119},
+{1,205,108,43,185,48,238,248,226,120,220,251,194,204,161,71,146,137,222,22,26,154,82,84,116,46,215,123,126,78,57,7},
+{1,173,152,226,101,190,103,159,44,32,230,39,40,98,112,34,199,108,151,168,119,236,65,13,136,245,108,246,42,156,80,98},
+{1,219,101,155,89,44,184,173,27,33,197,253,40,218,190,254,194,117,148,21,182,58,114,14,136,94,82,1,174,187,224,45},
+{1,45,224,208,7,195,61,173,21,212,179,85,107,177,15,32,154,1,45,224,208,7,164,168,70,237,85,240,139,245,2,45},
+{1,235,145,75,224,192,94,242,212,167,119,102,194,5,93,66,234,122,218,171,32,158,86,207,154,13,94,121,53,70,46,73},
+{1,113,9,199,65,131,232,70,75,215,178,19,96,139,94,14,15,126,119,176,241,114,77,55,33,4,226,9,172,184,236,193},
+{1,112,205,178,74,154,210,168,67,44,251,64,188,15,53,98,2,224,57,199,148,151,210,84,120,212,196,2,112,183,253,176},
+{1,18,173,102,8,144,158,98,64,223,175,66,251,92,142,235,213,27,47,85,12,216,188,170,12,108,94,85,6,54,47,254},
+{1,179,98,110,79,4,31,57,9,141,16,124,228,36,231,64,65,242,144,254,177,181,85,144,127,64,248,228,18,141,8,31},
+{1,35,54,110,154,229,171,98,179,48,164,46,60,141,251,51,193,116,142,158,105,115,237,7,170,254,78,186,91,150,102,193},
+{1,221,136,18,55,132,199,152,92,96,103,49,15,113,244,238,254,176,231,4,242,101,36,55,66,65,19,117,3,82,102,118},
+{1,221,189,9,198,56,65,5,55,24,45,64,216,138,17,235,120,153,143,38,243,85,139,102,242,68,25,120,171,80,119,96},
+{1,30,131,77,74,16,55,3,34,82,215,222,48,89,5,102,246,174,181,80,235,15,85,173,160,235,236,193,189,80,158,118},
+{1,112,145,30,179,22,137,80,121,219,201,93,46,47,95,206,208,99,117,252,172,213,7,168,100,124,91,135,165,161,65,208},
+{1,255,218,96,153,104,253,195,51,89,189,45,222,82,63,15,176,132,9,155,113,174,242,202,84,10,205,62,120,233,239,9},
+{1,25,178,105,104,113,195,170,194,179,112,218,24,171,219,1,25,178,105,104,113,195,85,201,40,7,222,62,228,232,190,155},
+{1,90,73,204,185,154,162,208,128,178,187,46,48,189,7,115,10,123,197,44,132,47,53,61,160,50,254,88,132,237,224,228},
+{1,51,234,141,147,154,200,150,101,120,36,177,129,62,116,137,95,192,247,209,6,170,199,55,19,183,233,108,21,226,118,139},
+{1,92,328,396,472,115,432,2,184,147,283,435,230,355,4,368,294,53,357,460,197,8,368,147,396,236,156,54,449,133,395,38},
+{1,341,349,416,285,123,215,286,405,289,495,163,428,150,400,258,484,432,231,257,10,70,11,385,478,508,339,72,147,465,198,464},
+{1,8,64,23,184,494,277,244,409,186,510,405,218,233,369,451,125,511,413,154,254,457,285,90,360,398,1,4,16,64,256,46},
+{1,476,297,300,429,22,444,136,198,423,276,209,455,181,315,461,439,86,130,452,202,91,81,208,256,103,332,6,127,176,221,272},
+{1,125,27,253,325,443,121,495,145,144,237,246,11,334,245,140,355,498,354,399,377,370,30,186,348,222,338,429,98,137,117,233},
+{1,143,431,317,106,164,148,88,374,201,432,219,234,169,40,170,441,118,211,200,319,372,509,429,263,205,454,4,286,431,392,268},
+{1,320,332,213,284,134,188,193,388,238,33,143,259,274,428,478,241,437,415,28,103,247,48,257,457,205,279,197,113,110,164,224},
+{1,202,27,201,325,228,30,352,306,322,217,95,340,308,437,131,162,23,295,497,286,211,163,331,79,39,33,383,76,136,413,285},
+{1,474,444,473,395,324,441,384,44,274,245,358,410,121,105,142,226,53,368,275,303,218,269,336,322,455,258,9,366,334,425,415},
+{1,233,155,139,390,330,134,317,388,152,432,43,215,83,188,14,384,355,387,88,46,453,338,17,242,130,99,250,377,341,113,442},
+{1,266,275,48,82,135,458,91,73,469,491,238,416,330,8,452,268,384,245,242,363,189,292,463,491,119,104,176,306,368,453,3},
+{1,466,299,509,463,498,428,100,122,188,505,60,396,227,483,265,183,105,468,277,444,275,193,352,389,95,13,215,240,369,227,453},
+{1,332,288,506,185,127,104,308,285,415,156,160,393,140,425,241,310,490,432,263,466,375,46,348,291,279,346,152,167,238,475,196},
+{1,483,140,118,501,146,53,312,408,466,161,425,511,382,419,19,232,136,355,434,330,376,440,83,256,318,158,389,474,126,212,7},
+{1,86,129,392,210,7,418,506,66,67,21,148,284,462,457,107,401,467,400,389,273,13,479,316,381,31,324,59,114,72,17,230},
+{1,147,211,502,485,507,43,498,302,48,122,495,331,156,59,89,395,372,14,123,380,408,181,308,470,26,462,327,419,474,503,187},
+{1,70,406,210,448,14,305,261,342,212,84,80,328,175,370,461,501,27,293,343,146,450,65,34,268,400,163,301,249,215,79,496},
+{1,292,46,113,358,321,457,497,464,43,247,496,244,5,134,150,437,460,375,326,414,315,271,288,198,148,178,100,301,295,417,490},
+{1,126,76,191,14,87,363,415,84,489,331,405,507,434,139,505,334,19,135,338,189,242,310,508,100,243,265,495,374,502,482,77},
+{1,289,132,153,408,178,201,182,263,3,454,396,427,13,470,347,474,428,5,239,49,88,345,460,41,219,67,333,18,24,247,445},
+{1,276,479,437,292,218,24,469,385,303,506,460,320,369,352,274,86,41,452,499,107,389,327,246,227,93,467,4,135,479,397,73},
+{1,421,245,265,326,278,36,505,167,454,369,237,382,469,371,272,148,368,328,395,220,53,3,44,234,366,412,402,135,185,475,247},
+{1,235,344,492,187,484,36,464,202,370,100,82,362,453,14,88,35,508,389,396,504,148,203,402,79,454,455,236,186,473,95,345},
+{1,84,57,345,223,267,286,196,326,450,307,19,34,276,3,252,75,292,353,466,493,332,485,502,487,418,156,32,222,456,250,446},
+{1,484,123,219,284,497,33,399,509,260,362,491,419,179,103,163,314,96,189,91,176,154,23,457,256,428,477,479,59,366,132,463},
+{1,39,419,13,387,347,81,251,53,326,377,329,180,399,255,169,167,333,40,110,203,456,339,473,277,230,483,61,63,24,420,124},
+{1,229,357,287,488,297,497,405,400,20,271,390,209,182,412,322,397,457,272,401,241,106,310,243,208,339,131,85,41,7,39,73},
+{1,123,116,52,33,269,226,447,499,299,142,17,192,63,397,200,286,212,360,22,417,371,508,457,484,260,220,344,401,95,119,288},
+{1,364,419,152,454,234,127,256,475,414,375,445,345,298,511,438,138,466,404,456,230,426,73,158,86,328,325,153,85,146,316,172},
+{1,34,305,422,154,134,45,207,230,161,438,425,356,454,22,511,354,266,150,286,301,269,60,239,320,404,76,441,418,9,153,112},
+{1,426,506,428,313,143,494,51,473,360,371,129,41,385,58,375,3,491,283,481,94,401,281,208,352,433,4,65,506,214,139,182},
+{1,284,231,3,59,297,5,77,100,15,215,172,17,377,500,51,148,259,85,444,26,255,354,388,132,179,478,446,273,260,272,394},
+{1,114,144,156,487,353,439,250,473,119,298,367,40,348,55,471,488,140,129,392,414,468,191,79,136,309,242,181,501,480,398,89},
+{1,221,306,232,423,83,368,81,202,260,282,379,444,170,286,318,39,59,480,114,180,383,356,128,259,28,373,508,332,465,81,101},
+{1,476,299,413,238,264,339,119,132,308,422,66,154,211,33,77,500,397,443,250,347,320,419,76,20,436,202,338,328,165,289,393},
+{1,334,473,478,422,370,435,26,214,276,338,57,455,491,324,458,384,462,355,56,137,50,77,27,204,225,437,150,256,186,243,317},
+{1,113,266,498,258,309,447,214,322,403,390,445,52,25,312,205,152,5,437,243,164,219,24,259,162,345,387,4,226,266,249,487},
+{1,465,196,461,247,60,404,242,31,283,189,111,471,463,14,436,341,284,103,360,345,81,93,342,26,156,417,4,249,196,331,235},
+{1,271,278,248,87,200,405,219,347,430,310,388,362,355,51,434,72,454,396,309,500,305,389,386,197,173,240,4,383,278,124,381},
+{1,13,81,246,291,283,3,23,243,282,14,70,5,57,277,69,18,202,15,75,84,207,27,482,256,86,479,37,377,201,12,46},
+{1,72,70,219,18,423,347,434,260,315,474,65,291,448,203,293,112,351,146,28,314,402,437,126,225,379,494,284,294,84,190,137},
+{1,286,350,387,492,499,436,213,198,453,403,190,308,367,24,507,285,271,274,26,180,210,189,267,454,225,215,381,443,224,88,147},
+{1,357,73,31,187,473,341,181,83,468,15,239,200,165,7,197,511,93,94,142,85,116,355,331,266,175,204,88,151,167,217,202},
+{1,388,332,214,347,34,323,372,78,63,139,138,270,66,148,463,493,174,474,404,427,288,213,41,319,437,306,224,304,356,406,147},
+{1,27,325,463,274,480,356,315,460,319,416,186,386,99,284,354,353,332,268,210,107,452,308,365,252,3,465,16,216,389,17,274},
+{1,411,128,377,180,186,254,188,327,29,275,4,302,417,263,369,329,89,337,511,116,175,8,302,256,377,90,510,295,307,89,376},
+{1,364,439,510,170,102,34,30,10,6,2,365,219,73,340,204,68,60,20,12,4,367,219,510,85,451,233,154,59,189,495,392},
+{1,384,299,382,72,410,460,451,213,184,111,110,494,197,443,499,105,421,102,179,11,100,5,121,83,418,458,4,185,299,191,18},
+{1,488,343,155,146,294,412,406,477,345,254,259,298,494,366,231,15,397,198,151,224,478,83,48,228,248,157,438,437,169,325,26},
+{1,130,393,344,110,29,406,458,381,27,337,161,315,383,287,392,474,487,325,504,471,235,269,11,256,141,293,338,374,232,462,95},
+{1,261,218,228,319,322,60,28,457,182,403,156,263,285,336,247,241,373,100,497,233,255,477,282,270,79,48,394,495,405,140,483},
+{1,494,229,473,456,110,399,187,142,426,471,503,359,186,352,335,14,63,265,309,475,449,210,122,256,405,111,474,509,165,406,374},
+{1,328,399,133,308,236,275,241,280,447,149,115,358,405,452,188,291,225,95,53,19,326,97,180,54,9,495,446,258,127,177,475},
+{1,5,17,85,257,288,389,87,267,258,303,438,168,491,385,67,335,86,270,275,378,183,196,490,194,485,298,290,310,276,321,48},
+{1,372,163,144,103,154,345,255,194,224,285,236,201,170,475,487,177,495,142,204,53,29,111,422,490,508,438,469,153,150,434,212},
+{1,496,338,463,395,294,10,119,46,497,162,157,68,173,300,125,89,479,339,63,217,233,317,343,505,103,123,58,370,450,493,16},
+};
+
+static const uint16_t prescr_table_31_11213[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3,2,1,3,2,1,3,2,1},
+{1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,2,2,2,2,2,2,2,2,2},
+{1,5,6,4,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2,7,1,5,3,1,4,7,6,2,5,3,1},
+{1,6,7,1,6,7,1,6,7,1,6,7,1,6,7,1,6,7,1,6,7,1,6,10,13,4,12,7,9,8,11,14},
+{1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11,8,2,6,10,7,9,2,6,10,7,9},
+{1,6,11,4,7,13,15,3,10,2,12,9,8,14,5,1,6,11,4,7,13,15,3,5,15,14,13,8,7,9,4,12},
+{1,15,31,20,18,21,29,10,9,24,28,5,22,12,14,16,11,6,7,8,23,3,17,2,15,29,5,11,3,26,1,21},
+{1,28,24,19,8,22,31,21,18,20,14,12,29,4,11,27,30,9,10,7,6,26,2,28,12,26,1,14,6,13,20,7},
+{1,13,15,21,11,14,24,4,27,19,10,3,23,17,16,29,18,7,12,2,26,30,5,11,7,6,23,31,4,26,15,29},
+{1,3,5,15,17,4,12,20,11,29,16,7,9,27,26,25,28,19,2,6,10,30,21,4,6,5,28,18,27,13,16,24},
+{1,20,31,25,23,24,3,7,26,16,2,19,5,9,21,11,6,14,15,27,4,29,10,9,23,12,14,26,8,29,5,25},
+{1,15,18,26,24,6,31,22,27,23,20,5,14,29,8,2,30,25,9,13,12,3,17,27,21,5,7,8,1,25,26,12},
+{1,9,2,18,4,36,8,11,16,22,32,44,3,27,6,54,12,47,24,29,48,58,35,58,48,29,24,47,12,54,6,27},
+{1,6,20,49,52,42,39,9,54,38,15,34,23,59,8,48,50,62,22,61,28,1,6,10,30,34,47,56,1,3,5,15},
+{1,28,12,62,7,3,36,20,21,9,5,59,60,63,27,15,26,19,22,45,17,46,53,29,8,39,24,62,40,21,47,63},
+{1,22,35,34,52,23,53,1,22,35,34,52,23,53,1,22,35,34,52,23,53,1,22,60,37,43,18,16,6,58,31,52},
+{1,35,58,57,61,18,56,30,40,1,35,58,57,61,18,56,30,40,1,35,58,57,61,9,14,43,50,3,2,35,29,22},
+{1,47,40,43,61,34,56,24,25,54,30,53,8,42,18,10,19,37,59,14,6,44,62,26,16,42,9,49,61,17,14,3},
+{1,56,34,20,8,25,19,23,45,18,47,15,6,39,22,21,48,59,7,31,52,1,56,17,5,1,28,62,52,54,14,31},
+{1,19,47,51,27,34,18,60,28,40,57,48,46,32,52,17,9,30,14,20,37,24,23,8,63,45,51,52,49,39,31,55},
+{1,47,50,30,40,21,31,7,39,1,47,50,30,40,21,31,7,39,1,47,50,30,40,48,32,19,49,13,37,21,53,38},
+{1,56,94,123,50,107,59,22,26,60,61,5,91,32,18,121,66,84,78,114,79,74,17,89,40,106,64,18,125,81,75,85},
+{1,24,82,71,36,86,39,126,88,62,52,77,93,70,60,4,96,90,14,25,74,21,99,57,62,26,49,94,55,118,76,102},
+{1,80,111,88,92,2,47,81,63,55,4,94,45,126,110,8,51,90,115,83,16,102,59,115,110,4,47,111,44,23,100,10},
+{1,2,4,8,16,32,64,17,34,68,25,50,100,89,35,70,29,58,116,121,99,87,63,63,63,63,63,63,63,63,63,63},
+{1,31,111,109,83,16,87,108,76,127,58,63,92,40,86,115,35,18,105,47,11,68,26,6,33,22,68,13,3,94,11,34},
+{1,107,2,113,4,69,8,45,16,90,32,19,64,38,39,76,78,63,59,126,118,91,75,91,118,126,59,63,78,76,39,38},
+{1,22,66,95,60,25,59,123,8,27,23,84,29,99,37,34,64,115,19,12,67,73,126,35,43,115,92,3,29,100,118,123},
+{1,56,49,2,112,98,4,89,125,8,11,67,16,22,63,32,44,126,64,88,69,57,9,69,64,44,63,16,11,125,4,112},
+{1,124,76,126,11,89,72,79,69,96,100,85,27,34,14,20,74,8,98,35,114,88,52,94,33,69,48,25,109,122,29,42},
+{1,17,66,45,123,65,30,124,54,82,126,20,23,36,35,84,24,26,56,125,39,16,83,87,117,55,65,15,31,86,29,71},
+{1,86,38,74,61,101,43,19,37,123,87,112,108,119,88,78,56,54,94,44,39,28,27,114,96,60,124,84,69,100,91,90},
+{1,26,49,16,6,92,117,96,20,110,75,53,120,17,28,109,101,102,72,27,43,33,22,45,87,44,90,125,88,103,41,99},
+{1,42,18,10,123,97,68,122,75,86,112,48,55,52,74,124,98,58,76,85,14,6,41,54,15,22,81,83,121,112,24,82},
+{1,26,107,72,87,78,11,27,113,35,31,25,69,16,106,82,60,6,92,85,122,56,110,29,100,111,16,53,102,117,87,39},
+{1,59,95,116,39,86,73,13,62,103,102,93,2,118,81,7,78,67,125,26,124,33,35,93,1,106,44,121,123,64,24,5},
+{1,33,77,102,114,49,123,11,120,104,94,51,57,96,69,125,60,52,47,97,100,48,90,35,127,63,83,62,59,17,115,8},
+{1,49,124,3,83,115,5,2,98,15,6,81,17,10,4,51,30,12,85,34,20,8,102,30,6,83,66,71,70,37,58,95},
+{1,9,65,71,113,13,101,68,106,51,81,42,125,97,96,105,40,111,30,19,118,50,88,75,112,2,9,94,80,111,15,69},
+{1,229,76,181,251,159,252,18,3,52,212,196,22,186,31,54,5,92,103,87,58,213,33,45,69,145,243,123,167,124,108,5},
+{1,89,145,59,15,96,44,100,85,26,185,38,36,150,169,223,193,1,89,145,59,15,96,22,25,41,34,160,58,43,123,102},
+{1,141,180,51,114,37,130,174,101,88,189,122,225,165,29,136,91,1,141,180,51,114,37,65,190,99,144,30,26,43,159,19},
+{1,76,218,252,145,239,49,208,94,54,25,2,152,153,213,15,243,98,141,188,108,50,4,152,218,126,111,115,204,144,199,231},
+{1,209,196,38,236,64,240,109,72,238,219,65,33,169,110,2,155,177,76,225,128,217,218,72,119,228,47,141,144,238,241,94},
+{1,217,117,81,99,109,143,103,72,100,28,251,239,94,88,240,241,40,93,12,111,2,141,117,183,87,250,27,69,105,85,35},
+{1,189,91,160,161,28,71,231,70,90,29,250,188,230,251,1,189,91,160,161,28,71,231,35,176,42,38,127,146,98,239,77},
+{1,18,91,122,150,10,180,208,197,224,68,235,226,96,93,22,19,73,33,236,156,190,100,165,241,187,31,231,29,245,159,68},
+{1,216,94,76,46,254,73,51,187,86,165,24,88,90,137,53,173,241,110,252,154,143,35,5,191,248,158,37,14,206,205,121},
+{1,139,140,146,153,200,168,26,237,171,226,28,120,44,33,229,2,115,125,65,87,245,53,26,196,193,69,234,232,99,37,179},
+{1,145,134,64,250,158,143,148,129,12,211,55,187,245,151,91,239,19,80,112,13,66,177,201,237,44,87,30,9,106,240,72},
+{1,169,44,24,229,51,49,18,74,122,193,167,197,225,117,129,114,77,182,5,239,156,120,113,219,136,147,28,233,196,36,74},
+{1,139,58,86,152,65,33,222,72,89,67,64,170,228,30,193,2,97,116,172,71,130,66,222,36,240,157,4,97,58,43,38},
+{1,149,52,32,252,225,151,101,72,188,98,46,48,130,44,97,234,108,226,83,57,40,195,29,59,129,116,236,242,171,61,69},
+{1,80,90,243,30,124,176,166,211,58,159,188,104,101,251,23,37,179,86,61,168,189,56,220,2,80,45,93,98,102,198,156},
+{1,175,11,56,69,3,122,29,72,207,5,142,39,216,218,15,25,105,227,229,17,43,187,87,41,55,46,223,133,202,128,141},
+{1,169,142,222,56,191,174,203,110,181,23,137,155,136,50,6,236,62,83,144,152,254,45,178,41,109,167,2,169,71,241,7},
+{1,192,253,232,238,207,96,177,116,119,168,48,151,58,244,84,24,132,29,122,42,12,66,175,167,153,252,20,99,55,59,26},
+{1,110,58,94,142,215,240,129,72,37,173,189,209,55,29,47,71,186,120,145,36,195,135,150,151,160,127,28,241,166,205,59},
+{1,142,82,58,120,28,178,92,99,86,249,153,244,251,44,80,143,220,104,66,100,174,238,203,103,158,6,59,123,199,17,104},
+{1,188,55,115,179,39,255,161,98,131,2,201,110,230,215,78,79,243,196,183,4,35,220,230,179,203,139,34,48,202,213,155},
+{1,141,27,199,248,29,147,162,72,68,236,88,242,225,125,93,140,150,220,63,229,142,49,117,3,21,100,192,206,23,233,19},
+{1,155,241,8,82,132,64,213,170,69,103,25,109,190,200,238,185,143,124,129,242,102,130,78,204,130,78,204,130,78,204,130},
+{1,173,9,168,65,133,24,15,216,119,235,81,143,136,85,106,172,164,161,233,196,157,23,140,88,244,166,26,77,213,29,196},
+{1,19,210,151,250,22,141,163,72,170,195,99,30,21,184,2,38,115,249,35,44,205,145,72,85,69,221,59,194,56,51,142},
+{1,194,233,72,98,1,194,233,72,98,1,194,233,72,98,1,194,233,72,98,1,194,233,36,246,213,217,50,212,184,127,221},
+{1,41,19,194,226,119,62,117,108,83,15,112,225,12,11,212,173,202,77,239,85,249,26,34,144,98,5,181,110,243,128,205},
+{1,93,10,71,68,163,189,116,184,174,154,6,61,60,97,107,44,104,203,118,2,186,20,71,34,84,85,130,121,182,55,196},
+{1,246,45,197,111,22,227,33,147,70,225,56,201,57,63,20,250,123,236,152,205,11,139,117,171,189,54,67,232,85,99,32},
+{1,106,10,118,68,174,163,58,72,93,219,89,138,113,171,152,24,31,240,198,125,88,224,193,73,231,74,184,177,213,63,197},
+{1,200,56,475,326,52,189,102,396,412,278,149,311,329,10,469,432,356,176,456,148,511,369,489,164,305,253,295,480,483,335,349},
+{1,26,324,6,92,427,20,456,472,120,146,242,272,381,61,83,317,142,490,189,309,94,415,334,113,44,508,424,29,129,190,389},
+{1,170,157,225,422,393,96,109,262,318,381,312,150,97,199,411,479,219,177,246,12,449,165,81,253,70,40,84,508,370,392,101},
+{1,169,268,496,394,264,335,396,229,330,410,495,343,21,241,274,388,411,326,91,485,379,26,360,131,119,245,475,365,136,312,51},
+{1,294,478,27,438,122,325,320,188,121,14,259,145,130,128,237,368,326,11,255,84,245,397,431,448,312,202,41,256,237,184,321},
+{1,231,221,393,451,419,36,215,264,230,58,340,74,96,391,243,479,494,220,366,286,42,487,186,75,341,320,164,412,19,205,157},
+{1,460,297,195,243,214,424,6,206,163,185,25,199,406,20,151,505,421,86,161,274,120,321,56,110,295,122,117,401,139,466,118},
+{1,88,339,67,38,439,22,198,130,300,255,288,276,261,75,173,72,69,502,128,412,18,422,172,8,352,237,67,19,255,144,69},
+{1,56,498,93,334,8,448,31,177,333,64,399,248,314,341,89,430,299,180,405,145,166,60,137,371,145,83,15,180,486,178,430},
+{1,321,501,28,152,362,336,189,387,324,270,220,244,461,300,19,405,42,484,340,263,182,308,439,349,409,370,57,279,368,376,194},
+{1,146,250,381,317,392,385,329,204,424,233,127,168,88,91,493,227,257,35,222,56,390,210,277,93,114,276,20,382,375,275,491},
+{1,369,426,92,408,329,113,174,78,409,56,475,242,470,208,73,373,188,79,232,402,391,362,379,178,511,120,205,324,285,214,234},
+{1,310,429,76,106,95,327,211,397,124,66,99,357,224,144,216,180,238,153,482,275,173,460,149,244,71,414,415,260,195,509,26},
+{1,168,267,350,72,492,150,40,399,269,217,235,177,294,174,140,509,277,92,16,299,383,193,55,297,300,40,508,485,200,180,407},
+{1,253,237,78,493,503,449,87,220,342,408,407,118,359,128,482,22,208,432,446,162,350,247,60,447,273,461,358,256,482,11,52},
+{1,314,155,27,147,336,325,392,211,276,231,193,502,250,327,379,485,290,449,230,507,365,225,234,171,20,440,112,376,22,130,382},
+{1,487,105,28,233,342,336,40,350,278,501,446,481,273,362,161,437,283,119,430,365,62,170,493,186,427,286,403,503,312,419,317},
+{1,215,172,354,289,61,448,315,63,110,99,98,181,25,379,90,103,423,156,163,205,174,204,368,24,214,369,319,253,507,72,187},
+{1,362,506,22,386,366,276,27,474,131,490,269,438,14,325,320,196,307,381,274,130,128,247,208,99,81,508,278,54,474,272,299},
+{1,302,209,173,235,380,147,200,229,310,439,417,141,165,426,27,177,127,401,228,24,358,268,51,223,289,392,86,216,97,254,401},
+{1,280,399,237,2,159,433,474,4,318,461,283,8,211,309,153,16,422,197,306,32,483,394,306,16,211,461,474,2,280,400,455},
+{1,297,330,23,247,55,277,176,322,308,123,143,372,264,385,474,183,324,27,30,253,497,442,19,453,490,210,155,380,334,437,474},
+{1,307,278,272,125,462,105,359,185,463,346,113,425,434,148,24,206,267,347,322,191,162,233,235,472,339,279,335,427,490,174,71},
+{1,332,15,233,85,73,460,376,56,453,360,79,309,346,129,59,222,377,372,458,385,26,380,75,426,318,489,58,201,314,446,53},
+{1,243,451,452,460,295,473,287,409,308,282,119,136,189,504,145,371,313,31,309,489,436,332,464,491,41,474,5,247,111,434,435},
+{1,41,503,171,294,358,74,54,43,421,414,112,497,93,162,71,499,15,407,273,356,24,259,467,289,433,469,346,464,113,236,263},
+{1,146,301,327,287,96,6,409,497,141,349,320,20,188,460,475,209,159,120,381,322,304,19,417,68,294,447,53,22,204,415,52},
+{1,378,170,336,67,215,284,461,198,14,35,423,399,363,440,190,290,342,84,466,503,71,205,474,413,135,106,472,231,210,62,305},
+{1,172,108,71,92,269,282,409,95,249,430,336,187,239,385,250,90,484,114,11,407,213,496,258,158,63,182,328,15,19,153,413},
+{1,438,301,141,458,429,499,218,169,226,104,149,221,414,263,216,214,427,370,18,148,363,179,197,461,77,396,320,168,170,284,3},
+{1,357,330,106,32,103,184,276,319,180,233,262,345,361,183,83,461,487,265,30,411,484,435,480,140,442,115,213,280,97,230,426},
+{1,497,152,238,490,169,122,21,477,314,458,26,448,12,273,158,489,421,466,295,252,193,324,413,46,288,5,394,190,173,192,469},
+{1,68,225,29,370,183,337,274,47,438,151,56,335,172,443,192,304,462,41,46,498,118,37,399,206,324,288,484,500,247,80,106},
+{1,129,125,297,29,360,226,447,337,128,252,340,308,373,394,349,238,465,124,424,96,65,255,499,312,277,381,496,97,96,440,363},
+{1,350,203,14,472,431,84,138,315,99,282,149,361,347,416,210,494,353,305,398,162,249,245,85,234,124,164,312,93,223,490,170},
+{1,406,13,200,81,115,212,366,255,459,288,64,388,9,2,101,26,400,162,230,424,405,510,459,144,16,404,52,400,81,413,53},
+{1,379,8,122,64,159,335,297,474,421,163,20,201,160,214,209,46,22,368,176,34,81,272,324,367,455,401,193,109,386,218,75},
+{1,180,280,502,98,367,316,329,235,171,408,203,415,156,97,179,335,8,77,65,391,75,162,285,457,235,504,102,114,343,450,398},
+{1,461,100,360,509,43,238,489,199,508,486,138,129,314,471,264,355,70,198,49,386,482,380,312,150,112,194,339,436,80,472,274},
+{1,254,67,35,39,180,440,308,424,19,37,328,318,370,486,379,62,75,261,340,428,128,297,226,477,283,29,54,259,424,444,358},
+{1,252,249,152,232,381,344,102,489,23,128,203,294,428,421,99,392,103,277,238,24,35,91,122,285,234,500,412,327,238,12,357},
+{1,244,396,351,481,473,493,60,151,263,66,242,199,482,197,10,174,455,31,262,182,382,408,440,71,491,258,435,106,293,298,239},
+{1,102,367,219,13,433,296,238,81,511,308,423,226,390,440,257,507,172,410,241,434,386,32,158,122,19,26,433,148,388,186,40},
+{1,319,360,41,452,213,206,288,245,211,326,346,3,196,61,123,457,383,338,229,287,373,79,503,224,491,398,249,35,430,309,504},
+{1,390,238,102,316,172,334,31,265,439,243,492,343,147,341,16,137,220,382,388,109,442,496,362,450,486,492,364,199,383,1,195},
+{1,359,426,332,354,434,268,509,443,308,34,240,289,293,90,432,99,264,130,81,231,329,378,249,348,494,86,200,127,459,325,173},
+{1,51,474,451,237,315,428,327,214,377,107,358,495,179,301,387,332,283,166,343,83,369,499,177,383,442,180,218,460,246,483,297},
+{1,155,168,367,358,494,205,245,140,246,289,270,297,285,162,74,445,478,167,260,12,454,146,16,19,281,359,358,247,221,437,314},
+{1,400,378,76,138,325,372,318,157,330,406,83,222,290,446,356,392,407,451,420,366,308,33,126,312,218,118,246,489,58,179,170},
+{1,145,140,237,477,77,245,162,10,503,293,292,437,313,468,9,68,177,19,25,494,203,495,45,170,394,407,66,14,60,466,82},
+{1,237,125,397,90,198,445,443,24,278,111,435,234,307,254,174,320,34,479,110,350,151,190,82,26,102,214,458,143,212,295,343},
+{1,41,62,420,299,447,349,56,338,431,24,13,453,310,319,94,400,405,280,478,320,184,81,489,296,226,344,432,101,438,30,407},
+{1,415,52,80,379,292,172,164,225,321,24,207,313,50,377,451,196,4,462,208,320,391,251,344,164,412,166,3,188,23,30,243},
+{1,352,443,87,473,350,385,456,364,183,202,478,184,389,109,70,491,104,131,378,355,504,377,144,452,48,507,157,498,392,497,88},
+{1,492,442,403,66,451,56,437,232,450,468,15,379,384,23,55,206,360,469,483,193,19,85,250,457,402,215,228,178,338,476,401},
+{1,33,12,396,80,433,59,173,308,42,359,504,328,58,140,312,422,311,73,371,151,440,274,413,205,348,343,31,2,33,6,99},
+};
+
+static const uint16_t prescr_table_31_19937[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,2,4,8,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+{1,11,10,1,11,5,6,4,15,10,12,8,7,13,1,9,14,3,2,11,5,6,4,15,10,12,8,7,13,1,9,14},
+{1,11,7,15,10,6,2,11,12,4,9,7,8,13,14,15,5,3,1,10,6,2,11,12,4,9,7,8,13,14,15,5},
+{1,16,13,14,27,6,21,25,22,1,8,10,26,14,31,3,24,30,11,18,4,5,13,7,29,19,12,15,23,9,2,16},
+{1,2,4,8,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+{1,6,20,9,25,4,12,20,19,26,1,3,5,15,17,28,11,29,8,24,7,9,27,2,6,10,30,13,23,22,21,16},
+{1,28,3,19,5,1,14,13,31,8,30,6,19,25,27,7,29,20,4,15,3,18,23,22,24,21,10,2,28,26,9,16},
+{1,14,25,4,3,9,4,28,25,2,14,17,1,7,21,29,30,23,19,15,22,20,26,11,10,13,24,5,27,12,31,16},
+{1,24,27,14,30,6,21,8,26,11,14,15,3,20,4,13,27,7,25,31,10,2,24,19,29,18,17,5,1,12,23,16},
+{1,18,8,22,3,27,6,54,12,47,24,29,48,58,35,55,5,45,10,25,20,50,40,39,19,13,38,26,15,52,30,43},
+{1,50,34,39,6,31,51,8,19,13,39,3,43,61,4,45,34,55,37,49,58,2,50,17,63,54,60,29,1,25,44,59},
+{1,1,1,1,1,43,62,31,36,18,9,47,60,30,15,44,22,11,46,23,32,16,8,4,2,1,43,62,31,36,18,9},
+{1,36,33,35,48,57,13,39,11,16,23,50,29,48,57,13,39,11,16,23,50,29,48,57,13,39,11,16,23,50,29,48},
+{1,25,7,46,21,4,50,7,23,29,1,60,41,45,31,24,15,18,19,47,6,43,52,44,35,49,34,13,11,32,20,56},
+{1,21,36,55,10,38,61,35,46,14,12,25,11,31,52,41,8,51,47,55,5,19,45,34,23,7,6,63,54,60,26,39},
+{1,45,48,20,15,57,41,47,53,29,18,43,2,45,24,5,23,60,62,19,11,14,25,37,27,8,3,13,20,49,42,34},
+{1,46,26,39,29,60,10,3,57,50,38,32,33,54,9,58,11,20,6,1,23,63,51,49,31,18,7,22,40,12,2,46},
+{1,1,1,1,1,58,29,52,26,13,60,30,15,61,36,18,9,62,31,53,32,16,8,4,2,1,58,29,52,26,13,60},
+{1,42,92,109,54,7,107,101,48,121,25,104,90,9,62,44,80,8,43,59,109,27,66,116,115,24,125,77,52,45,69,31},
+{1,118,124,22,56,82,69,98,84,86,32,30,95,88,112,45,3,77,33,37,64,60,55,57,105,90,6,19,66,74,9,120},
+{1,22,10,19,68,95,37,89,31,86,118,8,88,20,19,34,104,85,107,72,43,59,4,44,10,78,17,52,109,114,36,82},
+{1,78,48,41,59,47,22,119,121,32,104,51,53,118,94,44,127,99,64,65,102,106,125,45,88,111,87,17,19,93,69,107},
+{1,85,88,34,9,10,59,1,100,22,35,46,19,112,96,33,123,63,54,60,7,6,98,116,87,121,106,26,122,91,32,31},
+{1,97,70,50,37,91,15,10,12,8,109,43,50,65,126,84,5,6,4,101,70,25,115,63,42,81,3,2,97,35,95,106},
+{1,26,18,105,82,112,55,5,57,67,6,46,27,4,52,18,97,65,28,39,126,113,58,84,94,44,1,13,81,103,111,7},
+{1,16,114,12,121,94,20,25,113,30,73,21,17,49,67,69,117,62,59,19,33,122,70,109,71,101,7,56,11,88,36,82},
+{1,113,29,106,47,90,86,14,41,118,26,126,31,68,117,12,88,39,95,108,100,97,91,49,121,84,127,120,51,8,5,58},
+{1,85,45,21,30,7,116,96,37,125,61,68,18,123,3,31,77,79,26,108,89,10,66,44,32,92,43,84,60,14,41,1},
+{1,66,107,90,3,99,120,47,112,122,109,32,9,116,53,6,13,59,94,43,63,17,64,18,35,106,12,26,118,119,86,126},
+{1,69,127,81,60,11,111,80,85,71,19,31,39,117,101,116,46,95,99,104,7,87,2,69,86,73,110,27,126,10,36,123},
+{1,53,56,14,105,125,21,24,3,69,18,55,41,117,20,104,13,27,70,87,37,30,92,97,124,101,22,93,17,114,59,66},
+{1,25,110,109,70,122,91,127,23,120,66,72,53,59,116,20,31,28,123,37,22,6,43,89,102,32,90,1,126,105,17,83},
+{1,54,14,53,84,100,57,113,32,51,112,59,71,39,114,13,64,102,15,118,97,78,11,26,111,35,30,3,45,115,22,52},
+{1,101,126,7,40,76,57,27,68,79,22,67,91,48,39,46,18,120,37,75,45,61,32,58,52,28,80,105,114,54,121,111},
+{1,109,75,41,59,72,79,66,120,125,29,121,48,50,95,1,77,47,38,49,127,112,39,124,80,86,22,3,32,113,106,83},
+{1,57,90,78,51,13,9,123,33,6,75,119,74,21,34,93,14,82,62,4,114,90,39,77,60,61,95,55,127,83,92,108},
+{1,186,169,41,183,53,192,229,130,245,37,103,119,208,66,16,167,146,82,183,53,192,229,130,245,37,103,119,208,66,16,167},
+{1,24,93,107,129,66,63,25,172,131,90,159,202,17,204,57,49,81,235,128,78,111,254,124,42,229,200,9,108,234,140,30},
+{1,72,166,136,93,241,246,10,67,52,170,223,9,47,219,153,137,159,81,106,55,198,48,58,121,77,231,56,49,30,197,92},
+{1,101,47,24,225,233,80,14,22,240,18,58,61,54,78,71,90,210,201,238,91,118,31,237,154,33,26,131,99,46,168,165},
+{1,210,193,130,253,213,218,255,7,38,67,163,135,22,73,114,192,40,15,37,248,33,101,224,36,145,95,59,178,232,39,42},
+{1,184,57,177,130,160,30,106,44,215,188,204,197,7,171,100,69,31,54,242,169,220,198,227,246,230,229,1,92,222,126,96},
+{1,65,168,223,7,69,214,106,179,213,173,205,118,234,90,72,155,245,196,185,221,228,208,169,79,222,35,174,10,8,73,29},
+{1,64,140,166,222,235,214,180,145,18,254,200,149,146,114,155,13,255,232,182,209,84,120,132,12,223,203,245,247,183,241,119},
+{1,95,47,56,186,145,51,131,82,153,44,221,106,196,213,117,154,237,40,99,69,216,74,184,206,149,141,172,78,6,225,137},
+{1,236,3,81,5,203,232,14,78,182,134,196,208,83,92,100,57,43,249,70,169,128,149,96,132,40,99,30,112,186,36,193},
+{1,38,217,227,73,134,112,230,207,246,150,41,57,96,191,16,89,223,175,73,134,112,230,207,246,150,41,57,96,191,16,89},
+{1,135,205,226,191,198,243,145,171,52,153,85,223,123,178,188,186,66,81,160,182,195,119,51,154,41,110,187,185,62,224,96},
+{1,199,40,254,235,146,203,104,252,9,93,90,188,138,51,152,137,44,134,79,224,8,133,80,254,206,73,222,52,126,191,149},
+{1,150,49,68,237,35,147,185,207,251,197,195,2,150,165,17,108,43,61,219,139,48,105,55,227,76,101,206,176,42,118,52},
+{1,19,130,140,126,191,201,58,112,198,137,211,253,51,246,166,215,219,177,176,122,153,75,124,172,136,25,30,225,193,118,243},
+{1,150,112,14,99,219,21,237,39,120,194,154,90,86,52,164,173,35,223,178,157,32,2,150,56,198,61,42,81,78,240,15},
+{1,211,255,34,12,125,140,51,5,132,101,118,166,99,142,224,188,74,162,72,113,241,191,54,129,225,19,208,197,237,110,92},
+{1,36,205,90,172,131,140,98,152,149,95,12,216,200,119,125,201,101,230,106,8,144,5,90,86,142,70,49,76,133,224,6},
+{1,114,201,224,90,209,205,148,14,253,77,168,88,163,120,172,188,106,8,107,49,224,45,185,183,74,7,175,247,84,44,128},
+{1,79,128,142,6,209,192,176,107,113,40,58,246,77,15,183,73,145,55,14,68,105,62,104,205,72,98,23,161,27,170,50},
+{1,57,231,181,159,184,197,73,117,104,67,168,188,183,174,247,251,109,245,194,198,180,83,209,66,108,49,79,62,36,128,170},
+{1,216,123,68,7,185,55,229,196,192,205,182,148,36,101,217,143,190,142,210,33,4,13,123,34,176,65,188,86,49,48,92},
+{1,101,246,180,71,129,234,105,230,244,63,26,156,10,50,84,153,19,24,249,113,31,133,32,159,188,149,142,193,23,210,15},
+{1,165,73,153,152,249,29,176,182,150,28,5,48,207,242,200,103,196,39,31,21,117,36,15,80,158,217,151,169,131,105,33},
+{1,117,82,214,181,1,209,255,111,89,204,193,249,240,34,121,192,40,15,77,32,12,233,246,189,2,117,41,222,178,79,85},
+{1,35,203,254,168,90,196,105,138,46,190,250,18,230,29,240,189,38,50,177,236,178,48,146,103,99,37,238,145,187,67,114},
+{1,166,211,110,216,115,160,151,161,196,236,176,18,35,24,52,195,178,180,185,240,47,2,166,154,232,27,193,20,46,81,235},
+{1,221,191,203,57,143,22,67,240,183,14,6,148,25,210,55,137,130,90,34,128,135,132,206,59,82,176,13,76,97,112,48},
+{1,209,6,249,20,254,30,129,17,59,227,220,104,178,92,235,114,100,75,86,148,125,222,185,177,31,19,234,224,159,144,42},
+{1,90,229,227,198,181,200,202,144,30,164,62,235,242,149,135,6,238,107,55,87,134,43,169,54,122,193,118,228,160,138,14},
+{1,294,402,90,228,302,87,48,327,215,476,300,369,249,80,458,377,103,375,400,267,240,93,392,169,410,179,286,272,231,155,507},
+{1,342,344,122,268,480,371,368,141,119,490,351,381,481,472,294,6,491,500,299,362,68,312,114,508,81,459,62,446,130,77,233},
+{1,256,459,409,449,233,401,453,254,90,2,256,494,488,255,218,245,500,154,389,398,32,184,61,93,405,466,309,413,508,180,4},
+{1,146,127,394,443,115,434,105,469,89,63,70,309,144,416,93,283,57,496,120,314,316,138,455,109,241,38,250,174,431,497,49},
+{1,108,282,431,204,131,247,139,327,158,232,248,441,403,236,32,163,84,223,408,262,494,278,175,316,464,496,339,263,472,64,326},
+{1,203,215,423,391,395,284,101,7,46,2,203,381,500,254,489,309,73,206,408,139,449,106,296,386,366,99,346,388,51,457,363},
+{1,342,88,154,216,6,457,116,370,45,404,13,266,254,337,334,349,239,437,56,495,291,501,260,9,405,166,284,376,69,264,424},
+{1,108,213,349,334,470,313,88,161,95,35,71,184,242,276,283,41,411,93,79,264,344,73,444,194,34,113,314,2,108,335,480},
+{1,27,325,240,244,76,355,485,483,462,261,321,78,376,107,479,252,32,432,277,409,488,152,159,403,415,453,83,219,156,169,214},
+{1,51,443,206,107,39,12,170,146,169,407,418,5,336,322,233,278,406,148,252,478,217,481,385,111,65,439,205,31,55,404,167},
+{1,134,490,169,362,25,196,510,144,389,171,51,459,209,75,309,218,243,313,427,168,246,118,265,165,452,357,429,290,489,419,213},
+{1,126,167,176,145,24,97,443,464,493,20,357,82,312,47,30,227,123,420,268,17,422,370,374,394,301,373,459,461,335,143,251},
+{1,94,67,196,274,141,461,402,171,17,176,391,167,469,117,289,349,299,123,187,142,444,15,437,344,440,179,502,314,203,316,41},
+{1,71,474,114,291,479,431,66,379,432,192,307,400,94,166,88,111,367,369,235,494,102,363,511,305,471,179,385,265,26,276,223},
+{1,121,46,240,174,222,47,378,32,279,368,445,348,444,94,137,64,83,157,263,197,261,188,274,128,166,314,115,394,119,376,89},
+{1,459,116,220,296,46,108,385,370,44,423,443,325,9,259,245,388,453,69,145,160,95,181,418,268,300,319,24,495,312,356,444},
+{1,487,105,28,233,171,84,5,226,214,327,343,273,181,141,100,207,155,158,124,170,493,186,427,286,403,503,312,419,317,321,491},
+{1,184,49,13,51,498,178,405,403,91,318,209,452,108,444,82,283,25,215,12,265,83,327,179,457,313,325,11,157,412,438,147},
+{1,304,224,362,96,164,303,306,320,379,263,329,101,255,503,83,350,161,372,490,33,357,221,314,198,187,109,377,55,313,366,243},
+{1,181,467,67,288,58,482,349,34,369,253,231,193,218,500,96,233,367,433,303,156,262,33,204,201,171,247,35,121,370,320,211},
+{1,141,201,497,255,461,348,216,392,209,2,141,307,384,74,400,380,27,49,228,508,440,292,48,501,50,376,257,248,331,360,55},
+{1,355,472,363,28,343,102,228,21,95,279,175,183,401,47,293,311,400,453,339,23,316,507,88,495,493,142,98,149,461,433,272},
+{1,26,324,329,491,342,304,323,473,60,300,463,194,160,231,313,294,445,85,276,215,73,408,460,213,83,314,305,334,392,284,191},
+{1,228,413,491,285,213,328,218,329,168,250,427,45,7,350,391,88,234,474,264,286,67,338,272,48,147,416,484,488,383,279,366},
+{1,492,59,469,231,162,54,190,122,31,342,6,229,334,323,127,480,191,140,461,94,203,181,419,206,330,74,68,98,346,460,168},
+{1,481,50,67,178,262,108,170,61,192,111,214,325,53,41,11,149,284,182,31,94,486,380,492,116,401,145,5,132,339,287,202},
+{1,126,9,379,65,449,47,442,402,149,207,434,106,135,436,232,496,490,361,33,192,247,432,20,505,45,452,236,268,483,174,140},
+{1,464,233,216,133,243,353,280,160,110,335,246,208,373,215,276,434,341,507,343,43,95,29,364,226,287,193,267,270,191,210,165},
+{1,142,363,458,438,165,290,340,157,143,370,232,399,335,30,472,294,72,502,106,159,1,71,282,249,187,250,114,213,377,280,119},
+{1,497,217,298,258,205,179,359,172,35,302,112,310,325,243,296,368,10,19,87,233,492,336,420,253,458,510,118,54,121,421,396},
+{1,450,326,392,112,157,245,27,336,198,478,65,154,327,37,455,211,255,251,106,300,488,500,278,494,167,243,328,181,96,460,210},
+{1,131,175,320,478,469,395,481,217,180,455,49,410,278,406,259,103,227,368,187,159,244,2,131,472,80,252,273,477,152,191,409},
+{1,355,302,73,398,13,44,395,200,216,266,215,69,459,454,490,97,169,113,379,428,489,34,484,14,111,198,183,460,96,393,427},
+{1,411,201,167,34,419,470,208,140,233,499,442,145,425,67,190,342,48,36,63,227,102,468,331,368,404,315,292,511,435,458,197},
+{1,481,311,16,446,25,64,71,50,128,142,100,256,284,200,315,259,400,333,317,27,417,321,54,121,441,108,242,73,216,484,146},
+{1,502,40,59,411,21,387,130,371,207,385,372,359,439,265,187,492,373,412,445,437,255,175,148,509,83,310,375,106,425,205,119},
+{1,505,506,190,511,441,143,385,119,495,2,505,253,392,86,141,120,138,103,84,372,133,258,49,217,268,15,357,101,429,393,269},
+{1,75,327,87,53,320,211,440,217,223,2,75,270,195,187,40,113,55,267,477,379,98,247,115,124,5,286,448,74,134,68,375},
+{1,507,211,327,115,455,70,59,446,340,2,507,473,313,186,316,352,179,351,410,216,139,87,75,207,407,44,162,303,235,27,165},
+{1,324,377,192,405,398,415,103,271,151,245,187,100,233,175,221,457,335,66,401,109,230,7,5,321,72,120,253,22,509,41,464},
+{1,280,288,4,471,301,4,349,288,2,280,144,1,140,72,438,70,36,219,35,18,475,423,9,347,357,434,283,260,217,315,130},
+{1,237,205,19,344,412,292,446,422,239,306,263,243,417,23,374,3,290,137,180,391,335,234,295,156,303,91,181,72,25,134,139},
+{1,292,178,172,18,121,494,371,368,198,268,141,350,1,146,403,426,177,480,113,255,23,476,207,143,122,88,185,241,277,83,30},
+{1,447,134,151,506,1,285,483,131,111,217,491,373,355,78,278,183,47,381,149,322,385,74,493,49,422,193,116,484,218,329,213},
+{1,389,235,475,301,362,29,273,455,325,427,257,92,358,402,44,310,379,131,491,115,208,386,439,277,322,430,129,110,449,69,242},
+{1,417,295,371,391,91,510,94,29,8,454,495,371,275,509,255,47,478,4,227,295,361,345,302,431,455,239,2,417,323,356,380},
+{1,438,171,318,11,223,452,443,63,373,497,202,279,276,121,235,110,398,334,93,400,322,310,109,227,476,216,112,386,37,416,49},
+{1,103,75,235,208,511,417,424,475,109,2,103,505,264,26,378,67,53,162,422,238,329,72,33,237,193,145,429,250,262,303,94},
+{1,277,434,472,311,440,484,198,448,351,313,349,44,388,90,474,109,5,132,61,215,147,406,373,69,108,364,267,6,248,363,154},
+{1,434,374,371,415,182,390,70,156,79,283,208,63,200,22,106,72,223,165,410,192,328,333,315,501,254,345,227,262,143,83,413},
+{1,165,353,52,449,434,324,471,290,160,424,455,93,371,448,6,495,55,23,292,335,415,464,377,60,95,470,150,11,72,242,473},
+{1,65,509,98,480,416,382,6,195,233,451,68,92,133,244,82,322,50,499,502,190,457,257,359,277,56,182,205,302,261,485,232},
+{1,398,309,425,281,493,328,266,105,58,339,260,168,458,350,140,149,277,162,462,411,441,429,421,47,412,53,341,79,235,110,438},
+{1,68,132,475,419,348,90,93,179,84,385,381,29,121,94,213,55,328,273,298,506,359,138,192,350,30,31,61,28,91,127,146},
+{1,357,418,295,258,394,422,68,22,241,41,391,108,215,257,425,235,84,161,427,398,133,486,369,325,447,26,125,294,455,345,388},
+{1,325,158,379,388,102,143,470,56,185,66,407,437,153,43,362,84,106,231,116,3,26,405,240,214,139,167,166,505,35,115,360},
+};
+
+static const uint16_t prescr_table_31_21701[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,7,1,4,6,5,2,3,7,1,4,6,5,2,3,7,1,4,6,5,2,3,7,1,4,6,5,2,3,7,1},
+{1,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6},
+{1,8,6,11,10,14,13,1,4,3,12,5,7,15,9,2,8,6,11,10,14,13,1,4,3,12,5,7,15,9,2,8},
+{1,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6},
+{1,3,13,4,6,5,8,12,10,15,7,11,1,14,9,2,3,13,4,6,5,8,12,10,15,7,11,1,14,9,2,3},
+{1,28,25,10,3,18,7,15,16,27,22,26,24,4,29,23,20,6,1,14,30,5,19,9,17,21,8,31,11,13,12,2},
+{1,6,10,30,11,29,14,18,31,8,24,1,3,5,15,17,26,7,9,27,4,12,20,21,22,19,28,13,23,16,25,2},
+{1,8,15,19,18,22,6,24,17,26,25,21,10,7,28,1,4,16,30,9,11,3,12,31,13,27,29,5,20,14,23,2},
+{1,23,20,19,13,12,28,22,4,25,31,17,26,24,15,27,8,5,9,21,3,7,30,1,16,10,18,29,6,14,11,2},
+{1,9,6,27,10,22,30,1,25,3,16,5,11,15,29,17,28,8,31,24,26,19,21,14,4,18,12,13,20,23,7,2},
+{1,26,17,20,16,25,6,19,14,1,13,22,10,8,18,3,23,7,30,24,11,5,4,9,31,21,29,15,12,27,28,2},
+{1,7,43,10,27,1,34,52,5,44,33,17,26,35,22,49,41,13,48,11,57,53,39,24,36,61,59,50,12,18,63,60},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,36,30,46,4,31,60,11,8,62,47,22,16,43,9,44,32,1,18,15,23,2,36,30,46,4,31,60,11,8,62,47},
+{1,38,63,5,4,23,37,10,8,46,17,20,16,7,34,40,32,14,31,11,27,28,62,22,54,56,39,44,55,43,21,3},
+{1,53,52,30,4,11,9,60,8,22,18,25,16,44,36,50,32,57,41,5,33,19,51,10,35,38,7,20,39,45,14,40},
+{1,27,56,49,4,54,23,5,8,11,46,10,16,22,59,20,32,44,17,40,39,63,34,55,41,25,35,9,53,50,33,18},
+{1,60,25,13,33,1,30,58,48,38,54,15,29,24,19,27,49,56,12,63,59,46,28,6,41,43,23,14,3,34,35,61},
+{1,45,54,36,56,1,47,27,18,28,57,46,52,9,14,37,23,26,61,7,43,50,13,39,58,44,25,63,42,29,22,53},
+{1,32,9,15,26,1,16,62,61,13,58,8,31,36,60,29,4,53,18,30,52,2,32,9,15,26,1,16,62,61,13,58},
+{1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+{1,40,4,80,8,41,16,82,32,45,64,90,9,61,18,122,36,125,72,115,25,111,50,87,100,39,65,78,11,21,22,42},
+{1,9,103,121,14,63,43,113,42,50,94,73,89,17,11,110,30,119,49,20,90,91,24,108,23,16,72,26,101,112,105,70},
+{1,3,74,111,16,24,20,30,17,81,49,97,25,93,59,110,89,61,107,22,29,91,62,33,121,13,67,42,63,104,92,114},
+{1,123,114,74,28,43,85,63,53,5,24,64,44,54,13,83,47,62,70,60,61,78,119,82,92,7,99,50,102,42,38,6},
+{1,13,123,58,38,96,62,60,49,74,112,86,54,8,52,5,79,63,105,95,87,99,102,41,22,127,32,119,20,114,91,77},
+{1,58,14,13,42,35,125,66,37,51,80,50,77,53,30,32,90,75,123,12,55,36,46,87,97,88,113,117,1,29,7,83},
+{1,20,49,33,56,123,1,10,68,76,28,97,92,5,34,38,14,108,46,94,17,19,7,54,23,47,84,85,95,27,87,75},
+{1,53,43,118,62,48,4,106,86,83,124,96,8,107,19,25,71,127,16,105,38,50,49,65,32,109,76,100,98,61,64,101},
+{1,29,9,26,64,101,99,68,95,113,112,30,122,119,87,5,84,118,57,97,89,86,107,48,123,25,51,8,116,36,104,67},
+{1,76,122,86,74,101,19,123,112,119,78,54,44,28,47,118,104,11,7,57,120,26,48,51,89,30,99,12,62,65,98,42},
+{1,57,35,67,82,73,92,53,102,90,126,3,76,91,11,123,4,114,70,85,119,65,107,106,31,103,47,6,75,101,22,37},
+{1,63,62,75,84,27,49,86,36,15,29,112,20,44,38,48,35,59,64,55,23,102,7,52,93,71,3,74,33,4,126,124},
+{1,46,116,11,100,84,80,12,1,23,58,119,50,42,40,6,114,121,29,73,25,21,20,3,57,78,124,86,126,120,10,115},
+{1,114,89,92,110,104,17,21,30,67,20,39,24,58,16,44,69,109,35,19,103,71,31,122,79,9,47,14,111,81,74,59},
+{1,63,5,25,112,70,41,94,62,98,99,4,126,10,50,17,125,82,77,124,53,55,8,13,20,100,34,11,85,107,9,106},
+{1,45,97,82,118,57,74,68,112,78,30,69,29,5,55,126,122,32,21,70,93,47,76,51,36,79,115,14,52,62,80,91},
+{1,17,3,103,124,42,66,63,99,94,44,113,58,55,39,82,74,123,111,56,38,36,53,54,81,45,7,69,122,25,71,107},
+{1,166,113,157,227,114,104,39,44,119,108,112,206,86,177,148,30,24,233,122,198,248,110,214,191,203,82,230,118,63,197,13},
+{1,163,49,76,52,200,192,118,178,159,79,72,111,170,88,30,63,2,163,49,76,52,200,192,118,178,159,79,72,111,170,88},
+{1,77,206,235,190,81,117,147,27,223,102,83,56,93,240,97,55,38,171,70,47,7,100,30,246,182,78,48,66,181,176,153},
+{1,73,243,21,50,127,30,192,216,195,35,223,170,244,124,229,220,81,232,245,206,10,64,72,65,250,174,102,183,207,184,175},
+{1,244,132,169,135,39,65,70,25,238,228,139,109,18,251,64,60,91,38,59,4,209,49,107,55,78,130,140,50,229,241,47},
+{1,243,249,135,219,62,200,14,167,145,212,127,186,6,42,52,182,82,66,103,18,214,140,67,129,241,10,126,92,229,246,198},
+{1,116,224,16,119,174,128,111,68,121,175,186,31,76,228,248,250,142,110,126,9,167,39,72,12,117,218,96,127,51,215,47},
+{1,102,242,250,61,20,29,233,185,205,136,210,7,153,48,44,246,54,134,191,103,193,131,64,165,23,72,98,62,65,150,110},
+{1,110,81,19,140,134,51,69,26,96,56,199,245,135,4,220,162,38,123,111,102,138,52,192,112,237,137,109,8,219,39,76},
+{1,104,109,137,215,86,68,195,105,89,13,33,143,111,225,186,223,147,149,45,154,100,120,130,78,110,213,62,41,74,190,15},
+{1,81,199,108,58,146,9,177,112,239,245,211,148,250,145,196,161,42,200,46,106,201,178,189,255,175,244,79,67,204,140,141},
+{1,67,161,234,54,186,183,213,104,131,44,126,188,114,71,39,217,147,214,178,202,179,83,91,38,64,123,163,169,151,80,129},
+{1,254,225,72,240,245,1,127,203,36,120,193,187,132,222,18,60,219,230,66,111,9,30,214,115,33,140,191,15,107,130,171},
+{1,247,187,1,198,224,189,99,112,227,140,56,204,70,28,102,35,14,51,172,7,164,86,190,82,43,95,41,168,146,169,84},
+{1,226,27,158,97,69,151,150,231,41,102,149,116,252,183,7,208,227,106,80,46,182,118,30,172,153,177,166,253,198,201,159},
+{1,146,48,99,29,18,179,59,109,245,130,17,104,19,250,35,153,62,139,141,176,224,69,98,84,10,71,240,100,105,90,226},
+{1,40,183,234,237,129,72,142,132,12,240,168,235,249,28,61,62,2,40,183,234,237,129,72,142,132,12,240,168,235,249,28},
+{1,219,220,140,25,84,188,106,111,228,173,108,157,31,166,71,97,68,24,246,210,44,172,206,243,89,101,109,63,113,224,132},
+{1,55,190,112,65,166,183,102,3,253,225,72,176,245,61,85,211,82,64,108,232,94,242,174,107,123,96,90,156,113,139,249},
+{1,74,156,16,171,191,128,174,14,95,134,112,3,111,210,24,42,52,192,249,9,164,197,72,214,140,187,20,63,46,160,81},
+{1,176,235,174,191,193,65,192,25,109,78,234,246,18,150,198,120,225,13,154,4,209,103,237,207,51,130,49,50,218,156,101},
+{1,152,133,16,243,27,128,209,216,51,124,52,37,154,29,149,227,232,155,81,9,235,79,72,17,191,135,136,118,11,115,202},
+{1,64,215,31,102,157,75,116,152,235,147,72,20,197,26,198,122,155,139,206,185,65,247,149,136,174,228,176,162,167,7,224},
+{1,171,233,150,96,190,247,108,218,208,134,85,202,229,242,71,84,120,118,185,119,11,228,64,212,31,72,41,37,65,102,140},
+{1,226,132,10,196,237,34,122,247,170,69,133,123,134,232,64,231,230,151,213,208,178,47,62,3,147,198,15,166,112,51,71},
+{1,97,200,117,184,209,64,175,30,72,246,132,65,113,122,156,170,2,97,200,117,184,209,64,175,30,72,246,132,65,113,122},
+{1,45,242,100,182,43,133,149,26,22,248,253,66,56,194,18,162,254,138,179,148,255,111,202,166,164,137,123,31,169,130,7},
+{1,33,236,221,202,187,166,114,213,78,237,52,188,44,195,214,134,119,126,19,51,54,157,192,30,28,61,209,12,198,125,219},
+{1,142,47,155,207,165,93,10,169,147,232,25,46,220,34,18,192,162,125,150,70,170,90,42,53,124,209,171,29,199,130,225},
+{1,53,127,35,113,168,245,65,91,235,155,213,227,79,208,111,114,123,73,143,238,23,232,72,105,45,250,44,28,239,241,43},
+{1,78,38,52,9,287,139,202,289,500,363,334,275,303,30,409,450,300,119,428,492,32,230,99,323,144,488,188,170,11,337,173},
+{1,284,202,205,374,77,116,324,189,27,356,501,221,466,46,47,161,196,426,273,63,5,167,497,244,70,436,210,59,44,307,107},
+{1,222,390,497,148,260,350,277,504,404,486,336,280,324,109,29,117,443,22,427,223,489,306,359,334,476,442,121,360,300,419,432},
+{1,473,156,23,280,316,391,275,77,318,94,399,90,38,354,8,329,107,92,86,198,49,122,308,206,376,17,360,152,446,32,274},
+{1,108,141,499,265,220,450,221,500,395,29,31,115,254,269,4,216,282,455,51,440,421,442,457,311,58,62,230,508,59,8,432},
+{1,364,360,413,352,119,154,116,320,424,261,120,95,175,17,335,365,478,297,184,199,439,57,378,264,465,492,99,406,336,81,220},
+{1,37,290,365,91,84,420,142,375,450,68,140,338,224,297,215,262,324,423,416,196,256,299,242,36,41,508,500,352,398,92,304},
+{1,181,448,266,402,239,186,511,60,252,78,302,207,141,86,143,227,335,489,221,262,103,249,91,5,21,299,218,422,140,297,111},
+{1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+{1,83,209,91,413,320,241,469,335,78,250,460,450,123,19,402,511,478,342,195,207,293,412,70,438,215,174,238,429,9,74,92},
+{1,75,132,382,247,145,194,343,182,370,333,492,361,256,437,411,16,61,234,1,279,66,191,329,378,97,409,91,185,404,246,390},
+{1,53,469,173,159,59,350,340,437,399,511,373,418,342,384,90,338,490,409,8,212,495,221,21,236,426,386,111,135,327,262,51},
+{1,418,296,332,331,275,144,397,429,329,177,440,193,230,90,33,53,364,431,235,409,244,394,501,202,428,408,37,286,339,344,18},
+{1,324,233,482,345,193,381,351,378,70,270,230,261,254,368,252,52,21,470,332,279,49,72,331,14,69,232,320,22,48,234,4},
+{1,177,148,9,479,103,286,42,145,13,189,335,268,489,95,76,233,109,278,147,188,41,326,211,398,321,102,120,96,427,476,432},
+{1,265,72,225,187,384,436,84,397,460,448,127,463,270,19,29,171,339,371,213,347,89,501,88,50,124,257,354,449,440,491,61},
+{1,305,164,236,268,289,493,230,467,384,36,240,348,102,463,464,355,210,106,214,157,414,325,275,402,92,94,367,459,295,43,266},
+{1,32,153,365,129,237,390,359,33,137,109,379,481,188,420,478,469,357,1,16,256,506,268,314,195,511,348,264,378,497,444,94},
+{1,171,364,253,247,83,457,99,491,244,508,19,433,54,479,384,272,510,184,221,203,296,467,217,413,339,41,311,315,98,239,66},
+{1,168,65,124,355,96,60,331,113,98,148,266,13,257,244,310,326,368,150,418,76,381,407,342,378,59,231,448,216,119,410,87},
+{1,44,135,478,273,161,453,251,231,367,436,316,48,271,261,409,429,250,241,123,347,227,311,186,47,189,77,32,111,99,139,310},
+{1,367,196,261,463,286,58,486,479,186,451,421,21,33,19,295,351,159,441,266,503,407,289,89,467,1,492,98,473,444,143,29},
+{1,203,17,164,478,8,401,68,45,191,32,387,272,180,65,128,459,314,109,260,189,235,402,436,362,73,273,399,279,210,292,318},
+{1,93,60,423,103,380,388,317,81,498,303,43,46,477,443,398,20,157,408,212,313,235,394,174,229,25,26,270,300,319,12,462},
+{1,447,266,268,284,211,278,227,406,125,344,307,436,141,265,260,147,345,132,305,11,391,5,24,64,79,103,167,118,223,310,428},
+{1,252,117,254,137,139,119,2,252,117,254,137,139,119,2,252,117,254,137,139,119,2,252,117,254,137,139,119,2,252,117,254},
+{1,129,20,224,136,479,186,397,334,332,461,473,313,433,110,212,345,23,347,150,335,118,455,425,381,36,51,360,510,177,199,256},
+{1,207,461,506,220,362,467,29,51,184,213,436,118,3,468,87,263,178,479,70,367,342,228,451,366,77,382,318,256,248,235,76},
+{1,130,285,352,87,411,377,12,13,76,322,498,89,276,40,46,424,398,303,470,122,240,228,243,39,224,503,284,289,345,299,210},
+{1,311,71,335,250,420,141,424,25,58,413,309,368,264,437,350,297,293,433,35,423,168,69,120,189,235,119,12,148,402,388,271},
+{1,494,414,265,352,163,243,6,295,439,14,181,485,277,10,124,460,18,479,314,42,30,132,321,54,372,91,126,34,396,214,90},
+{1,169,229,424,400,144,62,251,385,290,213,275,437,203,314,263,142,23,73,452,15,411,89,429,281,167,165,12,233,321,209,65},
+{1,507,469,447,220,79,52,76,163,226,82,80,427,126,449,285,338,358,298,393,363,313,361,194,188,381,96,306,84,382,247,412},
+{1,355,452,256,345,395,248,130,87,153,380,280,56,300,60,219,133,490,262,461,246,201,88,507,401,250,481,403,409,37,147,192},
+{1,510,49,150,38,375,120,379,305,477,382,265,58,25,342,201,213,443,149,295,195,165,334,352,409,293,317,148,472,326,238,349},
+{1,143,315,461,466,374,91,420,341,312,161,464,505,352,105,135,78,250,116,172,88,200,343,439,410,29,43,22,50,291,283,450},
+{1,134,241,334,126,171,100,155,264,238,49,303,426,414,510,105,131,446,371,266,104,192,97,468,309,410,242,395,336,322,37,450},
+{1,288,458,8,365,414,32,89,206,128,356,99,347,125,396,129,500,134,351,358,323,145,117,225,287,468,223,401,486,39,242,302},
+{1,285,9,233,400,257,74,151,269,198,161,26,5,101,422,22,137,83,177,213,77,495,162,57,440,328,254,39,230,319,138,112},
+{1,140,108,304,338,173,251,272,387,187,178,431,41,460,400,428,227,406,56,87,429,165,416,160,254,78,365,296,468,278,23,15},
+{1,195,443,365,69,52,192,175,445,40,485,238,15,243,253,473,79,150,333,449,236,204,328,400,412,123,86,482,124,196,297,422},
+{1,382,389,362,208,247,269,305,445,105,381,68,404,271,79,56,259,429,179,153,62,498,81,126,489,295,406,113,458,338,467,346},
+{1,225,329,267,204,300,179,376,417,374,121,375,438,108,140,10,26,492,166,131,29,256,281,475,303,413,298,400,476,451,34,114},
+{1,322,325,423,141,240,227,395,285,258,236,238,428,233,334,451,307,464,91,326,68,168,70,490,259,77,398,189,365,310,112,52},
+{1,139,508,304,120,83,363,176,13,311,103,294,300,4,278,119,495,240,166,345,352,26,481,206,451,471,8,419,238,81,480,332},
+{1,412,410,159,400,49,288,371,434,390,241,474,201,262,93,246,17,267,312,388,365,64,86,150,108,470,354,185,190,373,183,137},
+{1,457,244,121,273,476,369,289,120,47,422,151,115,150,333,236,171,446,69,220,271,224,194,51,339,464,280,172,366,291,433,219},
+{1,303,44,76,401,419,446,395,21,66,302,359,90,439,183,179,340,268,404,271,496,309,410,432,308,209,422,274,453,171,461,220},
+{1,54,333,144,235,71,271,488,283,52,379,477,123,172,328,231,243,303,335,166,422,215,484,431,20,476,96,489,256,369,307,75},
+{1,213,244,204,218,155,433,275,315,19,100,184,348,497,438,483,93,289,359,189,377,99,72,58,195,181,486,120,179,153,356,487},
+{1,106,321,242,203,241,148,246,31,446,368,352,509,150,156,350,332,443,401,361,96,131,224,60,219,108,511,252,477,428,391,330},
+{1,403,497,52,216,339,349,475,115,255,290,49,264,118,303,7,67,212,70,260,355,374,191,326,148,34,417,73,161,473,480,270},
+{1,90,116,57,391,353,149,270,186,366,318,120,485,191,503,492,506,29,248,379,174,211,431,450,439,419,30,143,309,359,123,402},
+{1,461,62,137,329,235,249,208,286,506,338,295,464,70,482,68,47,122,166,307,77,458,157,212,359,390,64,86,6,436,66,411},
+{1,205,114,208,285,444,302,452,494,355,43,287,369,348,276,243,223,261,219,159,63,319,492,430,89,463,108,224,58,311,305,102},
+{1,281,253,114,220,167,355,72,218,119,100,222,446,414,58,6,208,263,150,356,489,94,216,366,153,172,354,313,345,78,10,368},
+};
+
+static const uint16_t prescr_table_31_23209[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,1,1,1,1,1,1,1,1,1,1},
+{1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,2,4,5,7,3,6,1,2,4,5},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,18,9,22,11,23,25,30,15,21,24},
+{1,13,3,23,5,16,15,25,17,2,26,6,7,10,9,30,27,11,4,29,12,14,10,16,19,12,7,5,8,29,6,23},
+{1,11,27,23,18,26,28,9,13,14,19,17,7,30,31,20,15,24,10,16,12,5,4,22,27,28,19,31,10,8,3,25},
+{1,19,15,10,12,8,29,22,9,14,25,3,2,17,30,20,24,16,13,27,18,28,25,26,27,9,7,16,29,11,20,12},
+{1,31,23,3,26,2,5,21,6,15,4,10,17,12,30,8,20,25,24,7,16,19,25,12,15,2,31,22,14,16,20,17},
+{1,25,26,12,31,11,23,10,14,16,2,15,9,24,3,22,19,20,28,29,4,30,9,12,17,19,10,7,4,15,26,6},
+{1,34,52,5,44,33,17,26,35,22,49,41,13,48,11,57,53,39,24,36,61,59,25,3,51,23,40,54,1,17,13,24},
+{1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,16,4,1,18,32,8,2,36,9,16},
+{1,11,18,8,15,62,23,47,2,22,36,16,30,43,46,9,4,44,31,32,60,1,46,47,1,46,47,1,46,47,1,46},
+{1,27,41,23,43,33,34,15,47,22,48,8,53,36,14,52,63,39,35,20,6,1,32,49,36,7,13,33,17,21,35,10},
+{1,46,10,11,37,47,36,1,46,10,11,37,47,36,1,46,10,11,37,47,36,1,23,50,21,28,16,54,40,22,37,39},
+{1,43,56,54,8,10,59,44,39,55,35,50,13,36,45,12,15,21,58,7,31,1,38,14,31,51,19,7,60,42,58,48},
+{1,14,57,48,35,11,15,55,9,19,40,4,56,62,26,59,44,60,6,36,33,23,8,56,31,48,39,47,23,8,56,31},
+{1,16,42,18,10,53,46,33,55,14,6,19,26,31,60,43,2,32,39,36,20,25,46,41,17,29,14,3,24,38,26,54},
+{1,4,16,53,62,18,61,30,13,52,58,2,8,32,31,9,36,15,60,26,29,1,2,4,8,16,32,53,31,62,9,18},
+{1,42,92,109,54,14,41,34,10,2,84,59,89,108,28,82,68,20,4,43,118,49,108,14,85,73,96,113,50,83,55,18},
+{1,2,4,8,16,32,64,9,18,36,72,25,50,100,65,11,22,44,88,57,114,109,109,109,109,109,109,109,109,109,109,109},
+{1,112,23,20,11,50,14,19,69,87,98,34,84,125,27,104,96,77,122,85,13,12,62,57,30,99,41,51,63,1,56,38},
+{1,93,23,90,55,63,2,43,46,37,110,126,4,86,92,74,77,109,8,61,41,5,77,126,2,93,67,94,120,116,9,48},
+{1,49,78,86,39,43,93,91,96,99,48,127,24,113,12,118,6,59,3,83,79,103,122,56,40,7,5,52,19,72,120,9},
+{1,100,87,75,106,20,116,90,3,11,94,122,25,60,59,73,5,29,69,41,43,68,117,31,21,8,121,9,75,53,5,93},
+{1,11,69,75,41,101,125,62,79,5,39,7,49,38,12,116,109,37,17,16,27,94,95,15,97,125,31,57,63,34,16,88},
+{1,98,11,32,69,18,3,31,29,96,118,54,5,33,39,25,35,90,15,99,105,43,110,103,21,115,87,84,7,46,34,28},
+{1,9,65,10,90,118,68,39,97,84,8,72,75,80,44,50,99,70,53,92,64,3,82,31,44,25,55,39,111,21,1,91},
+{1,3,5,15,17,51,85,62,66,7,9,27,45,119,88,41,123,76,21,63,65,2,3,98,83,26,23,124,66,99,50,43},
+{1,5,17,85,92,113,35,100,98,124,26,114,44,87,86,83,66,23,75,58,25,125,106,42,65,12,30,51,26,57,11,118},
+{1,66,106,52,88,70,23,58,91,83,122,102,96,74,67,40,94,108,30,81,45,97,4,87,106,26,22,60,81,127,69,1},
+{1,45,7,22,21,98,107,81,110,29,117,83,52,19,89,121,37,16,46,112,31,47,68,6,119,110,100,40,79,54,78,74},
+{1,126,105,17,83,27,46,21,97,117,106,118,13,40,62,56,19,74,44,12,86,87,102,16,100,110,34,83,127,121,30,49},
+{1,56,90,77,54,59,18,76,14,97,95,122,53,115,19,116,84,44,105,65,39,63,121,73,107,111,31,69,20,110,3,36},
+{1,64,35,88,73,69,112,6,98,59,50,84,124,51,20,95,107,93,26,27,91,120,16,38,125,65,73,90,28,68,24,53},
+{1,61,44,29,52,23,72,54,109,16,12,5,62,107,105,19,75,113,25,55,80,60,115,74,38,75,67,64,24,5,31,39},
+{1,40,92,95,39,62,34,75,9,111,79,84,24,52,53,29,65,30,57,7,37,110,77,2,40,46,86,36,35,79,42,6},
+{1,221,123,168,153,197,182,172,192,50,32,254,249,220,166,211,49,92,115,26,108,242,9,186,174,189,49,46,90,200,64,254},
+{1,133,2,23,4,46,8,92,16,184,32,109,64,218,128,169,29,79,58,158,116,33,116,158,58,79,29,169,128,218,64,109},
+{1,186,38,150,184,121,218,191,34,40,32,119,108,112,55,130,168,215,236,135,172,105,58,253,220,47,168,254,59,160,64,119},
+{1,173,151,109,74,205,111,61,206,181,169,121,107,211,200,44,172,58,250,39,135,162,41,225,247,220,144,186,54,228,64,179},
+{1,3,5,15,17,51,85,255,56,72,216,81,243,44,116,156,157,158,155,148,133,182,237,7,152,212,190,225,13,151,64,96},
+{1,11,69,153,160,28,196,209,70,132,111,136,27,245,53,200,165,59,170,82,24,232,125,23,223,18,83,150,251,180,64,95},
+{1,92,180,98,26,54,212,192,9,38,32,165,202,203,151,35,65,91,109,185,121,112,43,187,198,70,65,139,72,152,64,165},
+{1,231,52,223,108,156,8,250,255,101,129,195,64,18,58,201,43,133,190,144,143,213,172,85,190,72,116,201,186,217,64,9},
+{1,176,232,156,210,187,87,205,26,23,173,74,111,233,44,58,39,133,118,77,218,183,159,129,56,18,188,113,124,33,64,48},
+{1,211,194,50,166,27,144,94,44,6,32,70,172,123,90,207,161,232,20,192,241,71,141,119,13,251,161,116,5,24,64,70},
+{1,203,36,226,221,194,168,143,89,232,101,195,99,171,187,53,167,107,236,242,83,80,50,2,203,18,140,130,33,95,64,117},
+{1,185,93,203,22,29,171,70,101,239,32,48,40,60,34,51,146,219,14,9,181,87,98,145,136,102,146,213,187,47,64,48},
+{1,51,217,171,11,186,145,14,69,181,231,98,9,220,84,47,83,182,178,126,131,193,205,103,123,62,223,187,81,104,64,37},
+{1,194,240,82,24,147,213,170,59,17,32,191,158,227,141,60,169,6,122,214,151,80,206,2,194,120,169,3,163,68,64,191},
+{1,105,9,47,65,208,192,76,220,165,32,159,167,242,141,249,112,170,254,232,149,51,84,11,189,117,112,85,252,29,64,159},
+{1,179,208,177,61,154,212,224,107,195,32,21,45,85,7,15,173,1,179,208,177,61,77,53,28,30,173,197,78,26,64,21},
+{1,130,104,94,248,84,194,222,25,218,134,247,115,13,174,31,204,123,190,244,120,181,38,224,6,11,92,254,33,170,64,91},
+{1,147,45,176,140,37,245,123,231,72,204,172,174,23,77,178,53,127,10,252,173,61,29,151,96,1,134,163,22,111,64,139},
+{1,67,2,134,4,175,8,253,16,89,32,178,64,199,128,45,163,90,229,180,105,203,105,180,229,90,163,45,128,199,64,178},
+{1,254,113,238,34,243,216,40,91,224,32,166,58,93,31,175,57,246,140,52,95,74,242,19,124,247,57,123,35,210,64,166},
+{1,231,159,118,37,156,238,53,6,129,32,133,222,42,183,190,20,100,192,124,23,252,104,225,15,205,20,50,48,215,64,133},
+{1,61,223,253,110,93,89,173,171,37,32,233,48,67,40,188,60,226,34,147,51,4,122,223,160,197,60,113,214,148,64,233},
+{1,253,2,57,4,114,8,228,16,11,32,22,64,44,128,88,195,176,69,163,138,133,138,163,69,176,195,88,128,44,64,22},
+{1,55,120,172,244,75,8,119,94,13,156,9,64,38,161,104,66,72,81,255,101,222,199,144,81,152,141,104,33,18,64,19},
+{1,3,5,15,17,51,85,255,214,173,32,96,160,55,89,235,234,233,236,227,242,193,74,111,179,1,234,159,59,205,64,96},
+{1,45,159,106,231,96,8,181,54,234,76,186,64,187,109,36,7,195,103,203,210,253,28,91,103,139,218,36,237,169,64,179},
+{1,189,113,85,27,199,89,155,162,107,47,51,9,224,55,212,195,132,184,17,7,253,88,19,77,126,137,177,139,12,64,147},
+{1,145,71,216,189,41,174,222,61,72,107,182,203,74,186,56,136,195,232,151,199,185,60,149,11,113,57,245,33,6,64,157},
+{1,221,86,223,25,115,82,65,180,229,54,120,9,20,249,6,209,1,221,86,223,25,195,238,204,118,242,212,33,243,64,206},
+{1,80,161,235,142,14,146,211,205,176,84,24,100,208,61,170,144,115,118,159,177,4,160,161,137,223,131,54,148,101,64,39},
+{1,9,65,74,25,209,92,191,321,326,377,190,328,263,307,167,409,347,396,486,223,34,153,298,59,496,317,365,5,279,464,429},
+{1,405,484,135,79,68,36,334,221,101,152,468,50,398,24,338,488,46,187,83,369,111,446,350,424,318,285,214,266,372,454,322},
+{1,42,106,161,210,446,216,186,331,222,70,55,271,189,413,456,310,30,283,162,172,256,406,115,182,338,386,375,372,331,111,282},
+{1,97,239,338,448,215,6,326,121,449,182,233,20,441,278,176,431,109,120,416,89,443,234,342,34,92,47,39,419,125,303,463},
+{1,183,309,138,219,142,38,24,47,341,54,461,86,369,320,425,23,241,401,435,342,495,329,114,275,73,61,247,1,331,197,153},
+{1,332,167,9,437,453,65,243,302,100,284,234,361,328,461,184,401,358,290,503,207,134,70,48,267,467,54,242,49,429,103,356},
+{1,490,347,451,9,35,380,322,65,315,99,429,122,47,328,111,409,343,503,292,507,272,107,50,386,153,16,457,266,437,9,264},
+{1,231,220,216,271,52,287,437,357,399,390,132,101,160,251,367,420,3,297,356,360,346,46,383,311,425,107,174,422,451,403,319},
+{1,149,268,270,36,101,32,104,162,226,50,374,178,214,99,263,171,109,58,364,438,450,397,305,232,129,438,225,490,436,116,364},
+{1,317,188,453,301,404,294,24,444,445,128,60,505,212,320,102,126,450,127,255,195,314,247,260,25,367,504,475,127,336,167,415},
+{1,300,461,32,437,390,202,445,370,409,189,388,247,66,306,150,468,16,488,195,101,492,366,333,287,370,510,182,258,343,189,194},
+{1,172,212,254,103,440,241,248,486,297,156,426,164,358,229,300,233,71,459,157,262,112,204,276,294,309,125,283,93,22,70,391},
+{1,37,207,215,448,155,128,504,498,144,455,96,130,434,108,318,40,342,386,45,487,30,467,338,139,360,301,60,457,203,278,191},
+{1,10,68,223,479,116,319,45,306,95,49,490,438,409,191,104,487,452,154,266,495,404,349,199,428,389,264,454,71,347,217,458},
+{1,384,482,473,137,507,310,462,146,105,456,360,223,484,35,63,471,125,302,161,55,217,15,186,492,424,23,307,346,446,484,303},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,323,482,241,315,478,239,308,154,77,357},
+{1,468,70,92,406,245,210,19,448,384,14,12,305,445,261,188,342,242,212,449,84,72,40,454,41,300,370,109,214,126,54,30},
+{1,4,16,64,256,306,506,67,268,258,314,474,195,405,511,87,348,66,264,274,378,218,436,497,379,111,222,444,481,347,47,94},
+{1,78,10,79,68,69,11,1,78,10,79,68,69,11,1,78,10,79,68,69,11,1,39,339,268,509,61,246,309,407,258,23},
+{1,155,205,344,443,297,237,255,72,121,196,81,241,37,501,175,34,145,105,325,506,89,483,314,306,507,97,313,182,85,28,109},
+{1,180,214,232,426,199,416,337,333,48,171,119,265,78,488,430,184,87,94,20,387,474,353,243,186,456,299,367,336,427,366,266},
+{1,131,490,283,118,60,288,104,172,276,62,38,267,45,504,70,209,475,373,359,58,157,189,230,4,262,490,470,326,348,18,501},
+{1,459,331,394,446,219,472,186,434,486,290,54,78,296,203,201,482,457,96,417,23,282,55,412,489,289,107,277,391,164,260,490},
+{1,347,282,451,50,447,352,26,154,337,135,27,449,75,324,41,126,299,350,179,303,428,453,315,331,361,309,155,5,435,59,128},
+{1,345,23,53,277,266,179,286,444,50,233,367,56,262,505,506,192,249,166,328,135,338,312,45,168,344,167,352,36,426,175,422},
+{1,236,490,249,119,25,251,431,278,265,321,292,255,196,467,54,157,320,456,277,61,420,378,372,299,315,310,499,1,118,279,415},
+{1,400,397,415,220,117,472,363,462,375,76,441,378,200,444,437,110,320,236,463,231,449,19,275,73,187,119,380,33,94,125,435},
+{1,408,106,34,373,379,502,291,255,134,171,203,271,263,296,129,401,477,481,71,66,177,453,200,175,208,491,428,397,287,464,482},
+{1,508,412,35,400,308,262,160,448,468,492,86,491,161,60,72,463,454,223,423,156,392,397,394,113,324,313,374,490,302,104,173},
+{1,432,313,40,218,358,373,61,263,236,110,368,363,495,100,207,187,255,294,74,128,365,189,53,492,346,225,122,263,118,402,46},
+{1,337,357,63,330,153,106,22,32,205,103,458,184,502,276,469,319,264,180,379,233,209,131,489,451,261,180,311,255,498,317,469},
+{1,296,214,460,27,64,232,337,325,254,421,434,110,79,275,226,3,103,378,331,45,192,156,59,26,180,384,312,118,52,360,31},
+{1,114,144,156,487,353,439,250,473,119,298,367,40,348,55,471,488,140,129,392,414,468,191,79,136,309,242,181,501,480,398,89},
+{1,105,269,353,417,170,189,336,222,246,363,266,126,224,239,393,311,220,36,64,249,13,218,169,3,453,401,222,123,270,237,309},
+{1,385,3,440,5,499,15,302,17,73,51,219,85,365,255,140,257,404,56,391,72,434,108,296,45,222,211,453,270,93,345,247},
+{1,408,89,432,191,167,450,8,484,385,164,35,227,125,64,333,300,251,280,394,161,329,239,273,251,140,454,125,32,129,385,82},
+{1,29,337,501,413,68,426,296,481,57,458,25,293,352,215,174,186,286,144,291,302,431,263,381,195,133,77,264,135,80,7,398},
+{1,422,318,503,411,290,317,70,386,96,203,123,414,170,278,219,195,39,239,293,162,330,213,83,89,465,105,309,13,234,507,345},
+{1,126,185,479,474,92,352,257,369,93,286,440,174,391,322,216,431,246,287,454,23,88,76,33,285,157,129,276,346,261,500,118},
+{1,148,408,305,131,78,503,411,141,320,118,114,329,511,134,481,217,467,361,54,139,339,504,437,37,51,146,368,119,115,347,195},
+{1,465,383,412,132,313,296,91,8,81,150,340,407,459,323,437,64,485,263,462,268,129,187,7,64,324,300,340,381,287,296,411},
+{1,485,135,437,430,312,309,53,112,403,223,267,142,455,132,233,39,148,180,14,92,460,414,342,490,159,390,435,395,307,255,353},
+{1,193,108,356,299,427,72,440,231,306,112,5,186,476,373,6,505,360,422,4,123,432,439,299,362,18,55,390,494,222,39,368},
+{1,444,131,347,491,215,78,379,47,270,322,196,493,464,193,427,218,121,230,212,271,254,481,495,340,338,19,275,265,318,50,303},
+{1,180,435,23,366,222,277,289,454,238,173,475,473,177,88,118,293,153,316,241,242,302,58,311,14,131,68,317,485,372,181,324},
+{1,78,121,406,399,19,209,89,400,43,261,326,408,506,364,211,197,354,166,442,352,58,164,147,436,346,185,193,45,384,20,333},
+{1,407,117,180,263,74,350,31,484,364,141,320,108,253,341,202,358,463,439,123,192,36,156,104,319,205,174,33,278,237,169,60},
+{1,112,350,241,263,258,178,95,211,259,194,257,34,4,448,435,125,215,195,369,380,245,447,194,348,468,476,28,281,488,183,299},
+{1,24,320,56,391,293,265,366,111,449,251,250,226,418,410,29,312,49,351,304,241,10,120,487,54,360,508,130,406,445,73,171},
+{1,169,401,292,302,361,495,502,427,139,202,113,339,64,18,179,55,380,456,363,189,287,20,71,67,273,128,18,444,255,458,505},
+{1,189,33,475,86,497,501,204,72,190,486,440,502,267,43,286,284,102,36,95,243,220,411,333,338,427,65,222,294,187,49,180},
+{1,464,462,248,154,481,153,68,286,332,176,186,283,118,492,119,60,441,196,291,293,442,346,41,127,244,210,266,263,368,366,501},
+{1,199,187,78,44,213,504,391,59,404,447,230,486,395,372,274,302,310,113,381,95,38,388,185,224,442,114,26,392,498,301,467},
+{1,332,462,222,121,466,115,352,496,490,297,177,436,315,443,464,264,287,76,280,366,87,442,78,448,333,65,68,409,469,345,243},
+{1,501,251,370,459,218,183,280,404,350,497,253,375,56,36,54,45,463,220,178,235,362,283,49,282,319,42,491,117,297,464,156},
+{1,200,164,320,205,183,143,128,181,287,456,462,133,166,208,389,460,277,494,427,31,162,504,454,356,156,346,62,162,504,454,356},
+};
+
+static const uint16_t prescr_table_31_44497[127][32] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3},
+{1,4,6,5,2,3,7,1,4,6,5,2,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2},
+{1,5,6,4,3,2,7,1,5,6,4,3,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7},
+{1,3,5,15,2,6,10,13,4,12,7,9,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1},
+{1,11,10,1,11,10,1,11,10,1,11,10,1,9,14,3,2,11,5,6,4,15,10,12,8,7,13,1,9,14,3,2},
+{1,10,6,2,11,12,4,9,7,8,13,14,15,13,7,4,11,6,1,5,14,8,9,12,2,10,3,15,13,7,4,11},
+{1,20,29,24,22,16,7,3,25,2,13,31,21,22,8,26,31,24,11,4,13,29,12,23,2,20,28,6,25,1,10,14},
+{1,26,12,28,2,29,24,17,4,19,25,11,8,19,24,28,1,13,3,23,5,16,15,25,17,2,26,6,7,10,9,30},
+{1,4,16,30,9,11,3,12,31,13,27,29,5,10,20,7,14,28,23,1,2,4,8,16,15,30,19,9,18,11,22,3},
+{1,8,25,20,18,21,26,12,14,30,27,4,23,5,20,9,19,21,13,3,12,7,28,30,22,1,4,16,25,10,31,18},
+{1,28,18,27,11,19,7,25,8,12,10,15,21,1,14,25,4,3,18,16,12,5,13,11,20,15,23,29,7,17,2,28},
+{1,23,9,28,6,8,11,15,20,13,7,31,2,23,26,7,17,30,20,24,16,11,25,5,6,4,19,9,14,31,1,21},
+{1,22,24,25,15,23,14,1,22,24,25,15,23,7,49,18,32,47,5,39,30,23,7,49,18,32,47,5,39,30,23,7},
+{1,50,34,39,6,62,23,9,20,22,59,54,49,58,2,50,17,63,54,60,29,1,25,44,59,27,30,42,36,40,22,57},
+{1,27,25,47,29,20,46,6,13,1,27,25,47,37,5,16,33,51,9,29,10,32,21,49,18,58,20,23,42,53,36,35},
+{1,7,21,48,38,31,6,18,37,22,57,25,20,54,26,35,2,7,39,12,18,63,40,55,52,29,4,14,21,24,36,37},
+{1,7,21,10,54,33,37,57,12,36,62,25,46,4,14,21,5,61,8,28,42,10,27,16,56,53,20,54,32,17,11,40},
+{1,6,20,31,37,16,7,18,11,58,53,23,21,63,38,13,23,57,44,19,53,56,47,22,58,41,28,36,11,29,39,14},
+{1,36,28,47,62,49,52,55,54,18,14,33,31,23,48,8,39,56,47,31,23,48,8,39,56,47,31,23,48,8,39,56},
+{1,52,7,25,21,60,24,33,59,1,52,7,25,51,15,3,46,39,11,24,41,18,43,38,17,5,1,26,29,40,8,54},
+{1,46,51,2,41,19,4,39,38,8,59,57,16,59,38,4,41,51,1,23,43,29,34,45,26,50,22,60,54,63,15,55},
+{1,64,96,80,120,68,102,85,62,33,112,72,108,45,61,49,52,23,111,77,21,47,125,1,32,24,10,70,115,68,51,116},
+{1,116,120,44,40,99,24,33,8,31,127,114,82,23,48,33,4,97,120,22,10,63,69,39,17,37,101,25,110,28,53,122},
+{1,22,10,19,68,49,27,123,97,12,103,120,91,9,83,81,71,66,101,42,48,65,120,106,67,110,111,100,33,117,21,24},
+{1,85,87,108,83,26,45,25,67,113,102,21,72,49,116,106,15,122,114,4,59,87,54,120,39,103,32,107,109,3,55,26},
+{1,116,44,111,37,104,83,49,100,87,70,73,76,105,93,32,123,90,27,74,104,103,43,66,31,63,68,30,5,79,39,64},
+{1,35,115,84,12,125,111,34,80,39,88,113,18,117,79,26,94,14,78,88,107,87,103,58,85,68,80,64,22,51,60,48},
+{1,98,50,20,92,18,70,21,62,32,82,73,44,51,59,78,42,62,16,65,99,40,92,9,68,61,67,1,49,89,87,47},
+{1,90,58,56,53,65,49,91,96,2,13,116,112,53,124,34,50,6,87,39,18,110,76,126,120,47,8,26,116,56,70,62},
+{1,71,78,114,15,111,24,50,85,54,55,112,62,38,63,90,115,36,120,125,48,50,117,82,17,7,10,37,4,49,78,57},
+{1,10,68,46,111,99,27,47,101,39,53,64,6,30,102,124,14,54,47,82,89,126,4,20,68,23,75,36,117,35,110,84},
+{1,104,6,45,20,37,120,21,77,126,56,89,91,32,19,48,127,40,37,60,82,34,123,51,35,79,87,13,25,110,112,89},
+{1,17,116,10,121,4,68,118,40,66,16,101,126,80,66,8,68,59,10,85,1,97,29,92,36,71,75,45,98,109,123,19},
+{1,92,8,30,64,37,43,87,39,70,71,27,19,108,38,13,76,26,77,52,79,104,75,5,67,10,83,20,115,40,51,80},
+{1,124,109,28,67,85,127,12,78,103,117,101,104,45,20,105,19,54,24,78,65,36,16,116,126,56,67,88,84,115,33,51},
+{1,44,123,24,28,67,113,17,97,92,70,2,88,123,12,7,98,20,9,73,60,27,52,68,45,92,35,119,11,101,118,29},
+{1,78,119,121,105,52,61,37,46,91,79,57,14,8,43,31,121,76,13,97,49,44,27,20,59,73,71,79,100,123,2,78},
+{1,121,66,82,122,62,99,123,71,33,41,61,31,37,106,11,52,57,113,43,28,27,32,40,34,81,3,62,74,35,22,104},
+{1,120,43,108,89,126,60,107,54,82,63,30,75,115,53,109,110,42,10,98,61,119,56,70,88,3,68,32,104,95,74,79},
+{1,11,69,209,186,114,43,62,169,223,216,233,41,20,78,74,92,25,252,95,154,137,82,40,156,148,184,50,227,190,47,9},
+{1,128,19,117,24,156,181,140,93,161,94,60,107,223,217,68,208,62,59,102,184,33,168,85,228,191,252,241,150,110,130,7},
+{1,138,161,101,72,205,91,171,166,174,82,221,136,79,3,207,50,165,152,179,209,5,122,86,196,131,254,88,15,142,250,103},
+{1,95,242,179,101,85,238,41,47,192,182,107,24,243,118,248,193,226,109,237,100,5,7,88,33,208,249,120,72,131,111,178},
+{1,41,165,207,210,204,169,26,193,85,172,151,130,234,81,4,82,165,251,168,133,25,93,242,132,145,58,30,174,254,114,71},
+{1,23,42,8,184,111,64,3,57,126,24,247,177,96,209,177,96,209,177,96,209,177,96,209,177,96,209,177,96,209,177,96},
+{1,26,9,202,65,121,211,102,168,129,220,240,223,111,49,48,61,108,38,195,227,14,70,185,59,66,141,50,39,206,178,68},
+{1,223,8,101,64,201,190,213,140,53,67,247,166,61,19,122,38,244,76,183,152,49,111,98,222,196,227,215,153,241,109,189},
+{1,63,217,168,95,68,203,131,47,140,9,164,56,50,241,253,127,119,139,90,242,108,125,72,86,112,100,129,153,254,238,117},
+{1,141,152,188,236,130,13,234,3,242,205,161,81,195,238,204,22,107,126,108,120,158,172,239,56,48,206,155,39,81,195,238},
+{1,91,163,101,38,155,83,169,217,181,194,70,227,174,172,247,18,81,187,137,204,203,191,63,111,77,2,91,229,67,234,50},
+{1,78,98,19,135,209,116,147,205,250,158,88,226,148,43,117,214,207,51,174,235,250,79,22,64,170,119,152,254,211,116,241},
+{1,98,237,140,199,11,47,26,40,67,69,126,254,156,81,114,68,14,89,141,233,130,129,210,194,75,102,9,206,112,38,195},
+{1,146,33,142,150,159,10,88,49,128,112,42,68,67,199,160,54,196,123,112,21,17,78,111,40,176,49,64,28,230,231,174},
+{1,213,49,99,19,23,77,137,130,206,146,33,140,197,111,189,55,10,143,185,26,59,125,220,40,181,109,104,236,115,126,160},
+{1,162,90,106,150,179,172,170,112,39,208,178,14,120,195,128,219,191,140,1,81,211,170,56,107,26,157,122,97,173,4,207},
+{1,72,91,160,211,226,207,187,255,222,208,58,34,107,164,63,165,27,22,15,81,181,204,247,194,130,196,90,116,34,107,164},
+{1,143,226,10,36,168,68,247,205,9,42,17,90,130,229,131,109,116,196,222,105,245,38,219,96,224,138,120,216,103,102,238},
+{1,90,224,201,114,1,90,224,201,114,1,90,224,181,205,141,89,7,195,168,170,240,128,11,188,43,214,4,180,224,181,205},
+{1,241,36,121,79,222,98,211,128,238,46,183,142,91,161,120,95,234,92,183,71,249,132,60,251,117,46,143,247,168,66,30},
+{1,161,215,35,57,137,18,30,231,165,128,29,181,238,85,190,144,120,127,165,64,107,248,169,228,163,18,15,141,250,8,87},
+{1,114,70,136,216,168,10,14,123,222,57,35,68,54,21,55,44,248,61,43,87,151,92,169,60,18,152,134,143,195,128,25},
+{1,70,121,224,101,164,144,182,246,216,237,141,180,61,235,109,137,214,134,228,95,80,98,187,15,50,217,180,61,235,109,137},
+{1,152,117,164,165,61,72,236,73,116,60,208,153,145,160,74,238,91,192,201,180,215,128,142,216,154,69,244,144,236,195,29},
+{1,199,60,5,117,204,17,118,82,85,121,205,214,37,96,4,89,60,233,131,242,205,107,249,48,2,199,30,159,170,121,141},
+{1,169,224,173,35,151,240,27,203,97,167,247,254,6,38,144,228,55,113,230,158,1,186,56,46,83,249,154,142,90,128,191},
+{1,93,25,249,166,5,206,125,211,23,17,56,110,219,107,188,254,105,225,1,221,140,90,197,222,12,41,43,118,137,61,80},
+{1,227,50,216,221,84,174,240,191,72,75,157,203,40,49,7,94,222,65,62,51,228,71,232,24,190,172,155,74,63,187,17},
+{1,25,180,9,209,223,65,120,6,86,82,54,249,148,155,34,124,49,91,137,243,233,92,84,48,173,164,54,134,74,183,17},
+{1,180,102,252,90,51,126,45,229,63,234,142,227,198,147,210,77,213,50,101,144,60,155,9,129,41,31,235,29,95,46,96},
+{1,396,432,147,230,368,357,8,106,394,158,309,399,402,16,106,197,294,230,184,472,1,198,108,82,78,266,284,481,76,134,452},
+{1,33,35,97,39,229,171,353,55,228,138,322,86,361,407,127,244,333,468,324,72,134,103,376,391,375,120,399,499,62,494,232},
+{1,262,479,483,209,80,431,508,334,196,440,15,327,215,309,213,51,305,206,492,203,372,486,507,313,248,69,296,23,498,396,419},
+{1,454,109,213,191,270,178,396,24,147,398,399,73,18,439,143,20,486,473,205,22,32,226,371,335,382,270,89,99,3,293,171},
+{1,488,224,220,296,195,58,454,394,16,367,231,262,452,301,116,454,197,4,497,224,110,74,212,343,104,83,68,270,7,237,168},
+{1,90,44,76,10,73,312,213,68,247,297,373,133,262,509,419,257,318,402,43,229,293,112,222,317,485,54,489,490,413,384,140},
+{1,138,113,398,255,484,181,374,158,6,271,294,322,257,278,251,486,457,101,485,262,205,34,230,154,279,190,111,372,197,57,4},
+{1,130,72,32,83,44,150,263,278,152,198,173,344,474,510,502,437,293,261,9,2,130,36,8,67,144,32,268,11,128,166,44},
+{1,222,472,124,440,200,371,217,411,454,204,82,338,281,229,337,424,127,109,168,463,296,167,483,387,473,81,24,314,98,132,356},
+{1,267,278,444,71,396,126,410,178,200,448,404,333,487,53,208,342,240,321,316,336,434,220,397,405,35,182,45,358,451,107,10},
+{1,204,227,372,124,394,448,64,215,230,237,374,484,38,202,23,509,474,374,242,19,101,313,460,237,187,121,315,256,430,230,324},
+{1,479,378,11,495,506,69,63,168,142,441,106,304,14,463,346,150,456,137,59,387,109,331,170,408,73,315,461,133,43,100,343},
+{1,199,384,283,229,69,290,498,346,180,262,202,189,164,10,436,431,454,184,126,490,343,499,505,77,482,36,156,226,264,95,428},
+{1,426,258,81,9,456,206,174,65,205,39,304,62,30,218,278,82,64,392,495,255,36,487,206,87,438,497,37,306,437,142,479},
+{1,354,90,288,209,6,459,476,71,155,20,64,50,201,488,15,24,491,476,285,391,316,4,185,90,144,171,417,469,222,27,56},
+{1,435,268,232,129,355,430,493,471,21,236,452,93,263,280,408,496,155,265,15,141,342,187,275,244,426,84,472,452,365,448,140},
+{1,16,256,386,355,13,208,235,462,137,81,58,309,361,284,33,264,129,290,465,502,206,463,262,241,55,440,43,344,148,394,443},
+{1,63,103,96,221,488,200,66,232,9,455,454,505,207,307,209,118,155,254,241,287,314,382,331,247,350,34,342,222,408,190,186},
+{1,468,144,364,120,47,494,104,88,193,275,61,146,354,86,347,276,378,393,152,3,318,108,295,345,192,306,466,151,131,226,145},
+{1,374,499,144,106,422,136,419,364,115,281,433,456,222,66,172,295,494,268,92,37,31,50,191,462,481,26,192,203,404,251,93},
+{1,483,298,80,469,141,294,215,352,482,201,378,389,172,193,192,358,123,113,495,385,453,491,232,239,451,353,343,211,473,5,207},
+{1,253,262,320,113,467,179,6,185,461,89,294,388,469,5,223,28,136,203,471,248,92,76,125,267,316,333,255,126,211,165,309},
+{1,388,396,159,460,78,416,365,350,194,198,273,230,333,52,61,296,238,154,401,162,462,419,174,428,394,288,313,319,270,68,131},
+{1,507,446,20,134,92,272,324,302,503,121,32,118,501,160,215,184,272,162,300,103,277,1,410,264,357,310,91,464,56,508,391},
+{1,304,15,246,85,208,466,274,234,264,100,414,205,439,222,10,82,369,419,122,57,453,389,465,289,482,182,278,196,77,287,318},
+{1,267,460,429,469,76,471,129,148,256,485,408,144,77,110,392,423,278,438,273,408,72,331,55,196,446,139,219,485,204,36,456},
+{1,267,225,289,373,168,335,315,232,339,387,416,70,486,453,310,174,53,98,258,307,434,81,136,474,414,371,444,127,161,484,206},
+{1,154,177,327,262,401,9,440,203,155,43,502,65,311,102,105,283,382,448,365,53,230,100,243,63,237,34,39,350,381,279,219},
+{1,95,90,377,75,469,178,49,330,447,222,415,312,492,384,343,203,423,234,251,173,83,495,112,236,26,218,497,20,327,306,207},
+{1,432,313,40,218,358,373,61,263,236,110,368,363,382,25,498,435,125,28,345,393,108,264,395,476,29,385,138,105,419,433,461},
+{1,72,387,313,132,140,473,405,310,41,374,255,3,108,100,324,343,110,44,15,476,500,363,308,470,156,51,134,14,504,219,164},
+{1,220,95,167,240,137,414,270,302,329,235,143,73,102,191,201,168,285,251,278,38,216,24,177,450,489,136,161,284,149,454,81},
+{1,430,361,151,362,326,498,255,367,22,90,279,200,263,408,467,482,18,82,484,451,30,211,380,142,352,499,313,400,301,19,133},
+{1,288,163,475,298,325,214,128,231,483,510,180,375,242,31,389,237,410,360,375,242,31,389,237,410,360,375,242,31,389,237,410},
+{1,194,409,82,323,353,381,484,410,276,211,407,387,190,468,103,115,401,26,151,330,383,48,170,54,492,254,76,47,472,464,483},
+{1,255,26,265,324,130,50,16,413,416,366,101,223,400,64,115,416,183,203,260,50,8,181,52,265,162,388,212,1,475,418,72},
+{1,327,137,74,439,383,414,340,116,428,24,481,484,55,99,206,337,255,436,347,373,325,164,86,490,124,27,276,204,22,284,1},
+{1,412,407,484,466,434,56,329,193,467,46,431,173,292,355,212,101,104,3,338,469,488,76,35,273,1,206,179,401,269,296,454},
+{1,332,349,316,92,399,432,166,286,158,46,375,216,409,331,269,131,253,491,311,343,321,210,70,398,126,278,220,96,22,403,148},
+{1,170,369,63,469,308,232,411,240,172,486,463,343,398,404,16,237,121,126,469,154,58,94,15,104,198,159,315,28,122,129,491},
+{1,59,242,314,173,135,147,162,510,106,13,271,285,219,263,468,63,15,266,229,163,340,38,144,449,58,466,114,132,111,109,86},
+{1,420,52,365,133,429,380,249,426,149,117,335,125,360,274,311,6,415,46,49,486,381,279,478,63,15,315,75,451,76,142,111},
+{1,280,99,437,382,303,292,462,268,248,247,508,178,182,505,410,255,287,341,39,417,333,379,235,237,186,343,319,47,64,395,206},
+{1,125,103,42,291,258,203,477,56,259,182,442,18,16,109,412,84,291,129,273,75,449,383,86,350,368,217,316,99,239,268,212},
+{1,222,173,118,242,274,78,489,108,243,460,227,415,79,348,276,325,98,43,21,61,153,58,404,9,152,85,155,228,5,467,418},
+{1,443,99,403,203,111,192,510,220,343,155,319,153,244,303,353,502,448,427,284,208,2,443,481,348,133,368,6,364,386,69,399},
+{1,89,392,488,288,461,310,340,302,358,504,111,58,271,10,317,97,402,180,355,440,198,35,224,391,141,451,276,444,116,427,20},
+{1,90,465,118,191,412,330,493,115,397,123,228,23,426,73,42,89,323,111,431,208,353,350,247,201,333,489,337,348,173,509,140},
+{1,403,383,84,155,462,52,72,412,396,266,80,345,478,89,423,376,114,90,286,138,398,278,328,183,322,230,295,167,257,339,399},
+{1,223,428,58,34,91,281,162,89,167,49,45,227,422,117,424,419,65,111,174,192,484,335,443,408,474,224,243,200,339,476,385},
+{1,492,183,316,101,507,460,487,282,266,418,433,224,149,474,184,443,438,383,414,509,287,102,1,246,312,449,476,321,177,359,480},
+{1,137,27,450,325,394,202,56,133,477,374,163,482,294,336,78,182,122,509,213,495,107,100,416,371,263,144,399,217,268,70,327},
+{1,49,362,168,480,184,297,6,166,206,41,43,73,162,5,406,220,65,102,264,318,44,111,56,389,145,129,265,202,410,122,38},
+{1,484,24,500,320,116,280,197,414,465,417,239,74,225,444,421,429,507,459,63,159,130,161,239,37,385,222,291,295,268,276,494},
+{1,231,155,275,284,170,97,36,52,480,38,506,214,256,260,202,81,300,363,388,72,52,240,509,197,138,16,234,389,463,284,85},
+{1,143,133,494,193,122,6,217,229,105,381,284,20,363,362,208,498,305,387,448,289,502,47,262,311,18,250,80,417,421,187,62},
+};
+
+static const uint16_t prescr_table_32_521[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,5,7,6,3,4,2,1,5,7,6,3,4,2,1,5,7,6,3,4,2,1,5,7},
+{1,7,2,3,4,6,5,1,7,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2,7,1},
+{1,1,1,1,1,1,1,1,1,1,9,13,15,14,7,10,5,11,12,6,3,8,4,2,1,9,13,15,14,7,10,5,11},
+{1,10,11,1,10,11,1,10,11,1,5,8,3,15,1,5,8,3,15,1,5,8,3,15,1,5,8,3,15,1,5,8,3},
+{1,12,13,1,12,13,1,12,13,1,6,11,4,7,13,15,3,10,2,12,9,8,14,5,1,6,11,4,7,13,15,3,10},
+{1,30,19,17,8,11,12,28,10,18,21,29,10,9,24,28,5,22,12,14,16,11,6,7,8,23,3,17,4,25,19,26,2},
+{1,2,4,8,16,9,18,13,26,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29},
+{1,24,23,12,28,6,14,3,7,22,10,9,29,15,26,4,31,23,6,7,11,5,19,25,16,13,2,24,28,3,20,18,21},
+{1,7,21,5,27,24,17,25,22,12,18,8,28,29,5,22,6,9,4,14,21,25,11,3,31,2,7,17,23,30,26,20,1},
+{1,4,16,13,15,7,28,6,24,22,23,21,17,25,9,18,31,5,10,20,19,29,1,2,4,8,16,27,13,26,15,30,7},
+{1,10,3,30,5,31,15,28,17,25,7,27,13,4,20,3,15,14,11,26,8,21,6,30,28,22,9,16,23,12,1,5,17},
+{1,42,55,18,41,10,8,31,50,22,34,20,8,46,45,18,53,35,1,21,29,51,30,12,57,26,27,14,19,32,62,50,11},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,47,46,1,47,46,1,47,46,1,60,32,31,44,4,9,46,43,30,16,36,22,2,47,23,62,15,8,18,11,1,60,32},
+{1,17,54,15,18,5,14,3,51,1,37,32,39,49,60,36,5,7,22,13,24,33,2,17,27,21,57,35,19,10,14,44,26},
+{1,18,35,56,58,30,57,40,61,1,9,32,7,63,34,21,30,44,10,59,6,54,2,18,33,14,31,37,42,60,57,20,23},
+{1,46,41,45,60,49,44,18,24,1,23,32,35,26,29,31,49,22,55,3,57,7,2,46,39,33,52,58,62,5,44,9,6},
+{1,9,44,34,49,13,8,37,14,19,30,26,8,36,53,34,46,24,1,50,11,31,40,3,59,29,33,21,5,32,39,14,63},
+{1,62,48,29,23,36,8,60,63,14,47,59,8,30,19,29,50,9,1,31,12,17,35,42,43,52,56,41,10,32,11,63,7},
+{1,36,2,61,4,15,8,30,16,60,16,30,8,15,4,61,2,36,1,18,58,9,29,62,52,31,26,53,13,32,60,16,30},
+{1,46,76,116,48,50,110,117,30,126,13,112,68,1,23,19,79,3,57,53,82,5,75,95,117,15,94,98,28,17,97,37,36},
+{1,62,14,102,84,64,110,63,48,104,25,5,99,73,89,50,10,79,27,59,100,20,23,54,118,65,40,46,108,101,11,80,92},
+{1,5,17,85,31,99,126,23,75,121,6,15,94,28,54,119,29,115,23,98,122,70,32,80,7,74,62,99,63,38,95,89,86},
+{1,24,98,11,121,65,69,37,30,50,122,124,84,7,36,3,20,97,89,91,67,114,28,1,12,80,55,70,78,46,123,112,4},
+{1,44,37,83,100,70,76,78,22,92,125,66,126,120,12,117,111,52,43,62,42,40,4,88,37,103,25,97,109,24,119,67,104},
+{1,35,115,84,12,125,111,34,80,39,44,102,120,96,29,121,34,40,32,11,74,30,24,125,100,91,10,8,43,65,84,6,101},
+{1,9,65,78,57,12,108,93,25,122,40,31,38,32,59,15,110,114,12,54,104,105,56,87,116,23,2,9,117,70,109,42,22},
+{1,57,48,10,113,43,68,69,124,76,35,127,95,89,18,58,97,74,104,87,4,114,48,5,50,60,42,98,51,124,38,77,99},
+{1,81,36,43,41,52,124,42,120,16,116,47,86,41,26,31,117,88,95,100,91,121,127,51,5,106,45,7,59,63,34,6,76},
+{1,118,103,58,37,122,72,24,94,68,123,31,79,108,10,44,92,84,14,1,59,73,55,62,95,25,20,88,121,105,28,2,118},
+{1,80,50,60,112,17,36,62,27,117,46,82,73,22,1,40,105,98,7,19,66,115,21,121,88,4,107,50,30,28,76,85,90},
+{1,86,15,94,85,38,79,100,10,37,51,64,29,35,26,33,76,79,50,107,42,28,8,45,30,94,67,96,122,91,23,88,106},
+{1,28,47,96,3,36,113,117,5,108,35,120,46,62,11,98,119,116,102,79,91,86,16,53,105,21,3,18,41,20,13,70,37},
+{1,55,99,95,23,97,49,52,58,31,123,22,43,102,90,126,17,27,21,117,118,40,56,74,12,87,64,2,55,67,92,39,49},
+{1,7,21,107,32,15,45,44,43,62,93,81,67,124,85,77,105,23,69,117,61,46,101,5,122,92,37,10,27,87,74,20,54},
+{1,63,10,100,68,44,127,43,51,29,14,76,27,79,67,48,46,120,75,61,58,28,105,54,111,119,96,92,1,103,122,116,56},
+{1,94,51,92,120,58,55,61,67,83,103,115,13,5,100,2,94,98,23,15,91,6,21,81,57,17,26,10,63,4,75,51,46},
+{1,45,77,122,33,107,47,23,29,40,106,1,104,44,48,76,85,27,99,32,35,102,18,66,107,105,68,28,124,25,78,120,67},
+{1,167,227,7,88,159,21,147,240,107,106,180,202,100,236,8,170,221,7,44,97,103,149,138,67,94,48,209,248,18,232,93,73},
+{1,133,2,23,4,46,8,92,16,184,16,92,8,46,4,23,2,133,1,204,142,102,71,51,173,151,216,197,108,236,54,118,27},
+{1,210,44,220,252,127,120,16,212,150,26,141,254,120,8,53,88,220,126,85,15,1,105,11,142,69,101,177,250,247,36,91,103},
+{1,202,188,192,187,236,248,246,174,40,14,44,183,144,215,99,92,250,177,227,53,51,64,162,242,238,182,245,248,123,189,5,220},
+{1,56,157,36,79,54,244,45,142,167,248,26,33,215,101,8,224,3,36,187,145,130,95,226,59,246,178,109,232,227,39,159,42},
+{1,44,172,159,22,86,208,11,43,104,77,189,153,127,112,162,20,7,98,209,140,110,57,71,33,168,136,54,149,151,187,237,133},
+{1,240,163,159,66,144,38,2,173,11,159,33,36,241,143,15,50,130,205,71,157,209,211,35,212,6,93,84,59,237,27,177,55},
+{1,12,80,33,211,168,34,199,88,65,217,104,47,226,242,146,141,207,28,72,239,220,118,107,37,222,122,67,213,64,223,124,87},
+{1,230,134,120,112,10,213,176,149,197,34,18,156,157,238,126,113,118,76,25,52,33,135,79,140,231,48,142,1,115,144,15,7},
+{1,22,113,13,254,247,81,7,98,50,163,12,116,147,185,242,189,222,204,106,65,1,11,69,45,122,241,160,17,187,228,55,132},
+{1,111,23,139,124,73,171,203,123,45,103,106,226,48,44,228,129,132,217,37,178,68,105,14,100,134,182,154,126,255,123,162,135},
+{1,230,79,246,99,179,62,212,134,167,180,55,18,240,210,24,29,211,107,234,41,84,243,71,112,98,146,64,88,69,150,253,23},
+{1,22,99,72,236,34,2,44,198,144,236,17,187,190,153,191,146,250,155,169,24,232,61,216,154,162,93,225,110,91,219,135,109},
+{1,125,23,194,110,90,240,177,105,82,247,225,3,254,237,118,199,78,231,132,95,1,131,91,251,148,58,93,124,53,214,168,224},
+{1,89,27,40,194,182,213,60,163,237,62,203,87,198,233,140,208,67,53,158,200,225,111,230,107,84,112,64,131,55,199,6,235},
+{1,84,194,13,178,224,81,77,209,139,198,107,43,223,167,207,154,209,128,99,240,208,170,150,162,77,173,64,244,120,104,85,75},
+{1,247,76,207,75,157,34,103,94,174,88,195,70,144,9,123,139,132,107,138,57,120,193,177,182,159,230,154,56,197,210,250,62},
+{1,101,134,62,163,8,22,237,111,90,32,44,237,248,217,8,11,147,62,158,2,101,67,192,232,207,177,119,48,58,84,132,122},
+{1,67,2,134,4,175,8,253,16,89,16,253,8,175,4,134,2,67,1,240,209,120,185,60,141,30,151,15,154,214,77,107,247},
+{1,153,238,180,216,144,224,39,58,44,131,230,197,67,166,98,185,240,80,48,16,151,234,193,216,72,56,143,226,94,173,252,84},
+{1,125,171,120,147,172,186,160,117,33,67,96,94,179,243,8,69,231,120,145,43,123,10,56,106,102,217,149,209,208,54,168,167},
+{1,42,119,94,87,144,37,76,100,71,165,7,107,62,92,223,193,250,231,227,183,192,239,75,89,158,26,111,106,43,240,101,232},
+{1,253,2,57,4,114,8,228,16,11,16,228,8,114,4,57,2,253,1,159,225,174,145,87,169,202,181,101,187,211,188,136,94},
+{1,35,167,189,77,51,198,23,136,65,52,240,63,169,80,21,103,48,182,152,16,215,205,181,77,254,214,59,239,247,172,224,232},
+{1,214,234,189,159,8,59,12,205,10,32,118,12,141,233,8,246,3,189,164,2,214,117,177,41,235,222,131,178,148,79,220,85},
+{1,31,136,77,47,255,211,13,155,65,187,227,61,118,174,196,208,22,217,139,54,244,5,223,170,250,88,222,75,216,106,20,198},
+{1,29,182,72,52,45,239,86,165,88,242,112,177,254,62,140,146,41,190,80,134,251,249,228,191,173,88,242,112,177,254,62,140},
+{1,130,177,88,109,110,27,59,211,100,107,66,106,3,195,8,29,145,88,207,226,61,229,9,92,56,83,17,123,120,187,179,174},
+{1,165,37,72,47,20,184,219,107,83,136,71,212,246,96,85,146,138,226,60,228,38,41,16,227,148,144,47,10,46,162,90,171},
+{1,39,3,105,5,187,15,52,17,92,229,57,201,144,212,108,95,45,70,159,206,22,168,242,126,185,220,240,89,68,184,51,114},
+{1,3,5,15,17,51,85,255,257,256,384,320,480,272,408,340,510,257,128,192,160,240,136,204,170,255,385,64,96,80,120,68,102},
+{1,136,113,197,427,71,168,505,146,455,326,3,204,424,487,386,410,457,239,416,470,352,351,20,370,437,224,77,237,296,230,469,428},
+{1,129,246,130,373,408,243,16,76,261,62,506,295,243,8,19,492,130,433,102,343,1,331,310,414,241,137,104,199,352,163,182,217},
+{1,175,280,469,154,153,360,91,63,401,29,493,291,380,304,455,428,375,98,294,376,110,223,75,92,441,61,362,399,5,4,350,280},
+{1,49,323,236,133,505,376,69,115,423,480,248,184,251,385,130,183,356,28,302,170,322,382,353,374,421,465,329,131,447,172,273,396},
+{1,19,261,26,398,387,324,147,49,366,48,424,210,92,191,84,243,115,233,180,276,394,497,340,455,201,388,392,482,192,215,357,368},
+{1,168,19,391,261,414,244,37,197,12,451,53,93,79,449,157,333,162,299,475,384,55,245,351,300,119,11,111,446,5,260,155,181},
+{1,299,483,481,508,113,504,75,169,274,194,272,489,196,38,478,222,323,214,377,347,152,421,307,410,275,370,506,43,73,90,181,218},
+{1,488,10,326,68,472,241,166,129,206,220,507,470,126,286,195,234,203,417,223,231,253,145,168,70,260,175,211,37,227,372,155,11},
+{1,505,200,332,36,81,420,60,174,71,211,476,176,8,261,400,332,18,428,283,148,271,364,184,269,149,220,350,446,183,399,411,99},
+{1,459,417,158,98,92,170,4,387,43,316,98,46,280,306,473,330,220,188,345,419,388,200,44,211,208,204,479,370,159,486,230,308},
+{1,473,366,436,255,170,204,136,240,160,96,32,455,189,107,510,170,102,34,30,10,6,2,473,183,109,508,371,209,79,482,377,215},
+{1,462,422,458,47,483,438,351,139,310,419,497,104,54,469,270,450,169,448,359,275,34,347,129,220,22,320,348,91,247,35,444,479},
+{1,282,329,451,387,63,98,289,429,296,486,347,460,168,341,19,155,417,81,351,399,481,143,238,210,372,241,140,377,185,212,45,39},
+{1,287,100,472,383,314,311,418,267,135,377,449,442,49,216,212,17,189,393,502,62,179,83,360,380,51,455,230,103,66,469,245,453},
+{1,162,220,317,432,227,142,181,265,507,438,212,466,468,50,128,240,170,97,21,267,284,181,455,223,302,53,311,117,335,32,60,361},
+{1,339,484,500,108,208,364,19,248,5,464,413,398,498,342,290,480,201,511,224,482,410,269,157,165,407,187,93,223,83,473,24,170},
+{1,385,334,23,162,361,277,435,373,106,398,158,284,438,481,263,467,86,362,459,62,357,498,205,97,44,291,351,268,113,491,297,369},
+{1,76,14,363,84,331,507,139,334,135,271,155,100,177,158,218,493,259,307,118,62,161,93,226,408,343,199,160,123,432,481,171,289},
+{1,59,15,377,85,220,422,446,371,507,93,130,293,181,234,83,35,97,213,368,219,465,415,433,5,313,503,199,147,434,369,404,41},
+{1,158,460,458,33,471,53,243,351,481,178,254,92,268,401,422,22,12,491,251,303,179,177,47,201,492,278,118,182,450,400,489,101},
+{1,458,280,174,293,341,213,430,282,397,209,500,5,454,350,239,381,179,284,372,167,477,354,428,327,281,178,505,306,31,287,91,109},
+{1,367,212,43,375,253,319,34,404,334,38,169,473,28,297,145,310,318,504,80,123,414,270,465,218,129,186,211,430,295,347,32,421},
+{1,291,237,418,476,16,470,114,53,132,128,9,228,53,66,64,355,114,381,33,32,470,57,473,375,16,235,379,395,476,8,274,474},
+{1,90,191,401,104,13,307,200,25,89,320,20,181,146,83,114,93,500,171,277,136,352,22,239,421,131,127,428,454,242,85,156,469},
+{1,201,77,140,484,475,489,456,35,121,96,435,469,317,494,182,112,150,225,37,10,310,465,175,419,240,9,246,338,496,311,216,359},
+{1,72,247,117,97,43,76,471,348,437,429,56,255,96,331,489,137,326,125,106,35,262,92,292,382,130,10,360,239,213,98,259,232},
+{1,190,339,406,281,248,62,371,414,283,194,166,470,504,63,410,141,306,152,19,227,253,316,347,202,167,393,110,463,420,328,41,90},
+{1,511,409,391,385,128,213,196,193,192,287,425,68,10,1,383,166,272,40,4,255,409,323,160,16,253,102,15,385,64,245,408,60},
+{1,92,177,205,406,188,18,77,24,262,362,445,425,226,388,497,395,75,232,168,322,56,118,8,368,354,205,203,47,335,478,196,405},
+{1,347,289,234,153,175,414,56,103,297,38,436,88,376,42,68,46,487,271,402,492,288,338,110,106,457,232,157,126,204,114,316,4},
+{1,369,50,96,37,130,132,412,304,112,87,359,351,251,455,231,277,121,389,128,307,126,62,296,279,264,412,152,28,210,158,144,249},
+{1,126,192,354,22,162,303,413,276,5,195,240,452,497,71,210,28,471,355,52,393,165,443,430,446,365,334,169,191,238,109,242,442},
+{1,465,146,245,376,308,33,374,508,447,321,122,230,352,193,153,101,143,90,301,163,36,344,337,263,415,138,441,3,161,501,273,416},
+{1,503,35,158,328,288,176,484,479,496,456,211,257,480,423,95,61,168,311,115,412,469,165,302,208,400,170,192,511,38,508,183,182},
+{1,486,296,337,488,506,140,418,380,246,60,289,245,297,511,48,174,196,372,369,263,101,298,234,238,107,323,79,53,216,422,59,177},
+{1,195,41,274,400,155,66,103,432,460,510,183,232,505,52,12,453,123,411,172,296,450,248,383,144,359,85,401,44,201,307,2,195},
+{1,31,341,208,305,353,487,18,462,78,230,28,186,29,280,307,258,424,333,236,127,76,249,283,142,299,390,224,61,232,65,281,145},
+{1,231,192,62,374,206,247,85,442,503,145,268,56,402,291,186,64,298,388,496,123,412,247,410,478,314,126,401,7,234,144,207,8},
+{1,253,70,132,54,311,152,128,169,47,324,22,57,381,363,338,47,324,22,57,381,363,338,47,324,22,57,381,363,338,47,324,22},
+{1,448,126,71,229,37,19,159,440,270,211,482,77,478,17,57,81,48,363,357,402,303,385,214,495,410,245,381,145,43,328,503,153},
+{1,276,282,381,334,100,124,375,236,426,290,457,473,288,221,340,26,40,55,462,284,328,125,392,452,461,130,58,474,190,431,243,300},
+{1,57,192,325,109,8,456,254,298,23,32,239,254,149,218,8,228,384,325,393,2,57,96,305,258,447,366,24,300,511,176,484,6},
+{1,100,294,479,41,464,432,262,206,145,304,292,329,120,366,428,382,265,361,306,320,474,300,217,433,177,122,266,319,42,190,372,253},
+{1,144,306,233,349,75,297,362,82,394,199,308,3,216,274,401,449,404,169,301,405,225,166,282,94,42,381,448,476,290,418,298,109},
+{1,67,40,31,163,185,341,356,82,184,139,83,429,415,182,322,63,338,390,498,440,337,52,492,456,413,245,342,256,474,103,65,87},
+{1,343,45,286,142,272,165,150,197,168,418,77,144,500,459,160,33,23,398,435,399,194,361,470,506,4,283,45,143,505,34,49,164},
+{1,140,445,76,177,80,197,9,39,264,278,416,90,187,301,286,41,153,247,169,266,410,162,73,218,296,64,277,362,473,381,160,197},
+{1,70,304,300,490,402,186,72,339,272,191,139,473,370,130,226,153,104,355,342,39,192,246,482,465,106,293,462,108,495,102,177,345},
+{1,399,122,102,109,424,317,364,376,492,25,23,231,84,509,420,4,213,122,51,268,53,86,114,409,504,83,389,24,309,284,170,446},
+{1,150,51,37,338,261,70,27,147,304,109,365,41,16,231,204,74,338,356,503,367,191,495,29,21,384,486,451,362,472,197,404,45},
+{1,5,17,85,257,378,237,140,361,178,317,219,49,400,61,398,14,27,465,373,111,259,184,300,283,132,330,484,239,67,333,3,493},
+{1,454,217,203,495,368,235,212,243,241,82,425,16,340,189,406,495,184,288,502,421,239,63,511,492,413,96,74,87,287,9,73,370},
+{1,247,23,474,277,120,361,302,27,411,265,403,310,445,236,198,242,414,365,377,233,162,24,65,114,397,110,34,11,322,297,367,398},
+{1,33,58,168,383,227,34,89,230,135,433,335,372,196,111,225,48,241,312,25,104,358,493,154,411,19,205,271,367,141,276,294,502},
+{1,118,301,435,231,368,355,367,252,311,193,180,402,291,102,288,43,259,240,82,273,205,384,286,436,303,338,428,188,74,130,469,174},
+};
+
+static const uint16_t prescr_table_32_607[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,1},
+{1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,6},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,2},
+{1,9,13,15,14,7,10,5,11,12,6,3,8,4,2,1,9,13,15,14,7,10,5,11,12,6,3,8,4,2,1,9,15},
+{1,12,6,3,13,10,5,14,7,15,11,9,8,4,2,1,12,6,3,13,10,5,14,7,15,11,9,8,4,2,1,12,3},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,28,23,13,24,8,27,9,7,30,10,6,2,29,11,26,21,16,19,18,14,25,20,12,4,31,22,17,15,5,3,1,14},
+{1,6,20,3,10,21,5,30,22,15,11,19,17,29,28,26,14,13,7,18,23,9,31,16,27,8,25,4,24,2,12,1,3},
+{1,8,30,18,3,24,13,25,5,7,23,4,15,9,22,12,17,27,21,20,28,2,16,19,11,6,31,26,29,10,14,1,4},
+{1,23,31,21,6,28,27,16,20,17,3,14,22,8,10,19,26,7,11,4,5,18,13,24,30,2,25,9,29,12,15,1,16},
+{1,9,12,26,29,25,6,13,19,17,3,27,20,21,28,16,10,23,14,8,5,22,7,4,31,11,30,2,18,24,15,1,25},
+{1,26,31,23,14,2,9,3,19,28,4,18,6,27,5,8,25,12,11,10,16,15,24,22,20,29,30,13,17,21,7,1,13},
+{1,6,20,59,28,11,58,26,31,1,6,20,59,28,11,58,26,31,1,6,20,59,28,11,58,26,31,1,6,20,59,28,36},
+{1,3,5,15,17,51,28,36,37,38,35,44,61,14,18,54,19,53,22,58,7,9,27,45,62,11,29,39,32,41,50,31,52},
+{1,40,59,44,53,57,43,20,54,22,49,55,62,10,27,11,51,48,31,5,38,46,50,24,36,41,19,23,25,12,18,63,17},
+{1,27,41,23,43,33,34,15,47,22,48,8,53,36,14,52,63,39,35,20,6,1,27,41,23,43,33,34,15,47,22,48,4},
+{1,57,56,1,57,56,1,57,56,1,57,56,1,57,56,1,57,56,1,57,56,1,57,56,1,57,56,1,57,56,1,57,28},
+{1,6,20,31,37,16,7,18,11,58,53,23,21,25,49,15,34,2,12,40,62,45,32,14,36,22,19,13,46,42,50,5,15},
+{1,46,53,8,30,28,45,42,58,6,62,9,48,41,37,52,38,43,20,51,54,23,44,4,15,14,32,21,29,3,31,50,12},
+{1,4,16,51,42,61,18,59,10,40,53,50,46,45,33,17,55,58,14,56,6,24,19,63,26,27,31,15,60,22,43,57,1},
+{1,20,46,36,51,33,2,40,41,61,19,55,4,37,39,15,38,27,8,63,59,30,57,54,16,11,3,60,7,25,32,22,3},
+{1,47,77,23,49,45,19,14,31,79,73,40,3,113,84,57,83,119,53,18,33,82,88,120,5,16,127,75,118,26,95,54,112},
+{1,29,67,25,55,7,83,82,79,12,21,34,37,118,36,107,103,114,80,117,3,39,76,43,89,9,124,127,88,20,63,102,115},
+{1,80,111,88,92,2,47,81,63,55,4,94,45,126,110,8,51,90,115,83,16,102,59,105,41,32,67,118,93,82,64,9,118},
+{1,61,106,98,57,15,121,2,122,69,85,114,30,99,4,101,27,59,117,60,87,8,91,54,118,123,120,63,16,39,108,125,123},
+{1,44,37,83,100,70,76,78,22,92,103,50,35,38,39,11,46,125,25,95,19,93,75,23,112,66,97,71,96,107,69,56,94},
+{1,102,83,51,122,74,61,37,77,65,117,115,105,106,103,53,96,73,48,119,24,104,12,52,6,26,3,13,82,85,41,121,112},
+{1,45,95,39,59,102,27,53,29,112,34,9,19,11,73,30,7,104,96,94,10,100,65,32,83,6,69,63,121,49,2,90,95},
+{1,3,5,15,17,51,85,70,115,44,116,37,111,8,24,40,120,49,83,76,109,14,18,54,90,87,64,121,50,86,67,124,66},
+{1,64,91,94,96,41,113,80,98,22,120,83,29,68,37,76,102,104,106,85,92,95,32,114,47,48,75,103,40,49,11,60,59},
+{1,82,56,98,76,108,52,127,47,114,96,41,28,49,38,54,26,95,119,57,48,116,14,120,19,27,13,79,91,124,24,58,99},
+{1,69,126,99,79,102,67,118,58,88,82,74,106,83,15,20,48,64,114,115,54,72,43,100,2,65,55,13,85,7,77,39,58},
+{1,102,8,124,64,127,57,103,110,116,60,63,70,94,9,26,72,3,121,24,87,19,82,75,122,97,79,68,65,25,49,27,23},
+{1,13,81,28,89,116,47,65,25,96,30,67,3,23,38,36,62,73,113,22,43,117,34,16,5,57,106,108,66,14,70,58,84},
+{1,62,34,113,93,119,60,94,53,90,40,55,38,108,48,121,103,72,32,13,25,112,99,85,77,3,66,102,118,2,124,68,113},
+{1,85,99,114,109,119,93,70,57,65,76,89,35,107,87,38,91,102,66,92,19,90,51,33,46,126,45,110,103,23,63,97,108},
+{1,103,122,116,56,35,108,47,31,49,73,2,63,5,25,112,70,41,94,62,98,99,4,126,10,50,17,125,82,77,124,53,99},
+{1,55,104,98,90,22,30,72,35,24,13,74,77,63,62,9,97,3,89,79,81,25,58,34,47,101,40,23,41,32,65,66,118},
+{1,91,50,76,31,6,32,81,82,66,20,61,28,22,118,120,115,72,116,51,23,45,74,63,87,114,19,70,127,8,43,106,55},
+{1,240,70,68,191,51,187,222,184,213,114,25,168,76,126,53,173,81,59,122,216,174,90,241,182,2,251,140,136,101,102,109,222},
+{1,96,185,223,59,85,150,89,44,38,193,15,26,169,145,100,36,1,96,185,223,59,85,150,89,44,38,193,15,26,169,145,50},
+{1,207,86,103,217,141,95,42,105,175,180,99,152,254,232,51,11,248,28,236,114,120,79,5,142,37,208,192,239,8,130,230,183},
+{1,177,234,175,8,17,147,225,64,136,44,203,90,244,77,182,138,99,50,41,228,111,189,101,227,15,113,95,219,120,255,162,27},
+{1,118,18,35,61,4,225,72,140,244,16,207,25,66,155,64,119,100,49,30,57,229,169,196,120,228,223,214,91,217,219,55,149},
+{1,50,199,108,30,98,29,52,107,128,73,38,110,122,211,197,8,175,186,33,240,81,232,159,25,252,54,15,49,145,26,170,32},
+{1,244,179,149,15,88,98,237,85,159,164,223,212,139,191,156,245,71,38,154,87,58,143,184,202,59,123,11,95,52,35,105,89},
+{1,173,252,217,46,75,28,54,119,122,201,6,15,182,104,228,229,72,180,109,67,8,20,34,85,47,230,224,239,89,49,213,24},
+{1,20,115,213,144,88,15,204,7,108,58,237,85,235,45,162,21,103,166,69,200,87,195,203,107,86,215,184,190,198,143,183,57},
+{1,99,159,168,249,189,120,134,119,125,12,94,191,190,221,66,234,19,174,214,80,39,90,86,8,183,9,212,150,124,111,193,185},
+{1,202,37,12,220,213,80,52,88,123,25,27,230,172,180,101,166,6,110,222,40,26,44,137,184,185,115,86,90,134,83,3,175},
+{1,92,23,225,100,25,90,174,147,192,48,12,3,228,57,82,172,43,238,131,196,49,80,20,5,93,75,246,133,125,67,244,166},
+{1,29,38,119,191,193,139,43,246,70,60,2,58,76,238,9,245,97,86,155,140,120,4,116,152,171,18,157,194,172,65,111,120},
+{1,238,55,123,249,159,3,73,89,141,112,218,5,219,235,236,144,21,15,22,70,79,203,63,17,58,202,209,38,65,51,78,175},
+{1,255,224,49,50,180,19,64,22,77,120,184,130,85,221,146,147,108,140,189,143,59,40,104,126,51,75,243,113,36,249,107,124},
+{1,247,153,173,37,65,15,71,160,7,88,217,85,251,76,45,94,118,21,3,146,32,124,111,195,17,201,107,9,232,224,255,67},
+{1,242,93,158,199,139,181,209,98,8,41,127,83,12,251,134,188,10,64,197,226,15,96,97,147,206,80,151,28,169,120,26,9},
+{1,119,29,33,206,131,220,254,169,13,178,129,50,196,235,14,43,166,81,9,241,245,182,194,70,64,237,163,101,96,84,61,76},
+{1,35,108,44,62,173,57,68,158,128,36,133,139,250,23,60,235,225,28,226,121,86,13,20,89,95,149,94,182,50,154,12,202},
+{1,59,179,223,245,159,47,189,52,99,250,79,10,7,161,75,230,48,143,205,97,140,128,29,68,54,21,53,88,73,144,255,76},
+{1,129,192,185,157,54,38,24,33,253,178,176,3,50,241,122,22,90,106,40,99,182,103,97,5,86,162,142,58,238,190,120,138},
+{1,92,33,192,50,106,134,194,138,40,187,166,94,153,130,15,14,82,115,179,129,235,109,175,37,13,182,16,78,215,85,90,42},
+{1,189,111,148,178,123,164,242,58,88,97,61,237,175,87,117,13,173,238,171,230,10,24,32,193,126,168,226,187,103,53,76,201},
+{1,127,225,21,128,147,222,90,250,62,48,155,184,110,82,156,10,152,57,130,109,211,112,53,215,67,47,131,18,50,101,181,34},
+{1,125,18,118,211,208,87,97,251,89,254,7,164,126,149,64,73,114,240,152,88,131,21,210,173,69,23,40,137,169,102,95,248},
+{1,213,33,209,207,85,49,211,184,23,78,144,18,117,53,61,60,233,200,25,214,131,178,97,217,206,128,16,2,119,66,127,207},
+{1,15,85,205,89,137,107,96,9,119,212,222,184,147,253,174,65,1,15,85,205,89,137,107,96,9,119,212,222,184,147,253,87},
+{1,34,46,69,126,164,185,197,37,192,143,86,45,35,12,107,59,218,29,124,224,229,79,217,123,14,47,103,80,225,199,97,78},
+{1,170,112,86,51,187,25,242,206,82,132,142,180,62,61,54,166,92,9,49,26,249,94,168,209,182,159,221,154,192,223,59,16},
+{1,129,152,59,32,120,170,132,22,200,247,216,203,141,137,134,237,1,129,152,59,32,120,170,132,22,200,247,216,203,141,137,67},
+{1,9,65,74,25,209,92,191,321,326,377,190,328,263,307,167,409,347,396,486,223,34,306,174,472,273,405,311,131,157,115,488,337},
+{1,2,4,8,16,32,64,128,256,17,34,68,136,272,49,98,196,392,257,19,38,76,152,304,113,226,452,409,291,87,174,348,348},
+{1,42,106,161,210,446,216,186,331,222,70,55,271,189,413,456,310,30,283,162,172,256,315,460,414,438,392,509,109,119,452,206,371},
+{1,138,319,5,185,501,17,70,12,85,350,60,257,16,204,307,80,487,457,272,86,192,358,270,475,200,256,154,499,310,233,18,236},
+{1,167,53,357,339,479,211,130,389,327,439,374,111,241,102,300,507,452,149,4,189,212,470,270,287,365,41,119,350,191,410,444,482},
+{1,59,287,232,202,427,136,478,214,258,122,295,442,302,89,125,390,144,411,2,118,19,464,404,379,272,401,428,41,244,99,345,302},
+{1,198,441,498,454,435,27,485,365,269,386,387,325,252,270,200,379,352,133,488,229,359,228,417,349,83,155,480,128,5,493,264,302},
+{1,231,220,216,271,52,287,437,357,399,390,132,101,160,251,367,420,3,297,356,360,346,92,362,148,484,218,193,396,175,480,269,253},
+{1,416,219,302,457,247,146,3,185,365,299,2,281,438,5,459,494,292,6,370,131,15,4,107,309,10,463,389,17,12,189,262,15},
+{1,484,409,310,209,315,249,301,357,142,168,229,411,161,444,264,347,260,151,139,61,505,203,363,213,74,124,331,126,220,275,239,375},
+{1,300,461,32,437,390,202,445,370,409,189,388,247,66,306,150,468,16,488,195,101,492,185,510,364,194,329,33,153,75,234,8,122},
+{1,356,187,224,449,143,421,451,46,211,3,453,461,288,42,401,134,44,114,373,5,38,62,265,126,218,394,116,150,502,15,106,33},
+{1,312,505,63,109,261,395,167,408,376,118,166,160,129,73,203,421,266,238,339,221,380,72,499,92,309,131,86,342,475,464,139,21},
+{1,31,341,320,211,77,450,40,367,481,414,5,99,239,174,488,377,83,136,61,252,383,17,495,292,97,209,115,287,223,201,379,269},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,318},
+{1,390,275,435,468,488,268,71,289,232,383,39,129,252,291,355,478,454,430,427,444,493,283,22,471,485,190,21,474,87,236,238,497},
+{1,473,23,476,277,407,6,508,114,482,449,88,20,290,300,358,428,464,120,371,343,235,194,458,272,149,77,239,25,406,479,491,215},
+{1,4,16,64,256,306,506,67,268,258,314,474,195,405,511,87,348,66,264,274,378,218,497,111,444,347,94,376,210,465,239,293,211},
+{1,213,55,195,83,418,291,62,347,476,156,331,485,335,18,403,445,223,208,277,40,319,189,492,215,413,173,469,260,196,219,295,437},
+{1,259,458,413,97,239,278,477,297,484,245,462,219,166,372,146,196,59,383,283,433,426,113,189,175,94,214,202,503,263,140,346,253},
+{1,294,389,299,70,46,468,495,50,472,266,178,353,141,378,130,90,34,305,367,139,95,194,337,438,469,201,439,243,332,156,181,177},
+{1,296,331,117,246,488,169,272,323,350,114,247,192,482,357,437,182,219,487,387,188,279,322,118,313,130,54,10,460,165,501,389,401},
+{1,257,360,409,193,222,221,355,102,112,307,81,310,46,132,20,508,271,232,154,278,298,403,63,263,169,302,237,229,164,272,235,146},
+{1,67,300,189,184,503,501,371,484,158,494,207,490,451,196,504,235,373,110,295,175,400,70,99,191,62,352,143,3,197,443,455,228},
+{1,27,325,123,327,77,284,187,323,33,426,343,509,277,120,362,339,401,419,404,468,103,67,414,314,336,444,189,281,204,176,438,321},
+{1,146,189,400,350,70,304,382,360,72,417,117,319,381,222,399,458,332,501,246,391,236,274,372,362,364,219,398,344,497,101,424,397},
+{1,63,191,438,150,142,115,69,317,38,125,319,88,259,166,372,31,64,510,144,12,260,27,188,503,343,161,457,471,424,233,463,464},
+{1,266,155,296,176,324,365,492,263,262,12,151,447,271,75,294,202,461,203,199,80,495,224,171,397,327,138,65,134,214,313,473,185},
+{1,508,412,35,400,308,262,160,448,468,492,86,491,161,60,72,463,454,223,423,156,392,27,42,137,76,61,436,83,485,335,147,205},
+{1,342,91,369,164,506,379,449,135,360,156,239,319,346,236,470,439,108,58,170,242,362,291,89,206,18,11,51,294,354,505,402,150},
+{1,121,445,258,239,149,419,371,399,43,55,180,443,20,94,179,212,280,378,299,42,78,265,185,251,203,272,423,151,337,284,158,368},
+{1,219,74,94,481,328,241,413,408,304,82,372,303,102,76,411,93,140,406,19,161,351,35,490,195,352,144,207,501,247,88,36,122},
+{1,446,105,381,469,331,122,327,440,136,11,157,208,390,91,108,125,24,167,189,69,42,438,277,278,247,76,232,436,330,452,302,499},
+{1,324,511,86,405,291,267,164,157,378,166,292,437,10,319,194,301,119,504,232,315,129,179,303,462,311,68,288,502,404,103,244,121},
+{1,476,299,413,238,264,339,119,132,308,422,66,154,211,33,77,500,397,443,250,347,320,125,304,160,419,152,80,332,76,40,166,19},
+{1,408,89,432,191,167,450,8,484,385,164,35,227,125,64,333,300,251,280,394,161,329,478,415,330,63,372,211,510,157,476,486,252},
+{1,221,381,488,28,161,251,292,336,160,38,89,184,188,135,162,412,492,39,132,453,340,155,3,359,200,375,36,483,269,35,191,240},
+{1,202,163,458,13,95,385,51,81,128,87,359,198,54,232,500,3,350,485,261,23,225,472,85,243,384,249,242,330,90,312,327,431},
+{1,63,246,319,449,262,437,364,52,335,343,62,201,457,254,199,179,217,344,379,24,361,247,256,311,57,116,106,385,35,355,369,207},
+{1,73,99,227,410,124,274,38,135,134,207,172,79,469,425,187,157,26,156,83,255,176,357,204,119,234,240,108,63,192,112,277,345},
+{1,256,96,20,433,346,272,102,206,241,290,257,352,116,421,235,74,374,168,63,467,35,97,276,465,334,161,316,478,151,492,496,33},
+{1,291,410,431,245,335,113,353,397,337,237,511,38,189,300,468,480,409,441,296,205,366,451,286,385,265,383,273,463,326,19,487,75},
+{1,26,324,494,457,432,155,418,271,366,309,21,466,238,49,389,374,69,12,184,435,181,273,66,74,154,440,75,128,252,421,329,166},
+{1,154,170,360,293,368,452,148,44,206,132,146,245,183,254,326,223,160,3,430,510,61,234,21,457,444,116,338,396,438,287,473,129},
+{1,209,248,249,40,208,41,1,209,248,249,40,208,41,1,209,248,249,40,208,41,1,209,248,249,40,208,41,1,209,248,249,20},
+{1,78,121,406,399,19,209,89,400,43,261,326,408,506,364,211,197,354,166,442,352,58,328,493,133,366,79,55,495,25,412,194,68},
+{1,233,198,326,76,291,300,36,153,282,299,270,382,162,207,397,464,94,181,417,363,30,421,378,179,98,74,224,13,218,305,186,398},
+{1,251,246,242,167,198,183,402,307,86,364,363,51,328,47,227,264,436,385,362,200,446,221,68,462,259,19,89,158,210,438,119,67},
+{1,150,461,34,271,452,77,438,246,424,334,276,373,390,295,286,160,175,115,45,467,410,435,511,223,484,110,47,255,455,503,38,72},
+{1,60,269,412,499,157,383,469,3,68,220,367,478,423,74,436,5,204,356,122,425,290,222,279,15,340,103,142,304,173,354,242,493},
+{1,15,85,206,77,70,47,437,269,127,328,65,2,30,170,412,154,140,94,167,471,254,349,130,4,60,340,245,308,280,188,334,471},
+{1,446,25,504,321,68,497,398,149,157,492,292,432,147,358,442,331,412,267,319,225,480,263,284,77,318,351,505,255,93,9,207,386},
+{1,280,291,432,13,261,10,511,81,388,114,301,68,187,499,76,173,61,369,197,195,289,89,402,444,16,44,69,419,208,508,160,156},
+{1,505,329,180,479,106,134,86,376,213,245,485,423,117,384,175,251,402,54,427,19,352,25,309,137,472,416,447,185,64,451,132,466},
+{1,342,156,14,265,122,84,474,293,177,403,82,508,388,149,119,334,4,355,409,56,31,488,336,186,175,301,414,328,34,450,445,238},
+{1,46,89,36,373,421,29,253,403,47,119,125,337,208,440,224,366,444,88,10,300,385,360,344,398,210,484,82,294,173,233,48,107},
+};
+
+static const uint16_t prescr_table_32_1279[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,3},
+{1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,3},
+{1,5,6,4,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2,7,1,5,6,4,7},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,12},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,22,25,21,6,27,28,17,20,16,2,9,23,15,12,19,29,7,13,5,4,18,11,30,24,3,31,14,26,10,8,1,11},
+{1,2,4,8,16,9,18,13,26,29,19,15,30,21,3,6,12,24,25,27,31,23,7,14,28,17,11,22,5,10,20,1,1},
+{1,9,31,5,2,18,17,10,4,11,13,20,8,22,26,7,16,3,27,14,15,6,25,28,30,12,29,23,19,24,21,1,19},
+{1,18,14,23,13,22,31,24,8,21,30,10,6,2,19,28,25,26,27,9,7,16,29,11,20,12,4,17,15,5,3,1,9},
+{1,11,8,21,13,9,30,5,28,19,12,2,22,16,17,26,18,7,10,3,29,24,4,23,27,25,15,31,14,20,6,1,24},
+{1,6,20,2,12,21,4,24,23,8,13,19,16,26,27,29,9,11,7,18,22,14,25,17,28,15,31,5,30,3,10,1,3},
+{1,19,9,13,2,38,18,26,4,15,36,52,8,30,11,43,16,60,22,21,32,59,44,42,3,53,27,23,6,41,54,46,6},
+{1,20,52,39,54,15,23,8,50,22,28,6,49,42,9,38,34,59,48,62,61,1,20,52,39,54,15,23,8,50,22,28,3},
+{1,21,26,32,24,10,44,29,28,9,19,51,43,33,13,16,12,5,22,37,14,47,34,50,62,59,45,8,6,41,11,57,40},
+{1,18,51,15,3,54,14,17,5,1,18,51,15,3,54,14,17,5,1,18,51,15,3,54,14,17,5,1,18,51,15,3,27},
+{1,34,59,33,60,13,62,40,41,11,48,17,45,32,30,54,31,20,36,53,24,56,38,16,15,27,63,10,18,42,12,28,57},
+{1,55,58,59,12,54,13,1,55,58,59,12,54,13,1,55,58,59,12,54,13,1,55,58,59,12,54,13,1,55,58,59,6},
+{1,14,57,48,35,11,15,55,9,19,40,4,56,62,26,59,44,60,6,36,33,23,16,58,34,5,54,7,42,24,39,51,46},
+{1,51,18,40,46,17,14,24,26,15,43,8,39,5,25,41,29,3,38,54,11,1,51,18,40,46,17,14,24,26,15,43,4},
+{1,39,7,31,21,40,30,50,47,1,39,7,31,21,40,30,50,47,1,39,7,31,21,40,30,50,47,1,39,7,31,21,20},
+{1,50,26,91,66,79,35,2,100,52,53,7,29,70,4,75,104,106,14,58,15,8,21,83,87,28,116,30,16,42,37,45,28},
+{1,30,70,51,38,59,95,47,92,13,31,88,117,21,29,100,112,115,81,18,71,45,96,8,121,20,3,34,67,85,106,77,52},
+{1,45,41,18,57,113,26,79,39,5,22,2,90,82,36,114,109,52,17,78,10,44,4,59,43,72,107,85,104,34,19,20,44},
+{1,27,103,75,104,67,33,29,61,59,97,17,24,74,115,36,106,117,126,26,124,44,35,43,98,60,32,6,90,112,9,82,84},
+{1,9,65,61,114,49,30,115,56,95,78,74,110,80,57,86,15,119,28,97,39,37,55,40,82,43,73,117,14,126,93,92,100},
+{1,2,4,8,16,32,64,39,78,59,118,75,49,98,99,97,101,109,125,93,29,58,116,79,57,114,67,33,66,35,70,43,43},
+{1,42,74,98,124,33,50,64,48,20,15,123,92,57,56,18,88,58,70,103,85,21,37,49,62,69,25,32,24,10,82,104,23},
+{1,20,98,61,11,37,32,100,69,53,18,26,3,60,31,71,29,111,96,21,118,95,54,46,5,68,33,112,39,8,25,63,77},
+{1,18,122,80,88,119,37,89,101,95,9,61,40,44,100,77,115,109,112,91,65,20,22,50,121,102,105,56,114,127,10,11,83},
+{1,33,78,83,43,71,57,82,10,9,106,121,77,48,56,115,68,90,65,62,116,98,50,122,46,35,12,14,76,17,118,32,87},
+{1,110,18,100,89,27,86,16,115,125,24,47,38,20,93,53,30,22,74,17,29,111,124,118,61,66,77,70,99,14,101,55,97},
+{1,32,114,60,109,67,87,61,77,49,107,80,14,102,86,29,63,13,6,19,89,91,27,44,84,93,8,117,15,70,36,33,41},
+{1,59,108,56,33,89,105,58,87,84,25,120,48,83,109,3,77,97,72,99,62,110,78,44,41,43,93,80,32,98,5,2,59},
+{1,109,67,127,78,117,104,80,31,7,44,3,82,32,100,55,122,93,21,33,9,116,5,19,96,73,89,107,2,63,99,27,78},
+{1,82,118,123,77,49,28,94,18,113,27,62,97,33,38,70,53,101,88,32,116,48,78,40,105,60,42,34,63,51,87,93,114},
+{1,10,68,127,51,28,41,9,90,66,67,73,13,114,65,93,116,125,39,101,38,111,98,16,81,12,120,5,34,71,97,14,54},
+{1,78,42,56,32,17,61,79,100,18,24,49,44,114,43,118,10,41,29,94,89,93,124,35,52,67,7,4,33,95,23,119,34},
+{1,53,10,56,68,74,91,55,96,44,52,63,50,124,14,17,108,87,76,24,11,13,78,114,31,125,59,27,84,19,6,67,30},
+{1,3,5,15,17,51,85,255,26,46,114,150,161,248,19,53,95,225,56,72,216,115,149,164,247,2,6,10,30,34,102,170,255},
+{1,222,151,110,27,160,237,75,88,70,103,123,251,212,136,145,144,78,217,183,172,12,225,170,242,180,211,168,83,135,15,158,7},
+{1,115,100,247,90,27,145,75,137,79,110,244,207,183,163,165,164,215,179,68,30,5,148,223,86,25,119,131,76,251,88,253,185},
+{1,223,128,77,114,87,219,139,23,107,178,170,144,97,55,51,56,98,123,158,239,244,130,222,95,205,63,37,140,80,156,124,250},
+{1,72,155,229,91,39,9,122,167,98,241,38,65,225,66,57,214,47,59,70,32,200,240,110,218,4,25,30,223,85,156,36,244},
+{1,93,223,253,97,55,153,64,76,145,214,54,196,159,177,240,225,175,132,211,32,38,215,107,27,98,208,199,120,239,200,66,123},
+{1,86,240,219,163,104,159,171,66,177,144,110,38,17,2,172,173,251,11,208,115,27,132,47,109,220,76,34,4,21,23,187,11},
+{1,17,94,194,135,177,6,102,155,50,243,71,20,11,187,172,148,205,120,58,123,9,153,16,79,156,69,54,183,96,253,169,207},
+{1,175,222,101,74,35,231,192,93,64,234,225,135,95,125,53,43,19,25,208,214,145,147,174,113,187,47,105,196,39,157,29,85},
+{1,182,73,215,42,189,210,142,181,246,12,54,195,112,157,66,76,115,34,153,80,13,128,138,167,183,255,158,253,151,111,92,175},
+{1,148,151,66,146,84,139,119,131,26,246,216,171,170,62,169,235,121,45,166,209,82,72,190,102,205,103,89,240,27,98,79,192},
+{1,92,23,225,100,25,90,174,147,192,48,12,3,228,57,82,172,43,238,131,196,49,80,20,5,93,75,246,133,125,67,244,166},
+{1,152,72,170,2,71,144,35,4,142,87,70,8,107,174,140,16,214,43,111,32,219,86,222,64,193,172,203,128,245,47,225,128},
+{1,220,223,192,218,225,244,172,203,68,98,174,8,129,153,97,177,18,186,140,57,214,157,156,64,159,95,133,100,144,60,247,228},
+{1,142,46,85,193,220,75,67,166,81,112,100,152,73,216,250,251,117,91,14,207,19,88,27,189,236,156,248,96,41,241,11,120},
+{1,249,205,214,231,247,41,161,18,167,153,148,240,91,95,173,143,193,75,129,37,60,116,117,140,65,151,112,135,174,15,29,93},
+{1,249,24,147,205,77,228,140,38,200,74,156,196,197,60,36,183,122,55,211,95,121,177,251,103,163,102,90,126,201,179,132,237},
+{1,116,24,61,223,153,19,63,55,169,105,30,154,143,23,112,87,93,43,219,214,115,203,117,108,37,226,70,138,44,8,158,96},
+{1,19,166,30,97,63,247,55,111,205,159,131,196,20,223,42,59,187,74,23,234,99,25,24,11,173,179,210,237,26,45,66,150},
+{1,55,227,44,137,159,15,148,71,13,250,40,85,65,191,75,192,49,81,157,97,251,31,182,109,54,212,207,165,22,144,155,189},
+{1,98,79,31,9,16,228,231,65,144,177,170,154,7,159,92,93,63,112,111,102,118,146,117,52,164,21,191,37,34,189,225,94},
+{1,132,90,24,53,57,253,63,159,94,207,224,89,41,219,17,162,116,37,31,211,2,181,180,48,106,114,71,126,131,188,35,224},
+{1,127,113,206,37,123,78,201,155,239,97,50,57,198,91,117,241,34,197,218,230,96,77,72,8,126,14,191,235,94,53,135,41},
+{1,26,139,24,191,193,143,112,194,161,34,234,175,174,180,63,39,152,89,214,166,100,197,231,13,162,12,184,135,160,56,97,188},
+{1,72,38,131,230,162,74,182,207,55,185,217,34,116,126,215,124,71,48,150,43,5,191,190,246,208,83,181,23,93,235,36,226},
+{1,132,127,207,196,123,184,229,253,18,212,122,60,154,50,214,175,194,217,103,32,2,213,254,67,85,246,173,23,39,36,117,122},
+{1,179,37,226,67,189,108,243,170,225,113,210,173,54,138,85,131,203,105,165,27,69,217,178,150,199,161,254,209,159,89,75,72},
+{1,184,44,136,122,4,245,176,53,27,16,50,213,212,108,64,200,178,182,67,243,198,221,205,255,42,254,146,210,26,168,30,215},
+{1,53,218,97,67,168,199,103,253,107,116,24,231,230,211,9,104,43,131,68,35,222,181,193,217,62,216,11,2,106,65,194,67},
+{1,107,11,23,69,129,236,100,73,126,152,128,135,111,94,59,25,108,227,38,32,163,153,235,140,120,27,186,245,8,170,88,92},
+{1,260,400,285,224,275,209,255,126,441,133,465,377,294,299,21,330,193,167,362,113,140,249,99,223,206,402,278,451,298,273,218,238},
+{1,16,256,136,196,38,113,291,169,197,54,369,427,109,227,71,82,258,168,213,310,505,367,75,146,356,251,455,158,420,157,404,198},
+{1,424,338,497,119,303,171,180,387,105,432,19,156,87,457,464,313,262,215,70,18,308,261,56,423,22,429,99,453,123,132,278,82},
+{1,202,487,118,90,224,506,264,412,424,405,287,267,194,410,271,497,43,215,153,432,274,143,493,415,246,423,389,485,482,399,12,167},
+{1,212,122,443,14,26,237,198,84,140,324,230,377,299,382,294,24,325,50,259,144,368,316,245,387,102,399,468,406,69,478,253,160},
+{1,38,78,208,316,501,402,206,149,182,70,480,353,258,198,421,235,177,180,10,380,193,343,257,172,375,411,472,134,145,46,382,336},
+{1,177,338,149,72,7,292,235,472,504,21,425,162,366,398,107,57,349,95,204,273,175,198,413,87,290,382,97,181,421,443,47,394},
+{1,315,227,337,204,322,34,422,15,392,295,389,146,356,510,110,85,468,316,415,435,166,365,49,328,235,421,265,173,159,209,287,129},
+{1,309,471,272,493,286,372,105,27,82,288,284,327,414,98,465,325,429,405,424,198,456,292,378,240,364,317,283,39,9,505,224,122},
+{1,133,210,52,352,49,430,500,330,426,447,93,378,129,153,291,432,271,362,429,123,60,502,64,14,471,194,280,386,302,488,187,23},
+{1,411,492,343,382,468,271,255,388,264,244,202,258,33,300,128,185,378,279,16,361,182,247,2,339,445,203,153,461,123,510,365,264},
+{1,133,71,153,308,374,279,376,154,187,447,188,77,361,491,94,274,384,449,47,137,192,468,291,368,96,234,421,184,48,117,486,46},
+{1,341,97,108,456,330,409,141,434,340,308,13,420,130,211,276,319,230,96,313,425,294,81,455,43,473,134,345,144,143,375,406,246},
+{1,442,2,259,4,113,8,226,16,452,32,511,64,393,128,357,256,189,119,378,238,131,476,262,463,123,489,246,421,492,317,431,317},
+{1,4,16,64,256,250,405,211,305,62,248,413,243,433,67,268,202,341,430,63,252,397,179,177,185,153,25,100,400,199,353,382,129},
+{1,322,483,81,314,423,55,367,155,405,28,18,27,341,188,226,147,409,22,29,336,504,260,390,325,164,246,141,392,332,490,287,298},
+{1,92,210,384,305,188,212,72,328,150,461,341,293,294,450,180,161,359,163,479,263,74,496,306,88,418,93,142,338,177,397,104,78},
+{1,64,506,258,195,87,264,218,444,376,239,307,332,32,253,129,301,359,132,109,222,188,315,469,166,16,306,268,474,511,66,378,379},
+{1,220,118,407,12,214,203,104,80,174,50,67,355,45,344,439,350,476,106,488,66,447,91,207,443,392,279,2,440,236,397,24,214},
+{1,199,511,322,58,481,425,280,14,480,366,231,332,474,143,334,84,468,367,32,179,152,181,175,509,204,353,448,477,127,505,373,185},
+{1,485,318,172,197,460,406,12,175,69,33,98,323,84,80,53,403,396,55,246,351,367,380,104,236,356,310,102,294,498,79,398,169},
+{1,66,210,304,61,136,11,97,63,12,431,182,69,284,441,116,59,260,80,280,177,395,405,496,199,308,309,375,421,149,168,32,334},
+{1,218,291,305,22,242,274,94,276,63,25,350,109,463,454,11,121,137,47,138,321,338,175,360,441,227,347,354,282,329,69,510,266},
+{1,302,188,419,500,495,471,145,491,241,174,54,112,67,59,251,190,304,140,102,240,384,138,467,439,468,300,47,219,125,200,198,248},
+{1,182,41,236,483,179,150,97,110,431,56,126,395,121,88,166,13,173,453,414,226,148,269,60,119,303,280,167,187,132,297,125,320},
+{1,47,483,440,54,159,198,278,162,336,236,102,24,339,157,152,11,265,316,466,490,239,23,230,320,199,313,321,232,218,249,222,335},
+{1,9,65,188,182,236,147,481,215,368,292,293,300,365,465,359,395,280,249,46,350,122,351,115,286,207,424,35,315,450,492,178,100},
+{1,149,228,402,212,325,46,71,38,285,13,354,422,174,214,111,486,410,398,366,81,492,490,109,204,82,83,198,34,432,356,33,379},
+{1,114,264,191,447,401,361,3,150,25,449,448,434,186,5,442,43,322,321,471,462,15,463,125,199,194,376,339,17,336,135,329,163},
+{1,364,42,476,369,462,445,41,379,271,185,317,360,175,372,39,319,163,251,479,470,432,202,169,58,219,194,419,362,356,288,140,103},
+{1,222,433,30,191,488,340,478,332,176,61,416,372,419,22,101,52,420,281,333,110,396,446,459,75,322,443,376,276,292,237,282,413},
+{1,296,214,460,27,64,232,337,325,254,421,434,110,79,275,226,3,103,378,331,45,192,312,236,208,258,496,457,178,209,42,294,397},
+{1,420,301,478,395,366,509,178,29,165,383,34,157,94,134,70,337,453,403,185,126,112,353,328,438,317,421,137,243,85,229,147,310},
+{1,414,216,397,291,417,477,235,166,182,222,410,194,476,373,126,315,509,59,287,311,467,200,485,103,249,195,66,429,499,24,92,243},
+{1,481,311,16,446,50,256,259,27,121,73,432,486,477,483,462,325,414,117,356,56,294,79,187,290,445,298,354,307,482,47,114,199},
+{1,356,70,161,490,133,176,418,376,439,379,338,433,177,198,318,278,145,471,257,275,446,137,109,451,102,432,469,128,415,252,20,279},
+{1,37,448,402,362,404,436,197,265,295,416,334,113,486,61,503,263,209,130,95,353,211,200,144,266,328,175,183,128,21,430,184,270},
+{1,471,208,250,487,169,78,5,61,203,73,205,342,374,17,201,188,365,162,483,323,85,182,279,308,369,217,418,257,309,166,9,172},
+{1,185,474,352,369,286,174,322,431,287,23,152,207,110,265,54,397,449,22,33,277,270,120,296,291,131,441,318,258,406,183,326,21},
+{1,396,403,437,198,380,367,99,190,258,388,95,129,194,410,501,97,205,335,389,467,274,375,348,137,270,174,497,135,87,333,502,207},
+{1,384,120,431,241,435,410,420,168,406,202,485,316,305,479,234,495,229,364,288,90,456,472,477,135,287,214,142,299,3,493,136,206},
+{1,142,495,318,195,88,203,445,268,20,498,423,332,387,373,291,90,471,272,3,402,322,49,325,232,349,436,103,60,357,410,167,251},
+{1,145,406,458,160,463,266,255,278,416,283,259,359,460,185,314,55,64,53,354,102,393,294,360,77,150,286,169,87,464,486,311,74},
+{1,301,108,416,358,221,467,149,400,82,262,304,480,339,255,468,92,148,189,62,166,86,317,128,106,68,14,402,397,478,501,169,438},
+{1,111,271,237,157,390,313,50,355,339,238,44,280,14,405,102,407,184,6,354,316,481,193,389,392,172,84,244,491,232,334,36,304},
+{1,484,283,212,52,489,393,94,499,173,330,476,388,204,377,362,14,287,6,187,280,345,184,149,469,452,201,79,254,43,507,265,42},
+{1,173,31,410,341,383,36,183,41,172,178,389,207,42,347,147,158,133,30,311,330,229,369,456,13,27,155,297,125,431,404,185,312},
+{1,97,95,439,448,443,245,390,446,272,165,423,162,128,319,78,180,164,454,253,311,255,501,65,290,120,493,402,344,343,193,29,27},
+{1,186,468,419,78,465,54,324,368,320,95,414,349,166,407,126,206,503,391,139,113,438,302,100,214,155,132,265,367,205,57,60,311},
+{1,105,360,21,203,247,273,123,188,364,433,310,163,502,108,165,128,138,219,497,371,299,235,304,469,272,18,468,377,378,449,434,291},
+{1,340,135,163,306,351,373,325,408,250,194,476,209,422,390,272,172,455,360,158,127,260,480,200,378,432,431,273,504,320,459,428,144},
+{1,100,403,330,55,215,208,492,362,54,179,323,166,349,225,99,175,460,363,82,288,9,145,394,49,399,453,506,472,273,390,340,56},
+{1,231,208,345,430,106,142,375,350,194,387,435,342,72,177,116,155,193,170,195,356,355,15,486,219,250,492,415,104,320,215,53,463},
+{1,257,267,168,335,378,470,184,459,350,255,249,313,197,214,178,104,185,202,85,87,438,67,275,110,377,310,70,51,364,146,352,393},
+{1,409,124,471,391,158,196,387,296,308,269,230,165,500,312,62,287,311,79,98,309,148,154,370,115,422,250,156,31,379,367,467,492},
+{1,356,146,182,468,488,457,82,335,251,18,177,30,493,304,371,218,393,428,426,260,403,476,297,340,495,3,87,438,474,391,451,208},
+};
+
+static const uint16_t prescr_table_32_2203[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,2,3,1,2,3},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,9,13,15,14,7,10,5,11,12,6,3,8,4,2,1,9,13,15,14,7,10,5,11,12,6,3,8,2,9,15,7,5},
+{1,12,6,3,13,10,5,14,7,15,11,9,8,4,2,1,12,6,3,13,10,5,14,7,15,11,9,8,2,12,3,10,14},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,28,23,13,24,8,27,9,7,30,10,6,2,29,11,26,21,16,19,18,14,25,20,12,4,31,22,17,21,8,31,11,13},
+{1,5,17,7,27,12,21,19,13,16,2,10,11,14,31,24,3,15,26,9,4,20,22,28,23,25,6,30,26,16,1,22,14},
+{1,27,18,28,13,19,7,31,15,10,12,8,21,3,2,25,11,23,26,9,14,17,30,20,24,16,5,6,2,27,9,7,24},
+{1,13,8,6,25,7,20,15,18,22,21,2,26,16,12,5,14,31,30,19,27,29,4,3,23,24,10,28,31,15,9,30,18},
+{1,18,11,7,8,10,21,3,13,29,9,24,30,4,5,23,28,27,19,25,12,15,2,31,22,14,16,20,21,28,16,10,23},
+{1,6,20,2,12,21,4,24,23,8,13,19,16,26,27,29,9,11,7,18,22,14,25,17,28,15,31,5,15,17,14,18,11},
+{1,39,37,40,33,50,51,20,49,25,56,10,57,45,28,5,61,55,14,35,63,58,7,48,62,29,34,24,46,27,59,16,52},
+{1,27,40,15,11,46,28,32,12,38,31,13,61,55,2,54,25,30,22,21,56,9,24,5,62,26,51,39,2,27,20,53,26},
+{1,43,62,31,36,18,9,47,60,30,15,44,22,11,46,23,32,16,8,4,2,1,43,62,31,36,18,9,60,15,22,46,32},
+{1,62,9,20,26,2,39,18,40,52,4,21,36,11,51,8,42,19,22,61,16,15,38,44,33,32,30,23,44,61,8,21,18},
+{1,40,30,56,18,61,57,58,35,1,40,30,56,18,61,57,58,35,1,40,30,56,18,61,57,58,35,1,20,55,7,13,38},
+{1,48,47,50,40,11,43,60,61,13,34,16,56,51,24,36,25,20,54,38,30,45,53,17,8,28,42,12,9,22,43,30,37},
+{1,4,16,45,3,12,48,26,5,20,61,46,15,60,42,31,17,41,19,33,51,22,53,14,56,58,50,18,36,37,39,35,43},
+{1,9,50,29,19,30,8,59,47,14,13,22,51,20,33,3,27,37,39,53,34,24,62,2,18,23,58,38,30,4,18,50,55},
+{1,58,29,52,26,13,60,30,15,61,36,18,9,62,31,53,32,16,8,4,2,1,58,29,52,26,13,60,15,36,9,31,32},
+{1,20,22,62,18,110,74,21,2,40,44,124,36,95,23,42,4,80,88,123,72,61,46,84,8,35,51,117,72,95,74,75,65},
+{1,53,75,111,119,34,47,116,125,123,76,109,29,61,120,19,57,37,45,30,98,44,43,41,67,92,11,108,20,89,117,36,12},
+{1,15,85,33,126,57,121,20,67,124,39,92,86,48,14,90,116,95,71,64,109,87,63,91,123,10,102,62,42,76,83,70,96},
+{1,107,56,43,123,68,92,30,26,5,116,73,22,36,118,14,102,114,17,23,79,78,37,29,54,77,9,85,109,48,66,2,107},
+{1,108,86,68,93,67,99,70,24,114,118,97,3,41,103,81,122,88,56,87,40,11,7,62,5,123,52,110,71,58,9,33,106},
+{1,5,17,85,79,61,110,63,100,29,105,36,19,95,109,48,87,69,31,99,6,30,102,23,75,41,42,37,11,64,7,94,52},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,85,127,106,53,79},
+{1,106,75,22,73,123,102,87,77,24,56,15,27,63,107,33,93,95,50,29,49,26,85,32,55,20,36,84,37,31,46,35,24},
+{1,8,64,67,91,36,94,12,96,61,41,54,113,10,80,124,98,45,22,15,120,66,83,100,29,87,68,99,77,74,86,38,39},
+{1,57,77,65,46,118,126,52,27,84,103,18,39,5,28,58,6,87,44,4,37,119,71,121,90,122,17,108,105,103,9,89,120},
+{1,55,97,105,71,99,7,78,122,66,67,116,21,124,59,88,95,17,107,41,106,30,11,119,76,20,75,90,125,6,89,52,28},
+{1,92,75,109,43,21,77,3,55,14,100,125,63,4,5,89,18,127,84,65,12,15,56,54,82,47,16,20,97,18,86,21,79},
+{1,72,103,88,100,85,24,104,97,66,73,47,63,60,49,77,112,9,35,11,102,16,3,13,124,61,121,42,20,46,81,73,125},
+{1,4,16,64,47,89,75,3,12,48,37,113,14,56,5,20,80,111,118,18,72,15,60,21,84,127,54,61,122,17,34,68,109},
+{1,73,2,125,4,21,8,42,16,84,32,71,64,97,111,45,49,90,98,91,43,89,86,93,67,85,105,69,105,85,67,93,86},
+{1,107,42,28,8,109,67,17,64,93,62,121,38,63,18,12,35,26,97,96,11,33,61,53,88,27,10,74,115,54,10,37,65},
+{1,34,96,108,26,95,74,5,93,14,50,114,58,123,17,48,54,13,84,37,121,85,7,25,57,29,70,115,12,59,87,90,112},
+{1,54,15,53,85,36,10,38,102,56,12,111,68,123,8,74,120,82,91,39,80,55,57,58,96,113,46,44,32,105,120,41,87},
+{1,222,126,174,136,228,162,119,218,43,77,6,242,31,201,29,110,225,41,234,250,181,20,26,66,128,78,127,56,176,194,103,199},
+{1,97,184,7,58,15,21,166,45,107,85,195,12,182,115,36,37,68,252,251,193,206,219,125,80,59,110,173,222,204,130,4,194},
+{1,225,174,180,29,88,114,91,122,130,141,165,101,51,136,189,37,1,225,174,180,29,88,114,91,122,130,141,199,198,35,157,30},
+{1,184,171,252,131,236,49,67,119,54,28,81,152,226,143,15,6,231,141,82,125,50,166,167,31,180,72,203,133,147,47,177,37},
+{1,3,5,15,17,51,85,255,56,72,216,81,243,44,116,156,157,158,155,148,133,182,227,28,36,108,180,229,11,146,219,42,63},
+{1,11,69,153,160,28,196,209,70,132,111,136,27,245,53,200,165,59,170,82,24,232,250,92,122,31,217,30,105,89,177,204,219},
+{1,84,244,107,179,23,149,74,15,219,88,211,98,221,237,113,85,160,159,216,164,130,223,69,212,131,139,177,249,12,181,81,248},
+{1,68,156,75,129,189,201,240,143,228,163,243,67,31,126,47,219,27,49,225,168,161,123,36,137,35,10,22,82,28,89,53,87},
+{1,30,55,188,153,154,184,225,70,142,67,232,168,98,147,86,13,150,48,230,28,11,210,130,203,239,242,231,1,15,85,166,107},
+{1,30,49,244,149,58,38,43,189,165,208,130,229,14,180,75,12,136,41,129,199,93,205,145,66,226,84,35,148,18,238,110,176},
+{1,230,184,22,10,227,125,156,68,193,169,124,122,252,215,163,159,7,96,147,98,54,123,26,111,181,149,228,186,237,234,218,16},
+{1,36,165,85,124,60,86,16,162,169,148,230,83,164,113,217,105,42,44,244,185,54,79,199,66,34,125,24,193,77,255,66,17},
+{1,51,217,171,11,186,145,14,69,181,231,98,9,220,84,47,83,182,178,126,131,193,237,235,65,121,26,32,169,141,66,22,186},
+{1,194,240,82,24,147,213,170,59,17,32,191,158,227,141,60,169,6,122,214,151,80,231,8,113,154,102,192,186,209,170,160,231},
+{1,77,140,243,42,241,176,110,209,58,180,221,104,248,28,23,33,199,86,255,120,189,113,17,8,225,245,3,168,101,176,55,150},
+{1,179,208,177,61,154,212,224,107,195,32,21,45,85,7,15,173,1,179,208,177,61,154,212,224,107,195,32,207,172,89,122,154},
+{1,25,204,48,39,117,46,164,182,153,36,94,247,244,223,6,86,63,160,210,179,228,194,174,76,216,73,165,145,118,196,124,185},
+{1,144,40,182,157,4,225,160,121,213,16,186,33,123,106,64,73,132,115,55,159,187,177,83,220,221,77,101,166,220,161,187,151},
+{1,67,2,134,4,175,8,253,16,89,32,178,64,199,128,45,163,90,229,180,105,203,210,53,7,106,14,212,14,106,7,53,210},
+{1,148,191,251,165,210,96,91,72,10,126,217,138,61,57,146,149,43,68,94,119,178,59,19,66,116,167,83,143,1,74,145,64},
+{1,228,154,112,52,189,250,238,182,50,54,196,127,14,222,249,115,169,162,106,178,192,141,181,175,41,84,35,60,116,99,217,75},
+{1,61,223,253,110,93,89,173,171,37,32,233,48,67,40,188,60,226,34,147,51,4,244,6,142,5,201,217,231,171,204,8,244},
+{1,250,23,216,214,83,153,3,205,57,171,185,245,104,5,148,75,62,8,220,184,15,127,221,66,24,167,11,233,177,245,52,144},
+{1,196,51,56,104,106,45,75,59,235,63,101,243,133,156,226,40,1,196,51,56,104,106,45,75,59,235,63,213,79,189,122,34},
+{1,3,5,15,17,51,85,255,214,173,32,96,160,55,89,235,234,233,236,227,242,193,148,107,189,16,48,80,120,68,102,85,148},
+{1,45,159,106,231,96,8,181,54,234,76,186,64,187,109,36,7,195,103,203,210,253,56,177,130,241,57,156,224,191,130,150,121},
+{1,53,164,173,215,230,150,130,200,188,124,143,102,52,145,9,122,49,112,20,74,116,192,243,233,82,165,152,202,107,77,140,239},
+{1,146,66,222,172,8,186,5,207,185,64,9,40,71,17,21,72,179,45,136,168,85,65,155,106,153,189,29,121,212,153,167,130},
+{1,175,97,47,199,82,107,55,231,129,9,28,131,162,222,221,217,122,11,183,65,252,165,121,15,20,48,64,211,49,141,246,164},
+{1,80,161,235,142,14,146,211,205,176,84,24,100,208,61,170,144,115,118,159,177,4,185,143,94,51,56,67,95,205,88,21,3},
+{1,100,14,123,84,193,347,136,264,373,121,156,221,429,32,138,448,361,143,52,351,280,304,153,297,411,439,398,3,86,261,209,143},
+{1,160,19,437,261,323,454,334,213,393,73,214,105,124,24,375,424,67,180,215,201,111,429,114,235,389,506,2,160,257,233,362,119},
+{1,85,425,219,339,310,266,372,118,445,241,429,399,462,77,104,386,112,67,297,352,92,323,72,361,182,464,114,383,27,159,483,140},
+{1,407,436,133,391,112,362,443,180,71,494,427,368,424,466,367,93,509,205,88,27,388,210,429,52,38,215,75,435,43,484,62,501},
+{1,180,304,433,202,178,169,370,302,47,292,165,97,168,454,30,414,494,23,200,474,232,49,186,331,118,96,28,123,499,314,397,507},
+{1,486,323,106,242,81,374,19,460,234,105,245,441,456,261,319,349,92,140,135,371,26,473,296,382,480,333,407,199,20,18,21,225},
+{1,388,241,209,202,491,172,184,489,407,346,75,3,191,275,371,350,14,500,456,8,138,477,221,5,449,262,422,497,285,346,316,140},
+{1,44,198,65,75,371,18,211,86,4,176,339,260,300,346,72,263,344,16,139,474,134,38,510,288,138,502,64,278,474,67,300,173},
+{1,201,205,432,221,246,475,90,477,181,298,423,445,458,469,22,425,497,446,145,130,159,206,235,394,127,188,320,472,428,270,299,183},
+{1,49,447,291,123,471,488,377,348,360,34,163,457,393,11,475,164,350,266,259,186,319,120,388,374,67,465,334,269,202,438,77,336},
+{1,73,268,99,263,149,386,333,322,144,239,187,173,321,75,414,30,449,254,168,44,445,113,463,357,475,27,172,132,506,115,412,70},
+{1,467,298,261,462,494,329,240,123,277,169,6,56,71,165,118,182,269,73,282,197,415,20,144,402,439,308,477,382,345,511,458,312},
+{1,72,343,480,101,172,300,141,472,168,12,271,233,316,211,353,178,237,28,337,80,294,50,114,266,385,489,2,72,412,120,493,145},
+{1,151,176,122,75,296,101,291,394,413,163,367,304,159,230,276,492,263,249,124,334,255,377,153,483,195,240,189,72,371,459,477,50},
+{1,66,401,97,227,48,366,494,441,440,506,107,10,233,217,439,89,480,88,418,457,451,298,499,68,29,509,421,317,333,78,122,73},
+{1,175,141,11,391,241,69,419,274,96,239,442,295,448,12,77,469,116,56,322,443,392,333,7,458,292,49,411,40,215,124,39,9},
+{1,342,501,161,365,179,156,96,410,194,408,251,231,441,168,223,400,31,49,411,404,109,90,394,266,52,191,10,292,207,44,387,92},
+{1,295,43,138,375,70,7,94,209,303,494,466,21,410,174,102,184,12,107,500,467,306,433,36,273,254,11,53,478,63,343,304,179},
+{1,84,334,387,172,367,475,177,110,495,491,187,197,300,319,453,332,299,147,202,131,204,379,141,311,454,432,90,267,286,415,429,508},
+{1,394,3,59,5,77,15,215,17,377,51,302,85,471,255,220,257,356,422,265,79,446,209,103,371,169,304,507,424,42,190,333,290},
+{1,151,397,449,6,477,112,472,20,400,288,398,120,62,305,122,272,132,343,284,401,439,3,441,56,236,10,200,72,154,336,43,27},
+{1,101,425,319,165,281,94,181,144,196,292,28,386,426,400,233,239,433,297,114,283,148,336,89,398,417,160,232,69,6,175,38,294},
+{1,110,444,143,438,414,160,386,498,448,200,346,399,489,408,452,368,109,270,246,39,505,191,98,457,363,53,2,110,222,466,455,225},
+{1,326,75,410,364,170,264,17,401,357,224,468,310,161,257,91,333,66,464,432,397,56,117,298,508,404,165,391,476,29,362,336,331},
+{1,203,289,32,270,165,418,231,249,318,300,61,404,261,211,141,391,223,91,60,351,36,243,387,290,381,188,197,344,66,453,194,264},
+{1,53,167,287,26,73,220,495,324,295,500,312,348,260,102,50,44,177,42,15,291,288,383,150,364,322,409,253,358,64,461,284,335},
+{1,450,62,428,190,441,311,106,151,237,38,478,91,433,281,410,316,247,293,327,510,227,366,170,498,218,102,174,392,370,285,444,113},
+{1,385,299,308,360,381,61,194,430,476,191,351,163,377,306,412,140,398,185,427,338,202,329,409,2,507,175,145,360,450,177,166,391},
+{1,86,27,296,325,176,188,85,225,261,316,126,364,401,30,38,306,59,494,292,428,4,344,108,419,23,449,497,170,225,258,79,335},
+{1,422,45,161,356,511,150,269,106,108,141,99,182,456,255,152,144,492,132,185,499,340,209,448,387,496,173,166,408,79,337,365,283},
+{1,503,360,72,283,421,387,127,226,313,431,385,132,295,425,140,478,151,473,109,491,405,128,209,310,428,141,41,373,161,353,163,150},
+{1,130,174,365,479,489,354,127,493,117,472,376,311,66,465,203,456,5,405,265,504,157,115,459,387,103,417,134,339,445,353,371,192},
+{1,509,157,403,438,229,349,148,41,166,354,471,287,342,503,3,292,423,406,505,303,196,444,123,490,133,346,2,509,479,172,254,88},
+{1,18,260,358,480,283,168,374,192,324,181,156,367,354,424,88,99,148,511,213,62,173,300,135,233,183,184,86,471,154,281,70,327},
+{1,273,231,467,197,291,382,463,396,365,174,258,390,349,46,208,82,153,131,474,253,138,482,340,22,377,206,2,273,494,186,177,444},
+{1,203,209,25,405,255,321,72,8,202,26,200,396,362,446,265,64,194,208,210,324,230,212,183,329,130,18,2,203,460,212,511,128},
+{1,16,256,474,326,107,46,431,136,109,78,305,389,359,308,469,438,280,90,113,398,471,406,87,161,434,344,395,356,130,449,123,151},
+{1,216,423,426,319,230,366,57,410,11,286,486,409,355,172,67,387,73,69,8,118,84,60,377,390,170,456,444,44,359,486,353,142},
+{1,383,507,258,211,361,327,416,115,86,239,365,280,142,472,123,232,466,346,322,128,166,255,17,3,224,364,103,266,390,21,46,451},
+{1,82,294,279,226,468,94,405,275,426,241,447,374,149,210,115,78,264,58,248,22,369,299,502,448,395,409,416,215,257,380,229,53},
+{1,475,315,295,146,201,450,227,284,405,95,189,122,212,428,387,304,38,361,502,339,298,254,370,245,115,270,332,377,250,98,477,43},
+{1,119,50,295,145,157,394,210,186,144,234,440,501,43,13,352,362,335,187,231,216,159,356,182,391,434,464,479,401,139,151,366,496},
+{1,119,110,336,303,390,217,116,247,482,416,392,300,287,107,251,249,23,203,276,53,70,500,284,242,73,118,25,159,192,165,34,505},
+{1,268,226,210,220,128,339,416,263,269,494,48,14,92,467,243,167,10,227,478,62,82,399,288,84,173,233,317,240,27,75,66,123},
+{1,50,405,481,491,31,417,216,485,291,341,315,106,409,185,442,433,119,92,196,18,203,284,426,286,462,443,387,241,331,84,170,358},
+{1,355,442,505,98,487,74,391,202,280,286,278,105,156,464,353,221,300,49,291,37,275,101,140,143,139,484,78,116,88,271,149,230},
+{1,46,139,417,212,197,446,59,328,445,73,213,235,309,410,412,376,503,238,419,136,467,329,403,194,372,63,496,18,350,6,114,276},
+{1,376,472,407,254,57,62,292,231,201,394,293,415,273,29,475,422,303,313,316,367,165,28,163,126,184,455,261,372,142,134,429,420},
+{1,170,212,116,237,31,125,350,485,110,341,258,60,430,211,229,262,339,313,259,150,378,167,8,281,302,103,230,124,250,350,273,504},
+{1,494,338,373,466,232,410,415,95,24,228,488,363,271,378,89,33,158,320,474,180,123,326,483,206,211,503,88,258,115,141,485,414},
+{1,493,182,102,100,115,287,467,283,509,14,101,414,425,437,383,398,273,438,133,84,443,282,16,184,3,506,474,85,43,107,283,280},
+{1,504,497,157,432,442,267,480,77,505,9,364,301,10,177,235,429,436,496,357,65,295,187,90,326,25,68,149,146,435,473,198,135},
+{1,224,197,365,191,401,501,326,60,158,96,234,439,381,475,380,315,441,86,262,455,243,129,207,31,175,245,280,196,298,498,499,387},
+{1,427,217,228,102,212,274,310,165,63,55,256,14,232,59,349,391,125,368,136,304,378,266,396,84,277,322,329,176,328,404,119,121},
+{1,230,154,366,285,336,487,157,53,306,136,358,511,443,264,3,298,430,91,206,25,448,423,95,191,408,67,488,146,198,393,324,41},
+{1,147,469,142,334,462,132,253,219,485,11,288,192,495,440,53,417,281,67,272,69,385,182,350,228,503,7,2,147,279,478,215,414},
+};
+
+static const uint16_t prescr_table_32_2281[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,6,2,7,4,5,3,1,6,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,7,2,6,1},
+{1,6,3,7,5,4,2,1,6,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2},
+{1,3,5,15,2,6,10,13,4,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1},
+{1,12,6,3,13,10,5,14,7,15,9,4,1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11},
+{1,6,11,4,7,13,15,3,10,2,6,10,1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,15,14,13},
+{1,20,29,24,22,16,7,3,25,2,20,28,6,25,1,10,14,3,30,18,5,7,19,15,9,16,17,27,21,22,8,26,31},
+{1,26,12,28,2,29,24,17,4,19,24,28,1,13,3,23,5,16,15,25,17,2,26,6,7,10,9,30,27,11,4,29,12},
+{1,4,16,30,9,11,3,12,31,13,26,27,25,29,21,5,10,20,7,14,28,23,1,2,4,8,16,15,30,19,9,18,11},
+{1,8,25,20,18,21,26,12,14,30,22,1,4,16,25,10,31,18,17,29,26,6,24,14,15,11,27,2,8,23,5,20,9},
+{1,28,18,27,11,19,7,25,8,12,5,13,11,20,15,23,29,7,17,2,28,9,8,6,31,27,24,10,26,22,19,30,21},
+{1,23,9,28,6,8,11,15,20,13,29,22,15,10,12,8,27,18,28,3,2,23,26,7,17,30,20,24,16,11,25,5,6},
+{1,14,23,15,25,24,22,1,14,23,38,55,3,9,63,59,39,48,22,33,34,43,20,47,8,56,46,15,45,6,18,61,53},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,31,9,30,22,23,8,1,31,9,15,46,8,43,18,30,11,16,1,36,60,22,32,2,31,47,44,23,4,62,9,15,46},
+{1,23,34,22,53,52,35,1,23,34,11,54,43,42,12,41,61,29,1,38,37,20,32,28,39,3,49,52,60,59,36,50,5},
+{1,11,36,10,47,46,37,1,11,36,5,35,45,28,3,62,27,43,1,53,9,25,32,19,7,40,63,46,34,24,21,26,30},
+{1,54,59,55,13,12,58,1,54,59,40,41,50,37,47,15,48,19,1,27,23,10,32,63,35,18,26,12,29,42,31,28,49},
+{1,21,18,20,7,6,19,1,21,18,10,44,45,17,35,23,28,12,19,54,30,25,26,51,8,57,36,20,53,55,34,43,46},
+{1,41,15,40,38,39,14,1,41,15,20,48,51,55,22,25,13,61,14,57,47,54,59,6,8,49,30,40,19,21,29,44,50},
+{1,53,61,52,8,9,60,1,53,61,26,2,53,36,13,1,32,18,60,58,16,9,30,29,8,62,15,52,4,31,61,26,2},
+{1,10,68,39,112,106,13,114,126,6,30,102,123,18,90,52,103,126,3,15,51,124,9,45,26,114,63,64,70,88,62,69,87},
+{1,26,86,2,52,37,4,104,74,8,104,37,2,26,43,68,66,108,17,84,27,38,21,96,77,39,24,49,111,6,46,125,69},
+{1,97,8,42,64,78,60,76,113,92,85,55,37,110,74,83,27,41,54,82,108,43,87,86,33,35,66,70,11,3,22,6,44},
+{1,126,11,20,69,13,50,127,117,31,96,18,121,97,45,23,43,4,109,11,10,53,91,17,56,66,98,108,52,100,127,114,107},
+{1,65,114,30,56,78,110,57,15,28,93,100,45,42,26,3,47,107,35,74,40,91,58,102,108,19,83,4,31,114,15,14,96},
+{1,103,82,7,123,87,21,47,76,107,53,121,31,86,57,101,78,1,96,71,20,36,84,94,76,102,73,111,92,43,79,97,39},
+{1,106,114,113,100,89,97,102,38,46,66,110,70,17,52,124,45,29,30,65,49,54,22,20,126,71,36,125,24,84,122,56,86},
+{1,60,33,41,2,120,66,82,4,73,66,41,1,30,38,18,23,113,118,44,103,25,124,89,105,20,83,28,26,94,51,95,45},
+{1,108,50,104,67,31,34,109,94,90,74,23,96,15,76,28,75,33,51,2,108,25,26,64,10,29,125,114,62,34,105,72,123},
+{1,23,86,76,40,31,47,122,15,28,11,32,51,54,115,80,31,119,126,73,81,116,2,23,43,19,5,69,35,79,104,9,55},
+{1,5,17,85,92,113,35,100,98,124,13,121,96,59,14,27,94,88,87,43,38,95,63,4,10,17,79,23,64,107,77,18,45},
+{1,87,14,6,84,36,20,94,11,120,49,103,34,32,119,112,24,123,36,10,126,27,110,73,86,69,2,87,7,104,99,95,46},
+{1,48,41,103,23,17,100,71,106,24,63,35,124,118,83,127,94,18,26,15,93,58,91,106,12,117,123,62,59,67,85,47,9},
+{1,95,49,31,119,81,122,30,40,96,64,35,97,29,22,71,122,15,10,12,8,83,98,31,73,45,54,36,56,115,1,93,53},
+{1,98,108,82,56,23,118,83,90,123,18,33,88,40,63,4,43,108,41,14,31,109,24,21,89,25,36,66,95,80,126,8,86},
+{1,12,80,4,48,83,16,49,95,64,98,95,32,49,87,16,96,83,8,48,81,4,24,80,2,12,40,1,6,20,120,3,10},
+{1,56,61,18,44,118,29,93,52,4,112,61,9,11,51,86,41,87,53,30,113,33,64,79,12,103,71,27,29,85,13,123,14},
+{1,30,83,80,114,122,119,28,111,11,105,89,78,110,116,31,88,65,59,126,121,84,5,51,6,34,4,60,83,40,98,48,23},
+{1,247,83,98,181,47,195,130,252,168,145,134,139,121,222,74,207,69,202,70,203,176,153,119,45,27,9,7,244,165,99,33,31},
+{1,64,205,45,143,96,37,181,70,80,210,95,47,137,240,107,225,113,134,13,189,62,147,151,23,218,66,168,164,57,115,198,229},
+{1,98,78,31,178,171,126,90,102,237,6,166,105,215,112,40,121,186,99,22,203,122,233,194,232,243,110,64,159,76,248,158,125},
+{1,130,118,109,7,249,111,46,21,181,16,164,245,218,7,234,198,216,133,209,150,182,211,20,141,131,122,219,70,97,238,239,174},
+{1,20,41,70,165,53,207,146,210,15,102,183,50,205,93,32,121,113,33,115,53,251,184,84,122,111,237,36,81,88,2,20,136},
+{1,95,219,63,113,198,150,105,115,120,144,74,122,207,184,58,169,12,253,82,191,107,249,236,100,235,53,187,213,34,108,168,188},
+{1,89,165,97,86,53,209,227,240,191,180,78,199,110,99,114,170,222,159,16,82,14,194,86,188,103,192,15,72,44,63,190,62},
+{1,10,68,22,156,164,75,112,129,118,241,212,101,174,168,182,208,113,234,163,145,107,152,70,1,5,17,85,94,121,194,43,135},
+{1,74,93,135,43,214,113,196,170,34,5,177,163,127,247,227,225,171,52,77,100,69,47,255,168,91,44,144,201,175,160,16,150},
+{1,57,213,131,214,200,204,40,211,21,113,66,71,155,34,6,75,13,56,118,167,38,116,158,254,191,111,64,126,67,233,247,245},
+{1,182,94,147,178,84,130,44,78,187,123,139,71,184,150,7,232,210,82,242,122,208,228,221,176,156,187,123,139,71,184,150,7},
+{1,103,150,77,189,1,103,150,77,189,184,253,246,247,124,225,126,134,53,201,180,222,61,36,233,147,219,120,47,232,24,70,231},
+{1,164,196,127,45,79,203,102,250,36,176,161,15,183,104,152,80,149,67,159,153,2,164,98,66,205,168,35,121,54,232,74,179},
+{1,129,95,191,132,44,231,49,78,123,222,112,80,21,27,17,98,78,128,111,56,40,183,176,181,49,39,64,138,28,20,230,88},
+{1,24,199,108,178,1,24,199,108,178,195,6,40,103,45,91,186,163,15,68,62,143,88,174,83,218,170,99,29,156,140,76,94},
+{1,223,104,30,168,1,223,104,30,168,197,85,13,245,162,112,177,209,180,78,198,32,35,86,120,219,1,170,26,97,207,224,233},
+{1,19,136,94,44,35,194,131,243,218,83,179,154,164,248,253,20,190,63,147,39,71,13,165,55,223,186,25,27,8,76,157,94},
+{1,180,229,249,49,89,254,3,67,176,74,115,225,68,65,236,152,96,237,194,241,166,235,129,169,131,29,62,139,108,107,114,187},
+{1,64,7,99,21,138,107,240,178,53,44,74,49,172,77,209,16,229,28,198,21,69,114,30,134,199,53,44,74,49,172,77,209},
+{1,200,147,202,170,69,151,184,29,63,98,107,125,104,209,111,68,251,180,145,173,99,15,231,27,58,63,98,107,125,104,209,111},
+{1,175,131,40,196,51,87,22,141,118,137,212,31,126,230,99,55,28,94,235,108,151,37,109,24,177,104,120,166,121,41,237,44},
+{1,254,92,178,33,221,192,202,50,173,53,72,161,246,172,74,95,216,94,167,73,222,225,213,226,84,219,223,158,194,155,252,208},
+{1,64,109,124,182,196,116,243,42,18,5,160,231,208,255,86,82,210,191,129,77,180,34,202,57,44,201,89,113,56,12,67,183},
+{1,114,176,196,151,109,51,178,32,56,21,211,13,218,51,89,8,7,175,196,172,143,216,65,1,57,44,255,242,40,27,66,74},
+{1,20,199,3,60,158,5,68,117,15,102,82,77,139,107,32,151,179,12,120,158,233,17,170,246,215,74,189,96,110,2,20,136},
+{1,151,167,78,180,198,214,58,108,66,146,235,234,79,255,111,19,68,246,241,48,154,208,121,1,165,176,144,124,87,178,7,193},
+{1,142,193,112,59,155,26,157,240,50,232,42,219,133,75,80,170,44,174,215,111,239,24,51,175,144,213,225,124,4,251,193,56},
+{1,239,98,145,134,133,71,225,161,216,82,158,85,210,231,107,101,253,106,235,28,195,221,241,29,77,60,88,43,160,226,200,230},
+{1,239,153,77,190,112,169,79,149,183,227,203,48,1,141,91,55,72,249,222,58,184,252,120,248,83,97,143,180,129,38,105,217},
+{1,80,161,235,142,14,146,211,205,176,42,6,240,13,49,76,62,45,222,171,96,200,208,226,214,18,219,35,151,29,186,195,17},
+{1,272,128,204,96,85,40,191,30,497,389,1,136,32,280,6,307,192,85,20,175,131,510,120,481,265,2,272,64,51,12,101,384},
+{1,109,251,93,478,5,473,262,297,149,256,299,303,501,270,40,343,29,297,322,128,413,415,498,135,20,419,262,412,161,64,454,455},
+{1,465,133,25,230,143,321,490,117,388,81,173,416,62,46,195,192,242,20,344,134,309,468,287,162,346,343,124,92,390,384,484,40},
+{1,460,41,361,119,156,373,265,507,445,280,311,193,362,28,191,223,25,474,375,69,481,291,355,487,364,83,399,183,450,75,179,65},
+{1,212,122,443,14,26,237,198,84,140,162,297,107,356,501,295,102,471,117,426,174,496,229,274,225,186,155,375,392,508,60,412,151},
+{1,316,149,353,235,380,172,134,141,176,488,366,62,18,104,293,60,302,308,502,505,164,233,386,375,350,495,153,345,24,510,339,398},
+{1,456,313,435,499,366,386,222,26,200,191,12,214,376,115,272,483,110,507,450,312,292,299,209,503,276,64,343,59,306,409,239,386},
+{1,34,146,316,328,209,246,206,355,369,175,312,224,273,18,306,74,124,353,447,315,211,89,351,42,193,363,277,86,416,212,46,133},
+{1,242,314,163,386,483,170,11,109,419,267,208,192,443,481,167,293,248,510,290,407,315,260,46,40,318,153,118,412,33,214,470,28},
+{1,31,341,136,229,224,131,60,203,485,109,301,143,92,261,259,290,498,404,506,488,271,352,82,344,294,460,193,446,105,275,474,24},
+{1,143,427,253,38,490,296,445,222,282,181,231,119,415,388,149,387,113,14,456,383,279,135,446,405,338,65,472,461,276,381,408,352},
+{1,239,496,502,509,271,489,309,428,264,434,419,291,36,49,367,408,374,205,504,302,364,52,498,20,29,139,382,280,113,216,166,473},
+{1,159,471,223,231,21,192,319,350,105,447,415,467,102,373,187,174,206,26,170,496,461,498,338,46,510,127,56,121,409,114,109,129},
+{1,35,235,160,193,368,331,255,107,239,22,381,126,312,412,129,54,314,447,463,30,497,424,408,199,221,362,41,481,176,67,391,28},
+{1,226,440,337,88,370,421,130,213,227,173,165,336,93,268,288,66,57,320,458,363,511,26,128,438,325,127,189,306,311,130,340,409},
+{1,42,330,367,419,511,188,169,12,504,53,310,49,354,379,150,434,249,280,192,210,424,299,392,268,452,446,5,65,91,393,281,213},
+{1,383,158,458,227,390,274,287,282,179,96,194,251,441,223,31,411,109,394,52,10,425,371,242,154,142,329,314,222,490,246,241,16},
+{1,68,490,51,451,179,55,211,176,251,58,159,445,383,444,349,138,430,416,124,46,174,84,76,485,171,254,144,67,27,463,141,320},
+{1,6,20,120,272,389,88,464,422,146,438,121,139,413,4,12,20,60,68,204,340,351,322,357,268,439,122,142,402,21,63,65,195},
+{1,26,324,497,445,106,110,6,92,119,182,49,381,191,84,257,118,187,96,69,476,125,196,190,89,336,334,472,73,384,276,159,500},
+{1,191,147,81,413,98,295,29,262,149,190,22,359,366,53,412,313,109,350,479,185,223,101,269,249,232,326,298,380,44,97,115,106},
+{1,49,111,419,493,390,225,176,99,239,207,360,167,498,159,281,50,30,287,97,285,80,113,149,492,384,376,303,78,366,244,241,464},
+{1,37,363,202,196,306,35,437,119,197,469,82,215,216,367,47,346,236,224,62,318,401,450,89,298,243,127,424,479,227,343,382,75},
+{1,132,298,58,172,317,218,365,244,173,443,124,115,354,363,502,64,425,326,464,127,181,218,465,61,408,265,360,304,504,275,141,8},
+{1,499,366,25,160,306,321,326,317,68,365,262,428,121,39,376,222,491,374,165,63,185,201,448,390,280,169,439,474,436,440,48,339},
+{1,303,106,184,71,437,335,152,416,244,294,197,397,401,209,455,83,509,295,319,250,390,78,327,326,188,459,476,323,451,214,407,379},
+{1,271,241,23,117,268,277,260,76,403,122,329,104,287,91,243,126,418,153,110,251,424,64,142,302,184,468,237,277,130,19,427,178},
+{1,339,281,62,414,388,166,235,126,410,157,76,227,129,465,167,220,411,328,180,294,261,386,351,273,161,464,370,36,94,204,231,222},
+{1,24,320,10,240,391,68,98,51,425,490,511,259,16,192,3,20,240,323,17,204,83,213,255,263,32,384,6,40,480,391,34,408},
+{1,504,152,296,226,200,475,236,370,109,392,130,53,446,56,103,438,510,343,158,399,357,199,325,505,176,108,372,164,16,159,371,323},
+{1,251,159,341,115,207,373,401,505,312,88,233,204,60,12,271,417,117,224,450,106,273,423,376,442,114,26,496,402,122,227,206,199},
+{1,335,71,259,432,349,434,220,316,453,302,24,39,402,26,360,62,157,350,190,333,227,299,177,182,336,109,40,105,425,46,167,66},
+{1,352,299,413,415,124,265,272,269,501,98,185,215,360,481,75,91,401,88,65,478,480,251,217,270,187,439,108,223,397,148,470,261},
+{1,509,401,134,141,422,104,129,45,2,509,336,441,495,176,207,346,466,172,399,254,27,272,461,375,467,458,295,442,372,328,50,474},
+{1,436,95,340,300,324,143,505,251,123,346,471,258,64,125,189,58,509,435,143,353,240,104,376,448,371,8,166,190,340,150,81,491},
+{1,275,374,31,322,218,341,511,393,82,232,180,439,363,25,221,95,317,414,287,67,418,334,149,84,148,377,365,101,272,133,51,151},
+{1,55,196,472,60,293,42,424,129,463,67,501,303,254,384,260,406,229,367,128,252,439,358,480,325,84,424,487,160,195,265,152,408},
+{1,329,97,75,238,307,327,243,350,87,229,445,187,152,167,10,384,351,143,188,273,56,292,277,497,325,157,103,264,106,257,426,160},
+{1,492,454,44,33,314,499,15,418,36,210,275,166,146,453,268,498,321,25,1,246,449,437,52,343,201,254,179,344,24,247,311,116},
+{1,11,69,396,51,461,403,234,184,437,216,191,194,192,203,348,319,340,275,478,159,114,387,45,314,242,40,156,457,362,458,209,291},
+{1,137,89,196,327,192,14,420,115,271,15,288,444,313,248,34,26,63,76,381,204,92,130,424,468,453,456,97,71,335,297,263,326},
+{1,455,278,91,286,220,503,375,350,369,405,164,94,296,221,24,381,146,237,401,89,328,188,291,442,48,393,292,474,81,178,483,376},
+{1,46,469,504,95,167,399,457,431,392,318,289,140,102,428,253,223,366,16,368,426,143,95,492,188,137,45,364,62,37,468,235,477},
+{1,277,419,430,470,378,391,167,497,201,96,315,411,339,123,11,134,155,273,188,10,462,464,7,498,507,104,480,344,253,144,407,39},
+{1,138,118,172,78,356,243,34,415,16,193,472,344,78,178,223,288,33,455,485,237,233,509,395,477,9,482,310,382,82,192,413,130},
+{1,87,312,214,210,398,397,372,413,231,280,504,482,496,190,33,104,72,475,477,292,128,270,24,69,466,378,187,372,286,257,70,126},
+{1,350,108,439,70,28,170,207,221,34,168,227,236,435,298,107,505,394,303,461,398,38,417,143,493,120,243,23,3,497,45,503,122},
+{1,319,344,230,275,185,423,120,451,318,495,435,405,433,170,285,335,422,383,276,59,249,183,448,227,465,462,44,300,190,180,444,25},
+{1,152,409,261,315,468,178,451,431,355,39,246,465,293,108,102,345,131,213,23,365,40,181,230,344,207,417,349,435,332,374,466,497},
+{1,326,194,263,253,274,439,468,501,490,83,509,432,72,28,323,389,420,78,29,480,80,24,4,327,194,358,296,309,213,133,157,153},
+{1,43,18,299,260,442,217,294,219,368,409,303,212,410,247,319,396,466,364,59,337,279,93,358,188,380,355,281,140,345,443,121,77},
+{1,492,225,9,472,67,65,76,398,412,278,320,69,43,360,55,331,325,190,7,279,438,136,442,159,153,376,3,282,343,358,460,498},
+{1,56,299,193,77,124,175,203,509,125,423,120,459,3,36,41,165,337,127,415,257,269,413,313,116,347,167,361,262,345,159,16,448},
+{1,452,61,371,372,13,190,289,171,136,473,28,273,179,318,403,120,183,341,430,304,234,464,40,109,402,154,433,263,176,24,378,142},
+{1,206,225,410,143,370,121,454,12,371,431,327,316,273,150,429,393,184,131,500,455,97,400,428,494,122,74,325,498,149,260,207,483},
+{1,412,315,345,499,380,462,88,343,65,233,207,126,487,138,84,19,421,305,331,111,478,219,74,61,146,293,383,437,454,426,294,45},
+};
+
+static const uint16_t prescr_table_32_3217[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,7,6,3,4,2,1,5,7,6,3,4,2,1,5},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2},
+{1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,12,5,7,15,9,2,8,6,11,10,14,13,1,4,3,12},
+{1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,14,11,4,12,13,14,11,4,12,13,14,11,4,12,13},
+{1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,8,12,10,15,7,11,1,14,9,2,3,13,4,6,5},
+{1,11,15,6,31,7,20,8,18,23,21,3,29,17,10,4,9,25,12,31,17,5,1,23,24,27,7,10,2,11,21,19,14},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,20,10,5,22,11,17,28,14,7,23,31,27,25,24,12},
+{1,19,12,25,14,16,22,13,10,2,9,24,29,28,15,3,26,20,2,19,6,26,10,1,30,3,13,5,23,15,22,17,21},
+{1,9,24,4,19,14,16,21,15,25,13,11,10,3,27,31,12,2,9,12,1,31,6,27,20,3,22,10,26,11,5,13,30},
+{1,24,2,11,4,22,8,23,16,21,27,17,13,25,26,9,15,18,15,9,26,25,13,17,27,21,16,23,8,22,4,11,2},
+{1,3,5,15,17,14,18,11,29,26,19,8,24,21,2,6,10,30,17,7,26,23,2,3,28,18,27,8,12,10,15,22,29},
+{1,47,38,62,36,35,43,28,32,25,53,33,54,19,31,18,48,52,7,4,29,38,31,9,12,39,41,33,27,20,42,56,32},
+{1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,36,9,16,4,1,18,32,8,2,36,9,16,4,1,18},
+{1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,43,30,16,36,22,2,47,23,62,15,8,18,11,1,60},
+{1,52,22,23,35,53,34,1,52,22,23,35,53,34,1,52,22,23,60,54,63,24,28,47,57,31,1,26,40,36,42,16,33},
+{1,15,52,11,8,25,36,57,33,10,7,45,47,49,56,46,62,12,34,61,62,6,17,46,31,3,56,23,63,49,28,59,47},
+{1,39,15,54,50,7,59,45,43,55,21,8,13,31,44,12,56,35,29,49,55,57,2,39,52,62,44,6,14,59,37,19,10},
+{1,27,43,39,36,9,25,29,28,7,44,11,47,38,63,34,62,57,60,49,61,10,26,24,3,32,4,54,43,37,9,58,28},
+{1,35,56,11,36,55,54,21,45,38,2,53,3,22,59,29,31,42,45,19,57,20,7,62,42,45,19,57,20,7,62,42,45},
+{1,36,2,61,4,15,8,30,16,60,32,13,53,26,31,52,62,29,62,52,31,26,53,13,32,60,16,30,8,15,4,61,2},
+{1,13,81,20,103,76,22,125,109,62,48,118,18,73,47,110,41,64,37,14,35,25,27,22,127,122,39,3,74,28,70,50,54},
+{1,44,24,31,82,26,71,98,36,106,86,35,39,30,126,2,88,48,31,41,66,127,23,16,114,96,62,82,13,119,46,32,109},
+{1,88,47,55,45,8,115,102,41,118,64,53,18,86,29,60,57,31,70,58,60,91,36,86,73,15,53,9,82,118,32,105,102},
+{1,17,35,87,28,111,83,88,114,45,40,125,67,106,6,102,91,65,36,16,25,29,63,28,127,120,11,21,123,90,40,118,124},
+{1,38,97,94,7,111,29,61,21,55,83,46,107,24,30,87,43,72,45,78,71,81,49,13,90,1,19,63,98,26,41,2,38},
+{1,8,64,59,49,97,125,58,57,33,70,11,88,92,124,50,121,26,104,73,106,65,74,102,113,45,19,76,126,17,68,94,54},
+{1,4,16,64,86,14,56,75,122,21,84,6,24,96,125,9,36,59,118,71,37,74,63,126,87,5,10,20,40,80,11,22,44},
+{1,98,11,32,69,18,3,31,29,96,118,54,5,33,39,25,35,90,91,106,26,30,99,104,120,71,107,43,110,103,21,115,87},
+{1,125,77,79,10,47,14,26,68,88,108,91,84,51,58,45,75,63,109,19,118,80,3,28,26,34,22,82,126,101,38,83,31},
+{1,27,6,90,20,94,120,70,83,22,104,116,51,123,107,89,57,84,75,126,14,65,9,1,109,97,59,49,70,73,101,13,55},
+{1,119,14,48,84,125,116,92,34,4,74,56,11,13,98,70,45,67,8,74,28,48,42,72,107,55,38,39,121,31,25,75,66},
+{1,10,68,66,126,64,106,27,61,52,110,51,88,73,48,70,86,37,98,76,9,45,74,23,75,18,90,71,46,69,36,103,93},
+{1,79,114,109,10,24,32,51,68,37,63,84,86,29,44,35,55,7,73,61,101,70,55,105,78,116,88,35,113,94,39,58,44},
+{1,74,15,50,85,33,114,37,117,25,88,98,57,96,72,126,44,49,55,12,118,17,43,116,91,94,10,77,107,76,78,4,113},
+{1,31,100,119,120,50,76,60,25,38,30,123,19,15,74,126,112,37,104,14,93,113,29,45,20,41,42,77,102,83,44,108,48},
+{1,60,15,71,85,41,54,117,33,52,13,63,75,86,109,39,77,47,95,81,20,122,51,36,124,119,84,114,50,58,59,37,98},
+{1,49,124,3,83,115,5,2,98,15,6,81,17,10,4,51,30,12,81,115,121,123,74,116,73,38,104,126,75,23,86,67,36},
+{1,53,10,56,68,74,91,55,96,44,52,63,50,124,14,17,108,87,38,6,95,15,18,103,45,126,50,62,125,99,71,116,46},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,39,97,134,184,145,7,245,58,181,15,208,21,241,166,44,45,10,187,124,41,75,178,125,180,20,107,248,82,150,121,250,117},
+{1,139,160,79,73,14,179,58,167,131,84,200,103,16,195,37,92,60,112,154,116,167,212,21,25,94,149,104,20,201,118,44,132},
+{1,186,175,53,147,85,136,109,90,144,182,84,50,194,111,3,227,220,185,38,113,143,30,24,251,149,95,76,226,51,60,48,219},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,94,218,186,112,233,61,242,114,85,182,185,146,184,204,98,118,18,208,68,250,126,78,227,152,69,213,215,137,228,85,91,254},
+{1,213,203,114,210,122,153,193,222,178,217,3,50,16,150,59,142,230,7,254,207,222,89,101,220,140,166,102,197,136,65,173,252},
+{1,66,136,182,206,105,230,193,86,220,238,111,53,16,3,198,199,133,169,121,221,86,110,148,38,197,175,191,17,143,188,114,233},
+{1,139,33,145,238,110,6,159,198,195,162,7,20,231,82,76,105,18,60,37,140,171,172,166,199,36,120,74,123,53,59,47,237},
+{1,125,174,212,108,93,215,235,202,206,95,45,210,7,22,229,230,97,123,208,204,224,5,118,55,194,246,197,253,165,10,236,110},
+{1,189,27,122,44,51,111,47,157,66,161,233,23,16,152,217,214,18,241,213,94,157,33,114,48,212,180,117,116,158,118,35,207},
+{1,21,96,198,131,70,250,28,221,53,34,104,110,16,33,87,206,43,210,123,56,221,162,176,13,204,184,89,12,126,160,165,61},
+{1,164,196,127,45,79,203,102,250,36,23,106,120,200,253,193,165,96,230,175,234,238,209,21,145,124,91,29,239,131,36,176,161},
+{1,63,185,94,243,44,133,166,29,61,199,87,79,177,221,215,42,7,227,149,208,246,202,182,48,254,54,191,110,58,61,222,75},
+{1,58,86,3,78,250,5,210,137,15,241,28,17,148,36,51,59,108,233,177,213,212,201,31,236,216,85,229,45,47,21,62,95},
+{1,165,79,239,12,27,82,117,80,180,206,225,214,215,114,61,210,222,167,71,187,157,221,149,212,11,59,13,95,160,180,103,159},
+{1,5,17,85,140,43,135,12,60,204,230,100,121,16,80,157,126,11,213,139,24,60,102,255,202,124,198,98,245,219,144,229,243},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,93,245,28,192,184,243,113,27,240,150,167,212,117,204,98,230,225,185,87,33,229,3,162,47,213,20,183,103,54,240,75,65},
+{1,123,102,111,158,154,223,238,251,120,235,197,47,145,216,38,96,220,229,126,44,14,200,153,41,17,99,252,88,28,57,155,82},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,41,114,74,70,23,136,138,216,60,168,36,10,167,14,3,123,150,111,236,238,199,254,50,139,166,205,115,239,13,60,84,9},
+{1,17,194,191,30,61,107,20,151,243,24,91,162,16,211,125,161,35,43,111,40,151,152,6,51,163,225,149,137,103,108,208,39},
+{1,143,175,89,13,56,87,107,81,215,45,206,3,94,62,235,23,72,155,187,192,213,126,100,92,144,249,185,79,101,252,200,184},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,69,147,111,183,71,25,148,105,244,151,166,156,38,162,85,13,195,119,51,88,103,124,115,185,203,190,200,55,210,244,165,199},
+{1,24,167,112,210,218,26,151,217,50,153,73,163,16,103,253,156,49,171,104,201,217,25,172,76,158,243,6,40,7,36,87,42},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,252,105,77,135,65,169,178,31,183,249,143,117,11,197,25,160,122,106,94,15,149,18,200,159,244,212,188,30,223,36,101,203},
+{1,197,208,153,56,139,33,17,175,19,220,74,23,58,248,120,218,223,126,219,13,11,189,5,237,228,156,241,68,167,19,110,238},
+{1,123,347,373,221,138,143,280,297,398,36,133,53,331,192,371,455,341,218,500,130,170,243,145,54,227,330,348,10,407,281,169,436},
+{1,70,156,378,353,456,298,43,111,127,61,441,162,9,103,94,255,60,503,263,232,214,359,46,400,296,347,473,151,448,397,190,185},
+{1,128,247,244,372,109,369,250,77,457,199,16,92,277,293,449,233,401,489,308,389,199,8,23,494,244,186,405,233,451,511,154,457},
+{1,275,223,196,246,232,435,21,129,18,469,20,402,205,273,226,378,382,130,158,45,43,261,184,235,323,93,252,285,54,50,15,208},
+{1,107,271,414,477,13,190,397,435,197,81,469,372,66,443,444,173,483,429,282,69,85,300,338,79,402,132,443,222,163,240,353,171},
+{1,54,334,392,163,28,37,89,421,330,336,449,75,132,41,305,46,435,335,223,240,292,464,152,6,90,489,166,121,137,429,125,229},
+{1,109,431,384,210,54,225,270,169,114,370,494,458,372,128,78,18,95,125,149,137,188,151,228,370,247,363,311,8,436,365,384,105},
+{1,81,274,123,52,389,448,16,390,307,365,267,367,425,256,351,360,30,372,298,281,256,394,90,145,267,402,477,32,390,444,492,104},
+{1,334,177,248,430,145,382,500,143,447,284,482,259,109,346,504,72,24,199,511,264,377,470,230,411,136,223,312,247,113,175,304,381},
+{1,399,453,300,294,477,445,422,505,361,102,391,127,153,314,401,200,396,426,79,498,289,231,22,372,509,218,243,237,324,364,154,250},
+{1,144,254,172,301,259,356,492,460,228,338,341,192,95,382,18,436,295,262,474,392,122,323,410,160,161,233,484,195,453,31,407,493},
+{1,197,358,432,191,310,220,22,465,21,158,470,39,23,276,371,302,361,444,412,186,71,60,322,116,26,299,348,213,32,294,253,123},
+{1,424,123,361,140,124,495,493,210,36,153,385,377,200,381,217,145,419,103,143,322,367,209,366,5,491,254,376,176,374,54,241,298},
+{1,130,417,226,327,474,128,165,471,131,291,323,421,157,346,37,370,340,208,24,129,296,294,223,416,48,258,39,59,446,311,96,115},
+{1,448,119,6,122,306,20,284,43,120,207,250,272,223,97,231,191,326,297,478,460,383,422,149,127,388,462,191,163,426,239,230,385},
+{1,158,130,248,466,110,174,392,309,100,108,402,140,197,327,176,206,283,20,194,13,396,229,155,306,479,443,397,170,504,301,307,400},
+{1,315,268,251,307,21,90,340,332,242,273,440,198,318,497,237,177,192,327,339,169,191,126,238,510,245,461,423,179,347,367,50,133},
+{1,164,353,165,453,452,352,1,164,353,165,453,452,352,1,164,353,165,430,113,44,357,86,438,106,193,138,61,293,30,503,112,126},
+{1,194,290,61,484,180,23,420,214,448,302,99,277,424,136,305,50,252,192,83,359,155,159,283,57,374,271,72,410,58,469,135,325},
+{1,301,212,269,250,379,414,391,484,68,418,281,275,181,82,180,383,96,57,372,295,185,296,337,11,279,503,402,144,261,387,13,197},
+{1,62,10,396,68,154,7,186,54,506,476,361,21,393,130,184,74,494,354,388,218,357,473,384,166,367,287,401,329,18,462,45,468},
+{1,142,443,252,417,117,263,454,229,186,169,432,112,262,328,350,70,264,441,240,24,401,244,260,42,138,154,388,177,329,232,393,357},
+{1,421,247,51,8,27,127,408,64,216,325,499,189,263,220,22,146,113,461,44,146,358,440,22,73,179,220,11,378,263,110,347,189},
+{1,416,466,54,97,478,138,74,182,201,49,415,382,8,365,50,432,455,41,276,74,91,486,236,53,39,234,26,284,411,304,464,443},
+{1,127,268,368,253,72,500,187,407,481,443,50,379,341,120,113,295,478,53,3,296,197,114,211,474,203,271,400,78,123,120,336,405},
+{1,231,431,69,467,218,420,313,128,230,328,490,406,265,382,157,441,102,215,325,354,511,78,314,441,51,262,463,177,402,39,157,433},
+{1,385,140,291,121,58,331,68,28,94,174,301,86,109,167,111,336,375,395,220,209,391,48,325,335,469,139,39,74,355,191,149,393},
+{1,174,83,276,454,321,463,365,509,452,29,361,444,136,447,378,330,191,384,223,117,124,106,282,336,334,127,147,409,75,73,231,434},
+{1,439,214,485,292,446,221,385,236,189,151,438,353,307,193,154,355,348,310,212,197,34,462,217,303,237,133,208,170,244,188,144,88},
+{1,506,156,470,242,18,505,385,114,411,260,463,153,482,269,186,464,475,429,14,211,490,193,159,492,476,77,251,314,44,55,113,67},
+{1,117,493,461,44,136,275,428,367,137,358,65,162,165,494,338,270,458,313,13,142,412,250,336,242,132,61,329,43,363,292,62,140},
+{1,191,222,236,91,92,126,379,224,353,245,399,464,111,118,418,46,63,153,28,68,261,322,296,445,316,26,389,436,271,30,251,362},
+{1,28,336,251,334,403,54,299,26,280,349,119,113,57,415,166,324,331,366,152,470,142,274,339,510,318,219,359,230,1,14,84,123},
+{1,141,45,268,258,38,416,29,500,16,327,481,223,63,337,185,464,170,128,79,243,223,391,152,113,29,250,4,282,45,134,472,336},
+{1,380,386,9,6,382,65,54,20,370,390,180,120,346,89,131,272,426,235,351,204,145,142,328,439,81,353,123,367,121,19,184,322},
+{1,390,269,356,34,462,70,144,479,161,179,407,490,327,106,133,434,365,88,21,402,115,187,485,141,83,474,370,198,23,20,337,226},
+{1,161,38,162,453,200,35,456,379,429,108,367,468,475,298,232,8,217,152,324,453,100,219,57,343,74,321,368,492,490,9,60,482},
+{1,455,464,374,197,229,217,350,246,469,283,227,422,83,372,16,30,366,106,79,458,217,175,400,135,36,203,359,142,192,68,233,190},
+{1,238,129,198,313,259,354,402,417,156,326,321,170,76,383,18,473,309,52,107,79,406,188,166,291,180,127,33,114,339,265,134,294},
+{1,250,83,72,295,172,98,112,227,200,357,377,411,425,159,430,274,23,117,77,175,182,334,106,187,68,81,222,271,434,248,358,398},
+{1,79,83,317,259,272,134,244,101,59,352,137,12,41,185,168,416,372,121,284,481,200,116,303,109,151,254,247,90,389,242,341,175},
+{1,275,271,405,95,50,160,427,487,17,145,333,46,58,97,394,131,410,313,118,370,507,508,138,36,215,302,449,117,337,90,124,440},
+{1,510,411,436,241,388,293,418,237,104,420,360,179,413,49,42,445,124,290,339,267,307,223,288,173,121,350,113,88,56,492,511,397},
+{1,401,93,423,232,13,454,68,152,135,81,496,241,306,425,24,174,50,319,501,23,293,51,53,259,178,233,206,325,367,7,60,327},
+{1,89,138,223,118,463,172,132,78,4,356,423,243,472,34,319,415,312,8,356,276,223,59,144,466,300,509,73,258,371,339,82,147},
+{1,232,58,478,423,337,188,47,307,372,93,255,263,377,182,509,151,285,391,380,511,371,178,254,295,360,45,417,64,8,1,116,478},
+{1,3,5,15,17,51,85,255,257,182,474,475,472,477,466,451,496,421,173,289,107,388,326,485,205,369,19,448,288,432,360,476,306},
+{1,56,395,105,366,495,31,337,204,12,288,91,341,44,338,132,296,411,40,217,426,461,466,166,149,328,346,162,229,195,178,293,413},
+{1,45,24,127,320,65,56,406,391,189,293,292,265,273,366,46,111,87,259,498,388,101,337,350,104,74,368,444,174,449,35,207,202},
+{1,475,30,336,340,430,470,203,454,232,38,193,79,36,188,115,335,479,114,74,359,467,245,104,159,300,444,196,183,501,368,137,382},
+{1,78,264,430,139,128,495,468,354,240,295,151,178,170,416,146,452,469,150,126,398,276,206,405,504,418,7,245,462,122,274,28,25},
+{1,487,164,236,53,185,393,480,366,69,356,50,371,288,177,485,191,420,284,299,378,447,440,349,386,56,130,338,337,431,468,24,90},
+{1,322,459,458,136,323,137,1,322,459,458,136,323,137,1,322,459,458,68,330,106,465,475,506,188,232,189,73,469,134,49,89,202},
+{1,112,433,195,413,236,290,355,488,237,338,210,299,368,446,496,72,152,344,473,282,37,30,307,283,29,379,343,177,102,474,338,105},
+{1,79,185,265,291,442,293,24,346,508,66,91,334,11,320,56,204,482,93,118,29,480,18,478,165,323,384,335,34,132,91,167,268},
+{1,357,147,321,469,345,142,230,334,209,462,86,132,286,253,65,219,54,271,5,126,73,9,214,508,21,183,510,368,259,173,459,85},
+};
+
+static const uint16_t prescr_table_32_4253[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,3,1,2},
+{1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,2,2,2},
+{1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,5,7,3},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,13,15},
+{1,9,14,3,2,11,5,6,4,15,10,12,8,7,13,1,9,14,3,2,11,5,6,4,15,10,12,8,7,13,12,4,11},
+{1,10,6,2,11,12,4,9,7,8,13,14,15,5,3,1,10,6,2,11,12,4,9,7,8,13,14,15,5,3,15,13,7},
+{1,10,14,3,30,18,5,7,19,15,9,16,17,27,21,22,8,26,31,24,11,4,13,29,12,23,2,20,28,6,30,9,8},
+{1,13,3,23,5,16,15,25,17,2,26,6,7,10,9,30,27,11,4,29,12,14,20,18,21,31,22,8,19,24,14,10,16},
+{1,2,4,8,16,15,30,19,9,18,11,22,3,6,12,24,31,17,13,26,27,25,29,21,5,10,20,7,14,28,28,28,28},
+{1,4,16,25,10,31,18,17,29,26,6,24,14,15,11,27,2,8,23,5,20,9,19,21,13,3,12,7,28,30,11,22,27},
+{1,14,25,4,3,18,16,12,5,13,11,20,15,23,29,7,17,2,28,9,8,6,31,27,24,10,26,22,19,30,23,19,15},
+{1,21,13,29,22,15,10,12,8,27,18,28,3,2,23,26,7,17,30,20,24,16,11,25,5,6,4,19,9,14,17,15,5},
+{1,14,23,15,25,24,22,1,14,23,15,25,24,22,1,14,23,15,25,24,22,1,14,23,15,25,24,22,1,14,42,19,58},
+{1,26,41,61,10,63,62,36,13,48,58,5,59,31,18,34,24,29,38,57,43,9,17,12,42,19,56,49,32,44,3,23,40},
+{1,38,56,15,48,52,2,27,39,30,55,63,4,54,25,60,57,41,8,59,50,47,37,5,16,33,51,9,29,10,16,59,25},
+{1,62,9,20,26,2,39,18,40,52,4,21,36,11,51,8,42,19,22,61,16,15,38,44,33,32,30,23,3,25,32,15,19},
+{1,43,27,62,3,28,45,35,5,36,22,4,15,13,58,12,17,23,47,20,51,57,16,60,52,42,48,37,61,31,40,51,44},
+{1,33,27,36,23,52,10,24,32,58,63,51,35,62,18,56,26,5,12,16,29,44,42,34,31,9,28,13,49,6,4,37,27},
+{1,63,55,22,26,29,23,37,42,1,63,55,22,26,29,23,37,42,1,63,55,22,26,29,23,37,42,1,63,55,11,48,14},
+{1,29,8,14,51,3,39,24,18,38,5,26,40,54,25,15,46,11,41,43,17,1,29,8,14,51,3,39,24,18,19,36,38},
+{1,23,43,29,34,45,26,50,22,60,54,63,15,55,40,36,42,10,9,48,56,31,12,14,32,3,57,8,39,19,1,49,45},
+{1,8,64,12,96,10,80,15,120,73,68,44,102,58,85,39,62,117,33,14,112,9,72,76,108,106,90,95,119,49,71,26,104},
+{1,16,18,50,22,114,94,51,6,96,108,37,116,62,95,35,20,82,122,87,42,13,89,67,120,119,14,105,117,46,98,38,34},
+{1,13,81,48,110,21,102,125,93,108,15,75,29,14,70,76,62,40,89,88,85,4,52,90,79,41,84,9,101,106,87,15,98},
+{1,10,68,125,116,46,14,108,79,51,77,39,84,76,45,16,49,89,62,63,53,113,12,120,86,88,52,123,72,5,17,85,35},
+{1,111,83,87,76,58,92,86,35,105,11,26,25,53,93,57,112,62,71,32,69,99,126,80,123,36,94,21,24,90,7,85,73},
+{1,5,17,85,79,61,110,63,100,29,105,36,19,95,109,48,87,69,31,99,6,30,102,23,75,41,42,37,22,78,28,54,119},
+{1,56,24,71,22,65,45,17,66,101,57,32,95,81,87,108,60,83,39,92,25,127,14,6,59,80,111,116,123,69,51,99,1},
+{1,125,44,114,83,29,121,19,123,80,35,13,60,55,119,17,56,8,126,18,6,124,81,94,33,78,100,106,104,43,101,87,17},
+{1,19,123,57,89,60,6,106,100,41,23,55,20,2,38,73,114,13,120,12,107,119,82,46,110,40,4,76,45,91,13,60,3},
+{1,36,95,69,105,85,110,104,113,49,45,24,100,67,112,21,114,93,13,22,30,125,3,108,32,14,122,62,115,121,41,68,70},
+{1,126,79,67,58,82,106,15,48,114,54,43,2,55,85,77,116,111,31,30,96,47,108,86,4,110,97,81,35,21,31,15,24},
+{1,95,78,53,58,19,22,64,67,113,112,47,97,84,110,125,107,43,104,25,105,70,39,115,29,96,11,32,72,81,28,118,76},
+{1,45,7,22,21,98,107,81,110,29,117,83,52,19,89,121,37,16,46,112,31,47,93,24,57,72,122,82,25,20,77,27,39},
+{1,26,107,72,87,78,11,27,113,35,31,25,69,16,106,82,60,6,92,85,122,56,110,58,90,9,47,66,86,84,48,95,79},
+{1,85,99,114,109,119,93,70,57,65,76,89,35,107,87,38,91,102,66,92,19,90,51,33,46,126,45,110,103,23,104,84,27},
+{1,20,3,60,5,68,15,61,17,71,51,56,85,72,14,41,18,123,54,124,90,117,31,110,33,67,99,52,84,92,126,57,88},
+{1,106,94,27,51,74,92,56,120,124,58,91,55,12,61,84,67,77,83,76,57,18,34,33,104,125,80,5,44,63,64,2,106},
+{1,12,80,52,119,106,11,116,126,6,40,26,69,53,123,58,63,3,20,13,92,100,67,29,97,127,10,120,46,50,81,28,72},
+{1,93,225,237,92,188,12,177,224,176,189,81,80,13,236,1,93,225,237,92,188,12,177,224,176,189,81,80,13,236,141,220,244},
+{1,12,80,231,208,169,191,87,195,125,38,181,47,217,197,85,219,221,245,8,96,186,107,206,33,145,130,86,207,45,238,94,217},
+{1,36,188,17,50,114,42,111,131,220,101,192,232,207,31,225,224,196,120,105,91,41,3,108,239,51,86,150,126,177,87,89,165},
+{1,164,214,3,193,87,5,110,249,15,178,38,17,251,106,51,32,190,85,96,239,255,160,28,44,205,36,116,122,108,78,181,128},
+{1,105,126,94,82,204,182,117,230,107,172,162,238,104,23,32,12,158,122,195,147,141,199,14,76,134,127,55,44,146,114,96,10},
+{1,92,222,126,96,10,38,241,77,129,68,67,232,140,201,214,224,18,187,103,161,66,180,82,183,182,234,52,74,42,16,158,57},
+{1,134,42,97,61,182,209,47,101,191,30,24,219,39,44,162,193,189,95,76,25,93,13,77,159,119,108,112,41,166,135,86,231},
+{1,32,35,67,38,227,137,243,55,125,36,163,207,117,123,228,105,26,161,143,51,253,168,240,87,24,225,201,181,177,183,215,74},
+{1,158,83,7,127,218,21,30,192,107,90,134,114,229,55,61,125,133,179,16,62,188,112,186,145,51,131,82,153,44,223,171,169},
+{1,118,235,148,22,111,188,117,113,204,207,85,13,212,238,95,254,97,242,195,247,8,31,6,81,176,215,116,7,39,159,251,85},
+{1,19,108,107,18,127,7,121,109,120,126,20,21,6,106,1,19,108,107,18,127,7,121,109,120,126,20,21,6,106,180,234,185},
+{1,251,111,64,214,126,54,30,139,95,166,78,208,134,37,239,157,42,18,10,121,53,98,58,159,173,204,138,164,201,7,185,31},
+{1,216,10,66,68,122,70,189,82,57,218,205,86,192,242,178,49,95,157,168,14,187,108,5,33,34,61,35,229,41,232,253,211},
+{1,75,239,181,54,168,163,208,248,24,137,166,204,38,143,103,88,21,59,26,31,3,221,74,164,90,131,158,11,115,20,56,222},
+{1,202,227,210,55,208,36,145,7,255,32,183,133,185,252,249,21,116,224,11,149,33,125,102,107,203,41,49,229,231,122,143,115},
+{1,75,28,99,219,21,237,39,120,194,154,90,86,52,164,173,35,223,178,157,32,2,150,56,198,61,42,81,78,240,194,77,211},
+{1,175,154,103,165,31,173,73,222,107,216,147,158,76,90,14,174,53,253,194,186,178,228,151,181,179,75,13,210,22,42,40,135},
+{1,18,155,163,109,118,111,82,198,139,28,103,194,195,209,74,233,132,242,157,207,9,130,158,249,59,248,41,99,138,7,63,88},
+{1,57,139,28,89,154,243,176,229,240,251,219,212,16,214,98,99,90,209,205,148,14,253,77,168,88,163,120,172,188,53,2,57},
+{1,243,32,175,95,195,12,11,41,201,214,226,80,116,69,154,30,199,146,139,110,28,136,210,124,208,51,144,196,46,161,217,254},
+{1,196,141,248,144,211,123,199,112,222,41,210,191,74,136,78,250,169,120,58,86,103,40,22,50,178,24,157,129,110,4,57,141},
+{1,108,175,214,44,127,47,203,99,12,23,141,102,109,195,121,250,83,80,228,168,111,27,154,235,11,174,186,131,169,223,45,215},
+{1,211,220,247,137,189,70,82,54,158,111,73,121,72,170,148,93,29,224,91,178,109,44,2,101,123,45,209,185,140,82,27,198},
+{1,181,134,89,238,205,87,11,213,215,114,177,3,16,69,235,253,152,249,29,176,182,150,28,5,48,207,242,200,103,98,122,58},
+{1,209,255,111,89,204,193,249,240,34,121,192,40,15,77,32,12,233,246,189,2,117,41,222,178,79,85,37,55,68,121,96,10},
+{1,255,171,134,228,62,123,108,51,78,71,52,212,172,28,15,22,160,214,143,151,222,3,220,32,87,241,66,141,180,196,218,204},
+{1,83,77,116,254,147,10,23,219,134,119,11,68,150,242,137,152,78,129,41,15,239,69,197,191,253,102,221,139,62,106,144,140},
+{1,151,83,39,94,107,63,27,15,145,199,62,140,92,182,153,85,179,71,185,8,146,141,203,229,190,11,216,120,162,250,124,140},
+{1,146,251,219,124,76,66,106,99,95,168,138,252,207,130,82,195,123,88,188,116,226,78,147,105,32,167,48,14,40,254,15,93},
+{1,45,71,93,77,150,240,207,9,188,116,190,46,48,148,170,65,179,38,161,167,73,34,21,66,196,239,70,112,10,153,81,52},
+{1,163,99,359,27,196,395,240,325,291,104,412,421,89,382,409,393,438,387,494,94,20,176,441,503,476,345,141,202,348,337,456,501},
+{1,336,332,337,28,29,333,1,336,332,337,28,29,333,1,336,332,337,28,29,333,1,336,332,337,28,29,333,1,336,166,208,267},
+{1,211,330,151,311,329,482,254,240,172,306,193,430,34,309,239,353,464,137,41,225,317,78,378,326,365,42,404,244,503,26,297,288},
+{1,372,36,151,38,100,110,330,34,386,254,269,186,18,326,19,50,55,165,17,193,127,395,93,9,163,260,25,278,351,399,464,429},
+{1,60,274,102,140,255,350,145,50,122,125,201,468,230,355,447,326,144,14,360,27,69,299,440,498,397,316,237,199,188,366,345,258},
+{1,49,347,221,434,193,451,308,315,36,147,50,264,285,213,58,128,348,74,324,255,391,350,40,479,325,206,220,387,410,143,311,180},
+{1,265,149,207,292,377,504,125,162,142,107,457,95,160,175,321,87,36,97,364,443,275,312,183,205,261,83,102,6,99,447,433,219},
+{1,19,261,263,289,352,293,300,423,422,437,176,439,150,502,211,511,88,510,75,251,332,474,44,255,256,344,166,237,22,173,32,304},
+{1,345,420,59,203,46,503,29,201,197,230,107,351,153,337,81,205,275,157,135,42,33,102,37,432,94,348,299,484,28,200,206,380},
+{1,80,423,197,315,214,117,404,168,462,368,224,264,187,128,50,61,338,355,430,74,102,218,490,275,298,312,38,195,219,221,45,118},
+{1,428,51,21,463,426,273,191,433,450,39,118,86,174,97,164,354,346,480,482,223,185,147,360,89,30,352,103,390,456,146,98,296},
+{1,405,31,50,341,71,470,294,360,245,308,510,315,25,414,279,235,147,180,334,154,255,425,312,207,447,321,381,90,167,274,508,60},
+{1,52,462,54,422,453,458,230,47,285,483,323,438,234,351,489,139,312,310,46,297,45,373,16,303,149,271,164,37,213,385,188,85},
+{1,22,276,110,285,200,373,417,348,432,42,43,61,297,327,90,146,487,70,282,170,128,171,150,447,248,162,48,471,401,382,430,199},
+{1,386,486,239,153,168,489,389,402,423,105,282,204,224,499,419,230,5,269,249,302,128,117,202,278,349,444,461,392,385,432,46,53},
+{1,416,9,309,65,6,206,54,311,390,20,35,180,315,26,120,202,319,275,92,272,59,267,483,456,489,154,435,324,446,188,215,343},
+{1,440,190,78,457,164,470,475,279,286,141,233,66,189,19,11,118,280,55,504,486,289,350,469,390,213,460,67,261,173,360,384,381},
+{1,476,485,265,406,269,333,306,91,193,349,199,167,427,314,493,191,488,440,50,423,87,428,284,356,43,56,304,378,402,235,272,328},
+{1,22,276,131,438,320,381,128,396,223,248,249,239,507,376,206,398,243,115,511,288,472,289,462,53,333,387,13,254,141,185,325,456},
+{1,292,149,267,153,448,394,207,201,510,37,496,3,457,447,440,427,229,59,337,347,167,111,181,5,254,100,109,88,303,372,263,41},
+{1,134,140,238,200,405,436,468,254,187,326,182,25,411,353,365,180,277,131,189,253,305,210,388,321,395,274,446,438,216,243,242,177},
+{1,66,210,304,61,136,11,97,63,12,431,182,69,284,441,116,59,260,80,280,177,395,405,496,199,308,309,375,421,149,84,8,264},
+{1,4,16,64,256,378,146,245,361,222,453,211,497,3,12,48,192,445,307,438,287,262,354,242,373,174,5,20,80,320,61,122,244},
+{1,489,186,62,480,185,202,46,251,37,485,421,87,232,458,183,200,307,399,89,234,215,451,180,60,253,461,182,289,393,447,442,308},
+{1,356,228,352,214,33,244,424,112,169,419,361,470,150,464,189,345,142,380,72,405,26,181,317,221,312,395,157,201,450,54,465,388},
+{1,26,324,348,44,291,364,23,486,498,58,223,474,369,277,267,39,477,311,164,242,227,345,94,193,246,139,511,152,113,230,504,111},
+{1,131,44,476,442,316,362,42,35,338,30,284,445,64,430,212,495,505,279,458,340,481,500,159,54,57,183,275,307,484,199,455,110},
+{1,393,363,443,427,229,413,266,157,219,213,182,123,292,155,31,164,222,115,387,39,296,275,253,116,206,317,251,176,191,470,510,415},
+{1,46,343,183,485,452,297,391,221,396,479,458,189,201,213,252,353,369,144,492,154,192,395,277,365,185,113,138,289,247,433,269,254},
+{1,471,504,437,152,500,296,449,226,430,200,334,475,357,236,398,370,33,109,151,3,362,283,460,424,271,107,336,294,481,172,381,235},
+{1,127,425,405,511,15,400,124,296,123,85,283,385,473,428,22,216,484,441,79,210,503,226,140,128,401,3,129,494,426,138,193,86},
+{1,28,336,295,274,33,131,327,179,24,288,326,175,328,7,84,142,459,320,231,150,235,6,72,478,236,82,198,21,428,469,20,216},
+{1,158,435,353,56,398,298,43,37,471,12,206,414,291,288,130,372,500,444,13,80,45,66,280,268,94,479,409,474,92,480,119,99},
+{1,273,241,433,49,305,478,123,82,371,418,316,199,405,9,14,283,253,441,302,219,146,499,77,118,331,157,505,65,126,42,265,488},
+{1,425,270,89,434,281,312,119,75,424,167,343,491,171,33,335,60,483,271,496,188,320,138,366,371,479,236,255,332,508,229,121,170},
+{1,396,329,404,460,223,9,200,183,16,449,181,65,26,212,144,420,198,256,202,230,459,416,100,511,8,324,510,388,13,53,18,200},
+{1,149,231,47,488,90,388,103,251,496,158,33,160,225,30,245,184,37,443,50,162,459,464,171,39,145,508,252,340,356,118,334,69},
+{1,83,7,441,21,450,107,163,273,50,449,158,170,129,13,220,35,335,233,91,452,385,177,362,76,160,484,59,81,161,374,15,61},
+{1,468,293,469,241,240,292,1,468,293,469,241,240,292,1,468,293,469,241,240,292,1,468,293,469,241,240,292,1,468,290,173,114},
+{1,42,505,23,285,295,277,119,26,207,227,486,90,309,138,411,324,108,255,469,274,161,72,170,358,197,487,112,204,157,67,194,301},
+{1,278,372,443,193,359,138,428,31,109,452,290,92,21,415,143,341,268,480,364,110,403,467,508,342,347,273,204,301,343,400,194,152},
+{1,302,459,185,326,194,367,500,172,100,269,251,376,505,390,130,126,42,311,237,91,280,473,183,109,266,471,412,421,434,358,320,96},
+{1,312,482,361,203,438,25,128,40,439,289,354,321,380,151,379,449,340,288,90,163,21,92,205,472,468,264,493,386,375,305,268,70},
+{1,412,12,11,80,116,69,501,185,354,38,140,424,346,379,428,32,331,384,352,155,148,446,506,403,294,79,57,193,300,259,241,128},
+{1,22,276,493,472,441,497,80,113,296,298,262,161,244,203,54,91,251,25,454,29,414,220,308,162,206,120,398,444,447,261,394,242},
+{1,177,342,80,72,84,301,495,109,207,317,152,451,300,350,315,159,373,204,238,195,307,500,418,493,271,450,413,8,363,443,160,72},
+{1,476,249,5,454,168,17,436,445,85,14,35,257,54,175,474,238,422,472,227,84,466,218,260,496,7,459,346,27,397,428,298,347},
+{1,449,447,221,181,66,41,292,55,93,145,61,138,243,29,131,478,263,452,8,236,165,410,355,425,328,182,440,337,67,244,276,243},
+{1,294,254,231,224,156,417,211,436,423,393,119,50,14,248,445,291,265,38,92,59,138,120,492,333,316,84,409,244,206,177,121,101},
+{1,87,97,303,296,141,426,497,447,471,476,86,54,334,7,421,295,91,78,104,11,394,96,376,329,418,130,380,21,38,468,375,298},
+{1,105,330,468,467,204,416,219,437,28,43,487,443,495,318,220,170,368,336,137,18,472,242,128,254,417,178,255,456,504,371,275,448},
+{1,49,382,113,447,259,130,480,24,333,365,231,94,298,177,252,320,16,197,438,186,295,460,222,168,384,339,134,292,415,430,273,504},
+{1,12,80,25,172,98,321,104,313,401,451,450,462,414,391,299,329,8,96,345,200,267,201,263,153,286,53,380,372,276,458,215,299},
+{1,417,157,395,226,171,252,258,262,68,467,57,82,285,270,291,286,14,132,96,296,377,356,461,400,424,91,475,350,159,149,118,243},
+{1,386,313,46,30,464,111,157,340,94,209,466,130,262,264,98,152,268,440,71,436,448,213,8,93,446,368,240,292,145,413,321,94},
+{1,281,506,456,278,401,31,463,431,122,362,347,341,39,10,283,51,455,381,70,198,497,458,223,414,116,24,374,68,271,255,363,33},
+};
+
+static const uint16_t prescr_table_32_4423[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,9,13,15,14,7,10,5,12,3,4,1,13,14,10,11,6,8,2,9,15,7,5,12,3,4,1,13,14,10,11,6,8},
+{1,12,6,3,13,10,5,14,15,9,4,1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11,8},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,11,15,6,31,7,20,8,9,30,6,29,26,16,18,25,12,31,17,5,1,23,24,27,7,10,2,11,21,19,14,20,4},
+{1,11,23,12,15,18,2,22,23,6,29,8,5,7,12,19,16,10,14,24,15,9,20,28,25,30,18,1,17,27,21,13,2},
+{1,11,27,23,18,26,28,9,17,20,16,6,29,1,18,13,7,15,12,21,2,11,26,14,30,24,5,4,22,27,28,19,31},
+{1,16,10,18,29,6,14,11,1,8,25,20,18,21,26,12,14,30,27,4,23,10,9,17,13,6,7,15,22,2,16,5,31},
+{1,22,27,9,7,20,12,4,23,27,25,15,31,14,20,6,1,11,8,21,13,9,30,5,28,19,12,2,22,16,17,26,18},
+{1,21,13,29,22,15,10,12,4,23,13,16,27,9,7,22,25,28,31,30,10,6,2,21,24,8,19,26,29,11,18,14,17},
+{1,9,2,18,4,36,8,11,8,36,4,18,2,9,1,37,33,51,49,56,57,28,61,14,63,7,62,34,31,17,46,41,23},
+{1,25,44,59,27,30,42,36,20,33,14,6,43,58,1,40,11,28,12,31,61,2,25,22,56,24,62,51,4,50,44,57,48},
+{1,43,62,31,36,18,9,47,30,44,11,23,16,4,1,62,36,9,60,15,22,46,32,8,2,43,31,18,47,30,44,11,23},
+{1,18,51,15,3,54,14,17,47,59,57,43,31,10,1,9,26,39,40,4,36,51,42,22,16,38,33,30,3,27,46,50,35},
+{1,60,41,45,31,24,15,18,57,35,40,56,61,58,1,30,18,57,35,40,56,61,58,1,30,18,57,35,40,56,61,58,1},
+{1,57,9,10,38,61,35,46,7,3,22,31,26,32,1,47,40,43,61,34,56,24,25,54,30,53,8,42,18,10,19,37,59},
+{1,32,12,52,61,30,31,63,47,44,28,25,36,43,1,16,3,48,5,61,15,42,17,19,51,53,56,50,37,59,2,32,6},
+{1,23,63,51,49,31,18,7,11,10,56,43,35,12,1,50,19,8,47,13,51,33,27,39,34,62,18,58,60,5,28,44,40},
+{1,58,29,52,26,13,60,30,61,18,62,53,16,4,1,29,26,60,15,36,9,31,32,8,2,58,52,13,30,61,18,62,53},
+{1,44,72,92,32,29,54,57,12,107,91,114,24,85,53,103,48,41,106,77,96,82,87,25,67,39,45,50,5,78,90,100,10},
+{1,31,71,106,39,2,62,7,106,87,68,97,127,83,122,38,74,60,88,82,49,81,101,65,20,79,73,104,72,35,63,12,66},
+{1,37,105,101,72,23,24,90,95,64,87,91,10,62,46,24,45,104,32,108,106,5,31,23,12,81,52,16,54,53,69,72,76},
+{1,112,95,53,19,126,42,105,91,35,55,49,48,8,115,47,53,65,87,33,71,86,25,60,10,3,72,28,117,46,13,58,11},
+{1,49,78,86,39,43,93,91,48,113,6,83,105,112,80,14,10,104,38,13,109,18,30,37,106,23,42,54,34,111,35,57,126},
+{1,34,114,5,13,83,17,57,123,111,117,38,125,9,62,12,107,49,84,44,112,115,64,54,35,40,52,1,17,79,110,100,105},
+{1,2,4,8,16,32,64,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43},
+{1,47,86,31,106,44,39,92,121,120,51,122,28,81,105,114,25,68,118,71,18,37,1,75,73,102,77,56,27,107,93,50,49},
+{1,63,18,12,122,103,80,123,44,79,25,58,55,74,39,115,111,107,21,7,1,64,91,94,96,41,113,80,98,22,120,83,29},
+{1,91,121,53,50,49,29,87,4,119,121,122,108,30,93,112,24,113,85,95,43,68,76,99,80,101,124,64,59,26,42,9,98},
+{1,9,65,56,110,50,52,2,9,69,14,63,77,42,118,117,29,31,22,83,93,98,47,5,115,6,27,4,18,65,28,126,81},
+{1,69,127,81,60,22,26,106,66,1,75,43,77,55,100,63,5,18,84,12,56,82,16,17,90,113,60,11,111,80,85,71,19},
+{1,27,58,21,109,38,110,11,16,13,61,42,109,19,113,68,2,27,29,48,23,71,126,98,53,70,25,6,45,39,80,57,28},
+{1,32,89,6,37,28,20,59,36,30,42,27,122,109,50,81,102,103,119,88,19,31,58,52,49,97,23,95,99,55,1,16,47},
+{1,4,16,64,49,43,67,61,122,27,54,108,55,110,51,102,35,70,99,41,82,75,121,29,58,116,7,14,28,56,112,15,30},
+{1,84,32,62,76,72,11,122,65,20,46,81,99,95,45,47,123,107,28,109,17,93,121,63,12,26,96,33,53,27,74,41,118},
+{1,55,104,98,90,22,30,72,106,6,89,92,82,32,91,107,102,67,22,15,18,97,122,80,23,111,8,43,39,98,45,126,62},
+{1,30,83,80,114,122,119,28,73,67,37,41,109,101,29,70,22,47,79,97,33,21,62,77,127,118,1,15,85,10,102,12,68},
+{1,252,22,103,15,99,210,59,167,71,211,238,86,12,62,58,217,207,113,52,27,254,247,84,240,53,101,118,85,142,189,199,172},
+{1,109,232,168,234,114,39,63,119,255,20,149,111,25,94,112,240,178,254,172,175,122,52,11,124,131,151,2,109,116,42,90,170},
+{1,119,116,237,113,109,254,73,48,100,38,56,147,206,213,62,10,128,210,9,89,245,159,215,73,48,100,38,56,147,206,213,62},
+{1,123,86,165,179,247,215,49,119,28,152,143,6,141,125,166,31,72,39,85,20,89,35,163,66,157,210,211,120,251,202,189,161},
+{1,10,68,218,203,97,129,215,192,139,213,202,169,127,186,32,160,82,35,175,97,220,231,48,240,123,174,100,205,178,8,40,136},
+{1,138,254,162,156,228,66,136,245,200,59,82,232,92,31,30,91,251,63,121,22,13,56,157,55,47,213,175,118,164,239,184,62},
+{1,165,86,209,240,37,219,235,247,226,13,253,73,138,75,47,96,72,126,248,186,111,16,28,21,239,240,180,195,193,100,79,40},
+{1,103,186,213,182,207,76,79,115,74,33,113,45,124,188,108,101,58,144,140,88,159,122,21,139,109,249,187,89,3,251,220,4},
+{1,110,162,76,143,221,73,58,169,164,148,136,90,145,99,97,15,94,77,193,71,116,49,43,75,115,180,65,198,194,30,188,154},
+{1,98,158,85,248,38,31,239,59,26,48,164,179,155,109,53,81,184,37,238,10,143,22,25,99,126,217,57,120,127,232,172,94},
+{1,25,40,83,141,11,227,81,235,248,145,47,14,79,108,52,3,161,30,135,204,146,142,16,200,160,166,141,177,214,39,106,31},
+{1,59,129,82,217,84,67,193,111,97,192,202,29,150,104,137,197,25,224,233,160,175,171,221,92,117,31,173,144,37,240,64,70},
+{1,197,44,35,251,40,174,75,82,107,136,124,4,253,44,170,99,5,36,39,59,38,226,45,115,104,148,97,192,50,114,177,159},
+{1,155,96,201,61,151,181,191,227,60,6,214,80,8,154,192,201,163,123,103,255,164,93,47,34,5,189,120,12,215,160,16,79},
+{1,159,168,146,175,65,249,177,93,158,216,205,149,62,100,80,94,141,166,154,97,101,220,116,61,119,46,9,121,253,34,69,6},
+{1,43,244,140,156,177,191,150,26,84,223,60,4,86,244,70,39,128,180,28,41,81,89,245,150,26,84,223,60,4,86,244,70},
+{1,21,156,253,177,35,8,168,231,119,177,215,2,21,78,92,225,72,99,51,172,205,235,9,152,146,211,40,137,246,19,113,142},
+{1,80,213,235,115,161,101,156,201,228,241,88,122,104,25,214,194,67,252,15,7,216,237,6,240,112,231,137,96,198,227,41,181},
+{1,4,16,64,163,105,7,28,56,112,224,99,198,47,94,188,219,21,42,84,168,243,69,138,183,205,57,114,228,107,214,15,30},
+{1,215,111,82,223,115,120,180,195,248,186,29,170,1,191,165,96,72,126,138,57,149,68,119,59,66,167,183,171,190,26,197,40},
+{1,133,208,165,44,4,199,34,251,44,2,133,104,69,221,108,254,13,230,245,213,171,239,168,240,244,79,159,21,30,198,139,145},
+{1,3,5,15,17,51,85,255,94,113,151,2,3,220,178,235,64,96,80,120,68,102,85,161,47,230,149,1,223,110,89,171,32},
+{1,46,222,66,141,68,105,197,19,138,71,236,25,28,87,95,231,152,218,125,108,200,224,253,189,52,74,31,110,230,143,12,228},
+{1,102,111,167,46,220,77,130,123,214,240,201,144,179,117,43,145,128,29,6,170,191,238,154,130,123,214,240,201,144,179,117,43},
+{1,10,68,209,118,242,255,141,192,110,1,5,17,85,214,32,160,89,234,236,242,148,189,48,240,158,159,154,139,222,8,40,136},
+{1,227,38,64,218,28,130,114,58,97,42,13,178,141,104,131,166,250,214,35,164,25,197,51,200,129,69,233,198,79,60,153,31},
+{1,175,146,226,118,184,108,177,7,178,12,44,81,147,213,57,129,183,17,105,182,181,190,32,125,194,70,236,184,54,166,120,223},
+{1,132,165,9,142,84,65,212,137,23,55,35,210,246,25,77,148,161,6,127,14,122,183,115,240,102,67,238,22,117,143,104,57},
+{1,194,246,178,45,213,197,167,205,75,133,109,84,132,12,147,239,235,154,108,53,67,103,116,230,104,68,181,62,2,194,123,214},
+{1,187,51,134,234,167,141,233,181,54,109,123,120,98,9,70,232,20,184,255,182,44,6,52,214,158,165,1,161,142,146,205,84},
+{1,28,336,215,152,297,365,24,144,485,377,212,94,311,259,27,130,281,151,463,213,80,355,88,275,251,452,183,15,90,271,83,369},
+{1,38,54,71,310,356,157,102,249,236,387,104,11,173,370,28,484,130,482,232,463,94,288,488,86,440,388,17,291,477,328,483,251},
+{1,325,354,12,345,253,80,457,25,240,38,286,136,53,401,204,292,82,170,438,123,255,365,333,395,208,224,69,184,144,364,228,216},
+{1,371,49,295,311,242,505,330,369,102,474,423,175,316,324,261,288,428,402,460,454,335,56,464,302,472,212,442,499,44,194,475,19},
+{1,65,265,266,457,243,460,438,321,293,337,268,311,313,254,80,141,510,225,142,143,447,373,476,242,470,439,113,495,504,34,19,344},
+{1,171,485,297,326,462,388,372,359,397,376,176,399,467,340,334,102,390,17,65,273,265,138,142,472,61,447,248,348,463,385,175,178},
+{1,482,283,262,401,188,192,294,240,59,102,325,179,345,272,77,170,508,469,472,259,215,510,55,76,91,310,377,49,89,212,237,361},
+{1,396,300,144,502,206,332,4,339,300,72,344,139,134,510,138,64,437,152,22,261,412,332,2,396,150,36,172,352,67,255,69,32},
+{1,410,301,343,151,208,496,184,132,57,285,212,405,259,422,263,203,42,332,437,342,426,233,485,250,436,411,375,306,56,464,9,78},
+{1,289,492,221,473,254,309,318,59,56,166,43,76,503,401,405,392,100,293,235,99,422,394,325,467,356,132,482,71,339,155,303,496},
+{1,125,214,334,423,499,78,437,59,119,482,166,206,222,339,110,151,304,251,474,416,64,155,62,385,51,387,78,488,303,265,241,83},
+{1,61,387,389,267,211,287,414,442,121,148,461,94,64,283,181,350,254,422,287,207,221,264,74,466,47,32,441,366,175,127,211,443},
+{1,193,404,220,501,384,197,255,297,269,509,427,218,142,318,416,39,358,249,106,83,420,421,242,151,443,99,111,134,85,231,251,171},
+{1,352,300,351,179,321,151,244,39,49,333,169,318,95,121,248,510,306,390,378,51,45,63,500,316,319,239,50,157,116,401,182,412},
+{1,351,497,249,396,241,253,10,217,89,88,457,298,68,509,7,13,212,141,213,284,54,114,399,392,389,337,476,265,21,35,81,478},
+{1,282,405,175,22,323,141,393,138,163,478,201,24,301,112,497,29,275,98,160,73,199,215,156,321,31,9,491,42,234,281,30,132},
+{1,383,158,458,227,390,274,287,141,451,24,378,465,203,472,488,393,190,296,13,328,207,435,374,364,361,247,260,381,304,375,153,4},
+{1,86,238,56,223,152,114,274,118,37,213,322,251,178,357,120,391,400,360,423,450,435,327,124,299,382,372,122,465,487,358,5,135},
+{1,63,19,274,261,235,418,71,266,215,248,88,257,346,298,388,96,342,424,433,507,317,371,459,406,423,66,58,104,426,398,163,40},
+{1,6,20,120,272,399,104,368,309,506,171,509,162,486,143,401,22,58,78,210,374,319,484,137,411,8,24,40,120,136,408,13,23},
+{1,437,24,303,320,274,452,389,291,64,315,384,363,94,139,452,405,454,32,458,192,482,47,274,226,413,227,16,229,96,241,320,137},
+{1,485,35,71,363,66,195,237,204,81,492,174,95,313,385,476,256,459,171,139,447,167,443,474,408,162,367,348,190,197,437,271,183},
+{1,453,287,122,60,475,172,44,21,301,431,105,449,230,95,356,415,62,118,506,27,268,482,366,137,364,332,189,12,484,412,71,17},
+{1,150,46,435,458,324,215,59,503,239,80,8,151,92,435,229,81,67,507,340,34,5,359,322,182,132,431,112,155,487,449,232,417},
+{1,147,410,295,374,261,282,429,240,144,383,86,453,386,92,459,170,238,130,214,384,207,262,319,284,11,303,38,272,432,336,250,158},
+{1,334,104,397,67,94,97,479,216,259,412,247,192,145,236,187,463,452,163,93,180,239,338,481,160,436,154,395,69,294,415,286,238},
+{1,124,13,153,81,298,360,25,219,144,156,404,387,44,471,127,318,345,130,501,220,42,339,270,147,222,86,47,405,445,146,224,232},
+{1,175,82,488,455,40,91,461,254,345,136,487,256,445,433,170,92,320,364,355,508,75,272,311,249,387,411,340,184,121,33,63,257},
+{1,54,23,227,277,157,310,5,119,338,333,100,207,479,102,249,84,286,315,301,199,263,72,26,350,505,93,477,80,370,300,220,66},
+{1,90,165,389,134,65,285,77,219,177,60,138,117,229,97,402,323,192,109,78,172,14,390,52,482,319,352,34,207,454,286,472,347},
+{1,453,339,76,353,399,403,3,173,56,400,294,484,396,494,375,382,296,384,79,407,276,143,58,85,5,503,72,421,127,313,385,295},
+{1,348,322,338,22,178,278,118,138,316,114,301,126,219,167,288,294,477,62,332,3,498,382,185,296,375,70,364,327,416,279,149,410},
+{1,314,158,34,435,302,353,368,28,227,249,119,95,416,265,419,174,90,106,33,239,35,469,108,76,62,427,291,358,72,361,309,306},
+{1,313,482,19,196,221,261,456,417,208,234,133,398,167,9,179,277,187,162,78,177,44,74,498,462,475,451,43,308,257,423,170,505},
+{1,462,47,362,280,244,150,271,83,100,56,156,410,96,159,179,303,38,284,221,407,366,43,18,105,310,40,315,294,399,391,201,151},
+{1,418,198,446,128,9,406,100,181,288,97,105,115,511,65,1,209,405,321,8,26,396,446,64,208,324,212,329,18,406,50,510,144},
+{1,335,201,368,109,301,77,219,45,199,203,503,172,356,410,413,3,79,133,114,408,210,448,19,405,238,477,501,483,167,454,141,159},
+{1,21,273,170,35,452,76,81,244,132,135,309,303,454,51,74,442,78,400,351,453,385,80,339,443,489,175,49,95,159,457,511,56},
+{1,151,45,382,498,42,506,305,73,265,312,143,384,257,5,213,254,504,447,50,219,122,41,401,481,98,15,383,258,361,416,86,365},
+{1,295,227,411,274,197,134,477,402,142,122,271,476,180,108,36,28,301,450,190,106,38,315,233,382,499,392,417,159,117,266,479,181},
+{1,283,293,201,454,142,95,244,53,269,447,459,508,490,369,83,250,430,43,77,442,427,75,506,426,368,360,104,108,311,18,448,7},
+{1,100,311,412,138,62,225,102,326,325,275,160,333,131,445,209,198,11,454,174,113,395,136,123,127,183,384,334,213,14,316,264,309},
+{1,220,317,54,499,143,149,271,229,354,376,437,228,268,87,364,19,172,379,263,234,103,334,243,24,17,112,90,181,260,88,105,37},
+{1,452,245,3,457,287,5,478,82,288,173,317,108,175,249,468,396,370,397,400,337,195,86,301,88,254,255,29,193,402,149,379,373},
+{1,165,178,187,423,20,486,202,63,37,34,88,344,430,132,305,39,135,1,405,491,417,485,341,106,185,433,92,18,284,286,443,482},
+{1,213,392,497,389,59,10,64,234,363,268,342,118,10,32,117,357,134,171,59,5,16,490,354,67,389,461,466,8,245,177,497,274},
+{1,278,229,145,150,158,400,466,280,416,78,239,3,413,380,375,109,219,317,283,61,306,408,110,326,65,108,80,489,165,373,379,371},
+{1,9,65,496,148,255,117,100,418,299,302,228,91,157,95,143,30,119,59,301,309,345,223,374,424,262,80,360,479,317,381,93,134},
+{1,424,115,47,104,122,28,68,373,205,140,442,489,236,169,264,296,473,390,314,490,400,414,399,192,481,450,79,295,284,36,102,44},
+{1,367,222,55,429,275,328,353,500,498,392,313,56,506,105,133,15,201,223,172,174,449,430,337,495,39,314,5,71,268,100,291,191},
+{1,364,400,86,236,448,72,27,62,411,22,122,130,372,300,196,257,134,97,188,239,314,190,387,498,333,120,494,444,223,319,285,119},
+{1,55,362,166,175,288,49,472,56,449,173,167,76,504,157,442,480,505,364,10,235,436,357,295,90,25,149,358,225,351,209,66,381},
+{1,394,293,204,25,189,254,355,332,142,7,386,228,416,180,288,110,362,19,418,318,94,93,274,211,277,337,497,241,325,465,299,187},
+{1,434,408,218,505,294,99,379,341,371,91,416,129,173,313,221,225,138,200,320,210,3,363,170,213,495,89,18,77,362,115,179,253},
+{1,308,79,156,185,492,265,137,357,21,205,110,145,88,439,361,383,28,188,493,490,453,324,202,65,16,470,316,312,185,246,184,108},
+{1,81,309,45,423,352,92,339,452,488,275,5,375,123,367,76,39,59,174,211,335,337,405,143,27,435,353,507,484,245,161,177,450},
+};
+
+static const uint16_t prescr_table_32_9689[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,2,1,3,1,2,3,1,2,3,1},
+{1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,6,6,6,6,6,6,6},
+{1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,7,4,1,3,5,2,6,5,1,7,2,3,4,6},
+{1,10,8,15,12,1,10,8,15,12,1,10,8,15,12,1,10,8,15,12,1,10,8,15,12,1,5,2,10,4,7,8,14},
+{1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,11,1,10,9,6,7,2,10,9,6},
+{1,10,6,2,11,12,4,9,7,8,13,14,15,5,3,1,10,6,2,11,12,4,9,7,8,13,7,4,11,6,1,5,14},
+{1,21,28,16,23,19,13,18,24,14,8,25,27,20,9,12,7,4,30,31,10,22,6,17,2,15,28,8,30,29,16,25,31},
+{1,10,22,17,14,23,27,24,6,21,15,29,13,9,8,2,20,5,11,28,7,31,25,12,3,30,29,18,8,1,5,17,7},
+{1,2,4,8,16,15,30,19,9,18,11,22,3,6,12,24,31,17,13,26,27,25,29,21,5,10,10,10,10,10,10,10,10},
+{1,16,10,18,29,6,14,11,2,23,20,19,13,12,28,22,4,25,31,17,26,24,15,27,8,5,31,19,29,3,24,28,11},
+{1,24,2,11,4,22,8,23,16,21,27,17,13,25,26,9,15,18,30,31,7,5,14,10,28,20,28,10,14,5,7,31,30},
+{1,31,14,9,19,4,6,5,25,11,16,24,20,30,17,7,26,23,2,3,28,18,27,8,12,10,25,27,4,3,14,26,21},
+{1,9,2,18,4,36,8,11,16,22,32,44,3,27,6,54,12,47,24,29,48,58,35,55,5,45,5,55,35,58,48,29,24},
+{1,27,40,15,11,46,28,32,12,38,31,13,61,55,2,54,25,30,22,21,56,9,24,5,62,26,61,63,36,48,5,31,34},
+{1,6,20,47,27,13,46,29,25,1,6,20,47,27,13,46,29,25,1,6,20,47,27,13,46,29,39,62,21,63,22,58,25},
+{1,25,45,33,59,61,48,51,24,52,12,26,6,13,3,43,44,56,22,28,11,14,40,7,20,46,5,19,29,9,30,49,21},
+{1,34,59,33,60,13,62,40,41,11,48,17,45,32,30,54,31,20,36,53,24,56,38,16,15,27,47,50,26,62,20,18,21},
+{1,9,38,35,14,25,31,41,51,55,19,34,7,63,60,39,42,40,58,17,48,44,30,32,21,20,61,23,3,62,41,42,20},
+{1,7,21,6,18,19,20,1,7,21,6,18,19,20,1,7,21,6,18,19,20,1,7,21,6,18,63,5,59,11,46,8,28},
+{1,25,24,1,25,24,1,25,24,1,25,24,1,25,24,1,25,24,1,25,24,1,25,24,1,25,12,37,40,56,22,5,7},
+{1,25,10,16,49,63,62,39,45,61,12,51,13,42,7,58,54,5,8,34,37,31,41,44,36,6,43,15,12,35,30,24,51},
+{1,4,16,64,6,24,96,5,20,80,70,30,120,101,17,68,22,88,102,29,116,85,82,78,62,123,117,105,81,33,66,7,14},
+{1,63,15,87,85,43,53,18,49,103,13,41,75,12,22,68,91,67,111,110,81,94,9,92,119,66,40,58,102,25,77,71,13},
+{1,2,4,8,16,32,64,15,30,60,120,127,113,109,85,37,74,27,54,108,87,33,66,11,22,44,44,44,44,44,44,44,44},
+{1,53,42,29,93,20,115,76,23,44,50,48,90,14,52,31,55,64,73,103,63,91,59,30,2,106,42,70,51,74,28,52,71},
+{1,37,100,76,22,103,35,39,46,25,19,75,112,97,96,69,33,109,123,28,63,24,54,47,60,119,77,87,105,57,99,21,4},
+{1,108,23,96,91,35,71,69,58,20,115,98,36,13,32,84,124,61,94,22,12,76,67,28,102,125,123,104,39,15,124,77,68},
+{1,52,72,25,120,42,23,54,32,34,74,113,67,24,76,98,14,78,10,53,124,81,97,82,61,33,11,85,13,9,97,41,112},
+{1,21,99,74,10,59,72,32,68,101,52,50,76,116,3,63,28,103,30,77,97,96,117,22,92,86,106,39,75,83,22,46,73},
+{1,27,59,102,2,54,118,115,4,108,83,89,8,103,25,13,16,113,50,26,32,93,100,52,64,5,100,26,16,103,83,115,2},
+{1,81,61,124,93,52,35,10,109,16,28,21,74,29,68,119,97,25,67,66,19,46,82,15,59,24,9,79,69,19,23,116,73},
+{1,104,6,45,20,37,120,21,77,126,56,89,91,64,76,22,62,116,79,101,52,3,115,10,119,60,82,34,123,51,35,79,87},
+{1,20,101,41,13,55,51,99,81,38,18,29,2,40,25,82,26,110,102,21,113,76,36,58,4,80,25,41,111,57,28,11,78},
+{1,7,21,107,110,117,52,89,37,46,31,93,57,122,25,79,71,127,2,14,42,3,9,63,104,103,37,23,88,17,81,100,75},
+{1,67,78,104,31,44,82,100,122,21,9,5,96,89,2,99,121,53,62,88,65,45,17,42,18,10,96,94,114,91,66,116,123},
+{1,7,21,107,32,15,45,44,43,62,85,117,122,87,123,80,110,59,78,52,99,24,72,38,29,83,68,1,116,73,103,2,7},
+{1,124,44,87,28,126,37,15,67,70,40,69,93,49,85,21,38,122,55,78,12,54,50,32,97,46,47,17,26,74,15,89,105},
+{1,68,110,75,78,3,59,69,42,37,5,77,56,126,111,15,32,72,117,70,17,96,47,104,61,51,80,90,23,11,111,124,8},
+{1,57,90,78,51,26,36,44,30,61,67,33,12,43,76,65,83,69,74,42,117,27,29,118,80,14,82,62,4,114,90,39,77},
+{1,35,105,52,134,250,103,253,142,249,2,70,210,104,23,239,206,225,7,233,4,140,191,208,46,197,206,253,71,245,203,39,255},
+{1,236,250,206,243,17,138,225,178,120,28,194,87,93,171,193,126,78,228,201,77,205,218,2,197,233,206,247,67,86,214,83,101},
+{1,22,63,15,210,110,85,2,44,126,30,143,220,170,4,88,252,60,53,147,127,8,176,211,120,106,147,170,2,22,138,73,197},
+{1,94,243,31,100,110,120,232,46,177,106,45,83,82,12,255,224,132,234,146,122,84,229,143,162,241,199,246,10,11,36,197,168},
+{1,105,126,94,82,204,182,117,230,107,172,162,238,104,23,32,12,158,122,195,147,141,199,14,76,134,163,223,153,46,32,6,187},
+{1,92,222,126,96,10,38,241,77,129,68,67,232,140,201,214,224,18,187,103,161,66,180,82,183,182,117,13,217,245,1,46,168},
+{1,164,87,35,241,113,124,198,162,88,156,59,205,23,131,172,67,1,164,87,35,241,113,124,198,162,44,39,219,24,30,191,101},
+{1,107,234,182,101,118,230,252,190,220,228,42,53,239,46,198,166,72,13,33,49,28,103,160,109,207,58,12,37,97,237,124,235},
+{1,150,19,103,102,240,227,132,226,18,241,117,151,133,116,1,150,19,103,102,240,227,132,226,18,241,139,125,100,238,216,224,159},
+{1,36,225,22,82,32,113,61,10,13,241,156,254,37,197,247,68,114,81,76,55,7,252,109,98,219,112,190,209,196,219,112,190},
+{1,80,230,110,184,83,22,45,10,242,227,23,125,236,156,91,68,107,193,150,169,167,124,188,122,53,126,14,217,48,246,101,13},
+{1,236,11,3,69,29,5,207,39,15,32,105,17,96,187,51,160,188,85,145,181,255,194,174,112,55,249,36,37,83,181,199,136},
+{1,216,10,66,68,122,70,189,82,57,218,205,86,192,242,178,49,95,157,168,14,187,108,5,33,34,165,85,212,59,181,208,252},
+{1,75,239,181,54,168,163,208,248,24,137,166,204,38,143,103,88,21,59,26,31,3,221,74,164,90,252,154,46,173,226,190,159},
+{1,33,148,64,237,47,221,3,99,59,192,176,113,224,5,165,77,199,87,147,167,15,104,215,206,249,25,216,83,200,220,17,92},
+{1,75,28,99,219,21,237,39,120,194,154,90,86,52,164,173,35,223,178,157,32,2,150,56,198,61,21,179,107,15,154,45,208},
+{1,43,230,157,192,41,176,220,119,36,226,49,66,202,170,120,32,78,179,161,208,14,47,74,31,35,223,5,133,25,170,60,8},
+{1,252,239,114,117,32,12,205,25,249,221,31,80,30,172,241,222,132,254,136,51,145,202,76,213,28,170,44,175,53,28,170,44},
+{1,57,139,28,89,154,243,176,229,240,251,219,212,16,214,98,99,90,209,205,148,14,253,77,168,88,128,30,196,99,45,141,69},
+{1,244,53,202,231,115,151,81,153,63,38,140,186,197,125,249,238,42,163,111,75,134,86,174,180,171,97,198,100,253,54,235,46},
+{1,90,169,101,151,1,90,169,101,151,1,90,169,101,151,1,90,169,101,151,1,90,169,101,151,1,45,70,226,72,213,142,47},
+{1,108,175,214,44,127,47,203,99,12,23,141,102,109,195,121,250,83,80,228,168,111,27,154,235,11,87,240,150,126,255,25,33},
+{1,45,219,122,156,168,96,248,228,110,189,108,231,25,19,226,128,34,179,41,111,144,183,157,133,187,65,30,104,200,76,7,128},
+{1,32,162,59,92,149,40,109,70,75,36,34,226,176,42,45,205,61,156,199,178,106,166,187,133,121,172,26,111,3,48,158,164},
+{1,209,255,111,89,204,193,249,240,34,121,192,40,15,77,32,12,233,246,189,2,117,41,222,178,79,193,151,60,154,32,6,164},
+{1,255,171,134,228,62,123,108,51,78,71,52,212,172,28,15,22,160,214,143,151,222,3,220,32,87,150,254,42,124,123,54,149},
+{1,183,53,108,164,17,173,171,215,105,230,240,150,182,130,89,200,181,188,6,124,190,143,22,102,32,26,79,87,175,17,165,83},
+{1,62,141,245,228,220,213,232,39,182,190,189,255,155,119,168,63,179,120,17,56,9,61,207,145,8,248,233,245,114,55,88,247},
+{1,130,14,200,84,206,178,234,29,231,166,161,197,239,136,209,164,80,217,138,32,184,53,113,227,177,182,132,116,59,166,170,76},
+{1,45,71,93,77,150,240,207,9,188,116,190,46,48,148,170,65,179,38,161,167,73,34,21,66,196,139,237,14,195,22,230,125},
+{1,44,86,292,268,490,406,12,464,491,442,90,244,231,80,460,248,311,443,118,162,451,348,38,366,315,308,486,35,249,396,506,427},
+{1,407,480,305,95,358,487,502,477,194,122,503,74,290,331,424,300,197,189,117,494,191,330,63,204,500,113,456,67,317,119,352,339},
+{1,124,454,53,400,281,319,466,60,27,138,162,176,433,128,429,382,115,325,284,179,309,221,498,473,335,258,465,92,282,470,230,325},
+{1,311,249,270,212,122,398,278,179,78,426,129,245,48,206,104,72,309,140,252,211,466,378,17,132,296,155,382,368,216,162,101,301},
+{1,2,4,8,16,32,64,128,256,33,66,132,264,49,98,196,392,305,67,134,268,57,114,228,456,433,433,433,433,433,433,433,433},
+{1,500,71,23,381,511,277,203,508,292,2,453,142,46,215,467,7,406,469,101,4,423,284,92,430,395,7,203,254,73,139,296,99},
+{1,398,181,6,322,397,20,473,328,120,176,485,272,403,56,53,268,144,190,125,339,439,270,447,468,113,242,318,168,348,457,126,249},
+{1,268,352,43,437,16,211,206,251,36,256,138,346,65,11,19,396,293,134,176,304,511,8,332,103,344,9,32,211,103,172,289,16},
+{1,282,304,210,454,501,392,128,236,463,347,92,41,149,29,325,110,334,173,163,416,271,449,88,243,231,134,257,97,391,352,486,231},
+{1,410,212,153,372,185,386,445,90,494,316,71,404,36,127,11,483,317,477,320,189,267,178,97,128,391,87,472,262,374,233,293,90},
+{1,436,371,49,469,5,459,117,245,46,17,72,417,324,150,85,360,394,158,171,257,2,269,131,98,463,5,471,132,82,215,95,383},
+{1,172,212,254,103,440,241,248,486,297,156,426,164,358,229,300,233,71,459,157,262,112,408,130,148,24,363,145,258,352,178,245,292},
+{1,245,90,474,83,54,182,49,18,439,458,14,328,355,479,285,260,181,302,252,438,319,84,146,304,489,482,481,89,341,387,75,185},
+{1,325,467,390,354,260,444,504,296,336,29,77,22,118,457,393,163,270,194,500,337,344,414,400,276,205,289,203,153,202,256,35,429},
+{1,220,22,123,276,45,42,67,33,320,171,104,190,375,400,471,251,483,164,102,108,435,303,124,381,79,411,106,131,503,397,361,198},
+{1,409,70,172,290,152,136,181,475,263,150,397,406,218,457,143,372,9,196,241,194,169,342,454,19,17,210,74,14,449,233,209,92},
+{1,160,157,254,230,152,75,154,267,416,247,108,455,250,243,121,294,407,510,140,10,362,248,435,323,218,359,377,166,228,236,249,451},
+{1,221,232,505,203,160,198,211,508,507,369,368,429,325,188,119,215,17,194,318,197,436,196,361,44,144,319,12,87,312,73,241,60},
+{1,121,89,179,287,196,315,458,499,126,310,316,165,124,452,398,451,225,76,347,244,420,176,404,47,238,36,135,50,359,114,397,164},
+{1,262,475,404,352,44,343,215,231,225,282,138,184,23,255,226,181,66,161,274,139,446,460,363,386,153,472,335,106,82,259,405,51},
+{1,298,469,294,352,201,389,427,439,299,255,243,70,425,332,46,28,156,468,12,181,495,229,354,50,128,164,118,233,444,395,421,427},
+{1,205,360,162,413,179,133,84,219,164,388,26,510,116,454,269,124,119,145,2,410,103,324,397,358,266,84,310,41,363,417,383,394},
+{1,294,7,53,21,139,107,268,273,227,176,20,429,108,313,260,104,219,280,188,143,393,272,453,183,33,220,456,133,350,279,248,374},
+{1,373,208,165,275,286,181,59,115,473,34,186,437,349,219,353,434,71,36,213,410,76,480,116,195,221,135,435,153,61,14,282,280},
+{1,191,104,307,25,81,10,292,321,186,250,251,68,44,287,262,343,349,121,312,386,376,387,455,491,244,249,157,63,53,167,67,224},
+{1,100,19,385,261,74,49,456,408,439,497,427,183,79,453,407,368,272,147,350,306,218,451,207,282,416,240,341,351,171,489,467,241},
+{1,403,392,317,205,36,31,486,207,503,506,361,341,447,452,80,203,164,197,119,148,303,440,215,258,103,25,179,184,459,136,318,316},
+{1,106,373,502,255,171,271,296,401,481,66,371,138,202,365,500,43,184,26,214,199,262,235,168,433,78,185,56,426,121,48,2,106},
+{1,295,233,237,370,471,354,425,247,124,218,7,503,414,386,92,38,44,348,452,372,263,21,198,473,397,202,444,408,169,266,73,112},
+{1,212,339,84,74,43,241,207,421,420,368,35,119,61,22,231,40,397,41,345,378,269,304,294,449,489,50,350,427,493,410,13,385},
+{1,226,478,310,22,56,396,296,276,5,127,140,209,78,216,406,183,123,17,387,425,128,374,173,484,382,321,208,86,459,20,254,140},
+{1,193,270,337,483,170,275,465,412,192,463,95,178,329,441,194,77,348,271,400,237,507,240,379,143,273,422,224,260,509,315,272,73},
+{1,119,129,46,230,409,305,188,359,261,281,360,219,208,210,60,318,354,174,191,510,134,363,66,339,160,139,444,379,186,443,72,147},
+{1,392,460,253,451,402,97,474,406,35,136,339,333,162,215,71,152,91,342,135,60,239,234,288,446,390,269,368,378,176,255,241,282},
+{1,266,418,351,331,247,202,63,474,410,453,498,473,447,24,296,319,166,326,361,106,307,50,68,314,201,13,207,40,444,387,366,149},
+{1,223,449,144,230,8,106,101,347,418,64,25,97,366,52,329,200,65,198,416,510,210,321,162,36,413,1,459,162,18,181,210,260},
+{1,4,16,64,256,465,474,502,326,201,107,428,46,184,431,34,136,367,109,436,78,312,305,277,389,138,276,359,385,77,154,308,295},
+{1,436,58,268,169,191,370,277,73,430,349,83,201,2,51,116,323,338,382,447,369,146,7,481,166,402,2,436,29,67,261,325,302},
+{1,272,67,202,75,109,306,255,11,246,444,460,484,190,384,59,69,104,449,432,136,401,101,405,390,153,343,181,187,265,93,368,290},
+{1,410,135,79,157,255,119,63,473,472,66,197,138,23,232,159,160,377,161,227,38,172,187,83,204,108,319,109,498,150,35,196,136},
+{1,472,318,357,131,149,448,277,29,73,265,396,126,480,369,267,337,367,71,119,33,444,40,125,229,350,338,53,26,123,193,64,100},
+{1,260,26,496,324,161,406,229,168,235,47,103,165,19,141,398,110,472,217,66,448,82,306,498,63,149,315,510,344,366,410,309,4},
+{1,214,377,398,281,441,480,235,98,411,372,305,207,381,425,380,383,5,241,284,328,252,419,158,56,490,315,297,433,215,360,226,125},
+{1,168,289,302,60,199,105,317,479,13,66,316,375,300,364,256,432,325,81,223,445,263,365,424,145,107,500,6,504,115,286,458,271},
+{1,488,480,156,416,465,354,470,107,231,48,22,406,294,37,55,287,167,381,212,401,47,276,108,494,257,481,186,16,380,158,312,416},
+{1,486,287,409,36,328,132,464,243,351,284,18,164,66,232,425,383,142,9,82,33,116,260,367,71,468,452,112,239,124,88,252,221},
+{1,328,376,194,167,209,92,207,91,349,345,166,409,292,13,252,396,261,105,450,121,340,90,21,33,100,159,144,422,377,197,320,323},
+{1,365,201,19,313,150,261,78,332,115,249,243,215,127,193,340,3,14,347,53,242,442,182,210,109,149,345,171,88,495,194,173,86},
+{1,260,179,213,405,166,236,72,363,69,132,44,484,16,356,101,395,230,309,476,201,26,25,210,263,120,128,473,202,395,115,351,472},
+{1,98,301,243,430,258,417,247,38,491,422,473,115,249,433,321,73,503,323,141,102,165,26,425,44,500,279,283,87,235,388,221,79},
+{1,292,140,91,375,117,25,123,213,169,26,218,321,68,78,69,362,201,305,446,324,423,319,370,406,360,166,249,33,67,20,11,369},
+{1,373,506,86,501,308,232,499,416,139,7,481,409,418,436,38,333,422,31,100,21,472,176,17,115,242,334,246,113,268,90,388,406},
+{1,263,118,223,211,74,507,20,427,266,488,280,483,294,272,269,335,90,39,198,230,135,291,96,163,309,14,167,161,113,60,146,299},
+{1,223,114,326,437,187,394,313,397,199,211,467,253,273,110,376,232,206,306,466,34,355,296,205,83,324,500,239,152,27,224,248,345},
+{1,69,253,304,479,14,95,477,132,421,84,211,441,234,128,177,73,40,279,210,508,23,432,366,71,119,101,481,118,435,292,80,279},
+{1,227,236,336,185,158,399,339,412,426,388,152,62,192,394,455,315,439,34,389,123,210,400,307,345,180,114,402,391,291,447,102,186},
+};
+
+static const uint16_t prescr_table_32_9941[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,7,6,3,4,2,1,5,7,6,3},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,5,6,4,3,2,7,1,5,6,4,3},
+{1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,6,11,10,14,13,1,4,3,12,5,7},
+{1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11,8,1,3,5,15,8,1,3,5,15,8,1},
+{1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,15,14,13,8,12,10,15,7,11,1,14,9,2,3,13},
+{1,3,5,15,17,22,31,4,12,20,25,14,18,19,16,21,26,11,29,2,6,10,15,26,23,14,9,31,2,3,16,24,20},
+{1,3,5,15,17,26,7,9,27,4,12,20,21,22,19,28,13,23,16,25,2,6,5,19,14,9,25,1,21,11,26,23,8},
+{1,3,5,15,17,28,11,29,8,24,7,9,27,2,6,10,30,13,23,22,21,16,24,20,30,17,14,9,26,23,11,25,2},
+{1,3,5,15,17,4,12,20,11,29,16,7,9,27,26,25,28,19,2,6,10,30,17,2,3,25,14,9,22,29,8,12,10},
+{1,3,5,15,17,8,24,19,14,18,13,23,2,6,10,30,25,16,11,29,28,31,13,22,29,14,9,16,24,20,30,17,4},
+{1,3,5,15,17,14,18,11,29,26,19,8,24,21,2,6,10,30,31,28,25,22,29,13,21,1,31,14,9,19,4,6,5},
+{1,5,17,22,13,57,24,59,18,25,62,3,15,51,58,23,8,40,14,54,43,1,35,53,18,45,46,8,20,34,22,39,63},
+{1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,16,4,1,18,32,8,2,36,9,16,4},
+{1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,47,46,1,60,32,31,44,4,9,46,43,30,16,36},
+{1,37,32,39,49,60,36,5,7,22,13,24,33,2,17,27,21,57,35,19,10,14,22,43,6,52,48,33,1,63,8,34,27},
+{1,29,23,7,50,4,21,61,28,10,16,53,54,17,40,33,22,26,37,3,39,57,52,37,49,33,11,54,56,10,8,21,46},
+{1,9,38,35,14,25,31,41,51,55,19,34,7,63,60,39,42,40,58,17,48,44,15,8,36,43,35,7,44,15,8,36,43},
+{1,18,7,19,21,20,6,1,18,7,19,21,20,6,1,18,7,19,21,20,6,1,9,44,34,49,13,8,37,14,19,60,5},
+{1,29,8,14,51,3,39,24,18,38,5,26,40,54,25,15,46,11,41,43,17,1,55,2,29,4,58,8,7,16,14,32,28},
+{1,36,2,61,4,15,8,30,16,60,32,13,53,26,31,52,62,29,9,58,18,1,18,58,9,29,62,52,31,26,53,13,32},
+{1,31,83,5,99,25,17,106,125,85,71,12,7,93,60,27,47,79,119,16,117,46,40,9,50,17,53,126,58,109,16,123,74},
+{1,4,16,64,18,72,50,65,22,88,114,83,94,106,51,69,6,24,96,27,108,43,86,37,74,29,58,116,97,75,31,62,124},
+{1,119,2,97,4,77,8,21,16,42,32,84,64,39,15,78,30,19,60,38,120,76,120,38,60,19,30,78,15,39,64,84,32},
+{1,105,60,76,107,127,52,98,56,91,10,109,43,45,121,96,123,35,3,42,68,69,22,4,67,60,38,118,113,39,10,126,102},
+{1,50,75,126,54,30,104,105,91,16,110,88,70,46,71,28,12,98,58,124,82,21,74,38,56,12,49,64,65,88,35,69,60},
+{1,40,54,115,44,49,12,9,38,111,57,2,80,108,65,88,98,24,18,76,121,114,2,40,27,53,86,78,71,84,102,92,97},
+{1,31,3,33,5,99,15,14,17,18,51,54,85,90,84,69,87,100,82,7,93,9,38,44,79,29,75,35,72,102,54,127,67},
+{1,48,113,68,124,70,28,29,45,92,24,100,34,62,35,14,82,74,46,12,50,17,83,61,101,9,97,105,16,75,15,49,124},
+{1,117,13,74,81,15,31,75,36,2,85,26,43,29,30,62,41,72,4,21,52,86,29,15,80,61,91,56,107,70,55,59,123},
+{1,82,56,98,76,108,52,127,47,114,96,41,28,49,38,54,26,95,119,57,48,116,7,30,42,117,46,16,22,33,5,76,54},
+{1,67,106,114,2,77,31,47,4,81,62,94,8,105,124,119,16,25,51,37,32,50,51,119,8,81,31,114,1,68,127,89,78},
+{1,20,101,41,13,55,51,99,81,38,18,29,2,40,25,82,26,110,102,21,113,76,18,103,105,5,34,33,63,32,53,100,119},
+{1,121,79,58,114,88,109,70,10,110,24,14,32,91,51,66,68,45,37,108,63,69,42,112,85,99,51,33,17,31,15,70,5},
+{1,39,76,51,27,80,115,70,106,88,100,120,56,101,95,116,86,68,36,37,2,78,76,107,77,10,94,91,116,43,17,118,12},
+{1,71,86,74,102,72,7,11,124,40,3,38,21,49,69,55,9,29,107,120,5,106,104,47,4,97,86,37,110,9,121,33,15},
+{1,23,6,114,20,63,120,115,3,57,10,103,60,65,121,100,5,75,30,88,68,50,61,43,91,70,14,101,9,47,117,64,55},
+{1,88,39,114,113,110,7,102,2,71,78,19,21,43,14,59,4,121,107,38,42,86,14,102,1,44,52,72,109,12,62,105,75},
+{1,27,66,25,116,96,70,117,123,4,108,15,100,42,122,31,46,22,16,74,60,106,84,122,113,117,67,1,115,110,98,56,3},
+{1,36,124,242,140,54,66,139,202,45,99,67,175,182,223,239,117,237,61,21,194,22,87,169,55,51,123,7,126,93,29,241,112},
+{1,47,33,166,117,223,115,61,181,206,150,54,161,184,56,38,107,146,138,37,26,241,176,160,197,65,16,101,132,81,117,225,213},
+{1,91,136,29,165,225,122,189,88,101,174,130,37,114,51,180,141,1,91,136,29,165,229,139,120,144,82,187,193,10,28,127,197},
+{1,212,197,141,233,241,35,68,13,189,96,63,177,9,154,3,81,98,186,22,62,101,102,216,86,10,243,83,229,76,183,195,129},
+{1,36,244,167,49,114,214,139,220,218,2,72,209,119,98,228,149,47,129,141,4,144,209,167,132,128,200,60,243,177,241,149,139},
+{1,240,200,123,75,197,55,32,244,73,26,152,214,98,252,116,216,1,240,200,123,75,253,66,4,223,200,162,93,239,143,1,120},
+{1,245,178,211,14,162,223,11,84,63,67,98,143,55,69,198,244,71,97,221,172,125,106,226,209,242,215,160,60,174,109,108,176},
+{1,164,189,253,163,32,47,238,168,207,35,156,118,240,117,67,237,27,87,123,38,22,239,6,179,76,22,239,6,179,76,22,239},
+{1,28,51,162,137,104,143,32,37,73,182,90,49,154,239,79,254,240,88,9,252,200,31,186,101,176,9,126,50,95,159,240,44},
+{1,30,49,244,149,58,38,43,189,165,208,130,229,14,180,75,12,136,41,129,199,93,212,125,81,144,46,223,20,204,245,247,233},
+{1,209,9,70,65,164,155,32,142,73,51,211,194,84,205,38,186,127,206,60,161,181,178,116,149,245,60,228,119,152,29,127,103},
+{1,220,207,197,187,123,255,228,89,8,183,47,127,28,75,222,6,42,64,124,9,107,112,150,222,3,178,8,227,239,197,229,250},
+{1,185,226,194,146,26,57,213,12,30,51,196,157,184,91,32,80,136,35,236,217,18,173,96,120,102,196,245,46,158,2,185,113},
+{1,152,101,103,44,230,40,112,199,151,119,130,215,57,70,147,225,109,48,137,83,51,45,63,240,144,25,141,223,55,102,90,126},
+{1,126,155,209,184,165,33,136,40,8,254,77,148,210,58,143,213,199,64,107,225,53,70,116,143,169,80,8,127,177,209,92,139},
+{1,235,66,2,93,132,4,186,131,8,255,141,16,117,145,32,234,169,64,95,217,128,95,169,32,117,141,8,186,132,2,235,33},
+{1,217,187,55,7,152,59,133,21,210,161,129,107,169,125,157,156,69,254,201,206,86,240,58,46,237,45,158,61,98,70,12,65},
+{1,36,205,90,172,153,145,46,58,75,105,124,41,198,137,112,6,216,15,67,214,104,44,57,220,128,186,80,226,34,197,189,46},
+{1,182,194,214,31,202,172,131,246,84,95,92,37,192,25,56,197,146,180,13,241,16,122,78,15,31,101,43,36,59,94,117,81},
+{1,91,57,178,183,41,244,117,229,104,30,22,53,84,50,124,157,48,202,239,253,13,138,47,151,134,92,220,109,64,140,194,102},
+{1,36,7,252,21,39,107,245,160,24,2,72,14,73,42,78,214,91,241,48,4,144,14,252,210,189,87,120,5,90,178,185,31},
+{1,9,65,142,205,81,30,238,215,155,112,138,233,232,225,160,46,227,178,172,66,149,7,193,192,26,101,197,210,91,34,153,49},
+{1,56,9,59,65,32,12,227,108,247,138,67,80,30,149,238,183,146,70,136,51,66,52,117,101,102,66,52,117,101,102,66,52},
+{1,133,235,106,196,156,63,45,51,226,101,75,56,40,243,59,104,1,133,235,106,196,78,124,168,108,34,94,246,154,184,230,16},
+{1,36,226,193,223,201,40,133,171,246,104,97,178,28,94,242,248,71,24,206,212,82,161,207,120,44,225,189,224,175,51,248,200},
+{1,201,172,185,241,108,61,151,255,92,28,96,66,51,167,222,171,161,15,249,141,78,38,153,137,104,191,16,225,215,175,241,54},
+{1,30,179,19,37,104,226,22,67,62,189,167,108,154,243,15,170,250,225,52,113,11,105,126,163,10,102,43,110,83,239,64,14},
+{1,36,58,100,157,143,146,160,23,169,224,176,66,239,159,199,230,104,222,68,55,3,54,234,236,128,167,140,127,194,41,215,160},
+{1,64,248,160,121,229,52,183,114,58,221,105,219,28,212,54,55,119,143,47,86,179,185,12,117,253,240,165,102,130,184,44,75},
+{1,111,27,214,188,141,44,236,38,184,200,64,70,221,135,120,2,222,54,85,129,227,44,118,245,23,240,2,111,241,201,235,105},
+{1,9,65,74,25,209,92,191,321,326,377,190,328,263,307,167,409,347,396,486,223,34,153,298,59,496,317,365,5,279,464,429,358},
+{1,194,189,275,322,222,449,441,72,315,493,15,124,232,406,184,200,282,419,425,14,190,290,165,187,199,179,478,457,205,360,498,274},
+{1,42,106,161,210,446,216,186,331,222,70,55,271,189,413,456,310,30,283,162,172,256,406,115,182,338,386,375,372,331,111,282,68},
+{1,13,81,390,473,25,181,484,312,66,321,12,92,471,95,448,172,337,220,378,259,333,40,228,49,435,72,404,388,492,168,447,102},
+{1,54,342,489,404,110,225,382,250,469,286,287,297,127,406,2,108,141,499,265,220,450,382,125,253,443,495,144,246,334,140,498,399},
+{1,345,438,436,299,106,303,340,384,499,374,91,400,337,487,234,101,390,82,152,441,285,256,330,105,354,501,381,230,133,384,495,331},
+{1,484,271,397,129,275,176,263,52,53,465,222,339,466,193,113,374,322,375,166,120,299,357,14,474,188,420,303,158,257,5,265,448},
+{1,231,220,216,271,52,287,437,357,399,390,132,101,160,251,367,420,3,297,356,360,346,46,383,311,425,107,174,422,451,403,319,126},
+{1,452,232,10,126,123,68,341,375,241,358,50,129,152,500,440,322,414,319,496,67,187,219,395,303,343,83,222,184,509,453,150,276},
+{1,379,15,123,85,230,348,316,438,457,206,20,164,204,189,186,58,23,374,221,48,69,136,107,510,298,498,209,483,440,331,37,205},
+{1,300,461,32,437,390,202,445,370,409,189,388,247,66,306,150,468,16,488,195,101,492,366,333,287,370,510,182,258,343,189,194,406},
+{1,207,290,30,398,427,340,149,346,157,409,41,361,303,327,66,317,351,263,225,79,100,381,254,135,161,118,369,53,392,176,486,87},
+{1,361,495,36,377,217,206,342,239,60,212,70,449,379,100,383,286,114,398,328,133,31,438,115,324,178,194,364,254,262,472,488,69},
+{1,398,508,57,473,240,431,404,294,89,388,469,275,99,184,342,247,491,142,393,440,291,187,482,33,52,218,48,433,460,150,28,136},
+{1,249,253,356,237,391,78,213,493,196,503,154,449,468,87,384,220,91,342,58,408,368,501,180,431,349,63,124,1,322,160,274,41},
+{1,187,413,181,86,392,457,75,34,169,327,373,112,330,371,365,266,74,153,308,498,291,252,129,39,383,232,289,71,268,488,468,435},
+{1,376,139,138,498,377,499,1,376,139,138,498,377,499,1,376,139,138,498,377,499,1,188,461,180,263,418,397,347,374,216,506,316},
+{1,4,16,64,256,306,506,67,268,258,314,474,195,405,511,87,348,66,264,274,378,218,436,497,379,111,222,444,481,347,47,94,188},
+{1,236,48,445,70,421,457,390,74,51,137,22,449,259,458,178,26,87,67,90,313,298,138,145,413,297,16,133,192,473,70,387,395},
+{1,57,11,387,69,323,66,492,115,47,424,265,102,455,319,266,45,474,287,453,333,284,199,84,373,151,339,489,87,2,57,343,411},
+{1,163,451,151,116,296,397,299,104,449,465,349,6,357,468,477,312,257,112,267,368,472,220,164,341,32,140,506,243,232,296,401,225},
+{1,227,82,405,466,29,155,371,88,146,337,45,170,417,216,391,406,247,235,147,434,127,452,177,440,188,111,261,505,37,366,314,398},
+{1,235,344,492,187,484,36,464,202,370,100,82,362,453,14,88,35,508,389,396,504,148,203,402,79,454,455,236,186,473,95,345,477},
+{1,510,431,406,391,18,344,372,89,363,260,328,287,188,209,430,104,40,388,223,358,257,360,387,314,505,386,453,289,259,150,51,56},
+{1,195,353,161,245,307,316,207,471,203,10,237,95,488,305,186,220,149,289,189,68,449,291,501,457,254,486,360,492,118,39,75,25},
+{1,218,328,157,124,479,232,196,339,495,208,321,506,24,28,431,313,406,102,119,268,199,371,59,280,263,10,361,239,353,348,298,449},
+{1,293,351,407,326,169,408,427,7,228,386,271,461,426,290,443,21,73,356,50,137,444,258,437,404,110,210,320,180,236,447,463,496},
+{1,470,253,328,405,188,92,379,59,264,343,175,403,442,171,448,183,121,159,190,265,129,41,500,408,435,401,267,234,106,168,477,108},
+{1,508,412,35,400,308,262,160,448,468,492,86,491,161,60,72,463,454,223,423,156,392,397,394,113,324,313,374,490,302,104,173,277},
+{1,407,25,139,321,47,487,180,334,267,352,379,461,190,391,497,283,136,235,4,122,100,278,321,414,189,415,511,212,396,478,126,15},
+{1,160,25,225,321,146,475,374,101,49,34,444,7,117,79,434,237,235,62,104,315,151,119,269,96,130,344,435,428,438,188,364,178},
+{1,401,28,358,336,48,295,351,274,403,33,350,131,399,327,14,179,168,24,284,288,137,163,160,118,127,322,381,240,77,463,483,76},
+{1,103,385,404,89,146,328,128,432,425,483,494,14,329,231,49,61,442,380,326,457,343,204,486,411,298,125,177,343,204,486,411,298},
+{1,92,335,415,442,432,217,424,411,202,479,199,290,313,159,285,201,315,39,178,198,382,59,64,294,444,60,138,81,217,212,306,213},
+{1,132,500,160,38,218,169,463,345,68,217,293,232,185,46,439,222,386,105,226,220,138,93,501,18,489,348,360,236,201,98,412,99},
+{1,408,89,432,191,167,450,8,484,385,164,35,227,125,64,333,300,251,280,394,161,329,239,273,251,140,454,125,32,129,385,82,382},
+{1,286,18,329,260,326,221,424,342,231,136,461,381,227,289,389,392,290,488,446,438,427,314,320,420,113,220,91,81,230,203,164,417},
+{1,372,221,90,438,243,70,261,62,232,15,128,278,13,307,172,185,260,330,53,85,310,351,196,208,281,491,370,260,165,374,183,120},
+{1,205,295,102,245,272,505,322,452,493,67,420,215,323,265,202,37,337,455,186,75,270,228,500,184,344,208,400,447,63,298,42,460},
+{1,449,480,118,92,45,139,187,370,93,492,363,205,302,112,359,464,447,371,412,12,285,509,154,114,199,132,71,42,397,412,6,296},
+{1,234,493,348,408,28,310,208,312,75,336,215,195,127,286,424,151,295,67,218,358,333,307,457,259,58,476,296,25,314,377,276,251},
+{1,42,465,58,2,84,209,116,4,168,418,232,8,336,55,464,16,467,110,211,32,213,110,464,8,168,209,58,1,21,273,354,267},
+{1,83,511,45,410,491,464,273,240,97,138,328,78,438,34,452,236,123,378,315,211,502,371,504,202,454,37,385,36,23,132,285,402},
+{1,483,111,491,355,278,47,149,385,493,422,116,218,213,255,271,349,509,59,398,455,86,19,476,369,100,353,360,221,315,446,432,150},
+{1,59,468,424,33,69,43,491,144,455,474,234,212,471,485,466,306,72,292,237,117,106,150,361,143,391,147,197,302,358,500,235,432},
+{1,78,121,406,399,19,209,89,400,43,261,326,408,506,364,211,197,354,166,442,352,58,164,147,436,346,185,193,45,384,20,333,413},
+{1,151,388,370,368,94,227,434,231,91,413,332,130,52,187,406,146,250,396,277,49,453,180,266,100,124,498,53,22,478,60,110,258},
+{1,303,88,304,469,138,269,446,175,84,425,460,151,359,180,430,371,287,389,340,417,290,247,178,31,282,434,27,253,490,131,102,277},
+{1,144,473,208,31,364,253,290,341,469,414,289,229,121,238,256,150,382,79,312,302,27,406,244,350,86,410,83,242,238,128,454,222},
+{1,264,482,42,258,195,25,6,422,17,252,410,321,86,20,393,102,451,257,16,500,120,336,85,390,25,3,396,364,253,73,218,490},
+{1,331,466,312,436,213,476,35,171,177,362,34,480,355,82,406,309,191,113,317,388,469,463,196,150,93,227,126,336,161,398,316,385},
+{1,429,284,128,56,480,90,381,319,428,177,412,184,472,442,295,66,147,285,301,292,352,49,210,86,197,417,287,209,199,12,401,241},
+{1,255,400,457,97,94,140,164,454,271,248,180,338,373,377,278,217,355,54,103,389,391,464,32,148,61,150,194,94,70,41,290,160},
+{1,201,358,200,431,430,359,1,201,358,200,431,430,359,1,201,358,200,431,430,359,1,405,424,25,220,314,321,85,119,65,107,154},
+{1,151,332,409,472,364,124,502,145,471,483,181,391,198,254,158,344,298,196,464,495,387,333,135,37,407,224,192,454,57,399,470,186},
+{1,312,502,501,326,167,323,370,155,165,200,357,138,466,390,24,405,228,204,392,164,496,436,161,495,172,21,205,88,425,129,416,240},
+};
+
+static const uint16_t prescr_table_32_11213[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,1,3,2,1,3,2,1,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1},
+{1,3,5,4,7,2,6,1,3,5,4,7,2,6,5,2,3,7,1,4,6,5,2,3,7,1,4,6,5,2,3,7,1},
+{1,3,5,2,6,7,4,1,3,5,2,6,7,4,6,5,1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2},
+{1,11,9,12,13,6,15,3,14,8,7,4,10,2,11,13,3,7,2,11,13,3,7,2,11,13,3,7,2,11,13,3,7},
+{1,5,8,3,15,1,5,8,3,15,1,5,8,3,11,6,15,12,7,1,14,2,5,4,10,8,13,9,3,11,6,15,12},
+{1,3,5,15,14,13,8,7,9,4,12,11,2,6,5,8,12,10,15,7,11,1,14,9,2,3,13,4,6,5,8,12,10},
+{1,29,22,7,25,13,21,5,6,4,27,18,28,11,26,21,16,19,18,14,25,20,12,4,31,22,17,15,5,3,1,28,23},
+{1,12,2,24,4,25,8,27,16,31,9,23,18,7,18,23,9,31,16,27,8,25,4,24,2,12,1,6,20,3,10,21,5},
+{1,16,9,3,31,27,5,14,2,15,18,6,17,25,5,7,23,4,15,9,22,12,17,27,21,20,28,2,16,19,11,6,31},
+{1,25,18,26,14,27,23,9,13,7,22,16,31,29,12,15,1,23,31,21,6,28,27,16,20,17,3,14,22,8,10,19,26},
+{1,18,11,7,8,10,21,3,13,29,9,24,30,4,31,11,30,2,18,24,15,1,9,12,26,29,25,6,13,19,17,3,27},
+{1,9,6,11,20,7,2,18,12,22,21,14,4,25,12,11,10,16,15,24,22,20,29,30,13,17,21,7,1,26,31,23,14},
+{1,12,19,17,9,47,13,31,2,24,38,34,18,29,13,46,33,3,10,60,14,36,29,13,46,33,3,10,60,14,36,29,13},
+{1,17,37,61,19,7,62,32,33,48,21,40,59,60,1,44,27,42,40,57,15,18,11,48,46,10,28,53,32,52,12,47,38},
+{1,39,57,16,49,35,11,13,38,30,41,33,18,40,3,31,7,6,62,14,12,43,28,24,1,56,48,2,39,55,4,25,57},
+{1,39,36,22,33,27,35,14,48,34,41,20,52,8,42,19,22,61,16,15,38,44,33,32,30,23,3,25,27,60,46,6,50},
+{1,58,61,56,40,35,57,18,30,1,58,61,56,40,33,22,26,37,3,39,57,9,55,12,63,38,36,30,48,62,59,51,25},
+{1,10,35,12,31,8,55,45,7,54,39,36,58,56,22,41,36,29,14,54,32,9,45,48,62,8,40,33,12,60,2,10,34},
+{1,14,57,48,35,11,15,55,9,19,40,4,56,62,13,35,51,46,16,29,62,13,35,51,46,16,29,62,13,35,51,46,16},
+{1,58,32,3,61,19,5,52,53,15,47,44,17,2,58,16,28,21,6,61,48,36,63,10,52,35,31,50,30,47,22,33,37},
+{1,35,23,58,43,49,29,47,34,52,45,17,26,44,25,30,37,33,18,5,24,53,7,59,4,51,23,29,45,50,60,63,55},
+{1,41,89,4,39,98,16,31,13,64,124,52,6,117,104,6,123,52,3,124,26,64,62,13,32,31,71,16,78,98,8,39,49},
+{1,13,81,34,33,54,76,42,73,19,78,48,98,87,6,23,61,93,63,80,83,28,70,44,119,95,50,60,31,9,118,29,4},
+{1,13,81,48,110,21,102,125,93,108,15,75,29,14,35,19,36,69,106,87,15,98,99,34,82,84,67,125,105,27,16,104,90},
+{1,47,76,114,52,66,91,11,43,97,96,79,3,113,106,109,67,58,125,25,40,8,45,9,114,26,88,61,83,96,111,108,28},
+{1,59,10,9,68,90,65,16,99,61,13,53,114,101,29,43,122,13,84,82,31,16,127,40,18,68,45,55,2,59,5,37,70},
+{1,78,101,57,86,31,121,53,107,63,27,15,72,40,71,48,122,32,49,93,67,11,31,111,119,74,90,17,108,30,72,20,112},
+{1,57,25,102,23,110,34,13,67,30,98,88,10,71,125,84,56,16,53,100,103,23,55,93,62,91,117,27,10,118,107,42,28},
+{1,44,83,121,123,35,60,119,56,126,6,81,33,100,52,110,17,4,88,83,96,108,61,113,104,101,34,8,9,31,121,97,122},
+{1,17,127,52,73,95,87,96,26,123,112,116,48,13,49,14,119,94,35,40,42,59,91,86,103,105,30,64,99,75,97,90,1},
+{1,104,112,125,115,4,34,66,118,78,16,73,75,90,93,16,68,66,59,115,2,104,56,47,38,48,13,7,77,84,6,121,72},
+{1,119,14,48,84,125,116,92,34,4,74,56,11,13,49,116,46,109,101,47,51,3,41,97,10,61,27,60,69,90,67,8,74},
+{1,98,24,55,53,34,18,124,22,82,118,93,113,6,117,20,75,120,28,101,72,43,22,41,116,37,77,13,8,46,48,55,115},
+{1,83,93,123,9,53,75,34,65,55,56,77,98,37,41,105,91,119,46,10,96,43,58,31,54,95,4,115,93,87,55,28,38},
+{1,89,37,20,72,127,63,51,11,125,104,121,35,8,75,74,20,36,84,34,90,103,85,124,106,23,35,4,87,37,10,18,42},
+{1,118,77,28,18,27,97,38,53,88,116,78,105,42,104,46,107,99,101,16,12,5,56,18,122,84,63,92,57,41,37,32,24},
+{1,69,50,95,91,92,101,10,117,22,96,72,126,38,34,89,107,60,110,29,40,27,22,48,18,75,32,28,114,111,71,92,74},
+{1,124,83,5,98,6,17,4,30,85,20,102,24,68,8,30,81,5,49,122,33,70,116,76,22,79,84,52,75,91,103,50,56},
+{1,110,56,104,91,5,44,37,50,48,17,97,76,7,120,42,35,86,40,77,74,50,24,59,109,69,8,66,112,104,83,62,123},
+{1,119,201,181,112,151,252,86,220,52,148,101,22,24,82,128,196,72,165,173,106,227,86,110,13,159,185,17,35,240,2,119,233},
+{1,38,96,193,185,15,223,26,59,169,85,145,150,100,162,9,139,216,116,143,148,20,97,253,113,208,236,79,85,198,171,130,83},
+{1,235,234,1,235,234,1,235,234,1,235,234,1,235,117,223,56,97,171,7,246,48,176,84,6,22,159,74,72,163,214,9,49},
+{1,138,54,73,141,247,203,95,35,84,116,147,189,245,121,209,165,122,30,37,153,48,1,69,155,186,26,28,175,130,105,53,125},
+{1,209,196,38,236,64,240,109,72,238,219,65,33,169,55,156,122,132,107,110,1,244,49,214,220,2,209,98,149,129,4,155,196},
+{1,231,226,216,243,10,116,86,205,252,68,9,98,79,77,170,219,237,75,188,72,183,158,154,107,137,229,150,71,144,81,3,11},
+{1,42,61,209,101,30,219,44,193,95,25,13,159,108,178,229,231,205,117,18,55,76,136,64,116,7,107,217,60,219,22,99,113},
+{1,192,2,223,4,225,8,157,16,101,32,202,64,203,64,202,32,101,16,157,8,225,4,223,2,192,1,96,175,48,248,24,124},
+{1,122,209,135,31,154,113,42,54,34,67,131,148,123,228,164,19,50,229,153,206,191,170,22,251,233,230,222,202,75,123,228,164},
+{1,166,44,172,161,241,104,74,57,117,55,170,218,25,165,227,54,6,143,58,125,251,192,238,30,121,210,236,184,111,249,102,248},
+{1,16,105,143,3,48,187,248,5,80,164,97,15,240,246,198,47,17,136,141,165,140,173,204,127,67,202,79,170,244,214,175,220},
+{1,2,4,8,16,32,64,128,113,226,181,27,54,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,187,230,115,130,65,155,246,123,134,67,154,77,157,245,193,219,214,107,142},
+{1,117,87,41,196,90,214,250,228,206,149,54,155,86,46,122,33,205,5,109,28,96,222,210,151,110,238,189,254,152,217,202,29},
+{1,92,10,209,68,177,33,127,205,8,105,80,148,169,77,66,127,165,2,92,5,150,203,224,183,55,113,182,25,176,253,191,192},
+{1,201,247,107,153,9,173,232,37,224,65,255,15,134,230,53,20,125,61,38,24,86,175,189,16,100,202,214,153,193,140,29,238},
+{1,157,176,36,66,120,179,14,31,20,117,134,71,6,42,232,27,189,206,167,251,69,158,77,125,160,89,129,71,3,21,116,203},
+{1,9,65,232,75,178,96,94,15,119,241,154,151,242,143,21,145,98,38,139,7,208,22,83,53,1,203,184,29,181,224,206,97},
+{1,242,213,247,169,48,196,216,52,74,202,174,11,10,124,178,162,29,15,66,235,243,194,217,99,79,91,163,100,131,185,167,35},
+{1,13,81,207,125,154,134,10,114,209,235,64,18,202,34,221,143,227,20,114,188,132,8,52,162,207,234,242,174,225,25,142,49},
+{1,241,58,115,226,211,255,50,142,131,41,154,110,3,81,203,252,72,48,182,137,155,151,98,44,190,47,239,228,19,172,35,26},
+{1,70,216,10,123,57,68,84,7,111,207,54,220,175,238,107,53,11,192,87,184,240,243,150,204,126,109,255,191,25,113,33,112},
+{1,74,41,11,203,240,69,9,95,162,83,92,124,40,193,217,39,209,204,131,199,7,251,71,175,146,247,56,212,125,49,26,180},
+{1,253,31,17,154,32,206,126,113,7,162,93,119,88,112,125,187,238,88,112,125,187,238,88,112,125,187,238,88,112,125,187,238},
+{1,19,210,151,250,22,141,163,72,170,195,99,30,21,92,235,113,132,20,190,52,89,47,124,12,106,161,55,168,153,4,38,210},
+{1,97,77,9,211,66,65,226,53,46,134,64,131,120,253,98,119,217,25,53,23,207,8,89,154,9,135,254,221,219,120,253,98},
+{1,33,83,190,77,174,116,43,254,169,147,117,10,173,248,196,212,59,144,11,70,17,12,198,245,225,76,180,112,164,159,15,4},
+{1,98,134,71,161,164,189,54,158,174,143,211,61,206,159,102,135,235,117,34,125,89,130,30,43,55,126,10,25,188,42,6,166},
+{1,33,63,11,158,76,69,153,171,248,168,155,233,134,95,238,202,135,181,102,114,205,14,231,164,113,6,99,218,122,73,112,236},
+{1,12,80,50,161,104,235,226,142,85,14,72,146,197,149,140,218,215,249,29,78,93,55,178,94,61,142,214,255,9,54,180,74},
+{1,147,357,394,399,339,420,3,437,428,157,146,502,239,259,55,351,443,300,441,447,10,220,378,233,182,225,249,40,371,494,423,219},
+{1,174,71,414,157,106,417,331,352,170,238,130,214,15,268,127,385,280,113,218,250,79,102,45,279,381,165,379,343,23,247,493,306},
+{1,128,247,244,372,109,369,250,77,457,199,16,92,277,409,510,218,369,125,413,254,45,267,32,92,385,455,255,109,435,309,453,127},
+{1,110,186,165,9,261,348,443,65,321,459,57,82,318,233,503,467,450,158,334,213,309,264,509,5,235,409,398,96,343,49,401,54},
+{1,25,321,182,129,95,308,121,99,265,93,262,218,271,277,416,501,274,151,476,506,65,29,386,124,15,339,138,94,390,78,334,264},
+{1,152,186,463,228,406,344,289,216,48,369,358,439,389,226,355,177,360,40,377,254,132,442,229,135,366,384,414,225,439,468,113,423},
+{1,237,410,35,421,373,99,129,150,111,59,209,507,376,26,87,503,225,144,25,469,69,39,17,82,322,4,474,410,264,508,228,37},
+{1,54,386,240,376,84,457,288,245,406,259,178,302,497,211,442,59,110,436,185,98,256,116,234,482,334,235,505,11,245,203,210,417},
+{1,460,168,342,239,119,497,384,107,66,310,335,331,144,280,474,438,380,203,337,432,369,55,131,477,349,426,137,458,89,389,62,446},
+{1,164,109,94,72,172,499,361,231,179,45,364,140,362,426,1,82,419,156,299,353,403,97,424,165,331,155,149,438,24,337,366,226},
+{1,67,328,363,90,396,149,202,9,62,249,450,239,178,329,148,374,201,102,459,346,441,106,65,231,341,355,289,150,309,109,407,345},
+{1,227,416,339,476,99,380,136,383,429,502,49,507,148,11,67,401,84,82,375,7,96,280,154,203,26,165,450,102,61,490,172,354},
+{1,75,338,273,116,38,358,143,217,181,202,6,442,349,348,78,301,473,114,206,149,11,117,257,13,168,250,90,396,285,384,167,25},
+{1,158,241,458,389,198,35,474,441,147,126,409,235,212,426,445,78,469,5,371,363,378,299,258,382,23,499,411,464,374,24,17,81},
+{1,158,391,71,503,43,384,480,408,510,191,305,482,164,376,147,139,132,364,421,407,279,327,357,495,292,392,245,277,473,152,95,458},
+{1,273,464,361,305,412,168,367,222,114,87,64,152,261,94,161,373,39,89,222,57,180,8,330,295,361,475,103,21,381,365,382,439},
+{1,275,102,236,188,83,335,438,461,447,135,124,180,10,117,255,215,259,106,419,133,301,30,159,257,377,400,190,112,399,482,34,417},
+{1,92,170,286,309,76,88,474,303,127,426,360,186,492,436,345,248,334,75,230,163,465,217,402,335,101,384,362,1,46,358,457,464},
+{1,151,109,433,329,443,409,170,185,95,477,111,159,403,61,106,298,323,484,34,456,172,180,437,219,171,23,349,348,70,420,63,253},
+{1,140,472,19,357,84,261,215,246,408,370,420,478,414,301,349,356,108,158,330,412,417,433,155,20,50,343,381,405,370,210,293,456},
+{1,283,394,250,19,20,164,332,261,380,272,195,470,316,267,14,176,244,494,241,173,78,307,97,463,189,133,234,405,476,183,172,404},
+{1,166,149,187,254,48,452,506,259,246,110,2,332,298,187,127,12,355,447,445,283,10,137,59,56,205,15,406,381,36,496,339,349},
+{1,426,162,402,395,132,152,338,473,14,229,283,437,299,289,484,241,89,85,211,309,110,102,265,77,479,68,101,118,362,120,70,463},
+{1,383,148,455,42,298,368,380,474,123,172,340,193,35,303,337,238,10,285,354,261,452,178,322,141,250,255,278,423,66,160,249,88},
+{1,366,160,321,317,11,343,322,94,491,69,212,67,195,169,357,403,476,194,30,333,481,62,293,323,152,398,328,347,182,159,90,400},
+{1,81,180,40,287,78,502,453,220,372,481,212,295,503,202,26,326,313,114,488,107,442,293,455,63,7,438,195,27,3,276,119,15},
+{1,244,100,318,333,308,26,41,66,506,94,286,324,383,431,267,399,117,90,359,53,83,56,228,141,165,254,483,463,124,261,438,235},
+{1,173,86,257,471,107,222,294,252,237,372,432,98,233,480,58,334,406,242,176,140,53,478,46,142,152,501,208,297,238,317,302,51},
+{1,71,282,249,187,250,114,213,377,280,119,398,264,260,272,167,214,216,269,431,84,80,222,452,56,342,393,494,16,313,363,498,187},
+{1,490,412,143,92,487,503,489,177,312,461,259,205,227,325,254,246,376,339,476,498,335,154,19,272,255,3,287,169,285,323,467,420},
+{1,135,307,450,413,82,326,295,464,392,199,96,112,363,460,452,205,446,124,312,166,449,10,398,96,56,277,115,113,246,485,31,78},
+{1,275,178,271,143,267,482,220,255,511,498,73,413,170,416,87,451,509,490,259,412,339,371,486,343,74,340,95,174,153,229,203,281},
+{1,464,425,355,380,379,302,20,123,73,110,482,398,239,136,407,295,484,404,31,402,332,382,252,159,259,26,505,470,22,124,14,85},
+{1,443,410,258,200,436,500,131,35,223,463,73,464,302,420,486,382,411,452,460,322,327,69,33,76,490,439,4,71,410,129,50,430},
+{1,172,249,236,401,496,128,491,259,281,54,61,484,337,292,233,91,488,486,409,371,466,182,235,247,9,477,159,364,470,494,18,129},
+{1,251,10,188,68,323,481,97,494,131,392,197,317,304,18,433,45,343,488,232,109,420,328,211,381,107,169,327,162,192,277,480,77},
+{1,461,315,374,466,420,89,312,110,464,369,352,155,133,332,163,98,407,298,481,115,205,138,191,262,168,324,265,347,225,451,392,194},
+{1,13,81,198,3,23,243,330,5,57,277,133,15,75,50,181,274,83,110,339,88,508,283,460,419,347,108,350,477,96,368,302,197},
+{1,296,160,195,155,45,371,15,125,162,498,475,427,69,410,462,423,416,301,501,464,474,497,225,378,32,431,163,109,310,45,265,363},
+{1,374,448,249,481,460,86,240,93,203,433,222,310,326,446,64,67,398,286,338,243,86,120,376,116,154,351,426,269,85,437,488,56},
+{1,350,306,389,211,127,105,294,283,487,228,204,496,245,343,249,73,194,184,68,371,377,232,376,71,130,26,15,239,344,22,273,212},
+{1,323,189,67,383,348,183,132,120,177,488,133,315,12,364,455,475,389,453,152,98,265,352,171,28,94,64,349,250,363,105,459,183},
+{1,410,240,78,236,211,174,389,444,284,360,245,322,163,365,323,291,309,456,511,232,413,356,280,255,429,367,217,347,153,106,282,357},
+{1,455,240,205,472,350,6,29,421,299,95,206,20,78,362,124,217,203,288,285,85,438,413,309,27,220,481,492,208,508,252,441,358},
+{1,80,203,414,444,433,430,128,315,314,362,417,63,387,25,103,484,509,410,126,387,25,103,484,509,410,126,387,25,103,484,509,410},
+{1,256,369,178,190,411,339,329,259,464,128,360,89,95,350,182,510,47,239,1,128,180,254,327,275,302,263,329,337,116,16,454,295},
+{1,220,264,401,433,243,97,175,190,195,386,116,23,256,471,292,206,466,242,388,350,190,443,442,468,406,8,197,421,401,258,267,416},
+{1,196,360,299,216,398,72,493,56,460,383,467,213,177,146,297,168,267,369,208,110,379,189,435,296,202,337,461,257,284,269,61,268},
+{1,341,150,421,461,190,34,279,271,207,452,22,77,321,219,114,239,223,287,121,494,126,159,357,395,29,196,483,327,227,175,165,237},
+{1,205,168,40,400,308,29,507,303,131,239,348,337,157,452,144,290,322,283,503,23,298,445,75,479,223,359,309,104,166,444,456,501},
+{1,313,477,84,481,335,76,390,230,54,450,6,268,153,252,247,7,508,81,467,31,41,200,303,232,46,308,382,315,49,285,438,20},
+{1,364,187,351,352,319,449,432,235,68,66,128,207,167,460,172,473,348,362,470,68,33,32,150,423,259,277,319,266,108,376,241,202},
+{1,170,301,52,89,304,379,176,237,172,264,360,225,230,472,6,510,87,23,144,53,405,241,328,51,107,166,351,163,94,307,430,491},
+{1,508,344,472,222,284,365,378,115,12,90,44,490,429,398,84,455,300,499,387,135,410,35,474,403,235,223,112,260,285,441,505,73},
+{1,227,139,258,28,315,352,153,336,460,26,152,435,327,140,33,17,335,233,311,275,321,425,283,292,191,25,298,511,53,285,1,389},
+{1,382,470,147,331,315,469,234,202,142,499,92,334,432,427,398,20,278,376,146,487,312,214,164,429,503,297,120,386,230,151,95,358},
+};
+
+static const uint16_t prescr_table_32_19937[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7,5,1,2,4,3,6,7},
+{1,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4},
+{1,5,1,11,9,12,13,6,15,3,14,8,7,4,10,2,5,1,11,9,12,13,6,15,3,14,8,7,4,10,2,5,1},
+{1,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10,7,9,2,6,10},
+{1,11,12,4,9,7,8,13,14,15,5,3,1,10,6,2,11,12,4,9,7,8,13,14,15,5,3,1,10,6,2,11,12},
+{1,20,28,6,25,1,10,14,3,30,18,5,7,19,15,9,16,17,27,21,22,8,26,31,24,11,4,13,29,12,23,2,20},
+{1,20,5,11,28,7,31,25,12,3,30,19,26,18,16,4,1,10,22,17,14,23,27,24,6,21,15,29,13,9,8,2,20},
+{1,20,27,12,9,4,7,25,24,18,8,14,29,31,11,16,28,21,17,22,15,23,5,13,3,30,1,10,26,6,19,2,20},
+{1,20,13,28,4,31,26,15,8,9,3,30,16,18,6,11,23,19,12,22,25,17,24,27,5,21,7,1,10,29,14,2,20},
+{1,20,18,21,24,28,15,16,1,10,9,23,12,14,26,8,29,5,25,22,6,7,13,4,19,31,17,11,3,30,27,2,20},
+{1,20,6,1,10,3,30,5,31,15,28,17,25,14,22,18,7,11,9,29,27,26,16,19,13,8,23,24,4,21,12,2,20},
+{1,7,43,10,27,1,34,52,5,44,33,17,26,35,22,49,41,13,48,11,57,53,39,24,36,61,59,50,12,18,63,60,25},
+{1,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,32},
+{1,22,36,16,30,43,46,9,4,44,31,32,60,1,11,18,8,15,62,23,47,2,22,36,16,30,43,46,9,4,44,31,32},
+{1,54,9,46,13,25,31,30,5,44,59,16,49,19,28,51,37,21,29,40,12,2,54,9,46,13,25,31,30,5,44,59,16},
+{1,61,20,22,43,63,41,2,61,20,22,43,63,41,2,61,20,22,43,63,41,2,61,20,22,43,63,41,2,61,20,22,43},
+{1,49,23,11,16,20,17,63,41,9,33,3,26,47,61,24,30,42,19,14,62,2,49,23,11,16,20,17,63,41,9,33,3},
+{1,28,31,13,43,22,30,3,18,38,61,8,29,17,52,27,53,21,12,37,47,46,32,25,41,10,1,14,57,48,35,11,15},
+{1,32,39,36,20,25,47,49,29,28,12,38,52,62,11,37,4,51,61,59,40,50,45,17,58,56,24,63,27,15,22,57,8},
+{1,8,32,31,9,36,15,60,26,29,1,4,16,53,62,18,61,30,13,52,58,2,8,32,31,9,36,15,60,26,29,1,4},
+{1,74,18,22,1,37,9,11,65,83,69,68,97,104,99,34,113,52,112,17,121,26,56,73,125,13,28,101,127,71,14,115,126},
+{1,64,25,22,109,106,3,96,81,29,31,95,70,80,61,87,84,52,101,120,103,56,126,46,19,68,16,36,65,57,94,102,24},
+{1,8,32,15,60,127,109,37,27,108,33,11,44,63,115,93,106,57,107,61,123,125,101,5,20,80,94,102,9,36,31,124,97},
+{1,97,62,38,127,85,78,14,5,43,99,95,24,89,42,27,64,11,46,72,60,71,65,115,49,91,75,37,102,116,123,6,50},
+{1,22,23,28,89,87,53,80,4,44,46,56,47,51,106,61,8,88,92,112,94,102,73,122,16,45,37,125,33,81,15,105,32},
+{1,127,46,103,17,70,41,45,116,40,65,99,72,26,64,15,95,122,27,44,24,63,33,56,107,93,5,53,75,9,121,8,21},
+{1,12,40,91,39,121,64,125,88,45,69,99,28,72,77,83,23,114,122,74,65,123,76,85,3,10,60,35,97,16,96,22,116},
+{1,15,118,11,104,94,126,55,123,114,21,61,72,23,50,62,28,90,96,98,109,27,16,120,38,88,111,20,102,115,78,6,17},
+{1,52,116,49,6,92,35,83,10,91,101,74,30,82,16,97,34,73,48,28,102,100,80,36,21,19,79,108,63,53,110,11,65},
+{1,33,39,68,45,32,87,55,15,86,71,124,116,49,108,63,74,11,20,9,53,46,113,3,81,84,102,91,48,28,76,104,125},
+{1,62,16,102,75,28,41,43,21,5,99,40,52,29,54,35,38,69,109,89,68,114,81,119,50,95,6,66,48,97,22,36,123},
+{1,50,104,124,46,33,117,44,19,29,80,61,60,37,17,47,56,65,18,4,100,3,43,92,66,57,88,38,58,115,122,120,74},
+{1,67,17,120,63,125,39,61,62,54,69,1,75,98,60,117,84,121,116,31,27,72,106,79,49,30,80,42,86,58,101,103,36},
+{1,31,61,24,97,51,69,55,123,77,75,106,45,5,67,22,60,101,13,63,7,92,43,36,4,62,122,48,39,102,111,110,19},
+{1,105,99,112,65,47,91,39,33,117,63,64,108,29,31,118,21,101,36,11,80,119,86,35,28,92,48,45,50,68,81,52,16},
+{1,24,81,8,96,87,32,98,79,113,106,47,38,74,77,105,59,39,70,29,109,11,116,86,44,50,75,65,57,63,23,21,13},
+{1,107,84,112,64,34,122,105,63,36,48,98,88,19,86,27,20,82,58,75,69,77,15,70,104,113,14,8,66,73,46,25,127},
+{1,15,84,124,77,65,99,97,110,58,70,11,74,41,72,38,28,90,81,27,50,122,92,64,26,75,80,98,24,68,4,30,85},
+{1,235,12,76,40,179,240,135,22,63,116,130,35,33,202,198,138,162,17,225,102,112,79,59,185,154,187,113,183,61,159,142,111},
+{1,132,143,99,35,110,94,162,182,247,248,1,66,201,191,159,55,47,81,91,245,124,142,33,234,209,193,149,153,166,163,244,62},
+{1,118,175,113,14,105,48,124,42,52,144,95,214,140,141,182,116,217,222,127,103,89,76,86,30,164,207,137,90,1,59,194,173},
+{1,99,139,106,141,207,61,113,135,13,192,158,100,137,9,6,165,176,190,186,124,71,147,164,23,109,143,172,182,27,10,194,253},
+{1,155,177,76,225,128,217,218,144,229,143,130,66,107,220,4,15,91,152,251,57,139,141,25,243,39,61,132,214,129,8,30,182},
+{1,97,38,49,116,2,97,38,49,116,2,97,38,49,116,2,97,38,49,116,2,97,38,49,116,2,97,38,49,116,2,97,38},
+{1,82,112,54,232,105,16,10,87,253,238,159,128,80,34,70,222,129,121,26,93,170,19,113,31,208,114,100,152,95,248,99,71},
+{1,74,100,78,240,134,108,57,63,225,77,159,208,5,177,250,187,199,16,238,193,206,66,19,129,151,167,202,214,219,29,40,244},
+{1,204,167,77,79,131,36,105,38,165,129,232,206,107,234,2,204,167,77,79,131,36,105,38,165,129,232,206,107,234,2,204,167},
+{1,196,89,170,149,76,62,187,236,208,175,26,96,90,12,82,179,83,209,205,132,53,162,42,77,92,37,185,40,137,5,143,44},
+{1,36,218,42,38,254,240,12,216,14,252,212,214,242,40,2,36,218,42,38,254,240,12,216,14,252,212,214,242,40,2,36,218},
+{1,175,28,205,168,115,231,80,174,243,195,118,39,102,155,134,164,2,175,28,205,168,115,231,80,174,243,195,118,39,102,155,134},
+{1,17,59,9,247,74,155,133,122,116,3,162,157,182,55,111,109,124,71,78,185,243,104,237,151,227,224,66,223,105,94,49,92},
+{1,239,27,118,31,211,41,63,23,226,69,156,107,35,225,96,55,38,142,230,224,170,135,29,60,50,73,8,49,108,163,124,193},
+{1,229,210,153,18,86,94,196,130,111,39,248,7,25,152,163,63,209,205,169,64,69,185,243,201,228,99,240,157,95,117,235,224},
+{1,131,117,64,57,101,233,135,248,170,185,23,35,222,125,209,102,238,13,152,74,43,79,34,90,130,241,191,25,188,30,54,126},
+{1,123,56,170,55,189,131,164,219,21,207,33,242,134,169,183,153,124,78,254,17,57,81,43,232,94,60,92,71,100,237,83,80},
+{1,10,34,170,163,142,23,75,248,38,190,231,69,206,200,214,176,209,171,166,159,66,213,191,226,84,155,86,145,116,59,215,181},
+{1,78,248,247,153,232,98,118,127,195,25,41,53,167,189,253,76,182,15,110,113,138,20,9,188,218,48,28,146,26,64,177,250},
+{1,228,78,243,148,141,16,45,139,149,255,55,128,193,7,247,245,17,95,172,56,181,165,136,3,150,105,94,222,31,24,239,26},
+{1,28,168,116,75,128,117,69,212,79,184,148,173,66,254,82,30,180,220,63,203,245,48,145,155,247,44,57,239,188,172,76,170},
+{1,185,156,93,141,153,16,70,211,47,91,251,128,247,108,197,31,145,51,241,26,220,248,187,37,193,208,20,137,86,149,252,116},
+{1,36,77,192,30,31,13,202,170,165,75,172,201,156,47,235,189,56,118,128,20,171,183,140,204,198,114,200,142,232,139,178,214},
+{1,50,211,110,147,221,240,251,24,151,185,153,39,241,226,150,160,23,16,95,107,238,58,27,188,228,192,26,165,106,247,180,44},
+{1,38,115,249,35,44,205,145,144,131,81,198,60,42,167,4,76,230,37,70,88,77,245,247,209,162,91,120,84,153,8,152,27},
+{1,215,252,106,87,116,4,115,37,212,174,232,8,230,74,117,129,13,16,17,148,234,223,26,32,34,245,9,99,52,64,68,55},
+{1,229,207,255,196,193,109,128,21,24,238,241,86,133,185,245,123,252,160,154,30,38,71,176,46,29,66,28,195,136,79,234,220},
+{1,232,194,135,245,95,80,169,147,90,7,191,212,192,111,55,216,165,246,195,243,148,229,211,127,187,247,183,146,46,102,5,87},
+{1,10,34,170,29,105,56,216,82,239,185,66,191,92,217,87,254,236,182,113,64,181,126,115,74,151,212,110,35,175,12,60,204},
+{1,108,15,203,214,227,66,47,22,38,105,225,46,32,221,240,138,163,1,54,251,153,107,141,33,235,11,19,200,140,23,16,146},
+{1,260,200,454,28,49,246,171,168,302,386,167,181,413,272,239,19,426,233,284,242,160,312,161,442,197,345,203,64,176,276,228,387},
+{1,229,69,254,324,188,495,29,46,141,425,380,5,176,416,387,59,294,48,316,75,84,159,87,256,312,385,222,355,206,120,247,443},
+{1,424,169,498,76,312,87,495,116,224,345,22,477,157,500,163,195,86,315,299,25,383,138,253,353,462,211,356,93,222,110,227,37},
+{1,324,137,295,157,483,497,226,21,102,37,159,167,376,453,136,389,468,125,178,286,480,23,290,172,440,58,155,52,106,400,434,88},
+{1,282,102,247,175,385,270,39,298,154,485,227,238,92,315,67,199,83,147,322,328,120,390,140,190,344,44,151,343,388,406,216,431},
+{1,175,492,437,405,508,151,54,186,209,277,88,353,159,167,381,114,310,479,272,71,98,20,124,86,1,321,246,460,476,254,349,27},
+{1,90,110,511,213,136,37,351,94,218,291,280,290,309,277,211,102,151,365,289,322,332,202,448,91,67,456,307,507,97,84,488,245},
+{1,315,340,483,316,490,254,134,123,126,507,434,491,326,44,431,224,270,461,424,94,19,119,57,222,366,446,428,99,240,506,10,321},
+{1,505,425,242,77,104,157,338,96,402,285,497,166,189,476,348,317,383,410,18,446,311,393,124,369,199,255,313,212,145,502,292,487},
+{1,60,247,473,456,54,59,173,404,63,213,122,466,282,22,420,64,353,474,490,405,33,385,441,310,257,292,221,138,81,159,471,380},
+{1,411,246,510,388,132,61,128,366,364,247,1,511,123,255,194,66,300,64,183,182,329,306,461,271,333,97,33,150,32,361,91,406},
+{1,90,262,179,166,134,500,181,72,485,33,351,450,400,510,391,388,499,118,424,349,408,150,333,289,258,7,195,480,184,441,457,143},
+{1,269,27,386,405,136,327,29,250,440,97,407,389,348,415,367,304,294,394,383,228,510,248,181,122,21,16,468,216,370,458,158,491},
+{1,361,397,148,455,332,353,199,57,480,201,191,429,338,260,464,492,294,383,162,302,53,15,265,432,465,99,219,309,378,392,446,343},
+{1,393,495,26,108,223,162,193,417,445,311,420,296,349,413,454,434,136,282,355,111,172,132,214,507,51,452,59,359,256,271,176,14},
+{1,509,55,51,334,288,326,349,410,401,428,31,442,101,91,424,354,468,3,64,367,361,489,432,485,176,343,26,378,339,359,276,309},
+{1,185,238,460,495,388,131,256,350,283,98,96,217,55,507,20,400,275,19,333,86,52,84,141,186,321,341,197,470,453,136,222,234},
+{1,64,253,268,237,405,174,264,109,111,47,210,478,307,166,8,256,365,258,301,511,33,274,436,444,188,465,211,510,1,32,306,134},
+{1,192,147,423,367,95,279,257,420,463,468,306,392,133,258,260,68,497,443,169,72,466,114,61,207,16,485,478,81,500,91,151,39},
+{1,44,141,362,446,472,259,439,382,134,480,182,229,373,12,232,395,147,206,410,485,248,235,433,266,273,251,209,40,213,112,463,1},
+{1,253,271,229,77,492,431,31,364,359,488,85,174,166,509,159,420,144,209,412,480,270,460,413,201,222,233,236,63,350,433,90,475},
+{1,328,290,475,476,23,343,59,6,367,465,218,211,57,334,77,10,262,196,366,373,75,357,215,30,445,332,261,296,221,280,377,34},
+{1,26,162,253,411,475,38,398,306,345,379,193,183,20,228,302,469,96,93,380,226,256,51,359,77,428,136,303,472,49,381,239,337},
+{1,493,85,311,28,58,409,424,168,332,109,323,481,421,201,511,114,261,352,198,115,148,45,314,125,137,390,494,41,47,215,40,446},
+{1,38,219,234,376,81,65,369,218,249,125,36,253,49,402,297,16,304,427,35,132,89,217,204,419,187,313,288,155,392,167,221,128},
+{1,150,315,90,189,434,277,436,175,34,65,485,76,1,75,496,45,307,217,487,218,314,17,333,415,38,365,328,248,379,500,257,414},
+{1,150,484,22,224,455,138,319,186,36,365,500,332,510,375,149,313,256,253,343,212,496,96,195,347,341,66,20,118,35,156,479,381},
+{1,269,71,50,107,260,123,113,186,481,283,220,58,429,24,179,477,344,13,223,205,181,51,401,91,98,312,56,160,95,129,438,92},
+{1,114,132,367,279,41,211,20,117,43,161,144,282,316,136,67,270,329,163,226,414,83,415,106,477,349,214,201,319,195,133,342,341},
+{1,100,98,206,104,314,386,479,74,312,486,445,132,336,220,63,347,282,484,473,230,414,180,261,217,197,430,225,256,35,48,85,5},
+{1,100,118,39,244,491,149,359,101,68,28,365,401,490,167,348,508,62,355,173,168,82,133,338,192,380,406,372,6,172,154,105,284},
+{1,112,194,202,266,285,298,35,374,255,115,138,105,421,146,310,412,203,306,380,335,166,119,106,493,49,409,19,215,141,193,130,425},
+{1,66,491,276,341,221,326,397,318,346,306,214,45,232,405,261,71,334,133,212,111,259,129,80,154,8,264,490,309,49,87,125,114},
+{1,111,276,340,112,511,487,18,38,35,338,193,498,298,130,278,315,356,171,407,493,449,49,372,226,160,491,368,60,441,114,400,243},
+{1,422,304,10,328,189,34,293,370,170,252,503,313,55,93,144,235,297,491,124,192,49,396,251,245,458,44,26,148,156,114,511,471},
+{1,356,35,250,239,330,417,362,141,19,320,142,453,214,9,249,313,220,294,86,354,198,159,481,123,310,192,122,388,373,7,87,464},
+{1,72,205,236,409,436,369,189,351,20,415,364,38,393,187,391,323,171,136,437,341,380,297,383,325,115,479,129,177,239,501,184,491},
+{1,47,220,397,374,155,75,292,449,409,80,373,270,249,450,12,226,403,195,386,1,442,110,363,187,480,392,146,333,353,40,279,135},
+{1,319,362,315,117,142,354,100,126,449,182,317,85,81,334,251,492,262,26,447,375,395,360,4,287,437,279,234,284,421,200,252,227},
+{1,342,395,161,195,148,154,238,482,494,204,75,230,263,276,291,44,477,4,455,125,322,390,296,308,476,175,183,408,150,460,357,323},
+{1,366,372,11,470,425,404,191,181,468,199,224,180,355,125,339,95,1,183,186,435,235,354,202,489,492,234,469,112,90,263,392,287},
+{1,418,16,220,128,6,405,48,356,384,10,460,80,223,499,30,295,240,353,358,34,26,272,208,217,102,46,67,368,363,170,114,197},
+{1,258,300,6,121,11,10,139,29,30,413,39,34,472,105,102,279,187,170,70,461,510,202,296,381,350,7,248,157,9,264,423,27},
+{1,444,387,373,366,391,392,493,232,209,358,125,142,182,479,455,76,195,171,119,200,51,497,414,221,97,504,186,216,66,120,173,310},
+{1,78,264,319,68,126,134,278,298,256,7,245,19,406,238,189,457,62,100,15,461,162,507,510,325,94,247,93,158,465,249,439,184},
+{1,484,349,53,470,500,249,186,126,448,477,48,333,401,345,92,205,414,244,243,396,180,289,17,342,497,98,223,478,294,366,110,100},
+{1,378,395,228,328,297,401,370,188,418,365,214,490,92,427,231,143,445,263,158,219,289,166,52,153,93,278,504,253,281,73,396,98},
+{1,352,76,69,446,168,66,279,90,371,179,502,404,356,309,221,308,109,274,403,461,455,492,144,449,501,68,270,142,444,456,14,338},
+{1,234,248,204,122,344,309,504,503,211,384,69,286,180,456,149,1,117,124,102,61,172,377,252,280,394,192,449,143,90,228,425,483},
+{1,30,170,400,202,123,370,297,443,323,54,306,290,466,223,184,382,365,396,126,321,40,408,178,280,164,458,87,214,207,72,115,266},
+{1,210,345,101,107,408,141,438,167,56,86,3,187,19,433,440,340,301,365,274,36,125,484,256,508,143,356,510,93,61,411,54,421},
+{1,15,448,479,103,236,295,294,203,43,302,247,129,504,363,228,283,396,29,439,331,20,102,257,455,35,274,93,87,100,270,7,508},
+{1,498,209,22,315,73,138,410,330,421,282,344,163,241,510,150,297,335,353,316,383,125,427,175,182,193,226,1,249,388,11,369,456},
+{1,445,279,290,510,95,356,256,174,172,273,6,292,218,133,481,225,79,227,498,500,208,10,143,366,399,448,291,209,293,501,511,368},
+{1,267,356,18,293,475,130,123,167,169,74,420,474,499,201,174,463,339,485,19,84,361,139,285,446,232,387,3,122,470,27,67,194},
+{1,46,465,9,175,423,477,237,68,401,452,306,135,4,92,89,18,350,181,65,474,136,217,115,415,270,8,184,178,36,327,362,130},
+};
+
+static const uint16_t prescr_table_32_21701[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,2,1,3,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2,3,1,2},
+{1,2,4,3,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7},
+{1,4,7,6,2,5,7,3,6,1,2,4,5,7,3,6,1,2,4,5,7,3,6,1,2,4,5,7,3,6,1,2,4},
+{1,9,13,15,14,7,5,12,3,4,1,13,14,10,11,6,8,2,9,15,7,5,12,3,4,1,13,14,10,11,6,8,2},
+{1,12,6,3,13,10,14,15,9,4,1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,5,7,11,8,2},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,31,18,29,9,28,11,17,30,20,24,16,3,2,31,9,14,23,26,15,10,12,8,19,1,29,22,7,25,13,21,5,6},
+{1,15,7,4,21,28,8,21,14,4,30,7,2,15,23,1,19,31,20,29,27,10,26,25,5,13,24,22,18,12,11,9,6},
+{1,18,13,7,15,12,29,23,19,24,21,1,9,31,5,2,18,17,10,4,11,13,20,8,22,26,7,16,3,27,14,15,6},
+{1,29,2,13,4,26,4,13,2,29,1,21,27,17,22,19,11,18,30,9,15,31,28,20,14,10,7,5,24,25,12,23,6},
+{1,7,21,29,30,23,20,13,12,18,4,14,21,19,26,24,31,8,28,17,29,15,11,5,16,3,25,1,30,22,10,27,6},
+{1,22,8,3,7,24,28,13,5,26,10,9,20,18,21,25,23,15,19,30,27,1,11,2,22,4,17,8,31,16,3,29,6},
+{1,11,6,58,20,26,60,23,34,61,51,2,11,3,47,35,25,19,52,59,46,7,57,37,4,22,6,29,5,50,38,43,53},
+{1,25,44,59,27,30,21,9,5,26,39,37,60,42,18,10,52,7,3,49,29,36,20,33,14,6,43,58,1,40,11,28,12},
+{1,38,56,15,48,52,1,19,14,11,3,53,18,29,5,8,54,39,15,24,13,62,17,40,23,21,51,47,57,63,2,38,28},
+{1,46,62,6,9,50,10,32,56,42,24,18,50,10,32,56,42,24,18,50,10,32,56,42,24,18,50,10,32,56,42,24,18},
+{1,51,29,25,23,2,51,62,30,38,12,9,39,37,22,40,54,16,28,21,50,23,1,41,31,15,19,6,52,35,34,11,20},
+{1,3,5,15,17,51,25,38,53,28,18,27,37,4,6,5,52,46,57,22,29,32,48,40,60,34,51,25,38,53,28,18,27},
+{1,18,7,19,21,20,3,27,25,11,62,23,24,2,18,53,41,15,26,16,39,28,38,21,10,55,59,58,51,31,61,12,1},
+{1,26,29,40,8,54,7,35,8,27,58,40,4,52,29,20,2,26,55,10,1,13,34,5,57,63,17,59,37,38,49,36,43},
+{1,23,43,29,34,45,13,54,37,36,21,56,53,3,38,2,23,47,26,25,63,61,42,5,31,6,57,4,46,43,52,50,11},
+{1,63,75,93,37,49,90,76,112,117,85,44,120,10,64,113,43,103,23,98,55,27,99,105,41,88,115,20,3,97,86,77,46},
+{1,63,15,87,85,43,94,64,23,121,21,70,86,53,9,46,123,42,5,37,106,18,92,127,84,10,74,93,36,49,119,33,20},
+{1,86,123,100,82,61,75,55,91,52,38,115,116,42,22,118,124,108,111,18,85,7,94,60,96,10,16,3,125,71,82,89,98},
+{1,121,30,117,118,108,39,16,63,120,123,118,54,91,8,87,60,117,59,27,101,4,99,30,114,85,69,122,2,121,15,57,98},
+{1,11,69,14,98,101,42,10,39,123,67,26,127,85,95,120,3,64,90,37,112,47,87,84,20,78,107,27,52,99,55,35,109},
+{1,12,80,18,127,63,37,121,88,57,49,1,6,20,120,94,45,73,95,43,93,39,117,112,110,42,91,51,13,46,67,99,4},
+{1,54,76,81,104,64,98,101,36,93,43,111,97,72,17,86,117,105,59,34,7,65,121,118,68,14,41,89,71,35,28,82,25},
+{1,90,58,56,53,65,68,100,12,23,78,36,101,33,69,73,94,16,52,81,112,53,124,34,50,6,87,39,18,110,76,126,120},
+{1,116,12,51,80,42,33,126,99,61,26,71,46,118,114,37,41,111,123,14,50,18,86,54,69,90,112,81,47,76,113,107,44},
+{1,79,42,93,11,47,86,18,112,124,92,34,49,6,16,63,105,123,11,119,43,9,56,62,46,17,120,3,8,127,84,93,101},
+{1,90,118,23,15,122,36,96,33,50,47,34,69,108,107,99,86,113,102,4,127,118,110,49,88,97,12,74,81,121,83,35,104},
+{1,124,57,116,70,26,85,48,82,89,77,25,23,22,40,123,28,2,124,117,29,60,47,18,3,66,38,122,34,81,27,107,99},
+{1,70,51,69,44,16,27,25,95,44,8,103,102,69,22,4,89,51,72,11,2,70,115,36,111,1,35,83,18,93,106,123,67},
+{1,115,56,36,54,45,86,76,53,92,57,89,113,111,21,68,51,44,29,66,67,8,6,112,36,27,50,103,19,52,23,55,47},
+{1,91,55,127,15,10,6,2,91,108,36,28,81,106,38,71,61,78,58,22,87,104,125,43,25,82,107,124,113,47,64,101,35},
+{1,48,95,19,101,78,11,25,75,115,21,26,99,119,117,69,18,82,56,102,15,121,20,2,48,87,64,106,94,105,118,109,22},
+{1,81,102,127,14,69,43,50,113,94,57,46,52,117,11,95,106,76,37,107,31,71,122,1,83,98,17,30,20,24,16,77,118},
+{1,17,6,102,20,83,60,4,34,6,51,5,84,121,126,59,65,88,31,116,110,78,89,105,11,35,112,76,72,106,108,95,90},
+{1,141,203,232,116,58,131,102,148,37,194,189,228,57,197,250,179,106,151,99,94,154,171,108,27,64,16,4,1,203,116,29,204},
+{1,142,71,173,216,108,27,207,250,176,44,11,203,251,247,244,61,72,18,138,172,43,195,249,121,89,81,83,221,112,28,7,200},
+{1,149,223,250,125,171,96,24,6,148,37,214,160,40,10,151,111,81,203,120,30,146,177,243,118,136,34,157,248,62,154,179,102},
+{1,150,75,179,207,241,119,192,48,12,3,221,124,31,218,160,40,10,148,37,66,134,183,240,60,15,222,161,99,197,122,136,34},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,166,83,143,225,214,147,209,103,236,59,251,203,199,196,49,95,226,158,129,115,233,105,73,65,67,229,106,188,47,254,153,117},
+{1,175,248,124,62,31,80,20,5,249,198,158,136,34,167,126,176,44,11,85,237,195,103,78,188,47,92,23,82,187,121,230,150},
+{1,177,233,197,211,216,54,188,47,83,76,19,92,23,93,254,142,146,149,204,51,84,21,236,59,86,164,41,227,96,24,6,176},
+{1,178,89,158,79,149,124,31,236,59,229,96,24,6,179,199,218,132,33,81,77,74,160,40,10,176,44,11,233,99,243,215,222},
+{1,180,90,45,162,81,78,167,199,223,217,108,27,232,58,186,154,146,144,36,9,88,22,177,118,169,112,28,7,239,213,111,245},
+{1,184,92,46,23,179,200,50,180,45,87,241,96,24,6,185,114,164,41,86,173,119,249,98,160,40,10,186,150,157,123,250,134},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,195,162,81,235,182,238,248,62,204,51,109,185,140,35,105,184,46,200,50,207,82,215,84,21,167,72,18,199,80,20,5,163},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,198,99,247,189,152,38,207,150,227,157,68,17,103,188,47,174,237,88,22,195,149,70,215,144,36,9,97,123,187,139,135,132},
+{1,207,168,84,42,21,173,131,71,118,210,251,89,190,224,56,14,204,51,107,125,183,74,221,159,64,16,4,1,168,42,197,153},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,212,106,53,206,103,167,151,155,152,38,221,93,125,117,119,163,150,241,86,193,90,194,228,57,100,25,108,27,184,46,223,137},
+{1,216,108,54,27,213,89,122,198,233,86,205,95,163,156,39,189,67,164,41,102,193,92,23,177,64,16,4,1,108,27,178,244},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,225,145,169,181,187,94,246,220,55,125,142,194,209,165,184,46,234,219,70,240,60,15,115,108,27,118,252,63,127,111,107,106},
+{1,231,148,74,37,245,169,190,200,50,235,73,134,198,214,210,211,71,98,255,76,19,119,110,252,63,124,31,116,29,147,87,102},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,243,138,69,209,155,95,110,232,58,253,181,167,80,20,5,139,91,111,98,235,67,105,144,36,9,136,34,251,71,104,26,245},
+{1,249,133,187,164,82,237,190,214,204,51,112,28,7,125,154,223,75,110,226,193,181,168,42,243,64,16,4,1,133,164,41,143},
+{1,250,125,196,98,49,113,97,101,100,25,123,153,91,145,89,107,157,90,236,59,137,95,144,36,9,127,152,38,243,187,169,87},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,156,304,133,134,290,313,382,271,496,493,14,471,459,102,499,319,218,167,275,93,120,194,50,438,466,189,282,96,87,151,57,279},
+{1,504,287,73,401,97,364,15,310,380,440,360,494,41,80,344,294,203,486,506,127,273,230,87,445,117,314,334,136,13,206,251,302},
+{1,221,286,377,159,21,14,4,442,286,439,162,462,132,267,441,166,116,410,188,283,360,240,145,261,445,284,362,45,30,213,492,507},
+{1,478,301,48,445,53,155,363,190,321,343,415,427,479,372,460,244,277,158,35,83,351,202,490,495,167,74,84,457,444,504,128,446},
+{1,176,288,150,458,70,187,153,396,152,468,208,94,408,58,54,439,246,43,428,317,80,169,491,478,129,175,59,110,511,380,355,456},
+{1,11,69,202,377,247,107,228,299,94,265,229,56,196,411,91,12,58,207,175,383,368,82,307,42,151,443,235,9,319,16,88,276},
+{1,135,32,376,102,154,53,182,424,470,490,41,457,328,209,191,221,414,189,90,398,227,218,333,133,151,78,222,67,165,43,334,344},
+{1,67,22,300,276,173,251,289,4,134,22,150,69,206,86,474,293,130,144,128,211,139,152,396,255,423,18,16,83,88,19,276,371},
+{1,480,74,476,213,203,212,441,340,231,312,366,509,168,191,185,192,175,54,488,334,227,161,292,275,11,123,399,188,425,475,463,217},
+{1,204,52,54,430,454,213,402,407,105,80,218,463,476,503,304,239,434,149,457,136,473,9,265,101,167,134,482,79,6,340,46,313},
+{1,317,204,168,227,56,186,2,317,102,42,507,305,71,382,263,481,78,236,172,348,194,328,161,209,421,417,446,370,294,181,178,60},
+{1,173,213,135,102,370,277,206,479,75,321,125,17,216,402,253,183,148,70,420,429,18,279,99,129,452,227,39,392,311,382,146,433},
+{1,286,307,41,444,391,376,506,343,105,304,178,278,264,431,297,471,474,416,77,404,421,145,112,85,126,446,234,274,347,156,10,440},
+{1,59,427,412,259,192,124,380,1,294,247,264,401,6,77,69,169,392,20,430,414,385,478,120,266,426,488,42,272,165,274,158,252},
+{1,284,97,226,366,399,220,37,158,403,263,258,457,303,477,126,56,459,51,211,376,436,133,415,456,417,346,253,254,364,229,352,42},
+{1,132,454,256,37,421,299,475,115,133,161,370,406,24,441,410,391,372,26,317,377,455,194,217,422,493,10,19,488,320,231,328,112},
+{1,234,347,321,420,19,112,24,466,101,342,374,168,36,10,471,452,436,428,126,27,333,59,147,183,189,362,174,282,182,200,211,414},
+{1,260,284,123,92,262,394,378,179,418,482,15,53,372,4,145,284,369,23,458,151,137,227,146,154,440,281,354,332,65,367,125,443},
+{1,142,300,426,432,341,110,88,51,304,100,77,94,417,138,394,23,227,7,469,497,34,65,473,118,501,318,365,268,26,291,411,358},
+{1,407,338,409,169,414,131,456,447,57,202,257,176,294,22,479,505,198,313,483,289,403,290,413,141,103,69,241,92,280,345,35,301},
+{1,32,350,304,445,59,287,470,11,176,444,346,216,205,413,485,404,373,135,99,449,379,103,385,37,255,18,288,137,131,35,159,483},
+{1,361,412,113,218,54,263,286,431,494,392,146,344,298,449,62,461,145,478,387,222,126,68,492,225,92,178,199,207,5,394,507,406},
+{1,416,230,99,265,52,424,308,37,331,374,329,214,314,319,18,403,342,303,33,182,400,38,59,98,266,362,448,217,240,257,349,280},
+{1,113,438,172,198,229,122,49,89,350,85,120,64,130,373,254,471,458,244,98,178,115,170,240,128,260,37,508,353,347,488,196,356},
+{1,100,73,251,442,170,425,498,370,28,169,511,24,97,438,269,359,279,354,493,397,9,418,52,10,500,478,281,94,122,385,337,377},
+{1,144,185,113,334,150,129,79,13,499,62,170,187,453,15,355,271,365,36,407,199,145,377,50,273,368,225,406,143,356,247,272,312},
+{1,208,414,235,473,29,482,45,438,369,313,495,80,252,273,401,418,334,448,310,322,469,353,166,136,390,293,101,352,206,405,2,208},
+{1,122,117,58,32,342,91,464,128,85,182,345,256,170,364,75,249,340,33,150,498,81,66,300,285,162,132,161,195,324,264,322,390},
+{1,169,125,420,349,239,361,120,84,53,91,447,445,276,170,195,264,22,432,55,242,1,468,223,436,357,143,211,323,482,505,362,261},
+{1,449,236,362,294,385,31,76,474,171,229,254,35,277,267,46,463,4,145,236,181,448,287,488,384,374,119,186,219,102,132,67,193},
+{1,271,498,429,377,73,381,165,198,132,248,419,49,301,197,134,503,346,159,234,447,298,460,123,82,367,185,477,101,70,375,169,206},
+{1,59,100,17,148,26,271,362,383,323,174,429,93,398,347,410,245,110,336,223,22,405,454,233,300,108,363,237,346,8,236,200,17},
+{1,322,74,491,181,508,341,187,118,448,497,62,486,160,290,474,4,423,74,356,372,430,134,115,198,56,259,207,244,20,381,354,401},
+{1,436,463,506,454,298,194,241,258,393,467,370,471,299,24,470,497,319,293,327,457,272,345,498,81,381,82,19,10,262,464,28,399},
+{1,383,391,122,23,500,56,44,139,358,431,371,42,49,447,17,64,197,424,235,92,211,112,88,278,503,101,477,84,98,69,34,128},
+{1,396,329,404,460,223,416,50,265,1,198,128,406,362,65,13,53,18,200,511,4,81,329,202,115,260,52,212,72,105,366,16,324},
+{1,301,198,3,56,330,421,18,168,52,213,63,428,70,178,505,365,233,399,31,489,232,190,393,39,332,413,183,477,61,129,37,97},
+{1,179,269,454,371,143,325,160,25,22,416,511,488,444,379,125,78,406,181,254,506,378,393,374,376,314,93,164,383,283,323,373,63},
+{1,161,154,329,124,302,166,78,459,100,473,110,157,279,350,150,435,433,272,349,471,104,382,448,192,310,488,115,369,38,181,420,281},
+{1,287,30,431,340,291,416,27,269,505,198,283,346,175,253,452,83,3,37,445,348,229,236,23,409,475,11,484,385,243,79,126,127},
+{1,7,21,107,273,429,250,371,503,57,481,8,28,42,107,318,176,392,305,272,213,163,2,7,444,375,505,44,98,151,68,238,325},
+{1,362,361,420,364,243,26,301,157,502,78,280,257,499,348,334,94,354,304,456,48,142,83,77,199,307,23,2,362,269,105,404,56},
+{1,337,216,106,301,134,288,76,462,276,112,311,93,339,317,457,143,242,458,201,168,258,374,412,281,127,105,367,452,128,428,248,94},
+{1,470,497,329,363,87,165,37,394,240,342,149,457,216,76,366,299,252,301,259,486,214,481,450,439,396,271,413,320,462,460,26,288},
+{1,440,299,164,28,363,414,243,42,160,241,402,498,216,86,248,176,130,431,186,196,292,55,270,151,511,261,13,477,91,293,235,423},
+{1,133,165,40,70,421,385,285,115,199,394,447,122,224,1,402,193,5,152,100,17,345,500,85,222,358,257,7,29,486,27,105,316},
+{1,45,142,165,197,241,501,140,421,155,374,38,274,102,109,312,410,409,120,454,352,313,86,96,26,497,214,299,275,426,404,346,429},
+{1,97,95,439,448,443,422,445,261,17,349,89,420,476,246,334,357,14,295,274,495,168,421,48,467,61,377,505,186,373,191,91,453},
+{1,277,434,472,311,183,15,396,71,377,437,381,88,207,180,115,218,10,264,122,430,294,235,301,138,216,287,465,12,496,273,308,452},
+{1,457,282,378,230,469,258,363,22,244,418,57,468,3,200,302,131,153,134,449,63,68,404,462,28,399,208,248,329,220,19,428,283},
+{1,184,48,293,343,323,416,32,227,384,195,355,323,416,32,227,384,195,355,323,416,32,227,384,195,355,323,416,32,227,384,195,355},
+{1,243,220,298,246,54,323,349,99,460,82,9,394,399,506,273,340,489,67,424,280,222,102,441,185,76,311,37,17,417,146,337,412},
+{1,269,50,414,367,331,502,345,69,392,299,427,48,450,344,303,104,2,269,25,395,332,82,146,40,291,500,84,92,3,103,505,162},
+{1,141,482,186,12,410,105,462,10,346,214,357,502,266,431,19,375,310,437,260,495,295,79,195,389,467,317,344,91,404,41,250,306},
+{1,97,214,490,417,313,215,305,339,157,185,441,13,130,187,472,102,268,242,501,294,213,336,312,275,240,404,333,347,281,277,83,297},
+{1,269,234,230,173,88,387,203,492,73,138,351,194,174,90,142,190,40,221,370,133,241,78,285,7,407,344,341,502,271,376,433,336},
+};
+
+static const uint16_t prescr_table_32_23209[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,2,4,3,6,7,5,1,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+{1,5,6,4,3,2,7,1,5,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5,3,1,4,7,6,2,5},
+{1,4,3,12,5,7,15,9,2,8,3,6,12,11,5,10,7,14,15,13,9,1,2,4,8,3,6,12,11,5,10,7,14},
+{1,7,12,15,6,11,3,9,13,8,5,1,15,3,8,5,1,15,3,8,5,1,15,3,8,5,1,15,3,8,5,1,15},
+{1,10,6,2,11,12,4,9,7,8,9,12,2,10,3,15,13,7,4,11,6,1,5,14,8,9,12,2,10,3,15,13,7},
+{1,9,11,25,15,24,6,19,31,28,17,20,16,2,9,23,15,12,19,29,7,13,5,4,18,11,30,24,3,31,14,26,10},
+{1,18,30,25,28,20,9,15,24,14,5,4,13,30,24,7,22,2,18,15,12,23,11,1,9,19,6,31,17,20,16,29,3},
+{1,27,18,28,13,19,7,31,15,10,6,2,27,9,7,24,8,29,11,28,17,15,5,3,1,26,19,20,12,4,25,18,14},
+{1,11,28,24,3,29,19,31,5,16,1,30,7,3,21,9,5,8,27,15,24,26,17,31,25,4,22,28,12,13,19,20,23},
+{1,26,6,17,20,16,14,22,31,2,26,3,23,31,1,13,28,22,18,29,27,14,11,9,19,16,7,24,25,20,8,30,12},
+{1,27,30,19,15,23,25,21,18,20,26,28,12,29,31,4,11,30,23,18,10,13,14,6,16,17,2,27,15,21,9,5,24},
+{1,31,26,58,11,28,59,20,6,1,46,39,54,37,41,40,6,33,23,50,27,51,53,20,3,49,42,25,44,56,59,10,32},
+{1,1,1,1,1,1,1,1,1,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,1,36,18,9,32,16},
+{1,9,22,8,31,30,23,1,9,22,4,18,22,4,18,22,4,18,22,4,18,22,4,18,22,4,18,22,4,18,22,4,18},
+{1,16,55,41,19,7,43,51,50,34,39,15,35,47,20,22,6,48,1,8,27,53,41,36,23,14,43,52,33,63,34,39,15},
+{1,59,60,62,41,48,45,30,31,36,12,57,37,33,54,10,21,7,1,45,15,47,52,49,11,56,8,46,25,62,36,12,57},
+{1,19,48,15,47,37,50,41,40,59,54,1,58,12,13,55,59,54,1,58,12,13,55,59,54,1,58,12,13,55,59,54,1},
+{1,26,42,22,37,55,23,63,29,1,13,60,47,50,4,52,42,11,18,16,10,31,44,37,45,40,17,7,35,3,23,41,28},
+{1,7,21,24,59,52,25,60,33,1,58,32,3,61,19,5,52,53,15,47,44,17,2,7,51,6,9,38,10,27,25,30,45},
+{1,8,53,9,61,60,52,1,8,53,62,18,61,30,13,52,58,2,8,32,31,9,36,15,60,26,29,1,4,16,53,62,18},
+{1,40,88,117,38,109,111,63,12,101,85,28,53,13,103,125,48,73,41,56,106,26,77,121,96,17,82,112,87,52,25,113,67},
+{1,62,14,102,84,64,110,63,48,104,25,5,99,73,89,50,10,79,27,59,100,20,23,54,118,65,40,46,108,101,11,80,92},
+{1,121,86,71,123,43,100,122,82,50,89,110,49,91,23,26,105,78,116,88,21,99,66,124,45,54,36,56,85,102,68,120,80},
+{1,87,83,45,67,102,72,99,97,94,124,96,76,70,111,57,59,108,13,34,28,44,10,41,86,2,87,97,47,62,48,38,35},
+{1,20,42,124,49,7,108,75,78,10,68,65,99,13,114,58,3,30,81,94,56,23,11,78,5,34,110,127,72,57,29,79,15},
+{1,64,49,125,57,70,88,124,121,119,65,107,19,91,94,89,30,18,123,40,56,3,96,61,4,39,49,109,116,33,86,23,124},
+{1,86,122,24,36,126,22,49,30,45,26,68,119,46,103,50,114,2,86,61,6,81,71,10,88,98,30,67,13,34,110,23,102},
+{1,22,102,24,27,33,50,26,55,84,1,11,69,3,29,118,5,39,35,15,105,101,17,2,22,51,6,58,85,10,78,70,30},
+{1,76,11,72,69,100,27,14,74,98,57,13,79,48,101,116,113,112,86,123,114,26,33,96,117,87,93,95,19,73,91,52,66},
+{1,90,120,22,51,89,87,95,9,12,94,73,29,37,53,99,1,45,30,82,23,84,56,16,86,98,44,51,76,69,67,108,40},
+{1,72,47,80,124,63,50,54,75,60,117,35,14,110,3,108,75,30,95,116,7,55,100,54,64,15,74,58,102,126,50,27,32},
+{1,104,92,114,75,7,109,50,43,87,99,116,39,71,111,113,16,12,5,55,75,106,70,91,102,67,108,45,41,42,118,79,105},
+{1,92,8,30,64,37,43,87,39,70,73,89,71,103,91,27,99,54,19,108,38,13,76,26,77,52,79,104,75,5,67,10,83},
+{1,81,101,65,3,22,74,38,5,58,111,104,36,33,60,121,77,95,61,35,109,57,100,8,107,47,65,115,119,48,85,7,76},
+{1,61,75,31,6,97,100,66,20,119,67,99,15,53,73,69,36,22,113,4,122,75,120,118,42,74,17,95,52,32,108,58,124},
+{1,123,57,47,30,45,25,95,71,99,118,40,54,88,98,51,26,105,3,62,86,16,28,21,94,30,110,58,81,41,115,106,61},
+{1,77,47,38,49,127,112,39,124,80,43,126,101,2,77,108,114,37,115,120,69,65,44,3,16,90,75,76,49,68,28,26,58},
+{1,6,20,120,23,114,43,7,18,108,73,38,106,67,56,72,37,111,76,41,123,112,109,74,35,101,82,11,29,39,105,70,55},
+{1,235,24,43,91,197,41,150,245,127,16,25,96,86,91,239,193,84,176,227,141,124,3,19,10,106,60,103,136,73,29,173,78},
+{1,19,24,181,93,94,107,67,129,102,66,73,145,171,65,221,155,244,125,2,19,12,106,40,97,240,91,26,199,92,168,213,215},
+{1,63,210,85,44,30,220,4,252,53,170,44,15,55,149,69,197,167,36,243,184,192,83,87,41,251,68,79,6,65,187,117,155},
+{1,227,73,14,203,137,84,86,189,47,143,34,120,160,173,90,216,13,247,130,213,250,117,87,47,143,34,120,160,173,90,216,13},
+{1,155,91,9,167,241,65,66,214,59,16,60,85,18,167,228,94,70,100,135,156,244,98,19,118,32,120,170,36,119,241,188,140},
+{1,175,19,135,58,1,175,19,135,58,159,100,186,132,122,13,107,126,108,120,162,253,16,187,76,49,58,159,100,186,132,122,13},
+{1,77,248,6,227,138,20,208,235,120,61,56,34,228,18,191,75,171,35,100,44,74,43,29,145,76,252,153,53,65,159,226,197},
+{1,77,221,116,12,189,224,206,80,222,254,13,120,247,239,82,34,190,180,146,182,223,119,194,217,160,222,254,13,120,247,239,82},
+{1,18,103,151,227,1,18,103,151,227,177,181,145,246,12,108,169,109,160,44,47,52,247,5,45,38,117,120,29,245,23,175,91},
+{1,141,152,188,236,130,13,234,3,242,212,113,148,223,246,171,233,202,228,191,15,248,167,104,7,6,242,212,113,148,223,246,171},
+{1,120,107,21,7,1,120,107,21,7,180,30,122,249,222,156,97,79,184,103,199,82,134,235,221,216,20,139,174,148,232,153,173},
+{1,101,146,245,173,13,59,29,60,87,144,167,62,246,1,138,156,136,249,193,152,66,107,3,239,213,233,122,50,217,198,189,5},
+{1,141,46,225,255,122,151,113,180,4,109,46,203,98,233,30,249,221,65,104,190,85,198,40,43,91,252,77,223,204,127,96,100},
+{1,166,221,47,222,190,194,207,219,118,115,23,30,35,54,142,126,29,214,49,76,164,117,134,16,220,249,94,222,95,141,139,26},
+{1,203,226,250,54,44,241,168,6,51,161,135,213,205,171,110,231,202,215,6,218,147,128,169,165,150,55,176,101,168,3,109,138},
+{1,51,63,224,111,94,7,153,189,61,67,163,81,131,119,240,225,46,191,232,62,172,20,117,195,59,22,70,25,3,239,183,36},
+{1,244,73,37,90,134,178,46,210,130,60,132,173,47,19,151,58,21,6,145,171,190,184,41,130,60,132,173,47,19,151,58,21},
+{1,10,68,9,90,197,65,43,145,232,118,49,245,31,99,112,47,147,126,25,125,22,78,233,115,32,160,129,36,180,197,239,109},
+{1,38,125,240,156,207,209,19,239,120,39,252,154,220,31,114,153,233,86,80,58,168,236,9,139,92,238,47,100,96,44,81,41},
+{1,7,21,107,184,122,207,150,176,66,231,39,174,12,18,63,138,114,175,219,125,109,85,1,215,111,82,223,115,120,180,47,178},
+{1,28,225,97,139,46,74,173,132,154,249,120,3,18,252,78,182,192,151,191,190,176,228,222,35,99,129,123,17,238,178,248,118},
+{1,209,58,214,202,112,47,193,194,12,33,78,189,137,18,173,245,250,188,63,194,6,206,39,128,154,9,136,164,125,94,193,97},
+{1,200,90,243,234,112,86,218,212,174,18,71,134,105,102,63,11,10,110,153,191,249,27,133,197,188,85,193,239,15,89,52,1},
+{1,185,214,66,248,42,221,227,14,173,115,231,186,105,78,116,88,213,35,135,250,172,200,53,38,129,254,17,30,20,24,16,165},
+{1,38,230,74,207,185,34,126,124,48,254,90,107,134,14,242,142,150,233,196,26,89,94,39,96,43,180,214,219,28,51,203,251},
+{1,174,245,221,239,249,97,93,118,107,177,80,50,11,38,233,189,14,240,86,29,106,230,26,18,205,250,39,190,247,46,54,138},
+{1,136,213,242,204,76,139,170,106,61,140,110,26,147,78,62,64,72,65,12,254,152,139,85,233,177,226,116,137,221,112,126,8},
+{1,232,119,9,100,41,65,162,146,92,204,10,174,44,142,199,208,227,24,202,193,27,86,98,38,32,235,94,36,200,41,217,209},
+{1,208,7,47,21,205,107,124,228,129,171,102,169,182,80,58,108,211,65,243,246,203,74,225,135,46,152,200,242,158,77,12,255},
+{1,69,73,135,25,32,140,245,184,210,11,118,38,137,210,11,118,38,137,210,11,118,38,137,210,11,118,38,137,210,11,118,38},
+{1,96,30,70,340,449,12,131,136,299,509,64,10,480,51,342,385,12,320,34,101,255,8,384,60,70,170,497,256,40,389,204,350},
+{1,183,262,362,208,255,42,175,441,502,231,322,384,474,97,45,469,38,252,497,109,398,206,505,160,403,420,401,275,274,65,264,417},
+{1,230,117,370,391,221,89,510,297,437,143,194,248,157,301,29,313,216,152,146,507,32,5,447,486,281,221,295,372,226,253,290,203},
+{1,317,189,417,28,85,150,324,336,129,489,241,323,103,481,51,57,454,495,429,173,89,232,406,86,229,166,53,357,40,465,164,264},
+{1,166,52,502,338,42,436,299,388,100,3,245,23,203,243,509,229,357,27,318,175,240,264,242,430,232,195,74,405,275,460,257,24},
+{1,14,84,373,120,253,444,220,114,145,474,348,227,132,433,77,483,499,387,211,20,108,260,363,102,306,489,453,257,368,39,245,230},
+{1,402,485,49,270,37,359,181,128,403,290,117,376,296,506,362,128,464,145,291,188,148,253,181,64,232,337,392,94,74,359,323,32},
+{1,328,355,477,432,119,62,69,234,458,200,424,399,189,255,445,215,14,37,122,470,130,348,104,441,12,365,494,22,180,493,506,490},
+{1,278,352,154,87,343,345,18,388,227,248,91,280,313,67,38,146,493,374,250,333,424,51,440,487,138,211,221,340,29,448,147,358},
+{1,377,11,319,69,410,184,483,182,255,106,6,468,289,360,82,97,438,125,170,76,4,173,11,432,425,395,292,86,204,445,461,259},
+{1,38,222,477,487,148,181,153,315,261,119,326,72,146,258,14,242,269,239,250,405,339,295,84,374,381,464,262,66,44,209,317,474},
+{1,133,71,153,308,374,279,376,154,187,491,47,368,48,270,333,319,309,461,84,113,505,80,379,446,296,310,62,252,147,98,240,484},
+{1,38,202,312,465,157,505,435,243,63,478,408,492,129,47,238,223,499,336,342,316,403,321,117,382,427,230,71,103,104,137,183,378},
+{1,87,218,220,302,389,314,327,183,178,487,31,122,273,29,45,380,42,149,400,492,4,174,218,110,368,472,507,290,11,27,212,459},
+{1,386,486,239,153,168,489,389,402,423,266,376,295,14,116,164,60,169,267,441,96,195,197,62,299,504,35,258,503,150,225,262,142},
+{1,288,479,297,356,284,414,324,249,447,387,224,281,152,344,493,221,234,439,13,473,48,42,287,383,299,402,491,314,153,456,315,9},
+{1,107,237,302,334,211,29,261,181,250,152,375,306,16,461,289,201,334,291,162,114,34,356,491,147,463,330,501,79,229,315,195,137},
+{1,451,176,39,113,472,295,33,457,225,438,427,240,341,478,259,70,214,396,388,291,67,100,272,358,251,412,202,378,13,21,508,197},
+{1,448,384,26,478,187,324,242,212,479,492,49,29,236,422,473,271,369,327,345,149,403,231,99,218,440,21,9,5,451,480,503,62},
+{1,455,48,286,74,35,155,447,38,431,501,336,77,30,505,136,29,399,156,208,383,138,474,407,393,112,248,229,362,502,294,89,211},
+{1,298,469,294,352,201,389,427,439,299,296,151,163,306,264,190,489,244,359,119,124,53,260,435,313,321,399,350,126,287,185,173,277},
+{1,2,4,8,16,32,64,128,256,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183,183},
+{1,334,431,287,179,195,60,355,138,172,49,299,170,350,269,205,307,108,454,145,377,461,314,137,447,341,166,317,321,3,489,19,365},
+{1,141,363,44,388,454,462,56,92,316,479,203,204,122,42,341,431,151,82,498,296,307,402,130,415,66,4,282,363,22,97,139,69},
+{1,429,449,59,456,201,231,298,393,216,506,401,244,473,493,342,14,481,282,156,175,396,89,504,60,380,11,468,31,256,425,3,19},
+{1,508,355,122,399,42,327,441,101,88,249,207,389,372,294,190,432,316,229,75,193,455,470,18,198,486,391,136,250,461,183,467,463},
+{1,87,418,33,355,465,491,166,508,409,487,417,108,92,139,199,1,337,274,288,416,317,334,427,359,316,31,185,71,156,290,503,492},
+{1,165,22,147,276,446,240,177,463,427,198,421,324,404,260,5,100,367,454,234,310,462,135,282,349,13,9,323,341,96,37,464,479},
+{1,240,51,287,6,289,170,64,20,196,510,96,15,425,128,20,98,255,48,391,340,64,10,49,511,24,323,170,32,5,408,383,12},
+{1,52,37,66,292,115,485,128,395,114,353,356,278,119,275,5,114,353,356,278,119,275,5,114,353,356,278,119,275,5,114,353,356},
+{1,85,210,276,481,384,183,375,124,484,458,14,427,287,475,19,72,394,208,223,212,117,6,255,187,207,361,40,315,286,123,429,480},
+{1,480,409,343,92,284,263,157,245,285,508,65,380,70,179,434,332,227,93,126,424,369,471,41,392,439,355,84,304,171,111,315,5},
+{1,189,211,233,275,396,306,38,442,402,4,378,211,485,140,416,302,51,229,437,278,115,498,9,24,346,457,315,11,165,162,170,381},
+{1,277,225,11,305,73,69,125,418,470,47,340,341,71,179,24,56,375,29,49,354,299,145,66,186,13,270,471,317,416,510,103,508},
+{1,511,99,254,305,432,388,236,426,304,442,183,337,58,4,197,99,127,287,54,331,96,226,101,325,208,491,326,77,145,53,470,282},
+{1,322,393,156,344,487,58,100,205,11,304,395,268,310,260,485,351,377,499,118,294,162,339,103,33,164,476,142,72,217,458,423,23},
+{1,132,486,317,175,193,454,103,114,260,433,92,252,426,52,84,419,297,265,420,231,450,156,93,190,116,270,106,44,250,38,289,86},
+{1,41,428,400,378,344,455,500,137,270,176,281,58,14,223,377,316,26,453,211,399,147,322,139,174,142,325,329,447,16,328,6,123},
+{1,103,504,115,214,122,232,167,98,3,484,130,462,459,134,256,51,271,133,228,177,193,334,98,433,242,65,231,341,67,128,425,311},
+{1,439,363,189,145,223,100,250,393,264,330,173,489,252,195,41,332,287,386,87,152,190,292,365,89,288,360,306,203,35,241,418,127},
+{1,291,466,284,378,106,304,129,149,245,332,125,172,400,118,403,114,184,416,54,72,224,91,511,226,376,278,165,396,381,282,181,151},
+{1,17,257,419,11,187,33,322,69,384,268,191,395,232,466,198,181,478,160,197,277,450,78,292,491,171,289,120,143,19,296,397,219},
+{1,139,210,262,361,431,311,181,25,415,48,276,89,234,196,199,438,84,341,57,445,118,275,62,474,326,145,104,4,278,210,131,314},
+{1,422,455,231,240,335,205,409,472,505,175,235,291,188,319,326,229,478,81,371,284,369,186,80,416,78,508,181,126,31,143,425,271},
+{1,150,294,206,77,104,429,202,410,97,141,440,291,256,415,144,297,65,207,426,404,410,503,385,220,342,128,264,72,339,487,416,213},
+{1,210,413,404,148,196,213,2,420,155,404,74,49,446,116,121,349,212,104,230,365,259,147,381,209,421,500,69,455,297,173,309,50},
+{1,211,349,258,105,199,501,367,87,153,508,39,151,112,257,142,200,287,240,69,183,33,482,89,26,472,464,297,38,292,202,460,388},
+{1,70,129,469,492,478,175,158,293,151,117,219,183,222,24,145,191,454,282,324,73,109,74,8,280,258,469,246,427,336,332,337,367},
+{1,482,275,121,422,373,44,58,39,471,396,165,138,388,163,363,509,112,36,27,281,59,257,49,229,186,400,172,125,208,92,57,227},
+{1,60,269,412,499,157,383,469,3,68,110,169,201,212,418,67,52,403,438,475,336,430,203,232,193,36,115,479,296,163,5,102,89},
+{1,216,315,290,473,181,152,136,497,208,470,21,134,219,463,398,221,167,462,482,390,112,284,236,232,344,99,242,119,24,503,256,171},
+{1,507,500,230,417,92,461,364,332,169,86,177,156,246,438,109,399,168,321,204,415,36,315,256,62,10,445,199,309,158,269,332,446},
+{1,427,335,163,410,209,364,417,37,147,315,226,466,188,43,415,50,93,363,289,434,137,107,441,261,302,177,131,222,437,148,294,431},
+{1,103,164,204,390,208,375,335,173,112,482,415,237,183,280,152,89,10,507,282,255,11,57,307,279,111,462,379,4,206,164,102,400},
+{1,214,417,430,263,30,338,475,369,274,170,453,485,200,397,231,256,286,439,207,156,240,371,95,369,137,85,278,262,100,306,391,128},
+{1,229,248,272,425,346,443,300,39,451,280,326,91,344,453,55,450,151,376,121,1,399,62,34,345,74,9,480,462,306,112,481,65},
+};
+
+static const uint16_t prescr_table_32_44497[127][33] = {
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+{1,3,5,4,7,2,6,1,3,5,4,7,2,6,1,3,5,4,6,5,2,3,7,1,4,6,5,2,3,7,1,4,6},
+{1,7,2,3,4,6,5,1,7,2,3,4,6,5,1,7,2,3,2,7,1,5,6,4,3,2,7,1,5,6,4,3,2},
+{1,8,12,10,15,1,8,12,10,15,1,8,12,10,15,1,8,12,5,7,15,9,2,8,6,11,10,14,13,1,4,3,12},
+{1,6,13,5,7,11,8,2,12,3,10,14,15,9,4,1,6,13,14,11,4,12,13,14,11,4,12,13,14,11,4,12,13},
+{1,3,5,15,14,13,8,7,9,4,12,11,2,6,10,1,3,5,8,12,10,15,7,11,1,14,9,2,3,13,4,6,5},
+{1,23,24,27,7,10,2,11,21,19,14,20,4,22,15,3,28,13,4,11,24,31,26,8,22,21,27,17,16,9,15,19,7},
+{1,3,5,15,17,26,7,9,27,4,12,20,21,22,19,28,13,23,8,12,10,15,28,18,27,2,3,22,29,7,16,24,20},
+{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,23,28,14,7,20,10,5,21,29,25,27,26,13,17,31},
+{1,13,8,6,25,7,20,15,18,22,21,2,26,16,12,5,14,31,15,9,30,18,11,19,22,17,27,21,1,29,2,13,4},
+{1,9,12,26,29,25,6,13,19,17,3,27,20,21,28,16,10,23,7,2,9,6,27,10,22,30,1,25,3,16,5,11,15},
+{1,5,17,18,29,19,24,2,10,31,25,7,27,13,4,20,3,15,7,19,12,30,14,27,24,1,28,11,13,2,5,22,26},
+{1,36,32,54,48,45,40,26,60,23,34,61,51,2,11,3,47,35,45,20,39,38,52,60,42,41,31,7,61,56,33,9,4},
+{1,36,18,9,32,16,8,4,2,1,36,18,9,32,16,8,4,2,36,9,16,4,1,18,32,8,2,36,9,16,4,1,18},
+{1,36,60,22,32,2,31,47,44,23,4,62,9,15,46,8,43,18,15,23,2,36,30,46,4,31,60,11,8,62,47,22,16},
+{1,36,33,35,48,41,52,15,6,53,43,39,22,27,14,34,20,8,38,25,35,24,49,43,62,40,8,38,25,35,24,49,43},
+{1,36,47,37,11,10,46,1,36,47,37,11,10,46,1,36,47,37,53,50,45,6,13,8,51,63,37,53,50,45,6,13,8},
+{1,36,10,58,35,56,12,44,31,13,8,21,55,43,45,59,7,50,27,26,8,57,20,58,34,14,50,27,26,8,57,20,58},
+{1,36,28,47,62,49,52,55,54,18,14,33,31,46,26,45,27,9,53,63,60,10,3,54,9,53,63,60,10,3,54,9,53},
+{1,36,45,3,31,4,5,33,12,15,16,20,17,48,60,51,35,55,19,60,32,20,49,12,62,4,59,45,56,27,57,9,23},
+{1,36,2,61,4,15,8,30,16,60,32,13,53,26,31,52,62,29,62,52,31,26,53,13,32,60,16,30,8,15,4,61,2},
+{1,15,85,9,119,114,65,70,107,69,122,57,97,35,116,99,61,93,121,20,102,7,87,74,86,12,34,124,76,71,50,4,30},
+{1,48,90,28,100,116,66,49,106,70,120,16,54,115,91,44,62,104,19,51,5,120,8,73,61,28,50,29,42,79,109,107,59},
+{1,42,60,92,54,70,63,34,114,45,101,103,51,75,124,16,19,109,83,87,3,63,17,91,112,123,99,10,13,102,75,62,4},
+{1,121,30,117,118,108,78,64,75,110,45,124,48,19,100,113,33,20,92,102,9,35,115,33,10,46,51,76,89,113,88,5,23},
+{1,67,118,81,40,123,72,66,53,39,121,83,51,10,119,18,94,42,48,41,28,65,120,8,54,113,81,20,119,9,89,34,6},
+{1,76,97,42,70,5,50,12,37,16,17,93,60,22,80,85,103,107,39,68,29,60,11,20,100,12,65,4,63,97,21,66,110},
+{1,51,93,41,63,95,79,46,13,49,59,56,109,33,90,27,81,43,121,70,60,5,42,53,46,83,115,18,86,89,39,120,10},
+{1,50,117,110,108,8,91,62,95,79,64,60,59,28,37,93,43,19,112,74,93,73,118,28,78,57,60,65,7,79,32,15,62},
+{1,127,73,87,26,112,48,98,58,89,28,12,71,81,102,7,3,62,50,78,42,9,93,79,74,107,64,41,22,68,104,95,48},
+{1,110,100,13,32,82,81,34,79,88,56,15,61,91,75,98,42,59,62,20,105,118,124,40,19,45,57,80,38,90,114,97,76},
+{1,22,73,82,46,117,54,51,125,77,10,87,96,69,113,110,74,104,31,18,109,56,30,25,40,101,96,71,75,63,47,84,45},
+{1,117,120,72,41,77,46,115,51,45,63,104,38,68,108,84,2,57,120,36,87,39,113,5,106,102,45,118,26,48,89,25,22},
+{1,35,83,18,93,106,123,67,9,68,53,87,75,110,34,112,65,79,113,49,7,30,91,80,81,42,97,86,52,58,6,101,16},
+{1,121,124,43,109,15,28,47,67,53,85,81,127,69,12,114,78,62,65,17,18,37,4,23,124,103,34,36,74,8,46,29,43},
+{1,95,39,73,62,102,2,81,78,125,124,35,4,77,115,21,23,70,4,81,39,83,120,55,38,11,74,24,56,61,52,33,93},
+{1,117,109,40,62,58,12,90,11,2,27,43,80,124,116,24,69,22,2,117,78,10,67,101,34,92,19,91,63,95,36,50,48},
+{1,12,80,28,103,97,73,71,15,68,27,67,63,29,107,49,85,32,55,69,112,57,97,95,44,31,66,98,85,16,96,89,56},
+{1,67,117,113,122,84,106,120,47,125,103,38,40,78,43,118,73,24,29,57,110,71,63,86,118,90,6,56,49,101,80,78,107},
+{1,126,136,162,218,77,242,201,110,41,250,20,66,78,112,74,147,92,155,205,203,73,133,113,26,64,89,88,103,69,154,242,233},
+{1,207,139,61,86,89,56,130,196,241,145,228,41,33,23,59,206,68,91,211,101,222,20,181,157,234,205,4,131,139,144,155,166},
+{1,23,62,39,211,171,185,204,45,69,12,228,35,143,83,37,253,215,238,207,10,75,99,100,195,120,9,194,230,147,118,108,159},
+{1,194,252,138,49,156,54,136,152,73,15,234,141,37,50,247,31,59,243,48,47,164,75,83,210,128,51,140,229,165,42,108,136},
+{1,105,126,94,82,204,182,117,230,107,172,162,238,104,23,32,12,158,61,226,123,85,117,115,200,137,45,225,186,233,39,21,121},
+{1,156,213,181,37,226,104,140,237,225,243,204,13,142,234,116,166,134,123,136,238,61,99,154,110,221,203,76,121,20,27,192,144},
+{1,254,247,87,182,195,241,201,30,124,146,217,162,80,214,156,25,28,192,95,116,102,198,16,94,11,174,182,199,111,150,123,121},
+{1,207,87,172,198,125,253,118,22,137,161,49,47,67,228,201,75,1,200,66,186,136,55,182,148,206,76,105,245,230,4,193,87},
+{1,195,120,124,213,86,197,52,15,190,110,82,108,183,156,79,85,227,94,122,253,224,77,88,92,185,193,255,35,113,71,50,144},
+{1,255,99,146,159,149,168,217,249,171,189,92,120,121,134,229,119,232,140,108,179,25,56,220,152,81,57,17,107,26,10,172,69},
+{1,52,180,26,90,13,45,178,162,89,81,152,156,76,78,38,39,19,231,117,223,151,216,209,27,55,116,197,186,129,77,61,144},
+{1,101,146,245,173,13,59,29,60,87,81,126,129,93,32,14,148,218,41,104,236,58,60,147,72,235,31,123,184,69,78,68,196},
+{1,227,147,72,13,220,2,177,81,144,26,207,4,21,162,87,52,233,4,177,147,36,229,160,115,255,124,114,53,5,123,234,45},
+{1,3,5,15,17,51,85,255,122,142,233,64,192,59,77,215,2,6,5,186,231,41,128,192,160,240,136,204,170,255,61,158,209},
+{1,23,146,250,249,192,241,120,244,51,167,47,180,225,143,254,165,1,200,231,189,39,6,57,219,128,210,20,150,83,14,101,120},
+{1,88,146,224,96,138,7,3,232,61,171,160,21,9,5,179,71,118,240,109,50,191,189,229,172,148,152,195,254,110,70,23,153},
+{1,16,141,27,61,202,200,232,127,73,51,42,55,106,148,6,96,52,45,229,145,43,213,156,67,143,219,236,217,252,89,95,111},
+{1,238,116,151,24,42,61,175,223,206,153,78,19,20,63,236,55,127,155,201,89,143,25,98,186,7,218,83,231,203,183,181,91},
+{1,143,73,22,70,236,183,62,19,16,34,249,195,9,158,228,166,147,128,136,81,195,213,246,205,62,216,4,189,73,11,192,204},
+{1,46,11,171,69,250,28,122,196,12,97,116,249,110,103,144,195,198,40,163,78,252,124,16,217,44,255,69,125,7,101,102,95},
+{1,158,36,85,7,184,252,26,21,74,39,70,107,71,245,99,160,100,12,38,108,167,110,57,124,64,254,147,123,28,193,252,13},
+{1,231,160,32,121,255,51,15,3,148,93,96,139,188,85,17,5,1,173,40,4,115,160,16,113,71,64,121,161,189,89,67,51},
+{1,198,14,46,84,87,222,204,190,66,187,26,141,140,74,68,106,62,213,93,55,40,163,108,150,130,50,4,79,14,23,21,211},
+{1,48,109,101,42,220,106,245,230,40,188,176,63,178,95,104,149,60,113,58,33,134,121,250,251,227,108,205,98,93,4,96,109},
+{1,209,255,111,89,204,193,249,240,34,121,192,40,15,77,32,12,233,123,177,158,85,249,120,227,64,12,159,214,179,79,193,151},
+{1,22,201,206,172,180,185,71,241,100,108,220,61,228,151,36,255,160,46,223,237,246,3,29,207,93,104,66,177,149,4,44,201},
+{1,43,23,72,242,205,239,108,139,88,107,90,61,116,173,119,208,78,4,86,23,36,207,175,227,204,98,103,215,188,145,20,233},
+{1,169,222,69,186,7,185,15,40,192,21,201,45,216,85,107,106,195,247,22,153,47,197,255,167,214,106,152,130,11,181,238,155},
+{1,50,207,72,167,142,184,191,33,83,94,193,129,67,148,115,63,80,4,100,207,36,174,150,241,21,24,173,189,216,14,158,57},
+{1,58,171,88,202,119,225,180,133,73,162,75,214,228,102,137,136,178,240,110,80,141,48,123,16,41,167,176,202,199,70,234,149},
+{1,84,264,221,448,351,297,6,504,53,205,134,455,243,20,22,190,173,394,37,452,262,195,495,366,90,296,41,60,29,369,383,211},
+{1,285,405,428,484,10,135,501,79,142,68,276,36,247,334,185,221,360,314,42,19,55,324,31,74,490,357,193,101,84,38,110,153},
+{1,367,264,26,395,35,324,383,377,34,43,119,355,425,8,307,28,208,21,70,324,436,464,394,166,19,480,200,180,79,362,497,71},
+{1,414,501,51,350,68,307,240,86,320,200,283,233,54,149,72,460,224,129,425,127,366,476,218,180,447,108,149,36,115,28,472,509},
+{1,138,38,341,86,425,401,495,28,63,489,257,235,116,245,351,336,213,411,356,88,83,149,467,293,85,267,486,66,194,82,208,202},
+{1,174,500,504,71,131,23,286,381,409,511,288,277,421,203,217,508,210,146,96,139,392,148,402,389,266,478,190,464,473,283,163,356},
+{1,162,87,205,141,450,508,20,100,74,381,27,79,356,272,389,494,399,238,371,73,340,289,35,44,288,114,181,499,262,331,347,45},
+{1,154,264,426,368,3,430,339,181,475,5,185,446,479,38,15,459,137,21,319,508,72,315,200,320,494,148,265,152,30,459,353,303},
+{1,510,286,88,288,403,465,469,198,12,364,350,505,86,489,168,152,410,40,493,497,312,137,77,437,353,230,248,463,241,35,511,112},
+{1,166,105,67,88,383,162,174,487,340,31,480,121,256,41,497,412,280,114,178,473,330,387,124,415,121,128,434,226,142,159,322,324},
+{1,75,264,306,279,132,153,441,66,382,494,33,191,247,290,365,329,145,194,343,182,370,333,492,361,256,437,411,16,61,234,1,279},
+{1,346,317,234,219,372,481,419,50,40,443,380,252,495,473,75,470,363,73,433,94,390,58,430,467,497,248,286,465,171,338,16,285},
+{1,377,239,449,286,133,499,473,307,177,147,98,41,270,179,14,444,452,409,450,125,109,118,421,72,342,35,196,41,135,183,154,128},
+{1,95,154,3,225,430,5,291,133,15,274,399,17,321,230,51,436,298,273,183,242,275,232,191,398,39,235,500,222,463,376,394,153},
+{1,184,361,292,31,102,475,7,341,152,379,93,306,507,21,44,437,230,503,217,461,463,375,253,180,103,399,357,383,96,27,323,190},
+{1,145,215,147,501,317,211,80,46,502,142,426,485,182,54,507,346,407,342,105,466,238,207,79,490,32,395,305,203,365,317,298,20},
+{1,104,232,465,351,195,87,497,436,426,48,468,151,286,381,248,238,161,221,428,160,233,406,386,135,346,463,296,422,360,333,150,187},
+{1,258,264,376,332,129,132,188,166,268,66,94,83,134,33,47,357,67,174,444,469,153,405,436,239,16,237,274,105,332,268,33,347},
+{1,37,343,413,493,407,143,430,151,117,203,85,301,133,204,174,109,272,341,442,120,169,75,20,354,333,6,111,173,1,323,253,207},
+{1,422,281,42,142,303,270,388,476,508,208,401,411,57,87,339,373,199,333,155,180,457,399,236,473,452,450,397,330,7,156,40,481},
+{1,304,145,444,409,138,89,255,278,125,220,340,359,172,181,415,475,400,323,272,150,441,460,60,331,142,436,5,87,329,446,171,106},
+{1,353,476,134,12,318,507,497,80,13,95,39,375,92,307,420,470,295,371,91,317,300,275,461,124,221,315,56,33,244,293,18,181},
+{1,8,64,189,146,490,222,311,497,6,48,384,307,465,262,121,373,348,10,40,160,61,244,365,206,389,467,139,145,249,345,30,120},
+{1,309,505,209,442,342,274,79,150,375,331,384,114,360,380,128,46,216,106,421,471,355,316,300,375,450,96,474,369,82,2,309,411},
+{1,402,310,372,27,398,484,97,325,138,102,25,123,345,88,371,327,383,261,8,315,189,372,357,267,340,43,302,294,29,160,468,177},
+{1,443,195,32,9,98,438,288,65,425,7,407,146,224,63,302,436,141,398,417,239,341,489,359,226,201,42,339,511,168,250,145,123},
+{1,436,119,271,72,487,241,69,247,23,453,298,117,146,166,268,97,382,496,154,412,173,39,208,417,365,501,477,49,402,331,511,422},
+{1,181,278,343,459,346,265,75,428,489,344,99,158,507,134,277,136,8,45,213,343,409,298,126,116,236,178,114,307,303,50,91,140},
+{1,114,264,191,447,401,361,3,150,25,449,448,434,186,5,442,43,322,288,309,377,272,134,285,403,326,452,61,166,63,212,187,443},
+{1,391,281,196,495,14,83,449,397,368,84,97,228,63,236,75,349,77,189,322,305,176,47,2,391,261,49,470,491,26,457,373,381},
+{1,367,270,29,499,49,337,382,376,48,62,112,357,451,15,289,27,187,405,264,288,186,168,193,321,441,345,60,343,27,471,320,132},
+{1,422,40,349,353,285,323,351,306,333,230,130,23,212,327,505,402,280,430,178,335,469,443,382,461,81,398,309,15,384,102,99,227},
+{1,120,212,231,262,269,358,252,171,347,238,413,319,255,35,39,455,436,276,396,465,177,71,27,327,388,49,281,160,152,93,352,246},
+{1,410,200,500,35,463,464,121,342,310,454,94,147,247,13,388,251,19,323,71,258,218,372,297,431,144,180,153,115,315,33,229,16},
+{1,354,214,209,137,400,156,24,421,330,258,52,180,460,320,375,350,488,368,131,367,480,437,303,446,57,465,161,34,333,173,280,55},
+{1,389,264,57,51,380,154,288,222,313,262,496,46,34,424,236,448,148,464,326,275,209,286,370,269,157,48,93,324,150,85,450,463},
+{1,61,128,297,502,40,214,11,431,81,401,150,312,340,69,506,308,72,458,493,140,445,90,31,226,175,166,491,203,381,87,296,322},
+{1,399,146,372,225,81,221,257,267,90,3,458,438,199,291,243,359,88,35,406,189,483,72,311,133,270,258,461,123,437,299,350,427},
+{1,450,49,157,162,485,105,232,159,71,391,339,428,52,149,87,109,290,413,484,357,238,216,224,53,283,425,30,24,319,166,423,243},
+{1,410,135,79,157,255,119,63,473,472,66,197,138,23,232,159,160,377,485,226,222,208,427,468,192,215,163,94,74,361,153,405,64},
+{1,153,345,470,295,476,362,421,450,445,302,58,405,26,478,88,122,259,79,275,304,448,497,231,287,267,326,204,230,229,390,17,133},
+{1,64,178,40,298,17,469,184,475,75,257,507,18,277,366,419,70,306,450,463,111,44,21,467,156,65,121,415,325,413,261,452,271},
+{1,383,269,193,370,245,108,318,348,356,253,150,299,426,502,427,137,166,36,117,280,420,120,484,239,462,25,391,499,491,364,444,255},
+{1,151,251,113,413,8,55,210,13,377,64,440,410,104,339,389,81,321,416,291,389,490,177,104,363,128,440,205,26,377,32,110,210},
+{1,214,237,332,313,142,339,489,280,510,102,30,6,379,481,182,392,171,122,218,202,356,351,72,369,310,385,302,248,207,163,173,256},
+{1,334,264,342,305,125,72,175,147,301,415,416,109,102,2,317,433,269,305,494,18,345,71,136,355,235,248,262,259,153,467,106,231},
+{1,24,320,29,312,130,337,389,110,335,149,153,57,493,369,304,66,346,364,4,48,320,468,78,253,195,459,202,423,431,463,250,231},
+{1,56,395,105,366,495,31,337,204,12,288,91,341,44,338,132,296,411,40,217,426,461,466,166,149,328,346,162,229,195,178,293,413},
+{1,3,5,15,17,51,85,255,257,196,332,19,53,95,225,291,162,486,277,124,66,99,433,138,207,331,13,488,284,402,347,21,508},
+{1,165,449,353,346,360,138,397,402,374,203,497,457,20,126,273,299,444,298,361,498,19,103,240,260,248,91,177,314,28,352,282,317},
+{1,296,220,452,299,105,160,170,217,27,330,295,368,359,308,468,314,336,324,311,342,497,389,453,487,222,458,305,483,323,278,467,188},
+{1,92,172,407,117,366,39,319,146,126,191,204,106,112,66,494,350,307,385,1,46,43,189,58,422,372,480,315,241,345,441,507,268},
+{1,62,319,328,349,418,399,203,158,133,270,317,308,250,235,236,86,89,357,480,359,478,20,396,424,493,508,19,465,177,306,63,364},
+{1,218,99,489,180,205,73,310,134,203,374,124,213,144,59,458,423,103,177,78,408,147,347,163,386,468,465,8,139,198,489,90,314},
+{1,275,97,480,214,386,490,503,417,359,313,273,430,290,255,46,263,458,211,115,269,385,155,85,13,197,65,300,288,152,59,299,129},
+{1,203,161,176,220,396,477,214,436,410,59,282,270,382,496,42,374,94,362,192,41,488,364,413,293,412,189,183,171,68,216,336,469},
+};
+
+static const struct {
+    int m, n, r, w;
+    const uint16_t *modlist; /* NIRREDPOLY rows of w+1 entries */
+} prescr_tables[PRESCR_NTABLES] = {
+    {8, 17, 6, 31, &prescr_table_31_521[0][0]},
+    {10, 20, 13, 31, &prescr_table_31_607[0][0]},
+    {21, 42, 23, 31, &prescr_table_31_1279[0][0]},
+    {36, 72, 29, 31, &prescr_table_31_2203[0][0]},
+    {37, 74, 13, 31, &prescr_table_31_2281[0][0]},
+    {52, 104, 7, 31, &prescr_table_31_3217[0][0]},
+    {69, 138, 25, 31, &prescr_table_31_4253[0][0]},
+    {71, 143, 10, 31, &prescr_table_31_4423[0][0]},
+    {156, 313, 14, 31, &prescr_table_31_9689[0][0]},
+    {160, 321, 10, 31, &prescr_table_31_9941[0][0]},
+    {181, 362, 9, 31, &prescr_table_31_11213[0][0]},
+    {322, 644, 27, 31, &prescr_table_31_19937[0][0]},
+    {350, 701, 30, 31, &prescr_table_31_21701[0][0]},
+    {374, 749, 10, 31, &prescr_table_31_23209[0][0]},
+    {718, 1436, 19, 31, &prescr_table_31_44497[0][0]},
+    {8, 17, 23, 32, &prescr_table_32_521[0][0]},
+    {9, 19, 1, 32, &prescr_table_32_607[0][0]},
+    {20, 40, 1, 32, &prescr_table_32_1279[0][0]},
+    {34, 69, 5, 32, &prescr_table_32_2203[0][0]},
+    {36, 72, 23, 32, &prescr_table_32_2281[0][0]},
+    {50, 101, 15, 32, &prescr_table_32_3217[0][0]},
+    {66, 133, 3, 32, &prescr_table_32_4253[0][0]},
+    {69, 139, 25, 32, &prescr_table_32_4423[0][0]},
+    {151, 303, 7, 32, &prescr_table_32_9689[0][0]},
+    {155, 311, 11, 32, &prescr_table_32_9941[0][0]},
+    {175, 351, 19, 32, &prescr_table_32_11213[0][0]},
+    {312, 624, 31, 32, &prescr_table_32_19937[0][0]},
+    {339, 679, 27, 32, &prescr_table_32_21701[0][0]},
+    {363, 726, 23, 32, &prescr_table_32_23209[0][0]},
+    {695, 1391, 15, 32, &prescr_table_32_44497[0][0]},
+};
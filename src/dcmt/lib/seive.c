@@ -16,8 +16,13 @@
 /* Free Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA   */
 /* 02111-1307  USA                                                 */
 
+#define _DEFAULT_SOURCE /* clock_gettime() */
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
 #include "dci.h"
 
 #define WORDLEN 32
@@ -30,40 +35,535 @@ _org_state global_mt19937;
 static uint32_t nextA(_org_state *org, int w);
 static uint32_t nextA_id(_org_state *org, int w, int id, int idw);
 static void make_masks(int r, int w, mt_struct *mts);
-static int get_irred_param(check32_t *ck, prescr_t *pre, _org_state *org,
+static int get_irred_param(search_ws_t *ws, _org_state *org,
 			   mt_struct *mts,int id, int idw);
+static int get_irred_param_batch(search_ws_t *ws, _org_state *org,
+				 mt_struct *mts, int id, int idw);
+static int get_irred_param_spec(search_ws_t *ws, _org_state *org,
+				mt_struct *mts, int id, int idw,
+				int n_threads);
+static int draw_candidates(search_ws_t *ws, _org_state *org,
+			   mt_struct *mts, int id, int idw, int *i, int max,
+			   uint32_t *a, uint32_t *init, int *draws);
+static void count_round(dc_stats *stats, int drawn, int count, int checked);
+static void *spec_worker(void *arg);
+static void cache_key(dc_cache_key_t *key, int kind, int w, int p, int id,
+		      uint32_t seed, int start_id, const dc_opts *opts);
+static mt_struct *cached_mt_struct(dc_cache_t *cache,
+				   const dc_cache_key_t *key);
+static int temper_param(search_ws_t *ws, mt_struct *mts);
+static dc_stats *reset_stats(const dc_opts *opts, int offset);
 static mt_struct *alloc_mt_struct(int n);
-static mt_struct *init_mt_search(check32_t *ck, prescr_t *pre, int w, int p);
-static void end_mt_search(prescr_t *pre);
+static mt_struct *init_mt_search(search_ws_t *ws, int w, int p,
+				 const dc_opts *opts);
+static void end_mt_search(search_ws_t *ws);
 static void copy_params_of_mt_struct(mt_struct *src, mt_struct *dst);
+static int check_mt_params(int w, int p);
+static int check_opts(const dc_opts *opts);
+static double monotonic_time(void);
+static int stoppable(const dc_opts *opts);
+static void init_ctl(search_ctl_t *ctl);
+static void arm_ctl(search_ctl_t *ctl, const dc_opts *opts);
+static void disarm_ctl(search_ctl_t *ctl);
+static search_ctl_t *start_ctl(search_ctl_t *ctl, const dc_opts *opts);
+static void end_ctl(search_ctl_t *ctl);
+static int run_range_serial(mt_range_search *search,
+			    mt_range_callback callback, void *arg);
+static int start_range_job(mt_range_search *search);
+static void end_range_job(mt_range_search *search);
+static int run_range_mt(mt_range_search *search,
+			mt_range_callback callback, void *arg);
+static int collect_mt_struct(mt_struct *mts, int id, void *arg);
 static int proper_mersenne_exponent(int p);
+static uint32_t id_seed(uint32_t seed, int id);
+static void *range_worker(void *arg);
 /*******************************************************************/
 
+/* streaming range search, see new_mt_range_search() */
+struct MT_RANGE_SEARCH_T {
+    int w, p;
+    int start_id, max_id; /* the whole range */
+    uint32_t seed;
+    dc_opts opts;
+    int next_id;    /* the first ID not passed to the callback yet */
+    _org_state org; /* serial search: the stream for next_id */
+    struct RANGE_JOB_T *job; /* threaded search: the running workers */
+};
+
+/*
+   State of a search which can be stopped (dc_opts.time_limit, cancel
+   and progress), shared by all threads of one search call.  The
+   threads report to it with _PollSearch_dc(), which tells them to stop.
+*/
+struct SEARCH_CTL_T {
+    volatile int *cancel;
+    dc_progress_callback progress;
+    void *progress_arg;
+    pthread_t owner;  /* the calling thread, the only one to call progress */
+    double deadline;  /* of CLOCK_MONOTONIC, 0 if none */
+    int stop;         /* DC_CANCELLED or DC_TIMED_OUT once stopped */
+    int ids_done;
+    long candidates;
+    pthread_mutex_t lock;
+};
+
 /* When idw==0, id is not embedded into "a" */
 #define FOUND 1
 #define NOT_FOUND 0
-static int get_irred_param(check32_t *ck, prescr_t *pre, _org_state *org,
+
+static int get_irred_param(search_ws_t *ws, _org_state *org,
 			   mt_struct *mts, int id, int idw)
 {
-    int i;
+    int i, polled, irred;
     uint32_t a;
+    dc_stats *stats = ws->stats;
+    double start = 0, check_start = 0, period_time = 0;
+
+    if (ws->ck.period_check == DC_PERIOD_BITSLICED)
+	return get_irred_param_batch(ws, org, mts, id, idw);
 
+    if (NULL != stats) start = monotonic_time();
+    polled = 0;
+    irred = REDU;
     for (i=0; i<MAX_SEARCH; i++) {
 	if (idw == 0)
 	    a = nextA(org, mts->ww);
 	else
 	    a = nextA_id(org, mts->ww, id, idw);
-	if (NOT_REJECTED == _prescreening_dc(pre, a) ) {
-	    if (IRRED
-		== _CheckPeriod_dc(ck, org, a,mts->mm,mts->nn,mts->rr,mts->ww)) {
+	if (NOT_REJECTED == _prescreening_dc(&ws->pre, a) ) {
+	    if (0 != _PollSearch_dc(ws->ctl, i+1-polled, 0)) break;
+	    polled = i+1;
+	    if (NULL != stats) {
+		stats->period_checks++;
+		check_start = monotonic_time();
+	    }
+	    irred = _CheckPeriod_dc(&ws->ck, org, a,
+				    mts->mm,mts->nn,mts->rr,mts->ww);
+	    if (NULL != stats) period_time += monotonic_time() - check_start;
+	    if (IRRED == irred) {
 		mts->aaa = a;
 		break;
 	    }
 	}
+	else if (NULL != stats)
+	    stats->rejected++;
+    }
+
+    if (MAX_SEARCH == i)
+	_PollSearch_dc(ws->ctl, i-polled, 0);
+    if (NULL != stats) {
+	/* the loop was left before i++ unless MAX_SEARCH was reached */
+	stats->candidates += (i < MAX_SEARCH) ? i+1 : i;
+	stats->period_time += period_time;
+	stats->prescreen_time += monotonic_time() - start - period_time;
+    }
+    return (IRRED == irred) ? FOUND : NOT_FOUND;
+}
+
+/*
+   Same search as get_irred_param(), but the period check is done on
+   up to CHECK_BATCH prescreened candidates at once.  The first IRRED
+   candidate in the order of drawing wins, and org is left exactly
+   where the one-by-one search would have left it.
+*/
+static int get_irred_param_batch(search_ws_t *ws, _org_state *org,
+				 mt_struct *mts, int id, int idw)
+{
+    int i, k, count, draws[CHECK_BATCH];
+    uint32_t a[CHECK_BATCH];
+    uint64_t irred;
+    _org_state start;
+    dc_stats *stats = ws->stats;
+    double t = 0;
+
+    for (i=0; i<MAX_SEARCH; ) {
+	start = *org;
+	k = i;
+	if (NULL != stats) t = monotonic_time();
+	count = draw_candidates(ws, org, mts, id, idw, &i, CHECK_BATCH,
+				a, ws->ck.init, draws);
+	if (NULL != stats)
+	    stats->prescreen_time += monotonic_time() - t;
+	if (0 != _PollSearch_dc(ws->ctl, i-k, 0)) {
+	    if (NULL != stats) count_round(stats, i-k, count, 0);
+	    return NOT_FOUND;
+	}
+	if (count == 0) {
+	    if (NULL != stats) count_round(stats, i-k, 0, 0);
+	    break;
+	}
+
+	if (NULL != stats) t = monotonic_time();
+	irred = _CheckPeriodBatch_dc(&ws->ck, a, ws->ck.init, count,
+				     mts->mm,mts->nn,mts->rr,mts->ww);
+	if (NULL != stats)
+	    stats->period_time += monotonic_time() - t;
+	if (!irred) {
+	    if (NULL != stats) count_round(stats, i-k, count, count);
+	}
+	else {
+	    for (k=0; !((irred >> k) & 1); k++);
+	    /* the candidates after a[k] are not counted */
+	    if (NULL != stats)
+		count_round(stats, draws[k] - (k+1)*mts->nn, k+1, k+1);
+	    mts->aaa = a[k];
+	    /* rewind org to just after the period check of a[k] */
+	    *org = start;
+	    for (k=draws[k]; k>0; k--)
+		_genrand_dc(org);
+	    return FOUND;
+	}
+    }
+
+    return NOT_FOUND;
+}
+
+/*
+   Draws the candidates of get_irred_param() from the (*i)-th one on,
+   until max of them pass the prescreening or MAX_SEARCH is reached.
+   The prescreened candidates go to a[] and the initial values of
+   their period checks to init[] (n words each); draws[k] is the
+   number of random numbers taken from org up to the initial values
+   of a[k], one for every candidate and n for every prescreened one.
+   Returns the number of candidates in a[].
+*/
+static int draw_candidates(search_ws_t *ws, _org_state *org,
+			   mt_struct *mts, int id, int idw, int *i, int max,
+			   uint32_t *a, uint32_t *init, int *draws)
+{
+    int count, ndraw;
+
+    count = 0;
+    ndraw = 0;
+    for (; (count<max) && (*i<MAX_SEARCH); ++(*i)) {
+	if (idw == 0)
+	    a[count] = nextA(org, mts->ww);
+	else
+	    a[count] = nextA_id(org, mts->ww, id, idw);
+	ndraw++;
+	if (NOT_REJECTED == _prescreening_dc(&ws->pre, a[count]) ) {
+	    _DrawPeriodInit_dc(&ws->ck, org, mts->nn,
+			       init + count*mts->nn);
+	    ndraw += mts->nn;
+	    draws[count++] = ndraw;
+	}
+    }
+
+    return count;
+}
+
+/*
+   Adds to stats a round of draw_candidates(): drawn candidates, count
+   of them prescreened, and the first checked of those period checked.
+   A round which found the generator is counted up to the winner only,
+   as in get_irred_param(), so the stats do not depend on the round
+   size.
+*/
+static void count_round(dc_stats *stats, int drawn, int count, int checked)
+{
+    stats->candidates += drawn;
+    stats->rejected += drawn - count;
+    stats->period_checks += checked;
+}
+
+/*
+   period checks of the rounds of get_irred_param_spec(); the workers
+   run for the whole search and wait on start for the next round
+*/
+typedef struct {
+    int m, n, r, w;
+    int unit;  /* candidates taken by a worker at once */
+    int count; /* candidates in the round */
+    uint32_t *a;
+    uint32_t *init;
+    int next;  /* next candidate to be checked */
+    int found; /* lowest IRRED candidate so far, count if none */
+    int round;   /* incremented when a round is handed over */
+    int running; /* workers still checking the round */
+    int quit;    /* set when the search is over */
+    pthread_mutex_t lock;
+    pthread_cond_t start; /* a new round, or quit */
+    pthread_cond_t done;  /* running dropped to 0 */
+} spec_job_t;
+
+typedef struct {
+    spec_job_t *job;
+    check32_t *ck;
+} spec_worker_t;
+
+static void spec_round(spec_worker_t *worker);
+
+/* prescreened candidates per worker in a round of get_irred_param_spec */
+#define SPEC_ROUND_UNITS 2
+
+static void *spec_worker(void *arg)
+{
+    spec_worker_t *worker = (spec_worker_t *)arg;
+    spec_job_t *job = worker->job;
+    int round = 0;
+
+    pthread_mutex_lock(&job->lock);
+    for (;;) {
+	while (job->round == round && !job->quit)
+	    pthread_cond_wait(&job->start, &job->lock);
+	if (job->quit) break;
+	round = job->round;
+	pthread_mutex_unlock(&job->lock);
+
+	spec_round(worker);
+
+	pthread_mutex_lock(&job->lock);
+	if (--job->running == 0)
+	    pthread_cond_signal(&job->done);
+    }
+    pthread_mutex_unlock(&job->lock);
+
+    return NULL;
+}
+
+/* checks candidates of the current round until it is decided */
+static void spec_round(spec_worker_t *worker)
+{
+    spec_job_t *job = worker->job;
+    int i, k, c;
+    uint64_t irred;
+
+    for (;;) {
+	pthread_mutex_lock(&job->lock);
+	i = job->next;
+	/* candidates after an IRRED one are not needed */
+	if (i >= job->found) {
+	    pthread_mutex_unlock(&job->lock);
+	    break;
+	}
+	job->next += job->unit;
+	pthread_mutex_unlock(&job->lock);
+
+	c = job->count - i;
+	if (c > job->unit) c = job->unit;
+	if (job->unit > 1) {
+	    irred = _CheckPeriodBatch_dc(worker->ck, job->a + i,
+					 job->init + i*job->n, c,
+					 job->m, job->n, job->r, job->w);
+	    for (k=0; (k<c) && !((irred >> k) & 1); k++);
+	}
+	else {
+	    k = (IRRED == _CheckPeriodInit_dc(worker->ck, job->a[i],
+					      job->init + i*job->n,
+					      job->m, job->n, job->r, job->w))
+		? 0 : 1;
+	}
+
+	if (k < c) {
+	    pthread_mutex_lock(&job->lock);
+	    if (i+k < job->found) job->found = i+k;
+	    pthread_mutex_unlock(&job->lock);
+	}
+    }
+}
+
+/*
+   Same search as get_irred_param(), but the period checks are run by
+   n_threads threads.  Whether a candidate passes the prescreening
+   decides where the next one is drawn from, so the calling thread
+   draws and prescreens the candidates of a round in order; then the
+   workers check them, and the lowest IRRED one wins.  The result
+   and org are the same as with the one-by-one search.  The workers
+   are started once and get the rounds through job.start.
+*/
+static int get_irred_param_spec(search_ws_t *ws, _org_state *org,
+				mt_struct *mts, int id, int idw,
+				int n_threads)
+{
+    spec_job_t job;
+    spec_worker_t *workers;
+    check32_t *cks;
+    pthread_t *threads;
+    int i, t, n_cks, n_started, size, res, *draws;
+    _org_state start;
+    dc_stats *stats = ws->stats;
+    double since = 0;
+
+    job.m = mts->mm;
+    job.n = mts->nn;
+    job.r = mts->rr;
+    job.w = mts->ww;
+    job.unit = (ws->ck.period_check == DC_PERIOD_BITSLICED)
+	? CHECK_BATCH : 1;
+    size = SPEC_ROUND_UNITS * n_threads * job.unit;
+
+    job.a = (uint32_t*)malloc(size*sizeof(uint32_t));
+    job.init = (uint32_t*)malloc(size*job.n*sizeof(uint32_t));
+    draws = (int*)malloc(size*sizeof(int));
+    workers = (spec_worker_t*)malloc(n_threads*sizeof(spec_worker_t));
+    cks = (check32_t*)malloc((n_threads-1)*sizeof(check32_t));
+    threads = (pthread_t*)malloc((n_threads-1)*sizeof(pthread_t));
+    if (NULL == job.a || NULL == job.init || NULL == draws
+	|| NULL == workers || NULL == cks || NULL == threads) {
+	free(job.a); free(job.init); free(draws);
+	free(workers); free(cks); free(threads);
+	return get_irred_param(ws, org, mts, id, idw);
+    }
+
+    /* the calling thread is worker 0 and uses ws->ck */
+    workers[0].job = &job;
+    workers[0].ck = &ws->ck;
+    for (n_cks=0; n_cks<n_threads-1; n_cks++) {
+	if (0 != _InitCheck32_dc(&cks[n_cks], job.n, job.r, job.w,
+				 ws->ck.period_check))
+	    break;
+	cks[n_cks].ctl = ws->ctl;
+	workers[n_cks+1].job = &job;
+	workers[n_cks+1].ck = &cks[n_cks];
+    }
+
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.start, NULL);
+    pthread_cond_init(&job.done, NULL);
+    job.round = 0;
+    job.quit = 0;
+    for (n_started=0; n_started<n_cks; n_started++) {
+	if (0 != pthread_create(&threads[n_started], NULL,
+				spec_worker, &workers[n_started+1]))
+	    break;
+    }
+
+    res = NOT_FOUND;
+    for (i=0; i<MAX_SEARCH; ) {
+	start = *org;
+	t = i;
+	if (NULL != stats) since = monotonic_time();
+	job.count = draw_candidates(ws, org, mts, id, idw, &i, size,
+				    job.a, job.init, draws);
+	if (NULL != stats)
+	    stats->prescreen_time += monotonic_time() - since;
+	if (0 != _PollSearch_dc(ws->ctl, i-t, 0)) {
+	    if (NULL != stats) count_round(stats, i-t, job.count, 0);
+	    break;
+	}
+	if (job.count == 0) {
+	    if (NULL != stats) count_round(stats, i-t, 0, 0);
+	    break;
+	}
+	if (NULL != stats) since = monotonic_time();
+
+	pthread_mutex_lock(&job.lock);
+	job.next = 0;
+	job.found = job.count;
+	job.running = n_started;
+	job.round++;
+	pthread_cond_broadcast(&job.start);
+	pthread_mutex_unlock(&job.lock);
+	spec_round(&workers[0]);
+	pthread_mutex_lock(&job.lock);
+	while (job.running > 0)
+	    pthread_cond_wait(&job.done, &job.lock);
+	pthread_mutex_unlock(&job.lock);
+	if (NULL != stats)
+	    stats->period_time += monotonic_time() - since;
+
+	if (job.found == job.count) {
+	    if (NULL != stats)
+		count_round(stats, i-t, job.count, job.count);
+	}
+	else {
+	    /* the candidates checked after the winner are not counted */
+	    if (NULL != stats)
+		count_round(stats, draws[job.found] - (job.found+1)*job.n,
+			    job.found+1, job.found+1);
+	    mts->aaa = job.a[job.found];
+	    /* rewind org to just after the period check of the winner */
+	    *org = start;
+	    for (t=draws[job.found]; t>0; t--)
+		_genrand_dc(org);
+	    res = FOUND;
+	    break;
+	}
+    }
+
+    pthread_mutex_lock(&job.lock);
+    job.quit = 1;
+    pthread_cond_broadcast(&job.start);
+    pthread_mutex_unlock(&job.lock);
+    for (t=0; t<n_started; t++)
+	pthread_join(threads[t], NULL);
+    pthread_cond_destroy(&job.done);
+    pthread_cond_destroy(&job.start);
+    pthread_mutex_destroy(&job.lock);
+
+    for (t=0; t<n_cks; t++)
+	_EndCheck32_dc(&cks[t]);
+    free(job.a); free(job.init); free(draws);
+    free(workers); free(cks); free(threads);
+
+    return res;
+}
+
+static void cache_key(dc_cache_key_t *key, int kind, int w, int p, int id,
+		      uint32_t seed, int start_id, const dc_opts *opts)
+{
+    memset(key, 0, sizeof(dc_cache_key_t));
+    key->kind = kind;
+    key->w = w;
+    key->p = p;
+    key->id = id;
+    key->seed = seed;
+    key->start_id = start_id;
+    if (NULL == opts || DC_TEMPER_HARD == opts->temper_depth)
+	key->effort = 0;
+    else
+	key->effort = opts->temper_depth + 1;
+}
+
+/* the generator for key from the cache, NULL if it is not there */
+static mt_struct *cached_mt_struct(dc_cache_t *cache,
+				   const dc_cache_key_t *key)
+{
+    mt_struct *mts;
+
+    if (cache->fd < 0) return NULL;
+    mts = alloc_mt_struct(key->p/key->w + 1);
+    if (NULL == mts) return NULL;
+    if (!_CacheLookup_dc(cache, key, mts)) {
+	free_mt_struct(mts);
+	return NULL;
     }
 
-    if (MAX_SEARCH == i) return NOT_FOUND;
-    return FOUND;
+    return mts;
+}
+
+/* 0 on success, -1 if out of memory */
+static int temper_param(search_ws_t *ws, mt_struct *mts)
+{
+    double start;
+    int res;
+
+    if (NULL == ws->stats)
+	return _get_tempering_parameter_hard_ws_dc(mts, &ws->temper);
+
+    start = monotonic_time();
+    ws->temper.n_nodes = ws->temper.n_pruned = 0;
+    res = _get_tempering_parameter_hard_ws_dc(mts, &ws->temper);
+    ws->stats->mask_nodes += ws->temper.n_nodes;
+    ws->stats->masks_pruned += ws->temper.n_pruned;
+    ws->stats->temper_time += monotonic_time() - start;
+    if (0 == res)
+	ws->stats->k_deficit = _k_deficit_dc(mts, &ws->temper);
+    return res;
+}
+
+/*
+   The zeroed statistics of the ID at offset in opts->stats (see
+   dc_opts.stats), or NULL if they are not kept.
+*/
+static dc_stats *reset_stats(const dc_opts *opts, int offset)
+{
+    dc_stats *stats;
+
+    if (NULL == opts || NULL == opts->stats) return NULL;
+    stats = opts->stats + offset;
+    memset(stats, 0, sizeof(dc_stats));
+    return stats;
 }
 
 
@@ -122,54 +622,253 @@ static void make_masks(int r, int w, mt_struct *mts)
     mts->lmask = lm;
 }
 
-static mt_struct *init_mt_search(check32_t *ck, prescr_t *pre, int w, int p)
+/*
+   Sets up the workspace ws, which is reused for all candidates and
+   IDs of the search and released by end_mt_search().
+   opts == NULL means the defaults.  Returns NULL on failure.
+*/
+static mt_struct *init_mt_search(search_ws_t *ws, int w, int p,
+				 const dc_opts *opts)
 {
     int n, m, r;
     mt_struct *mts;
 
+    if (!check_mt_params(w, p)) return NULL;
+
+    n = p/w + 1; /* since p is Mersenne Exponent, w never divids p */
+    mts = alloc_mt_struct(n);
+    if (NULL == mts) return NULL;
+
+    m = n/2;
+    if (m < 2) m = n-1;
+    r = n * w - p;
+
+    make_masks(r, w, mts);
+    if (0 != _InitTempering_dc(&ws->temper, n)) {
+	free_mt_struct(mts);
+	return NULL;
+    }
+    if (0 != _InitCheck32_dc(&ws->ck, n, r, w,
+			     (NULL != opts) ? opts->period_check
+			     : DC_PERIOD_DECIMATION)) {
+	_EndTempering_dc(&ws->temper);
+	free_mt_struct(mts);
+	return NULL;
+    }
+    if (0 != _InitCachedPrescreening_dc(&ws->pre, m, n, r, w)) {
+	_EndCheck32_dc(&ws->ck);
+	_EndTempering_dc(&ws->temper);
+	free_mt_struct(mts);
+	return NULL;
+    }
+    ws->ctl = NULL;
+    ws->stats = NULL;
+    if (NULL != opts) {
+	ws->temper.prune = opts->temper_prune;
+	ws->temper.depth = opts->temper_depth;
+    }
+
+    mts->mm = m;
+    mts->nn = n;
+    mts->rr = r;
+    mts->ww = w;
+
+    return mts;
+}
+
+static int check_mt_params(int w, int p)
+{
     if ( (w>32) || (w<31) ) {
 	printf ("Sorry, currently only w = 32 or 31 is allowded.\n");
-	return NULL;
+	return 0;
     }
 
     if ( !proper_mersenne_exponent(p) ) {
 	if (p<521) {
 	    printf ("\"p\" is too small.\n");
-	    return NULL;
+	    return 0;
 	}
 	else if (p>44497){
 	    printf ("\"p\" is too large.\n");
-	    return NULL;
+	    return 0;
 	}
 	else {
 	    printf ("\"p\" is not a Mersenne exponent.\n");
-	    return NULL;
+	    return 0;
 	}
     }
 
-    n = p/w + 1; /* since p is Mersenne Exponent, w never divids p */
-    mts = alloc_mt_struct(n);
-    if (NULL == mts) return NULL;
+    return 1;
+}
 
-    m = n/2;
-    if (m < 2) m = n-1;
-    r = n * w - p;
+static int check_opts(const dc_opts *opts)
+{
+    if (NULL == opts) return 1;
 
-    make_masks(r, w, mts);
-    _InitPrescreening_dc(pre, m, n, r, w);
-    _InitCheck32_dc(ck, r, w);
+    if (opts->n_threads < 0) {
+	printf("\"n_threads\" must not be negative\n");
+	return 0;
+    }
+    if ( (opts->period_check != DC_PERIOD_DECIMATION)
+	 && (opts->period_check != DC_PERIOD_BM)
+	 && (opts->period_check != DC_PERIOD_BITSLICED) ) {
+	printf("unknown \"period_check\"\n");
+	return 0;
+    }
+    if (!(opts->time_limit >= 0)) {
+	printf("\"time_limit\" must not be negative\n");
+	return 0;
+    }
+    if (opts->temper_depth < 0 || opts->temper_depth > 31) {
+	printf("\"temper_depth\" must be from 0 to 31\n");
+	return 0;
+    }
 
-    mts->mm = m;
-    mts->nn = n;
-    mts->rr = r;
-    mts->ww = w;
+    return 1;
+}
 
-    return mts;
+void init_dc_opts(dc_opts *opts)
+{
+    opts->n_threads = 0;
+    opts->period_check = DC_PERIOD_DECIMATION;
+    opts->time_limit = 0;
+    opts->cancel = NULL;
+    opts->progress = NULL;
+    opts->progress_arg = NULL;
+    opts->stats = NULL;
+    opts->temper_prune = 1;
+    opts->temper_depth = DC_TEMPER_HARD;
+}
+
+static double monotonic_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+/* 1 if a search with opts can be stopped */
+static int stoppable(const dc_opts *opts)
+{
+    return (NULL != opts)
+	&& ((opts->time_limit > 0) || (NULL != opts->cancel)
+	    || (NULL != opts->progress));
+}
+
+/* ctl which does not stop anything until arm_ctl() */
+static void init_ctl(search_ctl_t *ctl)
+{
+    pthread_mutex_init(&ctl->lock, NULL);
+    ctl->cancel = NULL;
+    ctl->progress = NULL;
+    ctl->progress_arg = NULL;
+    ctl->owner = pthread_self();
+    ctl->deadline = 0;
+    ctl->stop = 0;
+    ctl->ids_done = 0;
+    ctl->candidates = 0;
+}
+
+/* starts a search call with opts; other threads may poll ctl meanwhile */
+static void arm_ctl(search_ctl_t *ctl, const dc_opts *opts)
+{
+    double deadline;
+
+    deadline = (opts->time_limit > 0)
+	? monotonic_time() + opts->time_limit : 0;
+
+    pthread_mutex_lock(&ctl->lock);
+    ctl->cancel = opts->cancel;
+    ctl->progress = opts->progress;
+    ctl->progress_arg = opts->progress_arg;
+    ctl->owner = pthread_self();
+    ctl->deadline = deadline;
+    ctl->stop = 0;
+    ctl->ids_done = 0;
+    ctl->candidates = 0;
+    pthread_mutex_unlock(&ctl->lock);
 }
 
-static void end_mt_search(prescr_t *pre)
+/* ends the search call, telling *cancel why it was stopped */
+static void disarm_ctl(search_ctl_t *ctl)
 {
-    _EndPrescreening_dc(pre);
+    pthread_mutex_lock(&ctl->lock);
+    if ((0 != ctl->stop) && (NULL != ctl->cancel) && (0 == *ctl->cancel))
+	*ctl->cancel = ctl->stop;
+    ctl->cancel = NULL;
+    ctl->progress = NULL;
+    ctl->deadline = 0;
+    pthread_mutex_unlock(&ctl->lock);
+}
+
+/*
+   Sets up ctl for a search call with opts.  Returns NULL if the
+   search cannot be stopped, so that it does not pay for the polling.
+*/
+static search_ctl_t *start_ctl(search_ctl_t *ctl, const dc_opts *opts)
+{
+    if (!stoppable(opts)) return NULL;
+
+    init_ctl(ctl);
+    arm_ctl(ctl, opts);
+    return ctl;
+}
+
+/* called by the calling thread after all others have stopped */
+static void end_ctl(search_ctl_t *ctl)
+{
+    if (NULL == ctl) return;
+    disarm_ctl(ctl);
+    pthread_mutex_destroy(&ctl->lock);
+}
+
+/*
+   Adds the candidates drawn and IDs found by the calling thread since
+   its last report.  Returns nonzero if the search has to stop.
+*/
+int _PollSearch_dc(search_ctl_t *ctl, int candidates, int ids)
+{
+    int stop, ids_done, owner;
+    long total;
+    dc_progress_callback progress;
+    void *progress_arg;
+
+    if (NULL == ctl) return 0;
+
+    pthread_mutex_lock(&ctl->lock);
+    ctl->candidates += candidates;
+    ctl->ids_done += ids;
+    if (0 == ctl->stop) {
+	if ((NULL != ctl->cancel) && (0 != *ctl->cancel))
+	    ctl->stop = DC_CANCELLED;
+	else if ((ctl->deadline > 0) && (monotonic_time() >= ctl->deadline))
+	    ctl->stop = DC_TIMED_OUT;
+    }
+    stop = ctl->stop;
+    ids_done = ctl->ids_done;
+    total = ctl->candidates;
+    progress = ctl->progress;
+    progress_arg = ctl->progress_arg;
+    owner = pthread_equal(pthread_self(), ctl->owner);
+    pthread_mutex_unlock(&ctl->lock);
+
+    if ( (0 == stop) && (NULL != progress) && owner
+	 && (0 != progress(ids_done, total, progress_arg)) ) {
+	pthread_mutex_lock(&ctl->lock);
+	if (0 == ctl->stop) ctl->stop = DC_CANCELLED;
+	stop = ctl->stop;
+	pthread_mutex_unlock(&ctl->lock);
+    }
+
+    return stop;
+}
+
+static void end_mt_search(search_ws_t *ws)
+{
+    _EndPrescreening_dc(&ws->pre);
+    _EndCheck32_dc(&ws->ck);
+    _EndTempering_dc(&ws->temper);
 }
 
 /*
@@ -180,20 +879,20 @@ static void end_mt_search(prescr_t *pre)
 mt_struct *get_mt_parameter_st(int w, int p, uint32_t seed)
 {
     mt_struct *mts;
-    prescr_t pre;
     _org_state org;
-    check32_t ck;
+    search_ws_t ws;
 
     _sgenrand_dc(&org, seed);
-    mts = init_mt_search(&ck, &pre, w, p);
+    mts = init_mt_search(&ws, w, p, NULL);
     if (mts == NULL) return NULL;
 
-    if ( NOT_FOUND == get_irred_param(&ck, &pre, &org, mts,0,0) ) {
+    if ( NOT_FOUND == get_irred_param(&ws, &org, mts,0,0)
+	 || 0 != temper_param(&ws, mts) ) {
 	free_mt_struct(mts);
+	end_mt_search(&ws);
 	return NULL;
     }
-    _get_tempering_parameter_hard_dc(mts);
-    end_mt_search(&pre);
+    end_mt_search(&ws);
 
     return mts;
 }
@@ -205,18 +904,18 @@ mt_struct *get_mt_parameter_st(int w, int p, uint32_t seed)
 mt_struct *get_mt_parameter(int w, int p)
 {
     mt_struct *mts;
-    prescr_t pre;
-    check32_t ck;
+    search_ws_t ws;
 
-    mts = init_mt_search(&ck, &pre, w, p);
+    mts = init_mt_search(&ws, w, p, NULL);
     if (mts == NULL) return NULL;
 
-    if ( NOT_FOUND == get_irred_param(&ck, &pre, &global_mt19937, mts,0,0) ) {
+    if ( NOT_FOUND == get_irred_param(&ws, &global_mt19937, mts,0,0)
+	 || 0 != temper_param(&ws, mts) ) {
 	free_mt_struct(mts);
+	end_mt_search(&ws);
 	return NULL;
     }
-    _get_tempering_parameter_hard_dc(mts);
-    end_mt_search(&pre);
+    end_mt_search(&ws);
 
     return mts;
 }
@@ -229,20 +928,20 @@ mt_struct *get_mt_parameter(int w, int p)
 mt_struct *get_mt_parameter_opt_temper(int w, int p, uint32_t seed)
 {
     mt_struct *mts;
-    prescr_t pre;
     _org_state org;
-    check32_t ck;
+    search_ws_t ws;
 
     _sgenrand_dc(&org, seed);
-    mts = init_mt_search(&ck, &pre, w, p);
+    mts = init_mt_search(&ws, w, p, NULL);
     if (mts == NULL) return NULL;
 
-    if ( NOT_FOUND == get_irred_param(&ck, &pre, &org, mts,0,0) ) {
+    if ( NOT_FOUND == get_irred_param(&ws, &org, mts,0,0)
+	 || 0 != temper_param(&ws, mts) ) {
 	free_mt_struct(mts);
+	end_mt_search(&ws);
 	return NULL;
     }
-    _get_tempering_parameter_hard_dc(mts);
-    end_mt_search(&pre);
+    end_mt_search(&ws);
 
     return mts;
 }
@@ -254,11 +953,26 @@ mt_struct *get_mt_parameter_opt_temper(int w, int p, uint32_t seed)
 #define DEFAULT_ID_SIZE 16
 /* id <= 0xffff */
 mt_struct *get_mt_parameter_id_st(int w, int p, int id, uint32_t seed)
+{
+    return get_mt_parameter_id_opt_st(w, p, id, seed, NULL);
+}
+
+/*
+   opts == NULL means the defaults.  With opts->n_threads > 1 the
+   candidates are checked by that many threads; the result is the same.
+   Returns NULL also if the search was stopped, see dc_opts.cancel.
+*/
+mt_struct *get_mt_parameter_id_opt_st(int w, int p, int id, uint32_t seed,
+				      const dc_opts *opts)
 {
     mt_struct *mts;
-    prescr_t pre;
     _org_state org;
-    check32_t ck;
+    search_ws_t ws;
+    search_ctl_t ctl;
+    dc_cache_t cache;
+    dc_cache_key_t key;
+    dc_stats *stats;
+    int found;
 
     _sgenrand_dc(&org, seed);
     if (id > 0xffff) {
@@ -269,17 +983,45 @@ mt_struct *get_mt_parameter_id_st(int w, int p, int id, uint32_t seed)
 	printf("\"id\" must be positive\n");
 	return NULL;
     }
+    if (!check_opts(opts)) return NULL;
+    if (!check_mt_params(w, p)) return NULL;
+
+    stats = reset_stats(opts, 0);
+    cache_key(&key, DC_CACHE_SINGLE, w, p, id, seed, 0, opts);
+    _OpenCache_dc(&cache);
+    mts = cached_mt_struct(&cache, &key);
+    if (NULL != mts) {
+	_CloseCache_dc(&cache);
+	return mts;
+    }
 
-    mts = init_mt_search(&ck, &pre, w, p);
-    if (mts == NULL) return NULL;
+    mts = init_mt_search(&ws, w, p, opts);
+    if (mts == NULL) {
+	_CloseCache_dc(&cache);
+	return NULL;
+    }
 
-    if ( NOT_FOUND == get_irred_param(&ck, &pre, &org,
-				      mts, id, DEFAULT_ID_SIZE) ) {
+    ws.ctl = ws.ck.ctl = start_ctl(&ctl, opts);
+    ws.stats = stats;
+    if (NULL != opts && opts->n_threads > 1) {
+	ws.temper.n_threads = opts->n_threads;
+	found = get_irred_param_spec(&ws, &org, mts, id, DEFAULT_ID_SIZE,
+				     opts->n_threads);
+    }
+    else
+	found = get_irred_param(&ws, &org, mts, id, DEFAULT_ID_SIZE);
+    if ( NOT_FOUND == found
+	 || 0 != temper_param(&ws, mts) ) {
 	free_mt_struct(mts);
+	end_mt_search(&ws);
+	end_ctl(ws.ctl);
+	_CloseCache_dc(&cache);
 	return NULL;
     }
-    _get_tempering_parameter_hard_dc(mts);
-    end_mt_search(&pre);
+    end_mt_search(&ws);
+    end_ctl(ws.ctl);
+    _CacheStore_dc(&cache, &key, mts);
+    _CloseCache_dc(&cache);
 
     return mts;
 }
@@ -287,8 +1029,7 @@ mt_struct *get_mt_parameter_id_st(int w, int p, int id, uint32_t seed)
 mt_struct *get_mt_parameter_id(int w, int p, int id)
 {
     mt_struct *mts;
-    prescr_t pre;
-    check32_t ck;
+    search_ws_t ws;
 
     if (id > 0xffff) {
 	printf("\"id\" must be less than 65536\n");
@@ -299,16 +1040,17 @@ mt_struct *get_mt_parameter_id(int w, int p, int id)
 	return NULL;
     }
 
-    mts = init_mt_search(&ck, &pre, w, p);
+    mts = init_mt_search(&ws, w, p, NULL);
     if (mts == NULL) return NULL;
 
-    if ( NOT_FOUND == get_irred_param(&ck, &pre, &global_mt19937,
-				      mts, id, DEFAULT_ID_SIZE) ) {
+    if ( NOT_FOUND == get_irred_param(&ws, &global_mt19937,
+				      mts, id, DEFAULT_ID_SIZE)
+	 || 0 != temper_param(&ws, mts) ) {
 	free_mt_struct(mts);
+	end_mt_search(&ws);
 	return NULL;
     }
-    _get_tempering_parameter_hard_dc(mts);
-    end_mt_search(&pre);
+    end_mt_search(&ws);
 
     return mts;
 }
@@ -316,46 +1058,71 @@ mt_struct *get_mt_parameter_id(int w, int p, int id)
 mt_struct **get_mt_parameters_st(int w, int p, int start_id,
 				 int max_id, uint32_t seed, int *count)
 {
-    mt_struct **mtss, *template_mts;
+    return get_mt_parameters_opt_st(w, p, start_id, max_id, seed, NULL,
+				    count);
+}
+
+/* collects the generators of get_mt_parameters_opt_st() */
+typedef struct {
+    mt_struct **mtss;
+    int count;
+} collect_t;
+
+static int collect_mt_struct(mt_struct *mts, int id, void *arg)
+{
+    collect_t *collect = (collect_t *)arg;
+
+    collect->mtss[collect->count++] = mts;
+    return 0;
+}
+
+/* opts == NULL means the defaults */
+mt_struct **get_mt_parameters_opt_st(int w, int p, int start_id, int max_id,
+				     uint32_t seed, const dc_opts *opts,
+				     int *count)
+{
+    mt_struct **mtss;
+    mt_range_search *search;
+    collect_t collect;
     int i;
-    prescr_t pre;
-    _org_state org;
-    check32_t ck;
+    dc_cache_t cache;
+    dc_cache_key_t key;
 
-    if ((start_id > max_id) || (max_id > 0xffff) || (start_id < 0)) {
-	printf("\"id\" error\n");
-	return NULL;
-    }
+    search = new_mt_range_search(w, p, start_id, max_id, seed, opts);
+    if (NULL == search) return NULL;
 
-    _sgenrand_dc(&org, seed);
     mtss = (mt_struct**)malloc(sizeof(mt_struct*)*(max_id-start_id+1));
-    if (NULL == mtss) return NULL;
-
-    template_mts = init_mt_search(&ck, &pre, w, p);
-    if (template_mts == NULL) {
-	free(mtss);
+    if (NULL == mtss) {
+	free_mt_range_search(search);
 	return NULL;
     }
-    *count = 0;
-    for (i=0; i<=max_id-start_id; i++) {
-	mtss[i] = alloc_mt_struct(template_mts->nn);
-	if (NULL == mtss[i]) {
-	    break;
-	}
-
-	copy_params_of_mt_struct(template_mts, mtss[i]);
 
-	if ( NOT_FOUND == get_irred_param(&ck, &pre, &org, mtss[i],
-					  i+start_id,DEFAULT_ID_SIZE) ) {
-	    free_mt_struct(mtss[i]);
-	    break;
+    if (search->opts.n_threads == 0) {
+	/* the IDs share one stream, so the range is cached as a whole */
+	_OpenCache_dc(&cache);
+	for (i=0; i<=max_id-start_id; i++) {
+	    cache_key(&key, DC_CACHE_RANGE, w, p, i+start_id, seed, start_id,
+		      opts);
+	    mtss[i] = cached_mt_struct(&cache, &key);
+	    if (NULL == mtss[i]) break;
+	    reset_stats(opts, i);
 	}
-	_get_tempering_parameter_hard_dc(mtss[i]);
-	++(*count);
+	_CloseCache_dc(&cache);
+	if (i > max_id-start_id) {
+	    free_mt_range_search(search);
+	    *count = i;
+	    return mtss;
+	}
+	while (i > 0)
+	    free_mt_struct(mtss[--i]);
     }
 
-    free_mt_struct(template_mts);
-    end_mt_search(&pre);
+    collect.mtss = mtss;
+    collect.count = 0;
+    run_mt_range_search(search, collect_mt_struct, &collect);
+    free_mt_range_search(search);
+
+    *count = collect.count;
     if (*count > 0) {
 	return mtss;
     } else {
@@ -368,8 +1135,7 @@ mt_struct **get_mt_parameters(int w, int p, int max_id, int *count)
 {
     mt_struct **mtss, *template_mts;
     int i;
-    prescr_t pre;
-    check32_t ck;
+    search_ws_t ws;
     int start_id = 0;
 
     if ((start_id > max_id) || (max_id > 0xffff) || (start_id < 0)) {
@@ -380,7 +1146,7 @@ mt_struct **get_mt_parameters(int w, int p, int max_id, int *count)
     mtss = (mt_struct**)malloc(sizeof(mt_struct*)*(max_id-start_id+1));
     if (NULL == mtss) return NULL;
 
-    template_mts = init_mt_search(&ck, &pre, w, p);
+    template_mts = init_mt_search(&ws, w, p, NULL);
     if (template_mts == NULL) {
 	free(mtss);
 	return NULL;
@@ -394,17 +1160,17 @@ mt_struct **get_mt_parameters(int w, int p, int max_id, int *count)
 
 	copy_params_of_mt_struct(template_mts, mtss[i]);
 
-	if ( NOT_FOUND == get_irred_param(&ck, &pre, &global_mt19937, mtss[i],
-					  i+start_id,DEFAULT_ID_SIZE) ) {
+	if ( NOT_FOUND == get_irred_param(&ws, &global_mt19937, mtss[i],
+					  i+start_id,DEFAULT_ID_SIZE)
+	     || 0 != temper_param(&ws, mtss[i]) ) {
 	    free_mt_struct(mtss[i]);
 	    break;
 	}
-	_get_tempering_parameter_hard_dc(mtss[i]);
 	++(*count);
     }
 
     free_mt_struct(template_mts);
-    end_mt_search(&pre);
+    end_mt_search(&ws);
     if (*count > 0) {
 	return mtss;
     } else {
@@ -413,6 +1179,521 @@ mt_struct **get_mt_parameters(int w, int p, int max_id, int *count)
     }
 }
 
+/*
+   Streaming range search.  The generators are passed to the callback
+   in the order of IDs as soon as they are found, and the search can
+   be stopped after any of them and resumed later from a checkpoint,
+   also in another process.
+*/
+
+/* the checkpoint: the fields below, org and a checksum of them all */
+#define CHECKPOINT_MAGIC UINT32_C(0x4b434344) /* "DCCK" */
+#define CHECKPOINT_VERSION 2
+#define CHECKPOINT_FIELDS 11
+#define CHECKPOINT_WORDS (CHECKPOINT_FIELDS + N + 2)
+typedef char checkpoint_fits[(CHECKPOINT_WORDS*4 <= MT_RANGE_CHECKPOINT_SIZE)
+			     ? 1 : -1];
+
+/*
+   Workers of a threaded range search.  They keep running between the
+   calls of run_mt_range_search(), but search at most RANGE_AHEAD IDs
+   per thread beyond the ones passed to the callback.
+*/
+#define RANGE_AHEAD 8
+
+typedef struct RANGE_JOB_T {
+    int w, p;
+    int start_id; /* the first ID of the job */
+    int n_ids;
+    uint32_t seed;
+    dc_opts opts;
+    mt_struct **mtss;
+    char *done; /* mtss[i] is final (NULL if the search failed) */
+    int next; /* next ID (offset from start_id) to be searched */
+    int limit; /* IDs from limit on wait for the callbacks */
+    int fail; /* lowest ID offset which failed or is not needed */
+    int n_running; /* workers which have not returned yet */
+    int n_started;
+    pthread_t *threads;
+    search_ctl_t ctl; /* armed by every run_range_mt() */
+    int stoppable;
+    pthread_mutex_t lock;
+    pthread_cond_t cond; /* signalled when an ID is done, limit or fail
+			    changes */
+} range_job_t;
+
+/* seed of the mt19937 stream the candidates for "id" are drawn from */
+static uint32_t id_seed(uint32_t seed, int id)
+{
+    uint32_t x;
+
+    /* murmur3 finalizer; a bijection, so every id gets its own seed */
+    x = seed ^ ((uint32_t)id * UINT32_C(0x9e3779b9));
+    x ^= x >> 16;
+    x *= UINT32_C(0x85ebca6b);
+    x ^= x >> 13;
+    x *= UINT32_C(0xc2b2ae35);
+    x ^= x >> 16;
+
+    return x;
+}
+
+static void *range_worker(void *arg)
+{
+    range_job_t *job = (range_job_t *)arg;
+    mt_struct *template_mts, *mts;
+    int i;
+    _org_state org;
+    search_ws_t ws;
+    dc_cache_t cache;
+    dc_cache_key_t key;
+
+    template_mts = init_mt_search(&ws, job->w, job->p, &job->opts);
+    if (template_mts != NULL) {
+	ws.ctl = ws.ck.ctl = job->stoppable ? &job->ctl : NULL;
+	/* every thread needs its own file lock */
+	_OpenCache_dc(&cache);
+
+	for (;;) {
+	    pthread_mutex_lock(&job->lock);
+	    while ((job->next >= job->limit) && (job->next < job->fail))
+		pthread_cond_wait(&job->cond, &job->lock);
+	    i = job->next++;
+	    if (i >= job->fail) {
+		pthread_mutex_unlock(&job->lock);
+		break;
+	    }
+	    pthread_mutex_unlock(&job->lock);
+
+	    ws.stats = reset_stats(&job->opts, i);
+	    cache_key(&key, DC_CACHE_ID_STREAM, job->w, job->p,
+		      i+job->start_id, job->seed, 0, &job->opts);
+	    mts = cached_mt_struct(&cache, &key);
+	    if (NULL == mts) {
+		mts = alloc_mt_struct(template_mts->nn);
+		if (NULL != mts) {
+		    copy_params_of_mt_struct(template_mts, mts);
+		    _sgenrand_dc(&org, id_seed(job->seed, i+job->start_id));
+		    if ( NOT_FOUND == get_irred_param(&ws, &org, mts,
+						      i+job->start_id,
+						      DEFAULT_ID_SIZE)
+			 || 0 != temper_param(&ws, mts) ) {
+			free_mt_struct(mts);
+			mts = NULL;
+		    }
+		    else
+			_CacheStore_dc(&cache, &key, mts);
+		}
+	    }
+
+	    pthread_mutex_lock(&job->lock);
+	    /* IDs after the failed one will be thrown away anyway */
+	    if (NULL == mts && i < job->fail) job->fail = i;
+	    job->mtss[i] = mts;
+	    job->done[i] = 1;
+	    pthread_cond_broadcast(&job->cond);
+	    pthread_mutex_unlock(&job->lock);
+	}
+
+	free_mt_struct(template_mts);
+	end_mt_search(&ws);
+	_CloseCache_dc(&cache);
+    }
+
+    pthread_mutex_lock(&job->lock);
+    job->n_running--;
+    pthread_cond_broadcast(&job->cond);
+    pthread_mutex_unlock(&job->lock);
+    return NULL;
+}
+
+/*
+   Same as get_mt_parameters_st(), but the IDs are searched by
+   n_threads threads.  Every ID draws its candidates from its own
+   mt19937 stream derived from (seed, id), so the result is the same
+   for any n_threads (and differs from get_mt_parameters_st()).
+*/
+mt_struct **get_mt_parameters_mt_st(int w, int p, int start_id, int max_id,
+				    uint32_t seed, int n_threads, int *count)
+{
+    dc_opts opts;
+
+    if (n_threads < 1) {
+	printf("\"n_threads\" must be positive\n");
+	return NULL;
+    }
+    init_dc_opts(&opts);
+    opts.n_threads = n_threads;
+
+    return get_mt_parameters_opt_st(w, p, start_id, max_id, seed, &opts,
+				    count);
+}
+
+/*
+   Returns NULL if the parameters are wrong or out of memory.  With
+   opts->n_threads > 0 the search is threaded (the IDs are searched as
+   by get_mt_parameters_mt_st()), otherwise serial.  opts->stats, if
+   set, needs an entry for every ID from start_id to max_id.
+*/
+mt_range_search *new_mt_range_search(int w, int p, int start_id, int max_id,
+				     uint32_t seed, const dc_opts *opts)
+{
+    mt_range_search *search;
+
+    if ((start_id > max_id) || (max_id > 0xffff) || (start_id < 0)) {
+	printf("\"id\" error\n");
+	return NULL;
+    }
+    if (!check_opts(opts)) return NULL;
+    if (!check_mt_params(w, p)) return NULL;
+
+    search = (mt_range_search *)malloc(sizeof(mt_range_search));
+    if (NULL == search) return NULL;
+    search->w = w;
+    search->p = p;
+    search->start_id = start_id;
+    search->max_id = max_id;
+    search->seed = seed;
+    if (NULL != opts)
+	search->opts = *opts;
+    else
+	init_dc_opts(&search->opts);
+    search->next_id = start_id;
+    _sgenrand_dc(&search->org, seed);
+    search->job = NULL;
+
+    return search;
+}
+
+void free_mt_range_search(mt_range_search *search)
+{
+    end_range_job(search);
+    free(search);
+}
+
+/* the first ID which has not been passed to the callback yet */
+int mt_range_search_next_id(const mt_range_search *search)
+{
+    return search->next_id;
+}
+
+/* Writes MT_RANGE_CHECKPOINT_SIZE bytes to checkpoint */
+void mt_range_search_checkpoint(const mt_range_search *search,
+				void *checkpoint)
+{
+    uint32_t words[CHECKPOINT_WORDS];
+    int i;
+
+    words[0] = CHECKPOINT_MAGIC;
+    words[1] = CHECKPOINT_VERSION;
+    words[2] = search->w;
+    words[3] = search->p;
+    words[4] = search->start_id;
+    words[5] = search->max_id;
+    words[6] = search->seed;
+    words[7] = search->opts.n_threads;
+    words[8] = search->opts.period_check;
+    words[9] = search->next_id;
+    words[10] = search->opts.temper_depth;
+    for (i=0; i<N; i++)
+	words[CHECKPOINT_FIELDS + i] = search->org.mt[i];
+    words[CHECKPOINT_FIELDS + N] = search->org.mti;
+    words[CHECKPOINT_WORDS - 1]
+	= _fnv1a_dc(words, (CHECKPOINT_WORDS - 1)*sizeof(uint32_t));
+
+    memset(checkpoint, 0, MT_RANGE_CHECKPOINT_SIZE);
+    memcpy(checkpoint, words, sizeof(words));
+}
+
+/*
+   Continues the search saved by mt_range_search_checkpoint().
+   opts == NULL means the options of the saved search; otherwise the
+   search must be threaded (or serial) as the saved one was.  Returns
+   NULL if the checkpoint is broken or out of memory.
+*/
+mt_range_search *resume_mt_range_search(const void *checkpoint,
+					const dc_opts *opts)
+{
+    uint32_t words[CHECKPOINT_WORDS];
+    mt_range_search *search;
+    dc_opts saved;
+    int i;
+
+    memcpy(words, checkpoint, sizeof(words));
+    if ( (words[0] != CHECKPOINT_MAGIC)
+	 || (words[1] != CHECKPOINT_VERSION)
+	 || (words[CHECKPOINT_WORDS - 1]
+	     != _fnv1a_dc(words, (CHECKPOINT_WORDS - 1)*sizeof(uint32_t)))
+	 || ((int)words[9] < (int)words[4])
+	 || ((int)words[9] > (int)words[5] + 1)
+	 || (words[CHECKPOINT_FIELDS + N] > N) ) {
+	printf("broken checkpoint\n");
+	return NULL;
+    }
+
+    init_dc_opts(&saved);
+    saved.n_threads = words[7];
+    saved.period_check = words[8];
+    saved.temper_depth = words[10];
+    if (NULL == opts)
+	opts = &saved;
+    else if ((opts->n_threads > 0) != (saved.n_threads > 0)) {
+	printf("\"n_threads\" does not match the checkpoint\n");
+	return NULL;
+    }
+    else if (opts->temper_depth != saved.temper_depth) {
+	printf("\"temper_depth\" does not match the checkpoint\n");
+	return NULL;
+    }
+
+    search = new_mt_range_search(words[2], words[3], words[4], words[5],
+				 words[6], opts);
+    if (NULL == search) return NULL;
+    search->next_id = words[9];
+    for (i=0; i<N; i++)
+	search->org.mt[i] = words[CHECKPOINT_FIELDS + i];
+    search->org.mti = words[CHECKPOINT_FIELDS + N];
+
+    return search;
+}
+
+static int run_range_serial(mt_range_search *search,
+			    mt_range_callback callback, void *arg)
+{
+    mt_struct *template_mts, *mts;
+    search_ws_t ws;
+    search_ctl_t ctl_space, *ctl;
+    _org_state org;
+    dc_cache_t cache;
+    dc_cache_key_t key;
+    int res;
+
+    template_mts = init_mt_search(&ws, search->w, search->p, &search->opts);
+    if (template_mts == NULL) return MT_RANGE_FAILED;
+    ctl = start_ctl(&ctl_space, &search->opts);
+    ws.ctl = ws.ck.ctl = ctl;
+    _OpenCache_dc(&cache);
+
+    res = MT_RANGE_DONE;
+    while (search->next_id <= search->max_id) {
+	mts = alloc_mt_struct(template_mts->nn);
+	if (NULL == mts) {
+	    res = MT_RANGE_FAILED;
+	    break;
+	}
+	copy_params_of_mt_struct(template_mts, mts);
+
+	/* a failed ID does not move the stream of the checkpoint */
+	org = search->org;
+	ws.stats = reset_stats(&search->opts,
+			       search->next_id - search->start_id);
+	if ( NOT_FOUND == get_irred_param(&ws, &org, mts,
+					  search->next_id, DEFAULT_ID_SIZE)
+	     || 0 != temper_param(&ws, mts) ) {
+	    free_mt_struct(mts);
+	    res = (0 != _PollSearch_dc(ctl, 0, 0)) ? MT_RANGE_CANCELLED
+		: MT_RANGE_FAILED;
+	    break;
+	}
+	search->org = org;
+	cache_key(&key, DC_CACHE_RANGE, search->w, search->p,
+		  search->next_id, search->seed, search->start_id,
+		  &search->opts);
+	_CacheStore_dc(&cache, &key, mts);
+
+	if (0 != callback(mts, search->next_id++, arg)) {
+	    res = MT_RANGE_STOPPED;
+	    break;
+	}
+	if (0 != _PollSearch_dc(ctl, 0, 1)) {
+	    res = MT_RANGE_CANCELLED;
+	    break;
+	}
+    }
+
+    free_mt_struct(template_mts);
+    end_mt_search(&ws);
+    end_ctl(ctl);
+    _CloseCache_dc(&cache);
+    return res;
+}
+
+/* starts the workers for the IDs from search->next_id on */
+static int start_range_job(mt_range_search *search)
+{
+    range_job_t *job;
+    int n_threads;
+
+    job = (range_job_t *)malloc(sizeof(range_job_t));
+    if (NULL == job) return -1;
+    job->opts = search->opts;
+    /* the statistics of the job are indexed from its start_id, too */
+    if (NULL != job->opts.stats)
+	job->opts.stats += search->next_id - search->start_id;
+    job->w = search->w;
+    job->p = search->p;
+    job->start_id = search->next_id;
+    job->n_ids = search->max_id - search->next_id + 1;
+    job->seed = search->seed;
+    job->next = 0;
+    job->fail = job->n_ids;
+    job->stoppable = stoppable(&search->opts);
+    n_threads = job->opts.n_threads;
+    if (n_threads > job->n_ids) n_threads = job->n_ids;
+    job->limit = RANGE_AHEAD * n_threads;
+    job->mtss = (mt_struct**)calloc(job->n_ids, sizeof(mt_struct*));
+    job->done = (char*)calloc(job->n_ids, sizeof(char));
+    job->threads = (pthread_t*)malloc(sizeof(pthread_t)*n_threads);
+    if (NULL == job->mtss || NULL == job->done || NULL == job->threads) {
+	free(job->mtss);
+	free(job->done);
+	free(job->threads);
+	free(job);
+	return -1;
+    }
+
+    init_ctl(&job->ctl);
+    pthread_mutex_init(&job->lock, NULL);
+    pthread_cond_init(&job->cond, NULL);
+    job->n_running = n_threads;
+    for (job->n_started=0; job->n_started<n_threads; job->n_started++) {
+	if (0 != pthread_create(&job->threads[job->n_started], NULL,
+				range_worker, job))
+	    break;
+    }
+    pthread_mutex_lock(&job->lock);
+    job->n_running -= n_threads - job->n_started;
+    pthread_mutex_unlock(&job->lock);
+    search->job = job;
+    if (job->n_started == 0) {
+	/* no threads: search everything, then pass it on */
+	job->n_running = 1;
+	job->limit = job->n_ids;
+	range_worker(job);
+    }
+
+    return 0;
+}
+
+/* stops the workers and frees the IDs not passed to the callback */
+static void end_range_job(mt_range_search *search)
+{
+    range_job_t *job = search->job;
+    int i;
+
+    if (NULL == job) return;
+
+    /* the workers finish the IDs they have started */
+    pthread_mutex_lock(&job->lock);
+    if (search->next_id - job->start_id < job->fail)
+	job->fail = search->next_id - job->start_id;
+    pthread_cond_broadcast(&job->cond);
+    pthread_mutex_unlock(&job->lock);
+    for (i=0; i<job->n_started; i++)
+	pthread_join(job->threads[i], NULL);
+    pthread_cond_destroy(&job->cond);
+    pthread_mutex_destroy(&job->lock);
+    pthread_mutex_destroy(&job->ctl.lock);
+
+    for (i=0; i<job->n_ids; i++) {
+	if (NULL != job->mtss[i]) free_mt_struct(job->mtss[i]);
+    }
+    free(job->mtss);
+    free(job->done);
+    free(job->threads);
+    free(job);
+    search->job = NULL;
+}
+
+/* the callbacks are called by the calling thread only */
+static int run_range_mt(mt_range_search *search,
+			mt_range_callback callback, void *arg)
+{
+    range_job_t *job;
+    search_ctl_t *ctl;
+    mt_struct *mts;
+    struct timespec ts;
+    int k, res;
+
+    if (NULL == search->job && 0 != start_range_job(search))
+	return MT_RANGE_FAILED;
+    job = search->job;
+    ctl = job->stoppable ? &job->ctl : NULL;
+    if (NULL != ctl) arm_ctl(ctl, &search->opts);
+
+    res = MT_RANGE_DONE;
+    for (k=search->next_id-job->start_id; k<job->n_ids; k++) {
+	pthread_mutex_lock(&job->lock);
+	while (!job->done[k] && job->n_running > 0) {
+	    if (NULL == ctl) {
+		pthread_cond_wait(&job->cond, &job->lock);
+		continue;
+	    }
+	    /* the progress callback is called while waiting, too */
+	    clock_gettime(CLOCK_REALTIME, &ts);
+	    ts.tv_nsec += 100000000;
+	    if (ts.tv_nsec >= 1000000000) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000;
+	    }
+	    pthread_cond_timedwait(&job->cond, &job->lock, &ts);
+	    pthread_mutex_unlock(&job->lock);
+	    if (0 != _PollSearch_dc(ctl, 0, 0)) {
+		/* the workers see the stop on their next poll */
+		pthread_mutex_lock(&job->lock);
+		break;
+	    }
+	    pthread_mutex_lock(&job->lock);
+	}
+	mts = job->done[k] ? job->mtss[k] : NULL;
+	job->mtss[k] = NULL;
+	if (NULL != mts) {
+	    job->limit = k + 1 + RANGE_AHEAD * job->n_started;
+	    pthread_cond_broadcast(&job->cond);
+	}
+	pthread_mutex_unlock(&job->lock);
+
+	if (NULL == mts) {
+	    res = (0 != _PollSearch_dc(ctl, 0, 0)) ? MT_RANGE_CANCELLED
+		: MT_RANGE_FAILED;
+	    break;
+	}
+	if (0 != callback(mts, search->next_id++, arg)) {
+	    res = MT_RANGE_STOPPED;
+	    break;
+	}
+	if (0 != _PollSearch_dc(ctl, 0, 1)) {
+	    res = MT_RANGE_CANCELLED;
+	    break;
+	}
+    }
+
+    if (NULL != ctl) disarm_ctl(ctl);
+    /* the workers keep searching ahead for the next run */
+    if (res != MT_RANGE_STOPPED || search->next_id > search->max_id)
+	end_range_job(search);
+    return res;
+}
+
+/*
+   Searches the IDs from mt_range_search_next_id() on and passes every
+   generator to the callback, which owns it from then on.  Returns
+   MT_RANGE_DONE when all IDs are done, MT_RANGE_STOPPED if the
+   callback returned nonzero, MT_RANGE_CANCELLED if the search was
+   stopped by its options (see dc_opts.cancel), or MT_RANGE_FAILED if
+   no generator was found for the next ID (or out of memory).  In any
+   case the search can be continued or saved with
+   mt_range_search_checkpoint().
+*/
+int run_mt_range_search(mt_range_search *search,
+			mt_range_callback callback, void *arg)
+{
+    if (search->next_id > search->max_id) return MT_RANGE_DONE;
+    if (search->opts.n_threads > 0)
+	return run_range_mt(search, callback, arg);
+    return run_range_serial(search, callback, arg);
+}
+
 /* n : sizeof state vector */
 static mt_struct *alloc_mt_struct(int n)
 {
@@ -425,6 +1706,7 @@ static mt_struct *alloc_mt_struct(int n)
 	free(mts);
 	return NULL;
     }
+    mts->i = 0;
 
     return mts;
 }
@@ -3,8 +3,8 @@
 #include <stddef.h>
 
 void sgenrand(uint32_t seed, mt_struct *mts);
-uint32_t random_uint32(mt_struct *mt);
-double random_float(mt_struct *mt);
+uint32_t random_uint32(mt_struct *mt, dcmt_next_state_fn next_state);
+double random_float(mt_struct *mt, dcmt_next_state_fn next_state);
 
 // Modified genmtrand.c::sgenrand_mt(), taken from nVidia Cuda SDK 4.0
 //
@@ -30,39 +30,15 @@ static void sgenrand_mt_modified(uint32_t seed, mt_struct *mts){
 
 
 // Slightly optimised reference implementation of the Mersenne Twister,
-// taken from numpy 1.5.1
-// (replaced "x&1U ? aa : 0U" with "-(x & 1) & aa")
-static uint32_t genrand_mt_modified(mt_struct *mts)
+// taken from numpy 1.5.1; the state is regenerated by next_state, the
+// kernel of genmtrand.c for mts (dcmt_next_state_kernel()), which gives
+// the same words
+static uint32_t genrand_mt_modified(mt_struct *mts, dcmt_next_state_fn next_state)
 {
-	uint32_t *st, uuu, lll, aa, x;
-	int k,n,m,lim;
+	uint32_t x;
 
 	if(mts->i == mts->nn)
-	{
-		n = mts->nn; m = mts->mm;
-		aa = mts->aaa;
-		st = mts->state;
-		uuu = mts->umask; lll = mts->lmask;
-
-		lim = n - m;
-		for(k = 0; k < lim; k++)
-		{
-			x = (st[k] & uuu) | (st[k+1] & lll);
-			st[k] = st[k+m] ^ (x>>1) ^ (-(x & 1) & aa);
-		}
-
-		lim = n - 1;
-		for (; k < lim; k++)
-		{
-			x = (st[k] & uuu) | (st[k+1] & lll);
-			st[k] = st[k+m-n] ^ (x>>1) ^ (-(x & 1) & aa);
-		}
-
-		x = (st[n-1] & uuu) | (st[0] & lll);
-		st[n-1] = st[m-1] ^ (x >> 1) ^ (-(x & 1) & aa);
-
-		mts->i = 0;
-	}
+		next_state(mts);
 
 	x = mts->state[mts->i];
 	mts->i += 1;
@@ -84,9 +60,9 @@ void sgenrand(uint32_t seed, mt_struct *mts)
 	sgenrand_mt_modified(seed, mts);
 }
 
-uint32_t random_uint32(mt_struct *mt)
+uint32_t random_uint32(mt_struct *mt, dcmt_next_state_fn next_state)
 {
-	return genrand_mt_modified(mt);
+	return genrand_mt_modified(mt, next_state);
 }
 
 // Taken from Python standard library
@@ -99,10 +75,10 @@ uint32_t random_uint32(mt_struct *mt)
 * lower 26 bits of the 53-bit numerator.
 * The orginal code credited Isaku Wada for this algorithm, 2002/01/09.
 */
-double random_float(mt_struct *mt)
+double random_float(mt_struct *mt, dcmt_next_state_fn next_state)
 {
 	// Theoretically should support any randoms starting from 27 bit and larger
 	int ww = mt->ww;
-	uint32_t a = random_uint32(mt) >> (ww - 32 + 5), b = random_uint32(mt) >> (ww - 32 + 6);
+	uint32_t a = random_uint32(mt, next_state) >> (ww - 32 + 5), b = random_uint32(mt, next_state) >> (ww - 32 + 6);
 	return (double)((a * 67108864.0 + b) * (1.0 / 9007199254740992.0));
 }
@@ -1,3 +1,3 @@
 void sgenrand(uint32_t seed, mt_struct *mts);
-uint32_t random_uint32(mt_struct *mt);
-double random_float(mt_struct *mt);
+uint32_t random_uint32(mt_struct *mt, dcmt_next_state_fn next_state);
+double random_float(mt_struct *mt, dcmt_next_state_fn next_state);
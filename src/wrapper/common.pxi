@@ -13,11 +13,14 @@ cdef extern from "Python.h":
 	long PyInt_AsLong(object io)
 	object PyLong_FromUnsignedLong(unsigned long v)
 	object PyFloat_FromDouble(double v)
+	int PyErr_CheckSignals()
+	void *PyErr_Occurred()
 
 cdef extern from "inttypes.h":
 	ctypedef unsigned int uint32_t
 
-cdef extern from "dc.h":
+# the searches run without the GIL
+cdef extern from "dc.h" nogil:
 
 	ctypedef struct mt_struct:
 		uint32_t aaa
@@ -28,24 +31,92 @@ cdef extern from "dc.h":
 		int i
 		uint32_t *state
 
+	enum:
+		DC_PERIOD_DECIMATION
+		DC_PERIOD_BM
+		DC_PERIOD_BITSLICED
+		DC_CANCELLED
+		DC_TIMED_OUT
+		DC_TEMPER_GREEDY
+		DC_TEMPER_HARD
+
+	ctypedef int (*dc_progress_callback)(int ids_done, long candidates, void *arg)
+
+	ctypedef struct dc_stats:
+		long candidates
+		long rejected
+		long period_checks
+		long mask_nodes
+		long masks_pruned
+		int k_deficit
+		double prescreen_time
+		double period_time
+		double temper_time
+
+	ctypedef struct dc_opts:
+		int n_threads
+		int period_check
+		double time_limit
+		int *cancel
+		dc_progress_callback progress
+		void *progress_arg
+		dc_stats *stats
+		int temper_prune
+		int temper_depth
+
 	# new interface
 	mt_struct *get_mt_parameter_id_st(int w, int p, int id, uint32_t seed)
 	mt_struct **get_mt_parameters_st(int w, int p, int start_id, int max_id,
 					 uint32_t seed, int *count)
+	mt_struct **get_mt_parameters_mt_st(int w, int p, int start_id, int max_id,
+					 uint32_t seed, int n_threads, int *count)
+	void init_dc_opts(dc_opts *opts)
+	mt_struct *get_mt_parameter_id_opt_st(int w, int p, int id, uint32_t seed,
+					 dc_opts *opts)
+	mt_struct **get_mt_parameters_opt_st(int w, int p, int start_id, int max_id,
+					 uint32_t seed, dc_opts *opts, int *count)
+	int set_mt_cache_file(char *path)
+
+	# streaming range search
+	ctypedef struct mt_range_search:
+		pass
+	ctypedef int (*mt_range_callback)(mt_struct *mts, int id, void *arg)
+	enum:
+		MT_RANGE_DONE
+		MT_RANGE_STOPPED
+		MT_RANGE_FAILED
+		MT_RANGE_CANCELLED
+	mt_range_search *new_mt_range_search(int w, int p, int start_id, int max_id,
+					 uint32_t seed, dc_opts *opts)
+	int run_mt_range_search(mt_range_search *search,
+					 mt_range_callback callback, void *arg)
+	int mt_range_search_next_id(mt_range_search *search)
+	void free_mt_range_search(mt_range_search *search)
 	# common
 	void free_mt_struct(mt_struct *mts)
 	void free_mt_struct_array(mt_struct **mtss, int count)
+	void dcmt_fill_uint32(mt_struct *mts, uint32_t *out, size_t n)
+	void dcmt_fill_double(mt_struct *mts, double *out, size_t n)
+	ctypedef void (*dcmt_next_state_fn)(mt_struct *mts)
+	dcmt_next_state_fn dcmt_next_state_kernel(mt_struct *mts)
+	ctypedef struct mt_lanes:
+		pass
+	mt_lanes *new_mt_lanes(mt_struct **mtss, int count)
+	void free_mt_lanes(mt_lanes *lanes)
+	void mt_lanes_fill_uint32(mt_lanes *lanes, uint32_t *out, size_t n)
+	void mt_lanes_fill_double(mt_lanes *lanes, double *out, size_t n)
 
 
 cdef extern from "common.h":
 
 	void sgenrand(uint32_t seed, mt_struct *mts)
-	uint32_t random_uint32(mt_struct *mt)
-	double random_float(mt_struct *mt)
+	uint32_t random_uint32(mt_struct *mt, dcmt_next_state_fn next_state)
+	double random_float(mt_struct *mt, dcmt_next_state_fn next_state)
 
 from os import urandom as _urandom
 from binascii import hexlify as _hexlify
 import time
+import sys
 
 
 cdef uint32_t get_seed(object seed) except? -1:
@@ -71,6 +142,21 @@ cdef uint32_t get_seed(object seed) except? -1:
 	# not checking for overflow now, since we need 4 lower bytes anyway
 	return PyInt_AsUnsignedLongMask(seed)
 
+def set_cache_file(path):
+	"""Set the parameter cache file of this module, or switch the cache off if path is None"""
+
+	cdef char *c_path = NULL
+
+	if path is not None:
+		if isinstance(path, unicode):
+			path = path.encode(sys.getfilesystemencoding())
+		if not isinstance(path, bytes):
+			raise DcmtParameterError("Cache file name must be a string")
+		c_path = path
+
+	if set_mt_cache_file(c_path) != 0:
+		raise MemoryError()
+
 cdef void validate_parameters(wordlen, exponent, start_id, max_id,
 		int *c_wordlen, int *c_exponent, int *c_start_id, int *c_max_id) except *:
 	"""Return valid parameter or raise an exception"""
@@ -103,18 +189,90 @@ cdef void validate_parameters(wordlen, exponent, start_id, max_id,
 	c_start_id[0] = sid
 	c_max_id[0] = mid
 
-cdef object create_mt_range(args, wordlen, exponent, seed, mt_struct ***mts, int *count):
+cdef int get_n_threads(object n_threads) except -1:
+	"""Return valid number of search threads (0 for serial search) or raise an exception"""
 
-	cdef int w, p, mid, sid
+	if n_threads is None:
+		return 0
+
+	if not isinstance(n_threads, int) and not isinstance(n_threads, long):
+		raise DcmtParameterError("Number of threads must be an integer")
+
+	if n_threads < 1 or n_threads > 1024:
+		raise DcmtParameterError("Number of threads must lie between 1 and 1024")
+
+	return <int>PyInt_AsLong(n_threads)
+
+_PERIOD_CHECKS = {'decimation': DC_PERIOD_DECIMATION, 'bm': DC_PERIOD_BM,
+	'bitsliced': DC_PERIOD_BITSLICED}
+
+cdef int check_signals(int ids_done, long candidates, void *arg) with gil:
+	"""Progress callback of the searches, which stops them on a signal (Ctrl-C)"""
+	return PyErr_CheckSignals() != 0
+
+_TEMPERINGS = {'greedy': DC_TEMPER_GREEDY, 'hard': DC_TEMPER_HARD}
+
+cdef void get_search_opts(dc_opts *opts, int *cancel, n_threads=None, period_check=None,
+		timeout=None, tempering=None) except *:
+	"""Fill search options or raise an exception; cancel receives the reason of a stop"""
+
+	init_dc_opts(opts)
+	cancel[0] = 0
+	opts.cancel = cancel
+	opts.progress = check_signals
+	opts.n_threads = get_n_threads(n_threads)
+
+	if timeout is not None:
+		if not isinstance(timeout, (int, long, float)) or not timeout > 0:
+			raise DcmtParameterError("Timeout must be a positive number of seconds")
+		opts.time_limit = timeout
+
+	if period_check is not None:
+		try:
+			opts.period_check = _PERIOD_CHECKS[period_check]
+		except (KeyError, TypeError):
+			raise DcmtParameterError("Period check must be one of " +
+				", ".join(repr(name) for name in sorted(_PERIOD_CHECKS)))
+
+	if tempering is not None:
+		if isinstance(tempering, (int, long)) and 0 <= tempering <= 31:
+			opts.temper_depth = tempering
+		else:
+			try:
+				opts.temper_depth = _TEMPERINGS[tempering]
+			except (KeyError, TypeError):
+				raise DcmtParameterError("Tempering must be one of " +
+					", ".join(repr(name) for name in sorted(_TEMPERINGS)) +
+					" or a number of bits from 0 to 31")
+
+cdef int search_stopped(int cancel) except -1:
+	"""Raise an exception if the search was stopped"""
+
+	if cancel == DC_CANCELLED:
+		if PyErr_Occurred() == NULL:
+			raise KeyboardInterrupt()
+		# the exception raised by the signal handler
+		return -1
+	elif cancel == DC_TIMED_OUT:
+		raise DcmtTimeoutError("Search did not finish in the given time")
+
+	return 0
+
+cdef object get_range_args(args):
+	"""Return (start, stop) of *range function arguments or raise an exception"""
 
 	if len(args) == 1:
-		start_id = 0
-		max_id, = args
+		return 0, args[0]
 	elif len(args) == 2:
-		start_id, max_id = args
+		return args
 	else:
 		raise TypeError("range expected 1 or 2 positional arguments")
 
+cdef object create_mt_range(args, wordlen, exponent, seed, dc_opts *opts, mt_struct ***mts, int *count):
+
+	cdef int w, p, mid, sid
+
+	start_id, max_id = get_range_args(args)
 	max_id -= 1
 
 	if max_id < start_id:
@@ -123,12 +281,15 @@ cdef object create_mt_range(args, wordlen, exponent, seed, mt_struct ***mts, int
 	validate_parameters(wordlen, exponent, start_id, max_id, &w, &p, &sid, &mid)
 	cdef uint32_t s = get_seed(seed)
 
-	cdef mt_struct **m = get_mt_parameters_st(w, p, sid, mid, s, count)
+	cdef mt_struct **m
+	with nogil:
+		m = get_mt_parameters_opt_st(w, p, sid, mid, s, opts, count)
 
 	if count[0] < max_id - start_id + 1 or mts == NULL:
 		py_count = PyInt_FromLong(count[0])
 		if mts != NULL:
 			free_mt_struct_array(m, count[0])
+		search_stopped(opts.cancel[0])
 		raise DcmtError("dcmt internal error: could not create all requested RNGs " +
 			"(failed at id=" + str(start_id + py_count) + ")")
 
@@ -1,6483 +0,0 @@
-/* Generated by Cython 0.14 on Fri May 27 01:29:59 2011 */
-
-#define PY_SSIZE_T_CLEAN
-#include "Python.h"
-#ifndef Py_PYTHON_H
-    #error Python headers needed to compile C extensions, please install development version of Python.
-#else
-
-#include <stddef.h> /* For offsetof */
-#ifndef offsetof
-#define offsetof(type, member) ( (size_t) & ((type*)0) -> member )
-#endif
-
-#if !defined(WIN32) && !defined(MS_WINDOWS)
-  #ifndef __stdcall
-    #define __stdcall
-  #endif
-  #ifndef __cdecl
-    #define __cdecl
-  #endif
-  #ifndef __fastcall
-    #define __fastcall
-  #endif
-#endif
-
-#ifndef DL_IMPORT
-  #define DL_IMPORT(t) t
-#endif
-#ifndef DL_EXPORT
-  #define DL_EXPORT(t) t
-#endif
-
-#ifndef PY_LONG_LONG
-  #define PY_LONG_LONG LONG_LONG
-#endif
-
-#if PY_VERSION_HEX < 0x02040000
-  #define METH_COEXIST 0
-  #define PyDict_CheckExact(op) (Py_TYPE(op) == &PyDict_Type)
-  #define PyDict_Contains(d,o)   PySequence_Contains(d,o)
-#endif
-
-#if PY_VERSION_HEX < 0x02050000
-  typedef int Py_ssize_t;
-  #define PY_SSIZE_T_MAX INT_MAX
-  #define PY_SSIZE_T_MIN INT_MIN
-  #define PY_FORMAT_SIZE_T ""
-  #define PyInt_FromSsize_t(z) PyInt_FromLong(z)
-  #define PyInt_AsSsize_t(o)   PyInt_AsLong(o)
-  #define PyNumber_Index(o)    PyNumber_Int(o)
-  #define PyIndex_Check(o)     PyNumber_Check(o)
-  #define PyErr_WarnEx(category, message, stacklevel) PyErr_Warn(category, message)
-#endif
-
-#if PY_VERSION_HEX < 0x02060000
-  #define Py_REFCNT(ob) (((PyObject*)(ob))->ob_refcnt)
-  #define Py_TYPE(ob)   (((PyObject*)(ob))->ob_type)
-  #define Py_SIZE(ob)   (((PyVarObject*)(ob))->ob_size)
-  #define PyVarObject_HEAD_INIT(type, size) \
-          PyObject_HEAD_INIT(type) size,
-  #define PyType_Modified(t)
-
-  typedef struct {
-     void *buf;
-     PyObject *obj;
-     Py_ssize_t len;
-     Py_ssize_t itemsize;
-     int readonly;
-     int ndim;
-     char *format;
-     Py_ssize_t *shape;
-     Py_ssize_t *strides;
-     Py_ssize_t *suboffsets;
-     void *internal;
-  } Py_buffer;
-
-  #define PyBUF_SIMPLE 0
-  #define PyBUF_WRITABLE 0x0001
-  #define PyBUF_FORMAT 0x0004
-  #define PyBUF_ND 0x0008
-  #define PyBUF_STRIDES (0x0010 | PyBUF_ND)
-  #define PyBUF_C_CONTIGUOUS (0x0020 | PyBUF_STRIDES)
-  #define PyBUF_F_CONTIGUOUS (0x0040 | PyBUF_STRIDES)
-  #define PyBUF_ANY_CONTIGUOUS (0x0080 | PyBUF_STRIDES)
-  #define PyBUF_INDIRECT (0x0100 | PyBUF_STRIDES)
-
-#endif
-
-#if PY_MAJOR_VERSION < 3
-  #define __Pyx_BUILTIN_MODULE_NAME "__builtin__"
-#else
-  #define __Pyx_BUILTIN_MODULE_NAME "builtins"
-#endif
-
-#if PY_MAJOR_VERSION >= 3
-  #define Py_TPFLAGS_CHECKTYPES 0
-  #define Py_TPFLAGS_HAVE_INDEX 0
-#endif
-
-#if (PY_VERSION_HEX < 0x02060000) || (PY_MAJOR_VERSION >= 3)
-  #define Py_TPFLAGS_HAVE_NEWBUFFER 0
-#endif
-
-#if PY_MAJOR_VERSION >= 3
-  #define PyBaseString_Type            PyUnicode_Type
-  #define PyStringObject               PyUnicodeObject
-  #define PyString_Type                PyUnicode_Type
-  #define PyString_Check               PyUnicode_Check
-  #define PyString_CheckExact          PyUnicode_CheckExact
-#endif
-
-#if PY_VERSION_HEX < 0x02060000
-  #define PyBytesObject                PyStringObject
-  #define PyBytes_Type                 PyString_Type
-  #define PyBytes_Check                PyString_Check
-  #define PyBytes_CheckExact           PyString_CheckExact
-  #define PyBytes_FromString           PyString_FromString
-  #define PyBytes_FromStringAndSize    PyString_FromStringAndSize
-  #define PyBytes_FromFormat           PyString_FromFormat
-  #define PyBytes_DecodeEscape         PyString_DecodeEscape
-  #define PyBytes_AsString             PyString_AsString
-  #define PyBytes_AsStringAndSize      PyString_AsStringAndSize
-  #define PyBytes_Size                 PyString_Size
-  #define PyBytes_AS_STRING            PyString_AS_STRING
-  #define PyBytes_GET_SIZE             PyString_GET_SIZE
-  #define PyBytes_Repr                 PyString_Repr
-  #define PyBytes_Concat               PyString_Concat
-  #define PyBytes_ConcatAndDel         PyString_ConcatAndDel
-  #define PySet_Check(obj)             PyObject_TypeCheck(obj, &PySet_Type)
-  #define PyFrozenSet_Check(obj)       PyObject_TypeCheck(obj, &PyFrozenSet_Type)
-#endif
-
-#ifndef PySet_CheckExact
-#  define PySet_CheckExact(obj)          (Py_TYPE(obj) == &PySet_Type)
-#endif
-
-#if PY_MAJOR_VERSION >= 3
-  #define PyIntObject                  PyLongObject
-  #define PyInt_Type                   PyLong_Type
-  #define PyInt_Check(op)              PyLong_Check(op)
-  #define PyInt_CheckExact(op)         PyLong_CheckExact(op)
-  #define PyInt_FromString             PyLong_FromString
-  #define PyInt_FromUnicode            PyLong_FromUnicode
-  #define PyInt_FromLong               PyLong_FromLong
-  #define PyInt_FromSize_t             PyLong_FromSize_t
-  #define PyInt_FromSsize_t            PyLong_FromSsize_t
-  #define PyInt_AsLong                 PyLong_AsLong
-  #define PyInt_AS_LONG                PyLong_AS_LONG
-  #define PyInt_AsSsize_t              PyLong_AsSsize_t
-  #define PyInt_AsUnsignedLongMask     PyLong_AsUnsignedLongMask
-  #define PyInt_AsUnsignedLongLongMask PyLong_AsUnsignedLongLongMask
-#endif
-
-#if PY_MAJOR_VERSION >= 3
-  #define PyBoolObject PyLongObject
-#endif
-
-
-#if PY_MAJOR_VERSION >= 3
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_TrueDivide(x,y)
-  #define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceTrueDivide(x,y)
-#else
-  #define __Pyx_PyNumber_Divide(x,y)         PyNumber_Divide(x,y)
-  #define __Pyx_PyNumber_InPlaceDivide(x,y)  PyNumber_InPlaceDivide(x,y)
-#endif
-
-#if (PY_MAJOR_VERSION < 3) || (PY_VERSION_HEX >= 0x03010300)
-  #define __Pyx_PySequence_GetSlice(obj, a, b) PySequence_GetSlice(obj, a, b)
-  #define __Pyx_PySequence_SetSlice(obj, a, b, value) PySequence_SetSlice(obj, a, b, value)
-  #define __Pyx_PySequence_DelSlice(obj, a, b) PySequence_DelSlice(obj, a, b)
-#else
-  #define __Pyx_PySequence_GetSlice(obj, a, b) (unlikely(!(obj)) ? \
-        (PyErr_SetString(PyExc_SystemError, "null argument to internal routine"), (PyObject*)0) : \
-        (likely((obj)->ob_type->tp_as_mapping) ? (PySequence_GetSlice(obj, a, b)) : \
-            (PyErr_Format(PyExc_TypeError, "'%.200s' object is unsliceable", (obj)->ob_type->tp_name), (PyObject*)0)))
-  #define __Pyx_PySequence_SetSlice(obj, a, b, value) (unlikely(!(obj)) ? \
-        (PyErr_SetString(PyExc_SystemError, "null argument to internal routine"), -1) : \
-        (likely((obj)->ob_type->tp_as_mapping) ? (PySequence_SetSlice(obj, a, b, value)) : \
-            (PyErr_Format(PyExc_TypeError, "'%.200s' object doesn't support slice assignment", (obj)->ob_type->tp_name), -1)))
-  #define __Pyx_PySequence_DelSlice(obj, a, b) (unlikely(!(obj)) ? \
-        (PyErr_SetString(PyExc_SystemError, "null argument to internal routine"), -1) : \
-        (likely((obj)->ob_type->tp_as_mapping) ? (PySequence_DelSlice(obj, a, b)) : \
-            (PyErr_Format(PyExc_TypeError, "'%.200s' object doesn't support slice deletion", (obj)->ob_type->tp_name), -1)))
-#endif
-
-#if PY_MAJOR_VERSION >= 3
-  #define PyMethod_New(func, self, klass) ((self) ? PyMethod_New(func, self) : PyInstanceMethod_New(func))
-#endif
-
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),((char *)(n)))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),((char *)(n)),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),((char *)(n)))
-#else
-  #define __Pyx_GetAttrString(o,n)   PyObject_GetAttrString((o),(n))
-  #define __Pyx_SetAttrString(o,n,a) PyObject_SetAttrString((o),(n),(a))
-  #define __Pyx_DelAttrString(o,n)   PyObject_DelAttrString((o),(n))
-#endif
-
-#if PY_VERSION_HEX < 0x02050000
-  #define __Pyx_NAMESTR(n) ((char *)(n))
-  #define __Pyx_DOCSTR(n)  ((char *)(n))
-#else
-  #define __Pyx_NAMESTR(n) (n)
-  #define __Pyx_DOCSTR(n)  (n)
-#endif
-
-#ifdef __cplusplus
-#define __PYX_EXTERN_C extern "C"
-#else
-#define __PYX_EXTERN_C extern
-#endif
-
-#if defined(WIN32) || defined(MS_WINDOWS)
-#define _USE_MATH_DEFINES
-#endif
-#include <math.h>
-#define __PYX_HAVE_API__dcmt__numpyrandom
-#include "stdlib.h"
-#include "limits.h"
-#include "string.h"
-#include "inttypes.h"
-#include "dc.h"
-#include "common.h"
-#include "numpy/arrayobject.h"
-
-#ifdef PYREX_WITHOUT_ASSERTIONS
-#define CYTHON_WITHOUT_ASSERTIONS
-#endif
-
-
-/* inline attribute */
-#ifndef CYTHON_INLINE
-  #if defined(__GNUC__)
-    #define CYTHON_INLINE __inline__
-  #elif defined(_MSC_VER)
-    #define CYTHON_INLINE __inline
-  #elif defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-    #define CYTHON_INLINE inline
-  #else
-    #define CYTHON_INLINE
-  #endif
-#endif
-
-/* unused attribute */
-#ifndef CYTHON_UNUSED
-# if defined(__GNUC__)
-#   if !(defined(__cplusplus)) || (__GNUC__ > 3 || (__GNUC__ == 3 && __GNUC_MINOR__ >= 4))
-#     define CYTHON_UNUSED __attribute__ ((__unused__))
-#   else
-#     define CYTHON_UNUSED
-#   endif
-# elif defined(__ICC) || defined(__INTEL_COMPILER)
-#   define CYTHON_UNUSED __attribute__ ((__unused__))
-# else
-#   define CYTHON_UNUSED
-# endif
-#endif
-
-typedef struct {PyObject **p; char *s; const long n; const char* encoding; const char is_unicode; const char is_str; const char intern; } __Pyx_StringTabEntry; /*proto*/
-
-
-/* Type Conversion Predeclarations */
-
-#define __Pyx_PyBytes_FromUString(s) PyBytes_FromString((char*)s)
-#define __Pyx_PyBytes_AsUString(s)   ((unsigned char*) PyBytes_AsString(s))
-
-#define __Pyx_PyBool_FromLong(b) ((b) ? (Py_INCREF(Py_True), Py_True) : (Py_INCREF(Py_False), Py_False))
-static CYTHON_INLINE int __Pyx_PyObject_IsTrue(PyObject*);
-static CYTHON_INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x);
-
-static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject*);
-static CYTHON_INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t);
-static CYTHON_INLINE size_t __Pyx_PyInt_AsSize_t(PyObject*);
-
-#define __pyx_PyFloat_AsDouble(x) (PyFloat_CheckExact(x) ? PyFloat_AS_DOUBLE(x) : PyFloat_AsDouble(x))
-
-
-#ifdef __GNUC__
-/* Test for GCC > 2.95 */
-#if __GNUC__ > 2 || (__GNUC__ == 2 && (__GNUC_MINOR__ > 95))
-#define likely(x)   __builtin_expect(!!(x), 1)
-#define unlikely(x) __builtin_expect(!!(x), 0)
-#else /* __GNUC__ > 2 ... */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ > 2 ... */
-#else /* __GNUC__ */
-#define likely(x)   (x)
-#define unlikely(x) (x)
-#endif /* __GNUC__ */
-    
-static PyObject *__pyx_m;
-static PyObject *__pyx_b;
-static PyObject *__pyx_empty_tuple;
-static PyObject *__pyx_empty_bytes;
-static int __pyx_lineno;
-static int __pyx_clineno = 0;
-static const char * __pyx_cfilenm= __FILE__;
-static const char *__pyx_filename;
-
-
-static const char *__pyx_f[] = {
-  "common.pxi",
-  "numpyrandom.pyx",
-};
-
-/* Type declarations */
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":114
- * 
- * 
- * cdef class DcmtRandomState:             # <<<<<<<<<<<<<<
- * 
- * 	cdef mt_struct *mt
- */
-
-struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState {
-  PyObject_HEAD
-  mt_struct *mt;
-};
-
-#ifndef CYTHON_REFNANNY
-  #define CYTHON_REFNANNY 0
-#endif
-
-#if CYTHON_REFNANNY
-  typedef struct {
-    void (*INCREF)(void*, PyObject*, int);
-    void (*DECREF)(void*, PyObject*, int);
-    void (*GOTREF)(void*, PyObject*, int);
-    void (*GIVEREF)(void*, PyObject*, int);
-    void* (*SetupContext)(const char*, int, const char*);
-    void (*FinishContext)(void**);
-  } __Pyx_RefNannyAPIStruct;
-  static __Pyx_RefNannyAPIStruct *__Pyx_RefNanny = NULL;
-  static __Pyx_RefNannyAPIStruct * __Pyx_RefNannyImportAPI(const char *modname) {
-    PyObject *m = NULL, *p = NULL;
-    void *r = NULL;
-    m = PyImport_ImportModule((char *)modname);
-    if (!m) goto end;
-    p = PyObject_GetAttrString(m, (char *)"RefNannyAPI");
-    if (!p) goto end;
-    r = PyLong_AsVoidPtr(p);
-  end:
-    Py_XDECREF(p);
-    Py_XDECREF(m);
-    return (__Pyx_RefNannyAPIStruct *)r;
-  }
-  #define __Pyx_RefNannySetupContext(name)           void *__pyx_refnanny = __Pyx_RefNanny->SetupContext((name), __LINE__, __FILE__)
-  #define __Pyx_RefNannyFinishContext()           __Pyx_RefNanny->FinishContext(&__pyx_refnanny)
-  #define __Pyx_INCREF(r) __Pyx_RefNanny->INCREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_DECREF(r) __Pyx_RefNanny->DECREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_GOTREF(r) __Pyx_RefNanny->GOTREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_GIVEREF(r) __Pyx_RefNanny->GIVEREF(__pyx_refnanny, (PyObject *)(r), __LINE__)
-  #define __Pyx_XDECREF(r) do { if((r) != NULL) {__Pyx_DECREF(r);} } while(0)
-#else
-  #define __Pyx_RefNannySetupContext(name)
-  #define __Pyx_RefNannyFinishContext()
-  #define __Pyx_INCREF(r) Py_INCREF(r)
-  #define __Pyx_DECREF(r) Py_DECREF(r)
-  #define __Pyx_GOTREF(r)
-  #define __Pyx_GIVEREF(r)
-  #define __Pyx_XDECREF(r) Py_XDECREF(r)
-#endif /* CYTHON_REFNANNY */
-#define __Pyx_XGIVEREF(r) do { if((r) != NULL) {__Pyx_GIVEREF(r);} } while(0)
-#define __Pyx_XGOTREF(r) do { if((r) != NULL) {__Pyx_GOTREF(r);} } while(0)
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name); /*proto*/
-
-static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static CYTHON_INLINE void __Pyx_RaiseNeedMoreValuesError(Py_ssize_t index);
-
-static CYTHON_INLINE void __Pyx_RaiseTooManyValuesError(Py_ssize_t expected);
-
-static PyObject *__Pyx_UnpackItem(PyObject *, Py_ssize_t index); /*proto*/
-static int __Pyx_EndUnpack(PyObject *, Py_ssize_t expected); /*proto*/
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name, PyObject* kw_name); /*proto*/
-
-static void __Pyx_RaiseArgtupleInvalid(const char* func_name, int exact,
-    Py_ssize_t num_min, Py_ssize_t num_max, Py_ssize_t num_found); /*proto*/
-
-static int __Pyx_ParseOptionalKeywords(PyObject *kwds, PyObject **argnames[],     PyObject *kwds2, PyObject *values[], Py_ssize_t num_pos_args,     const char* function_name); /*proto*/
-
-static CYTHON_INLINE int __Pyx_CheckKeywordStrings(PyObject *kwdict,
-    const char* function_name, int kw_allowed); /*proto*/
-
-static CYTHON_INLINE PyObject* __Pyx_tp_new(PyObject* type_obj) {
-    return (PyObject*) (((PyTypeObject*)(type_obj))->tp_new(
-        (PyTypeObject*)(type_obj), __pyx_empty_tuple, NULL));
-}
-
-
-static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Generic(PyObject *o, PyObject* j) {
-    PyObject *r;
-    if (!j) return NULL;
-    r = PyObject_GetItem(o, j);
-    Py_DECREF(j);
-    return r;
-}
-
-
-#define __Pyx_GetItemInt_List(o, i, size, to_py_func) (((size) <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_List_Fast(o, i) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static CYTHON_INLINE PyObject *__Pyx_GetItemInt_List_Fast(PyObject *o, Py_ssize_t i) {
-    if (likely(o != Py_None)) {
-        if (likely((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-            PyObject *r = PyList_GET_ITEM(o, i);
-            Py_INCREF(r);
-            return r;
-        }
-        else if ((-PyList_GET_SIZE(o) <= i) & (i < 0)) {
-            PyObject *r = PyList_GET_ITEM(o, PyList_GET_SIZE(o) + i);
-            Py_INCREF(r);
-            return r;
-        }
-    }
-    return __Pyx_GetItemInt_Generic(o, PyInt_FromSsize_t(i));
-}
-
-#define __Pyx_GetItemInt_Tuple(o, i, size, to_py_func) (((size) <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_Tuple_Fast(o, i) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Tuple_Fast(PyObject *o, Py_ssize_t i) {
-    if (likely(o != Py_None)) {
-        if (likely((0 <= i) & (i < PyTuple_GET_SIZE(o)))) {
-            PyObject *r = PyTuple_GET_ITEM(o, i);
-            Py_INCREF(r);
-            return r;
-        }
-        else if ((-PyTuple_GET_SIZE(o) <= i) & (i < 0)) {
-            PyObject *r = PyTuple_GET_ITEM(o, PyTuple_GET_SIZE(o) + i);
-            Py_INCREF(r);
-            return r;
-        }
-    }
-    return __Pyx_GetItemInt_Generic(o, PyInt_FromSsize_t(i));
-}
-
-
-#define __Pyx_GetItemInt(o, i, size, to_py_func) (((size) <= sizeof(Py_ssize_t)) ? \
-                                                    __Pyx_GetItemInt_Fast(o, i) : \
-                                                    __Pyx_GetItemInt_Generic(o, to_py_func(i)))
-
-static CYTHON_INLINE PyObject *__Pyx_GetItemInt_Fast(PyObject *o, Py_ssize_t i) {
-    PyObject *r;
-    if (PyList_CheckExact(o) && ((0 <= i) & (i < PyList_GET_SIZE(o)))) {
-        r = PyList_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (PyTuple_CheckExact(o) && ((0 <= i) & (i < PyTuple_GET_SIZE(o)))) {
-        r = PyTuple_GET_ITEM(o, i);
-        Py_INCREF(r);
-    }
-    else if (Py_TYPE(o)->tp_as_sequence && Py_TYPE(o)->tp_as_sequence->sq_item && (likely(i >= 0))) {
-        r = PySequence_GetItem(o, i);
-    }
-    else {
-        r = __Pyx_GetItemInt_Generic(o, PyInt_FromSsize_t(i));
-    }
-    return r;
-}
-
-static CYTHON_INLINE void __Pyx_ExceptionSave(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-static void __Pyx_ExceptionReset(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list); /*proto*/
-
-#include "descrobject.h"
-static PyObject* __Pyx_Method_ClassMethod(PyObject *method); /*proto*/
-
-static CYTHON_INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-static CYTHON_INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb); /*proto*/
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb); /*proto*/
-
-static CYTHON_INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject *);
-
-static CYTHON_INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject *);
-
-static CYTHON_INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject *);
-
-static CYTHON_INLINE char __Pyx_PyInt_AsChar(PyObject *);
-
-static CYTHON_INLINE short __Pyx_PyInt_AsShort(PyObject *);
-
-static CYTHON_INLINE int __Pyx_PyInt_AsInt(PyObject *);
-
-static CYTHON_INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject *);
-
-static CYTHON_INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject *);
-
-static CYTHON_INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject *);
-
-static CYTHON_INLINE int __Pyx_PyInt_AsLongDouble(PyObject *);
-
-static CYTHON_INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject *);
-
-static CYTHON_INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject *);
-
-static CYTHON_INLINE long __Pyx_PyInt_AsLong(PyObject *);
-
-static CYTHON_INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject *);
-
-static CYTHON_INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject *);
-
-static CYTHON_INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject *);
-
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name, long size, int strict);  /*proto*/
-
-static PyObject *__Pyx_ImportModule(const char *name); /*proto*/
-
-static void __Pyx_AddTraceback(const char *funcname); /*proto*/
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t); /*proto*/
-/* Module declarations from libc.stdlib */
-
-/* Module declarations from libc.limits */
-
-/* Module declarations from numpy */
-
-/* Module declarations from dcmt.numpyrandom */
-
-static PyTypeObject *__pyx_ptype_4dcmt_11numpyrandom_dtype = 0;
-static PyTypeObject *__pyx_ptype_4dcmt_11numpyrandom_ndarray = 0;
-static PyTypeObject *__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState = 0;
-static uint32_t __pyx_f_4dcmt_11numpyrandom_get_seed(PyObject *); /*proto*/
-static void __pyx_f_4dcmt_11numpyrandom_validate_parameters(PyObject *, PyObject *, PyObject *, PyObject *, int *, int *, int *, int *); /*proto*/
-static PyObject *__pyx_f_4dcmt_11numpyrandom_create_mt_range(PyObject *, PyObject *, PyObject *, PyObject *, mt_struct ***, int *); /*proto*/
-static PyObject *__pyx_f_4dcmt_11numpyrandom_uint32_to_python(uint32_t); /*proto*/
-static uint32_t __pyx_f_4dcmt_11numpyrandom_uint32_from_python(PyObject *); /*proto*/
-static PyObject *__pyx_f_4dcmt_11numpyrandom_get_mt_struct_fields(mt_struct *); /*proto*/
-static PyObject *__pyx_f_4dcmt_11numpyrandom_get_mt_struct_common_fields(mt_struct *); /*proto*/
-static PyObject *__pyx_f_4dcmt_11numpyrandom_set_mt_struct_fields(mt_struct *, PyObject *); /*proto*/
-static PyObject *__pyx_f_4dcmt_11numpyrandom_set_mt_struct_common_fields(mt_struct *, PyObject *); /*proto*/
-#define __Pyx_MODULE_NAME "dcmt.numpyrandom"
-int __pyx_module_is_main_dcmt__numpyrandom = 0;
-
-/* Implementation of dcmt.numpyrandom */
-static PyObject *__pyx_builtin_NotImplementedError;
-static PyObject *__pyx_builtin_TypeError;
-static PyObject *__pyx_builtin_ValueError;
-static PyObject *__pyx_builtin_range;
-static PyObject *__pyx_builtin_xrange;
-static char __pyx_k_2[] = "Seed must be an integer or hashable type";
-static char __pyx_k_4[] = "Starting ID must be equal to or lower than maximum ID";
-static char __pyx_k_6[] = "All IDs must lie between 0 and 65535";
-static char __pyx_k_8[] = "Known bug: cannot create RNG for wordlen=31, exponent=521, id=9";
-static char __pyx_k_10[] = "Word length must be equal to 31 or 32";
-static char __pyx_k_12[] = "Mersenne exponent is incorrect or not from a supported set";
-static char __pyx_k_14[] = "range expected 1 or 2 positional arguments";
-static char __pyx_k_16[] = "dcmt internal error: could not create all requested RNGs ";
-static char __pyx_k_17[] = "(failed at id=";
-static char __pyx_k_18[] = ")";
-static char __pyx_k_19[] = "State version ";
-static char __pyx_k_20[] = " is not supported";
-static char __pyx_k_21[] = "wrong state vector size";
-static char __pyx_k_23[] = "function requires numpy array";
-static char __pyx_k_25[] = "function requires numpy array of type float64";
-static char __pyx_k_28[] = "function requires numpy array with 4-byte elements";
-static char __pyx_k_30[] = "dcmt.exceptions";
-static char __pyx_k_31[] = "dcmt.numpyrandom";
-static char __pyx_k__i[] = "i";
-static char __pyx_k__id[] = "id";
-static char __pyx_k__mm[] = "mm";
-static char __pyx_k__mt[] = "mt";
-static char __pyx_k__nn[] = "nn";
-static char __pyx_k__os[] = "os";
-static char __pyx_k__rr[] = "rr";
-static char __pyx_k__ww[] = "ww";
-static char __pyx_k__aaa[] = "aaa";
-static char __pyx_k__data[] = "data";
-static char __pyx_k__seed[] = "seed";
-static char __pyx_k__size[] = "size";
-static char __pyx_k__time[] = "time";
-static char __pyx_k__descr[] = "descr";
-static char __pyx_k__empty[] = "empty";
-static char __pyx_k__lmask[] = "lmask";
-static char __pyx_k__maskB[] = "maskB";
-static char __pyx_k__maskC[] = "maskC";
-static char __pyx_k__numpy[] = "numpy";
-static char __pyx_k__range[] = "range";
-static char __pyx_k__shape[] = "shape";
-static char __pyx_k__state[] = "state";
-static char __pyx_k__umask[] = "umask";
-static char __pyx_k__wmask[] = "wmask";
-static char __pyx_k__append[] = "append";
-static char __pyx_k__elsize[] = "elsize";
-static char __pyx_k__shift0[] = "shift0";
-static char __pyx_k__shift1[] = "shift1";
-static char __pyx_k__shiftB[] = "shiftB";
-static char __pyx_k__shiftC[] = "shiftC";
-static char __pyx_k__uint32[] = "uint32";
-static char __pyx_k__xrange[] = "xrange";
-static char __pyx_k__float64[] = "float64";
-static char __pyx_k__hexlify[] = "hexlify";
-static char __pyx_k__urandom[] = "urandom";
-static char __pyx_k__wordlen[] = "wordlen";
-static char __pyx_k____main__[] = "__main__";
-static char __pyx_k____test__[] = "__test__";
-static char __pyx_k___hexlify[] = "_hexlify";
-static char __pyx_k___urandom[] = "_urandom";
-static char __pyx_k__binascii[] = "binascii";
-static char __pyx_k__exponent[] = "exponent";
-static char __pyx_k__gen_seed[] = "gen_seed";
-static char __pyx_k__mt_range[] = "mt_range";
-static char __pyx_k__type_num[] = "type_num";
-static char __pyx_k__DcmtError[] = "DcmtError";
-static char __pyx_k__TypeError[] = "TypeError";
-static char __pyx_k____class__[] = "__class__";
-static char __pyx_k__get_state[] = "get_state";
-static char __pyx_k__mt_common[] = "mt_common";
-static char __pyx_k__mt_unique[] = "mt_unique";
-static char __pyx_k__rand_fill[] = "rand_fill";
-static char __pyx_k__set_state[] = "set_state";
-static char __pyx_k__ValueError[] = "ValueError";
-static char __pyx_k__dimensions[] = "dimensions";
-static char __pyx_k__from_mt_range[] = "from_mt_range";
-static char __pyx_k__random_sample[] = "random_sample";
-static char __pyx_k__DcmtParameterError[] = "DcmtParameterError";
-static char __pyx_k__NotImplementedError[] = "NotImplementedError";
-static PyObject *__pyx_kp_s_10;
-static PyObject *__pyx_kp_s_12;
-static PyObject *__pyx_kp_s_14;
-static PyObject *__pyx_kp_s_16;
-static PyObject *__pyx_kp_s_17;
-static PyObject *__pyx_kp_s_18;
-static PyObject *__pyx_kp_s_19;
-static PyObject *__pyx_kp_s_2;
-static PyObject *__pyx_kp_s_20;
-static PyObject *__pyx_kp_s_21;
-static PyObject *__pyx_kp_s_23;
-static PyObject *__pyx_kp_s_25;
-static PyObject *__pyx_kp_s_28;
-static PyObject *__pyx_n_s_30;
-static PyObject *__pyx_n_s_31;
-static PyObject *__pyx_kp_s_4;
-static PyObject *__pyx_kp_s_6;
-static PyObject *__pyx_kp_s_8;
-static PyObject *__pyx_n_s__DcmtError;
-static PyObject *__pyx_n_s__DcmtParameterError;
-static PyObject *__pyx_n_s__NotImplementedError;
-static PyObject *__pyx_n_s__TypeError;
-static PyObject *__pyx_n_s__ValueError;
-static PyObject *__pyx_n_s____class__;
-static PyObject *__pyx_n_s____main__;
-static PyObject *__pyx_n_s____test__;
-static PyObject *__pyx_n_s___hexlify;
-static PyObject *__pyx_n_s___urandom;
-static PyObject *__pyx_n_s__aaa;
-static PyObject *__pyx_n_s__append;
-static PyObject *__pyx_n_s__binascii;
-static PyObject *__pyx_n_s__data;
-static PyObject *__pyx_n_s__descr;
-static PyObject *__pyx_n_s__dimensions;
-static PyObject *__pyx_n_s__elsize;
-static PyObject *__pyx_n_s__empty;
-static PyObject *__pyx_n_s__exponent;
-static PyObject *__pyx_n_s__float64;
-static PyObject *__pyx_n_s__from_mt_range;
-static PyObject *__pyx_n_s__gen_seed;
-static PyObject *__pyx_n_s__get_state;
-static PyObject *__pyx_n_s__hexlify;
-static PyObject *__pyx_n_s__i;
-static PyObject *__pyx_n_s__id;
-static PyObject *__pyx_n_s__lmask;
-static PyObject *__pyx_n_s__maskB;
-static PyObject *__pyx_n_s__maskC;
-static PyObject *__pyx_n_s__mm;
-static PyObject *__pyx_n_s__mt;
-static PyObject *__pyx_n_s__mt_common;
-static PyObject *__pyx_n_s__mt_range;
-static PyObject *__pyx_n_s__mt_unique;
-static PyObject *__pyx_n_s__nn;
-static PyObject *__pyx_n_s__numpy;
-static PyObject *__pyx_n_s__os;
-static PyObject *__pyx_n_s__rand_fill;
-static PyObject *__pyx_n_s__random_sample;
-static PyObject *__pyx_n_s__range;
-static PyObject *__pyx_n_s__rr;
-static PyObject *__pyx_n_s__seed;
-static PyObject *__pyx_n_s__set_state;
-static PyObject *__pyx_n_s__shape;
-static PyObject *__pyx_n_s__shift0;
-static PyObject *__pyx_n_s__shift1;
-static PyObject *__pyx_n_s__shiftB;
-static PyObject *__pyx_n_s__shiftC;
-static PyObject *__pyx_n_s__size;
-static PyObject *__pyx_n_s__state;
-static PyObject *__pyx_n_s__time;
-static PyObject *__pyx_n_s__type_num;
-static PyObject *__pyx_n_s__uint32;
-static PyObject *__pyx_n_s__umask;
-static PyObject *__pyx_n_s__urandom;
-static PyObject *__pyx_n_s__wmask;
-static PyObject *__pyx_n_s__wordlen;
-static PyObject *__pyx_n_s__ww;
-static PyObject *__pyx_n_s__xrange;
-static PyObject *__pyx_int_0;
-static PyObject *__pyx_int_1;
-static PyObject *__pyx_int_2;
-static PyObject *__pyx_int_3;
-static PyObject *__pyx_int_4;
-static PyObject *__pyx_int_16;
-static PyObject *__pyx_int_32;
-static PyObject *__pyx_int_256;
-static PyObject *__pyx_int_521;
-static PyObject *__pyx_int_4294967295;
-static PyObject *__pyx_k_tuple_1;
-static PyObject *__pyx_k_tuple_3;
-static PyObject *__pyx_k_tuple_5;
-static PyObject *__pyx_k_tuple_7;
-static PyObject *__pyx_k_tuple_9;
-static PyObject *__pyx_k_tuple_11;
-static PyObject *__pyx_k_tuple_13;
-static PyObject *__pyx_k_tuple_15;
-static PyObject *__pyx_k_tuple_22;
-static PyObject *__pyx_k_tuple_24;
-static PyObject *__pyx_k_tuple_26;
-static PyObject *__pyx_k_tuple_27;
-static PyObject *__pyx_k_tuple_29;
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":51
- * 
- * 
- * cdef uint32_t get_seed(object seed) except? -1:             # <<<<<<<<<<<<<<
- * 	"""
- * 	Return valid seed or raise an exception
- */
-
-static  uint32_t __pyx_f_4dcmt_11numpyrandom_get_seed(PyObject *__pyx_v_seed) {
-  uint32_t __pyx_r;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  int __pyx_t_5;
-  PyObject *__pyx_t_6 = NULL;
-  PyObject *__pyx_t_7 = NULL;
-  int __pyx_t_8;
-  int __pyx_t_9;
-  long __pyx_t_10;
-  __Pyx_RefNannySetupContext("get_seed");
-  __Pyx_INCREF(__pyx_v_seed);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":60
- * 	"""
- * 
- * 	if seed is None:             # <<<<<<<<<<<<<<
- * 		try:
- * 			seed = long(_hexlify(_urandom(16)), 16)
- */
-  __pyx_t_1 = (__pyx_v_seed == Py_None);
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":61
- * 
- * 	if seed is None:
- * 		try:             # <<<<<<<<<<<<<<
- * 			seed = long(_hexlify(_urandom(16)), 16)
- * 		except NotImplementedError:
- */
-    {
-      PyObject *__pyx_save_exc_type, *__pyx_save_exc_value, *__pyx_save_exc_tb;
-      __Pyx_ExceptionSave(&__pyx_save_exc_type, &__pyx_save_exc_value, &__pyx_save_exc_tb);
-      __Pyx_XGOTREF(__pyx_save_exc_type);
-      __Pyx_XGOTREF(__pyx_save_exc_value);
-      __Pyx_XGOTREF(__pyx_save_exc_tb);
-      /*try:*/ {
-
-        /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":62
- * 	if seed is None:
- * 		try:
- * 			seed = long(_hexlify(_urandom(16)), 16)             # <<<<<<<<<<<<<<
- * 		except NotImplementedError:
- * 			seed = long(time.time() * 256) # use fractional seconds
- */
-        __pyx_t_2 = __Pyx_GetName(__pyx_m, __pyx_n_s___hexlify); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(__pyx_t_2);
-        __pyx_t_3 = __Pyx_GetName(__pyx_m, __pyx_n_s___urandom); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(__pyx_t_3);
-        __pyx_t_4 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_k_tuple_1), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(__pyx_t_4);
-        __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-        __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-        PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_4);
-        __Pyx_GIVEREF(__pyx_t_4);
-        __pyx_t_4 = 0;
-        __pyx_t_4 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(__pyx_t_4);
-        __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-        __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-        __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-        PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_4);
-        __Pyx_GIVEREF(__pyx_t_4);
-        __Pyx_INCREF(__pyx_int_16);
-        PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_int_16);
-        __Pyx_GIVEREF(__pyx_int_16);
-        __pyx_t_4 = 0;
-        __pyx_t_4 = PyObject_Call(((PyObject *)((PyObject*)(&PyLong_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L4_error;}
-        __Pyx_GOTREF(__pyx_t_4);
-        __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-        __Pyx_DECREF(__pyx_v_seed);
-        __pyx_v_seed = __pyx_t_4;
-        __pyx_t_4 = 0;
-      }
-      __Pyx_XDECREF(__pyx_save_exc_type); __pyx_save_exc_type = 0;
-      __Pyx_XDECREF(__pyx_save_exc_value); __pyx_save_exc_value = 0;
-      __Pyx_XDECREF(__pyx_save_exc_tb); __pyx_save_exc_tb = 0;
-      goto __pyx_L11_try_end;
-      __pyx_L4_error:;
-      __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
-      __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-      __Pyx_XDECREF(__pyx_t_4); __pyx_t_4 = 0;
-
-      /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":63
- * 		try:
- * 			seed = long(_hexlify(_urandom(16)), 16)
- * 		except NotImplementedError:             # <<<<<<<<<<<<<<
- * 			seed = long(time.time() * 256) # use fractional seconds
- * 	elif not isinstance(seed, int) and not isinstance(seed, long):
- */
-      __pyx_t_5 = PyErr_ExceptionMatches(__pyx_builtin_NotImplementedError);
-      if (__pyx_t_5) {
-        __Pyx_AddTraceback("dcmt.numpyrandom.get_seed");
-        if (__Pyx_GetException(&__pyx_t_4, &__pyx_t_3, &__pyx_t_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 63; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(__pyx_t_4);
-        __Pyx_GOTREF(__pyx_t_3);
-        __Pyx_GOTREF(__pyx_t_2);
-
-        /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":64
- * 			seed = long(_hexlify(_urandom(16)), 16)
- * 		except NotImplementedError:
- * 			seed = long(time.time() * 256) # use fractional seconds             # <<<<<<<<<<<<<<
- * 	elif not isinstance(seed, int) and not isinstance(seed, long):
- * 		try:
- */
-        __pyx_t_6 = __Pyx_GetName(__pyx_m, __pyx_n_s__time); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(__pyx_t_6);
-        __pyx_t_7 = PyObject_GetAttr(__pyx_t_6, __pyx_n_s__time); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(__pyx_t_7);
-        __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-        __pyx_t_6 = PyObject_Call(__pyx_t_7, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(__pyx_t_6);
-        __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-        __pyx_t_7 = PyNumber_Multiply(__pyx_t_6, __pyx_int_256); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(__pyx_t_7);
-        __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-        __pyx_t_6 = PyTuple_New(1); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(((PyObject *)__pyx_t_6));
-        PyTuple_SET_ITEM(__pyx_t_6, 0, __pyx_t_7);
-        __Pyx_GIVEREF(__pyx_t_7);
-        __pyx_t_7 = 0;
-        __pyx_t_7 = PyObject_Call(((PyObject *)((PyObject*)(&PyLong_Type))), ((PyObject *)__pyx_t_6), NULL); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 64; __pyx_clineno = __LINE__; goto __pyx_L6_except_error;}
-        __Pyx_GOTREF(__pyx_t_7);
-        __Pyx_DECREF(((PyObject *)__pyx_t_6)); __pyx_t_6 = 0;
-        __Pyx_DECREF(__pyx_v_seed);
-        __pyx_v_seed = __pyx_t_7;
-        __pyx_t_7 = 0;
-        __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-        __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-        __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-        goto __pyx_L5_exception_handled;
-      }
-      __pyx_L6_except_error:;
-      __Pyx_XGIVEREF(__pyx_save_exc_type);
-      __Pyx_XGIVEREF(__pyx_save_exc_value);
-      __Pyx_XGIVEREF(__pyx_save_exc_tb);
-      __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-      goto __pyx_L1_error;
-      __pyx_L5_exception_handled:;
-      __Pyx_XGIVEREF(__pyx_save_exc_type);
-      __Pyx_XGIVEREF(__pyx_save_exc_value);
-      __Pyx_XGIVEREF(__pyx_save_exc_tb);
-      __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-      __pyx_L11_try_end:;
-    }
-    goto __pyx_L3;
-  }
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":65
- * 		except NotImplementedError:
- * 			seed = long(time.time() * 256) # use fractional seconds
- * 	elif not isinstance(seed, int) and not isinstance(seed, long):             # <<<<<<<<<<<<<<
- * 		try:
- * 			seed = hash(seed)
- */
-  __pyx_t_1 = PyInt_Check(__pyx_v_seed); 
-  __pyx_t_8 = (!__pyx_t_1);
-  if (__pyx_t_8) {
-    __pyx_t_1 = PyLong_Check(__pyx_v_seed); 
-    __pyx_t_9 = (!__pyx_t_1);
-    __pyx_t_1 = __pyx_t_9;
-  } else {
-    __pyx_t_1 = __pyx_t_8;
-  }
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":66
- * 			seed = long(time.time() * 256) # use fractional seconds
- * 	elif not isinstance(seed, int) and not isinstance(seed, long):
- * 		try:             # <<<<<<<<<<<<<<
- * 			seed = hash(seed)
- * 		except TypeError:
- */
-    {
-      PyObject *__pyx_save_exc_type, *__pyx_save_exc_value, *__pyx_save_exc_tb;
-      __Pyx_ExceptionSave(&__pyx_save_exc_type, &__pyx_save_exc_value, &__pyx_save_exc_tb);
-      __Pyx_XGOTREF(__pyx_save_exc_type);
-      __Pyx_XGOTREF(__pyx_save_exc_value);
-      __Pyx_XGOTREF(__pyx_save_exc_tb);
-      /*try:*/ {
-
-        /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":67
- * 	elif not isinstance(seed, int) and not isinstance(seed, long):
- * 		try:
- * 			seed = hash(seed)             # <<<<<<<<<<<<<<
- * 		except TypeError:
- * 			raise DcmtParameterError("Seed must be an integer or hashable type")
- */
-        __pyx_t_10 = PyObject_Hash(__pyx_v_seed); if (unlikely(__pyx_t_10 == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 67; __pyx_clineno = __LINE__; goto __pyx_L14_error;}
-        __pyx_t_2 = PyInt_FromLong(__pyx_t_10); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 67; __pyx_clineno = __LINE__; goto __pyx_L14_error;}
-        __Pyx_GOTREF(__pyx_t_2);
-        __Pyx_DECREF(__pyx_v_seed);
-        __pyx_v_seed = __pyx_t_2;
-        __pyx_t_2 = 0;
-      }
-      __Pyx_XDECREF(__pyx_save_exc_type); __pyx_save_exc_type = 0;
-      __Pyx_XDECREF(__pyx_save_exc_value); __pyx_save_exc_value = 0;
-      __Pyx_XDECREF(__pyx_save_exc_tb); __pyx_save_exc_tb = 0;
-      goto __pyx_L21_try_end;
-      __pyx_L14_error:;
-      __Pyx_XDECREF(__pyx_t_6); __pyx_t_6 = 0;
-      __Pyx_XDECREF(__pyx_t_7); __pyx_t_7 = 0;
-      __Pyx_XDECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __Pyx_XDECREF(__pyx_t_3); __pyx_t_3 = 0;
-      __Pyx_XDECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-      /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":68
- * 		try:
- * 			seed = hash(seed)
- * 		except TypeError:             # <<<<<<<<<<<<<<
- * 			raise DcmtParameterError("Seed must be an integer or hashable type")
- * 
- */
-      __pyx_t_5 = PyErr_ExceptionMatches(__pyx_builtin_TypeError);
-      if (__pyx_t_5) {
-        __Pyx_AddTraceback("dcmt.numpyrandom.get_seed");
-        if (__Pyx_GetException(&__pyx_t_2, &__pyx_t_3, &__pyx_t_4) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 68; __pyx_clineno = __LINE__; goto __pyx_L16_except_error;}
-        __Pyx_GOTREF(__pyx_t_2);
-        __Pyx_GOTREF(__pyx_t_3);
-        __Pyx_GOTREF(__pyx_t_4);
-
-        /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":69
- * 			seed = hash(seed)
- * 		except TypeError:
- * 			raise DcmtParameterError("Seed must be an integer or hashable type")             # <<<<<<<<<<<<<<
- * 
- * 	# not checking for overflow now, since we need 4 lower bytes anyway
- */
-        __pyx_t_7 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L16_except_error;}
-        __Pyx_GOTREF(__pyx_t_7);
-        __pyx_t_6 = PyObject_Call(__pyx_t_7, ((PyObject *)__pyx_k_tuple_3), NULL); if (unlikely(!__pyx_t_6)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L16_except_error;}
-        __Pyx_GOTREF(__pyx_t_6);
-        __Pyx_DECREF(__pyx_t_7); __pyx_t_7 = 0;
-        __Pyx_Raise(__pyx_t_6, 0, 0);
-        __Pyx_DECREF(__pyx_t_6); __pyx_t_6 = 0;
-        {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L16_except_error;}
-        __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-        __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-        __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-        goto __pyx_L15_exception_handled;
-      }
-      __pyx_L16_except_error:;
-      __Pyx_XGIVEREF(__pyx_save_exc_type);
-      __Pyx_XGIVEREF(__pyx_save_exc_value);
-      __Pyx_XGIVEREF(__pyx_save_exc_tb);
-      __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-      goto __pyx_L1_error;
-      __pyx_L15_exception_handled:;
-      __Pyx_XGIVEREF(__pyx_save_exc_type);
-      __Pyx_XGIVEREF(__pyx_save_exc_value);
-      __Pyx_XGIVEREF(__pyx_save_exc_tb);
-      __Pyx_ExceptionReset(__pyx_save_exc_type, __pyx_save_exc_value, __pyx_save_exc_tb);
-      __pyx_L21_try_end:;
-    }
-    goto __pyx_L3;
-  }
-  __pyx_L3:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":72
- * 
- * 	# not checking for overflow now, since we need 4 lower bytes anyway
- * 	return PyInt_AsUnsignedLongMask(seed)             # <<<<<<<<<<<<<<
- * 
- * cdef void validate_parameters(wordlen, exponent, start_id, max_id,
- */
-  __pyx_r = PyInt_AsUnsignedLongMask(__pyx_v_seed);
-  goto __pyx_L0;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_6);
-  __Pyx_XDECREF(__pyx_t_7);
-  __Pyx_AddTraceback("dcmt.numpyrandom.get_seed");
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_seed);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":74
- * 	return PyInt_AsUnsignedLongMask(seed)
- * 
- * cdef void validate_parameters(wordlen, exponent, start_id, max_id,             # <<<<<<<<<<<<<<
- * 		int *c_wordlen, int *c_exponent, int *c_start_id, int *c_max_id) except *:
- * 	"""Return valid parameter or raise an exception"""
- */
-
-static  void __pyx_f_4dcmt_11numpyrandom_validate_parameters(PyObject *__pyx_v_wordlen, PyObject *__pyx_v_exponent, PyObject *__pyx_v_start_id, PyObject *__pyx_v_max_id, int *__pyx_v_c_wordlen, int *__pyx_v_c_exponent, int *__pyx_v_c_start_id, int *__pyx_v_c_max_id) {
-  int __pyx_v_w;
-  int __pyx_v_p;
-  int __pyx_v_sid;
-  int __pyx_v_mid;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  int __pyx_t_6;
-  int __pyx_t_7;
-  int __pyx_t_8;
-  __Pyx_RefNannySetupContext("validate_parameters");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":80
- * 	cdef int w, p, sid, mid
- * 
- * 	w = <int>PyInt_AsLong(wordlen)             # <<<<<<<<<<<<<<
- * 	p = <int>PyInt_AsLong(exponent)
- * 	sid = <int>PyInt_AsLong(start_id)
- */
-  __pyx_v_w = ((int)PyInt_AsLong(__pyx_v_wordlen));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":81
- * 
- * 	w = <int>PyInt_AsLong(wordlen)
- * 	p = <int>PyInt_AsLong(exponent)             # <<<<<<<<<<<<<<
- * 	sid = <int>PyInt_AsLong(start_id)
- * 	mid = <int>PyInt_AsLong(max_id)
- */
-  __pyx_v_p = ((int)PyInt_AsLong(__pyx_v_exponent));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":82
- * 	w = <int>PyInt_AsLong(wordlen)
- * 	p = <int>PyInt_AsLong(exponent)
- * 	sid = <int>PyInt_AsLong(start_id)             # <<<<<<<<<<<<<<
- * 	mid = <int>PyInt_AsLong(max_id)
- * 
- */
-  __pyx_v_sid = ((int)PyInt_AsLong(__pyx_v_start_id));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":83
- * 	p = <int>PyInt_AsLong(exponent)
- * 	sid = <int>PyInt_AsLong(start_id)
- * 	mid = <int>PyInt_AsLong(max_id)             # <<<<<<<<<<<<<<
- * 
- * 	if sid > mid:
- */
-  __pyx_v_mid = ((int)PyInt_AsLong(__pyx_v_max_id));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":85
- * 	mid = <int>PyInt_AsLong(max_id)
- * 
- * 	if sid > mid:             # <<<<<<<<<<<<<<
- * 		raise DcmtParameterError("Starting ID must be equal to or lower than maximum ID")
- * 
- */
-  __pyx_t_1 = (__pyx_v_sid > __pyx_v_mid);
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":86
- * 
- * 	if sid > mid:
- * 		raise DcmtParameterError("Starting ID must be equal to or lower than maximum ID")             # <<<<<<<<<<<<<<
- * 
- * 	if sid < 0 or mid > 65535:
- */
-    __pyx_t_2 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_k_tuple_5), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __Pyx_Raise(__pyx_t_3, 0, 0);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L3;
-  }
-  __pyx_L3:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":88
- * 		raise DcmtParameterError("Starting ID must be equal to or lower than maximum ID")
- * 
- * 	if sid < 0 or mid > 65535:             # <<<<<<<<<<<<<<
- * 		raise DcmtParameterError("All IDs must lie between 0 and 65535")
- * 
- */
-  __pyx_t_1 = (__pyx_v_sid < 0);
-  if (!__pyx_t_1) {
-    __pyx_t_4 = (__pyx_v_mid > 65535);
-    __pyx_t_5 = __pyx_t_4;
-  } else {
-    __pyx_t_5 = __pyx_t_1;
-  }
-  if (__pyx_t_5) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":89
- * 
- * 	if sid < 0 or mid > 65535:
- * 		raise DcmtParameterError("All IDs must lie between 0 and 65535")             # <<<<<<<<<<<<<<
- * 
- * 	if w == 31 and p == 521 and sid <= 9 and mid >= 9:
- */
-    __pyx_t_3 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_k_tuple_7), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L4;
-  }
-  __pyx_L4:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":91
- * 		raise DcmtParameterError("All IDs must lie between 0 and 65535")
- * 
- * 	if w == 31 and p == 521 and sid <= 9 and mid >= 9:             # <<<<<<<<<<<<<<
- * 		raise DcmtParameterError("Known bug: cannot create RNG for wordlen=31, exponent=521, id=9")
- * 
- */
-  __pyx_t_5 = (__pyx_v_w == 31);
-  if (__pyx_t_5) {
-    __pyx_t_1 = (__pyx_v_p == 521);
-    if (__pyx_t_1) {
-      __pyx_t_4 = (__pyx_v_sid <= 9);
-      if (__pyx_t_4) {
-        __pyx_t_6 = (__pyx_v_mid >= 9);
-        __pyx_t_7 = __pyx_t_6;
-      } else {
-        __pyx_t_7 = __pyx_t_4;
-      }
-      __pyx_t_4 = __pyx_t_7;
-    } else {
-      __pyx_t_4 = __pyx_t_1;
-    }
-    __pyx_t_1 = __pyx_t_4;
-  } else {
-    __pyx_t_1 = __pyx_t_5;
-  }
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":92
- * 
- * 	if w == 31 and p == 521 and sid <= 9 and mid >= 9:
- * 		raise DcmtParameterError("Known bug: cannot create RNG for wordlen=31, exponent=521, id=9")             # <<<<<<<<<<<<<<
- * 
- * 	if w != 31 and w != 32:
- */
-    __pyx_t_2 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_k_tuple_9), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __Pyx_Raise(__pyx_t_3, 0, 0);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":94
- * 		raise DcmtParameterError("Known bug: cannot create RNG for wordlen=31, exponent=521, id=9")
- * 
- * 	if w != 31 and w != 32:             # <<<<<<<<<<<<<<
- * 		raise DcmtParameterError("Word length must be equal to 31 or 32")
- * 
- */
-  switch (__pyx_v_w) {
-    case 31:
-    case 32:
-    __pyx_t_1 = 0;
-    break;
-    default:
-    __pyx_t_1 = 1;
-    break;
-  }
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":95
- * 
- * 	if w != 31 and w != 32:
- * 		raise DcmtParameterError("Word length must be equal to 31 or 32")             # <<<<<<<<<<<<<<
- * 
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
- */
-    __pyx_t_3 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 95; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_2 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_k_tuple_11), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 95; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 95; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":97
- * 		raise DcmtParameterError("Word length must be equal to 31 or 32")
- * 
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,             # <<<<<<<<<<<<<<
- * 			9689, 9941, 11213, 19937, 21701, 23209, 44497):
- * 		raise DcmtParameterError("Mersenne exponent is incorrect or not from a supported set")
- */
-  __pyx_t_8 = __pyx_v_p;
-  switch (__pyx_v_p) {
-    case 521:
-    case 607:
-    case 1279:
-    case 2203:
-    case 2281:
-    case 3217:
-    case 4253:
-    case 4423:
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":98
- * 
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
- * 			9689, 9941, 11213, 19937, 21701, 23209, 44497):             # <<<<<<<<<<<<<<
- * 		raise DcmtParameterError("Mersenne exponent is incorrect or not from a supported set")
- * 
- */
-    case 9689:
-    case 9941:
-    case 11213:
-    case 19937:
-    case 21701:
-    case 23209:
-    case 44497:
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":97
- * 		raise DcmtParameterError("Word length must be equal to 31 or 32")
- * 
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,             # <<<<<<<<<<<<<<
- * 			9689, 9941, 11213, 19937, 21701, 23209, 44497):
- * 		raise DcmtParameterError("Mersenne exponent is incorrect or not from a supported set")
- */
-    __pyx_t_1 = 0;
-    break;
-    default:
-    __pyx_t_1 = 1;
-    break;
-  }
-  __pyx_t_5 = __pyx_t_1;
-  if (__pyx_t_5) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":99
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
- * 			9689, 9941, 11213, 19937, 21701, 23209, 44497):
- * 		raise DcmtParameterError("Mersenne exponent is incorrect or not from a supported set")             # <<<<<<<<<<<<<<
- * 
- * 	c_wordlen[0] = w
- */
-    __pyx_t_2 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_k_tuple_13), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __Pyx_Raise(__pyx_t_3, 0, 0);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L7;
-  }
-  __pyx_L7:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":101
- * 		raise DcmtParameterError("Mersenne exponent is incorrect or not from a supported set")
- * 
- * 	c_wordlen[0] = w             # <<<<<<<<<<<<<<
- * 	c_exponent[0] = p
- * 	c_start_id[0] = sid
- */
-  (__pyx_v_c_wordlen[0]) = __pyx_v_w;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":102
- * 
- * 	c_wordlen[0] = w
- * 	c_exponent[0] = p             # <<<<<<<<<<<<<<
- * 	c_start_id[0] = sid
- * 	c_max_id[0] = mid
- */
-  (__pyx_v_c_exponent[0]) = __pyx_v_p;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":103
- * 	c_wordlen[0] = w
- * 	c_exponent[0] = p
- * 	c_start_id[0] = sid             # <<<<<<<<<<<<<<
- * 	c_max_id[0] = mid
- * 
- */
-  (__pyx_v_c_start_id[0]) = __pyx_v_sid;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":104
- * 	c_exponent[0] = p
- * 	c_start_id[0] = sid
- * 	c_max_id[0] = mid             # <<<<<<<<<<<<<<
- * 
- * cdef object create_mt_range(args, wordlen, exponent, seed, mt_struct ***mts, int *count):
- */
-  (__pyx_v_c_max_id[0]) = __pyx_v_mid;
-
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("dcmt.numpyrandom.validate_parameters");
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":106
- * 	c_max_id[0] = mid
- * 
- * cdef object create_mt_range(args, wordlen, exponent, seed, mt_struct ***mts, int *count):             # <<<<<<<<<<<<<<
- * 
- * 	cdef int w, p, mid, sid
- */
-
-static  PyObject *__pyx_f_4dcmt_11numpyrandom_create_mt_range(PyObject *__pyx_v_args, PyObject *__pyx_v_wordlen, PyObject *__pyx_v_exponent, PyObject *__pyx_v_seed, mt_struct ***__pyx_v_mts, int *__pyx_v_count) {
-  int __pyx_v_w;
-  int __pyx_v_p;
-  int __pyx_v_mid;
-  int __pyx_v_sid;
-  PyObject *__pyx_v_start_id;
-  PyObject *__pyx_v_max_id;
-  uint32_t __pyx_v_s;
-  mt_struct **__pyx_v_m;
-  PyObject *__pyx_v_py_count;
-  PyObject *__pyx_r = NULL;
-  Py_ssize_t __pyx_t_1;
-  int __pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  uint32_t __pyx_t_6;
-  int __pyx_t_7;
-  int __pyx_t_8;
-  PyObject *__pyx_t_9 = NULL;
-  __Pyx_RefNannySetupContext("create_mt_range");
-  __pyx_v_start_id = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_max_id = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_py_count = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":110
- * 	cdef int w, p, mid, sid
- * 
- * 	if len(args) == 1:             # <<<<<<<<<<<<<<
- * 		start_id = 0
- * 		max_id, = args
- */
-  __pyx_t_1 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_1 == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 110; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_2 = (__pyx_t_1 == 1);
-  if (__pyx_t_2) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":111
- * 
- * 	if len(args) == 1:
- * 		start_id = 0             # <<<<<<<<<<<<<<
- * 		max_id, = args
- * 	elif len(args) == 2:
- */
-    __Pyx_INCREF(__pyx_int_0);
-    __Pyx_DECREF(__pyx_v_start_id);
-    __pyx_v_start_id = __pyx_int_0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":112
- * 	if len(args) == 1:
- * 		start_id = 0
- * 		max_id, = args             # <<<<<<<<<<<<<<
- * 	elif len(args) == 2:
- * 		start_id, max_id = args
- */
-    if (PyTuple_CheckExact(__pyx_v_args) && likely(PyTuple_GET_SIZE(__pyx_v_args) == 1)) {
-      PyObject* tuple = __pyx_v_args;
-      __pyx_t_3 = PyTuple_GET_ITEM(tuple, 0); __Pyx_INCREF(__pyx_t_3);
-      __Pyx_DECREF(__pyx_v_max_id);
-      __pyx_v_max_id = __pyx_t_3;
-      __pyx_t_3 = 0;
-    } else {
-      __pyx_t_4 = PyObject_GetIter(__pyx_v_args); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 112; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      __pyx_t_3 = __Pyx_UnpackItem(__pyx_t_4, 0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 112; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_3);
-      if (__Pyx_EndUnpack(__pyx_t_4, 1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 112; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-      __Pyx_DECREF(__pyx_v_max_id);
-      __pyx_v_max_id = __pyx_t_3;
-      __pyx_t_3 = 0;
-    }
-    goto __pyx_L3;
-  }
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":113
- * 		start_id = 0
- * 		max_id, = args
- * 	elif len(args) == 2:             # <<<<<<<<<<<<<<
- * 		start_id, max_id = args
- * 	else:
- */
-  __pyx_t_1 = PyObject_Length(__pyx_v_args); if (unlikely(__pyx_t_1 == -1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 113; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_t_2 = (__pyx_t_1 == 2);
-  if (__pyx_t_2) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":114
- * 		max_id, = args
- * 	elif len(args) == 2:
- * 		start_id, max_id = args             # <<<<<<<<<<<<<<
- * 	else:
- * 		raise TypeError("range expected 1 or 2 positional arguments")
- */
-    if (PyTuple_CheckExact(__pyx_v_args) && likely(PyTuple_GET_SIZE(__pyx_v_args) == 2)) {
-      PyObject* tuple = __pyx_v_args;
-      __pyx_t_3 = PyTuple_GET_ITEM(tuple, 0); __Pyx_INCREF(__pyx_t_3);
-      __pyx_t_4 = PyTuple_GET_ITEM(tuple, 1); __Pyx_INCREF(__pyx_t_4);
-      __Pyx_DECREF(__pyx_v_start_id);
-      __pyx_v_start_id = __pyx_t_3;
-      __pyx_t_3 = 0;
-      __Pyx_DECREF(__pyx_v_max_id);
-      __pyx_v_max_id = __pyx_t_4;
-      __pyx_t_4 = 0;
-    } else {
-      __pyx_t_5 = PyObject_GetIter(__pyx_v_args); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 114; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_5);
-      __pyx_t_3 = __Pyx_UnpackItem(__pyx_t_5, 0); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 114; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_3);
-      __pyx_t_4 = __Pyx_UnpackItem(__pyx_t_5, 1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 114; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_GOTREF(__pyx_t_4);
-      if (__Pyx_EndUnpack(__pyx_t_5, 2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 114; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-      __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-      __Pyx_DECREF(__pyx_v_start_id);
-      __pyx_v_start_id = __pyx_t_3;
-      __pyx_t_3 = 0;
-      __Pyx_DECREF(__pyx_v_max_id);
-      __pyx_v_max_id = __pyx_t_4;
-      __pyx_t_4 = 0;
-    }
-    goto __pyx_L3;
-  }
-  /*else*/ {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":116
- * 		start_id, max_id = args
- * 	else:
- * 		raise TypeError("range expected 1 or 2 positional arguments")             # <<<<<<<<<<<<<<
- * 
- * 	max_id -= 1
- */
-    __pyx_t_4 = PyObject_Call(__pyx_builtin_TypeError, ((PyObject *)__pyx_k_tuple_15), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_Raise(__pyx_t_4, 0, 0);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __pyx_L3:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":118
- * 		raise TypeError("range expected 1 or 2 positional arguments")
- * 
- * 	max_id -= 1             # <<<<<<<<<<<<<<
- * 
- * 	if max_id < start_id:
- */
-  __pyx_t_4 = PyNumber_InPlaceSubtract(__pyx_v_max_id, __pyx_int_1); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 118; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_v_max_id);
-  __pyx_v_max_id = __pyx_t_4;
-  __pyx_t_4 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":120
- * 	max_id -= 1
- * 
- * 	if max_id < start_id:             # <<<<<<<<<<<<<<
- * 		return []
- * 
- */
-  __pyx_t_4 = PyObject_RichCompare(__pyx_v_max_id, __pyx_v_start_id, Py_LT); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_2 = __Pyx_PyObject_IsTrue(__pyx_t_4); if (unlikely(__pyx_t_2 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  if (__pyx_t_2) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":121
- * 
- * 	if max_id < start_id:
- * 		return []             # <<<<<<<<<<<<<<
- * 
- * 	validate_parameters(wordlen, exponent, start_id, max_id, &w, &p, &sid, &mid)
- */
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_4 = PyList_New(0); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 121; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-    __pyx_r = ((PyObject *)__pyx_t_4);
-    __pyx_t_4 = 0;
-    goto __pyx_L0;
-    goto __pyx_L4;
-  }
-  __pyx_L4:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":123
- * 		return []
- * 
- * 	validate_parameters(wordlen, exponent, start_id, max_id, &w, &p, &sid, &mid)             # <<<<<<<<<<<<<<
- * 	cdef uint32_t s = get_seed(seed)
- * 
- */
-  __pyx_f_4dcmt_11numpyrandom_validate_parameters(__pyx_v_wordlen, __pyx_v_exponent, __pyx_v_start_id, __pyx_v_max_id, (&__pyx_v_w), (&__pyx_v_p), (&__pyx_v_sid), (&__pyx_v_mid)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 123; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":124
- * 
- * 	validate_parameters(wordlen, exponent, start_id, max_id, &w, &p, &sid, &mid)
- * 	cdef uint32_t s = get_seed(seed)             # <<<<<<<<<<<<<<
- * 
- * 	cdef mt_struct **m = get_mt_parameters_st(w, p, sid, mid, s, count)
- */
-  __pyx_t_6 = __pyx_f_4dcmt_11numpyrandom_get_seed(__pyx_v_seed); if (unlikely(__pyx_t_6 == -1 && PyErr_Occurred())) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 124; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_v_s = __pyx_t_6;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":126
- * 	cdef uint32_t s = get_seed(seed)
- * 
- * 	cdef mt_struct **m = get_mt_parameters_st(w, p, sid, mid, s, count)             # <<<<<<<<<<<<<<
- * 
- * 	if count[0] < max_id - start_id + 1 or mts == NULL:
- */
-  __pyx_v_m = get_mt_parameters_st(__pyx_v_w, __pyx_v_p, __pyx_v_sid, __pyx_v_mid, __pyx_v_s, __pyx_v_count);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":128
- * 	cdef mt_struct **m = get_mt_parameters_st(w, p, sid, mid, s, count)
- * 
- * 	if count[0] < max_id - start_id + 1 or mts == NULL:             # <<<<<<<<<<<<<<
- * 		py_count = PyInt_FromLong(count[0])
- * 		if mts != NULL:
- */
-  __pyx_t_4 = PyInt_FromLong((__pyx_v_count[0])); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyNumber_Subtract(__pyx_v_max_id, __pyx_v_start_id); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_5 = PyNumber_Add(__pyx_t_3, __pyx_int_1); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_RichCompare(__pyx_t_4, __pyx_t_5, Py_LT); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-  __pyx_t_2 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_2 < 0)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 128; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  if (!__pyx_t_2) {
-    __pyx_t_7 = (__pyx_v_mts == NULL);
-    __pyx_t_8 = __pyx_t_7;
-  } else {
-    __pyx_t_8 = __pyx_t_2;
-  }
-  if (__pyx_t_8) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":129
- * 
- * 	if count[0] < max_id - start_id + 1 or mts == NULL:
- * 		py_count = PyInt_FromLong(count[0])             # <<<<<<<<<<<<<<
- * 		if mts != NULL:
- * 			free_mt_struct_array(m, count[0])
- */
-    __pyx_t_3 = PyInt_FromLong((__pyx_v_count[0])); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 129; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_v_py_count);
-    __pyx_v_py_count = __pyx_t_3;
-    __pyx_t_3 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":130
- * 	if count[0] < max_id - start_id + 1 or mts == NULL:
- * 		py_count = PyInt_FromLong(count[0])
- * 		if mts != NULL:             # <<<<<<<<<<<<<<
- * 			free_mt_struct_array(m, count[0])
- * 		raise DcmtError("dcmt internal error: could not create all requested RNGs " +
- */
-    __pyx_t_8 = (__pyx_v_mts != NULL);
-    if (__pyx_t_8) {
-
-      /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":131
- * 		py_count = PyInt_FromLong(count[0])
- * 		if mts != NULL:
- * 			free_mt_struct_array(m, count[0])             # <<<<<<<<<<<<<<
- * 		raise DcmtError("dcmt internal error: could not create all requested RNGs " +
- * 			"(failed at id=" + str(start_id + py_count) + ")")
- */
-      free_mt_struct_array(__pyx_v_m, (__pyx_v_count[0]));
-      goto __pyx_L6;
-    }
-    __pyx_L6:;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":132
- * 		if mts != NULL:
- * 			free_mt_struct_array(m, count[0])
- * 		raise DcmtError("dcmt internal error: could not create all requested RNGs " +             # <<<<<<<<<<<<<<
- * 			"(failed at id=" + str(start_id + py_count) + ")")
- * 
- */
-    __pyx_t_3 = __Pyx_GetName(__pyx_m, __pyx_n_s__DcmtError); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":133
- * 			free_mt_struct_array(m, count[0])
- * 		raise DcmtError("dcmt internal error: could not create all requested RNGs " +
- * 			"(failed at id=" + str(start_id + py_count) + ")")             # <<<<<<<<<<<<<<
- * 
- * 	mts[0] = m
- */
-    __pyx_t_5 = PyNumber_Add(((PyObject *)__pyx_kp_s_16), ((PyObject *)__pyx_kp_s_17)); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_5));
-    __pyx_t_4 = PyNumber_Add(__pyx_v_start_id, __pyx_v_py_count); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_9 = PyTuple_New(1); if (unlikely(!__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_9));
-    PyTuple_SET_ITEM(__pyx_t_9, 0, __pyx_t_4);
-    __Pyx_GIVEREF(__pyx_t_4);
-    __pyx_t_4 = 0;
-    __pyx_t_4 = PyObject_Call(((PyObject *)((PyObject*)(&PyString_Type))), ((PyObject *)__pyx_t_9), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(((PyObject *)__pyx_t_9)); __pyx_t_9 = 0;
-    __pyx_t_9 = PyNumber_Add(((PyObject *)__pyx_t_5), __pyx_t_4); if (unlikely(!__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_9);
-    __Pyx_DECREF(((PyObject *)__pyx_t_5)); __pyx_t_5 = 0;
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_t_4 = PyNumber_Add(__pyx_t_9, ((PyObject *)__pyx_kp_s_18)); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 133; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_9); __pyx_t_9 = 0;
-    __pyx_t_9 = PyTuple_New(1); if (unlikely(!__pyx_t_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_9));
-    PyTuple_SET_ITEM(__pyx_t_9, 0, __pyx_t_4);
-    __Pyx_GIVEREF(__pyx_t_4);
-    __pyx_t_4 = 0;
-    __pyx_t_4 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_9), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_DECREF(((PyObject *)__pyx_t_9)); __pyx_t_9 = 0;
-    __Pyx_Raise(__pyx_t_4, 0, 0);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    {__pyx_filename = __pyx_f[0]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":135
- * 			"(failed at id=" + str(start_id + py_count) + ")")
- * 
- * 	mts[0] = m             # <<<<<<<<<<<<<<
- * 
- * 	return None
- */
-  (__pyx_v_mts[0]) = __pyx_v_m;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":137
- * 	mts[0] = m
- * 
- * 	return None             # <<<<<<<<<<<<<<
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(Py_None);
-  __pyx_r = Py_None;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_XDECREF(__pyx_t_9);
-  __Pyx_AddTraceback("dcmt.numpyrandom.create_mt_range");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_start_id);
-  __Pyx_DECREF(__pyx_v_max_id);
-  __Pyx_DECREF(__pyx_v_py_count);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":61
- * import_array()
- * 
- * cdef object uint32_to_python(uint32_t x):             # <<<<<<<<<<<<<<
- * 	if x > 0x7FFFFFFF and INT_MAX < 0xFFFFFFFF:
- * 		return PyLong_FromUnsignedLong(x)
- */
-
-static  PyObject *__pyx_f_4dcmt_11numpyrandom_uint32_to_python(uint32_t __pyx_v_x) {
-  PyObject *__pyx_r = NULL;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  int __pyx_t_4;
-  int __pyx_t_5;
-  __Pyx_RefNannySetupContext("uint32_to_python");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":62
- * 
- * cdef object uint32_to_python(uint32_t x):
- * 	if x > 0x7FFFFFFF and INT_MAX < 0xFFFFFFFF:             # <<<<<<<<<<<<<<
- * 		return PyLong_FromUnsignedLong(x)
- * 	else:
- */
-  __pyx_t_1 = (__pyx_v_x > 0x7FFFFFFF);
-  if (__pyx_t_1) {
-    __pyx_t_2 = PyInt_FromLong(INT_MAX); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = PyObject_RichCompare(__pyx_t_2, __pyx_int_4294967295, Py_LT); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __pyx_t_4 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_4 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __pyx_t_5 = __pyx_t_4;
-  } else {
-    __pyx_t_5 = __pyx_t_1;
-  }
-  if (__pyx_t_5) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":63
- * cdef object uint32_to_python(uint32_t x):
- * 	if x > 0x7FFFFFFF and INT_MAX < 0xFFFFFFFF:
- * 		return PyLong_FromUnsignedLong(x)             # <<<<<<<<<<<<<<
- * 	else:
- * 		return PyInt_FromLong(x)
- */
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_3 = PyLong_FromUnsignedLong(__pyx_v_x); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 63; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_r = __pyx_t_3;
-    __pyx_t_3 = 0;
-    goto __pyx_L0;
-    goto __pyx_L3;
-  }
-  /*else*/ {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":65
- * 		return PyLong_FromUnsignedLong(x)
- * 	else:
- * 		return PyInt_FromLong(x)             # <<<<<<<<<<<<<<
- * 
- * cdef uint32_t uint32_from_python(object x):
- */
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_3 = PyInt_FromLong(__pyx_v_x); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 65; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_r = __pyx_t_3;
-    __pyx_t_3 = 0;
-    goto __pyx_L0;
-  }
-  __pyx_L3:;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("dcmt.numpyrandom.uint32_to_python");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":67
- * 		return PyInt_FromLong(x)
- * 
- * cdef uint32_t uint32_from_python(object x):             # <<<<<<<<<<<<<<
- * 	return PyInt_AsUnsignedLongMask(x)
- * 
- */
-
-static  uint32_t __pyx_f_4dcmt_11numpyrandom_uint32_from_python(PyObject *__pyx_v_x) {
-  uint32_t __pyx_r;
-  __Pyx_RefNannySetupContext("uint32_from_python");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":68
- * 
- * cdef uint32_t uint32_from_python(object x):
- * 	return PyInt_AsUnsignedLongMask(x)             # <<<<<<<<<<<<<<
- * 
- * cdef get_mt_struct_fields(mt_struct *mt):
- */
-  __pyx_r = PyInt_AsUnsignedLongMask(__pyx_v_x);
-  goto __pyx_L0;
-
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":70
- * 	return PyInt_AsUnsignedLongMask(x)
- * 
- * cdef get_mt_struct_fields(mt_struct *mt):             # <<<<<<<<<<<<<<
- * 	common_fields = get_mt_struct_common_fields(mt)
- * 	common_fields['aaa'] = uint32_to_python(mt.aaa)
- */
-
-static  PyObject *__pyx_f_4dcmt_11numpyrandom_get_mt_struct_fields(mt_struct *__pyx_v_mt) {
-  PyObject *__pyx_v_common_fields;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  __Pyx_RefNannySetupContext("get_mt_struct_fields");
-  __pyx_v_common_fields = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":71
- * 
- * cdef get_mt_struct_fields(mt_struct *mt):
- * 	common_fields = get_mt_struct_common_fields(mt)             # <<<<<<<<<<<<<<
- * 	common_fields['aaa'] = uint32_to_python(mt.aaa)
- * 	common_fields['maskB'] = uint32_to_python(mt.maskB)
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_get_mt_struct_common_fields(__pyx_v_mt); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 71; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_v_common_fields);
-  __pyx_v_common_fields = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":72
- * cdef get_mt_struct_fields(mt_struct *mt):
- * 	common_fields = get_mt_struct_common_fields(mt)
- * 	common_fields['aaa'] = uint32_to_python(mt.aaa)             # <<<<<<<<<<<<<<
- * 	common_fields['maskB'] = uint32_to_python(mt.maskB)
- * 	common_fields['maskC'] = uint32_to_python(mt.maskC)
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_uint32_to_python(__pyx_v_mt->aaa); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetItem(__pyx_v_common_fields, ((PyObject *)__pyx_n_s__aaa), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 72; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":73
- * 	common_fields = get_mt_struct_common_fields(mt)
- * 	common_fields['aaa'] = uint32_to_python(mt.aaa)
- * 	common_fields['maskB'] = uint32_to_python(mt.maskB)             # <<<<<<<<<<<<<<
- * 	common_fields['maskC'] = uint32_to_python(mt.maskC)
- * 	common_fields['i'] = int(mt.i)
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_uint32_to_python(__pyx_v_mt->maskB); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetItem(__pyx_v_common_fields, ((PyObject *)__pyx_n_s__maskB), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 73; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":74
- * 	common_fields['aaa'] = uint32_to_python(mt.aaa)
- * 	common_fields['maskB'] = uint32_to_python(mt.maskB)
- * 	common_fields['maskC'] = uint32_to_python(mt.maskC)             # <<<<<<<<<<<<<<
- * 	common_fields['i'] = int(mt.i)
- * 	return common_fields
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_uint32_to_python(__pyx_v_mt->maskC); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetItem(__pyx_v_common_fields, ((PyObject *)__pyx_n_s__maskC), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 74; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":75
- * 	common_fields['maskB'] = uint32_to_python(mt.maskB)
- * 	common_fields['maskC'] = uint32_to_python(mt.maskC)
- * 	common_fields['i'] = int(mt.i)             # <<<<<<<<<<<<<<
- * 	return common_fields
- * 
- */
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_mt->i); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  if (PyObject_SetItem(__pyx_v_common_fields, ((PyObject *)__pyx_n_s__i), __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 75; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":76
- * 	common_fields['maskC'] = uint32_to_python(mt.maskC)
- * 	common_fields['i'] = int(mt.i)
- * 	return common_fields             # <<<<<<<<<<<<<<
- * 
- * cdef get_mt_struct_common_fields(mt_struct *mt):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(__pyx_v_common_fields);
-  __pyx_r = __pyx_v_common_fields;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("dcmt.numpyrandom.get_mt_struct_fields");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_common_fields);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":78
- * 	return common_fields
- * 
- * cdef get_mt_struct_common_fields(mt_struct *mt):             # <<<<<<<<<<<<<<
- * 	return {
- * 		'mm': int(mt.mm),
- */
-
-static  PyObject *__pyx_f_4dcmt_11numpyrandom_get_mt_struct_common_fields(mt_struct *__pyx_v_mt) {
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  __Pyx_RefNannySetupContext("get_mt_struct_common_fields");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":79
- * 
- * cdef get_mt_struct_common_fields(mt_struct *mt):
- * 	return {             # <<<<<<<<<<<<<<
- * 		'mm': int(mt.mm),
- * 		'nn': int(mt.nn),
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyDict_New(); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":80
- * cdef get_mt_struct_common_fields(mt_struct *mt):
- * 	return {
- * 		'mm': int(mt.mm),             # <<<<<<<<<<<<<<
- * 		'nn': int(mt.nn),
- * 		'rr': int(mt.rr),
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->mm); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 80; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 80; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 80; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__mm), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":81
- * 	return {
- * 		'mm': int(mt.mm),
- * 		'nn': int(mt.nn),             # <<<<<<<<<<<<<<
- * 		'rr': int(mt.rr),
- * 		'ww': int(mt.ww),
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->nn); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 81; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__nn), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":82
- * 		'mm': int(mt.mm),
- * 		'nn': int(mt.nn),
- * 		'rr': int(mt.rr),             # <<<<<<<<<<<<<<
- * 		'ww': int(mt.ww),
- * 		'wmask': uint32_to_python(mt.wmask),
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->rr); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 82; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__rr), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":83
- * 		'nn': int(mt.nn),
- * 		'rr': int(mt.rr),
- * 		'ww': int(mt.ww),             # <<<<<<<<<<<<<<
- * 		'wmask': uint32_to_python(mt.wmask),
- * 		'umask': uint32_to_python(mt.umask),
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->ww); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 83; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__ww), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":84
- * 		'rr': int(mt.rr),
- * 		'ww': int(mt.ww),
- * 		'wmask': uint32_to_python(mt.wmask),             # <<<<<<<<<<<<<<
- * 		'umask': uint32_to_python(mt.umask),
- * 		'lmask': uint32_to_python(mt.lmask),
- */
-  __pyx_t_2 = __pyx_f_4dcmt_11numpyrandom_uint32_to_python(__pyx_v_mt->wmask); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 84; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__wmask), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":85
- * 		'ww': int(mt.ww),
- * 		'wmask': uint32_to_python(mt.wmask),
- * 		'umask': uint32_to_python(mt.umask),             # <<<<<<<<<<<<<<
- * 		'lmask': uint32_to_python(mt.lmask),
- * 		'shift0': int(mt.shift0),
- */
-  __pyx_t_2 = __pyx_f_4dcmt_11numpyrandom_uint32_to_python(__pyx_v_mt->umask); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 85; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__umask), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":86
- * 		'wmask': uint32_to_python(mt.wmask),
- * 		'umask': uint32_to_python(mt.umask),
- * 		'lmask': uint32_to_python(mt.lmask),             # <<<<<<<<<<<<<<
- * 		'shift0': int(mt.shift0),
- * 		'shift1': int(mt.shift1),
- */
-  __pyx_t_2 = __pyx_f_4dcmt_11numpyrandom_uint32_to_python(__pyx_v_mt->lmask); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__lmask), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":87
- * 		'umask': uint32_to_python(mt.umask),
- * 		'lmask': uint32_to_python(mt.lmask),
- * 		'shift0': int(mt.shift0),             # <<<<<<<<<<<<<<
- * 		'shift1': int(mt.shift1),
- * 		'shiftB': int(mt.shiftB),
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->shift0); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 87; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__shift0), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":88
- * 		'lmask': uint32_to_python(mt.lmask),
- * 		'shift0': int(mt.shift0),
- * 		'shift1': int(mt.shift1),             # <<<<<<<<<<<<<<
- * 		'shiftB': int(mt.shiftB),
- * 		'shiftC': int(mt.shiftC)
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->shift1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 88; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__shift1), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":89
- * 		'shift0': int(mt.shift0),
- * 		'shift1': int(mt.shift1),
- * 		'shiftB': int(mt.shiftB),             # <<<<<<<<<<<<<<
- * 		'shiftC': int(mt.shiftC)
- * 	}
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->shiftB); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__shiftB), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":90
- * 		'shift1': int(mt.shift1),
- * 		'shiftB': int(mt.shiftB),
- * 		'shiftC': int(mt.shiftC)             # <<<<<<<<<<<<<<
- * 	}
- * 
- */
-  __pyx_t_2 = PyInt_FromLong(__pyx_v_mt->shiftC); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_2);
-  __Pyx_GIVEREF(__pyx_t_2);
-  __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyInt_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 90; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  if (PyDict_SetItem(__pyx_t_1, ((PyObject *)__pyx_n_s__shiftC), __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 79; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_r = ((PyObject *)__pyx_t_1);
-  __pyx_t_1 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("dcmt.numpyrandom.get_mt_struct_common_fields");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":93
- * 	}
- * 
- * cdef set_mt_struct_fields(mt_struct *mt, mt_dict):             # <<<<<<<<<<<<<<
- * 	set_mt_struct_common_fields(mt, mt_dict)
- * 	mt.aaa = uint32_from_python(mt_dict['aaa'])
- */
-
-static  PyObject *__pyx_f_4dcmt_11numpyrandom_set_mt_struct_fields(mt_struct *__pyx_v_mt, PyObject *__pyx_v_mt_dict) {
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  __Pyx_RefNannySetupContext("set_mt_struct_fields");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":94
- * 
- * cdef set_mt_struct_fields(mt_struct *mt, mt_dict):
- * 	set_mt_struct_common_fields(mt, mt_dict)             # <<<<<<<<<<<<<<
- * 	mt.aaa = uint32_from_python(mt_dict['aaa'])
- * 	mt.maskB = uint32_from_python(mt_dict['maskB'])
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_set_mt_struct_common_fields(__pyx_v_mt, __pyx_v_mt_dict); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 94; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":95
- * cdef set_mt_struct_fields(mt_struct *mt, mt_dict):
- * 	set_mt_struct_common_fields(mt, mt_dict)
- * 	mt.aaa = uint32_from_python(mt_dict['aaa'])             # <<<<<<<<<<<<<<
- * 	mt.maskB = uint32_from_python(mt_dict['maskB'])
- * 	mt.maskC = uint32_from_python(mt_dict['maskC'])
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_mt_dict, ((PyObject *)__pyx_n_s__aaa)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 95; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->aaa = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":96
- * 	set_mt_struct_common_fields(mt, mt_dict)
- * 	mt.aaa = uint32_from_python(mt_dict['aaa'])
- * 	mt.maskB = uint32_from_python(mt_dict['maskB'])             # <<<<<<<<<<<<<<
- * 	mt.maskC = uint32_from_python(mt_dict['maskC'])
- * 	mt.i = uint32_from_python(mt_dict['i'])
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_mt_dict, ((PyObject *)__pyx_n_s__maskB)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 96; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->maskB = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":97
- * 	mt.aaa = uint32_from_python(mt_dict['aaa'])
- * 	mt.maskB = uint32_from_python(mt_dict['maskB'])
- * 	mt.maskC = uint32_from_python(mt_dict['maskC'])             # <<<<<<<<<<<<<<
- * 	mt.i = uint32_from_python(mt_dict['i'])
- * 
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_mt_dict, ((PyObject *)__pyx_n_s__maskC)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 97; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->maskC = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":98
- * 	mt.maskB = uint32_from_python(mt_dict['maskB'])
- * 	mt.maskC = uint32_from_python(mt_dict['maskC'])
- * 	mt.i = uint32_from_python(mt_dict['i'])             # <<<<<<<<<<<<<<
- * 
- * cdef set_mt_struct_common_fields(mt_struct *mt, common_mt_dict):
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_mt_dict, ((PyObject *)__pyx_n_s__i)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 98; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->i = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("dcmt.numpyrandom.set_mt_struct_fields");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":100
- * 	mt.i = uint32_from_python(mt_dict['i'])
- * 
- * cdef set_mt_struct_common_fields(mt_struct *mt, common_mt_dict):             # <<<<<<<<<<<<<<
- * 	mt.mm = <int>common_mt_dict['mm']
- * 	mt.nn = <int>common_mt_dict['nn']
- */
-
-static  PyObject *__pyx_f_4dcmt_11numpyrandom_set_mt_struct_common_fields(mt_struct *__pyx_v_mt, PyObject *__pyx_v_common_mt_dict) {
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  int __pyx_t_2;
-  __Pyx_RefNannySetupContext("set_mt_struct_common_fields");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":101
- * 
- * cdef set_mt_struct_common_fields(mt_struct *mt, common_mt_dict):
- * 	mt.mm = <int>common_mt_dict['mm']             # <<<<<<<<<<<<<<
- * 	mt.nn = <int>common_mt_dict['nn']
- * 	mt.rr = <int>common_mt_dict['rr']
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__mm)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 101; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 101; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->mm = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":102
- * cdef set_mt_struct_common_fields(mt_struct *mt, common_mt_dict):
- * 	mt.mm = <int>common_mt_dict['mm']
- * 	mt.nn = <int>common_mt_dict['nn']             # <<<<<<<<<<<<<<
- * 	mt.rr = <int>common_mt_dict['rr']
- * 	mt.ww = <int>common_mt_dict['ww']
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__nn)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 102; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->nn = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":103
- * 	mt.mm = <int>common_mt_dict['mm']
- * 	mt.nn = <int>common_mt_dict['nn']
- * 	mt.rr = <int>common_mt_dict['rr']             # <<<<<<<<<<<<<<
- * 	mt.ww = <int>common_mt_dict['ww']
- * 	mt.wmask = uint32_from_python(common_mt_dict['wmask'])
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__rr)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 103; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 103; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->rr = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":104
- * 	mt.nn = <int>common_mt_dict['nn']
- * 	mt.rr = <int>common_mt_dict['rr']
- * 	mt.ww = <int>common_mt_dict['ww']             # <<<<<<<<<<<<<<
- * 	mt.wmask = uint32_from_python(common_mt_dict['wmask'])
- * 	mt.umask = uint32_from_python(common_mt_dict['umask'])
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__ww)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 104; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->ww = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":105
- * 	mt.rr = <int>common_mt_dict['rr']
- * 	mt.ww = <int>common_mt_dict['ww']
- * 	mt.wmask = uint32_from_python(common_mt_dict['wmask'])             # <<<<<<<<<<<<<<
- * 	mt.umask = uint32_from_python(common_mt_dict['umask'])
- * 	mt.lmask = uint32_from_python(common_mt_dict['lmask'])
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__wmask)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 105; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->wmask = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":106
- * 	mt.ww = <int>common_mt_dict['ww']
- * 	mt.wmask = uint32_from_python(common_mt_dict['wmask'])
- * 	mt.umask = uint32_from_python(common_mt_dict['umask'])             # <<<<<<<<<<<<<<
- * 	mt.lmask = uint32_from_python(common_mt_dict['lmask'])
- * 	mt.shift0 = <int>common_mt_dict['shift0']
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__umask)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 106; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->umask = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":107
- * 	mt.wmask = uint32_from_python(common_mt_dict['wmask'])
- * 	mt.umask = uint32_from_python(common_mt_dict['umask'])
- * 	mt.lmask = uint32_from_python(common_mt_dict['lmask'])             # <<<<<<<<<<<<<<
- * 	mt.shift0 = <int>common_mt_dict['shift0']
- * 	mt.shift1 = <int>common_mt_dict['shift1']
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__lmask)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 107; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_v_mt->lmask = __pyx_f_4dcmt_11numpyrandom_uint32_from_python(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":108
- * 	mt.umask = uint32_from_python(common_mt_dict['umask'])
- * 	mt.lmask = uint32_from_python(common_mt_dict['lmask'])
- * 	mt.shift0 = <int>common_mt_dict['shift0']             # <<<<<<<<<<<<<<
- * 	mt.shift1 = <int>common_mt_dict['shift1']
- * 	mt.shiftB = <int>common_mt_dict['shiftB']
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__shift0)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 108; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 108; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->shift0 = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":109
- * 	mt.lmask = uint32_from_python(common_mt_dict['lmask'])
- * 	mt.shift0 = <int>common_mt_dict['shift0']
- * 	mt.shift1 = <int>common_mt_dict['shift1']             # <<<<<<<<<<<<<<
- * 	mt.shiftB = <int>common_mt_dict['shiftB']
- * 	mt.shiftC = <int>common_mt_dict['shiftC']
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__shift1)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 109; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 109; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->shift1 = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":110
- * 	mt.shift0 = <int>common_mt_dict['shift0']
- * 	mt.shift1 = <int>common_mt_dict['shift1']
- * 	mt.shiftB = <int>common_mt_dict['shiftB']             # <<<<<<<<<<<<<<
- * 	mt.shiftC = <int>common_mt_dict['shiftC']
- * 
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__shiftB)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 110; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 110; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->shiftB = __pyx_t_2;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":111
- * 	mt.shift1 = <int>common_mt_dict['shift1']
- * 	mt.shiftB = <int>common_mt_dict['shiftB']
- * 	mt.shiftC = <int>common_mt_dict['shiftC']             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_t_1 = PyObject_GetItem(__pyx_v_common_mt_dict, ((PyObject *)__pyx_n_s__shiftC)); if (!__pyx_t_1) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 111; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyInt_AsInt(__pyx_t_1); if (unlikely((__pyx_t_2 == (int)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 111; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_v_mt->shiftC = __pyx_t_2;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_AddTraceback("dcmt.numpyrandom.set_mt_struct_common_fields");
-  __pyx_r = 0;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":118
- * 	cdef mt_struct *mt
- * 
- * 	def __init__(self, *args, wordlen=32, exponent=521, id=0, gen_seed=None):             # <<<<<<<<<<<<<<
- * 		cdef int w, p, mid, sid
- * 		validate_parameters(wordlen, exponent, id, id, &w, &p, &sid, &mid)
- */
-
-static int __pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_0__init__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static int __pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_0__init__(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_wordlen = 0;
-  PyObject *__pyx_v_exponent = 0;
-  PyObject *__pyx_v_id = 0;
-  PyObject *__pyx_v_gen_seed = 0;
-  PyObject *__pyx_v_args = 0;
-  int __pyx_v_w;
-  int __pyx_v_p;
-  int __pyx_v_mid;
-  int __pyx_v_sid;
-  uint32_t __pyx_v_s;
-  int __pyx_r;
-  uint32_t __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_n_s__wordlen,&__pyx_n_s__exponent,&__pyx_n_s__id,&__pyx_n_s__gen_seed,0};
-  __Pyx_RefNannySetupContext("__init__");
-  if (PyTuple_GET_SIZE(__pyx_args) > 0) {
-    __pyx_v_args = PyTuple_GetSlice(__pyx_args, 0, PyTuple_GET_SIZE(__pyx_args)); __Pyx_GOTREF(__pyx_v_args);
-    if (unlikely(!__pyx_v_args)) return -1;
-  } else {
-    __pyx_v_args = __pyx_empty_tuple; __Pyx_INCREF(__pyx_empty_tuple);
-  }
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[4] = {0,0,0,0};
-    values[0] = ((PyObject *)__pyx_int_32);
-    values[1] = ((PyObject *)__pyx_int_521);
-    values[2] = ((PyObject *)__pyx_int_0);
-    values[3] = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      default:
-      case  0: break;
-    }
-    while (kw_args > 0) {
-      PyObject* value;
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__wordlen);
-      if (value) { values[0] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__exponent);
-      if (value) { values[1] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__id);
-      if (value) { values[2] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__gen_seed);
-      if (value) { values[3] = value; if (!(--kw_args)) break; }
-      break;
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, 0, "__init__") < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 118; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_wordlen = values[0];
-    __pyx_v_exponent = values[1];
-    __pyx_v_id = values[2];
-    __pyx_v_gen_seed = values[3];
-  } else if (PyTuple_GET_SIZE(__pyx_args) < 0) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_wordlen = ((PyObject *)__pyx_int_32);
-    __pyx_v_exponent = ((PyObject *)__pyx_int_521);
-    __pyx_v_id = ((PyObject *)__pyx_int_0);
-    __pyx_v_gen_seed = ((PyObject *)Py_None);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("__init__", 0, 0, 0, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 118; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_DECREF(__pyx_v_args);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.__init__");
-  __Pyx_RefNannyFinishContext();
-  return -1;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":120
- * 	def __init__(self, *args, wordlen=32, exponent=521, id=0, gen_seed=None):
- * 		cdef int w, p, mid, sid
- * 		validate_parameters(wordlen, exponent, id, id, &w, &p, &sid, &mid)             # <<<<<<<<<<<<<<
- * 		cdef uint32_t s = get_seed(gen_seed)
- * 
- */
-  __pyx_f_4dcmt_11numpyrandom_validate_parameters(__pyx_v_wordlen, __pyx_v_exponent, __pyx_v_id, __pyx_v_id, (&__pyx_v_w), (&__pyx_v_p), (&__pyx_v_sid), (&__pyx_v_mid)); if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 120; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":121
- * 		cdef int w, p, mid, sid
- * 		validate_parameters(wordlen, exponent, id, id, &w, &p, &sid, &mid)
- * 		cdef uint32_t s = get_seed(gen_seed)             # <<<<<<<<<<<<<<
- * 
- * 		self.mt = get_mt_parameter_id_st(w, p, sid, s)
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_get_seed(__pyx_v_gen_seed); if (unlikely(__pyx_t_1 == -1 && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 121; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_v_s = __pyx_t_1;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":123
- * 		cdef uint32_t s = get_seed(gen_seed)
- * 
- * 		self.mt = get_mt_parameter_id_st(w, p, sid, s)             # <<<<<<<<<<<<<<
- * 		self.seed(*args)
- * 
- */
-  ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt = get_mt_parameter_id_st(__pyx_v_w, __pyx_v_p, __pyx_v_sid, __pyx_v_s);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":124
- * 
- * 		self.mt = get_mt_parameter_id_st(w, p, sid, s)
- * 		self.seed(*args)             # <<<<<<<<<<<<<<
- * 
- * 	def __dealloc__(self):
- */
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__seed); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 124; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PySequence_Tuple(((PyObject *)__pyx_v_args)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 124; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __pyx_t_4 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 124; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-
-  __pyx_r = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.__init__");
-  __pyx_r = -1;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_args);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":126
- * 		self.seed(*args)
- * 
- * 	def __dealloc__(self):             # <<<<<<<<<<<<<<
- * 		if self.mt != NULL:
- * 			free_mt_struct(self.mt)
- */
-
-static void __pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_1__dealloc__(PyObject *__pyx_v_self); /*proto*/
-static void __pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_1__dealloc__(PyObject *__pyx_v_self) {
-  int __pyx_t_1;
-  __Pyx_RefNannySetupContext("__dealloc__");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":127
- * 
- * 	def __dealloc__(self):
- * 		if self.mt != NULL:             # <<<<<<<<<<<<<<
- * 			free_mt_struct(self.mt)
- * 			self.mt = NULL
- */
-  __pyx_t_1 = (((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt != NULL);
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":128
- * 	def __dealloc__(self):
- * 		if self.mt != NULL:
- * 			free_mt_struct(self.mt)             # <<<<<<<<<<<<<<
- * 			self.mt = NULL
- * 
- */
-    free_mt_struct(((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt);
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":129
- * 		if self.mt != NULL:
- * 			free_mt_struct(self.mt)
- * 			self.mt = NULL             # <<<<<<<<<<<<<<
- * 
- * 	def __getstate__(self):
- */
-    ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt = NULL;
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  __Pyx_RefNannyFinishContext();
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":131
- * 			self.mt = NULL
- * 
- * 	def __getstate__(self):             # <<<<<<<<<<<<<<
- * 		return self.get_state()
- * 
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_2__getstate__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_2__getstate__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  __Pyx_RefNannySetupContext("__getstate__");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":132
- * 
- * 	def __getstate__(self):
- * 		return self.get_state()             # <<<<<<<<<<<<<<
- * 
- * 	def __setstate__(self, state):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__get_state); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 132; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_r = __pyx_t_2;
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.__getstate__");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":134
- * 		return self.get_state()
- * 
- * 	def __setstate__(self, state):             # <<<<<<<<<<<<<<
- * 		self.set_state(state)
- * 
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_3__setstate__(PyObject *__pyx_v_self, PyObject *__pyx_v_state); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_3__setstate__(PyObject *__pyx_v_self, PyObject *__pyx_v_state) {
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  __Pyx_RefNannySetupContext("__setstate__");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":135
- * 
- * 	def __setstate__(self, state):
- * 		self.set_state(state)             # <<<<<<<<<<<<<<
- * 
- * 	def __reduce__(self):
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__set_state); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(__pyx_v_state);
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_state);
-  __Pyx_GIVEREF(__pyx_v_state);
-  __pyx_t_3 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 135; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.__setstate__");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":137
- * 		self.set_state(state)
- * 
- * 	def __reduce__(self):             # <<<<<<<<<<<<<<
- * 		return self.__class__, (), self.get_state()
- * 
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_4__reduce__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_4__reduce__(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  __Pyx_RefNannySetupContext("__reduce__");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":138
- * 
- * 	def __reduce__(self):
- * 		return self.__class__, (), self.get_state()             # <<<<<<<<<<<<<<
- * 
- * 	def seed(self, seed=None):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s____class__); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__get_state); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_3 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __pyx_t_2 = PyTuple_New(3); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 138; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __Pyx_INCREF(((PyObject *)__pyx_empty_tuple));
-  PyTuple_SET_ITEM(__pyx_t_2, 1, ((PyObject *)__pyx_empty_tuple));
-  __Pyx_GIVEREF(((PyObject *)__pyx_empty_tuple));
-  PyTuple_SET_ITEM(__pyx_t_2, 2, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_1 = 0;
-  __pyx_t_3 = 0;
-  __pyx_r = ((PyObject *)__pyx_t_2);
-  __pyx_t_2 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.__reduce__");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":140
- * 		return self.__class__, (), self.get_state()
- * 
- * 	def seed(self, seed=None):             # <<<<<<<<<<<<<<
- * 		cdef uint32_t s = get_seed(seed)
- * 		sgenrand(s, self.mt)
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_5seed(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_5seed(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_seed = 0;
-  uint32_t __pyx_v_s;
-  PyObject *__pyx_r = NULL;
-  uint32_t __pyx_t_1;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_n_s__seed,0};
-  __Pyx_RefNannySetupContext("seed");
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[1] = {0};
-    values[0] = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__seed);
-        if (value) { values[0] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "seed") < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 140; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_seed = values[0];
-  } else {
-    __pyx_v_seed = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  1: __pyx_v_seed = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("seed", 0, 0, 1, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 140; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.seed");
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":141
- * 
- * 	def seed(self, seed=None):
- * 		cdef uint32_t s = get_seed(seed)             # <<<<<<<<<<<<<<
- * 		sgenrand(s, self.mt)
- * 
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_get_seed(__pyx_v_seed); if (unlikely(__pyx_t_1 == -1 && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 141; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_v_s = __pyx_t_1;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":142
- * 	def seed(self, seed=None):
- * 		cdef uint32_t s = get_seed(seed)
- * 		sgenrand(s, self.mt)             # <<<<<<<<<<<<<<
- * 
- * 	def get_state(self):
- */
-  sgenrand(__pyx_v_s, ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt);
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.seed");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":144
- * 		sgenrand(s, self.mt)
- * 
- * 	def get_state(self):             # <<<<<<<<<<<<<<
- * 		cdef ndarray state "arrayObject_state"
- * 		cdef mt_struct *mt = <mt_struct *>self.mt
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_6get_state(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_6get_state(PyObject *__pyx_v_self, CYTHON_UNUSED PyObject *unused) {
-  PyArrayObject *arrayObject_state;
-  mt_struct *__pyx_v_mt;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  __Pyx_RefNannySetupContext("get_state");
-  arrayObject_state = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":146
- * 	def get_state(self):
- * 		cdef ndarray state "arrayObject_state"
- * 		cdef mt_struct *mt = <mt_struct *>self.mt             # <<<<<<<<<<<<<<
- * 		state = <ndarray>numpy.empty(mt.nn, numpy.uint32)
- * 		memcpy(<void*>(state.data), <void*>(mt.state), mt.nn * sizeof(uint32_t))
- */
-  __pyx_v_mt = ((mt_struct *)((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":147
- * 		cdef ndarray state "arrayObject_state"
- * 		cdef mt_struct *mt = <mt_struct *>self.mt
- * 		state = <ndarray>numpy.empty(mt.nn, numpy.uint32)             # <<<<<<<<<<<<<<
- * 		memcpy(<void*>(state.data), <void*>(mt.state), mt.nn * sizeof(uint32_t))
- * 		return (1, get_mt_struct_fields(mt), state)
- */
-  __pyx_t_1 = __Pyx_GetName(__pyx_m, __pyx_n_s__numpy); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_1, __pyx_n_s__empty); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_mt->nn); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = __Pyx_GetName(__pyx_m, __pyx_n_s__numpy); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_4 = PyObject_GetAttr(__pyx_t_3, __pyx_n_s__uint32); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __pyx_t_3 = PyTuple_New(2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  __pyx_t_1 = 0;
-  __pyx_t_4 = 0;
-  __pyx_t_4 = PyObject_Call(__pyx_t_2, ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 147; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_t_4)));
-  __Pyx_DECREF(((PyObject *)arrayObject_state));
-  arrayObject_state = ((PyArrayObject *)__pyx_t_4);
-  __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":148
- * 		cdef mt_struct *mt = <mt_struct *>self.mt
- * 		state = <ndarray>numpy.empty(mt.nn, numpy.uint32)
- * 		memcpy(<void*>(state.data), <void*>(mt.state), mt.nn * sizeof(uint32_t))             # <<<<<<<<<<<<<<
- * 		return (1, get_mt_struct_fields(mt), state)
- * 
- */
-  memcpy(((void *)arrayObject_state->data), ((void *)__pyx_v_mt->state), (__pyx_v_mt->nn * (sizeof(uint32_t))));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":149
- * 		state = <ndarray>numpy.empty(mt.nn, numpy.uint32)
- * 		memcpy(<void*>(state.data), <void*>(mt.state), mt.nn * sizeof(uint32_t))
- * 		return (1, get_mt_struct_fields(mt), state)             # <<<<<<<<<<<<<<
- * 
- * 	def set_state(self, state):
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_4 = __pyx_f_4dcmt_11numpyrandom_get_mt_struct_fields(__pyx_v_mt); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 149; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_4);
-  __pyx_t_3 = PyTuple_New(3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 149; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-  __Pyx_INCREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_int_1);
-  __Pyx_GIVEREF(__pyx_int_1);
-  PyTuple_SET_ITEM(__pyx_t_3, 1, __pyx_t_4);
-  __Pyx_GIVEREF(__pyx_t_4);
-  __Pyx_INCREF(((PyObject *)arrayObject_state));
-  PyTuple_SET_ITEM(__pyx_t_3, 2, ((PyObject *)arrayObject_state));
-  __Pyx_GIVEREF(((PyObject *)arrayObject_state));
-  __pyx_t_4 = 0;
-  __pyx_r = ((PyObject *)__pyx_t_3);
-  __pyx_t_3 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.get_state");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF((PyObject *)arrayObject_state);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":151
- * 		return (1, get_mt_struct_fields(mt), state)
- * 
- * 	def set_state(self, state):             # <<<<<<<<<<<<<<
- * 		version, fields, state_vec = state
- * 		assert version == 1, "State version " + str(version) + " is not supported"
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_7set_state(PyObject *__pyx_v_self, PyObject *__pyx_v_state); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_7set_state(PyObject *__pyx_v_self, PyObject *__pyx_v_state) {
-  PyObject *__pyx_v_version;
-  PyObject *__pyx_v_fields;
-  PyObject *__pyx_v_state_vec;
-  mt_struct *__pyx_v_mt;
-  PyArrayObject *arrayObject_obj;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  int __pyx_t_5;
-  __Pyx_RefNannySetupContext("set_state");
-  __pyx_v_version = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_fields = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_state_vec = Py_None; __Pyx_INCREF(Py_None);
-  arrayObject_obj = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":152
- * 
- * 	def set_state(self, state):
- * 		version, fields, state_vec = state             # <<<<<<<<<<<<<<
- * 		assert version == 1, "State version " + str(version) + " is not supported"
- * 
- */
-  if (PyTuple_CheckExact(__pyx_v_state) && likely(PyTuple_GET_SIZE(__pyx_v_state) == 3)) {
-    PyObject* tuple = __pyx_v_state;
-    __pyx_t_1 = PyTuple_GET_ITEM(tuple, 0); __Pyx_INCREF(__pyx_t_1);
-    __pyx_t_2 = PyTuple_GET_ITEM(tuple, 1); __Pyx_INCREF(__pyx_t_2);
-    __pyx_t_3 = PyTuple_GET_ITEM(tuple, 2); __Pyx_INCREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_v_version);
-    __pyx_v_version = __pyx_t_1;
-    __pyx_t_1 = 0;
-    __Pyx_DECREF(__pyx_v_fields);
-    __pyx_v_fields = __pyx_t_2;
-    __pyx_t_2 = 0;
-    __Pyx_DECREF(__pyx_v_state_vec);
-    __pyx_v_state_vec = __pyx_t_3;
-    __pyx_t_3 = 0;
-  } else {
-    __pyx_t_4 = PyObject_GetIter(__pyx_v_state); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 152; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_1 = __Pyx_UnpackItem(__pyx_t_4, 0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 152; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __pyx_t_2 = __Pyx_UnpackItem(__pyx_t_4, 1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 152; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = __Pyx_UnpackItem(__pyx_t_4, 2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 152; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    if (__Pyx_EndUnpack(__pyx_t_4, 3) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 152; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __Pyx_DECREF(__pyx_v_version);
-    __pyx_v_version = __pyx_t_1;
-    __pyx_t_1 = 0;
-    __Pyx_DECREF(__pyx_v_fields);
-    __pyx_v_fields = __pyx_t_2;
-    __pyx_t_2 = 0;
-    __Pyx_DECREF(__pyx_v_state_vec);
-    __pyx_v_state_vec = __pyx_t_3;
-    __pyx_t_3 = 0;
-  }
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":153
- * 	def set_state(self, state):
- * 		version, fields, state_vec = state
- * 		assert version == 1, "State version " + str(version) + " is not supported"             # <<<<<<<<<<<<<<
- * 
- * 		cdef mt_struct *mt = <mt_struct *>malloc(sizeof(mt_struct))
- */
-  #ifndef CYTHON_WITHOUT_ASSERTIONS
-  __pyx_t_3 = PyObject_RichCompare(__pyx_v_version, __pyx_int_1, Py_EQ); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __pyx_t_5 = __Pyx_PyObject_IsTrue(__pyx_t_3); if (unlikely(__pyx_t_5 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  if (unlikely(!__pyx_t_5)) {
-    __pyx_t_3 = PyTuple_New(1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    __Pyx_INCREF(__pyx_v_version);
-    PyTuple_SET_ITEM(__pyx_t_3, 0, __pyx_v_version);
-    __Pyx_GIVEREF(__pyx_v_version);
-    __pyx_t_2 = PyObject_Call(((PyObject *)((PyObject*)(&PyString_Type))), ((PyObject *)__pyx_t_3), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __pyx_t_3 = PyNumber_Add(((PyObject *)__pyx_kp_s_19), __pyx_t_2); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __pyx_t_2 = PyNumber_Add(__pyx_t_3, ((PyObject *)__pyx_kp_s_20)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    PyErr_SetObject(PyExc_AssertionError, __pyx_t_2);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 153; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  #endif
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":155
- * 		assert version == 1, "State version " + str(version) + " is not supported"
- * 
- * 		cdef mt_struct *mt = <mt_struct *>malloc(sizeof(mt_struct))             # <<<<<<<<<<<<<<
- * 		cdef ndarray obj "arrayObject_obj"
- * 
- */
-  __pyx_v_mt = ((mt_struct *)malloc((sizeof(mt_struct))));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":158
- * 		cdef ndarray obj "arrayObject_obj"
- * 
- * 		set_mt_struct_fields(mt, fields)             # <<<<<<<<<<<<<<
- * 
- * 		mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)
- */
-  __pyx_t_2 = __pyx_f_4dcmt_11numpyrandom_set_mt_struct_fields(__pyx_v_mt, __pyx_v_fields); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 158; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":160
- * 		set_mt_struct_fields(mt, fields)
- * 
- * 		mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)             # <<<<<<<<<<<<<<
- * 
- * 		obj = <ndarray>PyArray_ContiguousFromObject(state_vec, NPY_UINT, 1, 1)
- */
-  __pyx_v_mt->state = ((uint32_t *)malloc(((sizeof(uint32_t)) * __pyx_v_mt->nn)));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":162
- * 		mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)
- * 
- * 		obj = <ndarray>PyArray_ContiguousFromObject(state_vec, NPY_UINT, 1, 1)             # <<<<<<<<<<<<<<
- * 		if obj.dimensions[0] != mt.nn:
- * 			raise ValueError("wrong state vector size")
- */
-  __pyx_t_2 = PyArray_ContiguousFromObject(__pyx_v_state_vec, NPY_UINT, 1, 1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 162; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_t_2)));
-  __Pyx_DECREF(((PyObject *)arrayObject_obj));
-  arrayObject_obj = ((PyArrayObject *)__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":163
- * 
- * 		obj = <ndarray>PyArray_ContiguousFromObject(state_vec, NPY_UINT, 1, 1)
- * 		if obj.dimensions[0] != mt.nn:             # <<<<<<<<<<<<<<
- * 			raise ValueError("wrong state vector size")
- * 		memcpy(<void*>(mt.state), <void*>(obj.data), mt.nn * sizeof(uint32_t))
- */
-  __pyx_t_5 = ((arrayObject_obj->dimensions[0]) != __pyx_v_mt->nn);
-  if (__pyx_t_5) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":164
- * 		obj = <ndarray>PyArray_ContiguousFromObject(state_vec, NPY_UINT, 1, 1)
- * 		if obj.dimensions[0] != mt.nn:
- * 			raise ValueError("wrong state vector size")             # <<<<<<<<<<<<<<
- * 		memcpy(<void*>(mt.state), <void*>(obj.data), mt.nn * sizeof(uint32_t))
- * 		self.mt = mt
- */
-    __pyx_t_2 = PyObject_Call(__pyx_builtin_ValueError, ((PyObject *)__pyx_k_tuple_22), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":165
- * 		if obj.dimensions[0] != mt.nn:
- * 			raise ValueError("wrong state vector size")
- * 		memcpy(<void*>(mt.state), <void*>(obj.data), mt.nn * sizeof(uint32_t))             # <<<<<<<<<<<<<<
- * 		self.mt = mt
- * 
- */
-  memcpy(((void *)__pyx_v_mt->state), ((void *)arrayObject_obj->data), (__pyx_v_mt->nn * (sizeof(uint32_t))));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":166
- * 			raise ValueError("wrong state vector size")
- * 		memcpy(<void*>(mt.state), <void*>(obj.data), mt.nn * sizeof(uint32_t))
- * 		self.mt = mt             # <<<<<<<<<<<<<<
- * 
- * 	def rand(self, *size):
- */
-  ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt = __pyx_v_mt;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.set_state");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_version);
-  __Pyx_DECREF(__pyx_v_fields);
-  __Pyx_DECREF(__pyx_v_state_vec);
-  __Pyx_DECREF((PyObject *)arrayObject_obj);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":168
- * 		self.mt = mt
- * 
- * 	def rand(self, *size):             # <<<<<<<<<<<<<<
- * 		if len(size) == 0:
- * 			return self.random_sample()
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_8rand(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_8rand(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_size = 0;
-  PyObject *__pyx_r = NULL;
-  Py_ssize_t __pyx_t_1;
-  int __pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  __Pyx_RefNannySetupContext("rand");
-  if (unlikely(__pyx_kwds) && unlikely(PyDict_Size(__pyx_kwds) > 0) && unlikely(!__Pyx_CheckKeywordStrings(__pyx_kwds, "rand", 0))) return NULL;
-  __Pyx_INCREF(__pyx_args);
-  __pyx_v_size = __pyx_args;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":169
- * 
- * 	def rand(self, *size):
- * 		if len(size) == 0:             # <<<<<<<<<<<<<<
- * 			return self.random_sample()
- * 		else:
- */
-  if (unlikely(__pyx_v_size == Py_None)) {
-    PyErr_SetString(PyExc_TypeError, "object of type 'NoneType' has no len()"); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 169; __pyx_clineno = __LINE__; goto __pyx_L1_error;} 
-  }
-  __pyx_t_1 = PyTuple_GET_SIZE(((PyObject *)__pyx_v_size)); 
-  __pyx_t_2 = (__pyx_t_1 == 0);
-  if (__pyx_t_2) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":170
- * 	def rand(self, *size):
- * 		if len(size) == 0:
- * 			return self.random_sample()             # <<<<<<<<<<<<<<
- * 		else:
- * 			return self.random_sample(size=size)
- */
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_3 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__random_sample); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_4 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 170; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __pyx_r = __pyx_t_4;
-    __pyx_t_4 = 0;
-    goto __pyx_L0;
-    goto __pyx_L5;
-  }
-  /*else*/ {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":172
- * 			return self.random_sample()
- * 		else:
- * 			return self.random_sample(size=size)             # <<<<<<<<<<<<<<
- * 
- * 	def random_sample(self, size=None):
- */
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_4 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__random_sample); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 172; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_3 = PyDict_New(); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 172; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_3));
-    if (PyDict_SetItem(__pyx_t_3, ((PyObject *)__pyx_n_s__size), ((PyObject *)__pyx_v_size)) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 172; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __pyx_t_5 = PyEval_CallObjectWithKeywords(__pyx_t_4, ((PyObject *)__pyx_empty_tuple), ((PyObject *)__pyx_t_3)); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 172; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_5);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __Pyx_DECREF(((PyObject *)__pyx_t_3)); __pyx_t_3 = 0;
-    __pyx_r = __pyx_t_5;
-    __pyx_t_5 = 0;
-    goto __pyx_L0;
-  }
-  __pyx_L5:;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.rand");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_size);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":174
- * 			return self.random_sample(size=size)
- * 
- * 	def random_sample(self, size=None):             # <<<<<<<<<<<<<<
- * 		if size is None:
- * 			return PyFloat_FromDouble(random_float(self.mt))
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_9random_sample(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_9random_sample(PyObject *__pyx_v_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_size = 0;
-  PyObject *__pyx_v_array;
-  PyObject *__pyx_r = NULL;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_n_s__size,0};
-  __Pyx_RefNannySetupContext("random_sample");
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[1] = {0};
-    values[0] = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      if (kw_args > 0) {
-        PyObject* value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__size);
-        if (value) { values[0] = value; kw_args--; }
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "random_sample") < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 174; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_size = values[0];
-  } else {
-    __pyx_v_size = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  1: __pyx_v_size = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("random_sample", 0, 0, 1, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 174; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.random_sample");
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_array = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":175
- * 
- * 	def random_sample(self, size=None):
- * 		if size is None:             # <<<<<<<<<<<<<<
- * 			return PyFloat_FromDouble(random_float(self.mt))
- * 		else:
- */
-  __pyx_t_1 = (__pyx_v_size == Py_None);
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":176
- * 	def random_sample(self, size=None):
- * 		if size is None:
- * 			return PyFloat_FromDouble(random_float(self.mt))             # <<<<<<<<<<<<<<
- * 		else:
- * 			array = numpy.empty(size, numpy.float64)
- */
-    __Pyx_XDECREF(__pyx_r);
-    __pyx_t_2 = PyFloat_FromDouble(random_float(((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 176; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_r = __pyx_t_2;
-    __pyx_t_2 = 0;
-    goto __pyx_L0;
-    goto __pyx_L6;
-  }
-  /*else*/ {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":178
- * 			return PyFloat_FromDouble(random_float(self.mt))
- * 		else:
- * 			array = numpy.empty(size, numpy.float64)             # <<<<<<<<<<<<<<
- * 			self.rand_fill(array)
- * 			return array
- */
-    __pyx_t_2 = __Pyx_GetName(__pyx_m, __pyx_n_s__numpy); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 178; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_3 = PyObject_GetAttr(__pyx_t_2, __pyx_n_s__empty); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 178; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __pyx_t_2 = __Pyx_GetName(__pyx_m, __pyx_n_s__numpy); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 178; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __pyx_t_4 = PyObject_GetAttr(__pyx_t_2, __pyx_n_s__float64); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 178; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    __pyx_t_2 = PyTuple_New(2); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 178; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-    __Pyx_INCREF(__pyx_v_size);
-    PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_size);
-    __Pyx_GIVEREF(__pyx_v_size);
-    PyTuple_SET_ITEM(__pyx_t_2, 1, __pyx_t_4);
-    __Pyx_GIVEREF(__pyx_t_4);
-    __pyx_t_4 = 0;
-    __pyx_t_4 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 178; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-    __Pyx_DECREF(__pyx_v_array);
-    __pyx_v_array = __pyx_t_4;
-    __pyx_t_4 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":179
- * 		else:
- * 			array = numpy.empty(size, numpy.float64)
- * 			self.rand_fill(array)             # <<<<<<<<<<<<<<
- * 			return array
- * 
- */
-    __pyx_t_4 = PyObject_GetAttr(__pyx_v_self, __pyx_n_s__rand_fill); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_2 = PyTuple_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-    __Pyx_INCREF(__pyx_v_array);
-    PyTuple_SET_ITEM(__pyx_t_2, 0, __pyx_v_array);
-    __Pyx_GIVEREF(__pyx_v_array);
-    __pyx_t_3 = PyObject_Call(__pyx_t_4, ((PyObject *)__pyx_t_2), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 179; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":180
- * 			array = numpy.empty(size, numpy.float64)
- * 			self.rand_fill(array)
- * 			return array             # <<<<<<<<<<<<<<
- * 
- * 	def rand_fill(self, arr):
- */
-    __Pyx_XDECREF(__pyx_r);
-    __Pyx_INCREF(__pyx_v_array);
-    __pyx_r = __pyx_v_array;
-    goto __pyx_L0;
-  }
-  __pyx_L6:;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.random_sample");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_array);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":182
- * 			return array
- * 
- * 	def rand_fill(self, arr):             # <<<<<<<<<<<<<<
- * 		cdef double *array_data
- * 		cdef ndarray array "arrayObject"
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_10rand_fill(PyObject *__pyx_v_self, PyObject *__pyx_v_arr); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_10rand_fill(PyObject *__pyx_v_self, PyObject *__pyx_v_arr) {
-  double *__pyx_v_array_data;
-  PyArrayObject *arrayObject;
-  long __pyx_v_length;
-  long __pyx_v_i;
-  PyObject *__pyx_r = NULL;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  long __pyx_t_3;
-  long __pyx_t_4;
-  __Pyx_RefNannySetupContext("rand_fill");
-  arrayObject = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":188
- * 		cdef long i
- * 
- * 		if not PyArray_Check(arr):             # <<<<<<<<<<<<<<
- * 			raise TypeError("function requires numpy array")
- * 
- */
-  __pyx_t_1 = (!PyArray_Check(__pyx_v_arr));
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":189
- * 
- * 		if not PyArray_Check(arr):
- * 			raise TypeError("function requires numpy array")             # <<<<<<<<<<<<<<
- * 
- * 		array = <ndarray>arr
- */
-    __pyx_t_2 = PyObject_Call(__pyx_builtin_TypeError, ((PyObject *)__pyx_k_tuple_24), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":191
- * 			raise TypeError("function requires numpy array")
- * 
- * 		array = <ndarray>arr             # <<<<<<<<<<<<<<
- * 		if array.descr.type_num != NPY_DOUBLE:
- * 			raise TypeError("function requires numpy array of type float64")
- */
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_v_arr)));
-  __Pyx_DECREF(((PyObject *)arrayObject));
-  arrayObject = ((PyArrayObject *)__pyx_v_arr);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":192
- * 
- * 		array = <ndarray>arr
- * 		if array.descr.type_num != NPY_DOUBLE:             # <<<<<<<<<<<<<<
- * 			raise TypeError("function requires numpy array of type float64")
- * 
- */
-  __pyx_t_1 = (arrayObject->descr->type_num != NPY_DOUBLE);
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":193
- * 		array = <ndarray>arr
- * 		if array.descr.type_num != NPY_DOUBLE:
- * 			raise TypeError("function requires numpy array of type float64")             # <<<<<<<<<<<<<<
- * 
- * 		length = PyArray_SIZE(array)
- */
-    __pyx_t_2 = PyObject_Call(__pyx_builtin_TypeError, ((PyObject *)__pyx_k_tuple_26), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 193; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 193; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":195
- * 			raise TypeError("function requires numpy array of type float64")
- * 
- * 		length = PyArray_SIZE(array)             # <<<<<<<<<<<<<<
- * 		array_data = <double *>array.data
- * 		for i in range(length):
- */
-  __pyx_v_length = PyArray_SIZE(arrayObject);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":196
- * 
- * 		length = PyArray_SIZE(array)
- * 		array_data = <double *>array.data             # <<<<<<<<<<<<<<
- * 		for i in range(length):
- * 			array_data[i] = random_float(self.mt)
- */
-  __pyx_v_array_data = ((double *)arrayObject->data);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":197
- * 		length = PyArray_SIZE(array)
- * 		array_data = <double *>array.data
- * 		for i in range(length):             # <<<<<<<<<<<<<<
- * 			array_data[i] = random_float(self.mt)
- * 
- */
-  __pyx_t_3 = __pyx_v_length;
-  for (__pyx_t_4 = 0; __pyx_t_4 < __pyx_t_3; __pyx_t_4+=1) {
-    __pyx_v_i = __pyx_t_4;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":198
- * 		array_data = <double *>array.data
- * 		for i in range(length):
- * 			array_data[i] = random_float(self.mt)             # <<<<<<<<<<<<<<
- * 
- * 	def randraw_fill(self, arr):
- */
-    (__pyx_v_array_data[__pyx_v_i]) = random_float(((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt);
-  }
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.rand_fill");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF((PyObject *)arrayObject);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":200
- * 			array_data[i] = random_float(self.mt)
- * 
- * 	def randraw_fill(self, arr):             # <<<<<<<<<<<<<<
- * 		cdef uint32_t *array_data
- * 		cdef ndarray array "arrayObject"
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_11randraw_fill(PyObject *__pyx_v_self, PyObject *__pyx_v_arr); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_11randraw_fill(PyObject *__pyx_v_self, PyObject *__pyx_v_arr) {
-  uint32_t *__pyx_v_array_data;
-  PyArrayObject *arrayObject;
-  long __pyx_v_length;
-  long __pyx_v_i;
-  PyObject *__pyx_r = NULL;
-  int __pyx_t_1;
-  PyObject *__pyx_t_2 = NULL;
-  long __pyx_t_3;
-  long __pyx_t_4;
-  __Pyx_RefNannySetupContext("randraw_fill");
-  arrayObject = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":206
- * 		cdef long i
- * 
- * 		if not PyArray_Check(arr):             # <<<<<<<<<<<<<<
- * 			raise TypeError("function requires numpy array")
- * 
- */
-  __pyx_t_1 = (!PyArray_Check(__pyx_v_arr));
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":207
- * 
- * 		if not PyArray_Check(arr):
- * 			raise TypeError("function requires numpy array")             # <<<<<<<<<<<<<<
- * 
- * 		array = <ndarray>arr
- */
-    __pyx_t_2 = PyObject_Call(__pyx_builtin_TypeError, ((PyObject *)__pyx_k_tuple_27), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 207; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 207; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L5;
-  }
-  __pyx_L5:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":209
- * 			raise TypeError("function requires numpy array")
- * 
- * 		array = <ndarray>arr             # <<<<<<<<<<<<<<
- * 		if array.descr.elsize != 4:
- * 			raise TypeError("function requires numpy array with 4-byte elements")
- */
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_v_arr)));
-  __Pyx_DECREF(((PyObject *)arrayObject));
-  arrayObject = ((PyArrayObject *)__pyx_v_arr);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":210
- * 
- * 		array = <ndarray>arr
- * 		if array.descr.elsize != 4:             # <<<<<<<<<<<<<<
- * 			raise TypeError("function requires numpy array with 4-byte elements")
- * 
- */
-  __pyx_t_1 = (arrayObject->descr->elsize != 4);
-  if (__pyx_t_1) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":211
- * 		array = <ndarray>arr
- * 		if array.descr.elsize != 4:
- * 			raise TypeError("function requires numpy array with 4-byte elements")             # <<<<<<<<<<<<<<
- * 
- * 		length = PyArray_SIZE(array)
- */
-    __pyx_t_2 = PyObject_Call(__pyx_builtin_TypeError, ((PyObject *)__pyx_k_tuple_29), NULL); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 211; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_2);
-    __Pyx_Raise(__pyx_t_2, 0, 0);
-    __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-    {__pyx_filename = __pyx_f[1]; __pyx_lineno = 211; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":213
- * 			raise TypeError("function requires numpy array with 4-byte elements")
- * 
- * 		length = PyArray_SIZE(array)             # <<<<<<<<<<<<<<
- * 		array_data = <uint32_t *>array.data
- * 		for i in range(length):
- */
-  __pyx_v_length = PyArray_SIZE(arrayObject);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":214
- * 
- * 		length = PyArray_SIZE(array)
- * 		array_data = <uint32_t *>array.data             # <<<<<<<<<<<<<<
- * 		for i in range(length):
- * 			array_data[i] = random_uint32(self.mt)
- */
-  __pyx_v_array_data = ((uint32_t *)arrayObject->data);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":215
- * 		length = PyArray_SIZE(array)
- * 		array_data = <uint32_t *>array.data
- * 		for i in range(length):             # <<<<<<<<<<<<<<
- * 			array_data[i] = random_uint32(self.mt)
- * 
- */
-  __pyx_t_3 = __pyx_v_length;
-  for (__pyx_t_4 = 0; __pyx_t_4 < __pyx_t_3; __pyx_t_4+=1) {
-    __pyx_v_i = __pyx_t_4;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":216
- * 		array_data = <uint32_t *>array.data
- * 		for i in range(length):
- * 			array_data[i] = random_uint32(self.mt)             # <<<<<<<<<<<<<<
- * 
- * 	@classmethod
- */
-    (__pyx_v_array_data[__pyx_v_i]) = random_uint32(((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_v_self)->mt);
-  }
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_2);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.randraw_fill");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF((PyObject *)arrayObject);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":219
- * 
- * 	@classmethod
- * 	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None):             # <<<<<<<<<<<<<<
- * 		cdef int i, count
- * 		cdef mt_struct **mts = NULL
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_12range(PyObject *__pyx_v_cls, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_12range(PyObject *__pyx_v_cls, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_wordlen = 0;
-  PyObject *__pyx_v_exponent = 0;
-  PyObject *__pyx_v_gen_seed = 0;
-  PyObject *__pyx_v_args = 0;
-  int __pyx_v_i;
-  int __pyx_v_count;
-  mt_struct **__pyx_v_mts;
-  PyObject *__pyx_v_res;
-  struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *__pyx_v_rng;
-  PyObject *__pyx_v_rngs;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  int __pyx_t_2;
-  int __pyx_t_3;
-  int __pyx_t_4;
-  PyObject *__pyx_t_5 = NULL;
-  int __pyx_t_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_n_s__wordlen,&__pyx_n_s__exponent,&__pyx_n_s__gen_seed,0};
-  __Pyx_RefNannySetupContext("range");
-  if (PyTuple_GET_SIZE(__pyx_args) > 0) {
-    __pyx_v_args = PyTuple_GetSlice(__pyx_args, 0, PyTuple_GET_SIZE(__pyx_args)); __Pyx_GOTREF(__pyx_v_args);
-    if (unlikely(!__pyx_v_args)) return NULL;
-  } else {
-    __pyx_v_args = __pyx_empty_tuple; __Pyx_INCREF(__pyx_empty_tuple);
-  }
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    values[0] = ((PyObject *)__pyx_int_32);
-    values[1] = ((PyObject *)__pyx_int_521);
-    values[2] = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      default:
-      case  0: break;
-    }
-    while (kw_args > 0) {
-      PyObject* value;
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__wordlen);
-      if (value) { values[0] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__exponent);
-      if (value) { values[1] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__gen_seed);
-      if (value) { values[2] = value; if (!(--kw_args)) break; }
-      break;
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, 0, "range") < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 219; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_wordlen = values[0];
-    __pyx_v_exponent = values[1];
-    __pyx_v_gen_seed = values[2];
-  } else if (PyTuple_GET_SIZE(__pyx_args) < 0) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_wordlen = ((PyObject *)__pyx_int_32);
-    __pyx_v_exponent = ((PyObject *)__pyx_int_521);
-    __pyx_v_gen_seed = ((PyObject *)Py_None);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("range", 0, 0, 0, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 219; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_DECREF(__pyx_v_args);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.range");
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_res = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_rng = ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_rngs = ((PyObject*)Py_None); __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":221
- * 	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None):
- * 		cdef int i, count
- * 		cdef mt_struct **mts = NULL             # <<<<<<<<<<<<<<
- * 
- * 		res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
- */
-  __pyx_v_mts = NULL;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":223
- * 		cdef mt_struct **mts = NULL
- * 
- * 		res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)             # <<<<<<<<<<<<<<
- * 		if res != None:
- * 			return res
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_create_mt_range(((PyObject *)__pyx_v_args), __pyx_v_wordlen, __pyx_v_exponent, __pyx_v_gen_seed, (&__pyx_v_mts), (&__pyx_v_count)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 223; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_v_res);
-  __pyx_v_res = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":224
- * 
- * 		res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
- * 		if res != None:             # <<<<<<<<<<<<<<
- * 			return res
- * 
- */
-  __pyx_t_1 = PyObject_RichCompare(__pyx_v_res, Py_None, Py_NE); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 224; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyObject_IsTrue(__pyx_t_1); if (unlikely(__pyx_t_2 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 224; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  if (__pyx_t_2) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":225
- * 		res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
- * 		if res != None:
- * 			return res             # <<<<<<<<<<<<<<
- * 
- * 		cdef DcmtRandomState rng
- */
-    __Pyx_XDECREF(__pyx_r);
-    __Pyx_INCREF(__pyx_v_res);
-    __pyx_r = __pyx_v_res;
-    goto __pyx_L0;
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":228
- * 
- * 		cdef DcmtRandomState rng
- * 		rngs = []             # <<<<<<<<<<<<<<
- * 		for i in range(count):
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- */
-  __pyx_t_1 = PyList_New(0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 228; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_DECREF(((PyObject *)__pyx_v_rngs));
-  __pyx_v_rngs = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":229
- * 		cdef DcmtRandomState rng
- * 		rngs = []
- * 		for i in range(count):             # <<<<<<<<<<<<<<
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- * 			rng.mt = mts[i]
- */
-  __pyx_t_3 = __pyx_v_count;
-  for (__pyx_t_4 = 0; __pyx_t_4 < __pyx_t_3; __pyx_t_4+=1) {
-    __pyx_v_i = __pyx_t_4;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":230
- * 		rngs = []
- * 		for i in range(count):
- * 			rng = <DcmtRandomState>cls.__new__(cls)             # <<<<<<<<<<<<<<
- * 			rng.mt = mts[i]
- * 			rng.seed()
- */
-    if (unlikely(__pyx_v_cls == Py_None)) {
-      PyErr_SetString(PyExc_TypeError, "object.__new__(X): X is not a type object (NoneType)"); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 230; __pyx_clineno = __LINE__; goto __pyx_L1_error;} 
-    }
-    __pyx_t_1 = __Pyx_tp_new(((PyObject*)__pyx_v_cls)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 230; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __Pyx_INCREF(((PyObject *)((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_t_1)));
-    __Pyx_DECREF(((PyObject *)__pyx_v_rng));
-    __pyx_v_rng = ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_t_1);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":231
- * 		for i in range(count):
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- * 			rng.mt = mts[i]             # <<<<<<<<<<<<<<
- * 			rng.seed()
- * 
- */
-    __pyx_v_rng->mt = (__pyx_v_mts[__pyx_v_i]);
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":232
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- * 			rng.mt = mts[i]
- * 			rng.seed()             # <<<<<<<<<<<<<<
- * 
- * 			rngs.append(rng)
- */
-    __pyx_t_1 = PyObject_GetAttr(((PyObject *)__pyx_v_rng), __pyx_n_s__seed); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-    __pyx_t_5 = PyObject_Call(__pyx_t_1, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 232; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_5);
-    __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-    __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":234
- * 			rng.seed()
- * 
- * 			rngs.append(rng)             # <<<<<<<<<<<<<<
- * 
- * 		# We do not need array of pointers anymore, but we are keeping pointers to mt_struct's
- */
-    if (unlikely(__pyx_v_rngs == Py_None)) {
-      PyErr_SetString(PyExc_AttributeError, "'NoneType' object has no attribute 'append'"); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 234; __pyx_clineno = __LINE__; goto __pyx_L1_error;} 
-    }
-    __pyx_t_6 = PyList_Append(__pyx_v_rngs, ((PyObject *)__pyx_v_rng)); if (unlikely(__pyx_t_6 == -1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 234; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":238
- * 		# We do not need array of pointers anymore, but we are keeping pointers to mt_struct's
- * 		# So we are not using free_mt_struct_array()
- * 		free(mts)             # <<<<<<<<<<<<<<
- * 
- * 		return rngs
- */
-  free(__pyx_v_mts);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":240
- * 		free(mts)
- * 
- * 		return rngs             # <<<<<<<<<<<<<<
- * 
- * 	@classmethod
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(((PyObject *)__pyx_v_rngs));
-  __pyx_r = ((PyObject *)__pyx_v_rngs);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.range");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_args);
-  __Pyx_DECREF(__pyx_v_res);
-  __Pyx_DECREF((PyObject *)__pyx_v_rng);
-  __Pyx_DECREF(__pyx_v_rngs);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":243
- * 
- * 	@classmethod
- * 	def from_mt_range(cls, mt_common, mt_unique):             # <<<<<<<<<<<<<<
- * 
- * 		cdef mt_struct *mt
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_13from_mt_range(PyObject *__pyx_v_cls, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_13from_mt_range(PyObject *__pyx_v_cls, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_mt_common = 0;
-  PyObject *__pyx_v_mt_unique = 0;
-  mt_struct *__pyx_v_mt;
-  struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *__pyx_v_rng;
-  PyArrayObject *arrayObject_unique;
-  uint32_t *__pyx_v_data;
-  PyObject *__pyx_v_rngs;
-  PyObject *__pyx_v_i;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  Py_ssize_t __pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  Py_ssize_t __pyx_t_5;
-  int __pyx_t_6;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_n_s__mt_common,&__pyx_n_s__mt_unique,0};
-  __Pyx_RefNannySetupContext("from_mt_range");
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[2] = {0,0};
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  2: values[1] = PyTuple_GET_ITEM(__pyx_args, 1);
-      case  1: values[0] = PyTuple_GET_ITEM(__pyx_args, 0);
-      case  0: break;
-      default: goto __pyx_L5_argtuple_error;
-    }
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      case  0:
-      values[0] = PyDict_GetItem(__pyx_kwds, __pyx_n_s__mt_common);
-      if (likely(values[0])) kw_args--;
-      else goto __pyx_L5_argtuple_error;
-      case  1:
-      values[1] = PyDict_GetItem(__pyx_kwds, __pyx_n_s__mt_unique);
-      if (likely(values[1])) kw_args--;
-      else {
-        __Pyx_RaiseArgtupleInvalid("from_mt_range", 1, 2, 2, 1); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-      }
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, PyTuple_GET_SIZE(__pyx_args), "from_mt_range") < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_mt_common = values[0];
-    __pyx_v_mt_unique = values[1];
-  } else if (PyTuple_GET_SIZE(__pyx_args) != 2) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_mt_common = PyTuple_GET_ITEM(__pyx_args, 0);
-    __pyx_v_mt_unique = PyTuple_GET_ITEM(__pyx_args, 1);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("from_mt_range", 1, 2, 2, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.from_mt_range");
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_rng = ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)Py_None); __Pyx_INCREF(Py_None);
-  arrayObject_unique = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_rngs = ((PyObject*)Py_None); __Pyx_INCREF(Py_None);
-  __pyx_v_i = Py_None; __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":248
- * 		cdef DcmtRandomState rng
- * 		cdef ndarray unique_fields "arrayObject_unique"
- * 		unique_fields = <ndarray>mt_unique             # <<<<<<<<<<<<<<
- * 		cdef uint32_t *data = <uint32_t *>unique_fields.data
- * 
- */
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_v_mt_unique)));
-  __Pyx_DECREF(((PyObject *)arrayObject_unique));
-  arrayObject_unique = ((PyArrayObject *)__pyx_v_mt_unique);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":249
- * 		cdef ndarray unique_fields "arrayObject_unique"
- * 		unique_fields = <ndarray>mt_unique
- * 		cdef uint32_t *data = <uint32_t *>unique_fields.data             # <<<<<<<<<<<<<<
- * 
- * 		rngs = []
- */
-  __pyx_v_data = ((uint32_t *)arrayObject_unique->data);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":251
- * 		cdef uint32_t *data = <uint32_t *>unique_fields.data
- * 
- * 		rngs = []             # <<<<<<<<<<<<<<
- * 		for i in xrange(mt_unique.shape[0]):
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- */
-  __pyx_t_1 = PyList_New(0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 251; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_DECREF(((PyObject *)__pyx_v_rngs));
-  __pyx_v_rngs = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":252
- * 
- * 		rngs = []
- * 		for i in xrange(mt_unique.shape[0]):             # <<<<<<<<<<<<<<
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- * 
- */
-  __pyx_t_1 = PyObject_GetAttr(__pyx_v_mt_unique, __pyx_n_s__shape); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = __Pyx_GetItemInt(__pyx_t_1, 0, sizeof(long), PyInt_FromLong); if (!__pyx_t_3) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, __pyx_t_3);
-  __Pyx_GIVEREF(__pyx_t_3);
-  __pyx_t_3 = 0;
-  __pyx_t_3 = PyObject_Call(__pyx_builtin_xrange, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  if (PyList_CheckExact(__pyx_t_3) || PyTuple_CheckExact(__pyx_t_3)) {
-    __pyx_t_2 = 0; __pyx_t_1 = __pyx_t_3; __Pyx_INCREF(__pyx_t_1);
-  } else {
-    __pyx_t_2 = -1; __pyx_t_1 = PyObject_GetIter(__pyx_t_3); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_1);
-  }
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  for (;;) {
-    if (likely(PyList_CheckExact(__pyx_t_1))) {
-      if (__pyx_t_2 >= PyList_GET_SIZE(__pyx_t_1)) break;
-      __pyx_t_3 = PyList_GET_ITEM(__pyx_t_1, __pyx_t_2); __Pyx_INCREF(__pyx_t_3); __pyx_t_2++;
-    } else if (likely(PyTuple_CheckExact(__pyx_t_1))) {
-      if (__pyx_t_2 >= PyTuple_GET_SIZE(__pyx_t_1)) break;
-      __pyx_t_3 = PyTuple_GET_ITEM(__pyx_t_1, __pyx_t_2); __Pyx_INCREF(__pyx_t_3); __pyx_t_2++;
-    } else {
-      __pyx_t_3 = PyIter_Next(__pyx_t_1);
-      if (!__pyx_t_3) {
-        if (unlikely(PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-        break;
-      }
-      __Pyx_GOTREF(__pyx_t_3);
-    }
-    __Pyx_DECREF(__pyx_v_i);
-    __pyx_v_i = __pyx_t_3;
-    __pyx_t_3 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":253
- * 		rngs = []
- * 		for i in xrange(mt_unique.shape[0]):
- * 			rng = <DcmtRandomState>cls.__new__(cls)             # <<<<<<<<<<<<<<
- * 
- * 			mt = <mt_struct *>malloc(sizeof(mt_struct))
- */
-    if (unlikely(__pyx_v_cls == Py_None)) {
-      PyErr_SetString(PyExc_TypeError, "object.__new__(X): X is not a type object (NoneType)"); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 253; __pyx_clineno = __LINE__; goto __pyx_L1_error;} 
-    }
-    __pyx_t_3 = __Pyx_tp_new(((PyObject*)__pyx_v_cls)); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 253; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_INCREF(((PyObject *)((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_t_3)));
-    __Pyx_DECREF(((PyObject *)__pyx_v_rng));
-    __pyx_v_rng = ((struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState *)__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":255
- * 			rng = <DcmtRandomState>cls.__new__(cls)
- * 
- * 			mt = <mt_struct *>malloc(sizeof(mt_struct))             # <<<<<<<<<<<<<<
- * 
- * 			set_mt_struct_common_fields(mt, mt_common)
- */
-    __pyx_v_mt = ((mt_struct *)malloc((sizeof(mt_struct))));
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":257
- * 			mt = <mt_struct *>malloc(sizeof(mt_struct))
- * 
- * 			set_mt_struct_common_fields(mt, mt_common)             # <<<<<<<<<<<<<<
- * 
- * 			mt.aaa = data[i * 4 + 0]
- */
-    __pyx_t_3 = __pyx_f_4dcmt_11numpyrandom_set_mt_struct_common_fields(__pyx_v_mt, __pyx_v_mt_common); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 257; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":259
- * 			set_mt_struct_common_fields(mt, mt_common)
- * 
- * 			mt.aaa = data[i * 4 + 0]             # <<<<<<<<<<<<<<
- * 			mt.maskB = data[i * 4 + 1]
- * 			mt.maskC = data[i * 4 + 2]
- */
-    __pyx_t_3 = PyNumber_Multiply(__pyx_v_i, __pyx_int_4); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 259; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_4 = PyNumber_Add(__pyx_t_3, __pyx_int_0); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 259; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __pyx_t_5 = __Pyx_PyIndex_AsSsize_t(__pyx_t_4); if (unlikely((__pyx_t_5 == (Py_ssize_t)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 259; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_v_mt->aaa = (__pyx_v_data[__pyx_t_5]);
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":260
- * 
- * 			mt.aaa = data[i * 4 + 0]
- * 			mt.maskB = data[i * 4 + 1]             # <<<<<<<<<<<<<<
- * 			mt.maskC = data[i * 4 + 2]
- * 			mt.i = <int>data[i * 4 + 3]
- */
-    __pyx_t_4 = PyNumber_Multiply(__pyx_v_i, __pyx_int_4); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_3 = PyNumber_Add(__pyx_t_4, __pyx_int_1); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_t_5 = __Pyx_PyIndex_AsSsize_t(__pyx_t_3); if (unlikely((__pyx_t_5 == (Py_ssize_t)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 260; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __pyx_v_mt->maskB = (__pyx_v_data[__pyx_t_5]);
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":261
- * 			mt.aaa = data[i * 4 + 0]
- * 			mt.maskB = data[i * 4 + 1]
- * 			mt.maskC = data[i * 4 + 2]             # <<<<<<<<<<<<<<
- * 			mt.i = <int>data[i * 4 + 3]
- * 
- */
-    __pyx_t_3 = PyNumber_Multiply(__pyx_v_i, __pyx_int_4); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 261; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_4 = PyNumber_Add(__pyx_t_3, __pyx_int_2); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 261; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __pyx_t_5 = __Pyx_PyIndex_AsSsize_t(__pyx_t_4); if (unlikely((__pyx_t_5 == (Py_ssize_t)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 261; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_v_mt->maskC = (__pyx_v_data[__pyx_t_5]);
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":262
- * 			mt.maskB = data[i * 4 + 1]
- * 			mt.maskC = data[i * 4 + 2]
- * 			mt.i = <int>data[i * 4 + 3]             # <<<<<<<<<<<<<<
- * 
- * 			mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)
- */
-    __pyx_t_4 = PyNumber_Multiply(__pyx_v_i, __pyx_int_4); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 262; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __pyx_t_3 = PyNumber_Add(__pyx_t_4, __pyx_int_3); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 262; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-    __pyx_t_5 = __Pyx_PyIndex_AsSsize_t(__pyx_t_3); if (unlikely((__pyx_t_5 == (Py_ssize_t)-1) && PyErr_Occurred())) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 262; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __pyx_v_mt->i = ((int)(__pyx_v_data[__pyx_t_5]));
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":264
- * 			mt.i = <int>data[i * 4 + 3]
- * 
- * 			mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)             # <<<<<<<<<<<<<<
- * 
- * 			rng.mt = mt
- */
-    __pyx_v_mt->state = ((uint32_t *)malloc(((sizeof(uint32_t)) * __pyx_v_mt->nn)));
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":266
- * 			mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)
- * 
- * 			rng.mt = mt             # <<<<<<<<<<<<<<
- * 			rng.seed()
- * 
- */
-    __pyx_v_rng->mt = __pyx_v_mt;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":267
- * 
- * 			rng.mt = mt
- * 			rng.seed()             # <<<<<<<<<<<<<<
- * 
- * 			rngs.append(rng)
- */
-    __pyx_t_3 = PyObject_GetAttr(((PyObject *)__pyx_v_rng), __pyx_n_s__seed); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_3);
-    __pyx_t_4 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_empty_tuple), NULL); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 267; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-    __Pyx_GOTREF(__pyx_t_4);
-    __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-    __Pyx_DECREF(__pyx_t_4); __pyx_t_4 = 0;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":269
- * 			rng.seed()
- * 
- * 			rngs.append(rng)             # <<<<<<<<<<<<<<
- * 
- * 		return rngs
- */
-    if (unlikely(__pyx_v_rngs == Py_None)) {
-      PyErr_SetString(PyExc_AttributeError, "'NoneType' object has no attribute 'append'"); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 269; __pyx_clineno = __LINE__; goto __pyx_L1_error;} 
-    }
-    __pyx_t_6 = PyList_Append(__pyx_v_rngs, ((PyObject *)__pyx_v_rng)); if (unlikely(__pyx_t_6 == -1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 269; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  }
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":271
- * 			rngs.append(rng)
- * 
- * 		return rngs             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __Pyx_XDECREF(__pyx_r);
-  __Pyx_INCREF(((PyObject *)__pyx_v_rngs));
-  __pyx_r = ((PyObject *)__pyx_v_rngs);
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_AddTraceback("dcmt.numpyrandom.DcmtRandomState.from_mt_range");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF((PyObject *)__pyx_v_rng);
-  __Pyx_DECREF((PyObject *)arrayObject_unique);
-  __Pyx_DECREF(__pyx_v_rngs);
-  __Pyx_DECREF(__pyx_v_i);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-/* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":274
- * 
- * 
- * def mt_range(*args, wordlen=32, exponent=521, gen_seed=None):             # <<<<<<<<<<<<<<
- * 
- * 	cdef int i, count
- */
-
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_0mt_range(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds); /*proto*/
-static PyMethodDef __pyx_mdef_4dcmt_11numpyrandom_0mt_range = {__Pyx_NAMESTR("mt_range"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_0mt_range, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(0)};
-static PyObject *__pyx_pf_4dcmt_11numpyrandom_0mt_range(PyObject *__pyx_self, PyObject *__pyx_args, PyObject *__pyx_kwds) {
-  PyObject *__pyx_v_wordlen = 0;
-  PyObject *__pyx_v_exponent = 0;
-  PyObject *__pyx_v_gen_seed = 0;
-  PyObject *__pyx_v_args = 0;
-  int __pyx_v_i;
-  int __pyx_v_count;
-  mt_struct **__pyx_v_mts;
-  PyObject *__pyx_v_res;
-  PyObject *__pyx_v_common_fields;
-  PyArrayObject *arrayObject_unique;
-  uint32_t *__pyx_v_data;
-  PyObject *__pyx_r = NULL;
-  PyObject *__pyx_t_1 = NULL;
-  int __pyx_t_2;
-  PyObject *__pyx_t_3 = NULL;
-  PyObject *__pyx_t_4 = NULL;
-  PyObject *__pyx_t_5 = NULL;
-  int __pyx_t_6;
-  int __pyx_t_7;
-  static PyObject **__pyx_pyargnames[] = {&__pyx_n_s__wordlen,&__pyx_n_s__exponent,&__pyx_n_s__gen_seed,0};
-  __Pyx_RefNannySetupContext("mt_range");
-  __pyx_self = __pyx_self;
-  if (PyTuple_GET_SIZE(__pyx_args) > 0) {
-    __pyx_v_args = PyTuple_GetSlice(__pyx_args, 0, PyTuple_GET_SIZE(__pyx_args)); __Pyx_GOTREF(__pyx_v_args);
-    if (unlikely(!__pyx_v_args)) return NULL;
-  } else {
-    __pyx_v_args = __pyx_empty_tuple; __Pyx_INCREF(__pyx_empty_tuple);
-  }
-  if (unlikely(__pyx_kwds)) {
-    Py_ssize_t kw_args = PyDict_Size(__pyx_kwds);
-    PyObject* values[3] = {0,0,0};
-    values[0] = ((PyObject *)__pyx_int_32);
-    values[1] = ((PyObject *)__pyx_int_521);
-    values[2] = ((PyObject *)Py_None);
-    switch (PyTuple_GET_SIZE(__pyx_args)) {
-      default:
-      case  0: break;
-    }
-    while (kw_args > 0) {
-      PyObject* value;
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__wordlen);
-      if (value) { values[0] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__exponent);
-      if (value) { values[1] = value; if (!(--kw_args)) break; }
-      value = PyDict_GetItem(__pyx_kwds, __pyx_n_s__gen_seed);
-      if (value) { values[2] = value; if (!(--kw_args)) break; }
-      break;
-    }
-    if (unlikely(kw_args > 0)) {
-      if (unlikely(__Pyx_ParseOptionalKeywords(__pyx_kwds, __pyx_pyargnames, 0, values, 0, "mt_range") < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 274; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-    }
-    __pyx_v_wordlen = values[0];
-    __pyx_v_exponent = values[1];
-    __pyx_v_gen_seed = values[2];
-  } else if (PyTuple_GET_SIZE(__pyx_args) < 0) {
-    goto __pyx_L5_argtuple_error;
-  } else {
-    __pyx_v_wordlen = ((PyObject *)__pyx_int_32);
-    __pyx_v_exponent = ((PyObject *)__pyx_int_521);
-    __pyx_v_gen_seed = ((PyObject *)Py_None);
-  }
-  goto __pyx_L4_argument_unpacking_done;
-  __pyx_L5_argtuple_error:;
-  __Pyx_RaiseArgtupleInvalid("mt_range", 0, 0, 0, PyTuple_GET_SIZE(__pyx_args)); {__pyx_filename = __pyx_f[1]; __pyx_lineno = 274; __pyx_clineno = __LINE__; goto __pyx_L3_error;}
-  __pyx_L3_error:;
-  __Pyx_DECREF(__pyx_v_args);
-  __Pyx_AddTraceback("dcmt.numpyrandom.mt_range");
-  __Pyx_RefNannyFinishContext();
-  return NULL;
-  __pyx_L4_argument_unpacking_done:;
-  __pyx_v_res = Py_None; __Pyx_INCREF(Py_None);
-  __pyx_v_common_fields = Py_None; __Pyx_INCREF(Py_None);
-  arrayObject_unique = ((PyArrayObject *)Py_None); __Pyx_INCREF(Py_None);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":277
- * 
- * 	cdef int i, count
- * 	cdef mt_struct **mts = NULL             # <<<<<<<<<<<<<<
- * 
- * 	res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
- */
-  __pyx_v_mts = NULL;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":279
- * 	cdef mt_struct **mts = NULL
- * 
- * 	res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)             # <<<<<<<<<<<<<<
- * 	if res != None:
- * 		return res
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_create_mt_range(((PyObject *)__pyx_v_args), __pyx_v_wordlen, __pyx_v_exponent, __pyx_v_gen_seed, (&__pyx_v_mts), (&__pyx_v_count)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 279; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_v_res);
-  __pyx_v_res = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":280
- * 
- * 	res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
- * 	if res != None:             # <<<<<<<<<<<<<<
- * 		return res
- * 
- */
-  __pyx_t_1 = PyObject_RichCompare(__pyx_v_res, Py_None, Py_NE); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_PyObject_IsTrue(__pyx_t_1); if (unlikely(__pyx_t_2 < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 280; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  if (__pyx_t_2) {
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":281
- * 	res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
- * 	if res != None:
- * 		return res             # <<<<<<<<<<<<<<
- * 
- * 	common_fields = get_mt_struct_common_fields(mts[0])
- */
-    __Pyx_XDECREF(__pyx_r);
-    __Pyx_INCREF(__pyx_v_res);
-    __pyx_r = __pyx_v_res;
-    goto __pyx_L0;
-    goto __pyx_L6;
-  }
-  __pyx_L6:;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":283
- * 		return res
- * 
- * 	common_fields = get_mt_struct_common_fields(mts[0])             # <<<<<<<<<<<<<<
- * 
- * 	cdef ndarray unique_fields "arrayObject_unique"
- */
-  __pyx_t_1 = __pyx_f_4dcmt_11numpyrandom_get_mt_struct_common_fields((__pyx_v_mts[0])); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 283; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_v_common_fields);
-  __pyx_v_common_fields = __pyx_t_1;
-  __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":286
- * 
- * 	cdef ndarray unique_fields "arrayObject_unique"
- * 	unique_fields = <ndarray>numpy.empty((count, 4), numpy.uint32)             # <<<<<<<<<<<<<<
- * 
- * 	cdef uint32_t *data = <uint32_t *>unique_fields.data
- */
-  __pyx_t_1 = __Pyx_GetName(__pyx_m, __pyx_n_s__numpy); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_3 = PyObject_GetAttr(__pyx_t_1, __pyx_n_s__empty); if (unlikely(!__pyx_t_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_3);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = PyInt_FromLong(__pyx_v_count); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_4 = PyTuple_New(2); if (unlikely(!__pyx_t_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_4, 0, __pyx_t_1);
-  __Pyx_GIVEREF(__pyx_t_1);
-  __Pyx_INCREF(__pyx_int_4);
-  PyTuple_SET_ITEM(__pyx_t_4, 1, __pyx_int_4);
-  __Pyx_GIVEREF(__pyx_int_4);
-  __pyx_t_1 = 0;
-  __pyx_t_1 = __Pyx_GetName(__pyx_m, __pyx_n_s__numpy); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_5 = PyObject_GetAttr(__pyx_t_1, __pyx_n_s__uint32); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = PyTuple_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  PyTuple_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_t_4));
-  __Pyx_GIVEREF(((PyObject *)__pyx_t_4));
-  PyTuple_SET_ITEM(__pyx_t_1, 1, __pyx_t_5);
-  __Pyx_GIVEREF(__pyx_t_5);
-  __pyx_t_4 = 0;
-  __pyx_t_5 = 0;
-  __pyx_t_5 = PyObject_Call(__pyx_t_3, ((PyObject *)__pyx_t_1), NULL); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 286; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_3); __pyx_t_3 = 0;
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __Pyx_INCREF(((PyObject *)((PyArrayObject *)__pyx_t_5)));
-  __Pyx_DECREF(((PyObject *)arrayObject_unique));
-  arrayObject_unique = ((PyArrayObject *)__pyx_t_5);
-  __Pyx_DECREF(__pyx_t_5); __pyx_t_5 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":288
- * 	unique_fields = <ndarray>numpy.empty((count, 4), numpy.uint32)
- * 
- * 	cdef uint32_t *data = <uint32_t *>unique_fields.data             # <<<<<<<<<<<<<<
- * 	for i in range(count):
- * 		data[i * 4 + 0] = mts[i].aaa
- */
-  __pyx_v_data = ((uint32_t *)arrayObject_unique->data);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":289
- * 
- * 	cdef uint32_t *data = <uint32_t *>unique_fields.data
- * 	for i in range(count):             # <<<<<<<<<<<<<<
- * 		data[i * 4 + 0] = mts[i].aaa
- * 		data[i * 4 + 1] = mts[i].maskB
- */
-  __pyx_t_6 = __pyx_v_count;
-  for (__pyx_t_7 = 0; __pyx_t_7 < __pyx_t_6; __pyx_t_7+=1) {
-    __pyx_v_i = __pyx_t_7;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":290
- * 	cdef uint32_t *data = <uint32_t *>unique_fields.data
- * 	for i in range(count):
- * 		data[i * 4 + 0] = mts[i].aaa             # <<<<<<<<<<<<<<
- * 		data[i * 4 + 1] = mts[i].maskB
- * 		data[i * 4 + 2] = mts[i].maskC
- */
-    (__pyx_v_data[((__pyx_v_i * 4) + 0)]) = (__pyx_v_mts[__pyx_v_i])->aaa;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":291
- * 	for i in range(count):
- * 		data[i * 4 + 0] = mts[i].aaa
- * 		data[i * 4 + 1] = mts[i].maskB             # <<<<<<<<<<<<<<
- * 		data[i * 4 + 2] = mts[i].maskC
- * 		data[i * 4 + 3] = <uint32_t>mts[i].i
- */
-    (__pyx_v_data[((__pyx_v_i * 4) + 1)]) = (__pyx_v_mts[__pyx_v_i])->maskB;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":292
- * 		data[i * 4 + 0] = mts[i].aaa
- * 		data[i * 4 + 1] = mts[i].maskB
- * 		data[i * 4 + 2] = mts[i].maskC             # <<<<<<<<<<<<<<
- * 		data[i * 4 + 3] = <uint32_t>mts[i].i
- * 
- */
-    (__pyx_v_data[((__pyx_v_i * 4) + 2)]) = (__pyx_v_mts[__pyx_v_i])->maskC;
-
-    /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":293
- * 		data[i * 4 + 1] = mts[i].maskB
- * 		data[i * 4 + 2] = mts[i].maskC
- * 		data[i * 4 + 3] = <uint32_t>mts[i].i             # <<<<<<<<<<<<<<
- * 
- * 	free_mt_struct_array(mts, count)
- */
-    (__pyx_v_data[((__pyx_v_i * 4) + 3)]) = ((uint32_t)(__pyx_v_mts[__pyx_v_i])->i);
-  }
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":295
- * 		data[i * 4 + 3] = <uint32_t>mts[i].i
- * 
- * 	free_mt_struct_array(mts, count)             # <<<<<<<<<<<<<<
- * 
- * 	return common_fields, unique_fields
- */
-  free_mt_struct_array(__pyx_v_mts, __pyx_v_count);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":297
- * 	free_mt_struct_array(mts, count)
- * 
- * 	return common_fields, unique_fields             # <<<<<<<<<<<<<<
- */
-  __Pyx_XDECREF(__pyx_r);
-  __pyx_t_5 = PyTuple_New(2); if (unlikely(!__pyx_t_5)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 297; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_5));
-  __Pyx_INCREF(__pyx_v_common_fields);
-  PyTuple_SET_ITEM(__pyx_t_5, 0, __pyx_v_common_fields);
-  __Pyx_GIVEREF(__pyx_v_common_fields);
-  __Pyx_INCREF(((PyObject *)arrayObject_unique));
-  PyTuple_SET_ITEM(__pyx_t_5, 1, ((PyObject *)arrayObject_unique));
-  __Pyx_GIVEREF(((PyObject *)arrayObject_unique));
-  __pyx_r = ((PyObject *)__pyx_t_5);
-  __pyx_t_5 = 0;
-  goto __pyx_L0;
-
-  __pyx_r = Py_None; __Pyx_INCREF(Py_None);
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_3);
-  __Pyx_XDECREF(__pyx_t_4);
-  __Pyx_XDECREF(__pyx_t_5);
-  __Pyx_AddTraceback("dcmt.numpyrandom.mt_range");
-  __pyx_r = NULL;
-  __pyx_L0:;
-  __Pyx_DECREF(__pyx_v_args);
-  __Pyx_DECREF(__pyx_v_res);
-  __Pyx_DECREF(__pyx_v_common_fields);
-  __Pyx_DECREF((PyObject *)arrayObject_unique);
-  __Pyx_XGIVEREF(__pyx_r);
-  __Pyx_RefNannyFinishContext();
-  return __pyx_r;
-}
-
-static PyObject *__pyx_tp_new_4dcmt_11numpyrandom_DcmtRandomState(PyTypeObject *t, PyObject *a, PyObject *k) {
-  PyObject *o = (*t->tp_alloc)(t, 0);
-  if (!o) return 0;
-  return o;
-}
-
-static void __pyx_tp_dealloc_4dcmt_11numpyrandom_DcmtRandomState(PyObject *o) {
-  {
-    PyObject *etype, *eval, *etb;
-    PyErr_Fetch(&etype, &eval, &etb);
-    ++Py_REFCNT(o);
-    __pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_1__dealloc__(o);
-    if (PyErr_Occurred()) PyErr_WriteUnraisable(o);
-    --Py_REFCNT(o);
-    PyErr_Restore(etype, eval, etb);
-  }
-  (*Py_TYPE(o)->tp_free)(o);
-}
-
-static PyMethodDef __pyx_methods_4dcmt_11numpyrandom_DcmtRandomState[] = {
-  {__Pyx_NAMESTR("__getstate__"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_2__getstate__, METH_NOARGS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("__setstate__"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_3__setstate__, METH_O, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("__reduce__"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_4__reduce__, METH_NOARGS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("seed"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_5seed, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("get_state"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_6get_state, METH_NOARGS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("set_state"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_7set_state, METH_O, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("rand"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_8rand, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("random_sample"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_9random_sample, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("rand_fill"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_10rand_fill, METH_O, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("randraw_fill"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_11randraw_fill, METH_O, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("range"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_12range, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(0)},
-  {__Pyx_NAMESTR("from_mt_range"), (PyCFunction)__pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_13from_mt_range, METH_VARARGS|METH_KEYWORDS, __Pyx_DOCSTR(0)},
-  {0, 0, 0, 0}
-};
-
-static PyNumberMethods __pyx_tp_as_number_DcmtRandomState = {
-  0, /*nb_add*/
-  0, /*nb_subtract*/
-  0, /*nb_multiply*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*nb_divide*/
-  #endif
-  0, /*nb_remainder*/
-  0, /*nb_divmod*/
-  0, /*nb_power*/
-  0, /*nb_negative*/
-  0, /*nb_positive*/
-  0, /*nb_absolute*/
-  0, /*nb_nonzero*/
-  0, /*nb_invert*/
-  0, /*nb_lshift*/
-  0, /*nb_rshift*/
-  0, /*nb_and*/
-  0, /*nb_xor*/
-  0, /*nb_or*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*nb_coerce*/
-  #endif
-  0, /*nb_int*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*nb_long*/
-  #else
-  0, /*reserved*/
-  #endif
-  0, /*nb_float*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*nb_oct*/
-  #endif
-  #if PY_MAJOR_VERSION < 3
-  0, /*nb_hex*/
-  #endif
-  0, /*nb_inplace_add*/
-  0, /*nb_inplace_subtract*/
-  0, /*nb_inplace_multiply*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*nb_inplace_divide*/
-  #endif
-  0, /*nb_inplace_remainder*/
-  0, /*nb_inplace_power*/
-  0, /*nb_inplace_lshift*/
-  0, /*nb_inplace_rshift*/
-  0, /*nb_inplace_and*/
-  0, /*nb_inplace_xor*/
-  0, /*nb_inplace_or*/
-  0, /*nb_floor_divide*/
-  0, /*nb_true_divide*/
-  0, /*nb_inplace_floor_divide*/
-  0, /*nb_inplace_true_divide*/
-  #if PY_VERSION_HEX >= 0x02050000
-  0, /*nb_index*/
-  #endif
-};
-
-static PySequenceMethods __pyx_tp_as_sequence_DcmtRandomState = {
-  0, /*sq_length*/
-  0, /*sq_concat*/
-  0, /*sq_repeat*/
-  0, /*sq_item*/
-  0, /*sq_slice*/
-  0, /*sq_ass_item*/
-  0, /*sq_ass_slice*/
-  0, /*sq_contains*/
-  0, /*sq_inplace_concat*/
-  0, /*sq_inplace_repeat*/
-};
-
-static PyMappingMethods __pyx_tp_as_mapping_DcmtRandomState = {
-  0, /*mp_length*/
-  0, /*mp_subscript*/
-  0, /*mp_ass_subscript*/
-};
-
-static PyBufferProcs __pyx_tp_as_buffer_DcmtRandomState = {
-  #if PY_MAJOR_VERSION < 3
-  0, /*bf_getreadbuffer*/
-  #endif
-  #if PY_MAJOR_VERSION < 3
-  0, /*bf_getwritebuffer*/
-  #endif
-  #if PY_MAJOR_VERSION < 3
-  0, /*bf_getsegcount*/
-  #endif
-  #if PY_MAJOR_VERSION < 3
-  0, /*bf_getcharbuffer*/
-  #endif
-  #if PY_VERSION_HEX >= 0x02060000
-  0, /*bf_getbuffer*/
-  #endif
-  #if PY_VERSION_HEX >= 0x02060000
-  0, /*bf_releasebuffer*/
-  #endif
-};
-
-PyTypeObject __pyx_type_4dcmt_11numpyrandom_DcmtRandomState = {
-  PyVarObject_HEAD_INIT(0, 0)
-  __Pyx_NAMESTR("dcmt.numpyrandom.DcmtRandomState"), /*tp_name*/
-  sizeof(struct __pyx_obj_4dcmt_11numpyrandom_DcmtRandomState), /*tp_basicsize*/
-  0, /*tp_itemsize*/
-  __pyx_tp_dealloc_4dcmt_11numpyrandom_DcmtRandomState, /*tp_dealloc*/
-  0, /*tp_print*/
-  0, /*tp_getattr*/
-  0, /*tp_setattr*/
-  #if PY_MAJOR_VERSION < 3
-  0, /*tp_compare*/
-  #else
-  0, /*reserved*/
-  #endif
-  0, /*tp_repr*/
-  &__pyx_tp_as_number_DcmtRandomState, /*tp_as_number*/
-  &__pyx_tp_as_sequence_DcmtRandomState, /*tp_as_sequence*/
-  &__pyx_tp_as_mapping_DcmtRandomState, /*tp_as_mapping*/
-  0, /*tp_hash*/
-  0, /*tp_call*/
-  0, /*tp_str*/
-  0, /*tp_getattro*/
-  0, /*tp_setattro*/
-  &__pyx_tp_as_buffer_DcmtRandomState, /*tp_as_buffer*/
-  Py_TPFLAGS_DEFAULT|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_NEWBUFFER|Py_TPFLAGS_BASETYPE, /*tp_flags*/
-  0, /*tp_doc*/
-  0, /*tp_traverse*/
-  0, /*tp_clear*/
-  0, /*tp_richcompare*/
-  0, /*tp_weaklistoffset*/
-  0, /*tp_iter*/
-  0, /*tp_iternext*/
-  __pyx_methods_4dcmt_11numpyrandom_DcmtRandomState, /*tp_methods*/
-  0, /*tp_members*/
-  0, /*tp_getset*/
-  0, /*tp_base*/
-  0, /*tp_dict*/
-  0, /*tp_descr_get*/
-  0, /*tp_descr_set*/
-  0, /*tp_dictoffset*/
-  __pyx_pf_4dcmt_11numpyrandom_15DcmtRandomState_0__init__, /*tp_init*/
-  0, /*tp_alloc*/
-  __pyx_tp_new_4dcmt_11numpyrandom_DcmtRandomState, /*tp_new*/
-  0, /*tp_free*/
-  0, /*tp_is_gc*/
-  0, /*tp_bases*/
-  0, /*tp_mro*/
-  0, /*tp_cache*/
-  0, /*tp_subclasses*/
-  0, /*tp_weaklist*/
-  0, /*tp_del*/
-  #if PY_VERSION_HEX >= 0x02060000
-  0, /*tp_version_tag*/
-  #endif
-};
-
-static PyMethodDef __pyx_methods[] = {
-  {0, 0, 0, 0}
-};
-
-#if PY_MAJOR_VERSION >= 3
-static struct PyModuleDef __pyx_moduledef = {
-    PyModuleDef_HEAD_INIT,
-    __Pyx_NAMESTR("numpyrandom"),
-    0, /* m_doc */
-    -1, /* m_size */
-    __pyx_methods /* m_methods */,
-    NULL, /* m_reload */
-    NULL, /* m_traverse */
-    NULL, /* m_clear */
-    NULL /* m_free */
-};
-#endif
-
-static __Pyx_StringTabEntry __pyx_string_tab[] = {
-  {&__pyx_kp_s_10, __pyx_k_10, sizeof(__pyx_k_10), 0, 0, 1, 0},
-  {&__pyx_kp_s_12, __pyx_k_12, sizeof(__pyx_k_12), 0, 0, 1, 0},
-  {&__pyx_kp_s_14, __pyx_k_14, sizeof(__pyx_k_14), 0, 0, 1, 0},
-  {&__pyx_kp_s_16, __pyx_k_16, sizeof(__pyx_k_16), 0, 0, 1, 0},
-  {&__pyx_kp_s_17, __pyx_k_17, sizeof(__pyx_k_17), 0, 0, 1, 0},
-  {&__pyx_kp_s_18, __pyx_k_18, sizeof(__pyx_k_18), 0, 0, 1, 0},
-  {&__pyx_kp_s_19, __pyx_k_19, sizeof(__pyx_k_19), 0, 0, 1, 0},
-  {&__pyx_kp_s_2, __pyx_k_2, sizeof(__pyx_k_2), 0, 0, 1, 0},
-  {&__pyx_kp_s_20, __pyx_k_20, sizeof(__pyx_k_20), 0, 0, 1, 0},
-  {&__pyx_kp_s_21, __pyx_k_21, sizeof(__pyx_k_21), 0, 0, 1, 0},
-  {&__pyx_kp_s_23, __pyx_k_23, sizeof(__pyx_k_23), 0, 0, 1, 0},
-  {&__pyx_kp_s_25, __pyx_k_25, sizeof(__pyx_k_25), 0, 0, 1, 0},
-  {&__pyx_kp_s_28, __pyx_k_28, sizeof(__pyx_k_28), 0, 0, 1, 0},
-  {&__pyx_n_s_30, __pyx_k_30, sizeof(__pyx_k_30), 0, 0, 1, 1},
-  {&__pyx_n_s_31, __pyx_k_31, sizeof(__pyx_k_31), 0, 0, 1, 1},
-  {&__pyx_kp_s_4, __pyx_k_4, sizeof(__pyx_k_4), 0, 0, 1, 0},
-  {&__pyx_kp_s_6, __pyx_k_6, sizeof(__pyx_k_6), 0, 0, 1, 0},
-  {&__pyx_kp_s_8, __pyx_k_8, sizeof(__pyx_k_8), 0, 0, 1, 0},
-  {&__pyx_n_s__DcmtError, __pyx_k__DcmtError, sizeof(__pyx_k__DcmtError), 0, 0, 1, 1},
-  {&__pyx_n_s__DcmtParameterError, __pyx_k__DcmtParameterError, sizeof(__pyx_k__DcmtParameterError), 0, 0, 1, 1},
-  {&__pyx_n_s__NotImplementedError, __pyx_k__NotImplementedError, sizeof(__pyx_k__NotImplementedError), 0, 0, 1, 1},
-  {&__pyx_n_s__TypeError, __pyx_k__TypeError, sizeof(__pyx_k__TypeError), 0, 0, 1, 1},
-  {&__pyx_n_s__ValueError, __pyx_k__ValueError, sizeof(__pyx_k__ValueError), 0, 0, 1, 1},
-  {&__pyx_n_s____class__, __pyx_k____class__, sizeof(__pyx_k____class__), 0, 0, 1, 1},
-  {&__pyx_n_s____main__, __pyx_k____main__, sizeof(__pyx_k____main__), 0, 0, 1, 1},
-  {&__pyx_n_s____test__, __pyx_k____test__, sizeof(__pyx_k____test__), 0, 0, 1, 1},
-  {&__pyx_n_s___hexlify, __pyx_k___hexlify, sizeof(__pyx_k___hexlify), 0, 0, 1, 1},
-  {&__pyx_n_s___urandom, __pyx_k___urandom, sizeof(__pyx_k___urandom), 0, 0, 1, 1},
-  {&__pyx_n_s__aaa, __pyx_k__aaa, sizeof(__pyx_k__aaa), 0, 0, 1, 1},
-  {&__pyx_n_s__append, __pyx_k__append, sizeof(__pyx_k__append), 0, 0, 1, 1},
-  {&__pyx_n_s__binascii, __pyx_k__binascii, sizeof(__pyx_k__binascii), 0, 0, 1, 1},
-  {&__pyx_n_s__data, __pyx_k__data, sizeof(__pyx_k__data), 0, 0, 1, 1},
-  {&__pyx_n_s__descr, __pyx_k__descr, sizeof(__pyx_k__descr), 0, 0, 1, 1},
-  {&__pyx_n_s__dimensions, __pyx_k__dimensions, sizeof(__pyx_k__dimensions), 0, 0, 1, 1},
-  {&__pyx_n_s__elsize, __pyx_k__elsize, sizeof(__pyx_k__elsize), 0, 0, 1, 1},
-  {&__pyx_n_s__empty, __pyx_k__empty, sizeof(__pyx_k__empty), 0, 0, 1, 1},
-  {&__pyx_n_s__exponent, __pyx_k__exponent, sizeof(__pyx_k__exponent), 0, 0, 1, 1},
-  {&__pyx_n_s__float64, __pyx_k__float64, sizeof(__pyx_k__float64), 0, 0, 1, 1},
-  {&__pyx_n_s__from_mt_range, __pyx_k__from_mt_range, sizeof(__pyx_k__from_mt_range), 0, 0, 1, 1},
-  {&__pyx_n_s__gen_seed, __pyx_k__gen_seed, sizeof(__pyx_k__gen_seed), 0, 0, 1, 1},
-  {&__pyx_n_s__get_state, __pyx_k__get_state, sizeof(__pyx_k__get_state), 0, 0, 1, 1},
-  {&__pyx_n_s__hexlify, __pyx_k__hexlify, sizeof(__pyx_k__hexlify), 0, 0, 1, 1},
-  {&__pyx_n_s__i, __pyx_k__i, sizeof(__pyx_k__i), 0, 0, 1, 1},
-  {&__pyx_n_s__id, __pyx_k__id, sizeof(__pyx_k__id), 0, 0, 1, 1},
-  {&__pyx_n_s__lmask, __pyx_k__lmask, sizeof(__pyx_k__lmask), 0, 0, 1, 1},
-  {&__pyx_n_s__maskB, __pyx_k__maskB, sizeof(__pyx_k__maskB), 0, 0, 1, 1},
-  {&__pyx_n_s__maskC, __pyx_k__maskC, sizeof(__pyx_k__maskC), 0, 0, 1, 1},
-  {&__pyx_n_s__mm, __pyx_k__mm, sizeof(__pyx_k__mm), 0, 0, 1, 1},
-  {&__pyx_n_s__mt, __pyx_k__mt, sizeof(__pyx_k__mt), 0, 0, 1, 1},
-  {&__pyx_n_s__mt_common, __pyx_k__mt_common, sizeof(__pyx_k__mt_common), 0, 0, 1, 1},
-  {&__pyx_n_s__mt_range, __pyx_k__mt_range, sizeof(__pyx_k__mt_range), 0, 0, 1, 1},
-  {&__pyx_n_s__mt_unique, __pyx_k__mt_unique, sizeof(__pyx_k__mt_unique), 0, 0, 1, 1},
-  {&__pyx_n_s__nn, __pyx_k__nn, sizeof(__pyx_k__nn), 0, 0, 1, 1},
-  {&__pyx_n_s__numpy, __pyx_k__numpy, sizeof(__pyx_k__numpy), 0, 0, 1, 1},
-  {&__pyx_n_s__os, __pyx_k__os, sizeof(__pyx_k__os), 0, 0, 1, 1},
-  {&__pyx_n_s__rand_fill, __pyx_k__rand_fill, sizeof(__pyx_k__rand_fill), 0, 0, 1, 1},
-  {&__pyx_n_s__random_sample, __pyx_k__random_sample, sizeof(__pyx_k__random_sample), 0, 0, 1, 1},
-  {&__pyx_n_s__range, __pyx_k__range, sizeof(__pyx_k__range), 0, 0, 1, 1},
-  {&__pyx_n_s__rr, __pyx_k__rr, sizeof(__pyx_k__rr), 0, 0, 1, 1},
-  {&__pyx_n_s__seed, __pyx_k__seed, sizeof(__pyx_k__seed), 0, 0, 1, 1},
-  {&__pyx_n_s__set_state, __pyx_k__set_state, sizeof(__pyx_k__set_state), 0, 0, 1, 1},
-  {&__pyx_n_s__shape, __pyx_k__shape, sizeof(__pyx_k__shape), 0, 0, 1, 1},
-  {&__pyx_n_s__shift0, __pyx_k__shift0, sizeof(__pyx_k__shift0), 0, 0, 1, 1},
-  {&__pyx_n_s__shift1, __pyx_k__shift1, sizeof(__pyx_k__shift1), 0, 0, 1, 1},
-  {&__pyx_n_s__shiftB, __pyx_k__shiftB, sizeof(__pyx_k__shiftB), 0, 0, 1, 1},
-  {&__pyx_n_s__shiftC, __pyx_k__shiftC, sizeof(__pyx_k__shiftC), 0, 0, 1, 1},
-  {&__pyx_n_s__size, __pyx_k__size, sizeof(__pyx_k__size), 0, 0, 1, 1},
-  {&__pyx_n_s__state, __pyx_k__state, sizeof(__pyx_k__state), 0, 0, 1, 1},
-  {&__pyx_n_s__time, __pyx_k__time, sizeof(__pyx_k__time), 0, 0, 1, 1},
-  {&__pyx_n_s__type_num, __pyx_k__type_num, sizeof(__pyx_k__type_num), 0, 0, 1, 1},
-  {&__pyx_n_s__uint32, __pyx_k__uint32, sizeof(__pyx_k__uint32), 0, 0, 1, 1},
-  {&__pyx_n_s__umask, __pyx_k__umask, sizeof(__pyx_k__umask), 0, 0, 1, 1},
-  {&__pyx_n_s__urandom, __pyx_k__urandom, sizeof(__pyx_k__urandom), 0, 0, 1, 1},
-  {&__pyx_n_s__wmask, __pyx_k__wmask, sizeof(__pyx_k__wmask), 0, 0, 1, 1},
-  {&__pyx_n_s__wordlen, __pyx_k__wordlen, sizeof(__pyx_k__wordlen), 0, 0, 1, 1},
-  {&__pyx_n_s__ww, __pyx_k__ww, sizeof(__pyx_k__ww), 0, 0, 1, 1},
-  {&__pyx_n_s__xrange, __pyx_k__xrange, sizeof(__pyx_k__xrange), 0, 0, 1, 1},
-  {0, 0, 0, 0, 0, 0, 0}
-};
-static int __Pyx_InitCachedBuiltins(void) {
-  __pyx_builtin_NotImplementedError = __Pyx_GetName(__pyx_b, __pyx_n_s__NotImplementedError); if (!__pyx_builtin_NotImplementedError) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 63; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_TypeError = __Pyx_GetName(__pyx_b, __pyx_n_s__TypeError); if (!__pyx_builtin_TypeError) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 68; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_ValueError = __Pyx_GetName(__pyx_b, __pyx_n_s__ValueError); if (!__pyx_builtin_ValueError) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_builtin_range = __Pyx_GetName(__pyx_b, __pyx_n_s__range); if (!__pyx_builtin_range) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 197; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  #if PY_MAJOR_VERSION >= 3
-  __pyx_builtin_xrange = __Pyx_GetName(__pyx_b, __pyx_n_s__range); if (!__pyx_builtin_xrange) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  #else
-  __pyx_builtin_xrange = __Pyx_GetName(__pyx_b, __pyx_n_s__xrange); if (!__pyx_builtin_xrange) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 252; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  #endif
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-static int __Pyx_InitCachedConstants(void) {
-  __Pyx_RefNannySetupContext("__Pyx_InitCachedConstants");
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":62
- * 	if seed is None:
- * 		try:
- * 			seed = long(_hexlify(_urandom(16)), 16)             # <<<<<<<<<<<<<<
- * 		except NotImplementedError:
- * 			seed = long(time.time() * 256) # use fractional seconds
- */
-  __pyx_k_tuple_1 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 62; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_1));
-  __Pyx_INCREF(__pyx_int_16);
-  PyTuple_SET_ITEM(__pyx_k_tuple_1, 0, __pyx_int_16);
-  __Pyx_GIVEREF(__pyx_int_16);
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_1));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":69
- * 			seed = hash(seed)
- * 		except TypeError:
- * 			raise DcmtParameterError("Seed must be an integer or hashable type")             # <<<<<<<<<<<<<<
- * 
- * 	# not checking for overflow now, since we need 4 lower bytes anyway
- */
-  __pyx_k_tuple_3 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_3)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 69; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_3));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_2));
-  PyTuple_SET_ITEM(__pyx_k_tuple_3, 0, ((PyObject *)__pyx_kp_s_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_2));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_3));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":86
- * 
- * 	if sid > mid:
- * 		raise DcmtParameterError("Starting ID must be equal to or lower than maximum ID")             # <<<<<<<<<<<<<<
- * 
- * 	if sid < 0 or mid > 65535:
- */
-  __pyx_k_tuple_5 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_5)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 86; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_5));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_4));
-  PyTuple_SET_ITEM(__pyx_k_tuple_5, 0, ((PyObject *)__pyx_kp_s_4));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_4));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_5));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":89
- * 
- * 	if sid < 0 or mid > 65535:
- * 		raise DcmtParameterError("All IDs must lie between 0 and 65535")             # <<<<<<<<<<<<<<
- * 
- * 	if w == 31 and p == 521 and sid <= 9 and mid >= 9:
- */
-  __pyx_k_tuple_7 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_7)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 89; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_7));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_6));
-  PyTuple_SET_ITEM(__pyx_k_tuple_7, 0, ((PyObject *)__pyx_kp_s_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_6));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_7));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":92
- * 
- * 	if w == 31 and p == 521 and sid <= 9 and mid >= 9:
- * 		raise DcmtParameterError("Known bug: cannot create RNG for wordlen=31, exponent=521, id=9")             # <<<<<<<<<<<<<<
- * 
- * 	if w != 31 and w != 32:
- */
-  __pyx_k_tuple_9 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_9)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 92; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_9));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_8));
-  PyTuple_SET_ITEM(__pyx_k_tuple_9, 0, ((PyObject *)__pyx_kp_s_8));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_8));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_9));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":95
- * 
- * 	if w != 31 and w != 32:
- * 		raise DcmtParameterError("Word length must be equal to 31 or 32")             # <<<<<<<<<<<<<<
- * 
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
- */
-  __pyx_k_tuple_11 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_11)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 95; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_11));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_10));
-  PyTuple_SET_ITEM(__pyx_k_tuple_11, 0, ((PyObject *)__pyx_kp_s_10));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_10));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_11));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":99
- * 	if p not in (521, 607, 1279, 2203, 2281, 3217, 4253, 4423,
- * 			9689, 9941, 11213, 19937, 21701, 23209, 44497):
- * 		raise DcmtParameterError("Mersenne exponent is incorrect or not from a supported set")             # <<<<<<<<<<<<<<
- * 
- * 	c_wordlen[0] = w
- */
-  __pyx_k_tuple_13 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_13)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 99; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_13));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_12));
-  PyTuple_SET_ITEM(__pyx_k_tuple_13, 0, ((PyObject *)__pyx_kp_s_12));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_12));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_13));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":116
- * 		start_id, max_id = args
- * 	else:
- * 		raise TypeError("range expected 1 or 2 positional arguments")             # <<<<<<<<<<<<<<
- * 
- * 	max_id -= 1
- */
-  __pyx_k_tuple_15 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_15)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 116; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_15));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_14));
-  PyTuple_SET_ITEM(__pyx_k_tuple_15, 0, ((PyObject *)__pyx_kp_s_14));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_14));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_15));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":164
- * 		obj = <ndarray>PyArray_ContiguousFromObject(state_vec, NPY_UINT, 1, 1)
- * 		if obj.dimensions[0] != mt.nn:
- * 			raise ValueError("wrong state vector size")             # <<<<<<<<<<<<<<
- * 		memcpy(<void*>(mt.state), <void*>(obj.data), mt.nn * sizeof(uint32_t))
- * 		self.mt = mt
- */
-  __pyx_k_tuple_22 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_22)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 164; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_22));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_21));
-  PyTuple_SET_ITEM(__pyx_k_tuple_22, 0, ((PyObject *)__pyx_kp_s_21));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_21));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_22));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":189
- * 
- * 		if not PyArray_Check(arr):
- * 			raise TypeError("function requires numpy array")             # <<<<<<<<<<<<<<
- * 
- * 		array = <ndarray>arr
- */
-  __pyx_k_tuple_24 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_24)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 189; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_24));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_23));
-  PyTuple_SET_ITEM(__pyx_k_tuple_24, 0, ((PyObject *)__pyx_kp_s_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_24));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":193
- * 		array = <ndarray>arr
- * 		if array.descr.type_num != NPY_DOUBLE:
- * 			raise TypeError("function requires numpy array of type float64")             # <<<<<<<<<<<<<<
- * 
- * 		length = PyArray_SIZE(array)
- */
-  __pyx_k_tuple_26 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_26)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 193; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_26));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_25));
-  PyTuple_SET_ITEM(__pyx_k_tuple_26, 0, ((PyObject *)__pyx_kp_s_25));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_25));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_26));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":207
- * 
- * 		if not PyArray_Check(arr):
- * 			raise TypeError("function requires numpy array")             # <<<<<<<<<<<<<<
- * 
- * 		array = <ndarray>arr
- */
-  __pyx_k_tuple_27 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_27)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 207; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_27));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_23));
-  PyTuple_SET_ITEM(__pyx_k_tuple_27, 0, ((PyObject *)__pyx_kp_s_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_23));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_27));
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":211
- * 		array = <ndarray>arr
- * 		if array.descr.elsize != 4:
- * 			raise TypeError("function requires numpy array with 4-byte elements")             # <<<<<<<<<<<<<<
- * 
- * 		length = PyArray_SIZE(array)
- */
-  __pyx_k_tuple_29 = PyTuple_New(1); if (unlikely(!__pyx_k_tuple_29)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 211; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_k_tuple_29));
-  __Pyx_INCREF(((PyObject *)__pyx_kp_s_28));
-  PyTuple_SET_ITEM(__pyx_k_tuple_29, 0, ((PyObject *)__pyx_kp_s_28));
-  __Pyx_GIVEREF(((PyObject *)__pyx_kp_s_28));
-  __Pyx_GIVEREF(((PyObject *)__pyx_k_tuple_29));
-  __Pyx_RefNannyFinishContext();
-  return 0;
-  __pyx_L1_error:;
-  __Pyx_RefNannyFinishContext();
-  return -1;
-}
-
-static int __Pyx_InitGlobals(void) {
-  if (__Pyx_InitStrings(__pyx_string_tab) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_0 = PyInt_FromLong(0); if (unlikely(!__pyx_int_0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_1 = PyInt_FromLong(1); if (unlikely(!__pyx_int_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_2 = PyInt_FromLong(2); if (unlikely(!__pyx_int_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_3 = PyInt_FromLong(3); if (unlikely(!__pyx_int_3)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_4 = PyInt_FromLong(4); if (unlikely(!__pyx_int_4)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_16 = PyInt_FromLong(16); if (unlikely(!__pyx_int_16)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_32 = PyInt_FromLong(32); if (unlikely(!__pyx_int_32)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_256 = PyInt_FromLong(256); if (unlikely(!__pyx_int_256)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_521 = PyInt_FromLong(521); if (unlikely(!__pyx_int_521)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  __pyx_int_4294967295 = PyInt_FromString((char *)"4294967295", 0, 0); if (unlikely(!__pyx_int_4294967295)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  return 0;
-  __pyx_L1_error:;
-  return -1;
-}
-
-#if PY_MAJOR_VERSION < 3
-PyMODINIT_FUNC initnumpyrandom(void); /*proto*/
-PyMODINIT_FUNC initnumpyrandom(void)
-#else
-PyMODINIT_FUNC PyInit_numpyrandom(void); /*proto*/
-PyMODINIT_FUNC PyInit_numpyrandom(void)
-#endif
-{
-  PyObject *__pyx_t_1 = NULL;
-  PyObject *__pyx_t_2 = NULL;
-  #if CYTHON_REFNANNY
-  void* __pyx_refnanny = NULL;
-  __Pyx_RefNanny = __Pyx_RefNannyImportAPI("refnanny");
-  if (!__Pyx_RefNanny) {
-      PyErr_Clear();
-      __Pyx_RefNanny = __Pyx_RefNannyImportAPI("Cython.Runtime.refnanny");
-      if (!__Pyx_RefNanny)
-          Py_FatalError("failed to import 'refnanny' module");
-  }
-  __pyx_refnanny = __Pyx_RefNanny->SetupContext("PyMODINIT_FUNC PyInit_numpyrandom(void)", __LINE__, __FILE__);
-  #endif
-  __pyx_empty_tuple = PyTuple_New(0); if (unlikely(!__pyx_empty_tuple)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_empty_bytes = PyBytes_FromStringAndSize("", 0); if (unlikely(!__pyx_empty_bytes)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  #ifdef __pyx_binding_PyCFunctionType_USED
-  if (__pyx_binding_PyCFunctionType_init() < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  #endif
-  /*--- Library function declarations ---*/
-  /*--- Threads initialization code ---*/
-  #if defined(__PYX_FORCE_INIT_THREADS) && __PYX_FORCE_INIT_THREADS
-  #ifdef WITH_THREAD /* Python build with threading support? */
-  PyEval_InitThreads();
-  #endif
-  #endif
-  /*--- Module creation code ---*/
-  #if PY_MAJOR_VERSION < 3
-  __pyx_m = Py_InitModule4(__Pyx_NAMESTR("numpyrandom"), __pyx_methods, 0, 0, PYTHON_API_VERSION);
-  #else
-  __pyx_m = PyModule_Create(&__pyx_moduledef);
-  #endif
-  if (!__pyx_m) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  #if PY_MAJOR_VERSION < 3
-  Py_INCREF(__pyx_m);
-  #endif
-  __pyx_b = PyImport_AddModule(__Pyx_NAMESTR(__Pyx_BUILTIN_MODULE_NAME));
-  if (!__pyx_b) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  if (__Pyx_SetAttrString(__pyx_m, "__builtins__", __pyx_b) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  /*--- Initialize various global constants etc. ---*/
-  if (unlikely(__Pyx_InitGlobals() < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (__pyx_module_is_main_dcmt__numpyrandom) {
-    if (__Pyx_SetAttrString(__pyx_m, "__name__", __pyx_n_s____main__) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;};
-  }
-  /*--- Builtin init code ---*/
-  if (unlikely(__Pyx_InitCachedBuiltins() < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Constants init code ---*/
-  if (unlikely(__Pyx_InitCachedConstants() < 0)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  /*--- Global init code ---*/
-  /*--- Function export code ---*/
-  /*--- Type init code ---*/
-  __pyx_ptype_4dcmt_11numpyrandom_dtype = __Pyx_ImportType("numpy", "dtype", sizeof(PyArray_Descr), 0); if (unlikely(!__pyx_ptype_4dcmt_11numpyrandom_dtype)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 11; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4dcmt_11numpyrandom_ndarray = __Pyx_ImportType("numpy", "ndarray", sizeof(PyArrayObject), 0); if (unlikely(!__pyx_ptype_4dcmt_11numpyrandom_ndarray)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 16; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (PyType_Ready(&__pyx_type_4dcmt_11numpyrandom_DcmtRandomState) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 114; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  if (__Pyx_SetAttrString(__pyx_m, "DcmtRandomState", (PyObject *)&__pyx_type_4dcmt_11numpyrandom_DcmtRandomState) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 114; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState = &__pyx_type_4dcmt_11numpyrandom_DcmtRandomState;
-  /*--- Type import code ---*/
-  /*--- Function import code ---*/
-  /*--- Execution code ---*/
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":46
- * 	double random_float(mt_struct *mt)
- * 
- * from os import urandom as _urandom             # <<<<<<<<<<<<<<
- * from binascii import hexlify as _hexlify
- * import time
- */
-  __pyx_t_1 = PyList_New(1); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 46; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(((PyObject *)__pyx_n_s__urandom));
-  PyList_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_n_s__urandom));
-  __Pyx_GIVEREF(((PyObject *)__pyx_n_s__urandom));
-  __pyx_t_2 = __Pyx_Import(((PyObject *)__pyx_n_s__os), ((PyObject *)__pyx_t_1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 46; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_GetAttr(__pyx_t_2, __pyx_n_s__urandom); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 46; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s___urandom, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 46; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":47
- * 
- * from os import urandom as _urandom
- * from binascii import hexlify as _hexlify             # <<<<<<<<<<<<<<
- * import time
- * 
- */
-  __pyx_t_2 = PyList_New(1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 47; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  __Pyx_INCREF(((PyObject *)__pyx_n_s__hexlify));
-  PyList_SET_ITEM(__pyx_t_2, 0, ((PyObject *)__pyx_n_s__hexlify));
-  __Pyx_GIVEREF(((PyObject *)__pyx_n_s__hexlify));
-  __pyx_t_1 = __Pyx_Import(((PyObject *)__pyx_n_s__binascii), ((PyObject *)__pyx_t_2)); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 47; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  __pyx_t_2 = PyObject_GetAttr(__pyx_t_1, __pyx_n_s__hexlify); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 47; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s___hexlify, __pyx_t_2) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 47; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/common.pxi":48
- * from os import urandom as _urandom
- * from binascii import hexlify as _hexlify
- * import time             # <<<<<<<<<<<<<<
- * 
- * 
- */
-  __pyx_t_1 = __Pyx_Import(((PyObject *)__pyx_n_s__time), 0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 48; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s__time, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[0]; __pyx_lineno = 48; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":3
- * include "common.pxi"
- * 
- * import numpy             # <<<<<<<<<<<<<<
- * 
- * from dcmt.exceptions import DcmtError, DcmtParameterError
- */
-  __pyx_t_1 = __Pyx_Import(((PyObject *)__pyx_n_s__numpy), 0); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 3; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s__numpy, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 3; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":5
- * import numpy
- * 
- * from dcmt.exceptions import DcmtError, DcmtParameterError             # <<<<<<<<<<<<<<
- * 
- * cdef extern from "numpy/arrayobject.h":
- */
-  __pyx_t_1 = PyList_New(2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 5; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_1));
-  __Pyx_INCREF(((PyObject *)__pyx_n_s__DcmtError));
-  PyList_SET_ITEM(__pyx_t_1, 0, ((PyObject *)__pyx_n_s__DcmtError));
-  __Pyx_GIVEREF(((PyObject *)__pyx_n_s__DcmtError));
-  __Pyx_INCREF(((PyObject *)__pyx_n_s__DcmtParameterError));
-  PyList_SET_ITEM(__pyx_t_1, 1, ((PyObject *)__pyx_n_s__DcmtParameterError));
-  __Pyx_GIVEREF(((PyObject *)__pyx_n_s__DcmtParameterError));
-  __pyx_t_2 = __Pyx_Import(((PyObject *)__pyx_n_s_30), ((PyObject *)__pyx_t_1)); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 5; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(((PyObject *)__pyx_t_1)); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_GetAttr(__pyx_t_2, __pyx_n_s__DcmtError); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 5; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s__DcmtError, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 5; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __pyx_t_1 = PyObject_GetAttr(__pyx_t_2, __pyx_n_s__DcmtParameterError); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 5; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s__DcmtParameterError, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 5; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":59
- * 
- * # Initialize numpy
- * import_array()             # <<<<<<<<<<<<<<
- * 
- * cdef object uint32_to_python(uint32_t x):
- */
-  import_array();
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":219
- * 
- * 	@classmethod
- * 	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None):             # <<<<<<<<<<<<<<
- * 		cdef int i, count
- * 		cdef mt_struct **mts = NULL
- */
-  __pyx_t_2 = __Pyx_GetName((PyObject *)__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState, __pyx_n_s__range); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 219; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __pyx_t_1 = __Pyx_Method_ClassMethod(__pyx_t_2); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 218; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  if (PyDict_SetItem((PyObject *)__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState->tp_dict, __pyx_n_s__range, __pyx_t_1) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 219; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  PyType_Modified(__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":243
- * 
- * 	@classmethod
- * 	def from_mt_range(cls, mt_common, mt_unique):             # <<<<<<<<<<<<<<
- * 
- * 		cdef mt_struct *mt
- */
-  __pyx_t_1 = __Pyx_GetName((PyObject *)__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState, __pyx_n_s__from_mt_range); if (unlikely(!__pyx_t_1)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_1);
-  __pyx_t_2 = __Pyx_Method_ClassMethod(__pyx_t_1); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 242; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  __Pyx_DECREF(__pyx_t_1); __pyx_t_1 = 0;
-  if (PyDict_SetItem((PyObject *)__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState->tp_dict, __pyx_n_s__from_mt_range, __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 243; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-  PyType_Modified(__pyx_ptype_4dcmt_11numpyrandom_DcmtRandomState);
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":274
- * 
- * 
- * def mt_range(*args, wordlen=32, exponent=521, gen_seed=None):             # <<<<<<<<<<<<<<
- * 
- * 	cdef int i, count
- */
-  __pyx_t_2 = PyCFunction_NewEx(&__pyx_mdef_4dcmt_11numpyrandom_0mt_range, NULL, __pyx_n_s_31); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 274; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(__pyx_t_2);
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s__mt_range, __pyx_t_2) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 274; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(__pyx_t_2); __pyx_t_2 = 0;
-
-  /* "/Users/bogdan/github/python-dcmt/src/wrapper/numpyrandom.pyx":1
- * include "common.pxi"             # <<<<<<<<<<<<<<
- * 
- * import numpy
- */
-  __pyx_t_2 = PyDict_New(); if (unlikely(!__pyx_t_2)) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_GOTREF(((PyObject *)__pyx_t_2));
-  if (PyObject_SetAttr(__pyx_m, __pyx_n_s____test__, ((PyObject *)__pyx_t_2)) < 0) {__pyx_filename = __pyx_f[1]; __pyx_lineno = 1; __pyx_clineno = __LINE__; goto __pyx_L1_error;}
-  __Pyx_DECREF(((PyObject *)__pyx_t_2)); __pyx_t_2 = 0;
-  goto __pyx_L0;
-  __pyx_L1_error:;
-  __Pyx_XDECREF(__pyx_t_1);
-  __Pyx_XDECREF(__pyx_t_2);
-  if (__pyx_m) {
-    __Pyx_AddTraceback("init dcmt.numpyrandom");
-    Py_DECREF(__pyx_m); __pyx_m = 0;
-  } else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_ImportError, "init dcmt.numpyrandom");
-  }
-  __pyx_L0:;
-  __Pyx_RefNannyFinishContext();
-  #if PY_MAJOR_VERSION < 3
-  return;
-  #else
-  return __pyx_m;
-  #endif
-}
-
-/* Runtime support code */
-
-static PyObject *__Pyx_GetName(PyObject *dict, PyObject *name) {
-    PyObject *result;
-    result = PyObject_GetAttr(dict, name);
-    if (!result)
-        PyErr_SetObject(PyExc_NameError, name);
-    return result;
-}
-
-static int __Pyx_GetException(PyObject **type, PyObject **value, PyObject **tb) {
-    PyObject *local_type, *local_value, *local_tb;
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-    local_type = tstate->curexc_type;
-    local_value = tstate->curexc_value;
-    local_tb = tstate->curexc_traceback;
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
-    PyErr_NormalizeException(&local_type, &local_value, &local_tb);
-    if (unlikely(tstate->curexc_type))
-        goto bad;
-    #if PY_MAJOR_VERSION >= 3
-    if (unlikely(PyException_SetTraceback(local_value, local_tb) < 0))
-        goto bad;
-    #endif
-    *type = local_type;
-    *value = local_value;
-    *tb = local_tb;
-    Py_INCREF(local_type);
-    Py_INCREF(local_value);
-    Py_INCREF(local_tb);
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = local_type;
-    tstate->exc_value = local_value;
-    tstate->exc_traceback = local_tb;
-    /* Make sure tstate is in a consistent state when we XDECREF
-       these objects (XDECREF may run arbitrary code). */
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-    return 0;
-bad:
-    *type = 0;
-    *value = 0;
-    *tb = 0;
-    Py_XDECREF(local_type);
-    Py_XDECREF(local_value);
-    Py_XDECREF(local_tb);
-    return -1;
-}
-
-
-static CYTHON_INLINE void __Pyx_RaiseNeedMoreValuesError(Py_ssize_t index) {
-    PyErr_Format(PyExc_ValueError,
-        #if PY_VERSION_HEX < 0x02050000
-                 "need more than %d value%s to unpack", (int)index,
-        #else
-                 "need more than %zd value%s to unpack", index,
-        #endif
-                 (index == 1) ? "" : "s");
-}
-
-static CYTHON_INLINE void __Pyx_RaiseTooManyValuesError(Py_ssize_t expected) {
-    PyErr_Format(PyExc_ValueError,
-        #if PY_VERSION_HEX < 0x02050000
-            "too many values to unpack (expected %d)", (int)expected);
-        #else
-            "too many values to unpack (expected %zd)", expected);
-        #endif
-}
-
-static PyObject *__Pyx_UnpackItem(PyObject *iter, Py_ssize_t index) {
-    PyObject *item;
-    if (!(item = PyIter_Next(iter))) {
-        if (!PyErr_Occurred()) {
-            __Pyx_RaiseNeedMoreValuesError(index);
-        }
-    }
-    return item;
-}
-
-static int __Pyx_EndUnpack(PyObject *iter, Py_ssize_t expected) {
-    PyObject *item;
-    if ((item = PyIter_Next(iter))) {
-        Py_DECREF(item);
-        __Pyx_RaiseTooManyValuesError(expected);
-        return -1;
-    }
-    else if (!PyErr_Occurred())
-        return 0;
-    else
-        return -1;
-}
-
-static void __Pyx_RaiseDoubleKeywordsError(
-    const char* func_name,
-    PyObject* kw_name)
-{
-    PyErr_Format(PyExc_TypeError,
-        #if PY_MAJOR_VERSION >= 3
-        "%s() got multiple values for keyword argument '%U'", func_name, kw_name);
-        #else
-        "%s() got multiple values for keyword argument '%s'", func_name,
-        PyString_AS_STRING(kw_name));
-        #endif
-}
-
-static void __Pyx_RaiseArgtupleInvalid(
-    const char* func_name,
-    int exact,
-    Py_ssize_t num_min,
-    Py_ssize_t num_max,
-    Py_ssize_t num_found)
-{
-    Py_ssize_t num_expected;
-    const char *number, *more_or_less;
-
-    if (num_found < num_min) {
-        num_expected = num_min;
-        more_or_less = "at least";
-    } else {
-        num_expected = num_max;
-        more_or_less = "at most";
-    }
-    if (exact) {
-        more_or_less = "exactly";
-    }
-    number = (num_expected == 1) ? "" : "s";
-    PyErr_Format(PyExc_TypeError,
-        #if PY_VERSION_HEX < 0x02050000
-            "%s() takes %s %d positional argument%s (%d given)",
-        #else
-            "%s() takes %s %zd positional argument%s (%zd given)",
-        #endif
-        func_name, more_or_less, num_expected, number, num_found);
-}
-
-static int __Pyx_ParseOptionalKeywords(
-    PyObject *kwds,
-    PyObject **argnames[],
-    PyObject *kwds2,
-    PyObject *values[],
-    Py_ssize_t num_pos_args,
-    const char* function_name)
-{
-    PyObject *key = 0, *value = 0;
-    Py_ssize_t pos = 0;
-    PyObject*** name;
-    PyObject*** first_kw_arg = argnames + num_pos_args;
-
-    while (PyDict_Next(kwds, &pos, &key, &value)) {
-        name = first_kw_arg;
-        while (*name && (**name != key)) name++;
-        if (*name) {
-            values[name-argnames] = value;
-        } else {
-            #if PY_MAJOR_VERSION < 3
-            if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key))) {
-            #else
-            if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key))) {
-            #endif
-                goto invalid_keyword_type;
-            } else {
-                for (name = first_kw_arg; *name; name++) {
-                    #if PY_MAJOR_VERSION >= 3
-                    if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                        PyUnicode_Compare(**name, key) == 0) break;
-                    #else
-                    if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                        _PyString_Eq(**name, key)) break;
-                    #endif
-                }
-                if (*name) {
-                    values[name-argnames] = value;
-                } else {
-                    /* unexpected keyword found */
-                    for (name=argnames; name != first_kw_arg; name++) {
-                        if (**name == key) goto arg_passed_twice;
-                        #if PY_MAJOR_VERSION >= 3
-                        if (PyUnicode_GET_SIZE(**name) == PyUnicode_GET_SIZE(key) &&
-                            PyUnicode_Compare(**name, key) == 0) goto arg_passed_twice;
-                        #else
-                        if (PyString_GET_SIZE(**name) == PyString_GET_SIZE(key) &&
-                            _PyString_Eq(**name, key)) goto arg_passed_twice;
-                        #endif
-                    }
-                    if (kwds2) {
-                        if (unlikely(PyDict_SetItem(kwds2, key, value))) goto bad;
-                    } else {
-                        goto invalid_keyword;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-arg_passed_twice:
-    __Pyx_RaiseDoubleKeywordsError(function_name, **name);
-    goto bad;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    goto bad;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-bad:
-    return -1;
-}
-
-static CYTHON_INLINE int __Pyx_CheckKeywordStrings(
-    PyObject *kwdict,
-    const char* function_name,
-    int kw_allowed)
-{
-    PyObject* key = 0;
-    Py_ssize_t pos = 0;
-    while (PyDict_Next(kwdict, &pos, &key, 0)) {
-        #if PY_MAJOR_VERSION < 3
-        if (unlikely(!PyString_CheckExact(key)) && unlikely(!PyString_Check(key)))
-        #else
-        if (unlikely(!PyUnicode_CheckExact(key)) && unlikely(!PyUnicode_Check(key)))
-        #endif
-            goto invalid_keyword_type;
-    }
-    if ((!kw_allowed) && unlikely(key))
-        goto invalid_keyword;
-    return 1;
-invalid_keyword_type:
-    PyErr_Format(PyExc_TypeError,
-        "%s() keywords must be strings", function_name);
-    return 0;
-invalid_keyword:
-    PyErr_Format(PyExc_TypeError,
-    #if PY_MAJOR_VERSION < 3
-        "%s() got an unexpected keyword argument '%s'",
-        function_name, PyString_AsString(key));
-    #else
-        "%s() got an unexpected keyword argument '%U'",
-        function_name, key);
-    #endif
-    return 0;
-}
-
-
-static CYTHON_INLINE void __Pyx_ExceptionSave(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->exc_type;
-    *value = tstate->exc_value;
-    *tb = tstate->exc_traceback;
-    Py_XINCREF(*type);
-    Py_XINCREF(*value);
-    Py_XINCREF(*tb);
-}
-
-static void __Pyx_ExceptionReset(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-    tmp_type = tstate->exc_type;
-    tmp_value = tstate->exc_value;
-    tmp_tb = tstate->exc_traceback;
-    tstate->exc_type = type;
-    tstate->exc_value = value;
-    tstate->exc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static PyObject *__Pyx_Import(PyObject *name, PyObject *from_list) {
-    PyObject *py_import = 0;
-    PyObject *empty_list = 0;
-    PyObject *module = 0;
-    PyObject *global_dict = 0;
-    PyObject *empty_dict = 0;
-    PyObject *list;
-    py_import = __Pyx_GetAttrString(__pyx_b, "__import__");
-    if (!py_import)
-        goto bad;
-    if (from_list)
-        list = from_list;
-    else {
-        empty_list = PyList_New(0);
-        if (!empty_list)
-            goto bad;
-        list = empty_list;
-    }
-    global_dict = PyModule_GetDict(__pyx_m);
-    if (!global_dict)
-        goto bad;
-    empty_dict = PyDict_New();
-    if (!empty_dict)
-        goto bad;
-    module = PyObject_CallFunctionObjArgs(py_import,
-        name, global_dict, empty_dict, list, NULL);
-bad:
-    Py_XDECREF(empty_list);
-    Py_XDECREF(py_import);
-    Py_XDECREF(empty_dict);
-    return module;
-}
-
-static PyObject* __Pyx_Method_ClassMethod(PyObject *method) {
-    /* It appears that PyMethodDescr_Type is not anywhere exposed in the Python/C API */
-    static PyTypeObject *methoddescr_type = NULL;
-    if (methoddescr_type == NULL) {
-       PyObject *meth = __Pyx_GetAttrString((PyObject*)&PyList_Type, "append");
-       if (!meth) return NULL;
-       methoddescr_type = Py_TYPE(meth);
-       Py_DECREF(meth);
-    }
-    if (PyObject_TypeCheck(method, methoddescr_type)) { /* cdef classes */
-        PyMethodDescrObject *descr = (PyMethodDescrObject *)method;
-        #if PY_VERSION_HEX < 0x03020000
-        PyTypeObject *d_type = descr->d_type;
-        #else
-        PyTypeObject *d_type = descr->d_common.d_type;
-        #endif
-        return PyDescr_NewClassMethod(d_type, descr->d_method);
-    }
-    else if (PyMethod_Check(method)) { /* python classes */
-        return PyClassMethod_New(PyMethod_GET_FUNCTION(method));
-    }
-    else if (PyCFunction_Check(method)) {
-        return PyClassMethod_New(method);
-    }
-#ifdef __pyx_binding_PyCFunctionType_USED
-    else if (PyObject_TypeCheck(method, __pyx_binding_PyCFunctionType)) { /* binded CFunction */
-        return PyClassMethod_New(method);
-    }
-#endif
-    PyErr_Format(PyExc_TypeError,
-                 "Class-level classmethod() can only be called on "
-                 "a method_descriptor or instance method.");
-    return NULL;
-}
-
-static CYTHON_INLINE void __Pyx_ErrRestore(PyObject *type, PyObject *value, PyObject *tb) {
-    PyObject *tmp_type, *tmp_value, *tmp_tb;
-    PyThreadState *tstate = PyThreadState_GET();
-
-    tmp_type = tstate->curexc_type;
-    tmp_value = tstate->curexc_value;
-    tmp_tb = tstate->curexc_traceback;
-    tstate->curexc_type = type;
-    tstate->curexc_value = value;
-    tstate->curexc_traceback = tb;
-    Py_XDECREF(tmp_type);
-    Py_XDECREF(tmp_value);
-    Py_XDECREF(tmp_tb);
-}
-
-static CYTHON_INLINE void __Pyx_ErrFetch(PyObject **type, PyObject **value, PyObject **tb) {
-    PyThreadState *tstate = PyThreadState_GET();
-    *type = tstate->curexc_type;
-    *value = tstate->curexc_value;
-    *tb = tstate->curexc_traceback;
-
-    tstate->curexc_type = 0;
-    tstate->curexc_value = 0;
-    tstate->curexc_traceback = 0;
-}
-
-
-#if PY_MAJOR_VERSION < 3
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb) {
-    Py_XINCREF(type);
-    Py_XINCREF(value);
-    Py_XINCREF(tb);
-    /* First, check the traceback argument, replacing None with NULL. */
-    if (tb == Py_None) {
-        Py_DECREF(tb);
-        tb = 0;
-    }
-    else if (tb != NULL && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto raise_error;
-    }
-    /* Next, replace a missing value with None */
-    if (value == NULL) {
-        value = Py_None;
-        Py_INCREF(value);
-    }
-    #if PY_VERSION_HEX < 0x02050000
-    if (!PyClass_Check(type))
-    #else
-    if (!PyType_Check(type))
-    #endif
-    {
-        /* Raising an instance.  The value should be a dummy. */
-        if (value != Py_None) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto raise_error;
-        }
-        /* Normalize to raise <class>, <instance> */
-        Py_DECREF(value);
-        value = type;
-        #if PY_VERSION_HEX < 0x02050000
-            if (PyInstance_Check(type)) {
-                type = (PyObject*) ((PyInstanceObject*)type)->in_class;
-                Py_INCREF(type);
-            }
-            else {
-                type = 0;
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception must be an old-style class or instance");
-                goto raise_error;
-            }
-        #else
-            type = (PyObject*) Py_TYPE(type);
-            Py_INCREF(type);
-            if (!PyType_IsSubtype((PyTypeObject *)type, (PyTypeObject *)PyExc_BaseException)) {
-                PyErr_SetString(PyExc_TypeError,
-                    "raise: exception class must be a subclass of BaseException");
-                goto raise_error;
-            }
-        #endif
-    }
-
-    __Pyx_ErrRestore(type, value, tb);
-    return;
-raise_error:
-    Py_XDECREF(value);
-    Py_XDECREF(type);
-    Py_XDECREF(tb);
-    return;
-}
-
-#else /* Python 3+ */
-
-static void __Pyx_Raise(PyObject *type, PyObject *value, PyObject *tb) {
-    if (tb == Py_None) {
-        tb = 0;
-    } else if (tb && !PyTraceBack_Check(tb)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: arg 3 must be a traceback or None");
-        goto bad;
-    }
-    if (value == Py_None)
-        value = 0;
-
-    if (PyExceptionInstance_Check(type)) {
-        if (value) {
-            PyErr_SetString(PyExc_TypeError,
-                "instance exception may not have a separate value");
-            goto bad;
-        }
-        value = type;
-        type = (PyObject*) Py_TYPE(value);
-    } else if (!PyExceptionClass_Check(type)) {
-        PyErr_SetString(PyExc_TypeError,
-            "raise: exception class must be a subclass of BaseException");
-        goto bad;
-    }
-
-    PyErr_SetObject(type, value);
-
-    if (tb) {
-        PyThreadState *tstate = PyThreadState_GET();
-        PyObject* tmp_tb = tstate->curexc_traceback;
-        if (tb != tmp_tb) {
-            Py_INCREF(tb);
-            tstate->curexc_traceback = tb;
-            Py_XDECREF(tmp_tb);
-        }
-    }
-
-bad:
-    return;
-}
-#endif
-
-static CYTHON_INLINE unsigned char __Pyx_PyInt_AsUnsignedChar(PyObject* x) {
-    const unsigned char neg_one = (unsigned char)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(unsigned char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned char)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to unsigned char" :
-                    "value too large to convert to unsigned char");
-            }
-            return (unsigned char)-1;
-        }
-        return (unsigned char)val;
-    }
-    return (unsigned char)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static CYTHON_INLINE unsigned short __Pyx_PyInt_AsUnsignedShort(PyObject* x) {
-    const unsigned short neg_one = (unsigned short)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(unsigned short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned short)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to unsigned short" :
-                    "value too large to convert to unsigned short");
-            }
-            return (unsigned short)-1;
-        }
-        return (unsigned short)val;
-    }
-    return (unsigned short)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static CYTHON_INLINE unsigned int __Pyx_PyInt_AsUnsignedInt(PyObject* x) {
-    const unsigned int neg_one = (unsigned int)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(unsigned int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(unsigned int)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to unsigned int" :
-                    "value too large to convert to unsigned int");
-            }
-            return (unsigned int)-1;
-        }
-        return (unsigned int)val;
-    }
-    return (unsigned int)__Pyx_PyInt_AsUnsignedLong(x);
-}
-
-static CYTHON_INLINE char __Pyx_PyInt_AsChar(PyObject* x) {
-    const char neg_one = (char)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(char)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to char" :
-                    "value too large to convert to char");
-            }
-            return (char)-1;
-        }
-        return (char)val;
-    }
-    return (char)__Pyx_PyInt_AsLong(x);
-}
-
-static CYTHON_INLINE short __Pyx_PyInt_AsShort(PyObject* x) {
-    const short neg_one = (short)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(short)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to short" :
-                    "value too large to convert to short");
-            }
-            return (short)-1;
-        }
-        return (short)val;
-    }
-    return (short)__Pyx_PyInt_AsLong(x);
-}
-
-static CYTHON_INLINE int __Pyx_PyInt_AsInt(PyObject* x) {
-    const int neg_one = (int)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(int)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to int" :
-                    "value too large to convert to int");
-            }
-            return (int)-1;
-        }
-        return (int)val;
-    }
-    return (int)__Pyx_PyInt_AsLong(x);
-}
-
-static CYTHON_INLINE signed char __Pyx_PyInt_AsSignedChar(PyObject* x) {
-    const signed char neg_one = (signed char)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(signed char) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed char)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to signed char" :
-                    "value too large to convert to signed char");
-            }
-            return (signed char)-1;
-        }
-        return (signed char)val;
-    }
-    return (signed char)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static CYTHON_INLINE signed short __Pyx_PyInt_AsSignedShort(PyObject* x) {
-    const signed short neg_one = (signed short)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(signed short) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed short)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to signed short" :
-                    "value too large to convert to signed short");
-            }
-            return (signed short)-1;
-        }
-        return (signed short)val;
-    }
-    return (signed short)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static CYTHON_INLINE signed int __Pyx_PyInt_AsSignedInt(PyObject* x) {
-    const signed int neg_one = (signed int)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(signed int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(signed int)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to signed int" :
-                    "value too large to convert to signed int");
-            }
-            return (signed int)-1;
-        }
-        return (signed int)val;
-    }
-    return (signed int)__Pyx_PyInt_AsSignedLong(x);
-}
-
-static CYTHON_INLINE int __Pyx_PyInt_AsLongDouble(PyObject* x) {
-    const int neg_one = (int)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-    if (sizeof(int) < sizeof(long)) {
-        long val = __Pyx_PyInt_AsLong(x);
-        if (unlikely(val != (long)(int)val)) {
-            if (!unlikely(val == -1 && PyErr_Occurred())) {
-                PyErr_SetString(PyExc_OverflowError,
-                    (is_unsigned && unlikely(val < 0)) ?
-                    "can't convert negative value to int" :
-                    "value too large to convert to int");
-            }
-            return (int)-1;
-        }
-        return (int)val;
-    }
-    return (int)__Pyx_PyInt_AsLong(x);
-}
-
-static CYTHON_INLINE unsigned long __Pyx_PyInt_AsUnsignedLong(PyObject* x) {
-    const unsigned long neg_one = (unsigned long)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (is_unsigned && unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned long");
-            return (unsigned long)-1;
-        }
-        return (unsigned long)val;
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-            if (unlikely(Py_SIZE(x) < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned long");
-                return (unsigned long)-1;
-            }
-            return PyLong_AsUnsignedLong(x);
-        } else {
-            return PyLong_AsLong(x);
-        }
-    } else {
-        unsigned long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned long)-1;
-        val = __Pyx_PyInt_AsUnsignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static CYTHON_INLINE unsigned PY_LONG_LONG __Pyx_PyInt_AsUnsignedLongLong(PyObject* x) {
-    const unsigned PY_LONG_LONG neg_one = (unsigned PY_LONG_LONG)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (is_unsigned && unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to unsigned PY_LONG_LONG");
-            return (unsigned PY_LONG_LONG)-1;
-        }
-        return (unsigned PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-            if (unlikely(Py_SIZE(x) < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to unsigned PY_LONG_LONG");
-                return (unsigned PY_LONG_LONG)-1;
-            }
-            return PyLong_AsUnsignedLongLong(x);
-        } else {
-            return PyLong_AsLongLong(x);
-        }
-    } else {
-        unsigned PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (unsigned PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsUnsignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static CYTHON_INLINE long __Pyx_PyInt_AsLong(PyObject* x) {
-    const long neg_one = (long)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (is_unsigned && unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to long");
-            return (long)-1;
-        }
-        return (long)val;
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-            if (unlikely(Py_SIZE(x) < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to long");
-                return (long)-1;
-            }
-            return PyLong_AsUnsignedLong(x);
-        } else {
-            return PyLong_AsLong(x);
-        }
-    } else {
-        long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (long)-1;
-        val = __Pyx_PyInt_AsLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static CYTHON_INLINE PY_LONG_LONG __Pyx_PyInt_AsLongLong(PyObject* x) {
-    const PY_LONG_LONG neg_one = (PY_LONG_LONG)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (is_unsigned && unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to PY_LONG_LONG");
-            return (PY_LONG_LONG)-1;
-        }
-        return (PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-            if (unlikely(Py_SIZE(x) < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to PY_LONG_LONG");
-                return (PY_LONG_LONG)-1;
-            }
-            return PyLong_AsUnsignedLongLong(x);
-        } else {
-            return PyLong_AsLongLong(x);
-        }
-    } else {
-        PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static CYTHON_INLINE signed long __Pyx_PyInt_AsSignedLong(PyObject* x) {
-    const signed long neg_one = (signed long)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (is_unsigned && unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to signed long");
-            return (signed long)-1;
-        }
-        return (signed long)val;
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-            if (unlikely(Py_SIZE(x) < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to signed long");
-                return (signed long)-1;
-            }
-            return PyLong_AsUnsignedLong(x);
-        } else {
-            return PyLong_AsLong(x);
-        }
-    } else {
-        signed long val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed long)-1;
-        val = __Pyx_PyInt_AsSignedLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-static CYTHON_INLINE signed PY_LONG_LONG __Pyx_PyInt_AsSignedLongLong(PyObject* x) {
-    const signed PY_LONG_LONG neg_one = (signed PY_LONG_LONG)-1, const_zero = 0;
-    const int is_unsigned = neg_one > const_zero;
-#if PY_VERSION_HEX < 0x03000000
-    if (likely(PyInt_Check(x))) {
-        long val = PyInt_AS_LONG(x);
-        if (is_unsigned && unlikely(val < 0)) {
-            PyErr_SetString(PyExc_OverflowError,
-                            "can't convert negative value to signed PY_LONG_LONG");
-            return (signed PY_LONG_LONG)-1;
-        }
-        return (signed PY_LONG_LONG)val;
-    } else
-#endif
-    if (likely(PyLong_Check(x))) {
-        if (is_unsigned) {
-            if (unlikely(Py_SIZE(x) < 0)) {
-                PyErr_SetString(PyExc_OverflowError,
-                                "can't convert negative value to signed PY_LONG_LONG");
-                return (signed PY_LONG_LONG)-1;
-            }
-            return PyLong_AsUnsignedLongLong(x);
-        } else {
-            return PyLong_AsLongLong(x);
-        }
-    } else {
-        signed PY_LONG_LONG val;
-        PyObject *tmp = __Pyx_PyNumber_Int(x);
-        if (!tmp) return (signed PY_LONG_LONG)-1;
-        val = __Pyx_PyInt_AsSignedLongLong(tmp);
-        Py_DECREF(tmp);
-        return val;
-    }
-}
-
-#ifndef __PYX_HAVE_RT_ImportType
-#define __PYX_HAVE_RT_ImportType
-static PyTypeObject *__Pyx_ImportType(const char *module_name, const char *class_name,
-    long size, int strict)
-{
-    PyObject *py_module = 0;
-    PyObject *result = 0;
-    PyObject *py_name = 0;
-    char warning[200];
-
-    py_module = __Pyx_ImportModule(module_name);
-    if (!py_module)
-        goto bad;
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(class_name);
-    #else
-    py_name = PyUnicode_FromString(class_name);
-    #endif
-    if (!py_name)
-        goto bad;
-    result = PyObject_GetAttr(py_module, py_name);
-    Py_DECREF(py_name);
-    py_name = 0;
-    Py_DECREF(py_module);
-    py_module = 0;
-    if (!result)
-        goto bad;
-    if (!PyType_Check(result)) {
-        PyErr_Format(PyExc_TypeError,
-            "%s.%s is not a type object",
-            module_name, class_name);
-        goto bad;
-    }
-    if (!strict && ((PyTypeObject *)result)->tp_basicsize > size) {
-        PyOS_snprintf(warning, sizeof(warning),
-            "%s.%s size changed, may indicate binary incompatibility",
-            module_name, class_name);
-        #if PY_VERSION_HEX < 0x02050000
-        PyErr_Warn(NULL, warning);
-        #else
-        PyErr_WarnEx(NULL, warning, 0);
-        #endif
-    }
-    else if (((PyTypeObject *)result)->tp_basicsize != size) {
-        PyErr_Format(PyExc_ValueError,
-            "%s.%s has the wrong size, try recompiling",
-            module_name, class_name);
-        goto bad;
-    }
-    return (PyTypeObject *)result;
-bad:
-    Py_XDECREF(py_module);
-    Py_XDECREF(result);
-    return 0;
-}
-#endif
-
-#ifndef __PYX_HAVE_RT_ImportModule
-#define __PYX_HAVE_RT_ImportModule
-static PyObject *__Pyx_ImportModule(const char *name) {
-    PyObject *py_name = 0;
-    PyObject *py_module = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_name = PyString_FromString(name);
-    #else
-    py_name = PyUnicode_FromString(name);
-    #endif
-    if (!py_name)
-        goto bad;
-    py_module = PyImport_Import(py_name);
-    Py_DECREF(py_name);
-    return py_module;
-bad:
-    Py_XDECREF(py_name);
-    return 0;
-}
-#endif
-
-#include "compile.h"
-#include "frameobject.h"
-#include "traceback.h"
-
-static void __Pyx_AddTraceback(const char *funcname) {
-    PyObject *py_srcfile = 0;
-    PyObject *py_funcname = 0;
-    PyObject *py_globals = 0;
-    PyCodeObject *py_code = 0;
-    PyFrameObject *py_frame = 0;
-
-    #if PY_MAJOR_VERSION < 3
-    py_srcfile = PyString_FromString(__pyx_filename);
-    #else
-    py_srcfile = PyUnicode_FromString(__pyx_filename);
-    #endif
-    if (!py_srcfile) goto bad;
-    if (__pyx_clineno) {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #else
-        py_funcname = PyUnicode_FromFormat( "%s (%s:%d)", funcname, __pyx_cfilenm, __pyx_clineno);
-        #endif
-    }
-    else {
-        #if PY_MAJOR_VERSION < 3
-        py_funcname = PyString_FromString(funcname);
-        #else
-        py_funcname = PyUnicode_FromString(funcname);
-        #endif
-    }
-    if (!py_funcname) goto bad;
-    py_globals = PyModule_GetDict(__pyx_m);
-    if (!py_globals) goto bad;
-    py_code = PyCode_New(
-        0,            /*int argcount,*/
-        #if PY_MAJOR_VERSION >= 3
-        0,            /*int kwonlyargcount,*/
-        #endif
-        0,            /*int nlocals,*/
-        0,            /*int stacksize,*/
-        0,            /*int flags,*/
-        __pyx_empty_bytes, /*PyObject *code,*/
-        __pyx_empty_tuple,  /*PyObject *consts,*/
-        __pyx_empty_tuple,  /*PyObject *names,*/
-        __pyx_empty_tuple,  /*PyObject *varnames,*/
-        __pyx_empty_tuple,  /*PyObject *freevars,*/
-        __pyx_empty_tuple,  /*PyObject *cellvars,*/
-        py_srcfile,   /*PyObject *filename,*/
-        py_funcname,  /*PyObject *name,*/
-        __pyx_lineno,   /*int firstlineno,*/
-        __pyx_empty_bytes  /*PyObject *lnotab*/
-    );
-    if (!py_code) goto bad;
-    py_frame = PyFrame_New(
-        PyThreadState_GET(), /*PyThreadState *tstate,*/
-        py_code,             /*PyCodeObject *code,*/
-        py_globals,          /*PyObject *globals,*/
-        0                    /*PyObject *locals*/
-    );
-    if (!py_frame) goto bad;
-    py_frame->f_lineno = __pyx_lineno;
-    PyTraceBack_Here(py_frame);
-bad:
-    Py_XDECREF(py_srcfile);
-    Py_XDECREF(py_funcname);
-    Py_XDECREF(py_code);
-    Py_XDECREF(py_frame);
-}
-
-static int __Pyx_InitStrings(__Pyx_StringTabEntry *t) {
-    while (t->p) {
-        #if PY_MAJOR_VERSION < 3
-        if (t->is_unicode) {
-            *t->p = PyUnicode_DecodeUTF8(t->s, t->n - 1, NULL);
-        } else if (t->intern) {
-            *t->p = PyString_InternFromString(t->s);
-        } else {
-            *t->p = PyString_FromStringAndSize(t->s, t->n - 1);
-        }
-        #else  /* Python 3+ has unicode identifiers */
-        if (t->is_unicode | t->is_str) {
-            if (t->intern) {
-                *t->p = PyUnicode_InternFromString(t->s);
-            } else if (t->encoding) {
-                *t->p = PyUnicode_Decode(t->s, t->n - 1, t->encoding, NULL);
-            } else {
-                *t->p = PyUnicode_FromStringAndSize(t->s, t->n - 1);
-            }
-        } else {
-            *t->p = PyBytes_FromStringAndSize(t->s, t->n - 1);
-        }
-        #endif
-        if (!*t->p)
-            return -1;
-        ++t;
-    }
-    return 0;
-}
-
-/* Type Conversion Functions */
-
-static CYTHON_INLINE int __Pyx_PyObject_IsTrue(PyObject* x) {
-   int is_true = x == Py_True;
-   if (is_true | (x == Py_False) | (x == Py_None)) return is_true;
-   else return PyObject_IsTrue(x);
-}
-
-static CYTHON_INLINE PyObject* __Pyx_PyNumber_Int(PyObject* x) {
-  PyNumberMethods *m;
-  const char *name = NULL;
-  PyObject *res = NULL;
-#if PY_VERSION_HEX < 0x03000000
-  if (PyInt_Check(x) || PyLong_Check(x))
-#else
-  if (PyLong_Check(x))
-#endif
-    return Py_INCREF(x), x;
-  m = Py_TYPE(x)->tp_as_number;
-#if PY_VERSION_HEX < 0x03000000
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Int(x);
-  }
-  else if (m && m->nb_long) {
-    name = "long";
-    res = PyNumber_Long(x);
-  }
-#else
-  if (m && m->nb_int) {
-    name = "int";
-    res = PyNumber_Long(x);
-  }
-#endif
-  if (res) {
-#if PY_VERSION_HEX < 0x03000000
-    if (!PyInt_Check(res) && !PyLong_Check(res)) {
-#else
-    if (!PyLong_Check(res)) {
-#endif
-      PyErr_Format(PyExc_TypeError,
-                   "__%s__ returned non-%s (type %.200s)",
-                   name, name, Py_TYPE(res)->tp_name);
-      Py_DECREF(res);
-      return NULL;
-    }
-  }
-  else if (!PyErr_Occurred()) {
-    PyErr_SetString(PyExc_TypeError,
-                    "an integer is required");
-  }
-  return res;
-}
-
-static CYTHON_INLINE Py_ssize_t __Pyx_PyIndex_AsSsize_t(PyObject* b) {
-  Py_ssize_t ival;
-  PyObject* x = PyNumber_Index(b);
-  if (!x) return -1;
-  ival = PyInt_AsSsize_t(x);
-  Py_DECREF(x);
-  return ival;
-}
-
-static CYTHON_INLINE PyObject * __Pyx_PyInt_FromSize_t(size_t ival) {
-#if PY_VERSION_HEX < 0x02050000
-   if (ival <= LONG_MAX)
-       return PyInt_FromLong((long)ival);
-   else {
-       unsigned char *bytes = (unsigned char *) &ival;
-       int one = 1; int little = (int)*(unsigned char*)&one;
-       return _PyLong_FromByteArray(bytes, sizeof(size_t), little, 0);
-   }
-#else
-   return PyInt_FromSize_t(ival);
-#endif
-}
-
-static CYTHON_INLINE size_t __Pyx_PyInt_AsSize_t(PyObject* x) {
-   unsigned PY_LONG_LONG val = __Pyx_PyInt_AsUnsignedLongLong(x);
-   if (unlikely(val == (unsigned PY_LONG_LONG)-1 && PyErr_Occurred())) {
-       return (size_t)-1;
-   } else if (unlikely(val != (unsigned PY_LONG_LONG)(size_t)val)) {
-       PyErr_SetString(PyExc_OverflowError,
-                       "value too large to convert to size_t");
-       return (size_t)-1;
-   }
-   return (size_t)val;
-}
-
-
-#endif /* Py_PYTHON_H */
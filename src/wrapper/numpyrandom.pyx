@@ -2,7 +2,7 @@ include "common.pxi"
 
 import numpy
 
-from dcmt.exceptions import DcmtError, DcmtParameterError
+from dcmt.exceptions import DcmtError, DcmtParameterError, DcmtTimeoutError
 
 cdef extern from "numpy/arrayobject.h":
 
@@ -114,13 +114,23 @@ cdef set_mt_struct_common_fields(mt_struct *mt, common_mt_dict):
 cdef class DcmtRandomState:
 
 	cdef mt_struct *mt
+	cdef dcmt_next_state_fn next_state
 
-	def __init__(self, *args, wordlen=32, exponent=521, id=0, gen_seed=None):
-		cdef int w, p, mid, sid
+	def __init__(self, *args, wordlen=32, exponent=521, id=0, gen_seed=None,
+			n_threads=None, period_check=None, timeout=None, tempering=None):
+		cdef int w, p, mid, sid, cancel
+		cdef dc_opts opts
+		cdef mt_struct *mt
 		validate_parameters(wordlen, exponent, id, id, &w, &p, &sid, &mid)
 		cdef uint32_t s = get_seed(gen_seed)
-
-		self.mt = get_mt_parameter_id_st(w, p, sid, s)
+		get_search_opts(&opts, &cancel, n_threads, period_check, timeout, tempering)
+
+		with nogil:
+			mt = get_mt_parameter_id_opt_st(w, p, sid, s, &opts)
+		self.set_mt(mt)
+		if self.mt == NULL:
+			search_stopped(cancel)
+			raise DcmtError("Failed to create RNG")
 		self.seed(*args)
 
 	def __dealloc__(self):
@@ -128,6 +138,12 @@ cdef class DcmtRandomState:
 			free_mt_struct(self.mt)
 			self.mt = NULL
 
+	cdef void set_mt(self, mt_struct *mt):
+		self.mt = mt
+		# the refill kernel depends only on the fields, it is chosen once
+		if mt != NULL:
+			self.next_state = dcmt_next_state_kernel(mt)
+
 	def __getstate__(self):
 		return self.get_state()
 
@@ -163,7 +179,7 @@ cdef class DcmtRandomState:
 		if obj.dimensions[0] != mt.nn:
 			raise ValueError("wrong state vector size")
 		memcpy(<void*>(mt.state), <void*>(obj.data), mt.nn * sizeof(uint32_t))
-		self.mt = mt
+		self.set_mt(mt)
 
 	def rand(self, *size):
 		if len(size) == 0:
@@ -173,7 +189,7 @@ cdef class DcmtRandomState:
 
 	def random_sample(self, size=None):
 		if size is None:
-			return PyFloat_FromDouble(random_float(self.mt))
+			return PyFloat_FromDouble(random_float(self.mt, self.next_state))
 		else:
 			array = numpy.empty(size, numpy.float64)
 			self.rand_fill(array)
@@ -183,7 +199,6 @@ cdef class DcmtRandomState:
 		cdef double *array_data
 		cdef ndarray array "arrayObject"
 		cdef long length
-		cdef long i
 
 		if not PyArray_Check(arr):
 			raise TypeError("function requires numpy array")
@@ -194,14 +209,13 @@ cdef class DcmtRandomState:
 
 		length = PyArray_SIZE(array)
 		array_data = <double *>array.data
-		for i in range(length):
-			array_data[i] = random_float(self.mt)
+		# same numbers as random_float() one by one
+		dcmt_fill_double(self.mt, array_data, length)
 
 	def randraw_fill(self, arr):
 		cdef uint32_t *array_data
 		cdef ndarray array "arrayObject"
 		cdef long length
-		cdef long i
 
 		if not PyArray_Check(arr):
 			raise TypeError("function requires numpy array")
@@ -212,15 +226,17 @@ cdef class DcmtRandomState:
 
 		length = PyArray_SIZE(array)
 		array_data = <uint32_t *>array.data
-		for i in range(length):
-			array_data[i] = random_uint32(self.mt)
+		dcmt_fill_uint32(self.mt, array_data, length)
 
 	@classmethod
-	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None):
-		cdef int i, count
+	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None, n_threads=None,
+			period_check=None, timeout=None, tempering=None):
+		cdef int i, count, cancel
 		cdef mt_struct **mts = NULL
+		cdef dc_opts opts
 
-		res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
+		get_search_opts(&opts, &cancel, n_threads, period_check, timeout, tempering)
+		res = create_mt_range(args, wordlen, exponent, gen_seed, &opts, &mts, &count)
 		if res != None:
 			return res
 
@@ -228,7 +244,7 @@ cdef class DcmtRandomState:
 		rngs = []
 		for i in range(count):
 			rng = <DcmtRandomState>cls.__new__(cls)
-			rng.mt = mts[i]
+			rng.set_mt(mts[i])
 			rng.seed()
 
 			rngs.append(rng)
@@ -263,7 +279,7 @@ cdef class DcmtRandomState:
 
 			mt.state = <uint32_t *>malloc(sizeof(uint32_t) * mt.nn)
 
-			rng.mt = mt
+			rng.set_mt(mt)
 			rng.seed()
 
 			rngs.append(rng)
@@ -271,14 +287,119 @@ cdef class DcmtRandomState:
 		return rngs
 
 
-def mt_range(*args, wordlen=32, exponent=521, gen_seed=None):
+cdef class DcmtRandomLanes:
+	"""
+	Generators of one range (see DcmtRandomState.range() and from_mt_range()) advanced together;
+	number j of generator l is element [j, l] of the results.
+	The generators are copied, drawing from the lanes does not advance them.
+	"""
+
+	cdef mt_lanes *lanes
+	cdef int count
+
+	def __init__(self, rngs):
+		cdef int i
+		cdef int count = len(rngs)
+		cdef mt_struct **mts
+
+		if count < 1:
+			raise DcmtParameterError("At least one generator is required")
+		mts = <mt_struct **>PyMem_Malloc(sizeof(mt_struct *) * count)
+		try:
+			for i in range(count):
+				mts[i] = (<DcmtRandomState?>rngs[i]).mt
+			self.lanes = new_mt_lanes(mts, count)
+		finally:
+			PyMem_Free(mts)
+		if self.lanes == NULL:
+			raise DcmtParameterError("The generators must be of one range and at the same position")
+		self.count = count
 
-	cdef int i, count
-	cdef mt_struct **mts = NULL
+	def __dealloc__(self):
+		if self.lanes != NULL:
+			free_mt_lanes(self.lanes)
+			self.lanes = NULL
+
+	def __len__(self):
+		return self.count
+
+	def rand(self, n):
+		array = numpy.empty((n, self.count), numpy.float64)
+		self.rand_fill(array)
+		return array
+
+	cdef long fill_rows(self, ndarray array) except -1:
+		cdef long length = PyArray_SIZE(array)
+		if length % self.count != 0:
+			raise ValueError("array size must be a multiple of the number of generators")
+		return length // self.count
+
+	def rand_fill(self, arr):
+		cdef ndarray array "arrayObject"
+		cdef long rows
+
+		if not PyArray_Check(arr):
+			raise TypeError("function requires numpy array")
+
+		array = <ndarray>arr
+		if array.descr.type_num != NPY_DOUBLE:
+			raise TypeError("function requires numpy array of type float64")
+
+		rows = self.fill_rows(array)
+		mt_lanes_fill_double(self.lanes, <double *>array.data, rows)
+
+	def randraw_fill(self, arr):
+		cdef ndarray array "arrayObject"
+		cdef long rows
+
+		if not PyArray_Check(arr):
+			raise TypeError("function requires numpy array")
+
+		array = <ndarray>arr
+		if array.descr.elsize != 4:
+			raise TypeError("function requires numpy array with 4-byte elements")
+
+		rows = self.fill_rows(array)
+		mt_lanes_fill_uint32(self.lanes, <uint32_t *>array.data, rows)
 
-	res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
-	if res != None:
-		return res
+# statistics of the search for every ID, see mt_range()
+_STATS_DTYPE = numpy.dtype([('id', numpy.int32), ('candidates', numpy.int64),
+	('rejected', numpy.int64), ('period_checks', numpy.int64), ('mask_nodes', numpy.int64),
+	('masks_pruned', numpy.int64), ('k_deficit', numpy.int32), ('prescreen_time', numpy.float64), ('period_time', numpy.float64),
+	('temper_time', numpy.float64)])
+
+cdef object get_stats_array(dc_stats *stats, int start_id, int count):
+
+	cdef int i
+	rows = []
+	for i in range(count):
+		rows.append((start_id + i, stats[i].candidates, stats[i].rejected,
+			stats[i].period_checks, stats[i].mask_nodes, stats[i].masks_pruned,
+			stats[i].k_deficit, stats[i].prescreen_time, stats[i].period_time, stats[i].temper_time))
+	return numpy.array(rows, _STATS_DTYPE)
+
+def mt_range(*args, wordlen=32, exponent=521, gen_seed=None, n_threads=None,
+		period_check=None, timeout=None, tempering=None, stats=False):
+
+	cdef int i, count, cancel
+	cdef mt_struct **mts = NULL
+	cdef dc_opts opts
+
+	get_search_opts(&opts, &cancel, n_threads, period_check, timeout, tempering)
+
+	start_id, stop_id = get_range_args(args)
+	# a wrong range is reported by create_mt_range()
+	if stats and 0 < stop_id - start_id <= 65536:
+		opts.stats = <dc_stats *>PyMem_Malloc(sizeof(dc_stats) * (stop_id - start_id))
+		if opts.stats == NULL:
+			raise MemoryError()
+	try:
+		res = create_mt_range(args, wordlen, exponent, gen_seed, &opts, &mts, &count)
+		if res != None:
+			return res
+		stats_array = get_stats_array(opts.stats, start_id, count) if stats else None
+	finally:
+		PyMem_Free(opts.stats)
 
 	common_fields = get_mt_struct_common_fields(mts[0])
 
@@ -294,4 +415,101 @@ def mt_range(*args, wordlen=32, exponent=521, gen_seed=None):
 
 	free_mt_struct_array(mts, count)
 
+	if stats:
+		return common_fields, unique_fields, stats_array
 	return common_fields, unique_fields
+
+
+cdef int take_one(mt_struct *mts, int id, void *arg) nogil:
+	"""Range search callback, which takes one generator and stops the search"""
+	(<mt_struct **>arg)[0] = mts
+	return 1
+
+cdef class MtRangeIterator:
+	"""Iterator returned by iter_mt_range()"""
+
+	cdef mt_range_search *search
+	cdef int cancel
+	cdef int busy # a search is running in some thread
+	cdef object params
+
+	def __cinit__(self):
+		self.search = NULL
+		self.busy = 0
+
+	def __dealloc__(self):
+		cdef mt_range_search *search = self.search
+		if search != NULL:
+			# waits for the threads searching ahead
+			with nogil:
+				free_mt_range_search(search)
+			self.search = NULL
+
+	def __iter__(self):
+		return self
+
+	def __next__(self):
+		cdef mt_struct *mt = NULL
+		cdef int id, res
+		cdef DcmtRandomState rng
+
+		if self.search == NULL:
+			raise StopIteration()
+
+		if self.busy:
+			raise DcmtError("iter_mt_range() iterator is already used by another thread")
+
+		cdef mt_range_search *search = self.search
+
+		id = mt_range_search_next_id(search)
+		self.cancel = 0
+		self.busy = 1
+		with nogil:
+			res = run_mt_range_search(search, take_one, &mt)
+		self.busy = 0
+
+		if res == MT_RANGE_DONE:
+			free_mt_range_search(self.search)
+			self.search = NULL
+			raise StopIteration()
+		elif res != MT_RANGE_STOPPED:
+			# the same ID is searched for again by the next call
+			search_stopped(self.cancel)
+			raise DcmtError("dcmt internal error: could not create RNG for id=" + str(id))
+
+		if self.params:
+			common_fields = get_mt_struct_common_fields(mt)
+			row = numpy.array([mt.aaa, mt.maskB, mt.maskC, <uint32_t>mt.i], numpy.uint32)
+			free_mt_struct(mt)
+			return id, common_fields, row
+
+		rng = <DcmtRandomState>DcmtRandomState.__new__(DcmtRandomState)
+		rng.set_mt(mt)
+		rng.seed()
+		return id, rng
+
+
+def iter_mt_range(*args, wordlen=32, exponent=521, gen_seed=None, n_threads=None,
+		period_check=None, timeout=None, tempering=None, params=False):
+
+	cdef int w, p, mid, sid
+	cdef dc_opts opts
+	cdef MtRangeIterator it = MtRangeIterator()
+
+	it.params = params
+	get_search_opts(&opts, &it.cancel, n_threads, period_check, timeout, tempering)
+
+	start_id, max_id = get_range_args(args)
+	max_id -= 1
+
+	if max_id < start_id:
+		return it
+
+	validate_parameters(wordlen, exponent, start_id, max_id, &w, &p, &sid, &mid)
+	cdef uint32_t s = get_seed(gen_seed)
+
+	it.search = new_mt_range_search(w, p, sid, mid, s, &opts)
+	if it.search == NULL:
+		raise MemoryError()
+
+	return it
@@ -2,22 +2,31 @@ include "common.pxi"
 
 from random import Random
 
-from dcmt.exceptions import DcmtError, DcmtParameterError
+from dcmt.exceptions import DcmtError, DcmtParameterError, DcmtTimeoutError
 
 
 cdef class RandomContainer:
 
 	cdef mt_struct *mt
+	cdef dcmt_next_state_fn next_state
 
 	def __init__(self):
 		self.mt = NULL
 
 	cdef void initWithStruct(self, mt_struct *mt):
 		self.mt = mt
-
-	cdef void initWithParams(self, int wordlen, int exponent, int id, uint32_t seed) except *:
-		self.mt = get_mt_parameter_id_st(wordlen, exponent, id, seed)
+		# the refill kernel depends only on the fields, it is chosen once
+		if mt != NULL:
+			self.next_state = dcmt_next_state_kernel(mt)
+
+	cdef void initWithParams(self, int wordlen, int exponent, int id, uint32_t seed,
+			dc_opts *opts) except *:
+		cdef mt_struct *mt
+		with nogil:
+			mt = get_mt_parameter_id_opt_st(wordlen, exponent, id, seed, opts)
+		self.initWithStruct(mt)
 		if self.mt == NULL:
+			search_stopped(opts.cancel[0])
 			raise DcmtError("Failed to create RNG")
 
 	def __dealloc__(self):
@@ -29,10 +38,10 @@ cdef class RandomContainer:
 		sgenrand(seed, self.mt)
 
 	cdef random(self):
-		return random_float(self.mt)
+		return random_float(self.mt, self.next_state)
 
 	cdef random_raw(self):
-		return random_uint32(self.mt)
+		return random_uint32(self.mt, self.next_state)
 
 	def jumpahead(self, n):
 
@@ -75,7 +84,7 @@ cdef class RandomContainer:
 		cdef int bitlen = bytelen * 8
 
 		for i in range(0, bytes, bytelen):
-			r = random_uint32(self.mt)
+			r = random_uint32(self.mt, self.next_state)
 			if k < bitlen:
 				r >>= (bitlen - k)
 
@@ -119,19 +128,22 @@ cdef class RandomContainer:
 		for i in range(mt.nn):
 			mt.state[i] = state_vec[i]
 
-		self.mt = mt
+		self.initWithStruct(mt)
 
 
 class DcmtRandom(Random):
 
-	def __init__(self, *args, wordlen=32, exponent=521, id=0, gen_seed=None):
-		cdef int w, p, mid, sid
+	def __init__(self, *args, wordlen=32, exponent=521, id=0, gen_seed=None,
+			n_threads=None, period_check=None, timeout=None, tempering=None):
+		cdef int w, p, mid, sid, cancel
+		cdef dc_opts opts
 		cdef uint32_t s = get_seed(gen_seed)
 
 		validate_parameters(wordlen, exponent, id, id, &w, &p, &sid, &mid)
+		get_search_opts(&opts, &cancel, n_threads, period_check, timeout, tempering)
 
 		cdef RandomContainer rc = <RandomContainer>RandomContainer()
-		rc.initWithParams(w, p, sid, s)
+		rc.initWithParams(w, p, sid, s, &opts)
 		self.rc = rc
 
 		self.seed(*args)
@@ -166,12 +178,15 @@ class DcmtRandom(Random):
 		rc.jumpahead(n)
 
 	@classmethod
-	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None):
+	def range(cls, *args, wordlen=32, exponent=521, gen_seed=None, n_threads=None,
+			period_check=None, timeout=None, tempering=None):
 
-		cdef int i, count
+		cdef int i, count, cancel
 		cdef mt_struct **mts = NULL
+		cdef dc_opts opts
 
-		res = create_mt_range(args, wordlen, exponent, gen_seed, &mts, &count)
+		get_search_opts(&opts, &cancel, n_threads, period_check, timeout, tempering)
+		res = create_mt_range(args, wordlen, exponent, gen_seed, &opts, &mts, &count)
 		if res != None:
 			return res
 
@@ -2,8 +2,13 @@ import unittest
 import numpy
 import gc
 import copy
+import os
+import tempfile
+import threading
 
-from dcmt import DcmtParameterError, DcmtError, DcmtRandom, DcmtRandomState, mt_range
+from dcmt import DcmtParameterError, DcmtError, DcmtTimeoutError, DcmtRandom, \
+	DcmtRandomState, DcmtRandomLanes, mt_range, iter_mt_range, set_cache_file, Catalog, \
+	write_catalog, search_async
 
 
 def testLimits(randoms, start, stop):
@@ -22,6 +27,50 @@ def getRandomArray(rng, N):
 		return rng.rand(N)
 
 
+# Numbers of the original scalar genrand_mt() for fixed parameters, seeded with
+# 4172 by DcmtRandomState.seed(): the first four of 3 * nn + 7 and the sum of all
+# of them modulo 2 ** 32.  The states of 521 and 607 are regenerated by the kernels
+# compiled for their sizes, the others by the SIMD ones; the parameters of 19937
+# and 44497 are the matrix and tempering constants of MT19937.
+KNOWN_ANSWERS = [
+	# w=32, p=521
+	(dict(mm=8, nn=17, rr=23, ww=32, wmask=0xffffffff, umask=0xff800000, lmask=0x007fffff,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0x83c30001, 0x76b15f80, 0xfdd50000],
+		[0x7428570e, 0x106cc169, 0xf883afa9, 0x7bee8b73], 0xaaf41501),
+	# w=31, p=521
+	(dict(mm=8, nn=17, rr=6, ww=31, wmask=0x7fffffff, umask=0x7fffffc0, lmask=0x0000003f,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0x7f1f0002, 0x76aadf80, 0x3de98000],
+		[0x703d872f, 0x6f41eefe, 0x6af1a6fb, 0x763bf22b], 0x5f5f42d6),
+	# w=32, p=607
+	(dict(mm=9, nn=19, rr=1, ww=32, wmask=0xffffffff, umask=0xfffffffe, lmask=0x00000001,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0xf8770003, 0xdced7780, 0xed748000],
+		[0xd41e5182, 0x76789a4e, 0x064e071e, 0x8958252b], 0x676499ba),
+	# w=31, p=607
+	(dict(mm=10, nn=20, rr=13, ww=31, wmask=0x7fffffff, umask=0x7fffe000, lmask=0x00001fff,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0x4eba0004, 0x649ddb80, 0x5feb8000],
+		[0x31c60e68, 0x4aa17411, 0x6d309803, 0x4611d983], 0x3c55229b),
+	# w=32, p=19937
+	(dict(mm=312, nn=624, rr=31, ww=32, wmask=0xffffffff, umask=0x80000000, lmask=0x7fffffff,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0x9908b0df, 0x9d2c5680, 0xefc60000],
+		[0x5037d29d, 0x0e3b50e8, 0x74484595, 0x6bd79b0f], 0x70c85c59),
+	# w=31, p=19937
+	(dict(mm=322, nn=644, rr=27, ww=31, wmask=0x7fffffff, umask=0x78000000, lmask=0x07ffffff,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0x1908b0df, 0x4e962b40, 0x77e30000],
+		[0x204724f0, 0x04cd1eff, 0x38f0384a, 0x5bf9ee8e], 0x140a9ac2),
+	# w=32, p=44497
+	(dict(mm=695, nn=1391, rr=15, ww=32, wmask=0xffffffff, umask=0xffff8000, lmask=0x00007fff,
+		shift0=12, shift1=18, shiftB=7, shiftC=15),
+		[0x9908b0df, 0x9d2c5680, 0xefc60000],
+		[0x821cd0eb, 0x41f091f7, 0x4b89be84, 0x44ca2e2d], 0xe3fcb1a5),
+]
+
+
 class TestErrors(unittest.TestCase):
 
 	def testWordlen(self):
@@ -108,6 +157,91 @@ class TestErrors(unittest.TestCase):
 		self.assertRaises(DcmtParameterError, mt_range, 65534, 65539, gen_seed=1)
 		self.assertRaises(DcmtParameterError, mt_range, 65536, 65539, gen_seed=1)
 
+	def testThreads(self):
+
+		tests = (
+			(DcmtRandom, ()),
+			(DcmtRandom.range, (2,)),
+			(DcmtRandomState, ()),
+			(DcmtRandomState.range, (2,)),
+			(mt_range, (2,))
+		)
+
+		for func, args in tests:
+			# correct
+			for n_threads in (None, 1, 3):
+				func(*args, gen_seed=1, n_threads=n_threads)
+
+			# incorrect
+			for n_threads in (0, -1, 2000, 1.5, "2"):
+				self.assertRaises(DcmtParameterError, func, *args,
+					gen_seed=1, n_threads=n_threads)
+
+	def testPeriodCheck(self):
+
+		tests = (
+			(DcmtRandom, ()),
+			(DcmtRandom.range, (2,)),
+			(DcmtRandomState, ()),
+			(DcmtRandomState.range, (2,)),
+			(mt_range, (2,))
+		)
+
+		for func, args in tests:
+			# correct
+			for period_check in (None, 'decimation', 'bm', 'bitsliced'):
+				func(*args, gen_seed=1, period_check=period_check)
+
+			# incorrect
+			for period_check in ('', 'BM', 1, []):
+				self.assertRaises(DcmtParameterError, func, *args,
+					gen_seed=1, period_check=period_check)
+
+	def testTempering(self):
+
+		tests = (
+			(DcmtRandom, ()),
+			(DcmtRandom.range, (2,)),
+			(DcmtRandomState, ()),
+			(DcmtRandomState.range, (2,)),
+			(mt_range, (2,))
+		)
+
+		for func, args in tests:
+			# correct
+			for tempering in (None, 'greedy', 'hard', 0, 5, 31):
+				func(*args, gen_seed=1, tempering=tempering)
+
+			# incorrect
+			for tempering in ('', 'Hard', -1, 32, 1.5, []):
+				self.assertRaises(DcmtParameterError, func, *args,
+					gen_seed=1, tempering=tempering)
+
+	def testTimeout(self):
+
+		tests = (
+			(DcmtRandom, ()),
+			(DcmtRandom.range, (2,)),
+			(DcmtRandomState, ()),
+			(DcmtRandomState.range, (2,)),
+			(mt_range, (2,))
+		)
+
+		for func, args in tests:
+			# correct
+			for timeout in (None, 100, 100.0):
+				func(*args, gen_seed=1, timeout=timeout)
+
+			# incorrect
+			for timeout in (0, -1, "1", []):
+				self.assertRaises(DcmtParameterError, func, *args,
+					gen_seed=1, timeout=timeout)
+
+			# a search for p=44497 takes minutes
+			for n_threads in (None, 2):
+				self.assertRaises(DcmtTimeoutError, func, *args, gen_seed=1,
+					exponent=44497, n_threads=n_threads, timeout=0.1)
+
 	def testBugId9(self):
 
 		kwds = dict(wordlen=31, exponent=521, gen_seed=1)
@@ -215,6 +349,19 @@ class TestBasics(unittest.TestCase):
 
 			self.assert_((randoms0 == randoms1).all())
 
+	def testThreadsDeterminism(self):
+		"""Check that a single RNG does not depend on the number of search threads"""
+		kwds = dict(id=10, gen_seed=100, exponent=1279)
+
+		for cls in (DcmtRandom, DcmtRandomState):
+			for period_check in (None, 'bm', 'bitsliced'):
+				rng0 = cls(300, period_check=period_check, **kwds)
+				randoms0 = getRandomArray(rng0, 10)
+				for n_threads in (2, 4):
+					rng = cls(300, n_threads=n_threads, period_check=period_check, **kwds)
+					randoms = getRandomArray(rng, 10)
+					self.assert_((randoms0 == randoms).all())
+
 	def testRangeMethod(self):
 		gen_id = 10
 		seed = 100
@@ -274,6 +421,64 @@ class TestBasics(unittest.TestCase):
 			self.assert_((randoms0 == randoms1).all())
 			self.assert_((randoms0 == randoms2).all())
 
+	def testSearchAsync(self):
+		"""Check that background searches give the same RNGs and do not block other threads"""
+		kwds = dict(exponent=2203, gen_seed=400)
+
+		ticks = []
+		stop = threading.Event()
+		def tick():
+			while not stop.is_set():
+				ticks.append(1)
+				stop.wait(0.01)
+		thread = threading.Thread(target=tick)
+		thread.start()
+
+		futures = [search_async(mt_range, 2, **kwds), search_async(DcmtRandom, id=3, **kwds)]
+		mt_common, mt_unique = futures[0].result()
+		rng = futures[1].result()
+		stop.set()
+		thread.join()
+
+		mt_common1, mt_unique1 = mt_range(2, **kwds)
+		self.assertEqual(mt_common, mt_common1)
+		self.assert_((mt_unique[:, :3] == mt_unique1[:, :3]).all())
+		# RNG parameters, without the state
+		self.assertEqual(rng.getstate()[1][:14], DcmtRandom(id=3, **kwds).getstate()[1][:14])
+		self.assert_(len(ticks) > 1)
+
+		self.assertRaises(DcmtParameterError, search_async(mt_range, 2, wordlen=30).result)
+
+	def testCache(self):
+		"""Check that cached RNGs are the same as the found ones"""
+		self.assertRaises(DcmtParameterError, set_cache_file, 1)
+
+		fd, fname = tempfile.mkstemp()
+		os.close(fd)
+		os.remove(fname)
+
+		ref_common, ref_unique = mt_range(3, 7, gen_seed=20)
+		ref_common_mt, ref_unique_mt = mt_range(3, 7, gen_seed=20, n_threads=2)
+		ref_single = getRandomArray(DcmtRandomState(1, id=5, gen_seed=20), 10)
+
+		set_cache_file(fname)
+		try:
+			for i in xrange(2): # fill the cache, then read from it
+				mt_common, mt_unique = mt_range(3, 7, gen_seed=20)
+				self.assertEqual(mt_common, ref_common)
+				self.assert_((mt_unique[:, :3] == ref_unique[:, :3]).all())
+
+				mt_common, mt_unique = mt_range(3, 7, gen_seed=20, n_threads=2)
+				self.assertEqual(mt_common, ref_common_mt)
+				self.assert_((mt_unique[:, :3] == ref_unique_mt[:, :3]).all())
+
+				for cls in (DcmtRandom, DcmtRandomState):
+					randoms = getRandomArray(cls(1, id=5, gen_seed=20), 10)
+					self.assert_((randoms == ref_single).all())
+		finally:
+			set_cache_file(None)
+			os.remove(fname)
+
 
 class TestRandom(unittest.TestCase):
 
@@ -325,6 +530,145 @@ class TestRandomState(unittest.TestCase):
 			randoms1 = getRandomArray(rng1, N)
 			self.assert_((randoms0 == randoms1).all())
 
+	def testMtRangeThreads(self):
+		"""Check that parallel search result does not depend on the number of threads"""
+		kwds = dict(exponent=521, gen_seed=100)
+
+		mt_common1, mt_unique1 = mt_range(1, 7, n_threads=1, **kwds)
+		for n_threads in (2, 4, 8):
+			mt_common, mt_unique = mt_range(1, 7, n_threads=n_threads, **kwds)
+			self.assertEqual(mt_common, mt_common1)
+			self.assert_((mt_unique[:, :3] == mt_unique1[:, :3]).all())
+
+	def testMtRangePeriodCheck(self):
+		"""Check that all period check engines accept the same candidates"""
+		for wordlen, exponent in ((32, 521), (31, 607), (32, 1279)):
+			kwds = dict(wordlen=wordlen, exponent=exponent, gen_seed=200)
+			for n_threads in (None, 2):
+				mt_common1, mt_unique1 = mt_range(10, 16, n_threads=n_threads,
+					period_check='decimation', **kwds)
+				for period_check in ('bm', 'bitsliced'):
+					mt_common, mt_unique = mt_range(10, 16, n_threads=n_threads,
+						period_check=period_check, **kwds)
+					self.assertEqual(mt_common, mt_common1)
+					self.assert_((mt_unique[:, :3] == mt_unique1[:, :3]).all())
+
+	def testMtRangeStats(self):
+		"""Check the search statistics returned by mt_range()"""
+		kwds = dict(exponent=607, gen_seed=400)
+		for n_threads in (None, 2):
+			mt_common1, mt_unique1 = mt_range(5, 9, n_threads=n_threads, **kwds)
+			mt_common, mt_unique, stats = mt_range(5, 9, n_threads=n_threads,
+				stats=True, **kwds)
+			self.assertEqual(mt_common, mt_common1)
+			self.assert_((mt_unique[:, :3] == mt_unique1[:, :3]).all())
+
+			self.assertEqual(list(stats['id']), [5, 6, 7, 8])
+			self.assert_((stats['candidates'] ==
+				stats['rejected'] + stats['period_checks']).all())
+			self.assert_((stats['period_checks'] > 0).all())
+			self.assert_((stats['mask_nodes'] > 0).all())
+			self.assert_((stats['masks_pruned'] >= 0).all())
+			for field in ('prescreen_time', 'period_time', 'temper_time'):
+				self.assert_((stats[field] >= 0).all())
+
+	def testMtRangeStatsThreads(self):
+		"""Check that the search statistics do not depend on the number of threads"""
+		kwds = dict(exponent=607, gen_seed=400, stats=True)
+		fields = ('id', 'candidates', 'rejected', 'period_checks',
+			'mask_nodes', 'masks_pruned', 'k_deficit')
+		stats1 = mt_range(5, 9, n_threads=1, **kwds)[2]
+		for period_check in ('decimation', 'bitsliced'):
+			for n_threads in (1, 2, 4):
+				stats = mt_range(5, 9, n_threads=n_threads,
+					period_check=period_check, **kwds)[2]
+				for field in fields:
+					self.assert_((stats[field] == stats1[field]).all())
+
+	def testMtRangeTempering(self):
+		"""Check that the tempering effort changes only the tempering masks"""
+		kwds = dict(exponent=521, gen_seed=500)
+		mt_common1, mt_unique1, stats1 = mt_range(0, 6, tempering='hard', stats=True, **kwds)
+		mt_common, mt_unique, stats = mt_range(0, 6, stats=True, **kwds)
+		self.assert_((mt_unique[:, :3] == mt_unique1[:, :3]).all())
+		self.assert_((stats['k_deficit'] == stats1['k_deficit']).all())
+
+		mt_common2, mt_unique2 = mt_range(0, 6, tempering=0, **kwds)
+		for tempering in ('greedy', 10):
+			mt_common, mt_unique, stats = mt_range(0, 6, tempering=tempering,
+				stats=True, **kwds)
+			self.assertEqual(mt_common, mt_common1)
+			self.assert_((mt_unique[:, 0] == mt_unique1[:, 0]).all())
+			self.assert_((stats['k_deficit'] >= 0).all())
+			if tempering == 'greedy':
+				self.assert_((mt_unique[:, :3] == mt_unique2[:, :3]).all())
+				self.assert_((stats['mask_nodes'] == 0).all())
+
+	def testIterMtRange(self):
+		"""Check that iter_mt_range() yields the same RNGs as mt_range()"""
+		kwds = dict(exponent=521, gen_seed=300)
+		for n_threads in (None, 2):
+			mt_common1, mt_unique1 = mt_range(3, 9, n_threads=n_threads, **kwds)
+
+			ids = []
+			for id, mt_common, row in iter_mt_range(3, 9, n_threads=n_threads,
+					params=True, **kwds):
+				ids.append(id)
+				self.assertEqual(mt_common, mt_common1)
+				self.assert_((row[:3] == mt_unique1[id - 3, :3]).all())
+			self.assertEqual(ids, list(range(3, 9)))
+
+			rngs = DcmtRandomState.from_mt_range(mt_common1, mt_unique1)
+			for (id, rng), rng1 in zip(iter_mt_range(3, 9, n_threads=n_threads, **kwds), rngs):
+				rng.seed(1)
+				rng1.seed(1)
+				self.assert_((rng.rand(10) == rng1.rand(10)).all())
+
+			# stopping in the middle
+			for id, rng in iter_mt_range(3, 9, n_threads=n_threads, **kwds):
+				break
+
+		self.assertEqual(list(iter_mt_range(5, 5, **kwds)), [])
+
+	def testCatalog(self):
+		fd, fname = tempfile.mkstemp()
+		os.close(fd)
+
+		try:
+			self.assertRaises(DcmtParameterError, write_catalog, fname, 3, 9)
+			for n_threads in (None, 2):
+				kwds = dict(gen_seed=30, n_threads=n_threads)
+				write_catalog(fname, 3, 9, **kwds)
+				catalog = Catalog(fname)
+				self.assertEqual(len(catalog), 6)
+
+				ref_common, ref_unique = mt_range(3, 9, **kwds)
+				mt_common, mt_unique = catalog.mt_range(3, 9)
+				self.assertEqual(mt_common, ref_common)
+				self.assert_((mt_unique[:, :3] == ref_unique[:, :3]).all())
+				# one argument starts at start_id
+				self.assert_((catalog.mt_range(9)[1] == mt_unique).all())
+				self.assert_(catalog.check())
+				self.assertFalse(os.path.exists(fname + '.tmp'))
+
+				ref = DcmtRandomState.from_mt_range(ref_common, ref_unique[2:3])[0]
+				ref.seed(1)
+				rng = catalog.random_state(5, seed=1)
+				self.assert_((rng.rand(10) == ref.rand(10)).all())
+
+				self.assertRaises(DcmtParameterError, catalog.random_state, 9)
+				del catalog, mt_unique
+
+			# a corrupt record passes the header check
+			with open(fname, 'r+b') as f:
+				f.seek(-16, 2)
+				f.write(b'\xff' * 4)
+			catalog = Catalog(fname)
+			self.assertFalse(catalog.check())
+			del catalog
+		finally:
+			os.remove(fname)
+
 	def testRandFill(self):
 		shape = (9, 10, 11)
 		rng = DcmtRandomState(gen_seed=900)
@@ -356,6 +700,63 @@ class TestRandomState(unittest.TestCase):
 			randoms = numpy.empty(shape, dtype)
 			rng.randraw_fill(randoms)
 
+	def testFillPartialBlock(self):
+		"""Check that the fills continue the sequence of single randoms"""
+		for exponent in (521, 2203):
+			rng = DcmtRandomState(gen_seed=900, exponent=exponent)
+			rng1 = DcmtRandomState(gen_seed=900, exponent=exponent)
+			rng.seed(400)
+			rng1.seed(400)
+
+			head = [rng.rand() for i in xrange(7)]
+			randoms = numpy.empty(1000, numpy.float64)
+			rng.rand_fill(randoms)
+			randoms1 = rng1.rand(1007)
+			self.assertEqual(head, list(randoms1[:7]))
+			self.assert_((randoms == randoms1[7:]).all())
+
+			rng.randraw_fill(numpy.empty(5, numpy.uint32))
+			rng1.randraw_fill(numpy.empty(5, numpy.uint32))
+			self.assertEqual(rng.rand(), rng1.rand())
+
+	def testKnownAnswers(self):
+		"""Check the fills against the numbers of the original generator"""
+		for mt_common, mt_unique, head, total in KNOWN_ANSWERS:
+			rng, = DcmtRandomState.from_mt_range(mt_common,
+				numpy.array([mt_unique + [0]], numpy.uint32))
+			rng.seed(4172)
+			randoms = numpy.empty(3 * mt_common['nn'] + 7, numpy.uint32)
+			rng.randraw_fill(randoms)
+			self.assertEqual(list(randoms[:4]), head)
+			self.assertEqual(int(randoms.sum(dtype=numpy.uint64)) & 0xFFFFFFFF, total)
+
+	def testLanes(self):
+		"""Check that the lanes give the numbers of every generator"""
+		for count in (5, 16):
+			mt_common, mt_unique = mt_range(0, count, gen_seed=100)
+			rngs = DcmtRandomState.from_mt_range(mt_common, mt_unique)
+			for i, rng in enumerate(rngs):
+				rng.seed(i)
+			lanes = DcmtRandomLanes(rngs)
+			self.assertEqual(len(lanes), count)
+
+			randoms = lanes.rand(1000)
+			raw = numpy.empty((7, count), numpy.uint32)
+			lanes.randraw_fill(raw)
+			for i, rng in enumerate(rngs):
+				self.assert_((randoms[:, i] == rng.rand(1000)).all())
+				raw1 = numpy.empty(7, numpy.uint32)
+				rng.randraw_fill(raw1)
+				self.assert_((raw[:, i] == raw1).all())
+
+		rngs = DcmtRandomState.range(0, 2, gen_seed=100)
+		rngs[0].rand()
+		self.assertRaises(DcmtParameterError, DcmtRandomLanes, rngs)
+		rngs.append(DcmtRandomState(exponent=607))
+		self.assertRaises(DcmtParameterError, DcmtRandomLanes, rngs[1:])
+		self.assertRaises(ValueError, DcmtRandomLanes(rngs[1:2] * 2).rand_fill,
+			numpy.empty(3, numpy.float64))
+
 	def testSingleRandom(self):
 		shape = (9, 10, 11)
 		rng = DcmtRandomState(gen_seed=900)
@@ -394,4 +795,6 @@ if __name__ == '__main__':
 		'../src/wrapper/numpyrandom.c'
 	]
 	for fname in cython_files:
-		print "File: " + fname + ": " + str(getLineCount(fname)) + " lines"
+		# generated by the build, see setup.py
+		if os.path.exists(fname):
+			print "File: " + fname + ": " + str(getLineCount(fname)) + " lines"